@@ -17,6 +17,7 @@
 namespace py = pybind11;
 #include <pybind11/stl.h>
 #include <pybind11/stl_bind.h>
+#include <pybind11/numpy.h>
 
 #include <gridpack/environment/environment.hpp>
 #include <gridpack/configuration/no_print.hpp>
@@ -461,6 +462,27 @@ PYBIND11_MODULE(gridpack, gpm) {
     .def("getGeneratorTimeSeries",
          &gpds::DSFullApp::getGeneratorTimeSeries,
          py::return_value_policy::copy)
+    .def("setTimeSeriesOptions", &gpds::DSFullApp::setTimeSeriesOptions,
+         py::arg("decimation") = 1,
+         py::arg("filename") = std::string(""),
+         py::arg("chunk") = 1000)
+    .def("getGeneratorTimeSeriesArray",
+         [](gpds::DSFullApp& self) -> py::object {
+           const gpds::TimeSeriesRecorder& rec(self.getTimeSeriesRecorder());
+           size_t nsignals(rec.numSignals());
+           size_t nsteps(rec.numSteps());
+           py::array_t<double> times(nsteps);
+           py::array_t<double> values({nsignals, nsteps});
+           if (nsteps > 0) {
+             std::copy(rec.times(), rec.times() + nsteps,
+                       times.mutable_data());
+             for (size_t i = 0; i < nsignals; ++i) {
+               const double *src(rec.data() + i*rec.stride());
+               std::copy(src, src + nsteps, values.mutable_data(i, 0));
+             }
+           }
+           return py::make_tuple(times, values);
+         })
     .def("getListWatchedGenerators",
          [](gpds::DSFullApp& self) -> py::object {
            std::vector<int> bus_ids;
@@ -34,8 +34,11 @@
  * @param comm communicator on which StatBlock is defined
  * @param nrows number of rows in data array
  * @param ncols number of columns in data array
+ * @param streaming if true, do not store the table but accumulate running
+ *        statistics for each row in a StreamingStatBlock
  */
-stb::StatBlock(const parallel::Communicator &comm, int nrows, int ncols)
+stb::StatBlock(const parallel::Communicator &comm, int nrows, int ncols,
+    bool streaming)
 {
   int one = 1;
   int two = 2;
@@ -50,6 +53,10 @@ stb::StatBlock(const parallel::Communicator &comm, int nrows, int ncols)
   p_comm = static_cast<MPI_Comm>(comm);
   p_GAgrp = comm.getGroup();
   p_branch_flag = false;
+  if (streaming) {
+    p_stream.reset(new StreamingStatBlock(comm,nrows,ncols));
+    return;
+  }
 
   // Create data and mask arrays
   dims[0] = nrows;
@@ -90,6 +97,7 @@ stb::StatBlock(const parallel::Communicator &comm, int nrows, int ncols)
  */
 stb::~StatBlock(void)
 {
+  if (p_stream) return;
   NGA_Deregister_type(p_type);
   GA_Destroy(p_data);
   GA_Destroy(p_mask);
@@ -105,6 +113,10 @@ stb::~StatBlock(void)
  */
 void stb::addColumnValues(int idx, std::vector<double> vals, std::vector<int> mask)
 {
+  if (p_stream) {
+    p_stream->addColumnValues(idx,vals,mask);
+    return;
+  }
   if (idx <p_ncols && idx >= 0) {
     int lo[2];
     int hi[2];
@@ -128,6 +140,10 @@ void stb::addColumnValues(int idx, std::vector<double> vals, std::vector<int> ma
  */
 void stb::addRowLabels(std::vector<int> indices, std::vector<std::string> tags)
 {
+  if (p_stream) {
+    p_stream->addRowLabels(indices,tags);
+    return;
+  }
   std::vector<stb::index_set> tagvec;
   gridpack::utility::StringUtils util;
   if (indices.size() != p_nrows) {
@@ -169,6 +185,10 @@ void stb::addRowLabels(std::vector<int> indices, std::vector<std::string> tags)
 void stb::addRowLabels(std::vector<int> idx1, std::vector<int> idx2,
     std::vector<std::string> tags)
 {
+  if (p_stream) {
+    p_stream->addRowLabels(idx1,idx2,tags);
+    return;
+  }
   p_branch_flag = true;
   std::vector<stb::index_set> tagvec;
   gridpack::utility::StringUtils util;
@@ -232,6 +252,10 @@ void stb::addRowLabels(std::vector<int> idx1, std::vector<int> idx2,
  */
 void stb::addRowMinValue(std::vector<double> min)
 {
+  if (p_stream) {
+    p_stream->addRowMinValue(min);
+    return;
+  }
   if (min.size() != p_nrows) {
     printf("NROWS: %d min.size: %d\n",p_nrows,(int)min.size());
     // TODO: Some kind of error
@@ -252,6 +276,10 @@ void stb::addRowMinValue(std::vector<double> min)
  */
 void stb::addRowMaxValue(std::vector<double> max)
 {
+  if (p_stream) {
+    p_stream->addRowMaxValue(max);
+    return;
+  }
   if (max.size() != p_nrows) {
     printf("NROWS: %d min.size: %d\n",p_nrows,(int)max.size());
     // TODO: Some kind of error
@@ -266,6 +294,209 @@ void stb::addRowMaxValue(std::vector<double> max)
   p_max_bound = true;
 }
 
+/**
+ * Add values for a subset of rows in a column. Unlike addColumnValues,
+ * this can be called from any process with the values that are available
+ * locally, so that each process only contributes the rows it owns.
+ * @param idx index of column
+ * @param rows vector of row indices
+ * @param vals vector of values corresponding to rows
+ * @param mask vector of mask values corresponding to rows
+ */
+void stb::scatterColumnValues(int idx, const std::vector<int> &rows,
+    const std::vector<double> &vals, const std::vector<int> &mask)
+{
+  if (p_stream) {
+    p_stream->scatterColumnValues(idx,rows,vals,mask);
+    return;
+  }
+  if (idx >= p_ncols || idx < 0) {
+    printf("IDX: %d NCOLS: %d\n",idx,p_ncols);
+    // TODO: Some kind of error
+    return;
+  }
+  int nvals = rows.size();
+  if (vals.size() != nvals || mask.size() != nvals) {
+    printf("rows.size: %d vals.size: %d mask.size: %d\n",nvals,
+        (int)vals.size(),(int)mask.size());
+    // TODO: Some kind of error
+    return;
+  }
+  if (nvals == 0) return;
+  std::vector<int> subs(2*nvals);
+  std::vector<int*> index(nvals);
+  int i;
+  for (i=0; i<nvals; i++) {
+    subs[2*i] = rows[i];
+    subs[2*i+1] = idx;
+    index[i] = &subs[2*i];
+  }
+  NGA_Scatter(p_data,const_cast<double*>(&vals[0]),&index[0],nvals);
+  NGA_Scatter(p_mask,const_cast<int*>(&mask[0]),&index[0],nvals);
+}
+
+/**
+ * Add index and device tag labels for a subset of rows. This can be called
+ * from any process.
+ * @param rows vector of row indices
+ * @param indices vector of indices
+ * @param tags  vector of character tags
+ */
+void stb::scatterRowLabels(const std::vector<int> &rows,
+    const std::vector<int> &indices, const std::vector<std::string> &tags)
+{
+  std::vector<int> idx2;
+  scatterTags(rows, indices, idx2, tags);
+}
+
+/**
+ * Add two branch indices and device tag labels for a subset of rows. This
+ * can be called from any process.
+ * @param rows vector of row indices
+ * @param idx1 vector of index 1
+ * @param idx2 vector of index 2
+ * @param tags  vector of character tags
+ */
+void stb::scatterRowLabels(const std::vector<int> &rows,
+    const std::vector<int> &idx1, const std::vector<int> &idx2,
+    const std::vector<std::string> &tags)
+{
+  p_branch_flag = true;
+  scatterTags(rows, idx1, idx2, tags);
+}
+
+/**
+ * Add the minimum allowed value for a subset of rows. This can be called
+ * from any process.
+ * @param rows vector of row indices
+ * @param min vector containing minimum value for each row
+ */
+void stb::scatterRowMinValue(const std::vector<int> &rows,
+    const std::vector<double> &min)
+{
+  scatterBounds(rows, min, 0);
+  p_min_bound = true;
+}
+
+/**
+ * Add the maximum allowed value for a subset of rows. This can be called
+ * from any process.
+ * @param rows vector of row indices
+ * @param max vector containing maximum value for each row
+ */
+void stb::scatterRowMaxValue(const std::vector<int> &rows,
+    const std::vector<double> &max)
+{
+  scatterBounds(rows, max, 1);
+  p_max_bound = true;
+}
+
+/**
+ * Scatter a row bound to the bounds array
+ * @param rows vector of row indices
+ * @param vals vector of bounds
+ * @param col column of bounds array (0 for min, 1 for max)
+ */
+void stb::scatterBounds(const std::vector<int> &rows,
+    const std::vector<double> &vals, int col)
+{
+  if (p_stream) {
+    if (col == 0) {
+      p_stream->scatterRowMinValue(rows,vals);
+    } else {
+      p_stream->scatterRowMaxValue(rows,vals);
+    }
+    return;
+  }
+  int nvals = rows.size();
+  if (vals.size() != nvals) {
+    printf("rows.size: %d vals.size: %d\n",nvals,(int)vals.size());
+    // TODO: Some kind of error
+    nvals = 0;
+  }
+  if (nvals > 0) {
+    std::vector<int> subs(2*nvals);
+    std::vector<int*> index(nvals);
+    int i;
+    for (i=0; i<nvals; i++) {
+      subs[2*i] = rows[i];
+      subs[2*i+1] = col;
+      index[i] = &subs[2*i];
+    }
+    NGA_Scatter(p_bounds,const_cast<double*>(&vals[0]),&index[0],nvals);
+  }
+}
+
+/**
+ * Scatter row labels to the tag array
+ * @param rows vector of row indices
+ * @param idx1 vector of index 1
+ * @param idx2 vector of index 2 (can be empty)
+ * @param tags vector of character tags
+ */
+void stb::scatterTags(const std::vector<int> &rows,
+    const std::vector<int> &idx1, const std::vector<int> &idx2,
+    const std::vector<std::string> &tags)
+{
+  if (p_stream) {
+    if (idx2.size() > 0) {
+      p_stream->scatterRowLabels(rows,idx1,idx2,tags);
+    } else {
+      p_stream->scatterRowLabels(rows,idx1,tags);
+    }
+    return;
+  }
+  int nvals = rows.size();
+  if (idx1.size() != nvals || tags.size() != nvals
+      || (idx2.size() != 0 && idx2.size() != nvals)) {
+    printf("rows.size: %d idx1.size: %d idx2.size: %d tags.size: %d\n",
+        nvals,(int)idx1.size(),(int)idx2.size(),(int)tags.size());
+    // TODO: Some kind of error
+    nvals = 0;
+  }
+  if (nvals > 0) {
+    gridpack::utility::StringUtils util;
+    std::vector<stb::index_set> tagvec(nvals);
+    std::vector<int> subs(rows);
+    std::vector<int*> index(nvals);
+    int i;
+    for (i=0; i<nvals; i++) {
+      stb::index_set &tag = tagvec[i];
+      tag.gidx = rows[i]+1;
+      tag.idx1 = idx1[i];
+      tag.idx2 = idx2.size() > 0 ? idx2[i] : 0;
+      std::string ctk;
+      if (tags[i].size() > 1) {
+        ctk = tags[i].substr(0,2);
+      } else {
+        ctk = tags[i];
+      }
+      util.clean2Char(ctk);
+      strncpy(tag.tag,ctk.c_str(),2);
+      tag.tag[2] = '\0';
+      index[i] = &subs[i];
+    }
+    NGA_Scatter(p_tags,&tagvec[0],&index[0],nvals);
+  }
+}
+
+/**
+ * Make sure that all processes agree on whether labels and bounds have
+ * been set. These may have only been set on the processes that called
+ * one of the scatter functions.
+ */
+void stb::syncFlags(void)
+{
+  int flags[3];
+  flags[0] = static_cast<int>(p_branch_flag);
+  flags[1] = static_cast<int>(p_min_bound);
+  flags[2] = static_cast<int>(p_max_bound);
+  MPI_Allreduce(MPI_IN_PLACE,flags,3,MPI_INT,MPI_MAX,p_comm);
+  p_branch_flag = (flags[0] != 0);
+  p_min_bound = (flags[1] != 0);
+  p_max_bound = (flags[2] != 0);
+}
+
 /**
  * Write out file containing mean value and RMS deviation for values in table
  * @param filename name of file containing results
@@ -274,7 +505,12 @@ void stb::addRowMaxValue(std::vector<double> max)
  */
 void stb::writeMeanAndRMS(std::string filename, int mval, bool flag)
 {
+  if (p_stream) {
+    p_stream->writeMeanAndRMS(filename,mval,flag);
+    return;
+  }
   GA_Pgroup_sync(p_GAgrp);
+  syncFlags();
   int zero = 0;
   int one = 1;
   int two = 2;
@@ -459,7 +695,12 @@ void stb::writeMeanAndRMS(std::string filename, int mval, bool flag)
  */
 void stb::writeMinAndMax(std::string filename, int mval, bool flag)
 {
+  if (p_stream) {
+    p_stream->writeMinAndMax(filename,mval,flag);
+    return;
+  }
   GA_Pgroup_sync(p_GAgrp);
+  syncFlags();
   int zero = 0;
   int one = 1;
   int two = 2;
@@ -665,7 +906,12 @@ void stb::writeMinAndMax(std::string filename, int mval, bool flag)
  */
 void stb::writeMaskValueCount(std::string filename, int mval, bool flag)
 {
+  if (p_stream) {
+    p_stream->writeMaskValueCount(filename,mval,flag);
+    return;
+  }
   GA_Pgroup_sync(p_GAgrp);
+  syncFlags();
   int zero = 0;
   int one = 1;
   int two = 2;
@@ -784,6 +1030,10 @@ void stb::writeMaskValueCount(std::string filename, int mval, bool flag)
  */
 void stb::sumColumnValues(std::string filename, int mval)
 {
+  if (p_stream) {
+    p_stream->sumColumnValues(filename,mval);
+    return;
+  }
   GA_Pgroup_sync(p_GAgrp);
   int zero = 0;
   int one = 1;
@@ -26,7 +26,9 @@
 #include <ga.h>
 #include <map>
 #include <vector>
+#include <boost/shared_ptr.hpp>
 #include "gridpack/parallel/communicator.hpp"
+#include "gridpack/analysis/streaming_stat_block.hpp"
 
 namespace gridpack {
 namespace analysis {
@@ -47,8 +49,12 @@ public:
    * @param comm communicator on which StatBlock is defined
    * @param nrows number of rows in data array
    * @param ncols number of columns in data array
+   * @param streaming if true, do not store the table but accumulate running
+   *        statistics for each row in a StreamingStatBlock. Memory use does
+   *        not depend on the number of columns
    */
-  StatBlock(const parallel::Communicator &comm, int nrows, int ncols);
+  StatBlock(const parallel::Communicator &comm, int nrows, int ncols,
+      bool streaming = false);
 
   /**
    * Default destructor
@@ -91,6 +97,58 @@ public:
    */
   void addRowMaxValue(std::vector<double> max);
 
+  /**
+   * Add values for a subset of rows in a column. Unlike addColumnValues,
+   * this can be called from any process with the values that are available
+   * locally, so that each process only contributes the rows it owns.
+   * @param idx index of column
+   * @param rows vector of row indices
+   * @param vals vector of values corresponding to rows
+   * @param mask vector of mask values corresponding to rows
+   */
+  void scatterColumnValues(int idx, const std::vector<int> &rows,
+      const std::vector<double> &vals, const std::vector<int> &mask);
+
+  /**
+   * Add index and device tag labels for a subset of rows. This can be
+   * called from any process.
+   * @param rows vector of row indices
+   * @param indices vector of indices
+   * @param tags  vector of character tags
+   */
+  void scatterRowLabels(const std::vector<int> &rows,
+      const std::vector<int> &indices, const std::vector<std::string> &tags);
+
+  /**
+   * Add two branch indices and device tag labels for a subset of rows. This
+   * can be called from any process.
+   * @param rows vector of row indices
+   * @param idx1 vector of index 1
+   * @param idx2 vector of index 2
+   * @param tags  vector of character tags
+   */
+  void scatterRowLabels(const std::vector<int> &rows,
+      const std::vector<int> &idx1, const std::vector<int> &idx2,
+      const std::vector<std::string> &tags);
+
+  /**
+   * Add the minimum allowed value for a subset of rows. This can be called
+   * from any process.
+   * @param rows vector of row indices
+   * @param min vector containing minimum value for each row
+   */
+  void scatterRowMinValue(const std::vector<int> &rows,
+      const std::vector<double> &min);
+
+  /**
+   * Add the maximum allowed value for a subset of rows. This can be called
+   * from any process.
+   * @param rows vector of row indices
+   * @param max vector containing maximum value for each row
+   */
+  void scatterRowMaxValue(const std::vector<int> &rows,
+      const std::vector<double> &max);
+
   /**
    * Write out file containing mean value and RMS deviation for values in table
    * @param filename name of file containing results
@@ -125,6 +183,31 @@ public:
   void sumColumnValues(std::string filename, int mval=1);
 private:
 
+  /**
+   * Scatter a row bound to the bounds array
+   * @param rows vector of row indices
+   * @param vals vector of bounds
+   * @param col column of bounds array (0 for min, 1 for max)
+   */
+  void scatterBounds(const std::vector<int> &rows,
+      const std::vector<double> &vals, int col);
+
+  /**
+   * Scatter row labels to the tag array
+   * @param rows vector of row indices
+   * @param idx1 vector of index 1
+   * @param idx2 vector of index 2 (can be empty)
+   * @param tags vector of character tags
+   */
+  void scatterTags(const std::vector<int> &rows, const std::vector<int> &idx1,
+      const std::vector<int> &idx2, const std::vector<std::string> &tags);
+
+  /**
+   * Make sure that all processes agree on whether labels and bounds have
+   * been set
+   */
+  void syncFlags(void);
+
   int p_data;
   int p_mask;
   int p_type;
@@ -144,6 +227,8 @@ private:
 
   MPI_Comm p_comm;
 
+  // running statistics used instead of the table in streaming mode
+  boost::shared_ptr<StreamingStatBlock> p_stream;
 };
 
 
@@ -0,0 +1,680 @@
+// Emacs Mode Line: -*- Mode:c++;-*-
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   streaming_stat_block.cpp
+ *
+ * @brief
+ * StatBlock interface built on running statistics so that memory use does
+ * not depend on the number of columns.
+ *
+ */
+
+// -------------------------------------------------------------
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <fstream>
+#include "gridpack/analysis/streaming_stat_block.hpp"
+#include "gridpack/utilities/string_utils.hpp"
+
+#define sstb gridpack::analysis::StreamingStatBlock
+
+namespace {
+
+/**
+ * Find the process that provides each entry of a vector whose entries may
+ * have been set on different processes. The highest ranked process that
+ * has set an entry is used, so that values set after a previous reduction
+ * take precedence over the values already held on process 0.
+ * @param comm communicator
+ * @param set nonzero for entries that have been set on this process. On
+ *        return, entries are marked on process 0 if they were set anywhere
+ *        and cleared on all other processes
+ * @param owner returns rank of process that provides each entry or -1
+ * @return true if any entry has been set on any process
+ */
+bool findOwners(const gridpack::parallel::Communicator &comm,
+    std::vector<int> &set, std::vector<int> &owner)
+{
+  int me = comm.rank();
+  int len = set.size();
+  owner.resize(len);
+  int i;
+  for (i=0; i<len; i++) owner[i] = set[i] ? me : -1;
+  if (len > 0) {
+    MPI_Allreduce(MPI_IN_PLACE, &owner[0], len, MPI_INT, MPI_MAX,
+        static_cast<MPI_Comm>(comm));
+  }
+  bool found = false;
+  for (i=0; i<len; i++) {
+    if (owner[i] >= 0) found = true;
+    set[i] = (me == 0 && owner[i] >= 0) ? 1 : 0;
+  }
+  return found;
+}
+
+/**
+ * Copy the entries of a vector to process 0 from the processes that
+ * provide them. Entries that were not set anywhere are set to zero.
+ * @param comm communicator
+ * @param vec vector of values
+ * @param owner rank of process that provides each entry, from findOwners
+ * @param width number of values in each entry
+ * @param type MPI data type of values
+ */
+template <class _T>
+void mergeToRoot(const gridpack::parallel::Communicator &comm,
+    std::vector<_T> &vec, const std::vector<int> &owner, int width,
+    MPI_Datatype type)
+{
+  int me = comm.rank();
+  int nentries = owner.size();
+  int len = nentries*width;
+  if (len == 0) return;
+  std::vector<_T> tmp(len);
+  int i, k;
+  for (i=0; i<nentries; i++) {
+    for (k=0; k<width; k++) {
+      tmp[i*width+k] = (owner[i] == me) ? vec[i*width+k]
+        : static_cast<_T>(0);
+    }
+  }
+  MPI_Reduce(&tmp[0], (me == 0 ? &vec[0] : NULL), len, type, MPI_SUM, 0,
+      static_cast<MPI_Comm>(comm));
+}
+
+}
+
+/**
+ * Constructor
+ * @param comm communicator on which StreamingStatBlock is defined
+ * @param nrows number of rows in data array
+ * @param ncols number of columns in data array
+ */
+sstb::StreamingStatBlock(const parallel::Communicator &comm, int nrows,
+    int ncols)
+  : p_nrows(nrows), p_ncols(ncols), p_nmask(0), p_comm(comm),
+    p_has_labels(false), p_branch_flag(false),
+    p_min_bound(false), p_max_bound(false)
+{
+  p_base.assign(p_nrows,0.0);
+  p_base_set.assign(p_nrows,0);
+  p_idx1.assign(p_nrows,0);
+  p_idx2.assign(p_nrows,0);
+  p_tags.assign(p_nrows,"");
+  p_label_set.assign(p_nrows,0);
+  p_min.assign(p_nrows,0.0);
+  p_max.assign(p_nrows,0.0);
+  p_min_set.assign(p_nrows,0);
+  p_max_set.assign(p_nrows,0);
+  checkMaskSize(2);
+}
+
+/**
+ * Default destructor
+ */
+sstb::~StreamingStatBlock(void)
+{
+}
+
+/**
+ * Make sure that statistics are kept for all mask values up to mval
+ * @param mval mask value
+ */
+void sstb::checkMaskSize(int mval)
+{
+  if (mval < p_nmask) return;
+  int nmask = mval+1;
+  std::vector<RunningStats> stats(p_nrows*nmask);
+  std::vector<double> colsum(p_ncols*nmask,0.0);
+  int i, m;
+  for (i=0; i<p_nrows; i++) {
+    for (m=0; m<p_nmask; m++) {
+      stats[i*nmask+m] = p_stats[i*p_nmask+m];
+    }
+  }
+  for (i=0; i<p_ncols*p_nmask; i++) colsum[i] = p_colsum[i];
+  p_stats.swap(stats);
+  p_colsum.swap(colsum);
+  p_nmask = nmask;
+}
+
+/**
+ * Add a column of data to the stat block. Column 0 is treated as the base
+ * case.
+ * @param idx index of column
+ * @param vals vector of column values
+ * @param mask vector of mask values
+ */
+void sstb::addColumnValues(int idx, const std::vector<double> &vals,
+    const std::vector<int> &mask)
+{
+  if (idx >= p_ncols || idx < 0) {
+    printf("IDX: %d NCOLS: %d\n",idx,p_ncols);
+    // TODO: Some kind of error
+    return;
+  }
+  if (vals.size() != p_nrows || mask.size() != p_nrows) {
+    printf("NROWS: %d vals.size: %d mask.size: %d\n",p_nrows,
+        (int)vals.size(),(int)mask.size());
+    // TODO: Some kind of error
+    return;
+  }
+  int i;
+  for (i=0; i<p_nrows; i++) {
+    addValue(i,idx,vals[i],mask[i]);
+  }
+}
+
+/**
+ * Add values for a subset of rows in a column. This can be called from
+ * any process with the values that are available locally.
+ * @param idx index of column
+ * @param rows vector of row indices
+ * @param vals vector of values corresponding to rows
+ * @param mask vector of mask values corresponding to rows
+ */
+void sstb::scatterColumnValues(int idx, const std::vector<int> &rows,
+    const std::vector<double> &vals, const std::vector<int> &mask)
+{
+  if (idx >= p_ncols || idx < 0) {
+    printf("IDX: %d NCOLS: %d\n",idx,p_ncols);
+    // TODO: Some kind of error
+    return;
+  }
+  int nvals = rows.size();
+  if (vals.size() != nvals || mask.size() != nvals) {
+    printf("rows.size: %d vals.size: %d mask.size: %d\n",nvals,
+        (int)vals.size(),(int)mask.size());
+    // TODO: Some kind of error
+    return;
+  }
+  int i;
+  for (i=0; i<nvals; i++) {
+    if (rows[i] < 0 || rows[i] >= p_nrows) {
+      printf("ROW: %d NROWS: %d\n",rows[i],p_nrows);
+      continue;
+    }
+    addValue(rows[i],idx,vals[i],mask[i]);
+  }
+}
+
+/**
+ * Add a value to the statistics for a row
+ * @param row row index
+ * @param idx index of column
+ * @param val value
+ * @param mval mask value
+ */
+void sstb::addValue(int row, int idx, double val, int mval)
+{
+  if (idx == 0) {
+    p_base[row] = val;
+    p_base_set[row] = 1;
+  }
+  if (mval < 0) return;
+  checkMaskSize(mval);
+  p_stats[row*p_nmask+mval].add(val,idx);
+  p_colsum[mval*p_ncols+idx] += val;
+}
+
+/**
+ * Add index and device tag that can be used to label rows
+ * @param indices vector of indices
+ * @param tags  vector of character tags
+ */
+void sstb::addRowLabels(const std::vector<int> &indices,
+    const std::vector<std::string> &tags)
+{
+  std::vector<int> idx2(indices.size(),0);
+  addRowLabels(indices, idx2, tags);
+  p_branch_flag = false;
+}
+
+/**
+ * Add two branch indices and device tag that can be used to label rows
+ * @param idx1 vector of index 1
+ * @param idx2 vector of index 2
+ * @param tags  vector of character tags
+ */
+void sstb::addRowLabels(const std::vector<int> &idx1,
+    const std::vector<int> &idx2, const std::vector<std::string> &tags)
+{
+  if (idx1.size() != p_nrows || idx2.size() != p_nrows
+      || tags.size() != p_nrows) {
+    printf("NROWS: %d idx1.size: %d idx2.size: %d tags.size: %d\n",p_nrows,
+        (int)idx1.size(),(int)idx2.size(),(int)tags.size());
+    // TODO: Some kind of error
+    return;
+  }
+  p_branch_flag = true;
+  std::vector<int> rows(p_nrows);
+  int i;
+  for (i=0; i<p_nrows; i++) rows[i] = i;
+  setLabels(rows,idx1,idx2,tags);
+}
+
+/**
+ * Add index and device tag labels for a subset of rows. This can be
+ * called from any process.
+ * @param rows vector of row indices
+ * @param indices vector of indices
+ * @param tags  vector of character tags
+ */
+void sstb::scatterRowLabels(const std::vector<int> &rows,
+    const std::vector<int> &indices, const std::vector<std::string> &tags)
+{
+  std::vector<int> idx2;
+  setLabels(rows,indices,idx2,tags);
+}
+
+/**
+ * Add two branch indices and device tag labels for a subset of rows. This
+ * can be called from any process.
+ * @param rows vector of row indices
+ * @param idx1 vector of index 1
+ * @param idx2 vector of index 2
+ * @param tags  vector of character tags
+ */
+void sstb::scatterRowLabels(const std::vector<int> &rows,
+    const std::vector<int> &idx1, const std::vector<int> &idx2,
+    const std::vector<std::string> &tags)
+{
+  p_branch_flag = true;
+  setLabels(rows,idx1,idx2,tags);
+}
+
+/**
+ * Store labels for a subset of rows
+ * @param rows vector of row indices
+ * @param idx1 vector of index 1
+ * @param idx2 vector of index 2 (can be empty)
+ * @param tags vector of character tags
+ */
+void sstb::setLabels(const std::vector<int> &rows,
+    const std::vector<int> &idx1, const std::vector<int> &idx2,
+    const std::vector<std::string> &tags)
+{
+  int nvals = rows.size();
+  if (idx1.size() != nvals || tags.size() != nvals
+      || (idx2.size() != 0 && idx2.size() != nvals)) {
+    printf("rows.size: %d idx1.size: %d idx2.size: %d tags.size: %d\n",
+        nvals,(int)idx1.size(),(int)idx2.size(),(int)tags.size());
+    // TODO: Some kind of error
+    return;
+  }
+  gridpack::utility::StringUtils util;
+  int i;
+  for (i=0; i<nvals; i++) {
+    int row = rows[i];
+    if (row < 0 || row >= p_nrows) {
+      printf("ROW: %d NROWS: %d\n",row,p_nrows);
+      continue;
+    }
+    std::string ctk;
+    if (tags[i].size() > 1) {
+      ctk = tags[i].substr(0,2);
+    } else {
+      ctk = tags[i];
+    }
+    util.clean2Char(ctk);
+    p_idx1[row] = idx1[i];
+    p_idx2[row] = idx2.size() > 0 ? idx2[i] : 0;
+    p_tags[row] = ctk.substr(0,2);
+    p_label_set[row] = 1;
+  }
+  p_has_labels = true;
+}
+
+/**
+ * Add the minimum allowed value per row
+ * @param max vector containing minimum value for each row
+ */
+void sstb::addRowMinValue(const std::vector<double> &min)
+{
+  if (min.size() != p_nrows) {
+    printf("NROWS: %d min.size: %d\n",p_nrows,(int)min.size());
+    // TODO: Some kind of error
+    return;
+  }
+  std::vector<int> rows(p_nrows);
+  int i;
+  for (i=0; i<p_nrows; i++) rows[i] = i;
+  setBounds(rows,min,p_min,p_min_set);
+  p_min_bound = true;
+}
+
+/**
+ * Add the maximum allowed value per row
+ * @param max vector containing maximum value for each row
+ */
+void sstb::addRowMaxValue(const std::vector<double> &max)
+{
+  if (max.size() != p_nrows) {
+    printf("NROWS: %d max.size: %d\n",p_nrows,(int)max.size());
+    // TODO: Some kind of error
+    return;
+  }
+  std::vector<int> rows(p_nrows);
+  int i;
+  for (i=0; i<p_nrows; i++) rows[i] = i;
+  setBounds(rows,max,p_max,p_max_set);
+  p_max_bound = true;
+}
+
+/**
+ * Add the minimum allowed value for a subset of rows. This can be called
+ * from any process.
+ * @param rows vector of row indices
+ * @param min vector containing minimum value for each row
+ */
+void sstb::scatterRowMinValue(const std::vector<int> &rows,
+    const std::vector<double> &min)
+{
+  setBounds(rows,min,p_min,p_min_set);
+  p_min_bound = true;
+}
+
+/**
+ * Add the maximum allowed value for a subset of rows. This can be called
+ * from any process.
+ * @param rows vector of row indices
+ * @param max vector containing maximum value for each row
+ */
+void sstb::scatterRowMaxValue(const std::vector<int> &rows,
+    const std::vector<double> &max)
+{
+  setBounds(rows,max,p_max,p_max_set);
+  p_max_bound = true;
+}
+
+/**
+ * Store bounds for a subset of rows
+ * @param rows vector of row indices
+ * @param vals vector of bounds
+ * @param bound vector of bounds for all rows
+ * @param set flags for rows where the bound has been set
+ */
+void sstb::setBounds(const std::vector<int> &rows,
+    const std::vector<double> &vals, std::vector<double> &bound,
+    std::vector<int> &set)
+{
+  int nvals = rows.size();
+  if (vals.size() != nvals) {
+    printf("rows.size: %d vals.size: %d\n",nvals,(int)vals.size());
+    // TODO: Some kind of error
+    return;
+  }
+  int i;
+  for (i=0; i<nvals; i++) {
+    int row = rows[i];
+    if (row < 0 || row >= p_nrows) {
+      printf("ROW: %d NROWS: %d\n",row,p_nrows);
+      continue;
+    }
+    bound[row] = vals[i];
+    set[row] = 1;
+  }
+}
+
+/**
+ * Combine statistics from all processes on process 0. This is a
+ * collective operation and is called automatically by the write
+ * functions.
+ */
+void sstb::reduce(void)
+{
+  MPI_Comm comm = static_cast<MPI_Comm>(p_comm);
+  int me = p_comm.rank();
+  int i;
+
+  // Make sure all processes use the same layout
+  int nmask = p_nmask;
+  MPI_Allreduce(MPI_IN_PLACE, &nmask, 1, MPI_INT, MPI_MAX, comm);
+  checkMaskSize(nmask-1);
+
+  // Merge statistics on process 0 and reset them everywhere else so that
+  // later calls do not count values twice
+  reduceStats(p_comm, p_stats);
+  if (me != 0) {
+    for (i=0; i<p_stats.size(); i++) p_stats[i].clear();
+  }
+  int len = p_colsum.size();
+  if (me == 0) {
+    MPI_Reduce(MPI_IN_PLACE, &p_colsum[0], len, MPI_DOUBLE, MPI_SUM, 0, comm);
+  } else {
+    MPI_Reduce(&p_colsum[0], NULL, len, MPI_DOUBLE, MPI_SUM, 0, comm);
+    for (i=0; i<len; i++) p_colsum[i] = 0.0;
+  }
+
+  // Combine base case values, labels and bounds on process 0. These may
+  // have been set for different rows on different processes
+  std::vector<int> owner;
+  findOwners(p_comm, p_base_set, owner);
+  mergeToRoot(p_comm, p_base, owner, 1, MPI_DOUBLE);
+  p_min_bound = findOwners(p_comm, p_min_set, owner);
+  mergeToRoot(p_comm, p_min, owner, 1, MPI_DOUBLE);
+  p_max_bound = findOwners(p_comm, p_max_set, owner);
+  mergeToRoot(p_comm, p_max, owner, 1, MPI_DOUBLE);
+
+  int branch = p_branch_flag ? 1 : 0;
+  MPI_Allreduce(MPI_IN_PLACE, &branch, 1, MPI_INT, MPI_MAX, comm);
+  p_branch_flag = (branch == 1);
+  std::vector<int> ctags(2*p_nrows,0);
+  for (i=0; i<p_nrows; i++) {
+    int k;
+    for (k=0; k<2 && k<p_tags[i].size(); k++) {
+      ctags[2*i+k] = static_cast<unsigned char>(p_tags[i][k]);
+    }
+  }
+  p_has_labels = findOwners(p_comm, p_label_set, owner);
+  mergeToRoot(p_comm, p_idx1, owner, 1, MPI_INT);
+  mergeToRoot(p_comm, p_idx2, owner, 1, MPI_INT);
+  mergeToRoot(p_comm, ctags, owner, 2, MPI_INT);
+  if (me == 0) {
+    for (i=0; i<p_nrows; i++) {
+      p_tags[i].clear();
+      int k;
+      for (k=0; k<2 && ctags[2*i+k] != 0; k++) {
+        p_tags[i].push_back(static_cast<char>(ctags[2*i+k]));
+      }
+    }
+  }
+}
+
+/**
+ * Get combined statistics for a row. This is only valid on process 0
+ * after one of the write functions (or reduce) has been called.
+ * @param row row index
+ * @param mval only include values with this mask value or greater
+ * @return statistics for row
+ */
+gridpack::analysis::RunningStats sstb::getRowStats(int row, int mval) const
+{
+  RunningStats ret;
+  if (mval < 0) mval = 0;
+  int m;
+  for (m=mval; m<p_nmask; m++) ret.merge(p_stats[row*p_nmask+m]);
+  return ret;
+}
+
+/**
+ * Format row label
+ * @param buf character buffer
+ * @param row row index
+ * @param flag if false, do not include tag ids
+ */
+void sstb::formatLabel(char *buf, int row, bool flag) const
+{
+  int idx1 = p_has_labels ? p_idx1[row] : 0;
+  int idx2 = p_has_labels ? p_idx2[row] : 0;
+  const char *tag = p_has_labels ? p_tags[row].c_str() : "";
+  if (flag) {
+    if (p_branch_flag) {
+      sprintf(buf,"%8d %8d %8d %s",row+1,idx1,idx2,tag);
+    } else {
+      sprintf(buf,"%8d %8d %s",row+1,idx1,tag);
+    }
+  } else {
+    if (p_branch_flag) {
+      sprintf(buf,"%8d %8d %8d",row+1,idx1,idx2);
+    } else {
+      sprintf(buf,"%8d %8d",row+1,idx1);
+    }
+  }
+}
+
+/**
+ * Write out file containing mean value and RMS deviation for values in table
+ * @param filename name of file containing results
+ * @param mval only include values with this mask value or greater
+ * @param flag if false, do not include tag ids in output
+ */
+void sstb::writeMeanAndRMS(std::string filename, int mval, bool flag)
+{
+  reduce();
+  if (p_comm.rank() == 0) {
+    char sbuf[256];
+    std::ofstream fout;
+    fout.open(filename.c_str());
+    int i;
+    for (i=0; i<p_nrows; i++) {
+      RunningStats stats = getRowStats(i,mval);
+      double avg = 0.0;
+      double rms = 0.0;
+      double diff2 = 0.0;
+      long n = stats.count();
+      if (n > 0) avg = stats.mean();
+      if (n > 1) {
+        rms = sqrt(stats.variance());
+        diff2 = stats.sumSquaredDeviation(p_base[i])
+          / static_cast<double>(n-1);
+        diff2 = (diff2 > 0.0) ? sqrt(diff2) : 0.0;
+      }
+      formatLabel(sbuf,i,flag);
+      int len = strlen(sbuf);
+      sprintf(sbuf+len," %16.8e %16.8e %16.8e",avg,rms,diff2);
+      fout << sbuf << std::endl;
+    }
+    fout.close();
+  }
+  p_comm.barrier();
+}
+
+/**
+ * Write out file containing Min an Max values in table for each row
+ * @param filename name of file containing results
+ * @param mval only include values with this mask value or greater
+ * @param flag if false, do not include tag ids in output
+ */
+void sstb::writeMinAndMax(std::string filename, int mval, bool flag)
+{
+  reduce();
+  if (p_comm.rank() == 0) {
+    char sbuf[256];
+    std::ofstream fout;
+    fout.open(filename.c_str());
+    int i;
+    for (i=0; i<p_nrows; i++) {
+      RunningStats stats = getRowStats(i,mval);
+      // The base case value is the starting value for the search, as in
+      // StatBlock
+      double base = p_base[i];
+      double min = base;
+      double max = base;
+      int jmin = 0;
+      int jmax = 0;
+      if (stats.count() > 0) {
+        if (stats.min() < min) {
+          min = stats.min();
+          jmin = stats.minIndex();
+        }
+        if (stats.max() > max) {
+          max = stats.max();
+          jmax = stats.maxIndex();
+        }
+      }
+      formatLabel(sbuf,i,flag);
+      int len = strlen(sbuf);
+      sprintf(sbuf+len," %16.8e %16.8e %16.8e %16.8e %16.8e",
+          base, min, max, min-base, max-base);
+      if (p_min_bound) {
+        len = strlen(sbuf);
+        sprintf(sbuf+len," %16.8e",p_min[i]);
+      }
+      if (p_max_bound) {
+        len = strlen(sbuf);
+        sprintf(sbuf+len," %16.8e",p_max[i]);
+      }
+      len = strlen(sbuf);
+      sprintf(sbuf+len," %8d %8d",jmin,jmax);
+      fout << sbuf << std::endl;
+    }
+    fout.close();
+  }
+  p_comm.barrier();
+}
+
+/**
+ * Write out file containing number of mask entries at each row that
+ * correspond to a given value
+ * @param filename name of file containing results
+ * @param mval count number of times this mask value occurs
+ * @param flag if false, do not include tag ids in output
+ */
+void sstb::writeMaskValueCount(std::string filename, int mval, bool flag)
+{
+  reduce();
+  if (p_comm.rank() == 0) {
+    char sbuf[256];
+    std::ofstream fout;
+    fout.open(filename.c_str());
+    int i;
+    for (i=0; i<p_nrows; i++) {
+      int icnt = 0;
+      if (mval >= 0 && mval < p_nmask) {
+        icnt = static_cast<int>(p_stats[i*p_nmask+mval].count());
+      }
+      formatLabel(sbuf,i,flag);
+      int len = strlen(sbuf);
+      sprintf(sbuf+len," %8d",icnt);
+      fout << sbuf << std::endl;
+    }
+    fout.close();
+  }
+  p_comm.barrier();
+}
+
+/**
+ * Sum up the values in the columns and print the result as a function
+ * of column index
+ * @param filename name of file containing results
+ * @param mval only include values with this mask value or greater
+ */
+void sstb::sumColumnValues(std::string filename, int mval)
+{
+  reduce();
+  if (p_comm.rank() == 0) {
+    char sbuf[128];
+    std::ofstream fout;
+    fout.open(filename.c_str());
+    if (mval < 0) mval = 0;
+    int j, m;
+    for (j=0; j<p_ncols; j++) {
+      double sum = 0.0;
+      for (m=mval; m<p_nmask; m++) sum += p_colsum[m*p_ncols+j];
+      double sum_avg = 0.0;
+      if (p_nrows > 0) sum_avg = sum/(static_cast<double>(p_nrows));
+      sprintf(sbuf,"%8d %16.8e %16.8e",j,sum,sum_avg);
+      fout << sbuf << std::endl;
+    }
+    fout.close();
+  }
+  p_comm.barrier();
+}
@@ -0,0 +1,270 @@
+// Emacs Mode Line: -*- Mode:c++;-*-
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   streaming_stat_block.hpp
+ *
+ * @brief
+ * This has the same interface as StatBlock, but instead of storing the
+ * complete table of values it accumulates running statistics for each row
+ * as columns are added. Memory use is proportional to the number of rows
+ * and does not depend on the number of columns (scenarios), so it can be
+ * used for very large ensembles. Statistics are kept separately for each
+ * mask value so that the mask value used to filter the results can still be
+ * chosen when the results are written. Values, labels and bounds can be
+ * added for all rows from one process or for a subset of rows from any
+ * process with the scatter functions.
+ *
+ */
+
+// -------------------------------------------------------------
+
+#ifndef _streaming_stat_block_hpp_
+#define _streaming_stat_block_hpp_
+
+#include <vector>
+#include <string>
+#include "gridpack/parallel/communicator.hpp"
+#include "gridpack/analysis/streaming_stats.hpp"
+
+namespace gridpack {
+namespace analysis {
+
+class StreamingStatBlock {
+public:
+  /**
+   * Constructor
+   * @param comm communicator on which StreamingStatBlock is defined
+   * @param nrows number of rows in data array
+   * @param ncols number of columns in data array
+   */
+  StreamingStatBlock(const parallel::Communicator &comm, int nrows, int ncols);
+
+  /**
+   * Default destructor
+   */
+  ~StreamingStatBlock(void);
+
+  /**
+   * Add a column of data to the stat block. Column 0 is treated as the base
+   * case.
+   * @param idx index of column
+   * @param vals vector of column values
+   * @param mask vector of mask values
+   */
+  void addColumnValues(int idx, const std::vector<double> &vals,
+      const std::vector<int> &mask);
+
+  /**
+   * Add index and device tag that can be used to label rows
+   * @param indices vector of indices
+   * @param tags  vector of character tags
+   */
+  void addRowLabels(const std::vector<int> &indices,
+      const std::vector<std::string> &tags);
+
+  /**
+   * Add two branch indices and device tag that can be used to label rows
+   * @param idx1 vector of index 1
+   * @param idx2 vector of index 2
+   * @param tags  vector of character tags
+   */
+  void addRowLabels(const std::vector<int> &idx1, const std::vector<int> &idx2,
+      const std::vector<std::string> &tags);
+
+  /**
+   * Add the minimum allowed value per row
+   * @param max vector containing minimum value for each row
+   */
+  void addRowMinValue(const std::vector<double> &min);
+
+  /**
+   * Add the maximum allowed value per row
+   * @param max vector containing maximum value for each row
+   */
+  void addRowMaxValue(const std::vector<double> &max);
+
+  /**
+   * Add values for a subset of rows in a column. This can be called from
+   * any process with the values that are available locally.
+   * @param idx index of column
+   * @param rows vector of row indices
+   * @param vals vector of values corresponding to rows
+   * @param mask vector of mask values corresponding to rows
+   */
+  void scatterColumnValues(int idx, const std::vector<int> &rows,
+      const std::vector<double> &vals, const std::vector<int> &mask);
+
+  /**
+   * Add index and device tag labels for a subset of rows. This can be
+   * called from any process.
+   * @param rows vector of row indices
+   * @param indices vector of indices
+   * @param tags  vector of character tags
+   */
+  void scatterRowLabels(const std::vector<int> &rows,
+      const std::vector<int> &indices, const std::vector<std::string> &tags);
+
+  /**
+   * Add two branch indices and device tag labels for a subset of rows. This
+   * can be called from any process.
+   * @param rows vector of row indices
+   * @param idx1 vector of index 1
+   * @param idx2 vector of index 2
+   * @param tags  vector of character tags
+   */
+  void scatterRowLabels(const std::vector<int> &rows,
+      const std::vector<int> &idx1, const std::vector<int> &idx2,
+      const std::vector<std::string> &tags);
+
+  /**
+   * Add the minimum allowed value for a subset of rows. This can be called
+   * from any process.
+   * @param rows vector of row indices
+   * @param min vector containing minimum value for each row
+   */
+  void scatterRowMinValue(const std::vector<int> &rows,
+      const std::vector<double> &min);
+
+  /**
+   * Add the maximum allowed value for a subset of rows. This can be called
+   * from any process.
+   * @param rows vector of row indices
+   * @param max vector containing maximum value for each row
+   */
+  void scatterRowMaxValue(const std::vector<int> &rows,
+      const std::vector<double> &max);
+
+  /**
+   * Write out file containing mean value and RMS deviation for values in table
+   * @param filename name of file containing results
+   * @param mval only include values with this mask value or greater
+   * @param flag if false, do not include tag ids in output
+   */
+  void writeMeanAndRMS(std::string filename, int mval=1, bool flag = true);
+
+  /**
+   * Write out file containing Min an Max values in table for each row
+   * @param filename name of file containing results
+   * @param mval only include values with this mask value or greater
+   * @param flag if false, do not include tag ids in output
+   */
+  void writeMinAndMax(std::string filename, int mval=1, bool flag = true);
+
+  /**
+   * Write out file containing number of mask entries at each row that
+   * correspond to a given value
+   * @param filename name of file containing results
+   * @param mval count number of times this mask value occurs
+   * @param flag if false, do not include tag ids in output
+   */
+  void writeMaskValueCount(std::string filename, int mval, bool flag = true);
+
+  /**
+   * Sum up the values in the columns and print the result as a function
+   * of column index
+   * @param filename name of file containing results
+   * @param mval only include values with this mask value or greater
+   */
+  void sumColumnValues(std::string filename, int mval=1);
+
+  /**
+   * Get combined statistics for a row. This is only valid on process 0
+   * after one of the write functions (or reduce) has been called.
+   * @param row row index
+   * @param mval only include values with this mask value or greater
+   * @return statistics for row
+   */
+  RunningStats getRowStats(int row, int mval=1) const;
+
+  /**
+   * Combine statistics from all processes on process 0. This is a
+   * collective operation and is called automatically by the write
+   * functions.
+   */
+  void reduce(void);
+
+private:
+
+  /**
+   * Make sure that statistics are kept for all mask values up to mval
+   * @param mval mask value
+   */
+  void checkMaskSize(int mval);
+
+  /**
+   * Add a value to the statistics for a row
+   * @param row row index
+   * @param idx index of column
+   * @param val value
+   * @param mval mask value
+   */
+  void addValue(int row, int idx, double val, int mval);
+
+  /**
+   * Store labels for a subset of rows
+   * @param rows vector of row indices
+   * @param idx1 vector of index 1
+   * @param idx2 vector of index 2 (can be empty)
+   * @param tags vector of character tags
+   */
+  void setLabels(const std::vector<int> &rows, const std::vector<int> &idx1,
+      const std::vector<int> &idx2, const std::vector<std::string> &tags);
+
+  /**
+   * Store bounds for a subset of rows
+   * @param rows vector of row indices
+   * @param vals vector of bounds
+   * @param bound vector of bounds for all rows
+   * @param set flags for rows where the bound has been set
+   */
+  void setBounds(const std::vector<int> &rows, const std::vector<double> &vals,
+      std::vector<double> &bound, std::vector<int> &set);
+
+  /**
+   * Format row label
+   * @param buf character buffer
+   * @param row row index
+   * @param flag if false, do not include tag ids
+   */
+  void formatLabel(char *buf, int row, bool flag) const;
+
+  int p_nrows;
+  int p_ncols;
+  int p_nmask;
+  parallel::Communicator p_comm;
+
+  // Statistics for each row and mask value, stored as [row*p_nmask+mask]
+  std::vector<RunningStats> p_stats;
+  // Column sums for each mask value, stored as [mask*p_ncols+col]
+  std::vector<double> p_colsum;
+  // Base case (column 0) values. Base values, labels and bounds can be set
+  // for different rows on different processes, so each has a flag per row
+  // that marks the rows that have been set on this process
+  std::vector<double> p_base;
+  std::vector<int> p_base_set;
+
+  std::vector<int> p_idx1;
+  std::vector<int> p_idx2;
+  std::vector<std::string> p_tags;
+  std::vector<int> p_label_set;
+  bool p_has_labels;
+  bool p_branch_flag;
+
+  std::vector<double> p_min;
+  std::vector<double> p_max;
+  std::vector<int> p_min_set;
+  std::vector<int> p_max_set;
+  bool p_min_bound;
+  bool p_max_bound;
+};
+
+
+} // namespace analysis
+} // namespace gridpack
+
+#endif
@@ -0,0 +1,345 @@
+// Emacs Mode Line: -*- Mode:c++;-*-
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   streaming_stats.cpp
+ *
+ * @brief
+ * Statistics that are accumulated one value at a time without storing the
+ * values themselves.
+ *
+ */
+
+// -------------------------------------------------------------
+
+#include <math.h>
+#include <float.h>
+#include <algorithm>
+#include "gridpack/analysis/streaming_stats.hpp"
+
+#define rst gridpack::analysis::RunningStats
+#define qsk gridpack::analysis::QuantileSketch
+
+/**
+ * Constructor
+ */
+rst::RunningStats(void)
+{
+  clear();
+}
+
+/**
+ * Default destructor
+ */
+rst::~RunningStats(void)
+{
+}
+
+/**
+ * Reset accumulator to its initial state
+ */
+void rst::clear(void)
+{
+  p_n = 0;
+  p_mean = 0.0;
+  p_m2 = 0.0;
+  p_min = DBL_MAX;
+  p_max = -DBL_MAX;
+  p_imin = -1;
+  p_imax = -1;
+}
+
+/**
+ * Add a value to the accumulator
+ * @param x value
+ * @param idx index (e.g. scenario number) associated with the value. This
+ *        is used to report where the minimum and maximum values occur
+ */
+void rst::add(double x, int idx)
+{
+  p_n++;
+  double delta = x - p_mean;
+  p_mean += delta/static_cast<double>(p_n);
+  p_m2 += delta*(x - p_mean);
+  if (x < p_min || (x == p_min && idx < p_imin)) {
+    p_min = x;
+    p_imin = idx;
+  }
+  if (x > p_max || (x == p_max && idx < p_imax)) {
+    p_max = x;
+    p_imax = idx;
+  }
+}
+
+/**
+ * Combine the contents of another accumulator with this one
+ * @param other accumulator to be merged
+ */
+void rst::merge(const RunningStats &other)
+{
+  if (other.p_n == 0) return;
+  if (p_n == 0) {
+    *this = other;
+    return;
+  }
+  double na = static_cast<double>(p_n);
+  double nb = static_cast<double>(other.p_n);
+  double n = na + nb;
+  double delta = other.p_mean - p_mean;
+  p_mean += delta*nb/n;
+  p_m2 += other.p_m2 + delta*delta*na*nb/n;
+  p_n += other.p_n;
+  if (other.p_min < p_min || (other.p_min == p_min && other.p_imin < p_imin)) {
+    p_min = other.p_min;
+    p_imin = other.p_imin;
+  }
+  if (other.p_max > p_max || (other.p_max == p_max && other.p_imax < p_imax)) {
+    p_max = other.p_max;
+    p_imax = other.p_imax;
+  }
+}
+
+/**
+ * @return sample variance of values (normalized by count-1)
+ */
+double rst::variance(void) const
+{
+  if (p_n < 2) return 0.0;
+  double ret = p_m2/static_cast<double>(p_n-1);
+  if (ret < 0.0) ret = 0.0;
+  return ret;
+}
+
+/**
+ * Sum of squared deviations of values from a reference value
+ * @param ref reference value
+ * @return sum of (x-ref)^2 over all values
+ */
+double rst::sumSquaredDeviation(double ref) const
+{
+  double delta = p_mean - ref;
+  return p_m2 + static_cast<double>(p_n)*delta*delta;
+}
+
+/**
+ * Append contents of accumulator to a buffer
+ * @param buf buffer
+ */
+void rst::pack(std::vector<double> &buf) const
+{
+  buf.push_back(static_cast<double>(p_n));
+  buf.push_back(p_mean);
+  buf.push_back(p_m2);
+  buf.push_back(p_min);
+  buf.push_back(p_max);
+  buf.push_back(static_cast<double>(p_imin));
+  buf.push_back(static_cast<double>(p_imax));
+}
+
+/**
+ * Set contents of accumulator from a buffer created by pack
+ * @param buf buffer
+ * @param pos position in buffer. On return, this points to the first
+ *        location after the data for this accumulator
+ */
+void rst::unpack(const double *buf, int &pos)
+{
+  p_n = static_cast<long>(buf[pos]);
+  p_mean = buf[pos+1];
+  p_m2 = buf[pos+2];
+  p_min = buf[pos+3];
+  p_max = buf[pos+4];
+  p_imin = static_cast<int>(buf[pos+5]);
+  p_imax = static_cast<int>(buf[pos+6]);
+  pos += 7;
+}
+
+/**
+ * Constructor
+ * @param compression controls the size and accuracy of the sketch
+ */
+qsk::QuantileSketch(double compression)
+{
+  p_compression = compression;
+  if (p_compression < 10.0) p_compression = 10.0;
+  clear();
+}
+
+/**
+ * Default destructor
+ */
+qsk::~QuantileSketch(void)
+{
+}
+
+/**
+ * Reset sketch to its initial state
+ */
+void qsk::clear(void)
+{
+  p_total = 0.0;
+  p_buffer_weight = 0.0;
+  p_min = DBL_MAX;
+  p_max = -DBL_MAX;
+  p_centroids.clear();
+  p_buffer.clear();
+}
+
+/**
+ * Add a value to the sketch
+ * @param x value
+ * @param w weight of value
+ */
+void qsk::add(double x, double w)
+{
+  if (w <= 0.0) return;
+  if (x < p_min) p_min = x;
+  if (x > p_max) p_max = x;
+  Centroid c;
+  c.mean = x;
+  c.weight = w;
+  p_buffer.push_back(c);
+  p_buffer_weight += w;
+  if (p_buffer.size() >= static_cast<size_t>(5.0*p_compression)) compress();
+}
+
+/**
+ * Combine the contents of another sketch with this one
+ * @param other sketch to be merged
+ */
+void qsk::merge(const QuantileSketch &other)
+{
+  if (other.count() <= 0.0) return;
+  if (other.p_min < p_min) p_min = other.p_min;
+  if (other.p_max > p_max) p_max = other.p_max;
+  p_buffer.insert(p_buffer.end(), other.p_centroids.begin(),
+      other.p_centroids.end());
+  p_buffer.insert(p_buffer.end(), other.p_buffer.begin(),
+      other.p_buffer.end());
+  p_buffer_weight += other.count();
+  compress();
+}
+
+/**
+ * Merge buffered values into the list of centroids. Centroids are combined
+ * as long as their total weight stays within the limit set by the arcsine
+ * scale function, which keeps centroids near the tails small.
+ */
+void qsk::compress(void)
+{
+  if (p_buffer.size() == 0) return;
+  p_buffer.insert(p_buffer.end(), p_centroids.begin(), p_centroids.end());
+  std::sort(p_buffer.begin(), p_buffer.end());
+  p_total += p_buffer_weight;
+  p_buffer_weight = 0.0;
+  p_centroids.clear();
+  double norm = p_compression/(2.0*M_PI);
+  double kmax = 0.25*p_compression;
+  double wsofar = 0.0;
+  // Scale function k(q) = norm*asin(2q-1) and its inverse
+  double k = norm*asin(-1.0) + 1.0;
+  double qlimit = (k >= kmax) ? 1.0 : 0.5*(sin(k/norm)+1.0);
+  Centroid cur = p_buffer[0];
+  size_t i;
+  for (i=1; i<p_buffer.size(); i++) {
+    const Centroid &next = p_buffer[i];
+    if (wsofar + cur.weight + next.weight <= qlimit*p_total) {
+      double w = cur.weight + next.weight;
+      cur.mean += (next.mean - cur.mean)*next.weight/w;
+      cur.weight = w;
+    } else {
+      wsofar += cur.weight;
+      p_centroids.push_back(cur);
+      double q = wsofar/p_total;
+      if (q > 1.0) q = 1.0;
+      k = norm*asin(2.0*q-1.0) + 1.0;
+      qlimit = (k >= kmax) ? 1.0 : 0.5*(sin(k/norm)+1.0);
+      cur = next;
+    }
+  }
+  p_centroids.push_back(cur);
+  p_buffer.clear();
+}
+
+/**
+ * Estimate a quantile
+ * @param q quantile. This value should be between 0 and 1
+ * @return estimated value at quantile q
+ */
+double qsk::quantile(double q)
+{
+  compress();
+  int n = p_centroids.size();
+  if (n == 0) return 0.0;
+  if (q <= 0.0) return p_min;
+  if (q >= 1.0) return p_max;
+  if (n == 1) return p_centroids[0].mean;
+  double target = q*p_total;
+  // Centroids are assumed to be centered on their cumulative weight
+  double left = 0.5*p_centroids[0].weight;
+  if (target < left) {
+    return p_min + (p_centroids[0].mean - p_min)*target/left;
+  }
+  int i;
+  for (i=0; i<n-1; i++) {
+    double right = left + 0.5*(p_centroids[i].weight
+        + p_centroids[i+1].weight);
+    if (target < right) {
+      double t = (target-left)/(right-left);
+      return p_centroids[i].mean
+        + t*(p_centroids[i+1].mean - p_centroids[i].mean);
+    }
+    left = right;
+  }
+  double last = 0.5*p_centroids[n-1].weight;
+  if (last <= 0.0) return p_max;
+  double t = (target-left)/last;
+  if (t > 1.0) t = 1.0;
+  return p_centroids[n-1].mean + t*(p_max - p_centroids[n-1].mean);
+}
+
+/**
+ * Append contents of sketch to a buffer
+ * @param buf buffer
+ */
+void qsk::pack(std::vector<double> &buf)
+{
+  compress();
+  buf.push_back(p_compression);
+  buf.push_back(static_cast<double>(p_centroids.size()));
+  buf.push_back(p_min);
+  buf.push_back(p_max);
+  size_t i;
+  for (i=0; i<p_centroids.size(); i++) {
+    buf.push_back(p_centroids[i].mean);
+    buf.push_back(p_centroids[i].weight);
+  }
+}
+
+/**
+ * Set contents of sketch from a buffer created by pack
+ * @param buf buffer
+ * @param pos position in buffer. On return, this points to the first
+ *        location after the data for this sketch
+ */
+void qsk::unpack(const double *buf, int &pos)
+{
+  clear();
+  p_compression = buf[pos];
+  int n = static_cast<int>(buf[pos+1]);
+  p_min = buf[pos+2];
+  p_max = buf[pos+3];
+  pos += 4;
+  p_centroids.resize(n);
+  int i;
+  for (i=0; i<n; i++) {
+    p_centroids[i].mean = buf[pos];
+    p_centroids[i].weight = buf[pos+1];
+    p_total += buf[pos+1];
+    pos += 2;
+  }
+}
@@ -0,0 +1,311 @@
+// Emacs Mode Line: -*- Mode:c++;-*-
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   streaming_stats.hpp
+ *
+ * @brief
+ * Statistics that are accumulated one value at a time without storing the
+ * values themselves. RunningStats keeps the count, mean, variance, minimum
+ * and maximum of a stream of values. QuantileSketch keeps a compressed
+ * representation of the distribution of the values (a merging t-digest)
+ * from which quantiles can be estimated. Both can be merged with other
+ * accumulators of the same type, so that partial results computed on
+ * different processes can be combined with reduceStats.
+ *
+ */
+
+// -------------------------------------------------------------
+
+#ifndef _streaming_stats_hpp_
+#define _streaming_stats_hpp_
+
+#include <vector>
+#include "gridpack/parallel/communicator.hpp"
+
+namespace gridpack {
+namespace analysis {
+
+class RunningStats {
+public:
+
+  /**
+   * Constructor
+   */
+  RunningStats(void);
+
+  /**
+   * Default destructor
+   */
+  ~RunningStats(void);
+
+  /**
+   * Add a value to the accumulator
+   * @param x value
+   * @param idx index (e.g. scenario number) associated with the value. This
+   *        is used to report where the minimum and maximum values occur
+   */
+  void add(double x, int idx = -1);
+
+  /**
+   * Combine the contents of another accumulator with this one
+   * @param other accumulator to be merged
+   */
+  void merge(const RunningStats &other);
+
+  /**
+   * Reset accumulator to its initial state
+   */
+  void clear(void);
+
+  /**
+   * @return number of values
+   */
+  long count(void) const
+  {
+    return p_n;
+  }
+
+  /**
+   * @return mean of values
+   */
+  double mean(void) const
+  {
+    return p_mean;
+  }
+
+  /**
+   * @return sum of values
+   */
+  double sum(void) const
+  {
+    return static_cast<double>(p_n)*p_mean;
+  }
+
+  /**
+   * @return sample variance of values (normalized by count-1)
+   */
+  double variance(void) const;
+
+  /**
+   * Sum of squared deviations of values from a reference value
+   * @param ref reference value
+   * @return sum of (x-ref)^2 over all values
+   */
+  double sumSquaredDeviation(double ref) const;
+
+  /**
+   * @return minimum value
+   */
+  double min(void) const
+  {
+    return p_min;
+  }
+
+  /**
+   * @return maximum value
+   */
+  double max(void) const
+  {
+    return p_max;
+  }
+
+  /**
+   * @return index associated with minimum value
+   */
+  int minIndex(void) const
+  {
+    return p_imin;
+  }
+
+  /**
+   * @return index associated with maximum value
+   */
+  int maxIndex(void) const
+  {
+    return p_imax;
+  }
+
+  /**
+   * Append contents of accumulator to a buffer
+   * @param buf buffer
+   */
+  void pack(std::vector<double> &buf) const;
+
+  /**
+   * Set contents of accumulator from a buffer created by pack
+   * @param buf buffer
+   * @param pos position in buffer. On return, this points to the first
+   *        location after the data for this accumulator
+   */
+  void unpack(const double *buf, int &pos);
+
+private:
+
+  long p_n;
+  double p_mean;
+  double p_m2;
+  double p_min;
+  double p_max;
+  int p_imin;
+  int p_imax;
+};
+
+class QuantileSketch {
+public:
+
+  /**
+   * Constructor
+   * @param compression controls the size and accuracy of the sketch. The
+   *        number of centroids retained is roughly equal to this value and
+   *        the error in estimated quantiles is smallest near the tails of
+   *        the distribution
+   */
+  QuantileSketch(double compression = 100.0);
+
+  /**
+   * Default destructor
+   */
+  ~QuantileSketch(void);
+
+  /**
+   * Add a value to the sketch
+   * @param x value
+   * @param w weight of value
+   */
+  void add(double x, double w = 1.0);
+
+  /**
+   * Combine the contents of another sketch with this one
+   * @param other sketch to be merged
+   */
+  void merge(const QuantileSketch &other);
+
+  /**
+   * Reset sketch to its initial state
+   */
+  void clear(void);
+
+  /**
+   * Estimate a quantile
+   * @param q quantile. This value should be between 0 and 1
+   * @return estimated value at quantile q
+   */
+  double quantile(double q);
+
+  /**
+   * @return total weight of all values added to sketch
+   */
+  double count(void) const
+  {
+    return p_total + p_buffer_weight;
+  }
+
+  /**
+   * Append contents of sketch to a buffer
+   * @param buf buffer
+   */
+  void pack(std::vector<double> &buf);
+
+  /**
+   * Set contents of sketch from a buffer created by pack
+   * @param buf buffer
+   * @param pos position in buffer. On return, this points to the first
+   *        location after the data for this sketch
+   */
+  void unpack(const double *buf, int &pos);
+
+private:
+
+  /**
+   * Merge buffered values into the list of centroids
+   */
+  void compress(void);
+
+  struct Centroid {
+    double mean;
+    double weight;
+    bool operator<(const Centroid &c) const { return mean < c.mean; }
+  };
+
+  double p_compression;
+  double p_total;
+  double p_buffer_weight;
+  double p_min;
+  double p_max;
+  std::vector<Centroid> p_centroids;
+  std::vector<Centroid> p_buffer;
+};
+
+/**
+ * Combine accumulators from all processes in a communicator using a
+ * binomial tree. On return, process 0 holds the merged accumulators. If
+ * broadcast is true, all processes hold the merged accumulators. This is a
+ * collective operation and all processes must pass vectors of the same
+ * length.
+ * @param comm communicator
+ * @param stats vector of accumulators (RunningStats or QuantileSketch)
+ * @param broadcast if true, copy result to all processes
+ */
+template <class _Stats>
+void reduceStats(const parallel::Communicator &comm,
+    std::vector<_Stats> &stats, bool broadcast = false)
+{
+  MPI_Comm mpi_comm = static_cast<MPI_Comm>(comm);
+  int me = comm.rank();
+  int nprocs = comm.size();
+  int nstats = stats.size();
+  int step, i;
+  std::vector<double> buf;
+  for (step = 1; step < nprocs; step *= 2) {
+    if (me%(2*step) == 0) {
+      int partner = me + step;
+      if (partner < nprocs) {
+        MPI_Status status;
+        int len;
+        MPI_Probe(partner, step, mpi_comm, &status);
+        MPI_Get_count(&status, MPI_DOUBLE, &len);
+        buf.resize(len+1);
+        MPI_Recv(&buf[0], len, MPI_DOUBLE, partner, step, mpi_comm,
+            &status);
+        int pos = 0;
+        for (i=0; i<nstats; i++) {
+          _Stats tmp(stats[i]);
+          tmp.unpack(&buf[0], pos);
+          stats[i].merge(tmp);
+        }
+      }
+    } else if (me%(2*step) == step) {
+      buf.clear();
+      for (i=0; i<nstats; i++) stats[i].pack(buf);
+      int len = buf.size();
+      if (len == 0) buf.resize(1);
+      MPI_Send(&buf[0], len, MPI_DOUBLE, me-step, step, mpi_comm);
+      break;
+    }
+  }
+  if (broadcast && nprocs > 1) {
+    buf.clear();
+    int len = 0;
+    if (me == 0) {
+      for (i=0; i<nstats; i++) stats[i].pack(buf);
+      len = buf.size();
+    }
+    MPI_Bcast(&len, 1, MPI_INT, 0, mpi_comm);
+    buf.resize(len+1);
+    MPI_Bcast(&buf[0], len, MPI_DOUBLE, 0, mpi_comm);
+    if (me != 0) {
+      int pos = 0;
+      for (i=0; i<nstats; i++) stats[i].unpack(&buf[0], pos);
+    }
+  }
+}
+
+} // namespace analysis
+} // namespace gridpack
+
+#endif
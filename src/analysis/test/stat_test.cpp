@@ -0,0 +1,282 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   stat_test.cpp
+ * @date   October 19, 2026
+ *
+ * @brief  Test running statistics and quantile sketches against exact
+ * values computed from the complete data set and check that a StatBlock in
+ * streaming mode writes the same results as a StatBlock that stores the
+ * table, both when complete columns are added and when rows are scattered
+ * from different processes
+ */
+// -------------------------------------------------------------
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <algorithm>
+#include <ga.h>
+#include "gridpack/parallel/parallel.hpp"
+#include "gridpack/environment/environment.hpp"
+#include "gridpack/analysis/streaming_stats.hpp"
+#include "gridpack/analysis/stat_block.hpp"
+
+#define NVALS 20000
+#define NROWS 7
+#define NCOLS 25
+
+/**
+ * Compare two files written by StatBlock. Integer fields must match and
+ * floating point fields must agree to a relative tolerance
+ * @param file1 name of first file
+ * @param file2 name of second file
+ * @return true if files agree
+ */
+bool compareFiles(const char *file1, const char *file2)
+{
+  std::ifstream f1(file1), f2(file2);
+  if (!f1.is_open() || !f2.is_open()) {
+    printf("Unable to open %s or %s\n",file1,file2);
+    return false;
+  }
+  std::string t1, t2;
+  int ntok = 0;
+  while (f1 >> t1) {
+    if (!(f2 >> t2)) {
+      printf("%s is shorter than %s\n",file2,file1);
+      return false;
+    }
+    ntok++;
+    if (t1 == t2) continue;
+    double v1 = atof(t1.c_str());
+    double v2 = atof(t2.c_str());
+    double scale = std::max(1.0,std::max(fabs(v1),fabs(v2)));
+    if (fabs(v1-v2) > 1.0e-7*scale) {
+      printf("%s and %s differ at entry %d: %s %s\n",file1,file2,ntok,
+          t1.c_str(),t2.c_str());
+      return false;
+    }
+  }
+  if (f2 >> t2) {
+    printf("%s is longer than %s\n",file2,file1);
+    return false;
+  }
+  return ntok > 0;
+}
+
+// -------------------------------------------------------------
+//  Main Program
+// -------------------------------------------------------------
+int
+main(int argc, char **argv)
+{
+  gridpack::Environment env(argc, argv);
+  int ret = 0;
+  // Create an artificial scope so that all objects call their destructors
+  // before GA_Terminate is called
+  if (1) {
+    gridpack::parallel::Communicator world;
+    int me = world.rank();
+    int nproc = world.size();
+    int i, j;
+    int chk = 1;
+
+    // Uniform values 0..NVALS-1 and exponentially distributed values are
+    // added in scrambled order, distributed over all processes
+    gridpack::analysis::RunningStats stats;
+    std::vector<gridpack::analysis::QuantileSketch> sketch(2);
+    for (i=0; i<NVALS; i++) {
+      int k = static_cast<int>((static_cast<long>(i)*7919)%NVALS);
+      if (k%nproc != me) continue;
+      double u = static_cast<double>(k);
+      stats.add(u,k);
+      sketch[0].add(u);
+      sketch[1].add(-log(1.0-(u+0.5)/static_cast<double>(NVALS)));
+    }
+    std::vector<gridpack::analysis::RunningStats> vstats(1,stats);
+    gridpack::analysis::reduceStats(world,vstats);
+    gridpack::analysis::reduceStats(world,sketch);
+
+    if (me == 0) {
+      // exact moments of 0..N-1
+      double n = static_cast<double>(NVALS);
+      double mean = 0.5*(n-1.0);
+      double var = n*(n+1.0)/12.0;
+      const gridpack::analysis::RunningStats &s = vstats[0];
+      if (s.count() != NVALS || fabs(s.mean()-mean) > 1.0e-9*mean
+          || fabs(s.variance()-var) > 1.0e-9*var || s.min() != 0.0
+          || s.max() != n-1.0 || s.minIndex() != 0
+          || s.maxIndex() != NVALS-1) {
+        printf("Running statistics incorrect: count %ld mean %f (%f)"
+            " variance %f (%f) min %f max %f\n",s.count(),s.mean(),mean,
+            s.variance(),var,s.min(),s.max());
+        chk = 0;
+      } else {
+        printf("Running statistics OK\n");
+      }
+
+      // compare estimated quantiles with exact quantiles. The error is
+      // measured in rank, i.e. by evaluating the exact distribution
+      // function at the estimate
+      double q[] = {0.0, 0.001, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99,
+        0.999, 1.0};
+      int nq = sizeof(q)/sizeof(double);
+      double maxerr[2] = {0.0, 0.0};
+      for (i=0; i<nq; i++) {
+        double est = sketch[0].quantile(q[i]);
+        double exact = q[i]*(n-1.0);
+        double err = fabs(est-exact)/n;
+        if (err > maxerr[0]) maxerr[0] = err;
+        est = sketch[1].quantile(q[i]);
+        double F = 1.0-exp(-est);
+        exact = std::min(std::max(q[i],0.5/n),1.0-0.5/n);
+        err = fabs(F-exact);
+        if (err > maxerr[1]) maxerr[1] = err;
+      }
+      if (sketch[0].count() != n || sketch[1].count() != n) {
+        printf("Quantile sketch count incorrect: %f %f\n",sketch[0].count(),
+            sketch[1].count());
+        chk = 0;
+      }
+      if (maxerr[0] > 0.005 || maxerr[1] > 0.005) {
+        printf("Quantile sketch error too large: uniform %e exponential %e\n",
+            maxerr[0],maxerr[1]);
+        chk = 0;
+      } else {
+        printf("Quantile sketch OK, maximum rank error: uniform %e"
+            " exponential %e\n",maxerr[0],maxerr[1]);
+      }
+    }
+
+    // the same table is added to a StatBlock that stores all values and to
+    // one that only keeps running statistics. Columns are added by
+    // different processes
+    gridpack::analysis::StatBlock table(world,NROWS,NCOLS);
+    gridpack::analysis::StatBlock stream(world,NROWS,NCOLS,true);
+    std::vector<int> idx1(NROWS), idx2(NROWS);
+    std::vector<std::string> tags(NROWS,"1 ");
+    std::vector<double> vmin(NROWS), vmax(NROWS);
+    for (i=0; i<NROWS; i++) {
+      idx1[i] = i+1;
+      idx2[i] = i+11;
+      vmin[i] = -0.5;
+      vmax[i] = 0.5;
+    }
+    if (me == 0) {
+      table.addRowLabels(idx1,idx2,tags);
+      stream.addRowLabels(idx1,idx2,tags);
+      table.addRowMinValue(vmin);
+      stream.addRowMinValue(vmin);
+      table.addRowMaxValue(vmax);
+      stream.addRowMaxValue(vmax);
+    }
+    std::vector<double> vals(NROWS);
+    std::vector<int> mask(NROWS);
+    for (j=0; j<NCOLS; j++) {
+      if (j%nproc != me) continue;
+      for (i=0; i<NROWS; i++) {
+        vals[i] = sin(static_cast<double>(i*NCOLS+j));
+        mask[i] = (i+j)%5 == 0 ? 0 : ((i*j)%3 == 0 ? 2 : 1);
+      }
+      table.addColumnValues(j,vals,mask);
+      stream.addColumnValues(j,vals,mask);
+    }
+    world.sync();
+    table.writeMeanAndRMS("table_mean.txt",1);
+    stream.writeMeanAndRMS("stream_mean.txt",1);
+    table.writeMinAndMax("table_mm.txt",1);
+    stream.writeMinAndMax("stream_mm.txt",1);
+    table.writeMaskValueCount("table_cnt.txt",2);
+    stream.writeMaskValueCount("stream_cnt.txt",2);
+    table.sumColumnValues("table_sum.txt",1);
+    stream.sumColumnValues("stream_sum.txt",1);
+    if (me == 0) {
+      bool ok = compareFiles("table_mean.txt","stream_mean.txt");
+      ok = compareFiles("table_mm.txt","stream_mm.txt") && ok;
+      ok = compareFiles("table_cnt.txt","stream_cnt.txt") && ok;
+      ok = compareFiles("table_sum.txt","stream_sum.txt") && ok;
+      if (ok) {
+        printf("Streaming StatBlock OK\n");
+      } else {
+        printf("Streaming StatBlock output differs from stored table\n");
+        chk = 0;
+      }
+    }
+
+    // add the same table with the scatter functions. Each process
+    // contributes the labels, bounds and values for a subset of rows
+    gridpack::analysis::StatBlock stable(world,NROWS,NCOLS);
+    gridpack::analysis::StatBlock sstream(world,NROWS,NCOLS,true);
+    std::vector<int> rows;
+    std::vector<int> ridx;
+    std::vector<std::string> rtags;
+    std::vector<double> rmin, rmax;
+    for (i=0; i<NROWS; i++) {
+      if (i%nproc != (nproc-1-me)) continue;
+      rows.push_back(i);
+      ridx.push_back(idx1[i]);
+      rtags.push_back(tags[i]);
+      rmin.push_back(vmin[i]-0.1*static_cast<double>(i));
+      rmax.push_back(vmax[i]+0.1*static_cast<double>(i));
+    }
+    stable.scatterRowLabels(rows,ridx,rtags);
+    sstream.scatterRowLabels(rows,ridx,rtags);
+    stable.scatterRowMinValue(rows,rmin);
+    sstream.scatterRowMinValue(rows,rmin);
+    stable.scatterRowMaxValue(rows,rmax);
+    sstream.scatterRowMaxValue(rows,rmax);
+    vals.resize(rows.size());
+    mask.resize(rows.size());
+    for (j=0; j<NCOLS; j++) {
+      for (i=0; i<rows.size(); i++) {
+        int row = rows[i];
+        vals[i] = cos(static_cast<double>(row*NCOLS+j));
+        mask[i] = (row+j)%4 == 0 ? 0 : ((row*j)%3 == 0 ? 2 : 1);
+      }
+      stable.scatterColumnValues(j,rows,vals,mask);
+      sstream.scatterColumnValues(j,rows,vals,mask);
+    }
+    world.sync();
+    stable.writeMeanAndRMS("scatter_table_mean.txt",1);
+    sstream.writeMeanAndRMS("scatter_stream_mean.txt",1);
+    stable.writeMinAndMax("scatter_table_mm.txt",1);
+    sstream.writeMinAndMax("scatter_stream_mm.txt",1);
+    stable.writeMaskValueCount("scatter_table_cnt.txt",2);
+    sstream.writeMaskValueCount("scatter_stream_cnt.txt",2);
+    stable.sumColumnValues("scatter_table_sum.txt",1);
+    sstream.sumColumnValues("scatter_stream_sum.txt",1);
+    if (me == 0) {
+      bool ok = compareFiles("scatter_table_mean.txt",
+          "scatter_stream_mean.txt");
+      ok = compareFiles("scatter_table_mm.txt","scatter_stream_mm.txt") && ok;
+      ok = compareFiles("scatter_table_cnt.txt","scatter_stream_cnt.txt")
+        && ok;
+      ok = compareFiles("scatter_table_sum.txt","scatter_stream_sum.txt")
+        && ok;
+      if (ok) {
+        printf("Streaming StatBlock scatter OK\n");
+      } else {
+        printf("Streaming StatBlock scatter output differs from stored"
+            " table\n");
+        chk = 0;
+      }
+    }
+
+    world.min(&chk,1);
+    if (chk) {
+      if (me == 0) printf("\nStatistics test passed\n");
+    } else {
+      if (me == 0) printf("\nStatistics test failed\n");
+      ret = 1;
+    }
+  }
+  return ret;
+}
@@ -858,14 +858,11 @@ bool gridpack::powerflow::PFBus::serialWrite(char *string, const int bufsize,
       */
     }
   } else if (!strcmp(signal,"vr_str")) {
-    double pi = 4.0*atan(1.0);
-    double angle = p_a*180.0/pi;
-    int use_vmag = 1;
-    if (p_saveisPV || p_original_isolated) use_vmag = 0;
-    int changed = 0;
-    if (p_isPV != p_saveisPV) changed = 1;
+    double angle, vmag;
+    int use_vmag, changed;
+    getVoltageResults(&angle,&vmag,&use_vmag,&changed);
     sprintf(string, "%6d %20.12e %20.12e %d %d\n",
-        getOriginalIndex(),angle,p_v,use_vmag,changed);
+        getOriginalIndex(),angle,vmag,use_vmag,changed);
   } else if (!strcmp(signal,"vfail_str")) {
     int use_vmag = 1;
     if (p_saveisPV || p_original_isolated) use_vmag = 0;
@@ -988,61 +985,17 @@ bool gridpack::powerflow::PFBus::serialWrite(char *string, const int bufsize,
     char sbuf[128];
     char *cptr = string;
     int i, len, slen = 0;
-    int ngen=p_pFac.size();
-    // Evalate p_Pinj and p_Qinj if bus is reference bus. This is skipped when
-    // evaluating matrix elements.
-#ifndef LARGE_MATRIX
-    if (getReferenceBus() || isIsolated()) {
-      std::vector<boost::shared_ptr<BaseComponent> > branches;
-      getNeighborBranches(branches);
-      int size = branches.size();
-      double P, Q, p, q;
-      P = 0.0;
-      Q = 0.0;
-      for (i=0; i<size; i++) {
-        gridpack::powerflow::PFBranch *branch
-          = dynamic_cast<gridpack::powerflow::PFBranch*>(branches[i].get());
-        branch->getPQ(this, &p, &q);
-        P += p;
-        Q += q;
-      }
-      // Also add bus i's own Pi, Qi
-      P += p_v*p_v*p_ybusr;
-      Q += p_v*p_v*(-p_ybusi);
-      p_Pinj = P;
-      p_Qinj = Q;
-    }
-#endif
-    double pl =0.0;
-    double ql =0.0;
-    for (i=0; i<p_pl.size(); i++) {
-      if (p_lstatus[i] == 1) {
-        pl += p_pl[i];
-        ql += p_ql[i];
-      }
-    }
+    std::vector<std::string> tags;
+    std::vector<double> pg, qg;
+    getGeneratorPower(tags, pg, qg);
+    int ngen = pg.size();
     for (i=0; i<ngen; i++) {
-      double pval = 0.0;
-      double qval = 0.0;
-
-      if(getReferenceBus()) {
-	pval = p_pFac[i]*(p_Pinj*p_sbase+pl);
-	qval = p_pFac[i]*(p_Qinj*p_sbase+ql);
-      } else if (p_isPV) {
-	pval = p_pg[i];
-	if(p_gstatus[i]) {
-	  qval = p_pFac[i]*(p_Qinj*p_sbase+ql);
-	}
-      } else {
-	pval = p_pg[i];
-	qval = p_qg[i];
-      }
       if (!strcmp(signal,"power")) {
         sprintf(sbuf, "     %6d      %s   %12.6f      %12.6f\n",
-            getOriginalIndex(),p_gid[i].c_str(),pval,qval);
+            getOriginalIndex(),tags[i].c_str(),pg[i],qg[i]);
       } else {
         sprintf(sbuf, "%6d %s %20.12e %20.12e\n",
-            getOriginalIndex(),p_gid[i].c_str(),pval,qval);
+            getOriginalIndex(),tags[i].c_str(),pg[i],qg[i]);
       }
       len = strlen(sbuf);
       if (slen+len<=bufsize) {
@@ -1519,6 +1472,30 @@ void gridpack::powerflow::PFBus::pushIsPV()
   if (p_PV_ptr) p_isPV = *p_PV_ptr;
 }
 
+/**
+ * Get scheduled real and reactive power injections (generation minus
+ * load) that appear in the power flow equations
+ * @param p0 scheduled real power injection
+ * @param q0 scheduled reactive power injection
+ */
+void gridpack::powerflow::PFBus::getScheduledPower(double *p0, double *q0)
+{
+  *p0 = p_P0;
+  *q0 = p_Q0;
+}
+
+/**
+ * Set calculated real and reactive power injections. This is used if
+ * the power flow equations are evaluated outside the bus
+ * @param pinj calculated real power injection
+ * @param qinj calculated reactive power injection
+ */
+void gridpack::powerflow::PFBus::setPowerInjection(double pinj, double qinj)
+{
+  p_Pinj = pinj;
+  p_Qinj = qinj;
+}
+
 
 /**
  * Evaluate RHS values for powerflow equation and return result as
@@ -1531,16 +1508,14 @@ int gridpack::powerflow::PFBus::rhsValues(double *rvals)
   if (!isIsolated()) {
     if (!getReferenceBus()) {
       int nvals;
-      std::vector<boost::shared_ptr<BaseComponent> > branches;
-      getNeighborBranches(branches);
-      int size = branches.size();
+      int size = numNeighborBranches();
       int i;
       double P, Q, p, q;
       P = 0.0;
       Q = 0.0;
       for (i=0; i<size; i++) {
         gridpack::powerflow::PFBranch *branch
-          = dynamic_cast<gridpack::powerflow::PFBranch*>(branches[i].get());
+          = dynamic_cast<gridpack::powerflow::PFBranch*>(getNeighborBranch(i));
         branch->getPQ(this, &p, &q);
         P += p;
         Q += q;
@@ -1570,16 +1545,14 @@ int gridpack::powerflow::PFBus::rhsValues(double *rvals)
       return nvals;
     } else {
 #ifdef LARGE_MATRIX
-      std::vector<boost::shared_ptr<BaseComponent> > branches;
-      getNeighborBranches(branches);
-      int size = branches.size();
+      int size = numNeighborBranches();
       int i;
       double P, Q, p, q;
       P = 0.0;
       Q = 0.0;
       for (i=0; i<size; i++) {
         gridpack::powerflow::PFBranch *branch
-          = dynamic_cast<gridpack::powerflow::PFBranch*>(branches[i].get());
+          = dynamic_cast<gridpack::powerflow::PFBranch*>(getNeighborBranch(i));
         branch->getPQ(this, &p, &q);
         P += p;
         Q += q;
@@ -1816,6 +1789,97 @@ void gridpack::powerflow::PFBus::getLoadPower(
   }
 }
 
+/**
+ * Get voltage results for bus. These are the same values reported by
+ * the "vr_str" signal in serialWrite
+ * @param angle voltage angle (degrees)
+ * @param vmag voltage magnitude
+ * @param use_vmag 0 if bus is a PV bus or was originally isolated, 1
+ *        otherwise
+ * @param changed 1 if bus has switched between PV and PQ, 0 otherwise
+ */
+void gridpack::powerflow::PFBus::getVoltageResults(double *angle,
+    double *vmag, int *use_vmag, int *changed)
+{
+  double pi = 4.0*atan(1.0);
+  *angle = p_a*180.0/pi;
+  *vmag = p_v;
+  *use_vmag = 1;
+  if (p_saveisPV || p_original_isolated) *use_vmag = 0;
+  *changed = 0;
+  if (p_isPV != p_saveisPV) *changed = 1;
+}
+
+/**
+ * Get real and reactive power for all generators on bus. These are the
+ * same values reported by the "power" signal in serialWrite
+ * @param tag character ID for generator
+ * @param pg generator real power (MW)
+ * @param qg generator reactive power (MVAR)
+ */
+void gridpack::powerflow::PFBus::getGeneratorPower(
+    std::vector<std::string> &tag, std::vector<double> &pg,
+    std::vector<double> &qg)
+{
+  int i;
+  int ngen=p_pFac.size();
+  // Evalate p_Pinj and p_Qinj if bus is reference bus. This is skipped when
+  // evaluating matrix elements.
+#ifndef LARGE_MATRIX
+  if (getReferenceBus() || isIsolated()) {
+    std::vector<boost::shared_ptr<BaseComponent> > branches;
+    getNeighborBranches(branches);
+    int size = branches.size();
+    double P, Q, p, q;
+    P = 0.0;
+    Q = 0.0;
+    for (i=0; i<size; i++) {
+      gridpack::powerflow::PFBranch *branch
+        = dynamic_cast<gridpack::powerflow::PFBranch*>(branches[i].get());
+      branch->getPQ(this, &p, &q);
+      P += p;
+      Q += q;
+    }
+    // Also add bus i's own Pi, Qi
+    P += p_v*p_v*p_ybusr;
+    Q += p_v*p_v*(-p_ybusi);
+    p_Pinj = P;
+    p_Qinj = Q;
+  }
+#endif
+  double pl =0.0;
+  double ql =0.0;
+  for (i=0; i<p_pl.size(); i++) {
+    if (p_lstatus[i] == 1) {
+      pl += p_pl[i];
+      ql += p_ql[i];
+    }
+  }
+  tag.resize(ngen);
+  pg.resize(ngen);
+  qg.resize(ngen);
+  for (i=0; i<ngen; i++) {
+    double pval = 0.0;
+    double qval = 0.0;
+
+    if(getReferenceBus()) {
+      pval = p_pFac[i]*(p_Pinj*p_sbase+pl);
+      qval = p_pFac[i]*(p_Qinj*p_sbase+ql);
+    } else if (p_isPV) {
+      pval = p_pg[i];
+      if(p_gstatus[i]) {
+        qval = p_pFac[i]*(p_Qinj*p_sbase+ql);
+      }
+    } else {
+      pval = p_pg[i];
+      qval = p_qg[i];
+    }
+    tag[i] = p_gid[i];
+    pg[i] = pval;
+    qg[i] = qval;
+  }
+}
+
 /**
  * Label bus as a source for real time path rating
  * @param flag identify bus as source
@@ -2273,33 +2337,21 @@ bool gridpack::powerflow::PFBranch::serialWrite(char *string, const int bufsize,
   if (signal == NULL || !strcmp(signal,"flow_str")) {
     bool rating = false;
     if (signal != NULL) rating = !strcmp(signal,"flow_str");
-    gridpack::ComplexType s;
-    std::vector<std::string> tags = getLineTags();
+    std::vector<std::string> tags;
+    std::vector<double> p, q, perf, rateA;
+    std::vector<int> viol;
+    getFlowResults(tags, p, q, perf, rateA, viol);
     int i;
     int ilen = 0;
     for (i=0; i<p_elems; i++) {
-      s = getComplexPower(tags[i]);
-      double p = real(s);
-      double q = imag(s);
-      if (!p_branch_status[i]) p = 0.0;
-      if (!p_branch_status[i]) q = 0.0;
-      if (bus1->isIsolated() || bus2->isIsolated()) p=0.0;
-      if (bus1->isIsolated() || bus2->isIsolated()) q=0.0;
-      double perf = 0.0;
-      int viol = 0;
-      if (p_rateA[i] > 0.0) {
-        perf = abs(s)/p_rateA[i];
-        if (perf > 1.0) viol = 1;
-        perf = perf*perf;
-      }
       if (rating) {
         sprintf(buf, "%6d %6d %s %20.12e %20.12e %20.12e %20.12e %1d\n",
             getBus1OriginalIndex(),getBus2OriginalIndex(),tags[i].c_str(),
-            p,q,perf,p_rateA[i],viol);
+            p[i],q[i],perf[i],rateA[i],viol[i]);
       } else {
         sprintf(buf, "     %6d      %6d     %s   %12.6f         %12.6f\n",
             getBus1OriginalIndex(),getBus2OriginalIndex(),tags[i].c_str(),
-            p,q);
+            p[i],q[i]);
       }
       ilen += strlen(buf);
       if (ilen<bufsize) sprintf(string,"%s",buf);
@@ -2486,6 +2538,72 @@ std::vector<std::string> gridpack::powerflow::PFBranch::getLineIDs()
   return p_ckt;
 }
 
+/**
+ * Is the branch part of the power flow Jacobian?
+ * @return true if at least one line on branch is in service
+ */
+bool gridpack::powerflow::PFBranch::isActive()
+{
+  return p_active;
+}
+
+/**
+ * Get power flow results for all lines in branch. These are the same
+ * values reported by the "flow_str" signal in serialWrite
+ * @param tag character ID for line
+ * @param p real power flow
+ * @param q reactive power flow
+ * @param perf square of ratio of apparent power to rating A (zero if
+ *        line has no rating)
+ * @param rating line rating A
+ * @param viol 1 if flow exceeds rating, 0 otherwise
+ * @return false if branch is not active
+ */
+bool gridpack::powerflow::PFBranch::getFlowResults(
+    std::vector<std::string> &tag, std::vector<double> &p,
+    std::vector<double> &q, std::vector<double> &perf,
+    std::vector<double> &rating, std::vector<int> &viol)
+{
+  gridpack::powerflow::PFBus *bus1
+    = dynamic_cast<gridpack::powerflow::PFBus*>(getBus1().get());
+  gridpack::powerflow::PFBus *bus2
+    = dynamic_cast<gridpack::powerflow::PFBus*>(getBus2().get());
+  bool isolated = bus1->isIsolated() || bus2->isIsolated();
+  tag.clear();
+  p.clear();
+  q.clear();
+  perf.clear();
+  rating.clear();
+  viol.clear();
+  if (!p_active) return false;
+  tag = getLineTags();
+  p.resize(p_elems);
+  q.resize(p_elems);
+  perf.resize(p_elems);
+  rating.resize(p_elems);
+  viol.resize(p_elems);
+  gridpack::ComplexType s;
+  int i;
+  for (i=0; i<p_elems; i++) {
+    s = getComplexPower(tag[i]);
+    p[i] = real(s);
+    q[i] = imag(s);
+    if (!p_branch_status[i] || isolated) {
+      p[i] = 0.0;
+      q[i] = 0.0;
+    }
+    perf[i] = 0.0;
+    viol[i] = 0;
+    if (p_rateA[i] > 0.0) {
+      double ratio = abs(s)/p_rateA[i];
+      if (ratio > 1.0) viol[i] = 1;
+      perf[i] = ratio*ratio;
+    }
+    rating[i] = p_rateA[i];
+  }
+  return true;
+}
+
 /**
  * Set parameter to ignore voltage violations
  * @param tag identifier of line element
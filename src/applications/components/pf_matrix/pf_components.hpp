@@ -345,6 +345,22 @@ class PFBus
      */
     void pushIsPV();
 
+    /**
+     * Get scheduled real and reactive power injections (generation minus
+     * load) that appear in the power flow equations
+     * @param p0 scheduled real power injection
+     * @param q0 scheduled reactive power injection
+     */
+    void getScheduledPower(double *p0, double *q0);
+
+    /**
+     * Set calculated real and reactive power injections. This is used if
+     * the power flow equations are evaluated outside the bus
+     * @param pinj calculated real power injection
+     * @param qinj calculated reactive power injection
+     */
+    void setPowerInjection(double pinj, double qinj);
+
     /**
      * Get vector containing generator participation
      * @return vector of generator participation factors
@@ -419,6 +435,28 @@ class PFBus
     void getLoadPower(std::vector<std::string> &tag, std::vector<double> &pl,
         std::vector<double> &ql, std::vector<int> &status);
 
+    /**
+     * Get voltage results for bus. These are the same values reported by
+     * the "vr_str" signal in serialWrite
+     * @param angle voltage angle (degrees)
+     * @param vmag voltage magnitude
+     * @param use_vmag 0 if bus is a PV bus or was originally isolated, 1
+     *        otherwise
+     * @param changed 1 if bus has switched between PV and PQ, 0 otherwise
+     */
+    void getVoltageResults(double *angle, double *vmag, int *use_vmag,
+        int *changed);
+
+    /**
+     * Get real and reactive power for all generators on bus. These are the
+     * same values reported by the "power" signal in serialWrite
+     * @param tag character ID for generator
+     * @param pg generator real power (MW)
+     * @param qg generator reactive power (MVAR)
+     */
+    void getGeneratorPower(std::vector<std::string> &tag,
+        std::vector<double> &pg, std::vector<double> &qg);
+
     /**
      * Label bus as a source for real time path rating
      * @param flag identify bus as source
@@ -670,6 +708,28 @@ class PFBranch
      */
     std::vector<std::string> getLineIDs();
 
+    /**
+     * Is the branch part of the power flow Jacobian?
+     * @return true if at least one line on branch is in service
+     */
+    bool isActive();
+
+    /**
+     * Get power flow results for all lines in branch. These are the same
+     * values reported by the "flow_str" signal in serialWrite
+     * @param tag character ID for line
+     * @param p real power flow
+     * @param q reactive power flow
+     * @param perf square of ratio of apparent power to rating A (zero if
+     *        line has no rating)
+     * @param rating line rating A
+     * @param viol 1 if flow exceeds rating, 0 otherwise
+     * @return false if branch is not active
+     */
+    bool getFlowResults(std::vector<std::string> &tag, std::vector<double> &p,
+        std::vector<double> &q, std::vector<double> &perf,
+        std::vector<double> &rating, std::vector<int> &viol);
+
     /**
      * Set parameter to ignore voltage violations
      * @param tag identifier of line element
@@ -92,14 +92,12 @@ bool gridpack::ymatrix::YMBus::matrixDiagValues(ComplexType *values)
 void gridpack::ymatrix::YMBus::setYBus(void)
 {
   gridpack::ComplexType ret(0.0,0.0);
-  std::vector<boost::shared_ptr<BaseComponent> > branches;
-  getNeighborBranches(branches);
-  int size = branches.size();
+  int size = numNeighborBranches();
   int i;
   // HACK: Need to cast pointer, is there a better way?
   for (i=0; i<size; i++) {
     gridpack::ymatrix::YMBranch *branch
-      = dynamic_cast<gridpack::ymatrix::YMBranch*>(branches[i].get());
+      = dynamic_cast<gridpack::ymatrix::YMBranch*>(getNeighborBranch(i));
     ret -= branch->getAdmittance();
     ret -= branch->getTransformer(this);
     ret += branch->getShunt(this);
@@ -41,6 +41,43 @@ gridpack::contingency_analysis::CADriver::~CADriver(void)
 {
 }
 
+/**
+ * Assign StatBlock rows to entries for network components owned by this
+ * process. Rows are ordered by the global index of the component and then
+ * by the order of entries within each component, which matches the order
+ * used by the serial IO writeStrings functions.
+ * @param comm communicator over which network is distributed
+ * @param nglobal total number of network components
+ * @param gidx global index of component for each local entry
+ * @param rows row index for each local entry
+ * @return total number of rows
+ */
+int gridpack::contingency_analysis::CADriver::setRowIndices(
+    const gridpack::parallel::Communicator &comm, int nglobal,
+    const std::vector<int> &gidx, std::vector<int> &rows)
+{
+  // Count entries for each component and find offset of first entry
+  std::vector<int> offset(nglobal+1,0);
+  int nsize = gidx.size();
+  int i;
+  for (i=0; i<nsize; i++) {
+    offset[gidx[i]+1]++;
+  }
+  comm.sum(&offset[0],nglobal+1);
+  for (i=0; i<nglobal; i++) {
+    offset[i+1] += offset[i];
+  }
+  // All entries for a component are on the same process, so the local copy
+  // of the offset can be incremented as each entry is assigned
+  int ret = offset[nglobal];
+  rows.resize(nsize);
+  for (i=0; i<nsize; i++) {
+    rows[i] = offset[gidx[i]];
+    offset[gidx[i]]++;
+  }
+  return ret;
+}
+
 /**
  * Get list of contingencies from external file
  * @param cursor pointer to contingencies in input deck
@@ -204,6 +241,11 @@ void gridpack::contingency_analysis::CADriver::execute(int argc, char** argv)
   if (!cursor->get("checkQLimit",&check_Qlim)) {
     check_Qlim = false;
   }
+  // If a task cost file is specified, use estimated costs from a previous
+  // run to schedule contingencies. Measured times are written back to the
+  // same file at the end of the run
+  std::string costfile;
+  bool use_costs = cursor->get("taskCostFile",&costfile);
   gridpack::parallel::Communicator task_comm = world.divide(grp_size);
 
   // Keep track of failed calculations
@@ -219,10 +261,14 @@ void gridpack::contingency_analysis::CADriver::execute(int argc, char** argv)
   boost::shared_ptr<gridpack::powerflow::PFNetwork>
     pf_network(new gridpack::powerflow::PFNetwork(task_comm));
   gridpack::powerflow::PFAppModule pf_app;
-  // Read in the network from an external file and partition it over the
-  // processors in the task communicator. This will read in power flow
-  // parameters from the Powerflow block in the input
-  pf_app.readNetwork(pf_network,config);
+  // Read in the network from an external file once and keep it in shared
+  // memory on each node. Each task communicator creates its network from
+  // this copy and partitions it over its processors. This will read in power
+  // flow parameters from the Powerflow block in the input
+  gridpack::parser::SharedCase<gridpack::powerflow::PFNetwork>
+    base_case(world);
+  pf_app.readSharedCase(base_case,config);
+  pf_app.readNetwork(pf_network,base_case,config);
   // Finish initializing the network
   pf_app.initialize();
   //  Set minimum and maximum voltage limits on all buses
@@ -284,8 +330,18 @@ void gridpack::contingency_analysis::CADriver::execute(int argc, char** argv)
   // Set up task manager on the world communicator. The number of tasks is
   // equal to the number of contingencies
   gridpack::parallel::TaskManager taskmgr(world);
+  gridpack::parallel::CostTaskManager costmgr(world);
   int ntasks = events.size();
-  taskmgr.set(ntasks);
+  if (use_costs) {
+    std::vector<double> costs;
+    if (!gridpack::parallel::CostTaskManager::readTaskCosts(world,costfile,
+          ntasks,costs) && world.rank() == 0) {
+      printf("No task costs found in %s, using unit costs\n",costfile.c_str());
+    }
+    costmgr.set(costs,task_comm);
+  } else {
+    taskmgr.set(ntasks);
+  }
 
   int nbus = pf_network->totalBuses();
   // Get bus voltage information for base case
@@ -293,38 +349,47 @@ void gridpack::contingency_analysis::CADriver::execute(int argc, char** argv)
 #ifdef USE_STATBLOCK
   int t_store = timer->createCategory("Store Statistics");
   timer->start(t_store);
-  std::vector<std::string> v_vals = pf_app.writeBusString("vr_str");
-  int nsize = v_vals.size();
-  std::vector<int> mag_ids;
+  // Results are copied directly from the processes that own each bus or
+  // branch into the StatBlock objects. The base case is replicated on all
+  // task communicators, so only the one containing process 0 adds it.
+  int base_grp = 0;
+  if (world.rank() == 0) base_grp = 1;
+  task_comm.max(&base_grp,1);
+  std::vector<int> gidx;
   std::vector<int> ids;
-  std::vector<int> branch_ids;
-  std::vector<std::string> mag_tags;
   std::vector<std::string> tags;
   std::vector<double> vmag;
   std::vector<double> vang;
+  std::vector<int> use_vmag;
+  std::vector<int> changed;
+  pf_app.getBusVoltages(gidx,ids,vang,vmag,use_vmag,changed);
+  int nsize = gidx.size();
+  // Only include voltage magnitudes for buses that are not PV buses or
+  // isolated
+  std::vector<int> mag_gidx;
+  std::vector<int> mag_ids;
+  std::vector<std::string> mag_tags;
+  std::vector<double> mag_vals;
   std::vector<int> mag_mask;
-  std::vector<int> mask;
-  // Find bus IDs and create a dummy tag label and get voltage magnitude
-  // and angle for base case
   for (i=0; i<nsize; i++) {
-    std::vector<std::string> tokens = util.blankTokenizer(v_vals[i]);
-    int not_isolated = atoi(tokens[3].c_str());
-    if (not_isolated == 1) {
-      mag_ids.push_back(atoi(tokens[0].c_str()));
+    if (use_vmag[i] == 1) {
+      mag_gidx.push_back(gidx[i]);
+      mag_ids.push_back(ids[i]);
       mag_tags.push_back("1 ");
-      vmag.push_back(atof(tokens[2].c_str()));
-      if (atoi(tokens[4].c_str()) != 0) {
+      mag_vals.push_back(vmag[i]);
+      if (changed[i] != 0) {
         mag_mask.push_back(2);
       } else {
         mag_mask.push_back(1);
       }
     }
-    ids.push_back(atoi(tokens[0].c_str()));
     tags.push_back("1 ");
-    vang.push_back(atof(tokens[1].c_str()));
-    mask.push_back(1);
   }
-  int nmags = vmag.size();
+  std::vector<int> mask(nsize,1);
+  std::vector<int> mag_rows;
+  std::vector<int> ang_rows;
+  int nmags = setRowIndices(task_comm,nbus,mag_gidx,mag_rows);
+  setRowIndices(task_comm,nbus,gidx,ang_rows);
   world.max(&nmags,1);
   world.max(&nbus,1);
 #endif
@@ -337,40 +402,22 @@ void gridpack::contingency_analysis::CADriver::execute(int argc, char** argv)
   // Add bus IDs and tags to StatBlock objects as well as base case values of
   // voltage magnitude and angle
 #ifdef USE_STATBLOCK
-  if (world.rank() == 0) {
-    vmag_stats.addRowLabels(mag_ids, mag_tags);
-    vang_stats.addRowLabels(ids, tags);
-    vmag_stats.addColumnValues(0,vmag,mag_mask);
-    vang_stats.addColumnValues(0,vang,mask);
+  if (base_grp) {
+    vmag_stats.scatterRowLabels(mag_rows, mag_ids, mag_tags);
+    vang_stats.scatterRowLabels(ang_rows, ids, tags);
+    vmag_stats.scatterColumnValues(0,mag_rows,mag_vals,mag_mask);
+    vang_stats.scatterColumnValues(0,ang_rows,vang,mask);
   }
 #endif
   // Get generator power information
 #ifdef USE_STATBLOCK
-  v_vals.clear();
-  ids.clear();
-  tags.clear();
-  mask.clear();
+  std::vector<int> gen_rows;
+  std::vector<int> gen_mask;
   std::vector<double> pgen;
   std::vector<double> qgen;
-  v_vals = pf_app.writeBusString("power");
-  nsize = v_vals.size();
-  // Find bus IDs and tags for generators and eveluate Pg and Qg for base case
-  for (i=0; i<nsize; i++) {
-    std::vector<std::string> tokens = util.blankTokenizer(v_vals[i]);
-    if (tokens.size()%4 != 0) {
-      printf("Incorrect generator listing\n");
-      continue;
-    }
-    int ngen = tokens.size()/4;
-    for (j=0; j<ngen; j++) {
-      ids.push_back(atoi(tokens[j*4].c_str()));
-      tags.push_back(tokens[j*4+1]);
-      pgen.push_back(atof(tokens[j*4+2].c_str()));
-      qgen.push_back(atof(tokens[j*4+3].c_str()));
-      mask.push_back(1);
-    }
-  }
-  nsize = pgen.size();
+  pf_app.getGeneratorPowers(gidx,ids,tags,pgen,qgen);
+  gen_mask.assign(pgen.size(),1);
+  nsize = setRowIndices(task_comm,nbus,gidx,gen_rows);
   world.max(&nsize,1);
 #endif
   // Create StatBlock objects for Pg and Qg and add labels as well as values for
@@ -378,54 +425,38 @@ void gridpack::contingency_analysis::CADriver::execute(int argc, char** argv)
 #ifdef USE_STATBLOCK
   gridpack::analysis::StatBlock pgen_stats(world,nsize,ntasks+1);
   gridpack::analysis::StatBlock qgen_stats(world,nsize,ntasks+1);
-  if (world.rank() == 0) {
-    pgen_stats.addRowLabels(ids, tags);
-    qgen_stats.addRowLabels(ids, tags);
-    pgen_stats.addColumnValues(0,pgen,mask);
-    qgen_stats.addColumnValues(0,qgen,mask);
+  if (base_grp) {
+    pgen_stats.scatterRowLabels(gen_rows, ids, tags);
+    qgen_stats.scatterRowLabels(gen_rows, ids, tags);
+    pgen_stats.scatterColumnValues(0,gen_rows,pgen,gen_mask);
+    qgen_stats.scatterColumnValues(0,gen_rows,qgen,gen_mask);
   }
 #endif
 
   // Find flow parameters for all branch lines
 #ifdef USE_STATBLOCK
-  v_vals.clear();
-  ids.clear();
-  tags.clear();
-  mask.clear();
   std::vector<int> id1;
   std::vector<int> id2;
-  std::vector<double> pmin, pmax;
+  std::vector<int> br_rows;
+  std::vector<int> viol;
+  std::vector<double> rating;
+  std::vector<double> pmin;
   std::vector<double> pflow;
   std::vector<double> qflow;
   std::vector<double> perf;
-  v_vals = pf_app.writeBranchString("flow_str");
-  nsize = v_vals.size();
-  // Parse branch line endpoints as well as line IDs and values of P and Q for
-  // base case
+  pf_app.getBranchFlows(gidx,id1,id2,tags,pflow,qflow,perf,rating,viol);
+  nsize = pflow.size();
+  pmin.resize(nsize);
+  mask.resize(nsize);
   for (i=0; i<nsize; i++) {
-    std::vector<std::string> tokens = util.blankTokenizer(v_vals[i]);
-    if (tokens.size()%8 != 0) {
-      printf("Incorrect branch power flow listing\n");
-      continue;
-    }
-    int nline = tokens.size()/8;
-    for (j=0; j<nline; j++) {
-      id1.push_back(atoi(tokens[j*8].c_str()));
-      id2.push_back(atoi(tokens[j*8+1].c_str()));
-      tags.push_back(tokens[j*8+2]);
-      pflow.push_back(atof(tokens[j*8+3].c_str()));
-      qflow.push_back(atof(tokens[j*8+4].c_str()));
-      perf.push_back(atof(tokens[j*8+5].c_str()));
-      pmin.push_back(-atof(tokens[j*8+6].c_str()));
-      pmax.push_back(atof(tokens[j*8+6].c_str()));
-      if (atoi(tokens[j*8+7].c_str()) == 0) {
-        mask.push_back(1);
-      } else {
-        mask.push_back(2);
-      }
+    pmin[i] = -rating[i];
+    if (viol[i] == 0) {
+      mask[i] = 1;
+    } else {
+      mask[i] = 2;
     }
   }
-  nsize = pflow.size();
+  nsize = setRowIndices(task_comm,pf_network->totalBranches(),gidx,br_rows);
   world.max(&nsize,1);
 #endif
   // Create StatBlock objects for flow parameters and add labels and base case
@@ -434,18 +465,22 @@ void gridpack::contingency_analysis::CADriver::execute(int argc, char** argv)
   gridpack::analysis::StatBlock pflow_stats(world,nsize,ntasks+1);
   gridpack::analysis::StatBlock qflow_stats(world,nsize,ntasks+1);
   gridpack::analysis::StatBlock perf_stats(world,nsize,ntasks+1);
-  if (world.rank() == 0) {
-    pflow_stats.addRowLabels(id1, id2, tags);
-    qflow_stats.addRowLabels(id1, id2, tags);
-    perf_stats.addRowLabels(id1, id2, tags);
-    pflow_stats.addColumnValues(0,pflow,mask);
-    qflow_stats.addColumnValues(0,qflow,mask);
-    perf_stats.addColumnValues(0,perf,mask);
-    pflow_stats.addRowMinValue(pmin);
-    qflow_stats.addRowMinValue(pmin);
-    pflow_stats.addRowMaxValue(pmax);
-    qflow_stats.addRowMaxValue(pmax);
+  if (base_grp) {
+    pflow_stats.scatterRowLabels(br_rows, id1, id2, tags);
+    qflow_stats.scatterRowLabels(br_rows, id1, id2, tags);
+    perf_stats.scatterRowLabels(br_rows, id1, id2, tags);
+    pflow_stats.scatterColumnValues(0,br_rows,pflow,mask);
+    qflow_stats.scatterColumnValues(0,br_rows,qflow,mask);
+    perf_stats.scatterColumnValues(0,br_rows,perf,mask);
+    pflow_stats.scatterRowMinValue(br_rows,pmin);
+    qflow_stats.scatterRowMinValue(br_rows,pmin);
+    pflow_stats.scatterRowMaxValue(br_rows,rating);
+    qflow_stats.scatterRowMaxValue(br_rows,rating);
   }
+  // Save selection of buses for voltage magnitudes so that the same rows are
+  // used for all contingencies
+  std::vector<int> mag_sel = use_vmag;
+  std::vector<int> ang_mask(ang_rows.size(),1);
   timer->stop(t_store);
 #endif
   if (check_Qlim) pf_app.clearQlimViolations();
@@ -456,7 +491,8 @@ void gridpack::contingency_analysis::CADriver::execute(int argc, char** argv)
   char sbuf[128];
   // nextTask returns the same task_id on all processors in task_comm. When the
   // calculation runs out of task, nextTask will return false.
-  while (taskmgr.nextTask(task_comm, &task_id)) {
+  while (use_costs ? costmgr.nextTask(task_comm, &task_id)
+      : taskmgr.nextTask(task_comm, &task_id)) {
     printf("Executing task %d on process %d\n",task_id,world.rank());
     sprintf(sbuf,"%s.out",events[task_id].p_name.c_str());
     // Open a new file, based on the contingency name, to store results from
@@ -508,9 +544,8 @@ void gridpack::contingency_analysis::CADriver::execute(int argc, char** argv)
       // If power flow solution is successful, write out voltages and currents
       if (print_calcs) pf_app.write();
       // Check for violations
-      bool ok1 = pf_app.checkVoltageViolations();
-      bool ok2 = pf_app.checkLineOverloadViolations();
-      bool ok = ok1 && ok2;
+      bool ok1, ok2;
+      bool ok = pf_app.checkViolations(ok1,ok2);
       // Include results of violation checks in output
       if (ok) {
         sprintf(sbuf,"\nNo violation for contingency %s\n",
@@ -542,99 +577,46 @@ void gridpack::contingency_analysis::CADriver::execute(int argc, char** argv)
         
       if (print_calcs) pf_app.print(sbuf);
       if (print_calcs) pf_app.writeCABranch();
-      // Get strings of data from power flow calculation and parse them to
-      // extract numerical values. Store these values in vectors and then
-      // add them to StatBlock objects
+      // Get results from power flow calculation for the buses and branches
+      // owned by this process and add them to StatBlock objects
 #ifdef USE_STATBLOCK
       timer->start(t_store);
-      vmag.clear();
-      vang.clear();
-      mask.clear();
+      pf_app.getBusVoltages(gidx,ids,vang,vmag,use_vmag,changed);
+      mag_vals.clear();
       mag_mask.clear();
-      v_vals.clear();
-      v_vals = pf_app.writeBusString("vr_str");
-      nsize = v_vals.size();
+      nsize = mag_sel.size();
       for (i=0; i<nsize; i++) {
-        std::vector<std::string> tokens = util.blankTokenizer(v_vals[i]);
-        int not_isolated = atoi(tokens[3].c_str());
-        if (not_isolated == 1) {
-          vmag.push_back(atof(tokens[2].c_str()));
-          if (atoi(tokens[4].c_str()) != 0) {
+        if (mag_sel[i] == 1) {
+          mag_vals.push_back(vmag[i]);
+          if (changed[i] != 0) {
             mag_mask.push_back(2);
           } else {
             mag_mask.push_back(1);
           }
         }
-        vang.push_back(atof(tokens[1].c_str()));
-        mask.push_back(1);
       }
+      vmag_stats.scatterColumnValues(task_id+1,mag_rows,mag_vals,mag_mask);
+      vang_stats.scatterColumnValues(task_id+1,ang_rows,vang,ang_mask);
 #endif
 #ifdef USE_STATBLOCK
-      if (task_comm.rank() == 0) {
-        vmag_stats.addColumnValues(task_id+1,vmag,mag_mask);
-        vang_stats.addColumnValues(task_id+1,vang,mask);
-      }
+      pf_app.getGeneratorPowers(gidx,ids,tags,pgen,qgen);
+      pgen_stats.scatterColumnValues(task_id+1,gen_rows,pgen,gen_mask);
+      qgen_stats.scatterColumnValues(task_id+1,gen_rows,qgen,gen_mask);
 #endif
 #ifdef USE_STATBLOCK
-      pgen.clear();
-      qgen.clear();
-      mask.clear();
-      v_vals.clear();
-      v_vals = pf_app.writeBusString("power");
-      nsize = v_vals.size();
+      pf_app.getBranchFlows(gidx,id1,id2,tags,pflow,qflow,perf,rating,viol);
+      nsize = viol.size();
+      mask.resize(nsize);
       for (i=0; i<nsize; i++) {
-        std::vector<std::string> tokens = util.blankTokenizer(v_vals[i]);
-        if (tokens.size()%4 != 0) {
-          printf("Incorrect generator listing\n");
-          continue;
-        }
-        int ngen = tokens.size()/4;
-        for (j=0; j<ngen; j++) {
-          pgen.push_back(atof(tokens[j*4+2].c_str()));
-          qgen.push_back(atof(tokens[j*4+3].c_str()));
-          mask.push_back(1);
+        if (viol[i] == 0) {
+          mask[i] = 1;
+        } else {
+          mask[i] = 2;
         }
       }
-#endif
-#ifdef USE_STATBLOCK
-      if (task_comm.rank() == 0) {
-        pgen_stats.addColumnValues(task_id+1,pgen,mask);
-        qgen_stats.addColumnValues(task_id+1,qgen,mask);
-      }
-#endif
-#ifdef USE_STATBLOCK
-      pflow.clear();
-      qflow.clear();
-      perf.clear();
-      mask.clear();
-      v_vals.clear();
-      v_vals = pf_app.writeBranchString("flow_str");
-      nsize = v_vals.size();
-      for (i=0; i<nsize; i++) {
-        std::vector<std::string> tokens = util.blankTokenizer(v_vals[i]);
-        if (tokens.size()%8 != 0) {
-          printf("Incorrect branch power flow listing\n");
-          continue;
-        }
-        int nline = tokens.size()/8;
-        for (j=0; j<nline; j++) {
-          pflow.push_back(atof(tokens[j*8+3].c_str()));
-          qflow.push_back(atof(tokens[j*8+4].c_str()));
-          perf.push_back(atof(tokens[j*8+5].c_str()));
-          if (atoi(tokens[j*8+7].c_str()) == 0) {
-            mask.push_back(1);
-          } else {
-            mask.push_back(2);
-          }
-        }
-      }
-#endif
-#ifdef USE_STATBLOCK
-      if (task_comm.rank() == 0) {
-        pflow_stats.addColumnValues(task_id+1,pflow,mask);
-        qflow_stats.addColumnValues(task_id+1,qflow,mask);
-        perf_stats.addColumnValues(task_id+1,perf,mask);
-      }
+      pflow_stats.scatterColumnValues(task_id+1,br_rows,pflow,mask);
+      qflow_stats.scatterColumnValues(task_id+1,br_rows,qflow,mask);
+      perf_stats.scatterColumnValues(task_id+1,br_rows,perf,mask);
       timer->stop(t_store);
 #endif
       if (check_Qlim) pf_app.clearQlimViolations();
@@ -650,86 +632,25 @@ void gridpack::contingency_analysis::CADriver::execute(int argc, char** argv)
       // network elements to indicate calculation failure
 #ifdef USE_STATBLOCK
       timer->start(t_store);
-      vmag.clear();
-      vang.clear();
-      mask.clear();
-      mag_mask.clear();
-      v_vals.clear();
-      v_vals = pf_app.writeBusString("vfail_str");
-      nsize = v_vals.size();
-      for (i=0; i<nsize; i++) {
-        std::vector<std::string> tokens = util.blankTokenizer(v_vals[i]);
-        int not_isolated = atoi(tokens[3].c_str());
-        if (not_isolated == 1) {
-          vmag.push_back(0.0);
-          mag_mask.push_back(0);
-        }
-        vang.push_back(0.0);
-        mask.push_back(0);
-      }
+      mag_vals.assign(mag_rows.size(),0.0);
+      mag_mask.assign(mag_rows.size(),0);
+      vmag_stats.scatterColumnValues(task_id+1,mag_rows,mag_vals,mag_mask);
+      vang.assign(ang_rows.size(),0.0);
+      mask.assign(ang_rows.size(),0);
+      vang_stats.scatterColumnValues(task_id+1,ang_rows,vang,mask);
 #endif
 #ifdef USE_STATBLOCK
-      if (task_comm.rank() == 0) {
-        vmag_stats.addColumnValues(task_id+1,vmag,mag_mask);
-        vang_stats.addColumnValues(task_id+1,vang,mask);
-      }
+      pgen.assign(gen_rows.size(),0.0);
+      mask.assign(gen_rows.size(),0);
+      pgen_stats.scatterColumnValues(task_id+1,gen_rows,pgen,mask);
+      qgen_stats.scatterColumnValues(task_id+1,gen_rows,pgen,mask);
 #endif
 #ifdef USE_STATBLOCK
-      pgen.clear();
-      qgen.clear();
-      mask.clear();
-      v_vals.clear();
-      v_vals = pf_app.writeBusString("pfail_str");
-      nsize = v_vals.size();
-      for (i=0; i<nsize; i++) {
-        std::vector<std::string> tokens = util.blankTokenizer(v_vals[i]);
-        if (tokens.size()%4 != 0) {
-          printf("Incorrect generator listing\n");
-          continue;
-        }
-        int ngen = tokens.size()/4;
-        for (j=0; j<ngen; j++) {
-          pgen.push_back(0.0);
-          qgen.push_back(0.0);
-          mask.push_back(0);
-        }
-      }
-#endif
-#ifdef USE_STATBLOCK
-      if (task_comm.rank() == 0) {
-        pgen_stats.addColumnValues(task_id+1,pgen,mask);
-        qgen_stats.addColumnValues(task_id+1,qgen,mask);
-      }
-#endif
-#ifdef USE_STATBLOCK
-      pflow.clear();
-      qflow.clear();
-      perf.clear();
-      mask.clear();
-      v_vals.clear();
-      v_vals = pf_app.writeBranchString("fail_str");
-      nsize = v_vals.size();
-      for (i=0; i<nsize; i++) {
-        std::vector<std::string> tokens = util.blankTokenizer(v_vals[i]);
-        if (tokens.size()%8 != 0) {
-          printf("Incorrect branch power flow listing\n");
-          continue;
-        }
-        int nline = tokens.size()/8;
-        for (j=0; j<nline; j++) {
-          pflow.push_back(0.0);
-          qflow.push_back(0.0);
-          perf.push_back(0.0);
-          mask.push_back(0);
-        }
-      }
-#endif
-#ifdef USE_STATBLOCK
-      if (task_comm.rank() == 0) {
-        pflow_stats.addColumnValues(task_id+1,pflow,mask);
-        qflow_stats.addColumnValues(task_id+1,qflow,mask);
-        perf_stats.addColumnValues(task_id+1,perf,mask);
-      }
+      pflow.assign(br_rows.size(),0.0);
+      mask.assign(br_rows.size(),0);
+      pflow_stats.scatterColumnValues(task_id+1,br_rows,pflow,mask);
+      qflow_stats.scatterColumnValues(task_id+1,br_rows,pflow,mask);
+      perf_stats.scatterColumnValues(task_id+1,br_rows,pflow,mask);
       timer->stop(t_store);
 #endif
     } 
@@ -740,7 +661,12 @@ void gridpack::contingency_analysis::CADriver::execute(int argc, char** argv)
   }
   // Print statistics from task manager describing the number of tasks performed
   // per processor
-  taskmgr.printStats();
+  if (use_costs) {
+    costmgr.printStats();
+    costmgr.saveTaskTimes(costfile);
+  } else {
+    taskmgr.printStats();
+  }
 
   // Gather stats on successful contingency calculations
 #ifdef USE_SUCCESS
@@ -810,5 +736,6 @@ void gridpack::contingency_analysis::CADriver::execute(int argc, char** argv)
   if (contingencies.size()*grp_size >= world.size()) {
     timer->dump();
   }
+  gridpack::utility::MemoryTracker::instance()->dump();
 }
 
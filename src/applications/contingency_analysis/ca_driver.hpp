@@ -75,6 +75,18 @@ class CADriver
     void execute(int argc, char** argv);
 
     private:
+
+    /**
+     * Assign StatBlock rows to entries for network components owned by this
+     * process
+     * @param comm communicator over which network is distributed
+     * @param nglobal total number of network components
+     * @param gidx global index of component for each local entry
+     * @param rows row index for each local entry
+     * @return total number of rows
+     */
+    int setRowIndices(const gridpack::parallel::Communicator &comm,
+        int nglobal, const std::vector<int> &gidx, std::vector<int> &rows);
 };
 
 } // contingency analysis 
@@ -16,6 +16,7 @@
 // -------------------------------------------------------------
 
 #include <algorithm>
+#include <math.h>
 #include "gridpack/include/gridpack.hpp"
 #include "gridpack/applications/modules/dynamic_simulation_full_y/dsf_app_module.hpp"
 #include "wind_driver.hpp"
@@ -29,9 +30,13 @@
  * @param nwatch number of generator variables being watched
  * @param nconf number of scenarios
  * @param nsteps number of timesteps being stored
+ * @param streaming if true, accumulate values in quantile sketches instead
+ *                  of storing all time series
+ * @param compression compression parameter for quantile sketches
  */
 gridpack::contingency_analysis::QuantileAnalysis::QuantileAnalysis(
-    gridpack::parallel::Communicator comm, int nwatch, int nconf, int nsteps)
+    gridpack::parallel::Communicator comm, int nwatch, int nconf, int nsteps,
+    bool streaming, double compression)
 {
   int dims[3];
   int three = 3;
@@ -39,6 +44,15 @@ gridpack::contingency_analysis::QuantileAnalysis::QuantileAnalysis(
   p_nwatch = nwatch;
   p_nconf = nconf;
   p_nsteps = nsteps;
+  p_streaming = streaming;
+  p_comm = comm;
+  p_GA = -1;
+  if (p_streaming) {
+    // Storage only depends on number of variables and steps
+    p_sketches.assign(nwatch*nsteps,
+        gridpack::analysis::QuantileSketch(compression));
+    return;
+  }
   dims[0] = nconf;
   dims[1] = nwatch;
   dims[2] = nsteps;
@@ -55,8 +69,6 @@ gridpack::contingency_analysis::QuantileAnalysis::QuantileAnalysis(
   GA_Allocate(p_GA);
   // Initialize all values to zero
   GA_Zero(p_GA);
-
-  p_comm = comm;
 }
 
 /**
@@ -64,7 +76,7 @@ gridpack::contingency_analysis::QuantileAnalysis::QuantileAnalysis(
  */
 gridpack::contingency_analysis::QuantileAnalysis::~QuantileAnalysis()
 {
-  GA_Destroy(p_GA);
+  if (p_GA >= 0) GA_Destroy(p_GA);
 }
 
 /**
@@ -72,10 +84,31 @@ gridpack::contingency_analysis::QuantileAnalysis::~QuantileAnalysis()
  * @param cfg_idx scenario index for time series
  * @param gen_idx generator index for time series
  * @param vals vector of time series values for a generator
+ * @param settled true if a series that is shorter than the number of steps
+ *                was stopped because the system had settled. The series is
+ *                then padded with its last value. Otherwise the missing
+ *                steps are excluded from the quantiles
  */
 void gridpack::contingency_analysis::QuantileAnalysis::saveData(int cfg_idx,
-    int gen_idx, std::vector<double> &vals)
+    int gen_idx, std::vector<double> &vals, bool settled)
 {
+  if (vals.size() == 0) return;
+  if (vals.size() < p_nsteps) {
+    if (settled) {
+      vals.resize(p_nsteps,vals.back());
+    } else {
+      // Mark steps after an insecure run was stopped as missing
+      vals.resize(p_nsteps,NAN);
+    }
+  }
+  if (p_streaming) {
+    int i;
+    gridpack::analysis::QuantileSketch *sketch = &p_sketches[gen_idx*p_nsteps];
+    for (i=0; i<p_nsteps; i++) {
+      if (!isnan(vals[i])) sketch[i].add(vals[i]);
+    }
+    return;
+  }
   int lo[3], hi[3], ld[2];
   lo[0] = cfg_idx;
   lo[1] = gen_idx;
@@ -85,10 +118,7 @@ void gridpack::contingency_analysis::QuantileAnalysis::saveData(int cfg_idx,
   hi[2] = p_nsteps-1;
   ld[0] = 1;
   ld[1] = p_nsteps;
-  if (vals.size() > 0) {
-    NGA_Put(p_GA,lo,hi,&(vals[0]),ld);
-  }
-
+  NGA_Put(p_GA,lo,hi,&(vals[0]),ld);
 }
 
 /**
@@ -109,6 +139,7 @@ void gridpack::contingency_analysis::QuantileAnalysis::saveVarNames(
  */
 void gridpack::contingency_analysis::QuantileAnalysis::writeData()
 {
+  if (p_streaming) return;
   GA_Sync();
 }
 
@@ -129,6 +160,10 @@ void gridpack::contingency_analysis::QuantileAnalysis::exportQuantiles(
       //TODO: out of range error
     }
   }
+  if (p_streaming) {
+    exportSketchQuantiles(quantiles, dt);
+    return;
+  }
   // Create global array of size n_vals*p_nwatch*p_nsteps to hold nvals
   // quantile values for all watched generators over all timesteps
   int g_quant = GA_Create_handle();
@@ -140,38 +175,8 @@ void gridpack::contingency_analysis::QuantileAnalysis::exportQuantiles(
   GA_Allocate(g_quant);
   // Sort quantile values so that they run from lowest to highest
   std::sort(quantiles.begin(),quantiles.end());
-  std::vector<int> partition(nvals);
-  std::vector<double> weight(nvals);
 
-  // find indices that bracket quantiles
-  for (i=0; i<nvals; i++) {
-    partition[i] = static_cast<int>(quantiles[i]
-        * static_cast<double>(p_nconf-1));
-  }
-  if (quantiles[0] == 0.0) partition[0] = 0;
-  if (quantiles[nvals-1] == 1.0) partition[nvals-1] = p_nconf-1;
-  // calculate weights for each partition
-  for (i=0; i<nvals; i++) {
-    if (i == 0 && quantiles[0] == 0.0) {
-      weight[0] = 1.0;
-    } else if (i == nvals-1 && quantiles[i] == 1.0) {
-      weight[nvals-1] = 1.0;
-    } else {
-      if (p_nconf > 1) {
-        double lo = static_cast<double>(partition[i])
-          / static_cast<double>(p_nconf-1);
-        double hi = static_cast<double>(partition[i]+1)
-          / static_cast<double>(p_nconf-1);
-        weight[i] = 1.0 - (quantiles[i]-lo)/(hi-lo);
-      } else {
-        weight[i] = 1.0;
-      }
-    }
-  }
   int lo[3], hi[3], ld[2];
-  printf("Quantiles: [%d,%f] [%d,%f] [%d,%f] [%d,%f] [%d,%f]\n",
-      partition[0],weight[0],partition[1],weight[1],partition[2],weight[2],
-      partition[3],weight[3],partition[4],weight[4]);
   // nconf, nwatch, nsteps
   std::vector<double> time_slice(p_nconf*p_nwatch);
   lo[0] = 0;
@@ -200,27 +205,19 @@ void gridpack::contingency_analysis::QuantileAnalysis::exportQuantiles(
     NGA_Get(p_GA,lo,hi,&time_slice[0],ld);
     // loop over watched variables
     for (i=0; i<p_nwatch; i++) {
-      // get all configuration values for each variable
-      std::vector<double> conf(p_nconf);
+      // get all configuration values for each variable. Values that are
+      // missing because an insecure run was stopped early are skipped
+      std::vector<double> conf;
+      conf.reserve(p_nconf);
       for (j=0; j<p_nconf; j++) {
-        conf[j] = time_slice[j*p_nwatch+i];
+        double val = time_slice[j*p_nwatch+i];
+        if (!isnan(val)) conf.push_back(val);
       }
       // Sort values from lowest to highest
       std::sort(conf.begin(),conf.end());
       // Find quantile values 
       for (k=0; k<nvals; k++) {
-        int kdx = partition[k];
-        if (k == 0 && quantiles[k] == 0.0) {
-          qvalues[0] = conf[kdx];
-        } else if (k == nvals-1 && quantiles[k] == 1.0) {
-          qvalues[k] = conf[kdx];
-        } else {
-          if (partition[k] < p_nconf-1) {
-            qvalues[k] = weight[k]*conf[kdx]+(1.0-weight[k])*conf[kdx+1];
-          } else {
-            //TODO: report error
-          }
-        }
+        qvalues[k] = sortedQuantile(conf,quantiles[k]);
       }
       // copy quantile values into results buffer
       for (k=0; k<nvals; k++) {
@@ -261,6 +258,63 @@ void gridpack::contingency_analysis::QuantileAnalysis::exportQuantiles(
   }
 }
 
+/**
+ * Evaluate a quantile from a sorted list of values by linear interpolation
+ * between the two values that bracket it
+ * @param conf values sorted from lowest to highest
+ * @param quantile quantile to be evaluated (between 0 and 1)
+ * @return quantile value. If the list is empty, this returns 0
+ */
+double gridpack::contingency_analysis::QuantileAnalysis::sortedQuantile(
+    const std::vector<double> &conf, double quantile)
+{
+  int nconf = conf.size();
+  if (nconf == 0) return 0.0;
+  if (quantile <= 0.0) return conf[0];
+  if (quantile >= 1.0 || nconf == 1) return conf[nconf-1];
+  int kdx = static_cast<int>(quantile*static_cast<double>(nconf-1));
+  if (kdx >= nconf-1) return conf[nconf-1];
+  double lo = static_cast<double>(kdx)/static_cast<double>(nconf-1);
+  double hi = static_cast<double>(kdx+1)/static_cast<double>(nconf-1);
+  double weight = 1.0 - (quantile-lo)/(hi-lo);
+  return weight*conf[kdx]+(1.0-weight)*conf[kdx+1];
+}
+
+/**
+ * Calculate quantiles from quantile sketches and write them to a file.
+ * Sketches from all processors are combined on process 0 before the
+ * quantiles are evaluated
+ * @param quantiles values describing quantiles to be calculated
+ * @param dt magnitude time step (in seconds)
+ */
+void gridpack::contingency_analysis::QuantileAnalysis::exportSketchQuantiles(
+    std::vector<double> quantiles, double dt)
+{
+  int i, j, k;
+  int nvals = quantiles.size();
+  std::sort(quantiles.begin(),quantiles.end());
+  gridpack::analysis::reduceStats(p_comm, p_sketches);
+  if (p_comm.rank() == 0) {
+    // Write out each variable to a separate file
+    for (i=0; i<p_nwatch; i++) {
+      FILE *fd = fopen(p_var_names[i].c_str(),"w");
+      for (j=0; j<p_nsteps; j++) {
+        gridpack::analysis::QuantileSketch &sketch = p_sketches[i*p_nsteps+j];
+        fprintf(fd,"%16.4f",j*dt);
+        for (k=0; k<nvals; k++) {
+          fprintf(fd," %16.8f",sketch.quantile(quantiles[k]));
+        }
+        fprintf(fd,"\n");
+      }
+      fclose(fd);
+    }
+  }
+  // Release memory held by sketches
+  for (i=0; i<p_sketches.size(); i++) {
+    p_sketches[i].clear();
+  }
+}
+
 /**
  * Basic constructor
  */
@@ -621,7 +675,12 @@ void gridpack::contingency_analysis::WindDriver::execute(int argc, char** argv)
 
   bool      pf_converged;
   gridpack::powerflow::PFAppModule pf_app;
-  pf_app.readNetwork(pf_network, config);
+  // parse network file once and create network on each sub-communicator
+  // from the copy in shared memory
+  gridpack::parser::SharedCase<gridpack::powerflow::PFNetwork>
+    base_case(world);
+  pf_app.readSharedCase(base_case, config);
+  pf_app.readNetwork(pf_network, base_case, config);
   pf_app.initialize();
   /* TODO: Is this needed? */
 #if 1
@@ -694,6 +753,11 @@ void gridpack::contingency_analysis::WindDriver::execute(int argc, char** argv)
   for (i=0; i<tokens.size(); i++) {
     quantiles.push_back(atof(tokens[i].c_str()));
   }
+  // Quantiles can be accumulated in sketches instead of storing all time
+  // series. This is approximate but memory use does not depend on the
+  // number of scenarios
+  bool streaming = cursor->get("streamingQuantiles",false);
+  double compression = cursor->get("quantileCompression",100.0);
 
 
   // Find number of generators being watched
@@ -792,7 +856,7 @@ void gridpack::contingency_analysis::WindDriver::execute(int argc, char** argv)
   int t_quantile = timer->createCategory("Quantile Analysis");
   timer->start(t_quantile);
   gridpack::contingency_analysis::QuantileAnalysis analysis(world,
-      4*bus_ids.size(),ntasks*numConfigs,nsteps-1);
+      4*bus_ids.size(),ntasks*numConfigs,nsteps-1,streaming,compression);
   timer->stop(t_quantile);
   // Construct variable names
   std::vector<std::string> var_names;
@@ -887,10 +951,20 @@ void gridpack::contingency_analysis::WindDriver::execute(int argc, char** argv)
     std::vector<std::vector<double> > all_series;
     all_series = ds_app.getGeneratorTimeSeries();
     std::vector<int> gen_idx = ds_app.getTimeSeriesMap();
+    // Only a run that was stopped because it had settled can be extended
+    // with its final values. Runs that were stopped as insecure are
+    // reported here and left out of the quantiles after they were stopped
+    bool settled = !ds_app.terminatedEarly() || ds_app.isSecure() == -1;
+    if (!settled && task_comm.rank() == 0) {
+      printf("p[%d] Task %d scenario: %d contingency: %d insecure,"
+          " simulation stopped at time %f\n",world.rank(),task_id,ncnfg,
+          nfault,ds_app.terminationTime());
+    }
     int iseries;
     timer->start(t_quantile);
     for (iseries=0; iseries<gen_idx.size(); iseries++) {
-      analysis.saveData(task_id, gen_idx[iseries],all_series[iseries]);
+      analysis.saveData(task_id, gen_idx[iseries],all_series[iseries],
+          settled);
     }
     timer->stop(t_quantile);
     ds_app.close();
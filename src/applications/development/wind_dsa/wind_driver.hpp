@@ -34,8 +34,14 @@ class QuantileAnalysis
    * @param nwatch number of generators being watched
    * @param nconf number of scenarios
    * @param nsteps number of timesteps being stored
+   * @param streaming if true, accumulate values in quantile sketches instead
+   *                  of storing all time series. Memory use is then
+   *                  independent of the number of scenarios but quantiles
+   *                  are approximate
+   * @param compression compression parameter for quantile sketches
    */
-  QuantileAnalysis(gridpack::parallel::Communicator comm, int nwatch, int nconf, int nsteps);
+  QuantileAnalysis(gridpack::parallel::Communicator comm, int nwatch, int nconf,
+      int nsteps, bool streaming = false, double compression = 100.0);
 
   /**
    * Basic destructor
@@ -47,8 +53,13 @@ class QuantileAnalysis
    * @param cfg_idx scenario index for time series
    * @param gen_idx generator index for time series
    * @param vals vector of time series values for a generator
+   * @param settled true if a series that is shorter than the number of steps
+   *                was stopped because the system had settled. The series is
+   *                then padded with its last value. Otherwise the missing
+   *                steps are excluded from the quantiles
    */
-  void saveData(int cfg_idx, int gen_idx, std::vector<double> &vals);
+  void saveData(int cfg_idx, int gen_idx, std::vector<double> &vals,
+      bool settled = true);
 
   /**
    * Save variable names
@@ -71,12 +82,31 @@ class QuantileAnalysis
 
   private:
 
+  /**
+   * Evaluate a quantile from a sorted list of values
+   * @param conf values sorted from lowest to highest
+   * @param quantile quantile to be evaluated (between 0 and 1)
+   * @return quantile value. If the list is empty, this returns 0
+   */
+  double sortedQuantile(const std::vector<double> &conf, double quantile);
+
+  /**
+   * Calculate quantiles from quantile sketches and write them to a file
+   * @param quantiles values describing quantiles to be calculated
+   * @param dt magnitude time step (in seconds)
+   */
+  void exportSketchQuantiles(std::vector<double> quantiles, double dt);
+
     gridpack::parallel::Communicator p_comm;
     int p_nwatch;
     std::vector<std::string> p_var_names;
     int p_nconf;
     int p_nsteps;
     int p_GA;
+    bool p_streaming;
+    // Quantile sketches for each watched variable and step, stored as
+    // [watch*p_nsteps+step]. Only used in streaming mode
+    std::vector<gridpack::analysis::QuantileSketch> p_sketches;
 };
 
 typedef gridpack::dynamic_simulation::DSFullNetwork DSFullNetwork;
@@ -163,6 +163,11 @@ void gridpack::contingency_analysis::WindDriver::execute2(int argc, char** argv)
   for (i=0; i<tokens.size(); i++) {
     quantiles.push_back(atof(tokens[i].c_str()));
   }
+  // Quantiles can be accumulated in sketches instead of storing all time
+  // series. This is approximate but memory use does not depend on the
+  // number of scenarios
+  bool streaming = cursor->get("streamingQuantiles",false);
+  double compression = cursor->get("quantileCompression",100.0);
 
     /* Get list of generator watch */
   std::string watchlistfile;
@@ -284,7 +289,7 @@ void gridpack::contingency_analysis::WindDriver::execute2(int argc, char** argv)
 
   // Create distributed storage object
   gridpack::contingency_analysis::QuantileAnalysis analysis(world,
-      4*bus_ids.size(),ntasks*numConfigs,nsteps-1);
+      4*bus_ids.size(),ntasks*numConfigs,nsteps-1,streaming,compression);
   // Construct variable names
   std::vector<std::string> var_names;
   char sbuf[128];
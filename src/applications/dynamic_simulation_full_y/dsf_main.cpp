@@ -55,6 +55,13 @@ main(int argc, char **argv)
     }
     timer->stop(t_config);
 
+    // record timer events for chrome://tracing or Perfetto if a trace file
+    // has been specified
+    std::string traceFile;
+    if (config->get("Configuration.Dynamic_simulation.traceFile",&traceFile)) {
+      timer->configTrace(true);
+    }
+
     // setup and run powerflow calculation
     gridpack::utility::Configuration::CursorPtr cursor;
     cursor = config->getCursor("Configuration.Powerflow");
@@ -114,6 +121,7 @@ main(int argc, char **argv)
     //ds_app.write();
     timer->stop(t_total);
     timer->dump();
+    if (traceFile.size() > 0) timer->dumpTrace(traceFile);
   }
 
 }
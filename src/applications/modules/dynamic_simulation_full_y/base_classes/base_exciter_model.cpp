@@ -230,3 +230,39 @@ bool gridpack::dynamic_simulation::BaseExciterModel::getState( std::string name,
 {
   return false;
 }
+
+/**
+ * Return the number of state variables in the exciter that are used for
+ * small signal analysis
+ * @return number of states or -1 if the model does not provide access to
+ *         its states
+ */
+int gridpack::dynamic_simulation::BaseExciterModel::numStates()
+{
+  return -1;
+}
+
+/**
+ * Copy current values of state variables
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::BaseExciterModel::getStates(double *x)
+{
+}
+
+/**
+ * Overwrite current values of state variables. Predicted values are reset
+ * to the same values
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::BaseExciterModel::setStates(const double *x)
+{
+}
+
+/**
+ * Copy values of state variables computed by the last call to predictor
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::BaseExciterModel::getPredictedStates(double *x)
+{
+}
@@ -164,6 +164,34 @@ class BaseExciterModel
     */
    virtual bool getState(std::string name, double *value);
 
+   /**
+    * Return the number of state variables in the exciter that are used
+    * for small signal analysis
+    * @return number of states or -1 if the model does not provide access
+    *         to its states
+    */
+   virtual int numStates();
+
+   /**
+    * Copy current values of state variables
+    * @param x array of length numStates()
+    */
+   virtual void getStates(double *x);
+
+   /**
+    * Overwrite current values of state variables. Predicted values are
+    * reset to the same values
+    * @param x array of length numStates()
+    */
+   virtual void setStates(const double *x);
+
+   /**
+    * Copy values of state variables computed by the last call to
+    * predictor
+    * @param x array of length numStates()
+    */
+   virtual void getPredictedStates(double *x);
+
   private:
     
     //double Vterminal, w;
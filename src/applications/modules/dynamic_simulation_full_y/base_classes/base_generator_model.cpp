@@ -349,3 +349,39 @@ bool gridpack::dynamic_simulation::BaseGeneratorModel::getState(
 {
   return false;
 }
+
+/**
+ * Return the number of state variables in the generator that are used for
+ * small signal analysis
+ * @return number of states or -1 if the model does not provide access to
+ *         its states
+ */
+int gridpack::dynamic_simulation::BaseGeneratorModel::numStates()
+{
+  return -1;
+}
+
+/**
+ * Copy current values of state variables
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::BaseGeneratorModel::getStates(double *x)
+{
+}
+
+/**
+ * Overwrite current values of state variables. Predicted values are reset
+ * to the same values
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::BaseGeneratorModel::setStates(const double *x)
+{
+}
+
+/**
+ * Copy values of state variables computed by the last call to predictor
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::BaseGeneratorModel::getPredictedStates(double *x)
+{
+}
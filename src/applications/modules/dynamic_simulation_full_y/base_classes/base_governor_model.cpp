@@ -157,3 +157,39 @@ bool gridpack::dynamic_simulation::BaseGovernorModel::getState(
 {
   return false;
 }
+
+/**
+ * Return the number of state variables in the governor that are used for
+ * small signal analysis
+ * @return number of states or -1 if the model does not provide access to
+ *         its states
+ */
+int gridpack::dynamic_simulation::BaseGovernorModel::numStates()
+{
+  return -1;
+}
+
+/**
+ * Copy current values of state variables
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::BaseGovernorModel::getStates(double *x)
+{
+}
+
+/**
+ * Overwrite current values of state variables. Predicted values are reset
+ * to the same values
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::BaseGovernorModel::setStates(const double *x)
+{
+}
+
+/**
+ * Copy values of state variables computed by the last call to predictor
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::BaseGovernorModel::getPredictedStates(double *x)
+{
+}
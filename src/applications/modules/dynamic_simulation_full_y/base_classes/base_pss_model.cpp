@@ -100,3 +100,39 @@ double gridpack::dynamic_simulation::BasePssModel::getBusFreq(int busnum)
 void gridpack::dynamic_simulation::BasePssModel::setWideAreaFreqforPSS(double freq)
 {
 }	
+
+/**
+ * Return the number of state variables in the stabilizer that are used for
+ * small signal analysis
+ * @return number of states or -1 if the model does not provide access to
+ *         its states
+ */
+int gridpack::dynamic_simulation::BasePssModel::numStates()
+{
+  return -1;
+}
+
+/**
+ * Copy current values of state variables
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::BasePssModel::getStates(double *x)
+{
+}
+
+/**
+ * Overwrite current values of state variables. Predicted values are reset
+ * to the same values
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::BasePssModel::setStates(const double *x)
+{
+}
+
+/**
+ * Copy values of state variables computed by the last call to predictor
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::BasePssModel::getPredictedStates(double *x)
+{
+}
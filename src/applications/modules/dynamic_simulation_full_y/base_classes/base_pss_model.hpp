@@ -72,6 +72,34 @@ class BasePssModel
 	virtual double getBusFreq(int busnum);
 	virtual void setWideAreaFreqforPSS(double freq);	
 
+    /**
+     * Return the number of state variables in the stabilizer that are used
+     * for small signal analysis
+     * @return number of states or -1 if the model does not provide access
+     *         to its states
+     */
+    virtual int numStates();
+
+    /**
+     * Copy current values of state variables
+     * @param x array of length numStates()
+     */
+    virtual void getStates(double *x);
+
+    /**
+     * Overwrite current values of state variables. Predicted values are
+     * reset to the same values
+     * @param x array of length numStates()
+     */
+    virtual void setStates(const double *x);
+
+    /**
+     * Copy values of state variables computed by the last call to
+     * predictor
+     * @param x array of length numStates()
+     */
+    virtual void getPredictedStates(double *x);
+
 
   private:
     
@@ -188,6 +188,12 @@ double Cblock::getstate(IntegrationStage stage)
   return xout;
 }
 
+void Cblock::setstate(double xin)
+{
+  x[0] = xin;
+  p_xhat[0] = xin;
+}
+
 // ------------------------------------
 // PI Controller
 // ------------------------------------
@@ -318,6 +318,17 @@ class Cblock
   **/
   double getstate(IntegrationStage stage);
 
+  /**
+     SETSTATE - Overwrites the internal state variable x for the control block
+
+     Input:
+       xin            New value of state variable
+
+     Note:
+       The predictor stage value is set to the same value
+  **/
+  void setstate(double xin);
+
   ~Cblock(void);
 };
 
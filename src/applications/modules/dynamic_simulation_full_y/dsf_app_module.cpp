@@ -21,6 +21,9 @@
 #include <iostream>
 #include <string>
 #include <vector>
+#include <algorithm>
+#include <float.h>
+#include <math.h>
 #include "gridpack/utilities/string_utils.hpp"
 
 using namespace std;
@@ -45,8 +48,19 @@ gridpack::dynamic_simulation::DSFullApp::DSFullApp(void)
   p_loadWatch = false;
   p_generators_read_in = false;
   p_save_time_series = false;
+  p_ts_decimation = 1;
+  p_ts_chunk = 1000;
   p_monitorGenerators = false;
   p_bDynSimuDone = false;
+  p_earlyTermination = false;
+  p_etFrequencyBand = 0.05;
+  p_etSettleTime = 2.0;
+  p_etAngleLimit = 180.0;
+  p_etMinVoltage = 0.0;
+  p_etFaultEnd = 0.0;
+  p_etSettleStart = -1.0;
+  p_etPendingTime = -1.0;
+  p_terminatedAt = -1.0;
   p_suppress_watch_files = false;
   Simu_Current_Step = 0;
 
@@ -77,8 +91,19 @@ gridpack::dynamic_simulation::DSFullApp::DSFullApp(gridpack::parallel::Communica
   p_loadWatch = false;
   p_generators_read_in = false;
   p_save_time_series = false;
+  p_ts_decimation = 1;
+  p_ts_chunk = 1000;
   p_monitorGenerators = false;
   p_bDynSimuDone = false;
+  p_earlyTermination = false;
+  p_etFrequencyBand = 0.05;
+  p_etSettleTime = 2.0;
+  p_etAngleLimit = 180.0;
+  p_etMinVoltage = 0.0;
+  p_etFaultEnd = 0.0;
+  p_etSettleStart = -1.0;
+  p_etPendingTime = -1.0;
+  p_terminatedAt = -1.0;
   p_suppress_watch_files = false;
   Simu_Current_Step = 0;
   
@@ -217,6 +242,18 @@ void gridpack::dynamic_simulation::DSFullApp::readNetwork(
   p_report_dummy_obs = cursor->get("reportNonExistingElements",false);
   p_maximumFrequency = cursor->get("frequencyMaximum",61.8);
 
+  // Terminate simulation as soon as outcome is known
+  p_earlyTermination = cursor->get("earlyTermination",false);
+  p_etFrequencyBand = cursor->get("earlyTerminationFrequencyBand",0.05);
+  p_etSettleTime = cursor->get("earlyTerminationSettleTime",2.0);
+  p_etAngleLimit = cursor->get("earlyTerminationAngleLimit",180.0);
+  p_etMinVoltage = cursor->get("earlyTerminationMinimumVoltage",0.0);
+
+  // Options for recording time series of watched generators
+  p_ts_decimation = cursor->get("timeSeriesDecimation",1);
+  p_ts_filename = cursor->get("timeSeriesFile","");
+  p_ts_chunk = cursor->get("timeSeriesChunkSize",1000);
+
   // load input file
   if (filetype == PTI23) {
     gridpack::parser::PTI23_parser<DSFullNetwork> parser(network);
@@ -291,6 +328,19 @@ void gridpack::dynamic_simulation::DSFullApp::setNetwork(
   p_monitorGenerators = cursor->get("monitorGenerators",false);
   p_report_dummy_obs = cursor->get("reportNonExistingElements",false);
   p_maximumFrequency = cursor->get("frequencyMaximum",61.8);
+
+  // Terminate simulation as soon as outcome is known
+  p_earlyTermination = cursor->get("earlyTermination",false);
+  p_etFrequencyBand = cursor->get("earlyTerminationFrequencyBand",0.05);
+  p_etSettleTime = cursor->get("earlyTerminationSettleTime",2.0);
+  p_etAngleLimit = cursor->get("earlyTerminationAngleLimit",180.0);
+  p_etMinVoltage = cursor->get("earlyTerminationMinimumVoltage",0.0);
+
+  // Options for recording time series of watched generators
+  p_ts_decimation = cursor->get("timeSeriesDecimation",1);
+  p_ts_filename = cursor->get("timeSeriesFile","");
+  p_ts_chunk = cursor->get("timeSeriesChunkSize",1000);
+
   p_analytics.reset(new gridpack::analysis::NetworkAnalytics<DSFullNetwork>(network));
 
   // Create serial IO object to export data from buses or branches
@@ -593,6 +643,11 @@ void gridpack::dynamic_simulation::DSFullApp::solve(
   last_S_Steps = -1;
 
   p_insecureAt = -1;
+  p_etFaultEnd = fault.end;
+  p_etSettleStart = -1.0;
+  p_terminatedAt = -1.0;
+  if (p_etBatch) p_etBatch->wait();
+  p_etPendingTime = -1.0;
 
   p_factory->setMode(make_INorton_full);
   //gridpack::mapper::BusVectorMap<DSFullNetwork> nbusMap(p_network);
@@ -1006,6 +1061,10 @@ void gridpack::dynamic_simulation::DSFullApp::solve(
 
         }
     }
+
+    // a relay trip may have split the network or removed the last
+    // generator in an island
+    if (flagBus || flagBranch) checkIslands();
 	
     //renke add, update old busvoltage first
     p_factory->updateoldbusvoltage(); //renke add
@@ -1210,7 +1269,7 @@ void gridpack::dynamic_simulation::DSFullApp::solve(
       if (p_loadWatch) p_loadIO->dumpChannel();
 #endif
     }
-    saveTimeStep();
+    saveTimeStep(static_cast<double>(Simu_Current_Step)*p_time_step);
     //    if ((!p_factory->securityCheck()) && p_insecureAt == -1)  
     //       p_insecureAt = Simu_Current_Step;
 
@@ -1261,6 +1320,12 @@ void gridpack::dynamic_simulation::DSFullApp::solve(
       p_frequencyOK = p_frequencyOK && checkFrequency(0.5,presentTime);
       if (!p_frequencyOK) Simu_Current_Step = simu_total_steps;
     }
+    if (p_earlyTermination && Simu_Current_Step < simu_total_steps) {
+      double presentTime = static_cast<double>(Simu_Current_Step)*p_time_step;
+      if (checkEarlyTermination(presentTime)) {
+        Simu_Current_Step = simu_total_steps;
+      }
+    }
   }
   
 #if 0
@@ -1309,6 +1374,12 @@ void gridpack::dynamic_simulation::DSFullApp::solve(
     }
   }
   p_busIO->header(secureBuf);
+  if (p_save_time_series) p_recorder.flush();
+  if (p_terminatedAt >= 0.0) {
+    sprintf(secureBuf,"\nSimulation terminated early at time %f\n",
+        p_terminatedAt);
+    p_busIO->header(secureBuf);
+  }
 
 #ifdef MAP_PROFILE
   timer->configTimer(true);
@@ -1474,14 +1545,30 @@ void gridpack::dynamic_simulation::DSFullApp::setGeneratorWatch(
     p_monitorGenerators = true;
   }
   if (p_save_time_series) {
-    p_time_series.clear();
+    p_recorder.clear();
+    p_recorder_idx.clear();
     for (i=0; i<p_gen_buses.size(); i++) {
-      std::vector<double> vec0;
-      p_time_series.push_back(vec0);
-      p_time_series.push_back(vec0);
-      p_time_series.push_back(vec0);
-      p_time_series.push_back(vec0);
+      gridpack::dynamic_simulation::BaseGeneratorModel *gen
+        = p_network->getBus(p_gen_buses[i])->getGenerator(p_gen_ids[i]);
+      if (gen) {
+        std::pair<int,std::string> item(
+            p_network->getBus(p_gen_buses[i])->getOriginalIndex(),
+            p_gen_ids[i]);
+        p_recorder.addGenerator(gen);
+        p_recorder_idx.push_back(p_watch_list[item]);
+      }
+    }
+    int nsteps = 1;
+    if (p_time_step > 0.0) {
+      nsteps = static_cast<int>(p_sim_time/p_time_step) + 2;
     }
+    std::string filename = p_ts_filename;
+    if (filename.size() > 0 && p_comm.size() > 1) {
+      char sbuf[32];
+      sprintf(sbuf,".%d",p_comm.rank());
+      filename.append(sbuf);
+    }
+    p_recorder.setup(nsteps,p_ts_decimation,filename,p_ts_chunk);
   }
 }
 
@@ -1555,6 +1642,139 @@ bool gridpack::dynamic_simulation::DSFullApp::frequencyOK()
   return p_frequencyOK;
 }
 
+/**
+ * Set parameters for terminating a simulation as soon as its outcome is
+ * known
+ * @param flag true if early termination is turned on
+ * @param band maximum frequency deviation (Hz) for a settled system
+ * @param settle time (seconds) that system must remain settled
+ * @param angle maximum separation (degrees) of rotor angles
+ * @param vmin minimum bus voltage (p.u.) for a settled system
+ */
+void gridpack::dynamic_simulation::DSFullApp::setEarlyTermination(bool flag,
+    double band, double settle, double angle, double vmin)
+{
+  p_earlyTermination = flag;
+  p_etFrequencyBand = band;
+  p_etSettleTime = settle;
+  p_etAngleLimit = angle;
+  p_etMinVoltage = vmin;
+}
+
+/**
+ * @return true if last simulation was terminated before the end time
+ */
+bool gridpack::dynamic_simulation::DSFullApp::terminatedEarly()
+{
+  return (p_terminatedAt >= 0.0);
+}
+
+/**
+ * @return time at which last simulation was terminated. If simulation
+ * ran to completion, this returns -1
+ */
+double gridpack::dynamic_simulation::DSFullApp::terminationTime()
+{
+  return p_terminatedAt;
+}
+
+/**
+ * Check to see if outcome of simulation is certain so that simulation
+ * can be stopped. Nothing is checked until the fault has been cleared. The
+ * system is insecure if the spread in rotor angles of the watched generators
+ * exceeds the angle limit and is secure if the frequency deviations of the
+ * watched generators and the bus voltages have remained within bounds for
+ * the settling time. The reduction of the monitored quantities is started
+ * at this step and completed at the next step so that it overlaps with the
+ * integration of the next time step, which means the outcome is detected
+ * one step after the quantities were sampled. This is a collective
+ * operation on the network communicator.
+ * @param time current value of time
+ * @return true if simulation can be terminated
+ */
+bool gridpack::dynamic_simulation::DSFullApp::checkEarlyTermination(double time)
+{
+  if (!p_earlyTermination || time <= p_etFaultEnd) return false;
+  if (!p_etBatch) {
+    p_etBatch.reset(new gridpack::parallel::ReductionBatch(
+          p_network->communicator()));
+    p_etIdx[0] = p_etBatch->addMax(0.0);
+    p_etIdx[1] = p_etBatch->addMin(DBL_MAX);
+    p_etIdx[2] = p_etBatch->addMax(-DBL_MAX);
+    p_etIdx[3] = p_etBatch->addMin(DBL_MAX);
+    p_etIdx[4] = p_etBatch->addAny(false);
+  }
+  // Evaluate quantities from the previous step
+  bool ret = false;
+  if (p_etPendingTime >= 0.0) {
+    p_etBatch->wait();
+    ret = evaluateEarlyTermination(p_etPendingTime);
+    p_etPendingTime = -1.0;
+  }
+  if (ret) return true;
+  int nbus = p_network->numBuses();
+  int i;
+  double fmax = 0.0;
+  double amin = DBL_MAX;
+  double amax = -DBL_MAX;
+  double vmin = DBL_MAX;
+  bool watched = false;
+  for (i=0; i<nbus; i++) {
+    if (p_network->getActiveBus(i)) {
+      DSFullBus *bus = p_network->getBus(i).get();
+      double fdev, bmin, bmax;
+      if (bus->getWatchedExtrema(&fdev,&bmin,&bmax)) {
+        if (fdev > fmax) fmax = fdev;
+        if (bmin < amin) amin = bmin;
+        if (bmax > amax) amax = bmax;
+        watched = true;
+      }
+      double vmag = abs(bus->getComplexVoltage());
+      if (vmag < vmin) vmin = vmag;
+    }
+  }
+  p_etBatch->set(p_etIdx[0],fmax);
+  p_etBatch->set(p_etIdx[1],amin);
+  p_etBatch->set(p_etIdx[2],amax);
+  p_etBatch->set(p_etIdx[3],vmin);
+  p_etBatch->set(p_etIdx[4],watched ? 1.0 : 0.0);
+  p_etBatch->start();
+  p_etPendingTime = time;
+  return false;
+}
+
+/**
+ * Evaluate the reduced quantities used to check for early termination
+ * @param time time at which quantities were sampled
+ * @return true if simulation can be terminated
+ */
+bool gridpack::dynamic_simulation::DSFullApp::evaluateEarlyTermination(
+    double time)
+{
+  // Outcome cannot be determined without watched generators
+  if (!p_etBatch->flag(p_etIdx[4])) return false;
+  double fmax = p_etBatch->value(p_etIdx[0]);
+  double amin = p_etBatch->value(p_etIdx[1]);
+  double amax = p_etBatch->value(p_etIdx[2]);
+  double vmin = p_etBatch->value(p_etIdx[3]);
+  double spread = (amax-amin)*180.0/M_PI;
+  if (spread > p_etAngleLimit) {
+    if (p_insecureAt == -1) p_insecureAt = Simu_Current_Step;
+    p_terminatedAt = time;
+    return true;
+  }
+  if (fmax <= p_etFrequencyBand && vmin >= p_etMinVoltage) {
+    if (p_etSettleStart < 0.0) p_etSettleStart = time;
+    if (time - p_etSettleStart >= p_etSettleTime) {
+      p_terminatedAt = time;
+      return true;
+    }
+  } else {
+    p_etSettleStart = -1.0;
+  }
+  return false;
+}
+
 /**
  * Scale generator real power. If zone less than 1 then scale all
  * generators in the area.
@@ -1670,27 +1890,30 @@ void gridpack::dynamic_simulation::DSFullApp::saveTimeSeries(bool flag)
   p_save_time_series = flag;
 }
 
+/**
+ * Set options for recording time series data
+ * @param decimation record values every decimation time steps
+ * @param filename name of binary file that recorded values are written
+ *        to. If empty, values are kept in memory
+ * @param chunk number of steps held in memory before they are written
+ *        to the binary file
+ */
+void gridpack::dynamic_simulation::DSFullApp::setTimeSeriesOptions(
+    int decimation, std::string filename, int chunk)
+{
+  p_ts_decimation = decimation;
+  p_ts_filename = filename;
+  p_ts_chunk = chunk;
+}
+
 /**
  * Save time series data for watched generators
+ * @param time current value of time
  */
-void gridpack::dynamic_simulation::DSFullApp::saveTimeStep()
+void gridpack::dynamic_simulation::DSFullApp::saveTimeStep(double time)
 {
   if (!p_save_time_series) return;
-  int nbus = p_gen_buses.size();
-  int i, j;
-  int icnt = 0;
-  gridpack::dynamic_simulation::DSFullBus *bus;
-  for (i=0; i<nbus; i++) {
-    if (p_network->getActiveBus(p_gen_buses[i])) {
-      bus = dynamic_cast<gridpack::dynamic_simulation::DSFullBus*>
-        (p_network->getBus(p_gen_buses[i]).get());
-      std::vector<double> vals = bus->getWatchedValues(p_gen_ids[i]);
-      for (j=0; j<vals.size(); j++) {
-        p_time_series[icnt].push_back(vals[j]);
-        icnt++;
-      }
-    }
-  }
+  p_recorder.record(time);
 }
 
 /**
@@ -1701,33 +1924,11 @@ std::vector<int> gridpack::dynamic_simulation::DSFullApp::getTimeSeriesMap()
 {
   std::vector<int> ret;
   if (p_save_time_series) {
-    std::vector<int> orig_idx;
-    std::vector<std::string> tags;
-    int nbus = p_network->numBuses();
+    int ngen = p_recorder_idx.size();
     int i, j;
-    int icnt = 0;
-    gridpack::dynamic_simulation::DSFullBus *bus;
-    for (i=0; i<nbus; i++) {
-      if (p_network->getActiveBus(i)) {
-        bus = dynamic_cast<gridpack::dynamic_simulation::DSFullBus*>
-          (p_network->getBus(i).get());
-        std::vector<std::string> watched = bus->getWatchedGenerators();
-        for (j=0; j<watched.size(); j++) {
-          std::pair<int,std::string> gen
-            = std::pair<int,std::string>(bus->getOriginalIndex(),watched[j]);
-          std::map<std::pair<int,std::string>,int>::iterator it;
-          it = p_watch_list.find(gen);
-          if (it != p_watch_list.end()) {
-            ret.push_back(4*(it->second));
-            ret.push_back(4*(it->second)+1);
-            ret.push_back(4*(it->second)+2);
-            ret.push_back(4*(it->second)+3);
-          } else {
-            printf("Could not find generator %s on bus %d\n",
-                watched[j].c_str(),bus->getOriginalIndex());
-          }
-          icnt++;
-        }
+    for (i=0; i<ngen; i++) {
+      for (j=0; j<TimeSeriesRecorder::GEN_SIGNALS; j++) {
+        ret.push_back(TimeSeriesRecorder::GEN_SIGNALS*p_recorder_idx[i]+j);
       }
     }
   }
@@ -1762,20 +1963,27 @@ std::vector<std::vector<double> > gridpack::dynamic_simulation::DSFullApp::getGe
 {
   std::vector<std::vector<double> > ret;
   if (p_save_time_series) {
-    int ngen = p_time_series.size();
-    int i, j;
-    for (i=0; i<ngen; i++) {
-      std::vector<double> series;
-      int nsteps = (p_time_series[i]).size();
-      for (j=0; j<nsteps; j++) {
-        series.push_back((p_time_series[i])[j]);
-      }
-      ret.push_back(series);
+    int nsignals = p_recorder.numSignals();
+    int i;
+    ret.resize(nsignals);
+    for (i=0; i<nsignals; i++) {
+      p_recorder.getSignal(i,ret[i]);
     }
   }
   return ret;
 }
 
+/**
+ * Return recorder holding time series data for watched generators on
+ * this processor
+ * @return time series recorder
+ */
+const gridpack::dynamic_simulation::TimeSeriesRecorder&
+gridpack::dynamic_simulation::DSFullApp::getTimeSeriesRecorder()
+{
+  return p_recorder;
+}
+
 /**
  * Redirect output from standard out
  * @param filename name of file to write results to
@@ -1958,6 +2166,8 @@ void gridpack::dynamic_simulation::DSFullApp::setObservations(
   gridpack::utility::Configuration::ChildCursors observations;
   p_obs_genBus.clear();
   p_obs_genIDs.clear();
+  p_obs_loadBus.clear();
+  p_obs_loadIDs.clear();
   p_obs_vBus.clear();
   p_obs_vBusfreq.clear();
   gridpack::utility::StringUtils util;
@@ -2014,16 +2224,19 @@ void gridpack::dynamic_simulation::DSFullApp::setObservations(
       }
     }
   }
-  // create global vectors to store values of observations. Check to see if
-  // any observations are on this processor
-  p_obs_vMag.reset(new gridpack::parallel::GlobalVector<double>(p_comm));
-  p_obs_vAng.reset(new gridpack::parallel::GlobalVector<double>(p_comm));
-  p_obs_vBusfreqVal.reset(new gridpack::parallel::GlobalVector<double>(p_comm));
-  p_obs_rSpd.reset(new gridpack::parallel::GlobalVector<double>(p_comm));
-  p_obs_rAng.reset(new gridpack::parallel::GlobalVector<double>(p_comm));
-  p_obs_genP.reset(new gridpack::parallel::GlobalVector<double>(p_comm));
-  p_obs_genQ.reset(new gridpack::parallel::GlobalVector<double>(p_comm));
-  p_obs_fOnline.reset(new gridpack::parallel::GlobalVector<double>(p_comm));
+  // Check to see if any observations are on this processor
+  p_obs_lGenIdx.clear();
+  p_obs_lLoadIdx.clear();
+  p_obs_lVIdx.clear();
+  p_obs_lVIdxfreq.clear();
+  p_obs_gUse.clear();
+  p_obs_lUse.clear();
+  p_obs_vUse.clear();
+  p_obs_GenIdx.clear();
+  p_obs_LoadIdx.clear();
+  p_obs_VIdx.clear();
+  p_obs_VIdxfreq.clear();
+  p_obs_vUsefreq.clear();
   if (p_obs_genBus.size() > 0) {
     int nbus = p_obs_genBus.size();
     p_obs_gActive.resize(nbus);
@@ -2031,8 +2244,6 @@ void gridpack::dynamic_simulation::DSFullApp::setObservations(
     p_obs_lGenIDs.clear();
     p_obs_lGenIdx.clear();
     p_obs_gUse.clear();
-    std::vector<double> zeros;
-    std::vector<double> ones;
     int i, j, k, lidx;
     for (i = 0; i<nbus; i++) {
       std::vector<int> localIndices;
@@ -2063,8 +2274,6 @@ void gridpack::dynamic_simulation::DSFullApp::setObservations(
         p_obs_lGenBus.push_back(p_obs_genBus[i]);
         p_obs_lGenIDs.push_back(p_obs_genIDs[i]);
         p_obs_gUse.push_back(0);
-        zeros.push_back(0.0);
-        ones.push_back(1.0);
       }
     }
     // Sum foundGen vector over all processors to find out if any observations
@@ -2079,20 +2288,10 @@ void gridpack::dynamic_simulation::DSFullApp::setObservations(
           p_obs_lGenBus.push_back(p_obs_genBus[i]);
           p_obs_lGenIDs.push_back(p_obs_genIDs[i]);
           p_obs_gUse.push_back(1);
-          zeros.push_back(0.0);
-          ones.push_back(1.0);
         }
       }
     }
-    p_obs_rSpd->addElements(p_obs_lGenIdx, zeros);
-    p_obs_rSpd->upload();
-    p_obs_rAng->addElements(p_obs_lGenIdx, zeros);
-    p_obs_rAng->upload();
-    p_obs_genP->addElements(p_obs_lGenIdx, zeros);
-    p_obs_genP->upload();
-    p_obs_genQ->addElements(p_obs_lGenIdx, zeros);
-    p_obs_genQ->upload();
-    p_comm.sum(&p_obs_gActive[0],p_comm.size());
+    p_comm.sum(&p_obs_gActive[0],nbus);
   }
   if (p_obs_loadBus.size() > 0) {
     int nbus = p_obs_loadBus.size();
@@ -2101,7 +2300,6 @@ void gridpack::dynamic_simulation::DSFullApp::setObservations(
     p_obs_lLoadIDs.clear();
     p_obs_lLoadIdx.clear();
     p_obs_lUse.clear();
-    std::vector<double> ones;
     int i, j, k, lidx;
     for (i = 0; i<nbus; i++) {
       std::vector<int> localIndices;
@@ -2142,7 +2340,6 @@ void gridpack::dynamic_simulation::DSFullApp::setObservations(
         p_obs_lLoadBus.push_back(p_obs_loadBus[i]);
         p_obs_lLoadIDs.push_back(p_obs_loadIDs[i]);
         p_obs_lUse.push_back(0);
-        ones.push_back(1.0);
       }
     }
     // Sum foundLoad vector over all processors to find out if any observations
@@ -2157,13 +2354,10 @@ void gridpack::dynamic_simulation::DSFullApp::setObservations(
           p_obs_lLoadBus.push_back(p_obs_loadBus[i]);
           p_obs_lLoadIDs.push_back(p_obs_loadIDs[i]);
           p_obs_lUse.push_back(1);
-          ones.push_back(1.0);
         }
       }
     }
-    p_obs_fOnline->addElements(p_obs_lLoadIdx, ones);
-    p_obs_fOnline->upload();
-    p_comm.sum(&p_obs_lActive[0],p_comm.size());
+    p_comm.sum(&p_obs_lActive[0],nbus);
   }
   if (p_obs_vBus.size() > 0) {
     int nbus = p_obs_vBus.size();
@@ -2171,8 +2365,6 @@ void gridpack::dynamic_simulation::DSFullApp::setObservations(
     p_obs_lVBus.clear();
     p_obs_lVIdx.clear();
     p_obs_vUse.clear();
-    std::vector<double> zeros;
-    std::vector<double> ones;
     int i, j, lidx;
     for (i = 0; i<nbus; i++) {
       std::vector<int> localIndices;
@@ -2193,8 +2385,6 @@ void gridpack::dynamic_simulation::DSFullApp::setObservations(
         p_obs_VIdx.push_back(lidx);
         p_obs_lVBus.push_back(p_obs_vBus[i]);
         p_obs_vUse.push_back(0);
-        zeros.push_back(0.0);
-        ones.push_back(1.0);
       }
     }
     // Sum foundBus vector over all processors to find out if any observations
@@ -2208,23 +2398,16 @@ void gridpack::dynamic_simulation::DSFullApp::setObservations(
           p_obs_VIdx.push_back(-1);
           p_obs_lVBus.push_back(p_obs_vBus[i]);
           p_obs_vUse.push_back(1);
-          zeros.push_back(0.0);
-          ones.push_back(1.0);
         }
       }
     }
-    p_obs_vMag->addElements(p_obs_lVIdx, ones);
-    p_obs_vMag->upload();
-    p_obs_vAng->addElements(p_obs_lVIdx, zeros);
-    p_obs_vAng->upload();
-    p_comm.sum(&p_obs_vActive[0],p_comm.size());
+    p_comm.sum(&p_obs_vActive[0],nbus);
   }
   if (p_obs_vBusfreq.size() > 0) {  // this is for bus frequency ob
     int nbusfreq = p_obs_vBusfreq.size();
     p_obs_vActivefreq.resize(nbusfreq);
     p_obs_lVBusfreq.clear();
     p_obs_lVIdxfreq.clear();
-    std::vector<double> ones;
     int i, j, lidx;
     for (i = 0; i<nbusfreq; i++) {
       std::vector<int> localIndicesfreq;
@@ -2243,9 +2426,8 @@ void gridpack::dynamic_simulation::DSFullApp::setObservations(
         foundBusfreq[i] = 1;
         p_obs_lVIdxfreq.push_back(i);
         p_obs_VIdxfreq.push_back(lidx);
-        p_obs_lVBusfreq.push_back(p_obs_vBus[i]);
+        p_obs_lVBusfreq.push_back(p_obs_vBusfreq[i]);
         p_obs_vUsefreq.push_back(0);
-        ones.push_back(1.0);
 
         //need to setup Busfreq computation flag for this specific bus  here!!!!!!!!!!!!!!
         p_network->getBus(lidx)->setBusVolFrequencyFlag(true);
@@ -2261,17 +2443,14 @@ void gridpack::dynamic_simulation::DSFullApp::setObservations(
         if (!foundBusfreq[i]) {
           p_obs_lVIdxfreq.push_back(i);
           p_obs_VIdxfreq.push_back(-1);
-          p_obs_lVBusfreq.push_back(p_obs_vBus[i]);
+          p_obs_lVBusfreq.push_back(p_obs_vBusfreq[i]);
           p_obs_vUsefreq.push_back(1);
-          ones.push_back(1.0);
         }
       }
     }
-    p_obs_vBusfreqVal->addElements(p_obs_lVIdxfreq, ones);
-    p_obs_vBusfreqVal->upload();
-    p_comm.sum(&p_obs_vActivefreq[0],p_comm.size());
+    p_comm.sum(&p_obs_vActivefreq[0],nbusfreq);
   } //bus frequency ob ends here
-    
+  compileObservationPlan();
 }
 
 /**
@@ -2399,187 +2578,227 @@ void gridpack::dynamic_simulation::DSFullApp::getObservationLists_withBusFreq(
 }
 
 /**
- * Get current values of observations
- * @param vMag voltage magnitude for observed buses
- * @param vAng voltage angle for observed buses
- * @param rSpd rotor speed on observed generators
- * @param rAng rotor angle on observed generators
- * @param genP real power on observed generators
- * @param genQ reactive power on observed generators
- * @param fOnline fraction of load shed
+ * Construct a fixed plan for gathering the values of observations. Each
+ * local observation is mapped directly to the bus object and generator or
+ * load slot that owns it and to its location in the packed buffer that is
+ * exchanged between processors, so that getObservations does not need to
+ * search for devices or perform more than one collective operation.
  */
-void gridpack::dynamic_simulation::DSFullApp::getObservations(
-    std::vector<double> &vMag, std::vector<double> &vAng,
-    std::vector<double> &rSpd, std::vector<double> &rAng,
-	std::vector<double> &genP, std::vector<double> &genQ,
-    std::vector<double> &fOnline)
+void gridpack::dynamic_simulation::DSFullApp::compileObservationPlan()
 {
-  vMag.clear(); 
-  vAng.clear(); 
-  rSpd.clear(); 
-  rAng.clear(); 
-  genP.clear(); 
-  genQ.clear();
-  fOnline.clear(); 
-  std::vector<double> tvMag;
-  std::vector<double> tvAng;
-  std::vector<double> trSpd;
-  std::vector<double> trAng;
-  std::vector<double> tgenP;
-  std::vector<double> tgenQ;
-  std::vector<double> tfOnline;
-  bool use;
-  if (p_obs_genBus.size()) {
-    int i, j;
-    int nbus =  p_obs_lGenBus.size();
+  int i, j;
+  int ngen = p_obs_genBus.size();
+  int nload = p_obs_loadBus.size();
+  int nvbus = p_obs_vBus.size();
+  int nfreq = p_obs_vBusfreq.size();
+  // Offsets of each type of observation in p_obs_values
+  p_obs_offset[0] = 0;
+  p_obs_offset[1] = p_obs_offset[0] + ngen;
+  p_obs_offset[2] = p_obs_offset[1] + ngen;
+  p_obs_offset[3] = p_obs_offset[2] + ngen;
+  p_obs_offset[4] = p_obs_offset[3] + ngen;
+  p_obs_offset[5] = p_obs_offset[4] + nload;
+  p_obs_offset[6] = p_obs_offset[5] + nvbus;
+  p_obs_offset[7] = p_obs_offset[6] + nvbus;
+  int ntot = p_obs_offset[7] + nfreq;
+  // Values of observations that are not found anywhere
+  p_obs_values.resize(ntot);
+  for (i=0; i<ntot; i++) p_obs_values[i] = 0.0;
+  for (i=p_obs_offset[4]; i<p_obs_offset[6]; i++) p_obs_values[i] = 1.0;
+
+  // Find generator and load slots on host buses and create map from
+  // local buffer to global observation array
+  std::vector<int> obsmap;
+  p_obs_genPtr.clear();
+  p_obs_genSlot.clear();
+  if (ngen > 0) {
+    int nbus = p_obs_lGenIdx.size();
     for (i=0; i<nbus; i++) {
+      DSFullBus *bus = NULL;
+      int slot = -1;
       if (!static_cast<bool>(p_obs_gUse[i])) {
-        std::vector<std::string> tags
-          = p_network->getBus(p_obs_GenIdx[i])->getGenerators();
+        bus = p_network->getBus(p_obs_GenIdx[i]).get();
+        std::vector<std::string> tags = bus->getGenerators();
         for (j=0; j<tags.size(); j++) {
           if (tags[j] == p_obs_lGenIDs[i]) {
-            double speed, angle, gPtmp, gQtmp;
-            p_network->getBus(p_obs_GenIdx[i])->getWatchedValues(j,&speed,&angle, &gPtmp, &gQtmp);
-            trSpd.push_back(speed);
-            trAng.push_back(angle);
-            tgenP.push_back(gPtmp);
-            tgenQ.push_back(gQtmp);
+            slot = j;
             break;
           }
         }
-      } else {
-        trSpd.push_back(0.0);
-        trAng.push_back(0.0);
-        tgenP.push_back(0.0);
-        tgenQ.push_back(0.0);
-      }
-    }
-    // Check to make sure that local vectors still match
-    if (p_obs_lGenIdx.size() != trSpd.size()) {
-      printf("Mismatch in vector sizes when resetting global vectors\n");
-    }
-    p_obs_rSpd->resetElements(p_obs_lGenIdx, trSpd);
-    p_obs_rSpd->reload();
-    p_obs_rSpd->getAllData(trSpd);
-    p_obs_rAng->resetElements(p_obs_lGenIdx, trAng);
-    p_obs_rAng->reload();
-    p_obs_rAng->getAllData(trAng);
-	
-	p_obs_genP->resetElements(p_obs_lGenIdx, tgenP);
-    p_obs_genP->reload();
-    p_obs_genP->getAllData(tgenP);
-	p_obs_genQ->resetElements(p_obs_lGenIdx, tgenQ);
-    p_obs_genQ->reload();
-    p_obs_genQ->getAllData(tgenQ);
-	
-    nbus = trSpd.size();
-    for (i=0; i<nbus; i++) {
-      if (p_report_dummy_obs) {
-        use = true;
-      } else {
-        use = static_cast<bool>(p_obs_gActive[i]);
-      }
-      if (use) {
-        rSpd.push_back(trSpd[i]);
-        rAng.push_back(trAng[i]);
-        genP.push_back(tgenP[i]);
-        genQ.push_back(tgenQ[i]);
-
+        if (slot < 0) bus = NULL;
       }
+      p_obs_genPtr.push_back(bus);
+      p_obs_genSlot.push_back(slot);
+      for (j=0; j<4; j++) obsmap.push_back(p_obs_offset[j]+p_obs_lGenIdx[i]);
     }
   }
-  if (p_obs_loadBus.size()) {
-    int i, j;
-    int nbus =  p_obs_lLoadBus.size();
+  p_obs_loadPtr.clear();
+  p_obs_loadSlot.clear();
+  if (nload > 0) {
+    int nbus = p_obs_lLoadIdx.size();
     for (i=0; i<nbus; i++) {
-      bool found = false;
+      DSFullBus *bus = NULL;
+      int slot = -1;
       if (!static_cast<bool>(p_obs_lUse[i])) {
-        std::vector<std::string> tags
-          = p_network->getBus(p_obs_LoadIdx[i])->getDynamicLoads();
+        bus = p_network->getBus(p_obs_LoadIdx[i]).get();
+        std::vector<std::string> tags = bus->getDynamicLoads();
         for (j=0; j<tags.size(); j++) {
           if (tags[j] == p_obs_lLoadIDs[i]) {
-            double frac;
-            frac = p_network->getBus(p_obs_LoadIdx[i])->getOnlineLoadFraction(j);
-            tfOnline.push_back(frac);
-            found = true;
+            slot = j;
             break;
           }
         }
-      } else {
-        tfOnline.push_back(1.0);
-        found = true;
-      }
-      if (!found) {
-        tfOnline.push_back(1.0);
+        if (slot < 0) bus = NULL;
       }
+      p_obs_loadPtr.push_back(bus);
+      p_obs_loadSlot.push_back(slot);
+      obsmap.push_back(p_obs_offset[4]+p_obs_lLoadIdx[i]);
     }
-    // Check to make sure that local vectors still match
-    if (p_obs_lLoadIdx.size() != tfOnline.size()) {
-      printf("Mismatch in vector sizes when resetting global vectors\n");
-    }
-    p_obs_fOnline->resetElements(p_obs_lLoadIdx, tfOnline);
-    p_obs_fOnline->reload();
-    p_obs_fOnline->getAllData(tfOnline);
-    nbus = tfOnline.size();
+  }
+  p_obs_vPtr.clear();
+  if (nvbus > 0) {
+    int nbus = p_obs_lVIdx.size();
     for (i=0; i<nbus; i++) {
-      if (p_report_dummy_obs) {
-        use = true;
-      } else {
-        use = static_cast<bool>(p_obs_lActive[i]);
-      }
-      if (use) {
-        fOnline.push_back(tfOnline[i]);
+      DSFullBus *bus = NULL;
+      if (!static_cast<bool>(p_obs_vUse[i])) {
+        bus = p_network->getBus(p_obs_VIdx[i]).get();
       }
+      p_obs_vPtr.push_back(bus);
+      obsmap.push_back(p_obs_offset[5]+p_obs_lVIdx[i]);
+      obsmap.push_back(p_obs_offset[6]+p_obs_lVIdx[i]);
     }
   }
-  if (p_obs_vBus.size() > 0) {
-    int i, j;
-    int nbus =  p_obs_lVBus.size();
+  p_obs_vPtrfreq.clear();
+  if (nfreq > 0) {
+    int nbus = p_obs_lVIdxfreq.size();
     for (i=0; i<nbus; i++) {
-      if (!static_cast<bool>(p_obs_vUse[i])) {
-        gridpack::ComplexType voltage =
-          p_network->getBus(p_obs_VIdx[i])->getComplexVoltage();
-        double rV = real(voltage);
-        double iV = imag(voltage);
-        double V = sqrt(rV*rV+iV*iV);
-        double Ang = acos(rV/V);
-        if (iV < 0) {
-          Ang = -Ang;
-        }
-        tvMag.push_back(V);
-        tvAng.push_back(Ang);
-      } else {
-        tvMag.push_back(1.0);
-        tvAng.push_back(0.0);
+      DSFullBus *bus = NULL;
+      if (!static_cast<bool>(p_obs_vUsefreq[i])) {
+        bus = p_network->getBus(p_obs_VIdxfreq[i]).get();
       }
+      p_obs_vPtrfreq.push_back(bus);
+      obsmap.push_back(p_obs_offset[7]+p_obs_lVIdxfreq[i]);
+    }
+  }
+
+  // Exchange buffer sizes and maps. These do not change between calls to
+  // getObservations
+  int nprocs = p_comm.size();
+  MPI_Comm comm = static_cast<MPI_Comm>(p_comm);
+  int nlocal = obsmap.size();
+  p_obs_sendBuf.resize(nlocal+1);
+  p_obs_recvCounts.resize(nprocs);
+  p_obs_recvDispls.resize(nprocs);
+  MPI_Allgather(&nlocal,1,MPI_INT,&p_obs_recvCounts[0],1,MPI_INT,comm);
+  int nrecv = 0;
+  for (i=0; i<nprocs; i++) {
+    p_obs_recvDispls[i] = nrecv;
+    nrecv += p_obs_recvCounts[i];
+  }
+  obsmap.resize(nlocal+1);
+  p_obs_recvMap.resize(nrecv+1);
+  p_obs_recvBuf.resize(nrecv+1);
+  MPI_Allgatherv(&obsmap[0],nlocal,MPI_INT,&p_obs_recvMap[0],
+      &p_obs_recvCounts[0],&p_obs_recvDispls[0],MPI_INT,comm);
+  p_obs_recvMap.resize(nrecv);
+}
+
+/**
+ * Evaluate all observations using the plan created in setObservations
+ * and copy them to all processors. Results are stored in p_obs_values
+ */
+void gridpack::dynamic_simulation::DSFullApp::gatherObservations()
+{
+  int i;
+  if (p_obs_recvCounts.size() == 0) return;
+  int n = 0;
+  int nbus = p_obs_genPtr.size();
+  for (i=0; i<nbus; i++) {
+    double speed, angle, gPtmp, gQtmp;
+    if (p_obs_genPtr[i]) {
+      p_obs_genPtr[i]->getWatchedValues(p_obs_genSlot[i],&speed,&angle,
+          &gPtmp,&gQtmp);
+    } else {
+      speed = 0.0;
+      angle = 0.0;
+      gPtmp = 0.0;
+      gQtmp = 0.0;
     }
-    // Check to make sure that local vectors still match
-    if (p_obs_lVIdx.size() != tvMag.size()) {
-      printf("Mismatch in vector sizes when resetting global vectors\n");
+    p_obs_sendBuf[n] = speed;
+    p_obs_sendBuf[n+1] = angle;
+    p_obs_sendBuf[n+2] = gPtmp;
+    p_obs_sendBuf[n+3] = gQtmp;
+    n += 4;
+  }
+  nbus = p_obs_loadPtr.size();
+  for (i=0; i<nbus; i++) {
+    if (p_obs_loadPtr[i]) {
+      p_obs_sendBuf[n] = p_obs_loadPtr[i]->getOnlineLoadFraction(
+          p_obs_loadSlot[i]);
+    } else {
+      p_obs_sendBuf[n] = 1.0;
     }
-    p_obs_vMag->resetElements(p_obs_lVIdx, tvMag);
-    p_obs_vMag->reload();
-    p_obs_vMag->getAllData(tvMag);
-    p_obs_vAng->resetElements(p_obs_lVIdx, tvAng);
-    p_obs_vAng->reload();
-    p_obs_vAng->getAllData(tvAng);
-    nbus = tvMag.size();
-    for (i=0; i<nbus; i++) {
-      if (p_report_dummy_obs) {
-        use = true;
-      } else {
-        use = static_cast<bool>(p_obs_vActive[i]);
-      }
-      if (use) {
-        vMag.push_back(tvMag[i]);
-        vAng.push_back(tvAng[i]);
+    n++;
+  }
+  nbus = p_obs_vPtr.size();
+  for (i=0; i<nbus; i++) {
+    if (p_obs_vPtr[i]) {
+      gridpack::ComplexType voltage = p_obs_vPtr[i]->getComplexVoltage();
+      double rV = real(voltage);
+      double iV = imag(voltage);
+      double V = sqrt(rV*rV+iV*iV);
+      double Ang = acos(rV/V);
+      if (iV < 0) {
+        Ang = -Ang;
       }
+      p_obs_sendBuf[n] = V;
+      p_obs_sendBuf[n+1] = Ang;
+    } else {
+      p_obs_sendBuf[n] = 1.0;
+      p_obs_sendBuf[n+1] = 0.0;
+    }
+    n += 2;
+  }
+  nbus = p_obs_vPtrfreq.size();
+  for (i=0; i<nbus; i++) {
+    if (p_obs_vPtrfreq[i]) {
+      p_obs_sendBuf[n] = p_obs_vPtrfreq[i]->getBusVolFrequency();
+    } else {
+      p_obs_sendBuf[n] = 0.0;
     }
+    n++;
+  }
+  MPI_Allgatherv(&p_obs_sendBuf[0],n,MPI_DOUBLE,&p_obs_recvBuf[0],
+      &p_obs_recvCounts[0],&p_obs_recvDispls[0],MPI_DOUBLE,
+      static_cast<MPI_Comm>(p_comm));
+  int nrecv = p_obs_recvMap.size();
+  for (i=0; i<nrecv; i++) {
+    p_obs_values[p_obs_recvMap[i]] = p_obs_recvBuf[i];
   }
 }
 
 /**
- * Get current values of observations including bus frequency ob
+ * Copy values of observations of one type from p_obs_values, leaving out
+ * observations that do not correspond to elements in the network
+ * @param type index of observation type in p_obs_offset
+ * @param active flags indicating which observations exist
+ * @param vals values of observations
+ */
+void gridpack::dynamic_simulation::DSFullApp::copyObservations(int type,
+    const std::vector<int> &active, std::vector<double> &vals)
+{
+  int i;
+  int nobs = active.size();
+  const double *ptr = &p_obs_values[0] + p_obs_offset[type];
+  for (i=0; i<nobs; i++) {
+    if (p_report_dummy_obs || static_cast<bool>(active[i])) {
+      vals.push_back(ptr[i]);
+    }
+  }
+}
+
+/**
+ * Get current values of observations
  * @param vMag voltage magnitude for observed buses
  * @param vAng voltage angle for observed buses
  * @param rSpd rotor speed on observed generators
@@ -2587,13 +2806,12 @@ void gridpack::dynamic_simulation::DSFullApp::getObservations(
  * @param genP real power on observed generators
  * @param genQ reactive power on observed generators
  * @param fOnline fraction of load shed
- * @param busfreq frequency of the buses in ob list
  */
-void gridpack::dynamic_simulation::DSFullApp::getObservations_withBusFreq(
+void gridpack::dynamic_simulation::DSFullApp::getObservations(
     std::vector<double> &vMag, std::vector<double> &vAng,
     std::vector<double> &rSpd, std::vector<double> &rAng,
 	std::vector<double> &genP, std::vector<double> &genQ,
-    std::vector<double> &fOnline, std::vector<double> &busfreq)
+    std::vector<double> &fOnline)
 {
   vMag.clear(); 
   vAng.clear(); 
@@ -2602,199 +2820,44 @@ void gridpack::dynamic_simulation::DSFullApp::getObservations_withBusFreq(
   genP.clear(); 
   genQ.clear();
   fOnline.clear(); 
-  busfreq.clear();
-  std::vector<double> tvMag;
-  std::vector<double> tvAng;
-  std::vector<double> trSpd;
-  std::vector<double> trAng;
-  std::vector<double> tgenP;
-  std::vector<double> tgenQ;
-  std::vector<double> tfOnline;
-  std::vector<double> tbusfreq;
-  bool use;
-  if (p_obs_genBus.size()) {
-    int i, j;
-    int nbus =  p_obs_lGenBus.size();
-    for (i=0; i<nbus; i++) {
-      if (!static_cast<bool>(p_obs_gUse[i])) {
-        std::vector<std::string> tags
-          = p_network->getBus(p_obs_GenIdx[i])->getGenerators();
-        for (j=0; j<tags.size(); j++) {
-          if (tags[j] == p_obs_lGenIDs[i]) {
-            double speed, angle, gPtmp, gQtmp;
-            p_network->getBus(p_obs_GenIdx[i])->getWatchedValues(j,&speed,&angle, &gPtmp, &gQtmp);
-            trSpd.push_back(speed);
-            trAng.push_back(angle);
-            tgenP.push_back(gPtmp);
-            tgenQ.push_back(gQtmp);
-            break;
-          }
-        }
-      } else {
-        trSpd.push_back(0.0);
-        trAng.push_back(0.0);
-        tgenP.push_back(0.0);
-        tgenQ.push_back(0.0);
-      }
-    }
-    // Check to make sure that local vectors still match
-    if (p_obs_lGenIdx.size() != trSpd.size()) {
-      printf("Mismatch in vector sizes when resetting global vectors\n");
-    }
-    p_obs_rSpd->resetElements(p_obs_lGenIdx, trSpd);
-    p_obs_rSpd->reload();
-    p_obs_rSpd->getAllData(trSpd);
-    p_obs_rAng->resetElements(p_obs_lGenIdx, trAng);
-    p_obs_rAng->reload();
-    p_obs_rAng->getAllData(trAng);
-	
-	p_obs_genP->resetElements(p_obs_lGenIdx, tgenP);
-    p_obs_genP->reload();
-    p_obs_genP->getAllData(tgenP);
-	p_obs_genQ->resetElements(p_obs_lGenIdx, tgenQ);
-    p_obs_genQ->reload();
-    p_obs_genQ->getAllData(tgenQ);
-	
-    nbus = trSpd.size();
-    for (i=0; i<nbus; i++) {
-      if (p_report_dummy_obs) {
-        use = true;
-      } else {
-        use = static_cast<bool>(p_obs_gActive[i]);
-      }
-      if (use) {
-        rSpd.push_back(trSpd[i]);
-        rAng.push_back(trAng[i]);
-		genP.push_back(tgenP[i]);
-		genQ.push_back(tgenQ[i]);
-		
-      }
-    }
+  gatherObservations();
+  if (p_obs_genBus.size() > 0) {
+    copyObservations(0,p_obs_gActive,rSpd);
+    copyObservations(1,p_obs_gActive,rAng);
+    copyObservations(2,p_obs_gActive,genP);
+    copyObservations(3,p_obs_gActive,genQ);
   }
-  if (p_obs_loadBus.size()) {
-    int i, j;
-    int nbus =  p_obs_lLoadBus.size();
-    for (i=0; i<nbus; i++) {
-      bool found = false;
-      if (!static_cast<bool>(p_obs_lUse[i])) {
-        std::vector<std::string> tags
-          = p_network->getBus(p_obs_LoadIdx[i])->getDynamicLoads();
-        for (j=0; j<tags.size(); j++) {
-          if (tags[j] == p_obs_lLoadIDs[i]) {
-            double frac;
-            frac = p_network->getBus(p_obs_LoadIdx[i])->getOnlineLoadFraction(j);
-            tfOnline.push_back(frac);
-            found = true;
-            break;
-          }
-        }
-      } else {
-        tfOnline.push_back(1.0);
-        found = true;
-      }
-      if (!found) {
-        tfOnline.push_back(1.0);
-      }
-    }
-    // Check to make sure that local vectors still match
-    if (p_obs_lLoadIdx.size() != tfOnline.size()) {
-      printf("Mismatch in vector sizes when resetting global vectors\n");
-    }
-    p_obs_fOnline->resetElements(p_obs_lLoadIdx, tfOnline);
-    p_obs_fOnline->reload();
-    p_obs_fOnline->getAllData(tfOnline);
-    nbus = tfOnline.size();
-    for (i=0; i<nbus; i++) {
-      if (p_report_dummy_obs) {
-        use = true;
-      } else {
-        use = static_cast<bool>(p_obs_lActive[i]);
-      }
-      if (use) {
-        fOnline.push_back(tfOnline[i]);
-      }
-    }
+  if (p_obs_loadBus.size() > 0) {
+    copyObservations(4,p_obs_lActive,fOnline);
   }
-  
   if (p_obs_vBus.size() > 0) {
-    int i, j;
-    int nbus =  p_obs_lVBus.size();
-    for (i=0; i<nbus; i++) {
-      if (!static_cast<bool>(p_obs_vUse[i])) {
-        gridpack::ComplexType voltage =
-          p_network->getBus(p_obs_VIdx[i])->getComplexVoltage();
-        double rV = real(voltage);
-        double iV = imag(voltage);
-        double V = sqrt(rV*rV+iV*iV);
-        double Ang = acos(rV/V);
-        if (iV < 0) {
-          Ang = -Ang;
-        }
-        tvMag.push_back(V);
-        tvAng.push_back(Ang);
-      } else {
-        tvMag.push_back(1.0);
-        tvAng.push_back(0.0);
-      }
-    }
-    // Check to make sure that local vectors still match
-    if (p_obs_lVIdx.size() != tvMag.size()) {
-      printf("Mismatch in vector sizes when resetting global vectors\n");
-    }
-    p_obs_vMag->resetElements(p_obs_lVIdx, tvMag);
-    p_obs_vMag->reload();
-    p_obs_vMag->getAllData(tvMag);
-    p_obs_vAng->resetElements(p_obs_lVIdx, tvAng);
-    p_obs_vAng->reload();
-    p_obs_vAng->getAllData(tvAng);
-    nbus = tvMag.size();
-    for (i=0; i<nbus; i++) {
-      if (p_report_dummy_obs) {
-        use = true;
-      } else {
-        use = static_cast<bool>(p_obs_vActive[i]);
-      }
-      if (use) {
-        vMag.push_back(tvMag[i]);
-        vAng.push_back(tvAng[i]);
-      }
-    }
+    copyObservations(5,p_obs_vActive,vMag);
+    copyObservations(6,p_obs_vActive,vAng);
   }
-  
-  if (p_obs_vBusfreq.size() > 0) { // bus frequency ob get
-    int i, j;
-    int nbusfreq =  p_obs_lVBusfreq.size();
-	double dbusfreqtmp;
-    for (i=0; i<nbusfreq; i++) {
-      if (!static_cast<bool>(p_obs_vUsefreq[i])) {
-        dbusfreqtmp = p_network->getBus(p_obs_VIdxfreq[i])->getBusVolFrequency();
-        tbusfreq.push_back(dbusfreqtmp);
-      } else {
-        tbusfreq.push_back(0.0);
-      }
-    }
-    // Check to make sure that local vectors still match
-    if (p_obs_lVIdxfreq.size() != tbusfreq.size()) {
-      printf("Mismatch in vector sizes when resetting global vectors for bus frequency observations\n");
-    }
-    p_obs_vBusfreqVal->resetElements(p_obs_lVIdxfreq, tbusfreq);
-    p_obs_vBusfreqVal->reload();
-    p_obs_vBusfreqVal->getAllData(tbusfreq);
-	
-    nbusfreq = tbusfreq.size();
-    for (i=0; i<nbusfreq; i++) {
-      if (p_report_dummy_obs) {
-        use = true;
-      } else {
-        use = static_cast<bool>(p_obs_vActivefreq[i]);
-      }
-      if (use) {
-        busfreq.push_back(tbusfreq[i]);
-      }
-    }
+}
+
+/**
+ * Get current values of observations including bus frequency ob
+ * @param vMag voltage magnitude for observed buses
+ * @param vAng voltage angle for observed buses
+ * @param rSpd rotor speed on observed generators
+ * @param rAng rotor angle on observed generators
+ * @param genP real power on observed generators
+ * @param genQ reactive power on observed generators
+ * @param fOnline fraction of load shed
+ * @param busfreq frequency of the buses in ob list
+ */
+void gridpack::dynamic_simulation::DSFullApp::getObservations_withBusFreq(
+    std::vector<double> &vMag, std::vector<double> &vAng,
+    std::vector<double> &rSpd, std::vector<double> &rAng,
+	std::vector<double> &genP, std::vector<double> &genQ,
+    std::vector<double> &fOnline, std::vector<double> &busfreq)
+{
+  getObservations(vMag, vAng, rSpd, rAng, genP, genQ, fOnline);
+  busfreq.clear();
+  if (p_obs_vBusfreq.size() > 0) {
+    copyObservations(7,p_obs_vActivefreq,busfreq);
   }
-  
-  
 }
 
 /**
@@ -2895,6 +2958,18 @@ void gridpack::dynamic_simulation::DSFullApp::solvePreInitialize(
 
   t_misc = timer->createCategory("DS Solve: Miscellaneous");
   t_presolve = timer->createCategory("DS App: solvePreInitialize");
+  // Categories used in executeOneSimuStep are registered once here so that
+  // the time step loop does not have to look up titles
+  t_execute_steps = timer->createCategory("DS Solve: execute steps");
+  t_mIf = timer->createCategory("DS Solve: Modified Euler Predictor: Make INorton");
+  t_psolve = timer->createCategory("DS Solve: Modified Euler Predictor: Linear Solver");
+  t_vmap = timer->createCategory("DS Solve: Map Volt to Bus");
+  t_volt = timer->createCategory("DS Solve: Set Volt");
+  t_predictor = timer->createCategory("DS Solve: Modified Euler Predictor");
+  t_cmIf = timer->createCategory("DS Solve: Modified Euler Corrector: Make INorton");
+  t_csolve = timer->createCategory("DS Solve: Modified Euler Corrector: Linear Solver");
+  t_corrector = timer->createCategory("DS Solve: Modified Euler Corrector");
+  t_secure = timer->createCategory("DS Solve: Check Security");
 #ifdef MAP_PROFILE
   timer->configTimer(false);
 #endif
@@ -2917,12 +2992,20 @@ void gridpack::dynamic_simulation::DSFullApp::solvePreInitialize(
   // set the line trip action related flag to be false and clear the vector
   bapplyLineTripAction = false;
   p_vbranches_need_to_trip.clear();
+  p_vbranches_trip_idx.clear();
+
+  // reconnect any islands that were dropped in a previous simulation
+  for (int ibus=0; ibus<p_network->numBuses(); ibus++) {
+    p_network->getBus(ibus)->setDeadIsland(false);
+  }
   
   // set the load P and Q change related flag to be false and clear the vector
   bapplyLoadChangeP = false;
   bapplyLoadChangeQ = false;
   p_vbus_need_to_changeP.clear();
   p_vbus_need_to_changeQ.clear();
+  p_vbus_changeP_idx.clear();
+  p_vbus_changeQ_idx.clear();
   
   ybusMap_sptr.reset(new gridpack::mapper::FullMatrixMap<DSFullNetwork> (p_network));
   orgYbus = ybusMap_sptr->mapToMatrix();
@@ -3076,6 +3159,11 @@ void gridpack::dynamic_simulation::DSFullApp::solvePreInitialize(
   last_S_Steps = -1;
 
   p_insecureAt = -1;
+  p_etFaultEnd = fault.end;
+  p_etSettleStart = -1.0;
+  p_terminatedAt = -1.0;
+  if (p_etBatch) p_etBatch->wait();
+  p_etPendingTime = -1.0;
 
   p_factory->setMode(make_INorton_full);
   //gridpack::mapper::BusVectorMap<DSFullNetwork> nbusMap(p_network);
@@ -3130,7 +3218,6 @@ void gridpack::dynamic_simulation::DSFullApp::executeOneSimuStep( ){
     gridpack::utility::CoarseTimer *timer =
     gridpack::utility::CoarseTimer::instance();
 
-    t_execute_steps = timer->createCategory("DS Solve: execute steps");
 	timer->start(t_execute_steps);
 	
   //for (Simu_Current_Step = 0; Simu_Current_Step < simu_total_steps - 1; Simu_Current_Step++) {
@@ -3166,78 +3253,11 @@ void gridpack::dynamic_simulation::DSFullApp::executeOneSimuStep( ){
     }
     timer->stop(t_misc);
 	
-	// renke add, if a line trip action is detected, modify the post-fault Ymatrix. 
+	// renke add, if a line trip action or a constant Y load change is
+	// detected, modify the post-fault Ymatrix. Only the entries of the
+	// affected buses and branches are updated
 	// Here we assume line trip action will only happen AFTER FAULT!!!!!!!
-	if (bapplyLineTripAction){
-		
-		char sybus[100];
-		
-		//sprintf(sybus, "ybus_%d_before_linetrip.m",Simu_Current_Step );
-		//ybus->save(sybus);
-		
-		p_factory->setMode(branch_trip_action);
-        ybusMap_sptr->incrementMatrix(ybus);  // in the current code, solver_posfy_sptr is linked with ybus, check Bill
-		
-		//printf ("-----------renke debug, line tripping action detected----------");		
-        //ybus->print();       
-        //sprintf(sybus, "ybus_%d_linetrip_test.m",Simu_Current_Step );
-        //ybus->save(sybus);
-		
-		// after Y-matrix is modified, we need to clear this line trip action to 
-		// avoid next step still apply the same line trip action
-		clearLineTripAction();// in this one, need to clear the flag, vector of each branch and set the status of the branches to be 0);  
-
-	}
-   bapplyLineTripAction = false;
-   
-   
-   	// renke add, if a load change P action is detected, modify the post-fault Ymatrix. 
-	// Here we assume line trip action will only happen AFTER FAULT!!!!!!!
-	if (bapplyLoadChangeP){
-		
-		char sybus[100];
-		
-		//sprintf(sybus, "ybus_%d_before_linetrip.m",Simu_Current_Step );
-		//ybus->save(sybus);
-		
-		p_factory->setMode(bus_Yload_change_P);
-        ybusMap_sptr->incrementMatrix(ybus);  // in the current code, solver_posfy_sptr is linked with ybus, check Bill
-		
-		//printf ("-----------renke debug, line tripping action detected----------");		
-        //ybus->print();       
-        //sprintf(sybus, "ybus_%d_linetrip_test.m",Simu_Current_Step );
-        //ybus->save(sybus);
-		
-		// after Y-matrix is modified, we need to clear this line trip action to 
-		// avoid next step still apply the same line trip action
-		clearConstYLoad_Change_P();// in this one, need to clear the flag, vector of each branch and set the status of the branches to be 0);  
-
-	}
-   bapplyLoadChangeP = false;
-   
-      	// renke add, if a load change Q action is detected, modify the post-fault Ymatrix. 
-	// Here we assume line trip action will only happen AFTER FAULT!!!!!!!
-	if (bapplyLoadChangeQ){
-		
-		char sybus[100];
-		
-		//sprintf(sybus, "ybus_%d_before_linetrip.m",Simu_Current_Step );
-		//ybus->save(sybus);
-		
-		p_factory->setMode(bus_Yload_change_Q);
-        ybusMap_sptr->incrementMatrix(ybus);  // in the current code, solver_posfy_sptr is linked with ybus, check Bill
-		
-		//printf ("-----------renke debug, line tripping action detected----------");		
-        //ybus->print();       
-        //sprintf(sybus, "ybus_%d_linetrip_test.m",Simu_Current_Step );
-        //ybus->save(sybus);
-		
-		// after Y-matrix is modified, we need to clear this line trip action to 
-		// avoid next step still apply the same line trip action
-		clearConstYLoad_Change_Q();// in this one, need to clear the flag, vector of each branch and set the status of the branches to be 0);  
-
-	}
-   bapplyLoadChangeQ = false;
+	applyYbusChanges();
    
    
     if (Simu_Current_Step !=0 && last_S_Steps != S_Steps) {
@@ -3249,7 +3269,6 @@ void gridpack::dynamic_simulation::DSFullApp::executeOneSimuStep( ){
 #ifdef MAP_PROFILE
   timer->configTimer(true);
 #endif
-    t_mIf = timer->createCategory("DS Solve: Modified Euler Predictor: Make INorton");
     timer->start(t_mIf);
 	p_factory->setMode(make_INorton_full);
     nbusMap_sptr->mapToVector(INorton_full);
@@ -3265,7 +3284,6 @@ void gridpack::dynamic_simulation::DSFullApp::executeOneSimuStep( ){
  
     // ---------- CALL ssnetwork_cal_volt(S_Steps+1, flagF2) 
     // to calculate terminal volt: ----------
-    t_psolve = timer->createCategory("DS Solve: Modified Euler Predictor: Linear Solver");
     timer->start(t_psolve);
     //boost::shared_ptr<gridpack::math::Vector> volt_full(INorton_full->clone());
     volt_full->zero();
@@ -3357,7 +3375,6 @@ void gridpack::dynamic_simulation::DSFullApp::executeOneSimuStep( ){
     //	 exit(0);
    //	}
 
-    t_vmap= timer->createCategory("DS Solve: Map Volt to Bus");
     timer->start(t_vmap);
 	
 	//printf("after first volt sovle, before first volt map: \n");
@@ -3373,7 +3390,6 @@ void gridpack::dynamic_simulation::DSFullApp::executeOneSimuStep( ){
 	}
     timer->stop(t_vmap);
 
-    t_volt= timer->createCategory("DS Solve: Set Volt");
     timer->start(t_volt);
     p_factory->setVolt(false);
 	p_factory->updateBusFreq(h_sol1);
@@ -3512,6 +3528,10 @@ void gridpack::dynamic_simulation::DSFullApp::executeOneSimuStep( ){
 
         }
     }
+
+    // a relay trip may have split the network or removed the last
+    // generator in an island
+    if (flagBus || flagBranch) checkIslands();
 	
     //renke add, update old busvoltage first
     p_factory->updateoldbusvoltage(); //renke add
@@ -3523,7 +3543,6 @@ void gridpack::dynamic_simulation::DSFullApp::executeOneSimuStep( ){
   timer->configTimer(false);
 #endif
 
-    t_predictor = timer->createCategory("DS Solve: Modified Euler Predictor");
     //printf("Test: predictor begins: \n");
     timer->start(t_predictor);
     if (Simu_Current_Step !=0 && last_S_Steps != S_Steps) {
@@ -3542,7 +3561,6 @@ void gridpack::dynamic_simulation::DSFullApp::executeOneSimuStep( ){
     
 
     //INorton_full = nbusMap_sptr->mapToVector();
-    t_cmIf = timer->createCategory("DS Solve: Modified Euler Corrector: Make INorton");
     timer->start(t_cmIf);
     p_factory->setMode(make_INorton_full);
     nbusMap_sptr->mapToVector(INorton_full);
@@ -3553,7 +3571,6 @@ void gridpack::dynamic_simulation::DSFullApp::executeOneSimuStep( ){
 
     // ---------- CALL ssnetwork_cal_volt(S_Steps+1, flagF2)
     // to calculate terminal volt: ----------
-    t_csolve = timer->createCategory("DS Solve: Modified Euler Corrector: Linear Solver");
     timer->start(t_csolve);
     
     volt_full->zero();
@@ -3639,7 +3656,6 @@ void gridpack::dynamic_simulation::DSFullApp::executeOneSimuStep( ){
 	p_factory->updateBusFreq(h_sol1);
     timer->stop(t_volt);
 
-    t_corrector = timer->createCategory("DS Solve: Modified Euler Corrector");
     timer->start(t_corrector);
     //printf("Test: corrector begins: \n");
     if (last_S_Steps != S_Steps) {
@@ -3654,7 +3670,6 @@ void gridpack::dynamic_simulation::DSFullApp::executeOneSimuStep( ){
 
 
     //printf("----------!renke debug, after solve INorton_full and map back voltage ----------\n");
-    t_secure = timer->createCategory("DS Solve: Check Security");
     timer->start(t_secure);
     if (p_generatorWatch && Simu_Current_Step%p_generatorWatchFrequency == 0) {
       char tbuf[32];
@@ -3705,7 +3720,7 @@ void gridpack::dynamic_simulation::DSFullApp::executeOneSimuStep( ){
       if (p_loadWatch) p_loadIO->dumpChannel();
 #endif
     }
-    saveTimeStep();
+    saveTimeStep(static_cast<double>(Simu_Current_Step)*p_time_step);
     //    if ((!p_factory->securityCheck()) && p_insecureAt == -1)  
     //       p_insecureAt = Simu_Current_Step;
 
@@ -3756,12 +3771,19 @@ void gridpack::dynamic_simulation::DSFullApp::executeOneSimuStep( ){
       p_frequencyOK = p_frequencyOK && checkFrequency(0.5,presentTime);
       if (!p_frequencyOK) Simu_Current_Step = simu_total_steps;
     }
+    if (p_earlyTermination && Simu_Current_Step < simu_total_steps) {
+      double presentTime = static_cast<double>(Simu_Current_Step)*p_time_step;
+      if (checkEarlyTermination(presentTime)) {
+        Simu_Current_Step = simu_total_steps;
+      }
+    }
   //} // main for loop ends here
   
   Simu_Current_Step++;
   
   if (Simu_Current_Step >= simu_total_steps - 1){
 	  p_bDynSimuDone = true;
+	  if (p_save_time_series) p_recorder.flush();
   }
 	  
   
@@ -4088,6 +4110,7 @@ void gridpack::dynamic_simulation::DSFullApp::applyConstYLoad_Change_P(int bus_n
 		bus->applyConstYLoad_Change_P(loadPChangeMW);
 		bapplyLoadChangeP = true;
 		p_vbus_need_to_changeP.push_back(bus);
+		p_vbus_changeP_idx.push_back(vec_busintidx[ibus]);
 	}
 	
    // Check to see if a load change P is occuring somewhere in the system
@@ -4105,6 +4128,7 @@ void gridpack::dynamic_simulation::DSFullApp::clearConstYLoad_Change_P()
 		p_vbus_need_to_changeP[ibus]->clearConstYLoad_Change_P();
 	}
 	p_vbus_need_to_changeP.clear();	
+	p_vbus_changeP_idx.clear();
 }
 
 /**
@@ -4126,6 +4150,7 @@ void gridpack::dynamic_simulation::DSFullApp::setConstYLoadtoZero_P(int bus_numb
 		if (ret){
 			bapplyLoadChangeP = true;
 			p_vbus_need_to_changeP.push_back(bus);
+			p_vbus_changeP_idx.push_back(vec_busintidx[ibus]);
 		}
 	}
 	
@@ -4153,8 +4178,10 @@ void gridpack::dynamic_simulation::DSFullApp::setConstYLoadImpedance(int bus_num
 		if (ret){
 			bapplyLoadChangeP = true;
 			p_vbus_need_to_changeP.push_back(bus);
+			p_vbus_changeP_idx.push_back(vec_busintidx[ibus]);
 			bapplyLoadChangeQ = true;
 			p_vbus_need_to_changeQ.push_back(bus);
+			p_vbus_changeQ_idx.push_back(vec_busintidx[ibus]);
 		}				
 	}
 	
@@ -4181,6 +4208,7 @@ void gridpack::dynamic_simulation::DSFullApp::applyConstYLoad_Change_Q(int bus_n
 		bus->applyConstYLoad_Change_Q(loadPChangeMVAR);
 		bapplyLoadChangeQ = true;
 		p_vbus_need_to_changeQ.push_back(bus);
+		p_vbus_changeQ_idx.push_back(vec_busintidx[ibus]);
 	}
 	
 	// Check to see if a load change Q is occuring somewhere in the system
@@ -4198,6 +4226,7 @@ void gridpack::dynamic_simulation::DSFullApp::clearConstYLoad_Change_Q()
 		p_vbus_need_to_changeQ[ibus]->clearConstYLoad_Change_Q();
 	}
 	p_vbus_need_to_changeQ.clear();	
+	p_vbus_changeQ_idx.clear();
 }
 
 /**
@@ -4219,6 +4248,7 @@ void gridpack::dynamic_simulation::DSFullApp::setConstYLoadtoZero_Q(int bus_numb
 		if (ret){
 			bapplyLoadChangeQ = true;
 			p_vbus_need_to_changeQ.push_back(bus);
+			p_vbus_changeQ_idx.push_back(vec_busintidx[ibus]);
 		}
 	}
 	
@@ -4256,56 +4286,94 @@ void gridpack::dynamic_simulation::DSFullApp::applyGeneratorTripping(int bus_num
 void gridpack::dynamic_simulation::DSFullApp::setLineTripAction
 (int brch_from_bus_number, int brch_to_bus_number, std::string branch_ckt){
 	
-	gridpack::utility::StringUtils util;
-	std::string clean_brkckt;
-	std::vector<int> vec_branchintidx;
-	vec_branchintidx = p_network->getLocalBranchIndices(brch_from_bus_number, brch_to_bus_number);
-	int ibr, nbr;
-	gridpack::dynamic_simulation::DSFullBranch *pbranch;	
-	nbr = vec_branchintidx.size();
-	//printf("----renke debug load shed, in dsf full app::setLineTripAction, there are %d branches from bus %d to bus %d \n", nbr, brch_from_bus_number, brch_to_bus_number);
-	for(ibr=0; ibr<nbr; ibr++){
-		pbranch = dynamic_cast<gridpack::dynamic_simulation::DSFullBranch*>
-			(p_network->getBranch(vec_branchintidx[ibr]).get());
-		//printf("----renke debug load shed, in dsf full app::setLineTripAction, from bus:, to bus:\n");
-		clean_brkckt = util.clean2Char(branch_ckt);
-		
-		if (pbranch->setBranchTripAction(clean_brkckt)){
-			p_vbranches_need_to_trip.push_back(pbranch);
-         bapplyLineTripAction = true;
-			break;		
-		}	
-	}			
+	bapplyLineTripAction = setLocalLineTripAction(brch_from_bus_number,
+	    brch_to_bus_number, branch_ckt) || bapplyLineTripAction;
    // Check to see if a line trip is occuring somewhere in the system
    bapplyLineTripAction = p_factory->checkTrueSomewhere(bapplyLineTripAction);
 }
 
+/**
+ * set trip actions for a batch of branches. This is equivalent to
+ * calling setLineTripAction for each branch but requires only one
+ * global check of whether any branch is tripped
+ * @param brch_from_bus_numbers from bus numbers of branches
+ * @param brch_to_bus_numbers to bus numbers of branches
+ * @param branch_ckts circuit IDs of branches
+ */
+void gridpack::dynamic_simulation::DSFullApp::setLineTripActions(
+    const std::vector<int> &brch_from_bus_numbers,
+    const std::vector<int> &brch_to_bus_numbers,
+    const std::vector<std::string> &branch_ckts)
+{
+  int i;
+  int nbr = brch_from_bus_numbers.size();
+  if (brch_to_bus_numbers.size() != nbr || branch_ckts.size() != nbr) {
+    printf("DSFullApp::setLineTripActions: inconsistent list sizes\n");
+    return;
+  }
+  for (i=0; i<nbr; i++) {
+    if (setLocalLineTripAction(brch_from_bus_numbers[i],
+          brch_to_bus_numbers[i], branch_ckts[i])) {
+      bapplyLineTripAction = true;
+    }
+  }
+  // Check to see if a line trip is occuring somewhere in the system
+  bapplyLineTripAction = p_factory->checkTrueSomewhere(bapplyLineTripAction);
+}
+
+/**
+ * set the trip action for a single branch on this processor without
+ * checking the other processors
+ * @param brch_from_bus_number from bus number of branch
+ * @param brch_to_bus_number to bus number of branch
+ * @param branch_ckt circuit ID of branch
+ * @return true if a branch was found and marked for tripping
+ */
+bool gridpack::dynamic_simulation::DSFullApp::setLocalLineTripAction(
+    int brch_from_bus_number, int brch_to_bus_number, std::string branch_ckt)
+{
+  gridpack::utility::StringUtils util;
+  std::string clean_brkckt = util.clean2Char(branch_ckt);
+  std::vector<int> vec_branchintidx;
+  vec_branchintidx = p_network->getLocalBranchIndices(brch_from_bus_number,
+      brch_to_bus_number);
+  int ibr, nbr;
+  gridpack::dynamic_simulation::DSFullBranch *pbranch;
+  nbr = vec_branchintidx.size();
+  for (ibr=0; ibr<nbr; ibr++) {
+    pbranch = dynamic_cast<gridpack::dynamic_simulation::DSFullBranch*>
+      (p_network->getBranch(vec_branchintidx[ibr]).get());
+    if (pbranch->setBranchTripAction(clean_brkckt)) {
+      p_vbranches_need_to_trip.push_back(pbranch);
+      p_vbranches_trip_idx.push_back(vec_branchintidx[ibr]);
+      return true;
+    }
+  }
+  return false;
+}
+
 // trip a branch, given a bus number, just find any one of the connected line(not transformer) with the bus, and trip that one
 void gridpack::dynamic_simulation::DSFullApp::setLineTripAction(int bus_number){
 	
 	std::vector<int> vec_busintidx;
 	vec_busintidx = p_network->getLocalBusIndices(bus_number);
 	int ibus, nbus;
-	gridpack::dynamic_simulation::DSFullBus *bus;	
 	nbus = vec_busintidx.size();
-	std::vector<boost::shared_ptr<gridpack::component::BaseComponent> > vec_nghbrs;
 	for(ibus=0; ibus<nbus; ibus++){
-		bus = dynamic_cast<gridpack::dynamic_simulation::DSFullBus*>
-			(p_network->getBus(vec_busintidx[ibus]).get());
 		//printf("----renke debug load shed, in dsf full app, \n");
 		
-		bus->getNeighborBranches(vec_nghbrs);
-		
 		int ibr, nbr;
-		nbr = vec_nghbrs.size();
+		nbr = p_network->numConnectedBranches(vec_busintidx[ibus]);
+		const int *nghbrs = p_network->connectedBranchList(vec_busintidx[ibus]);
 		gridpack::dynamic_simulation::DSFullBranch *pbranch;
 		for (ibr=0; ibr<nbr; ibr++){
 			
 			pbranch = dynamic_cast<gridpack::dynamic_simulation::DSFullBranch*>
-			(vec_nghbrs[ibr].get());
+			(p_network->getBranch(nghbrs[ibr]).get());
 			
 			if (pbranch->setBranchTripAction()){ // if the branch is a non-xmfr branch
 				p_vbranches_need_to_trip.push_back(pbranch);
+				p_vbranches_trip_idx.push_back(nghbrs[ibr]);
             bapplyLineTripAction = true;
 				break;
 				
@@ -4316,6 +4384,138 @@ void gridpack::dynamic_simulation::DSFullApp::setLineTripAction(int bus_number){
    bapplyLineTripAction = p_factory->checkTrueSomewhere(bapplyLineTripAction);
 }
 
+/**
+ * apply all pending line trip actions and constant Y load changes to
+ * the Y-matrix. Only the entries of the buses and branches that changed
+ * are evaluated and the sparsity pattern of the Y-matrix is unchanged,
+ * so the linear solver only needs a numeric refactorization. The pending
+ * actions are cleared afterwards
+ */
+void gridpack::dynamic_simulation::DSFullApp::applyYbusChanges()
+{
+  // in the current code, solver_posfy_sptr is linked with ybus
+  std::vector<int> no_branches;
+  if (bapplyLineTripAction) {
+    // a tripped branch changes its own off-diagonal entries and the
+    // diagonal entries of both of its end buses
+    std::vector<int> buses;
+    int ibr, nbr, bus1, bus2;
+    nbr = p_vbranches_trip_idx.size();
+    for (ibr=0; ibr<nbr; ibr++) {
+      p_network->getBranchEndpoints(p_vbranches_trip_idx[ibr], &bus1, &bus2);
+      buses.push_back(bus1);
+      buses.push_back(bus2);
+    }
+    std::sort(buses.begin(), buses.end());
+    buses.erase(std::unique(buses.begin(), buses.end()), buses.end());
+    p_factory->setMode(branch_trip_action);
+    ybusMap_sptr->incrementMatrix(ybus, buses, p_vbranches_trip_idx);
+    // after Y-matrix is modified, we need to clear this line trip action to 
+    // avoid next step still apply the same line trip action
+    clearLineTripAction();
+    // a line trip may have split the network
+    checkIslands();
+  }
+  bapplyLineTripAction = false;
+
+  if (bapplyLoadChangeP) {
+    p_factory->setMode(bus_Yload_change_P);
+    ybusMap_sptr->incrementMatrix(ybus, p_vbus_changeP_idx, no_branches);
+    clearConstYLoad_Change_P();
+  }
+  bapplyLoadChangeP = false;
+
+  if (bapplyLoadChangeQ) {
+    p_factory->setMode(bus_Yload_change_Q);
+    ybusMap_sptr->incrementMatrix(ybus, p_vbus_changeQ_idx, no_branches);
+    clearConstYLoad_Change_Q();
+  }
+  bapplyLoadChangeQ = false;
+}
+
+/**
+ * @return Y-matrix used in the network solution. Pending line trips and
+ * load changes are included once applyYbusChanges has been called
+ */
+boost::shared_ptr<gridpack::math::Matrix>
+gridpack::dynamic_simulation::DSFullApp::getYbus()
+{
+  return ybus;
+}
+
+/**
+ * check whether the branches that are in service split the network into
+ * islands. Islands without generators that are in service are dropped
+ * from the network solution: the Y-matrix rows of their buses are
+ * replaced by the identity so that the voltages on these buses are zero
+ * and the rest of the system is solved as before
+ * @return number of islands with generation
+ */
+int gridpack::dynamic_simulation::DSFullApp::checkIslands()
+{
+  int nbus = p_network->numBuses();
+  int nbranch = p_network->numBranches();
+  int i, j;
+  std::vector<bool> inService(nbranch);
+  for (i=0; i<nbranch; i++) {
+    std::vector<bool> status = p_network->getBranch(i)->getLineStatus();
+    inService[i] = false;
+    for (j=0; j<status.size(); j++) {
+      if (status[j]) inService[i] = true;
+    }
+  }
+  std::vector<int> island;
+  int nisland = p_network->findIslands(inService, island);
+  if (nisland < 2) return nisland;
+
+  // Count buses and generators in each island
+  std::vector<int> nisl_bus(nisland,0), nisl_gen(nisland,0);
+  for (i=0; i<nbus; i++) {
+    if (!p_network->getActiveBus(i)) continue;
+    gridpack::dynamic_simulation::DSFullBus *bus = p_network->getBus(i).get();
+    if (bus->isIsolated()) continue;
+    nisl_bus[island[i]]++;
+    nisl_gen[island[i]] += bus->getNumActiveGen();
+  }
+  p_network->communicator().sum(&nisl_bus[0],nisland);
+  p_network->communicator().sum(&nisl_gen[0],nisland);
+
+  // Mark buses in islands without generation. Relay trips increment the
+  // entries of buses that were dropped earlier, so the rows of all
+  // dropped buses are overwritten, in every Y-matrix that is in use
+  std::vector<int> buses, branches;
+  for (i=0; i<nbus; i++) {
+    gridpack::dynamic_simulation::DSFullBus *bus = p_network->getBus(i).get();
+    if (nisl_gen[island[i]] == 0) bus->setDeadIsland(true);
+    if (bus->getDeadIsland()) {
+      buses.push_back(i);
+      int nbr = p_network->numConnectedBranches(i);
+      const int *brlist = p_network->connectedBranchList(i);
+      for (j=0; j<nbr; j++) branches.push_back(brlist[j]);
+    }
+  }
+  std::sort(branches.begin(), branches.end());
+  branches.erase(std::unique(branches.begin(), branches.end()), branches.end());
+  p_factory->setMode(island_drop);
+  ybusMap_sptr->overwriteMatrix(ybus, buses, branches);
+  if (ybus_fy) ybusMap_sptr->overwriteMatrix(ybus_fy, buses, branches);
+  if (ybus_posfy) ybusMap_sptr->overwriteMatrix(ybus_posfy, buses, branches);
+
+  int nlive = 0;
+  for (i=0; i<nisland; i++) {
+    if (nisl_gen[i] > 0) nlive++;
+  }
+  if (p_network->communicator().rank() == 0) {
+    for (i=0; i<nisland; i++) {
+      if (nisl_gen[i] == 0 && nisl_bus[i] > 0) {
+        printf("DSFull_APP: island with %d buses has no generation and is"
+            " dropped from the network solution\n",nisl_bus[i]);
+      }
+    }
+  }
+  return nlive;
+}
+
 /**
  * clear all the necessery flags for the all buses and branches for the lines needs to trip
  * this function is for all the branches' flags clear-up, just need to be called
@@ -4331,6 +4531,7 @@ void gridpack::dynamic_simulation::DSFullApp::clearLineTripAction()
 		p_vbranches_need_to_trip[ibr]->clearBranchTripAction();
 	}
 	p_vbranches_need_to_trip.clear();	
+	p_vbranches_trip_idx.clear();
 }
 
 /**
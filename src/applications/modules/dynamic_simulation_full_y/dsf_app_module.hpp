@@ -21,9 +21,11 @@
 #include "gridpack/component/base_component.hpp"
 #include "gridpack/configuration/configuration.hpp"
 #include "gridpack/parallel/global_vector.hpp"
+#include "gridpack/parallel/reduction_batch.hpp"
 #include "gridpack/serial_io/serial_io.hpp"
 #include "gridpack/applications/modules/powerflow/pf_app_module.hpp"
 #include "dsf_factory.hpp"
+#include "dsf_recorder.hpp"
 #include "gridpack/mapper/full_map.hpp"
 #include "gridpack/mapper/bus_vector_map.hpp"
 #include "gridpack/math/math.hpp"
@@ -256,6 +258,43 @@ class DSFullApp
 	* multiple times for multiple line tripping 
 	*/
 	void setLineTripAction(int bus_number);
+
+	/**
+	* set trip actions for a batch of branches. This is equivalent to
+	* calling setLineTripAction for each branch but requires only one
+	* global check of whether any branch is tripped
+	* @param brch_from_bus_numbers from bus numbers of branches
+	* @param brch_to_bus_numbers to bus numbers of branches
+	* @param branch_ckts circuit IDs of branches
+	*/
+	void setLineTripActions(const std::vector<int> &brch_from_bus_numbers,
+	    const std::vector<int> &brch_to_bus_numbers,
+	    const std::vector<std::string> &branch_ckts);
+
+	/**
+	* apply all pending line trip actions and constant Y load changes to
+	* the Y-matrix. Only the entries of the buses and branches that changed
+	* are evaluated and the sparsity pattern of the Y-matrix is unchanged,
+	* so the linear solver only needs a numeric refactorization. The pending
+	* actions are cleared afterwards
+	*/
+	void applyYbusChanges();
+
+	/**
+	* @return Y-matrix used in the network solution. Pending line trips
+	* and load changes are included once applyYbusChanges has been called
+	*/
+	boost::shared_ptr<gridpack::math::Matrix> getYbus();
+
+	/**
+	* check whether the branches that are in service split the network into
+	* islands. Islands without generators that are in service are dropped
+	* from the network solution: the Y-matrix rows of their buses are
+	* replaced by the identity so that the voltages on these buses are zero
+	* and the rest of the system is solved as before
+	* @return number of islands with generation
+	*/
+	int checkIslands();
 	
 	/**
 	* clear all the necessery flags for the all buses and branches for the lines needs to trip
@@ -360,6 +399,26 @@ class DSFullApp
      */
     std::vector<std::vector<double> > getGeneratorTimeSeries();
 
+    /**
+     * Set options for recording time series data. These must be set before
+     * the generator watch list is read in
+     * @param decimation record values every decimation time steps
+     * @param filename name of binary file that recorded values are written
+     *        to. If empty, values are kept in memory. If more than one
+     *        processor is used, the processor rank is appended to the name
+     * @param chunk number of steps held in memory before they are written
+     *        to the binary file
+     */
+    void setTimeSeriesOptions(int decimation, std::string filename = "",
+        int chunk = 1000);
+
+    /**
+     * Return recorder holding time series data for watched generators on
+     * this processor. Values are stored in contiguous arrays for each signal
+     * @return time series recorder
+     */
+    const TimeSeriesRecorder& getTimeSeriesRecorder();
+
     /**
      * Return a list of original bus IDs and tags for all monitored
      * generators
@@ -445,6 +504,34 @@ class DSFullApp
      */
     void setFrequencyMonitoring(bool flag, double maxFreq);
 
+    /**
+     * Set parameters for terminating a simulation as soon as its outcome is
+     * known. A simulation is classified as insecure as soon as the spread of
+     * rotor angles on watched generators exceeds the angle limit and is
+     * classified as secure once the frequency deviation on watched generators
+     * has stayed inside the frequency band (and all bus voltages have stayed
+     * above the minimum voltage) for the settling time after the fault has
+     * been cleared.
+     * @param flag true if early termination is turned on
+     * @param band maximum frequency deviation (Hz) for a settled system
+     * @param settle time (seconds) that system must remain settled
+     * @param angle maximum separation (degrees) of rotor angles
+     * @param vmin minimum bus voltage (p.u.) for a settled system
+     */
+    void setEarlyTermination(bool flag, double band = 0.05,
+        double settle = 2.0, double angle = 180.0, double vmin = 0.0);
+
+    /**
+     * @return true if last simulation was terminated before the end time
+     */
+    bool terminatedEarly();
+
+    /**
+     * @return time at which last simulation was terminated. If simulation
+     * ran to completion, this returns -1
+     */
+    double terminationTime();
+
     /**
      * Get observations and store them internally
      * @param cursor configuration pointer to observation block
@@ -636,6 +723,47 @@ class DSFullApp
     */
     double getCurrentTime();
 
+    /**
+     * Integrate from the current time to a later time using a fixed time
+     * step. Events are handled as in run, but progress is not written to
+     * standard output. The time step of the application is not changed
+     * @param tend time at end of integration. The interval to tend
+     *        should be a multiple of the time step
+     * @param step time step used for integration
+     */
+    void advance(double tend, double step);
+
+    /**
+     * Get the dynamic state of the whole system. The state vector contains
+     * the voltage and frequency of each bus at the current and previous
+     * time step and the states of all dynamic models that provide access
+     * to their states, ordered by original bus index. The vector is
+     * replicated on all processors and has the same layout for any
+     * partition of the network. This is a collective operation
+     * @param x state vector
+     */
+    void getSystemState(std::vector<double> &x);
+
+    /**
+     * Check whether the state of every active dynamic model can be
+     * accessed, so that getSystemState captures the complete state of the
+     * system. This is a collective operation
+     * @return number of active models that do not provide access to their
+     *         states
+     */
+    int numHiddenStateDevices();
+
+    /**
+     * Overwrite the dynamic state of the whole system with a vector
+     * obtained from getSystemState on an application that uses the same
+     * network and events and set the current time. Integration continues
+     * from this state with the next call to advance or run. This is a
+     * collective operation
+     * @param x state vector
+     * @param time current time
+     */
+    void setSystemState(const std::vector<double> &x, double time);
+
   /**
    * Transfer data from power flow to dynamic simulation
    * @param pf_network power flow network
@@ -771,6 +899,13 @@ class DSFullApp
   */
   void getCurrent(int predcorrflag);
 
+  /**
+   * Find location of each local bus in the system state vector
+   * @param offset offset of each local bus in state vector
+   * @return length of state vector
+   */
+  int systemStateLayout(std::vector<int> &offset);
+
   /*
     Solve Network equations
     predcorrflag = 0 => Predictor stage
@@ -812,8 +947,9 @@ class DSFullApp
 
     /**
      * Save time series data for watched generators
+     * @param time current value of time
      */
-    void saveTimeStep();
+    void saveTimeStep(double time);
 
     /**
      * Check to see if frequency variations on monitored generators are okay
@@ -830,6 +966,53 @@ class DSFullApp
      */
     bool checkFrequency(double limit);
 
+    /**
+     * Check to see if outcome of simulation is certain so that simulation
+     * can be stopped
+     * @param time current value of time
+     * @return true if simulation can be terminated
+     */
+    bool checkEarlyTermination(double time);
+
+    /**
+     * Evaluate the reduced quantities used to check for early termination
+     * @param time time at which quantities were sampled
+     * @return true if simulation can be terminated
+     */
+    bool evaluateEarlyTermination(double time);
+
+    /**
+     * set the trip action for a single branch on this processor without
+     * checking the other processors
+     * @param brch_from_bus_number from bus number of branch
+     * @param brch_to_bus_number to bus number of branch
+     * @param branch_ckt circuit ID of branch
+     * @return true if a branch was found and marked for tripping
+     */
+    bool setLocalLineTripAction(int brch_from_bus_number,
+        int brch_to_bus_number, std::string branch_ckt);
+
+    /**
+     * Construct a fixed plan for gathering the values of observations
+     */
+    void compileObservationPlan();
+
+    /**
+     * Evaluate all observations using the plan created in setObservations
+     * and copy them to all processors
+     */
+    void gatherObservations();
+
+    /**
+     * Copy values of observations of one type, leaving out observations
+     * that do not correspond to elements in the network
+     * @param type index of observation type in p_obs_offset
+     * @param active flags indicating which observations exist
+     * @param vals values of observations
+     */
+    void copyObservations(int type, const std::vector<int> &active,
+        std::vector<double> &vals);
+
     /**
      * Get a list of unique zones in the system
      * @param zones a complete list of all zones in the network
@@ -1043,6 +1226,12 @@ class DSFullApp
 	std::vector<gridpack::dynamic_simulation::DSFullBus*> p_vbus_need_to_changeP;
 	std::vector<gridpack::dynamic_simulation::DSFullBus*>p_vbus_need_to_changeQ;
 
+	//local indices of the branches and buses in the vectors above, used to
+	//update only the affected Y-matrix entries
+	std::vector<int> p_vbranches_trip_idx;
+	std::vector<int> p_vbus_changeP_idx;
+	std::vector<int> p_vbus_changeQ_idx;
+
 
     // Monitor generators for instability
     bool p_monitorGenerators;
@@ -1071,14 +1260,42 @@ class DSFullApp
    // Keep track of whether or not systsem is secure
    int p_insecureAt;
 
+   // Parameters for terminating simulation once outcome is known
+   bool p_earlyTermination;
+   double p_etFrequencyBand;
+   double p_etSettleTime;
+   double p_etAngleLimit;
+   double p_etMinVoltage;
+
+   // Time at which fault is cleared and time at which system became settled
+   double p_etFaultEnd;
+   double p_etSettleStart;
+
+   // Batched reduction of monitored quantities. The reduction started at
+   // one step is completed at the next step
+   boost::shared_ptr<gridpack::parallel::ReductionBatch> p_etBatch;
+   int p_etIdx[5];
+   double p_etPendingTime;
+
+   // Time at which simulation was terminated early
+   double p_terminatedAt;
+
    // Global list of all generators that are being watched
    std::map<std::pair<int,std::string>, int> p_watch_list;
 
    // Flag to save time series
    bool p_save_time_series;
 
-   // Vector of times series from watched generators
-   std::vector<std::vector<double> > p_time_series;
+   // Recorder for times series from watched generators
+   TimeSeriesRecorder p_recorder;
+
+   // Location in global watch list of each generator in recorder
+   std::vector<int> p_recorder_idx;
+
+   // Options for time series recorder
+   int p_ts_decimation;
+   std::string p_ts_filename;
+   int p_ts_chunk;
 
    // Record bus ID where frequency violation occured
    std::vector<int> p_violations;
@@ -1121,14 +1338,29 @@ class DSFullApp
    std::vector<int> p_obs_vActivefreq;
    std::vector<int> p_obs_vUsefreq;
 
-   boost::shared_ptr<gridpack::parallel::GlobalVector<double> > p_obs_vMag;
-   boost::shared_ptr<gridpack::parallel::GlobalVector<double> > p_obs_vAng;
-   boost::shared_ptr<gridpack::parallel::GlobalVector<double> > p_obs_vBusfreqVal;
-   boost::shared_ptr<gridpack::parallel::GlobalVector<double> > p_obs_rSpd;
-   boost::shared_ptr<gridpack::parallel::GlobalVector<double> > p_obs_rAng;
-   boost::shared_ptr<gridpack::parallel::GlobalVector<double> > p_obs_genP;
-   boost::shared_ptr<gridpack::parallel::GlobalVector<double> > p_obs_genQ;
-   boost::shared_ptr<gridpack::parallel::GlobalVector<double> > p_obs_fOnline;
+   // Plan for evaluating observations. Pointers are NULL for observations
+   // that do not correspond to an existing element
+   std::vector<DSFullBus*> p_obs_genPtr;
+   std::vector<int> p_obs_genSlot;
+   std::vector<DSFullBus*> p_obs_loadPtr;
+   std::vector<int> p_obs_loadSlot;
+   std::vector<DSFullBus*> p_obs_vPtr;
+   std::vector<DSFullBus*> p_obs_vPtrfreq;
+
+   // Buffers for exchanging observations. p_obs_recvMap is the location in
+   // p_obs_values of each value in p_obs_recvBuf
+   std::vector<double> p_obs_sendBuf;
+   std::vector<double> p_obs_recvBuf;
+   std::vector<int> p_obs_recvCounts;
+   std::vector<int> p_obs_recvDispls;
+   std::vector<int> p_obs_recvMap;
+
+   // Values of all observations, stored as rotor speed, rotor angle,
+   // generator real and reactive power, online load fraction, voltage
+   // magnitude, voltage angle and bus frequency. p_obs_offset is the start
+   // of each block
+   std::vector<double> p_obs_values;
+   int p_obs_offset[8];
    
    // below are all variables originally defined the solve function, now define them as class private members
    boost::shared_ptr < gridpack::mapper::FullMatrixMap<DSFullNetwork> > ybusMap_sptr;  
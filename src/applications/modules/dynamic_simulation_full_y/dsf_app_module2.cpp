@@ -2,6 +2,7 @@
 #include <iostream>
 #include <string>
 #include <vector>
+#include <algorithm>
 #include "gridpack/utilities/string_utils.hpp"
 
 /*
@@ -44,6 +45,154 @@ double gridpack::dynamic_simulation::DSFullApp::getCurrentTime()
   return p_current_time;
 }
 
+/**
+ * Integrate from the current time to a later time using a fixed time
+ * step. Events are handled as in run, but progress is not written to
+ * standard output. The time step of the application is not changed
+ * @param tend time at end of integration. The interval to tend should be
+ *        a multiple of the time step
+ * @param step time step used for integration
+ */
+void gridpack::dynamic_simulation::DSFullApp::advance(double tend,
+    double step)
+{
+  double save_step = p_time_step;
+  p_time_step = step;
+  int nsteps = static_cast<int>((tend - p_current_time)/step + 0.5);
+  int i;
+  for (i=0; i<nsteps; i++) {
+    handleEvents();
+    runonestep();
+  }
+  // remove round-off accumulated over the steps
+  if (nsteps > 0) p_current_time = tend;
+  p_time_step = save_step;
+}
+
+/**
+ * Find location of each local bus in the system state vector
+ * @param offset offset of each local bus in state vector
+ * @return length of state vector
+ */
+int gridpack::dynamic_simulation::DSFullApp::systemStateLayout(
+    std::vector<int> &offset)
+{
+  int nbus = p_network->numBuses();
+  int ntot = p_network->totalBuses();
+  int i;
+  // collect original index and number of states of all buses
+  std::vector<int> orig(ntot,0);
+  std::vector<int> nstates(ntot,0);
+  for (i=0; i<nbus; i++) {
+    if (!p_network->getActiveBus(i)) continue;
+    int g = p_network->getGlobalBusIndex(i);
+    orig[g] = p_network->getOriginalBusIndex(i);
+    nstates[g] = dynamic_cast<DSFullBus*>(p_network->getBus(i).get())
+      ->numDynamicStates();
+  }
+  if (ntot > 0) {
+    p_comm.sum(&orig[0],ntot);
+    p_comm.sum(&nstates[0],ntot);
+  }
+  // order buses by original index so that the layout does not depend on
+  // how the network is partitioned
+  std::vector<std::pair<int,int> > order(ntot);
+  for (i=0; i<ntot; i++) order[i] = std::pair<int,int>(orig[i],i);
+  std::sort(order.begin(),order.end());
+  std::vector<int> goffset(ntot);
+  int size = 0;
+  for (i=0; i<ntot; i++) {
+    goffset[order[i].second] = size;
+    size += nstates[order[i].second];
+  }
+  offset.resize(nbus);
+  for (i=0; i<nbus; i++) {
+    offset[i] = goffset[p_network->getGlobalBusIndex(i)];
+  }
+  return size;
+}
+
+/**
+ * Get the dynamic state of the whole system. The state vector contains the
+ * voltage and frequency of each bus at the current and previous time step
+ * and the states of all dynamic models that provide access to their
+ * states, ordered by original bus index. The vector is replicated on all
+ * processors and has the same layout for any partition of the network.
+ * This is a collective operation
+ * @param x state vector
+ */
+void gridpack::dynamic_simulation::DSFullApp::getSystemState(
+    std::vector<double> &x)
+{
+  std::vector<int> offset;
+  int size = systemStateLayout(offset);
+  x.assign(size,0.0);
+  int nbus = p_network->numBuses();
+  int i;
+  for (i=0; i<nbus; i++) {
+    if (!p_network->getActiveBus(i)) continue;
+    dynamic_cast<DSFullBus*>(p_network->getBus(i).get())
+      ->getDynamicState(&x[offset[i]]);
+  }
+  if (size > 0) p_comm.sum(&x[0],size);
+}
+
+/**
+ * Check whether the state of every active dynamic model can be accessed,
+ * so that getSystemState captures the complete state of the system. This
+ * is a collective operation
+ * @return number of active models that do not provide access to their
+ *         states
+ */
+int gridpack::dynamic_simulation::DSFullApp::numHiddenStateDevices()
+{
+  int nbus = p_network->numBuses();
+  int i;
+  int ndev = 0;
+  for (i=0; i<nbus; i++) {
+    if (!p_network->getActiveBus(i)) continue;
+    ndev += dynamic_cast<DSFullBus*>(p_network->getBus(i).get())
+      ->numHiddenStateDevices();
+  }
+  p_comm.sum(&ndev,1);
+  return ndev;
+}
+
+/**
+ * Overwrite the dynamic state of the whole system with a vector obtained
+ * from getSystemState on an application that uses the same network and
+ * events and set the current time. Integration continues from this state
+ * with the next call to advance or run. This is a collective operation
+ * @param x state vector
+ * @param time current time
+ */
+void gridpack::dynamic_simulation::DSFullApp::setSystemState(
+    const std::vector<double> &x, double time)
+{
+  std::vector<int> offset;
+  int size = systemStateLayout(offset);
+  if (size != x.size()) {
+    if (p_comm.rank() == 0) {
+      printf("setSystemState: state vector has length %d, expected %d\n",
+          static_cast<int>(x.size()),size);
+    }
+    return;
+  }
+  // ghost buses are set as well so that no update is needed before the
+  // next network solution
+  int nbus = p_network->numBuses();
+  int i;
+  for (i=0; i<nbus; i++) {
+    dynamic_cast<DSFullBus*>(p_network->getBus(i).get())
+      ->setDynamicState(&x[offset[i]]);
+  }
+  p_current_time = time;
+  // the next step is not treated as the first step of the simulation
+  Simu_Current_Step = static_cast<int>(time/p_time_step + 0.5);
+  if (Simu_Current_Step < 1) Simu_Current_Step = 1;
+  last_S_Steps = S_Steps = Simu_Current_Step - 1;
+}
+
 /**
  * Reset data structures
  */
@@ -320,7 +469,7 @@ void gridpack::dynamic_simulation::DSFullApp::runonestep()
       if (p_loadWatch) p_loadIO->header("\n");
     }
   }
-  saveTimeStep();
+  saveTimeStep(p_current_time);
   
   //  if ((!p_factory->securityCheck()) && p_insecureAt == -1)  
   //    p_insecureAt = Simu_Current_Step;
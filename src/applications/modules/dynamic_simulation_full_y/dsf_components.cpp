@@ -25,6 +25,7 @@ gridpack::dynamic_simulation::DSFullBus::DSFullBus(void)
   p_bfault = 0.0;
   p_mode = YBUS;
   setReferenceBus(false);
+  p_dead_island = false;
   p_ngen = 0;
   p_negngen = 0;
   p_ngen_nodynmodel = 0;
@@ -48,6 +49,8 @@ gridpack::dynamic_simulation::DSFullBus::DSFullBus(void)
   p_busrelaytripflag = false; 
   p_branch = NULL;
   p_isolated = false;
+  p_ss_nstates = 0;
+  p_ss_shift = 0.0;
   p_busvolfreq = 60.0; //renke add
   pbusvolfreq_old = 60.0; //renke add
   bcomputefreq = false;  //renke add
@@ -185,8 +188,12 @@ bool gridpack::dynamic_simulation::DSFullBus::matrixDiagSize(int *isize, int *js
   if (YMBus::isIsolated()) return false;
   if (p_mode == YBUS || p_mode == YL || p_mode == PG || p_mode == YDYNLOAD || p_mode == onFY || p_mode == posFY
   || p_mode == jxd || p_mode == bus_relay || p_mode == branch_relay || p_mode == branch_trip_action
-  || p_mode == bus_Yload_change_P || p_mode == bus_Yload_change_Q) {
+  || p_mode == bus_Yload_change_P || p_mode == bus_Yload_change_Q
+  || p_mode == island_drop) {
     return YMBus::matrixDiagSize(isize,jsize);
+  } else if (p_mode == SMALL_SIGNAL) {
+    *isize = p_ss_nstates+2;
+    *jsize = p_ss_nstates+2;
   }  else {
     *isize = 1;
     *jsize = 1;
@@ -256,6 +263,20 @@ bool gridpack::dynamic_simulation::DSFullBus::matrixDiagValues(ComplexType *valu
       }
     }
     return true;
+  } else if (p_mode == SMALL_SIGNAL) {
+    int n = p_ss_nstates+2;
+    int i;
+    for (i=0; i<n*n; i++) values[i] = p_ss_jac[i];
+    for (i=0; i<p_ss_nstates; i++) values[i*n+i] -= p_ss_shift;
+    // subtract Yii*V from the current balance, split into real and
+    // imaginary parts
+    int ir = p_ss_nstates;
+    int ii = p_ss_nstates+1;
+    values[ir*n+ir] -= p_ybusr;
+    values[ii*n+ir] += p_ybusi;
+    values[ir*n+ii] -= p_ybusi;
+    values[ii*n+ii] -= p_ybusr;
+    return true;
   } else if (p_mode == jxd) {
     if (p_ngen > 0) {
       for (int i = 0; i < p_ngen; i++) {
@@ -364,6 +385,13 @@ bool gridpack::dynamic_simulation::DSFullBus::matrixDiagValues(ComplexType *valu
     } else {
       return false;
     }
+  } else if (p_mode == island_drop) {
+    if (p_dead_island) {
+      values[0] = 1.0;
+      return true;
+    } else {
+      return false;
+    }
   } else if (p_mode == bus_relay) {
       if (p_busrelaytripflag) {
       gridpack::ComplexType u(p_ybusr, p_ybusi);
@@ -443,6 +471,9 @@ bool gridpack::dynamic_simulation::DSFullBus::vectorSize(int *size) const
   if (!p_isolated) {
     if (p_mode == make_INorton_full) {
       *size = 1;
+    } else if (p_mode == SMALL_SIGNAL) {
+      if (YMBus::isIsolated()) return false;
+      *size = p_ss_nstates+2;
     }else {
       *size = 2;
     }
@@ -463,6 +494,8 @@ bool gridpack::dynamic_simulation::DSFullBus::vectorValues(ComplexType *values)
   if (!p_isolated) {
     if (p_mode == make_INorton_full) {
       values[0] = 0;
+      // buses in islands without generation carry no current
+      if (p_dead_island) return true;
       if (p_ngen > 0) {
         for (int i = 0; i < p_ngen; i++) {
 	  if(!p_gstatus[i] || !p_generators.size()) continue;
@@ -584,6 +617,13 @@ bool gridpack::dynamic_simulation::DSFullBus::vectorValues(ComplexType *values)
 	  
       //printf("bus id = %d, values[0] = %f, %f\n", getOriginalIndex(), real(values[0]), imag(values[0])); 
       return true;
+    } else if (p_mode == SMALL_SIGNAL) {
+      // mask that selects the state entries of a small signal vector
+      int i;
+      for (i=0; i<p_ss_nstates; i++) values[i] = 1.0;
+      values[p_ss_nstates] = 0.0;
+      values[p_ss_nstates+1] = 0.0;
+      return true;
     } else {
       return false;
     }  // if mode == make Inorton
@@ -597,6 +637,9 @@ void gridpack::dynamic_simulation::DSFullBus::setValues(ComplexType *values)
   if (p_mode == make_INorton_full) {
 	p_volt_full_old = p_volt_full; //renke add  
     p_volt_full = values[0];
+  } else if (p_mode == SMALL_SIGNAL) {
+    p_ss_vector.resize(p_ss_nstates+2);
+    for (i=0; i<p_ss_nstates+2; i++) p_ss_vector[i] = values[i];
   }
 }
 
@@ -2052,6 +2095,39 @@ int gridpack::dynamic_simulation::DSFullBus::getNumGen(void)
   return p_ngen;
 }
 
+/**
+ * Return the number of generators on this bus that are in service
+ * @return number of generators in service
+ */
+int gridpack::dynamic_simulation::DSFullBus::getNumActiveGen(void)
+{
+  int ret = 0;
+  int i;
+  for (i=0; i<p_ngen; i++) {
+    if (p_gstatus[i]) ret++;
+  }
+  return ret;
+}
+
+/**
+ * Mark bus as part of an island without generation. In island_drop mode
+ * the diagonal Y-matrix element of the bus is replaced by 1 and the
+ * branches connected to it do not contribute
+ * @param flag true if bus is in a dead island
+ */
+void gridpack::dynamic_simulation::DSFullBus::setDeadIsland(bool flag)
+{
+  p_dead_island = flag;
+}
+
+/**
+ * @return true if bus is part of an island without generation
+ */
+bool gridpack::dynamic_simulation::DSFullBus::getDeadIsland(void) const
+{
+  return p_dead_island;
+}
+
 void gridpack::dynamic_simulation::DSFullBus::setIFunc(void)
 {
 }
@@ -2716,6 +2792,41 @@ bool gridpack::dynamic_simulation::DSFullBus::checkFrequency(double limit)
   return ret;
 }
 
+/**
+ * Get largest frequency deviation and range of rotor angles for watched
+ * generators on this bus
+ * @param fdev largest absolute deviation of frequency from 60 Hz
+ * @param amin smallest rotor angle (radians)
+ * @param amax largest rotor angle (radians)
+ * @return false if there are no watched generators on bus
+ */
+bool gridpack::dynamic_simulation::DSFullBus::getWatchedExtrema(double *fdev,
+    double *amin, double *amax)
+{
+  bool ret = false;
+  *fdev = 0.0;
+  *amin = 0.0;
+  *amax = 0.0;
+  int i;
+  for (i=0; i<p_genid.size(); i++) {
+    if (p_generators[i]->getWatch()) {
+      std::vector<double> vals;
+      p_generators[i]->getWatchValues(vals);
+      if (vals.size() < 2) continue;
+      double dev = fabs(60.0*vals[1]-60.0);
+      if (!ret) {
+        *amin = vals[0];
+        *amax = vals[0];
+      }
+      if (dev > *fdev) *fdev = dev;
+      if (vals[0] < *amin) *amin = vals[0];
+      if (vals[0] > *amax) *amax = vals[0];
+      ret = true;
+    }
+  }
+  return ret;
+}
+
 /**
  * Scale value of real power on all generators
  * @param character ID for generator
@@ -3185,6 +3296,363 @@ void gridpack::dynamic_simulation::DSFullBus::diagValuesInsertForLineStatusChang
   p_yii = Ybr_self;
 }
 
+/**
+ * Linearize the dynamic models on the bus around the current operating
+ * point for small signal analysis
+ * @param delta perturbation used for finite differences
+ * @param h time increment used to evaluate state derivatives with the
+ *        model predictors
+ * @param report print a warning for each model that is held constant
+ * @return false if some models on the bus could not be linearized
+ */
+bool gridpack::dynamic_simulation::DSFullBus::linearize(double delta, double h,
+    bool report)
+{
+  bool ret = true;
+  int i, j, k;
+  p_ss_nstates = 0;
+  p_ss_slot_gen.clear();
+  p_ss_slot_device.clear();
+  p_ss_slot_offset.clear();
+  p_ss_gen.clear();
+  p_ss_device.clear();
+  p_ss_index.clear();
+  p_ss_vector.clear();
+  p_ss_shift = 0.0;
+  p_ss_active.assign(p_ngen,false);
+  p_ss_jac.assign(4,0.0);
+  if (YMBus::isIsolated()) return ret;
+
+  // find devices that provide access to their states
+  int nx = 0;
+  p_ss_slot_offset.push_back(0);
+  for (i=0; i<p_ngen; i++) {
+    if (!p_gstatus[i] || !p_generators.size() || p_gen_nodynmodel[i])
+      continue;
+    if (!p_generators[i]->getGenStatus()) continue;
+    for (k=0; k<4; k++) {
+      int ns = smallSignalDevice(i,k,0,NULL);
+      if (ns < 0) {
+        if (report) {
+          printf("Warning: dynamic model %d of generator %s on bus %d does"
+              " not support small signal analysis and is held constant\n",k,
+              p_genid[i].c_str(),getOriginalIndex());
+        }
+        ret = false;
+        if (k == 0) break;
+      } else if (ns > 0) {
+        p_ss_active[i] = true;
+        p_ss_slot_gen.push_back(i);
+        p_ss_slot_device.push_back(k);
+        nx += ns;
+        p_ss_slot_offset.push_back(nx);
+      }
+    }
+  }
+  if (p_ndyn_load > 0) {
+    if (report) {
+      printf("Warning: dynamic loads on bus %d are held constant in small"
+          " signal analysis\n",getOriginalIndex());
+    }
+    ret = false;
+  }
+
+  // evaluate derivatives by central differences
+  int nslot = p_ss_slot_gen.size();
+  int n = nx+2;
+  std::vector<double> x0(nx+1), x(nx+1), f0(n), fp(n), fm(n), jac(n*n);
+  for (k=0; k<nslot; k++) {
+    smallSignalDevice(p_ss_slot_gen[k],p_ss_slot_device[k],1,
+        &x0[p_ss_slot_offset[k]]);
+  }
+  gridpack::ComplexType v0(p_voltage*cos(p_angle),p_voltage*sin(p_angle));
+  for (j=0; j<n; j++) {
+    gridpack::ComplexType v = v0;
+    for (i=0; i<nx; i++) x[i] = x0[i];
+    if (j < nx) {
+      x[j] = x0[j]+delta;
+    } else if (j == nx) {
+      v = v0 + gridpack::ComplexType(delta,0.0);
+    } else {
+      v = v0 + gridpack::ComplexType(0.0,delta);
+    }
+    smallSignalResidual(&x[0],v,h,&fp[0]);
+    if (j < nx) {
+      x[j] = x0[j]-delta;
+    } else if (j == nx) {
+      v = v0 - gridpack::ComplexType(delta,0.0);
+    } else {
+      v = v0 - gridpack::ComplexType(0.0,delta);
+    }
+    smallSignalResidual(&x[0],v,h,&fm[0]);
+    for (i=0; i<n; i++) jac[j*n+i] = (fp[i]-fm[i])/(2.0*delta);
+  }
+  // restore operating point
+  smallSignalResidual(&x0[0],v0,h,&f0[0]);
+
+  // states with vanishing derivatives are not updated by the generator
+  // model (e.g. a stabilizer that is not evaluated by the machine) and
+  // are dropped from the system
+  std::vector<int> keep;
+  for (k=0; k<nslot; k++) {
+    for (i=p_ss_slot_offset[k]; i<p_ss_slot_offset[k+1]; i++) {
+      bool zero = true;
+      for (j=0; j<n; j++) {
+        if (jac[j*n+i] != 0.0) zero = false;
+      }
+      if (zero) continue;
+      keep.push_back(i);
+      p_ss_gen.push_back(p_ss_slot_gen[k]);
+      p_ss_device.push_back(p_ss_slot_device[k]);
+      p_ss_index.push_back(i-p_ss_slot_offset[k]);
+    }
+  }
+  keep.push_back(nx);
+  keep.push_back(nx+1);
+  p_ss_nstates = keep.size()-2;
+  int m = keep.size();
+  p_ss_jac.resize(m*m);
+  for (j=0; j<m; j++) {
+    for (i=0; i<m; i++) {
+      p_ss_jac[j*m+i] = jac[keep[j]*n+keep[i]];
+    }
+  }
+  return ret;
+}
+
+/**
+ * @return number of states contributed to the small signal system
+ */
+int gridpack::dynamic_simulation::DSFullBus::numSmallSignalStates() const
+{
+  return p_ss_nstates;
+}
+
+/**
+ * Identify a state in the small signal system
+ * @param idx index of state on bus
+ * @param gen index of generator on bus
+ * @param device 0: generator, 1: exciter, 2: governor, 3: stabilizer
+ * @param state index of state within device model
+ */
+void gridpack::dynamic_simulation::DSFullBus::getSmallSignalState(int idx,
+    int *gen, int *device, int *state) const
+{
+  *gen = p_ss_gen[idx];
+  *device = p_ss_device[idx];
+  *state = p_ss_index[idx];
+}
+
+/**
+ * Set shift s that is subtracted from the state block of the small
+ * signal matrix
+ * @param shift complex shift
+ */
+void gridpack::dynamic_simulation::DSFullBus::setSmallSignalShift(
+    gridpack::ComplexType shift)
+{
+  p_ss_shift = shift;
+}
+
+/**
+ * Copy values that were assigned to the bus by mapToBus in SMALL_SIGNAL
+ * mode
+ * @param values array of length numSmallSignalStates()+2
+ */
+void gridpack::dynamic_simulation::DSFullBus::getSmallSignalVector(
+    gridpack::ComplexType *values) const
+{
+  int i;
+  for (i=0; i<p_ss_nstates+2; i++) {
+    if (i < p_ss_vector.size()) {
+      values[i] = p_ss_vector[i];
+    } else {
+      values[i] = 0.0;
+    }
+  }
+}
+
+/**
+ * @return number of values used to store the dynamic state of the bus
+ */
+int gridpack::dynamic_simulation::DSFullBus::numDynamicStates()
+{
+  int i, k, ns;
+  int nstates = 6;
+  for (i=0; i<p_ngen; i++) {
+    if (!p_gstatus[i] || !p_generators.size()) continue;
+    for (k=0; k<4; k++) {
+      ns = smallSignalDevice(i,k,0,NULL);
+      if (ns > 0) nstates += ns;
+    }
+  }
+  return nstates;
+}
+
+/**
+ * @return number of active generator, exciter, governor and stabilizer
+ *         models on the bus that do not provide access to their states
+ */
+int gridpack::dynamic_simulation::DSFullBus::numHiddenStateDevices()
+{
+  int i, k;
+  int ndev = 0;
+  for (i=0; i<p_ngen; i++) {
+    if (!p_gstatus[i] || !p_generators.size()) continue;
+    for (k=0; k<4; k++) {
+      if (smallSignalDevice(i,k,0,NULL) < 0) ndev++;
+    }
+  }
+  return ndev;
+}
+
+/**
+ * Copy the dynamic state of the bus. The state consists of the real and
+ * imaginary parts of the bus voltage and the bus frequency at the current
+ * and previous time step and the states of all generator, exciter,
+ * governor and stabilizer models on the bus that provide access to their
+ * states
+ * @param x array of length numDynamicStates()
+ */
+void gridpack::dynamic_simulation::DSFullBus::getDynamicState(double *x)
+{
+  int i, k, ns;
+  x[0] = real(p_volt_full);
+  x[1] = imag(p_volt_full);
+  x[2] = p_busvolfreq;
+  x[3] = real(p_volt_full_old);
+  x[4] = imag(p_volt_full_old);
+  x[5] = pbusvolfreq_old;
+  int offset = 6;
+  for (i=0; i<p_ngen; i++) {
+    if (!p_gstatus[i] || !p_generators.size()) continue;
+    for (k=0; k<4; k++) {
+      ns = smallSignalDevice(i,k,1,x+offset);
+      if (ns > 0) offset += ns;
+    }
+  }
+}
+
+/**
+ * Overwrite the dynamic state of the bus with values obtained from
+ * getDynamicState on a copy of the same network
+ * @param x array of length numDynamicStates()
+ */
+void gridpack::dynamic_simulation::DSFullBus::setDynamicState(const double *x)
+{
+  int i, k, ns;
+  p_volt_full = gridpack::ComplexType(x[0],x[1]);
+  p_busvolfreq = x[2];
+  p_volt_full_old = gridpack::ComplexType(x[3],x[4]);
+  p_volt_full_old_real = x[3];
+  p_volt_full_old_imag = x[4];
+  pbusvolfreq_old = x[5];
+  int offset = 6;
+  for (i=0; i<p_ngen; i++) {
+    if (!p_gstatus[i] || !p_generators.size()) continue;
+    for (k=0; k<4; k++) {
+      ns = smallSignalDevice(i,k,2,const_cast<double*>(x+offset));
+      if (ns > 0) offset += ns;
+    }
+  }
+  setVolt(false);
+}
+
+/**
+ * Access states of a device attached to a generator
+ * @param igen index of generator on bus
+ * @param device 0: generator, 1: exciter, 2: governor, 3: stabilizer
+ * @param op 0: none, 1: get states, 2: set states, 3: get predicted states
+ * @param x state values
+ * @return number of states, 0 if the device is not present and -1 if the
+ *         device model does not provide access to its states
+ */
+int gridpack::dynamic_simulation::DSFullBus::smallSignalDevice(int igen,
+    int device, int op, double *x)
+{
+  boost::shared_ptr<BaseGeneratorModel> gen = p_generators[igen];
+  int ns = 0;
+  if (device == 0) {
+    ns = gen->numStates();
+    if (ns <= 0) return ns;
+    if (op == 1) gen->getStates(x);
+    if (op == 2) gen->setStates(x);
+    if (op == 3) gen->getPredictedStates(x);
+  } else if (device == 1) {
+    if (!gen->p_hasExciter) return 0;
+    boost::shared_ptr<BaseExciterModel> exc = gen->getExciter();
+    ns = exc->numStates();
+    if (ns <= 0) return ns;
+    if (op == 1) exc->getStates(x);
+    if (op == 2) exc->setStates(x);
+    if (op == 3) exc->getPredictedStates(x);
+  } else if (device == 2) {
+    if (!gen->p_hasGovernor) return 0;
+    boost::shared_ptr<BaseGovernorModel> gov = gen->getGovernor();
+    ns = gov->numStates();
+    if (ns <= 0) return ns;
+    if (op == 1) gov->getStates(x);
+    if (op == 2) gov->setStates(x);
+    if (op == 3) gov->getPredictedStates(x);
+  } else if (device == 3) {
+    if (!gen->p_hasPss) return 0;
+    boost::shared_ptr<BasePssModel> pss = gen->getPss();
+    ns = pss->numStates();
+    if (ns <= 0) return ns;
+    if (op == 1) pss->getStates(x);
+    if (op == 2) pss->setStates(x);
+    if (op == 3) pss->getPredictedStates(x);
+  }
+  return ns;
+}
+
+/**
+ * Evaluate state derivatives and generator current injection for the
+ * device slots found by linearize
+ * @param x state values
+ * @param v bus voltage
+ * @param h time increment passed to the model predictors
+ * @param f state derivatives followed by real and imaginary part of the
+ *        injected current
+ */
+void gridpack::dynamic_simulation::DSFullBus::smallSignalResidual(double *x,
+    gridpack::ComplexType v, double h, double *f)
+{
+  int i, k, pass;
+  int nslot = p_ss_slot_gen.size();
+  int nx = p_ss_slot_offset[nslot];
+  for (k=0; k<nslot; k++) {
+    smallSignalDevice(p_ss_slot_gen[k],p_ss_slot_device[k],2,
+        x+p_ss_slot_offset[k]);
+  }
+  for (i=0; i<p_ngen; i++) {
+    if (p_ss_active[i]) p_generators[i]->setVoltage(v);
+  }
+  // generators read the outputs of their exciters and governors before
+  // these are updated, so repeat the evaluation until the outputs are
+  // consistent with the states
+  for (pass=0; pass<3; pass++) {
+    for (i=0; i<p_ngen; i++) {
+      if (!p_ss_active[i]) continue;
+      p_generators[i]->predictor_currentInjection(true);
+      p_generators[i]->predictor(h,true);
+    }
+  }
+  gridpack::ComplexType current(0.0,0.0);
+  for (i=0; i<p_ngen; i++) {
+    if (!p_gstatus[i] || !p_generators.size()) continue;
+    if (p_ss_active[i]) p_generators[i]->predictor_currentInjection(true);
+    current += p_generators[i]->INorton();
+  }
+  for (k=0; k<nslot; k++) {
+    smallSignalDevice(p_ss_slot_gen[k],p_ss_slot_device[k],3,
+        f+p_ss_slot_offset[k]);
+  }
+  for (i=0; i<nx; i++) f[i] = (f[i]-x[i])/h;
+  f[nx] = real(current);
+  f[nx+1] = imag(current);
+}
+
 
 /**
  *  Simple constructor
@@ -3223,6 +3691,19 @@ gridpack::dynamic_simulation::DSFullBranch::~DSFullBranch(void)
 {
 }
 
+/**
+ * @return true if either end of the branch is in an island without
+ * generation
+ */
+bool gridpack::dynamic_simulation::DSFullBranch::deadIsland(void) const
+{
+  gridpack::dynamic_simulation::DSFullBus *bus1 =
+    dynamic_cast<gridpack::dynamic_simulation::DSFullBus*>(getBus1().get());
+  gridpack::dynamic_simulation::DSFullBus *bus2 =
+    dynamic_cast<gridpack::dynamic_simulation::DSFullBus*>(getBus2().get());
+  return bus1->getDeadIsland() || bus2->getDeadIsland();
+}
+
 /**
  * Return size of off-diagonal matrix block contributed by the component
  * for the forward/reverse directions
@@ -3232,8 +3713,18 @@ gridpack::dynamic_simulation::DSFullBranch::~DSFullBranch(void)
 bool gridpack::dynamic_simulation::DSFullBranch::matrixForwardSize(int *isize, int *jsize) const
 {
   if (p_mode == YBUS || p_mode == YL || p_mode == PG || p_mode == onFY || p_mode == posFY || p_mode == branch_trip_action
-  || p_mode == jxd || p_mode == YDYNLOAD ||p_mode == bus_relay || p_mode == branch_relay || p_mode == LINESTATUSCHANGE || p_mode == GENSTATUSCHANGE) { 
+  || p_mode == jxd || p_mode == YDYNLOAD ||p_mode == bus_relay || p_mode == branch_relay || p_mode == LINESTATUSCHANGE || p_mode == GENSTATUSCHANGE
+  || p_mode == island_drop) { 
     return YMBranch::matrixForwardSize(isize,jsize);
+  } else if (p_mode == SMALL_SIGNAL) {
+    if (!YMBranch::matrixForwardSize(isize,jsize)) return false;
+    gridpack::dynamic_simulation::DSFullBus *bus1 =
+      dynamic_cast<gridpack::dynamic_simulation::DSFullBus*>(getBus1().get());
+    gridpack::dynamic_simulation::DSFullBus *bus2 =
+      dynamic_cast<gridpack::dynamic_simulation::DSFullBus*>(getBus2().get());
+    *isize = bus1->numSmallSignalStates()+2;
+    *jsize = bus2->numSmallSignalStates()+2;
+    return true;
   } else {
     return false;
   }
@@ -3241,8 +3732,18 @@ bool gridpack::dynamic_simulation::DSFullBranch::matrixForwardSize(int *isize, i
 bool gridpack::dynamic_simulation::DSFullBranch::matrixReverseSize(int *isize, int *jsize) const
 {
   if (p_mode == YBUS || p_mode == YL || p_mode == PG || p_mode == onFY || p_mode == posFY || p_mode == branch_trip_action
-  || p_mode == jxd || p_mode == YDYNLOAD || p_mode == bus_relay || p_mode == branch_relay || p_mode == LINESTATUSCHANGE) { 
+  || p_mode == jxd || p_mode == YDYNLOAD || p_mode == bus_relay || p_mode == branch_relay || p_mode == LINESTATUSCHANGE
+  || p_mode == island_drop) { 
     return YMBranch::matrixReverseSize(isize,jsize);
+  } else if (p_mode == SMALL_SIGNAL) {
+    if (!YMBranch::matrixReverseSize(isize,jsize)) return false;
+    gridpack::dynamic_simulation::DSFullBus *bus1 =
+      dynamic_cast<gridpack::dynamic_simulation::DSFullBus*>(getBus1().get());
+    gridpack::dynamic_simulation::DSFullBus *bus2 =
+      dynamic_cast<gridpack::dynamic_simulation::DSFullBus*>(getBus2().get());
+    *isize = bus2->numSmallSignalStates()+2;
+    *jsize = bus1->numSmallSignalStates()+2;
+    return true;
   } else {
     return false;
   }
@@ -3268,6 +3769,13 @@ bool gridpack::dynamic_simulation::DSFullBranch::matrixForwardValues(ComplexType
 	//return bstatus;  
 	
     return YMBranch::matrixForwardValues(values);
+  } else if (p_mode == SMALL_SIGNAL) {
+    gridpack::ComplexType y;
+    if (!YMBranch::matrixForwardValues(&y)) return false;
+    int isize, jsize;
+    matrixForwardSize(&isize,&jsize);
+    smallSignalBlock(y,isize,jsize,values);
+    return true;
   } else if(p_mode == LINESTATUSCHANGE) {
     if(p_line_status_change) {
       values[0] = p_yft;
@@ -3280,6 +3788,13 @@ bool gridpack::dynamic_simulation::DSFullBranch::matrixForwardValues(ComplexType
     } else {
       return false;
     }
+  } else if (p_mode == island_drop) {
+    if (deadIsland()) {
+      values[0] = 0.0;
+      return true;
+    } else {
+      return false;
+    }
   } else if (p_mode == branch_relay) {
 	  if (p_branchrelaytripflag) {
       printf("matrix off diag forward element changes due to branch relay trip!\n");
@@ -3328,6 +3843,13 @@ bool gridpack::dynamic_simulation::DSFullBranch::matrixReverseValues(ComplexType
 	// return bstatus;  
 	  
     return YMBranch::matrixReverseValues(values);
+  } else if (p_mode == SMALL_SIGNAL) {
+    gridpack::ComplexType y;
+    if (!YMBranch::matrixReverseValues(&y)) return false;
+    int isize, jsize;
+    matrixReverseSize(&isize,&jsize);
+    smallSignalBlock(y,isize,jsize,values);
+    return true;
   } else if (p_mode == LINESTATUSCHANGE) {
     if(p_line_status_change) {
       values[0] = p_ytf;
@@ -3341,6 +3863,13 @@ bool gridpack::dynamic_simulation::DSFullBranch::matrixReverseValues(ComplexType
     } else {
       return false;
     }
+  } else if (p_mode == island_drop) {
+    if (deadIsland()) {
+      values[0] = 0.0;
+      return true;
+    } else {
+      return false;
+    }
   } else if (p_mode == branch_relay) {
 	  if (p_branchrelaytripflag) {
       printf("matrix off diag reverse element changes due to branch relay trip!\n");
@@ -3665,6 +4194,28 @@ void gridpack::dynamic_simulation::DSFullBranch::setMode(int mode)
   p_mode = mode;
 }
 
+/**
+ * Fill the off-diagonal block of the small signal matrix. Only the
+ * current balance rows and voltage columns are non-zero and contain
+ * -Yij*V, split into real and imaginary parts
+ * @param y off-diagonal element of Y-matrix
+ * @param isize, jsize number of rows and columns of block
+ * @param values block values in column-major order
+ */
+void gridpack::dynamic_simulation::DSFullBranch::smallSignalBlock(
+    gridpack::ComplexType y, int isize, int jsize,
+    gridpack::ComplexType *values)
+{
+  int i;
+  for (i=0; i<isize*jsize; i++) values[i] = 0.0;
+  int ir = isize-2;
+  int vr = jsize-2;
+  values[vr*isize+ir] = -real(y);
+  values[(vr+1)*isize+ir] = imag(y);
+  values[vr*isize+ir+1] = -imag(y);
+  values[(vr+1)*isize+ir+1] = -real(y);
+}
+
 /**
  * Return the complex admittance of the branch
  * @return: complex addmittance of branch
@@ -4058,6 +4609,24 @@ void gridpack::dynamic_simulation::DSFullBranch::clearBranchTripAction()
         (getBus2().get())->clearBranchTripAction();
 }
 
+/**
+ * Return status of all transmission elements. Elements that have been
+ * tripped by a trip action or a relay during the simulation are out of
+ * service
+ * @return vector containing status of transmission elements
+ */
+std::vector<bool> gridpack::dynamic_simulation::DSFullBranch::getLineStatus()
+{
+  std::vector<bool> ret = YMBranch::getLineStatus();
+  int i;
+  int nelems = ret.size();
+  if (p_branch_status.size() < nelems) nelems = p_branch_status.size();
+  for (i=0; i<nelems; i++) {
+    if (p_branch_status[i] == 0) ret[i] = false;
+  }
+  return ret;
+}
+
 /**
  * Set parameters of the transformer branch due to composite load model
  */
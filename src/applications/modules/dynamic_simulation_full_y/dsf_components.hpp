@@ -22,7 +22,7 @@
 namespace gridpack {
 namespace dynamic_simulation {
 
-  enum DSMode{YBUS, YL, YDYNLOAD, PG, onFY, posFY, jxd, make_INorton_full, bus_relay, branch_relay, branch_trip_action, bus_Yload_change_P, bus_Yload_change_Q, BUSFAULTON,BUSFAULTOFF, LINESTATUSCHANGE, GENSTATUSCHANGE,INIT_V};
+  enum DSMode{YBUS, YL, YDYNLOAD, PG, onFY, posFY, jxd, make_INorton_full, bus_relay, branch_relay, branch_trip_action, bus_Yload_change_P, bus_Yload_change_Q, BUSFAULTON,BUSFAULTOFF, LINESTATUSCHANGE, GENSTATUSCHANGE,INIT_V, island_drop, SMALL_SIGNAL};
 
 // Utility structure to encapsulate information about fault events
 struct Event{
@@ -340,6 +340,25 @@ class DSFullBus
      */
     int getNumGen(void);
 
+    /**
+     * Return the number of generators on this bus that are in service
+     * @return number of generators in service
+     */
+    int getNumActiveGen(void);
+
+    /**
+     * Mark bus as part of an island without generation. In island_drop mode
+     * the diagonal Y-matrix element of the bus is replaced by 1 and the
+     * branches connected to it do not contribute
+     * @param flag true if bus is in a dead island
+     */
+    void setDeadIsland(bool flag);
+
+    /**
+     * @return true if bus is part of an island without generation
+     */
+    bool getDeadIsland(void) const;
+
     /**
      * Return whether or not a bus is isolated
      * @return true if bus is isolated
@@ -504,6 +523,16 @@ class DSFullBus
      */
     bool checkFrequency(double limit);
 
+    /**
+     * Get largest frequency deviation and range of rotor angles for watched
+     * generators on this bus
+     * @param fdev largest absolute deviation of frequency from 60 Hz
+     * @param amin smallest rotor angle (radians)
+     * @param amax largest rotor angle (radians)
+     * @return false if there are no watched generators on bus
+     */
+    bool getWatchedExtrema(double *fdev, double *amin, double *amax);
+
     /**
      * Scale value of real power on all generators
      * @param character ID for generator
@@ -705,6 +734,83 @@ class DSFullBus
      @param : ybr_self - contribution for line status change
   **/
   void diagValuesInsertForLineStatusChange(gridpack::ComplexType Ybr_self);
+
+    /**
+     * Linearize the dynamic models on the bus around the current operating
+     * point for small signal analysis. State derivatives and the current
+     * injected by the generators are differentiated numerically with
+     * respect to the model states and the real and imaginary parts of the
+     * bus voltage. Models that do not provide access to their states are
+     * held constant. In SMALL_SIGNAL mode the bus then contributes the
+     * block [A-sI, B; C, D-Yii] to the matrix, with the states first and
+     * the real and imaginary parts of the network current balance last
+     * @param delta perturbation used for finite differences
+     * @param h time increment used to evaluate state derivatives with the
+     *        model predictors
+     * @param report print a warning for each model that is held constant.
+     *        Ghost buses are linearized on several processors, so this
+     *        should only be set for active buses on one processor
+     * @return false if some models on the bus could not be linearized
+     */
+    bool linearize(double delta, double h, bool report = false);
+
+    /**
+     * @return number of states contributed to the small signal system
+     */
+    int numSmallSignalStates() const;
+
+    /**
+     * Identify a state in the small signal system
+     * @param idx index of state on bus
+     * @param gen index of generator on bus
+     * @param device 0: generator, 1: exciter, 2: governor, 3: stabilizer
+     * @param state index of state within device model
+     */
+    void getSmallSignalState(int idx, int *gen, int *device,
+        int *state) const;
+
+    /**
+     * Set shift s that is subtracted from the state block of the small
+     * signal matrix
+     * @param shift complex shift
+     */
+    void setSmallSignalShift(ComplexType shift);
+
+    /**
+     * Copy values that were assigned to the bus by mapToBus in
+     * SMALL_SIGNAL mode
+     * @param values array of length numSmallSignalStates()+2
+     */
+    void getSmallSignalVector(ComplexType *values) const;
+
+    /**
+     * @return number of values used to store the dynamic state of the bus
+     */
+    int numDynamicStates();
+
+    /**
+     * @return number of active generator, exciter, governor and
+     *         stabilizer models on the bus that do not provide access to
+     *         their states
+     */
+    int numHiddenStateDevices();
+
+    /**
+     * Copy the dynamic state of the bus. The state consists of the real and
+     * imaginary parts of the bus voltage and the bus frequency at the
+     * current and previous time step and the states of all generator,
+     * exciter, governor and stabilizer models on the bus that provide
+     * access to their states
+     * @param x array of length numDynamicStates()
+     */
+    void getDynamicState(double *x);
+
+    /**
+     * Overwrite the dynamic state of the bus with values obtained from
+     * getDynamicState on a copy of the same network
+     * @param x array of length numDynamicStates()
+     */
+    void setDynamicState(const double *x);
   
 #ifdef USE_FNCS
     /**
@@ -773,6 +879,7 @@ class DSFullBus
 	bool p_branchrelay_from_flag, p_branchrelay_to_flag;
 	bool p_branchtripaction_from_flag, p_branchtripaction_to_flag;
 	bool p_busrelaytripflag;
+	bool p_dead_island;
 	int p_bextendedloadbus; // whether it is an extended load bus with composite load model
 	                        // -1: normal bus
 							//  1: LOW_SIDE_BUS
@@ -837,6 +944,39 @@ class DSFullBus
 
     bool p_isolated;
 
+    // small signal analysis. States are stored per device slot while the
+    // bus is linearized and per state afterwards
+    int p_ss_nstates;
+    std::vector<int> p_ss_slot_gen, p_ss_slot_device, p_ss_slot_offset;
+    std::vector<bool> p_ss_active;
+    std::vector<int> p_ss_gen, p_ss_device, p_ss_index;
+    std::vector<double> p_ss_jac; // linearized block in column-major order
+    ComplexType p_ss_shift;
+    std::vector<ComplexType> p_ss_vector;
+
+    /**
+     * Access states of a device attached to a generator
+     * @param igen index of generator on bus
+     * @param device 0: generator, 1: exciter, 2: governor, 3: stabilizer
+     * @param op 0: none, 1: get states, 2: set states, 3: get predicted
+     *        states
+     * @param x state values
+     * @return number of states, 0 if the device is not present and -1 if
+     *         the device model does not provide access to its states
+     */
+    int smallSignalDevice(int igen, int device, int op, double *x);
+
+    /**
+     * Evaluate state derivatives and generator current injection for the
+     * device slots found by linearize
+     * @param x state values
+     * @param v bus voltage
+     * @param h time increment passed to the model predictors
+     * @param f state derivatives followed by real and imaginary part of
+     *        the injected current
+     */
+    void smallSignalResidual(double *x, ComplexType v, double h, double *f);
+
     // variables for monitoring the frequency of generators to find out
     // if any are going out of bounds
     std::vector<double> p_previousFrequency;
@@ -1064,8 +1204,33 @@ class DSFullBranch
      the Y-bus matrix
   **/
   void setLineStatus(std::string ckt_id, int status);
+
+  /**
+   * Return status of all transmission elements. Elements that have been
+   * tripped by a trip action or a relay during the simulation are out of
+   * service
+   * @return vector containing status of transmission elements
+   */
+  std::vector<bool> getLineStatus();
+  using YMBranch::getLineStatus;
   
   private:
+    /**
+     * Fill the off-diagonal block of the small signal matrix. Only the
+     * current balance rows and voltage columns are non-zero
+     * @param y off-diagonal element of Y-matrix
+     * @param isize, jsize number of rows and columns of block
+     * @param values block values in column-major order
+     */
+    void smallSignalBlock(ComplexType y, int isize, int jsize,
+        ComplexType *values);
+
+    /**
+     * @return true if either end of the branch is in an island without
+     * generation
+     */
+    bool deadIsland(void) const;
+
     std::vector<double> p_reactance;
     std::vector<double> p_resistance;
     std::vector<double> p_tap_ratio;
@@ -350,7 +350,9 @@ bool gridpack::dynamic_simulation::DSFullFactory::updateBranchRelay(bool flag,do
 		bflag = bflag || p_branches[i]->updateRelay(flag,delta_t);
 	}
 	
-	return bflag;
+	// the Y-matrix update and island check that follow a trip are
+	// collective, so all processors must see the trip
+	return checkTrueSomewhere(bflag);
 	
 }
 
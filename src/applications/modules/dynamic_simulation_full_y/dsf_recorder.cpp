@@ -0,0 +1,326 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   dsf_recorder.cpp
+ *
+ * @brief  Recorder for time series of watched generator values
+ */
+// -------------------------------------------------------------
+
+#include "dsf_recorder.hpp"
+
+/**
+ * Basic constructor
+ */
+gridpack::dynamic_simulation::TimeSeriesRecorder::TimeSeriesRecorder()
+{
+  p_nsignals = 0;
+  p_capacity = 0;
+  p_nsteps = 0;
+  p_total = 0;
+  p_written = 0;
+  p_decimation = 1;
+  p_counter = 0;
+  p_file = NULL;
+}
+
+/**
+ * Basic destructor
+ */
+gridpack::dynamic_simulation::TimeSeriesRecorder::~TimeSeriesRecorder()
+{
+  if (p_file) fclose(p_file);
+}
+
+/**
+ * Remove all signals and recorded data and close binary file
+ */
+void gridpack::dynamic_simulation::TimeSeriesRecorder::clear()
+{
+  if (p_file) fclose(p_file);
+  p_file = NULL;
+  p_filename.clear();
+  p_generators.clear();
+  p_data.clear();
+  p_times.clear();
+  p_nsignals = 0;
+  p_capacity = 0;
+  p_nsteps = 0;
+  p_total = 0;
+  p_written = 0;
+  p_decimation = 1;
+  p_counter = 0;
+}
+
+/**
+ * Add a generator to the list of recorded devices. All generators must
+ * be added before calling setup
+ * @param gen pointer to generator model
+ */
+void gridpack::dynamic_simulation::TimeSeriesRecorder::addGenerator(
+    BaseGeneratorModel *gen)
+{
+  p_generators.push_back(gen);
+  p_nsignals += GEN_SIGNALS;
+}
+
+/**
+ * Allocate buffer for recorded data
+ * @param nsteps expected number of steps that will be recorded
+ * @param decimation record every decimation'th call to record
+ * @param filename name of binary file. If empty, data is kept in memory
+ * @param chunk number of steps held in memory before writing to file
+ */
+void gridpack::dynamic_simulation::TimeSeriesRecorder::setup(int nsteps,
+    int decimation, std::string filename, int chunk)
+{
+  if (p_file) fclose(p_file);
+  p_file = NULL;
+  p_decimation = decimation;
+  if (p_decimation < 1) p_decimation = 1;
+  p_filename = filename;
+  p_nsteps = 0;
+  p_total = 0;
+  p_written = 0;
+  p_counter = 0;
+  int capacity = nsteps/p_decimation + 1;
+  if (p_filename.size() > 0) {
+    p_file = fopen(p_filename.c_str(),"wb");
+    if (!p_file) {
+      printf("TimeSeriesRecorder: unable to open file %s\n",
+          p_filename.c_str());
+      p_filename.clear();
+    } else if (chunk > 0) {
+      capacity = chunk;
+    }
+  }
+  if (capacity < 1) capacity = 1;
+  p_capacity = 0;
+  p_data.clear();
+  p_times.clear();
+  grow(capacity);
+  p_scratch.reserve(2*GEN_SIGNALS);
+}
+
+/**
+ * Record values of all signals at the current time
+ * @param time current value of time
+ */
+void gridpack::dynamic_simulation::TimeSeriesRecorder::record(double time)
+{
+  if (p_counter%p_decimation != 0) {
+    p_counter++;
+    return;
+  }
+  p_counter++;
+  if (p_nsteps == p_capacity) {
+    if (p_file) {
+      spill();
+    } else {
+      grow(2*p_capacity);
+    }
+  }
+  int ngen = p_generators.size();
+  int i, j;
+  double *ptr = &p_data[0] + p_nsteps;
+  for (i=0; i<ngen; i++) {
+    p_generators[i]->getWatchValues(p_scratch);
+    int nvals = p_scratch.size();
+    for (j=0; j<GEN_SIGNALS; j++) {
+      *ptr = (j < nvals) ? p_scratch[j] : 0.0;
+      ptr += p_capacity;
+    }
+  }
+  p_times[p_nsteps] = time;
+  p_nsteps++;
+  p_total++;
+}
+
+/**
+ * Write any data still in buffer to binary file and close file. The
+ * buffer is left unchanged
+ */
+void gridpack::dynamic_simulation::TimeSeriesRecorder::flush()
+{
+  if (!p_file) return;
+  int nsteps = p_nsteps;
+  spill();
+  p_nsteps = nsteps;
+  fclose(p_file);
+  p_file = NULL;
+}
+
+/**
+ * @return number of recorded signals
+ */
+int gridpack::dynamic_simulation::TimeSeriesRecorder::numSignals() const
+{
+  return p_nsignals;
+}
+
+/**
+ * @return number of steps currently held in memory
+ */
+int gridpack::dynamic_simulation::TimeSeriesRecorder::numSteps() const
+{
+  return p_nsteps;
+}
+
+/**
+ * @return total number of steps recorded, including steps written to
+ * file
+ */
+int gridpack::dynamic_simulation::TimeSeriesRecorder::totalSteps() const
+{
+  return p_total;
+}
+
+/**
+ * @return distance between the start of consecutive signals in the
+ * buffer returned by data
+ */
+int gridpack::dynamic_simulation::TimeSeriesRecorder::stride() const
+{
+  return p_capacity;
+}
+
+/**
+ * @return pointer to buffer of recorded values
+ */
+const double* gridpack::dynamic_simulation::TimeSeriesRecorder::data() const
+{
+  if (p_data.size() == 0) return NULL;
+  return &p_data[0];
+}
+
+/**
+ * @return pointer to times of steps held in memory
+ */
+const double* gridpack::dynamic_simulation::TimeSeriesRecorder::times() const
+{
+  if (p_times.size() == 0) return NULL;
+  return &p_times[0];
+}
+
+/**
+ * Get values of a single signal for all recorded steps
+ * @param idx signal index
+ * @param vals values of signal
+ */
+void gridpack::dynamic_simulation::TimeSeriesRecorder::getSignal(int idx,
+    std::vector<double> &vals) const
+{
+  vals.clear();
+  if (idx < 0 || idx >= p_nsignals) return;
+  getSeries(idx,vals);
+}
+
+/**
+ * Get times of all recorded steps
+ * @param vals times of steps
+ */
+void gridpack::dynamic_simulation::TimeSeriesRecorder::getTimes(
+    std::vector<double> &vals) const
+{
+  getSeries(-1,vals);
+}
+
+/**
+ * Get a series for all recorded steps
+ * @param idx signal index or -1 for the times of each step
+ * @param vals values of series
+ */
+void gridpack::dynamic_simulation::TimeSeriesRecorder::getSeries(int idx,
+    std::vector<double> &vals) const
+{
+  vals.clear();
+  vals.reserve(p_total);
+  if (p_written > 0) {
+    if (p_file) fflush(p_file);
+    FILE *fp = fopen(p_filename.c_str(),"rb");
+    if (!fp) {
+      printf("TimeSeriesRecorder: unable to read file %s\n",
+          p_filename.c_str());
+    } else {
+      int header[2];
+      int nread = 0;
+      while (nread < p_written && fread(header,sizeof(int),2,fp) == 2) {
+        int n = header[0];
+        int m = header[1];
+        // skip to requested series in this chunk
+        long offset = (idx < 0) ? 0 : static_cast<long>(n)*(idx+1);
+        if (offset > 0) fseek(fp,offset*sizeof(double),SEEK_CUR);
+        int start = vals.size();
+        vals.resize(start+n);
+        if (fread(&vals[start],sizeof(double),n,fp)
+            != static_cast<size_t>(n)) {
+          printf("TimeSeriesRecorder: file %s is truncated\n",
+              p_filename.c_str());
+          vals.resize(start);
+          break;
+        }
+        // skip remaining series in this chunk
+        offset = static_cast<long>(n)*(m-((idx < 0) ? 0 : idx+1));
+        if (offset > 0) fseek(fp,offset*sizeof(double),SEEK_CUR);
+        nread += n;
+      }
+      fclose(fp);
+    }
+  }
+  // steps that have not been written to file are at the end of the buffer
+  int nmem = p_total-p_written;
+  if (nmem > p_nsteps) nmem = p_nsteps;
+  if (nmem <= 0) return;
+  const double *ptr;
+  if (idx < 0) {
+    ptr = &p_times[0];
+  } else {
+    ptr = &p_data[0] + idx*p_capacity;
+  }
+  vals.insert(vals.end(),ptr+p_nsteps-nmem,ptr+p_nsteps);
+}
+
+/**
+ * Write contents of buffer to binary file and reset buffer
+ */
+void gridpack::dynamic_simulation::TimeSeriesRecorder::spill()
+{
+  if (!p_file || p_nsteps == 0) {
+    p_nsteps = 0;
+    return;
+  }
+  int header[2];
+  header[0] = p_nsteps;
+  header[1] = p_nsignals;
+  fwrite(header,sizeof(int),2,p_file);
+  fwrite(&p_times[0],sizeof(double),p_nsteps,p_file);
+  int i;
+  for (i=0; i<p_nsignals; i++) {
+    fwrite(&p_data[i*p_capacity],sizeof(double),p_nsteps,p_file);
+  }
+  p_written += p_nsteps;
+  p_nsteps = 0;
+}
+
+/**
+ * Increase size of buffer
+ * @param capacity new number of steps that can be held in buffer
+ */
+void gridpack::dynamic_simulation::TimeSeriesRecorder::grow(int capacity)
+{
+  if (capacity <= p_capacity) return;
+  std::vector<double> data(p_nsignals*capacity+1,0.0);
+  int i, j;
+  for (i=0; i<p_nsignals; i++) {
+    for (j=0; j<p_nsteps; j++) {
+      data[i*capacity+j] = p_data[i*p_capacity+j];
+    }
+  }
+  p_data.swap(data);
+  p_times.resize(capacity);
+  p_capacity = capacity;
+}
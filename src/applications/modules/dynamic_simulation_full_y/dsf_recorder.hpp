@@ -0,0 +1,189 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   dsf_recorder.hpp
+ *
+ * @brief  Recorder for time series of watched generator values. Values are
+ * stored in a preallocated columnar buffer so that all values for a single
+ * signal are contiguous in memory. Steps can be decimated and, if a file
+ * name is supplied, the buffer is written to a binary file each time it
+ * fills up so that memory use stays fixed for long simulations.
+ *
+ * The binary file consists of a sequence of chunks. Each chunk starts with
+ * two integers containing the number of steps n in the chunk and the number
+ * of signals m, followed by n doubles containing the times of each step and
+ * m*n doubles containing the values, ordered by signal.
+ *
+ * The raw buffer accessors (numSteps, stride, data, times) only cover the
+ * steps held in memory. The accessors getSignal and getTimes always return
+ * the complete series; steps that have been written to the binary file are
+ * read back from it.
+ */
+// -------------------------------------------------------------
+
+#ifndef _dsf_recorder_h_
+#define _dsf_recorder_h_
+
+#include <stdio.h>
+#include <vector>
+#include <string>
+#include "base_classes/base_generator_model.hpp"
+
+namespace gridpack {
+namespace dynamic_simulation {
+
+class TimeSeriesRecorder {
+  public:
+
+    /**
+     * Number of signals recorded for each generator (rotor angle, rotor
+     * speed, real power, reactive power)
+     */
+    static const int GEN_SIGNALS = 4;
+
+    /**
+     * Basic constructor
+     */
+    TimeSeriesRecorder();
+
+    /**
+     * Basic destructor
+     */
+    ~TimeSeriesRecorder();
+
+    /**
+     * Remove all signals and recorded data and close binary file
+     */
+    void clear();
+
+    /**
+     * Add a generator to the list of recorded devices. All generators must
+     * be added before calling setup
+     * @param gen pointer to generator model
+     */
+    void addGenerator(BaseGeneratorModel *gen);
+
+    /**
+     * Allocate buffer for recorded data. If a file name is given, the
+     * buffer holds at most chunk steps and is written to the file when it
+     * fills up, otherwise the buffer is sized for nsteps and is expanded
+     * if more steps are recorded
+     * @param nsteps expected number of steps that will be recorded
+     * @param decimation record every decimation'th call to record
+     * @param filename name of binary file. If empty, data is kept in memory
+     * @param chunk number of steps held in memory before writing to file
+     */
+    void setup(int nsteps, int decimation = 1, std::string filename = "",
+        int chunk = 1000);
+
+    /**
+     * Record values of all signals at the current time
+     * @param time current value of time
+     */
+    void record(double time);
+
+    /**
+     * Write any data still in buffer to binary file and close file. The
+     * buffer is left unchanged, but after a flush it only holds the last
+     * chunk. Use getSignal and getTimes to get the complete series
+     */
+    void flush();
+
+    /**
+     * @return number of recorded signals
+     */
+    int numSignals() const;
+
+    /**
+     * @return number of steps currently held in memory
+     */
+    int numSteps() const;
+
+    /**
+     * @return total number of steps recorded, including steps written to
+     * file
+     */
+    int totalSteps() const;
+
+    /**
+     * @return distance between the start of consecutive signals in the
+     * buffer returned by data
+     */
+    int stride() const;
+
+    /**
+     * @return pointer to buffer of recorded values held in memory. The
+     * values for signal i start at location i*stride() and are contiguous
+     */
+    const double* data() const;
+
+    /**
+     * @return pointer to times of steps held in memory
+     */
+    const double* times() const;
+
+    /**
+     * Get values of a single signal for all recorded steps, including
+     * steps that have been written to file
+     * @param idx signal index
+     * @param vals values of signal (totalSteps() values)
+     */
+    void getSignal(int idx, std::vector<double> &vals) const;
+
+    /**
+     * Get times of all recorded steps, including steps that have been
+     * written to file
+     * @param vals times of steps (totalSteps() values)
+     */
+    void getTimes(std::vector<double> &vals) const;
+
+  private:
+
+    /**
+     * Write contents of buffer to binary file and reset buffer
+     */
+    void spill();
+
+    /**
+     * Get a series for all recorded steps. Steps that have been written to
+     * file are read back from the file, the remaining steps are taken from
+     * the buffer
+     * @param idx signal index or -1 for the times of each step
+     * @param vals values of series
+     */
+    void getSeries(int idx, std::vector<double> &vals) const;
+
+    /**
+     * Increase size of buffer
+     * @param capacity new number of steps that can be held in buffer
+     */
+    void grow(int capacity);
+
+    std::vector<BaseGeneratorModel*> p_generators;
+
+    // Scratch vector used to retrieve generator values
+    std::vector<double> p_scratch;
+
+    // Recorded values, stored as [signal*p_capacity+step]
+    std::vector<double> p_data;
+    std::vector<double> p_times;
+
+    int p_nsignals;
+    int p_capacity;
+    int p_nsteps;
+    int p_total;
+    int p_written;
+    int p_decimation;
+    int p_counter;
+
+    std::string p_filename;
+    FILE *p_file;
+};
+
+}  // dynamic_simulation
+}  // gridpack
+#endif
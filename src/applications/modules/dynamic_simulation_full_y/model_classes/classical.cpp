@@ -465,3 +465,49 @@ bool gridpack::dynamic_simulation::ClassicalGenerator::getState(std::string name
 {
   return false;
 }
+
+/**
+ * Return the number of state variables in the generator that are used for
+ * small signal analysis
+ * @return number of states
+ */
+int gridpack::dynamic_simulation::ClassicalGenerator::numStates()
+{
+  return 2;
+}
+
+/**
+ * Copy current values of state variables
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::ClassicalGenerator::getStates(double *x)
+{
+  x[0] = real(p_mac_ang_s0);
+  x[1] = real(p_mac_spd_s0);
+}
+
+/**
+ * Overwrite current values of state variables. Predicted values are reset
+ * to the same values
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::ClassicalGenerator::setStates(const double *x)
+{
+  gridpack::ComplexType jay(0.0,1.0);
+  p_mac_ang_s0 = x[0];
+  p_mac_spd_s0 = x[1];
+  p_mac_ang_s1 = p_mac_ang_s0;
+  p_mac_spd_s1 = p_mac_spd_s0;
+  p_eprime_s0 = exp(p_mac_ang_s0 * jay) * p_eqprime;
+  p_eprime_s1 = p_eprime_s0;
+}
+
+/**
+ * Copy values of state variables computed by the last call to predictor
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::ClassicalGenerator::getPredictedStates(double *x)
+{
+  x[0] = real(p_mac_ang_s1);
+  x[1] = real(p_mac_spd_s1);
+}
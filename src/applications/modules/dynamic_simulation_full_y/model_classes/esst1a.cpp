@@ -399,3 +399,65 @@ bool gridpack::dynamic_simulation::Esst1aModel::getState(std::string name,
 {
   return false;
 }
+
+/**
+ * Return the number of state variables in the exciter that are used for
+ * small signal analysis
+ * @return number of states
+ */
+int gridpack::dynamic_simulation::Esst1aModel::numStates()
+{
+  Cblock *blk[5];
+  return stateBlocks(blk);
+}
+
+/**
+ * Copy current values of state variables
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::Esst1aModel::getStates(double *x)
+{
+  Cblock *blk[5];
+  int i, nblk = stateBlocks(blk);
+  for (i=0; i<nblk; i++) x[i] = blk[i]->getstate(CORRECTOR);
+}
+
+/**
+ * Overwrite current values of state variables. Predicted values are reset
+ * to the same values
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::Esst1aModel::setStates(const double *x)
+{
+  Cblock *blk[5];
+  int i, nblk = stateBlocks(blk);
+  for (i=0; i<nblk; i++) blk[i]->setstate(x[i]);
+}
+
+/**
+ * Copy values of state variables computed by the last call to predictor
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::Esst1aModel::getPredictedStates(double *x)
+{
+  Cblock *blk[5];
+  int i, nblk = stateBlocks(blk);
+  for (i=0; i<nblk; i++) x[i] = blk[i]->getstate(PREDICTOR);
+}
+
+/**
+ * Collect the control blocks that carry state variables. Blocks that
+ * are bypassed because their time constant is zero are skipped
+ * @param blk array of (at least) 5 block pointers
+ * @return number of blocks
+ */
+int gridpack::dynamic_simulation::Esst1aModel::stateBlocks(Cblock **blk)
+{
+  int nblk = 0;
+  if (!zero_TR) blk[nblk++] = &Filter_blkR;
+  blk[nblk++] = &Feedback_blkF;
+  blk[nblk++] = &Leadlag_blkBC;
+  blk[nblk++] = &Leadlag_blkBC1;
+  if (!zero_TA) blk[nblk++] = &Regulator_blk;
+  return nblk;
+}
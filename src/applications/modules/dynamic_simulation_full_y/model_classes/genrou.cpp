@@ -778,3 +778,62 @@ bool gridpack::dynamic_simulation::GenrouGenerator::getState(std::string name,
     return false;
   }
 }
+
+/**
+ * Return the number of state variables in the generator that are used for
+ * small signal analysis
+ * @return number of states
+ */
+int gridpack::dynamic_simulation::GenrouGenerator::numStates()
+{
+  return 6;
+}
+
+/**
+ * Copy current values of state variables
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::GenrouGenerator::getStates(double *x)
+{
+  x[0] = x1d;
+  x[1] = x2w;
+  x[2] = x3Eqp;
+  x[3] = x4Psidp;
+  x[4] = x5Psiqp;
+  x[5] = x6Edp;
+}
+
+/**
+ * Overwrite current values of state variables. Predicted values are reset
+ * to the same values
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::GenrouGenerator::setStates(const double *x)
+{
+  x1d = x[0];
+  x2w = x[1];
+  x3Eqp = x[2];
+  x4Psidp = x[3];
+  x5Psiqp = x[4];
+  x6Edp = x[5];
+  x1d_1 = x[0];
+  x2w_1 = x[1];
+  x3Eqp_1 = x[2];
+  x4Psidp_1 = x[3];
+  x5Psiqp_1 = x[4];
+  x6Edp_1 = x[5];
+}
+
+/**
+ * Copy values of state variables computed by the last call to predictor
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::GenrouGenerator::getPredictedStates(double *x)
+{
+  x[0] = x1d_1;
+  x[1] = x2w_1;
+  x[2] = x3Eqp_1;
+  x[3] = x4Psidp_1;
+  x[4] = x5Psiqp_1;
+  x[5] = x6Edp_1;
+}
@@ -153,6 +153,32 @@ class GenrouGenerator : public BaseGeneratorModel
      */
     bool getState(std::string name, double *value);
 
+    /**
+     * Return the number of state variables in the generator that are used for
+     * small signal analysis
+     * @return number of states
+     */
+    int numStates();
+
+    /**
+     * Copy current values of state variables
+     * @param x array of length numStates()
+     */
+    void getStates(double *x);
+
+    /**
+     * Overwrite current values of state variables. Predicted values are reset
+     * to the same values
+     * @param x array of length numStates()
+     */
+    void setStates(const double *x);
+
+    /**
+     * Copy values of state variables computed by the last call to predictor
+     * @param x array of length numStates()
+     */
+    void getPredictedStates(double *x);
+
   private:
 
     double p_sbase;
@@ -722,3 +722,58 @@ bool gridpack::dynamic_simulation::GensalGenerator::getState(std::string name,
 { 
   return false;
 }
+
+/**
+ * Return the number of state variables in the generator that are used for
+ * small signal analysis
+ * @return number of states
+ */
+int gridpack::dynamic_simulation::GensalGenerator::numStates()
+{
+  return 5;
+}
+
+/**
+ * Copy current values of state variables
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::GensalGenerator::getStates(double *x)
+{
+  x[0] = x1d_0;
+  x[1] = x2w_0;
+  x[2] = x3Eqp_0;
+  x[3] = x4Psidp_0;
+  x[4] = x5Psiqpp_0;
+}
+
+/**
+ * Overwrite current values of state variables. Predicted values are reset
+ * to the same values
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::GensalGenerator::setStates(const double *x)
+{
+  x1d_0 = x[0];
+  x2w_0 = x[1];
+  x3Eqp_0 = x[2];
+  x4Psidp_0 = x[3];
+  x5Psiqpp_0 = x[4];
+  x1d_1 = x[0];
+  x2w_1 = x[1];
+  x3Eqp_1 = x[2];
+  x4Psidp_1 = x[3];
+  x5Psiqpp_1 = x[4];
+}
+
+/**
+ * Copy values of state variables computed by the last call to predictor
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::GensalGenerator::getPredictedStates(double *x)
+{
+  x[0] = x1d_1;
+  x[1] = x2w_1;
+  x[2] = x3Eqp_1;
+  x[3] = x4Psidp_1;
+  x[4] = x5Psiqpp_1;
+}
@@ -282,3 +282,64 @@ bool gridpack::dynamic_simulation::Ieeet1Model::getState(std::string name,
 {
   return false;
 }
+
+/**
+ * Return the number of state variables in the exciter that are used for
+ * small signal analysis
+ * @return number of states
+ */
+int gridpack::dynamic_simulation::Ieeet1Model::numStates()
+{
+  Cblock *blk[4];
+  return stateBlocks(blk);
+}
+
+/**
+ * Copy current values of state variables
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::Ieeet1Model::getStates(double *x)
+{
+  Cblock *blk[4];
+  int i, nblk = stateBlocks(blk);
+  for (i=0; i<nblk; i++) x[i] = blk[i]->getstate(CORRECTOR);
+}
+
+/**
+ * Overwrite current values of state variables. Predicted values are reset
+ * to the same values
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::Ieeet1Model::setStates(const double *x)
+{
+  Cblock *blk[4];
+  int i, nblk = stateBlocks(blk);
+  for (i=0; i<nblk; i++) blk[i]->setstate(x[i]);
+}
+
+/**
+ * Copy values of state variables computed by the last call to predictor
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::Ieeet1Model::getPredictedStates(double *x)
+{
+  Cblock *blk[4];
+  int i, nblk = stateBlocks(blk);
+  for (i=0; i<nblk; i++) x[i] = blk[i]->getstate(PREDICTOR);
+}
+
+/**
+ * Collect the control blocks that carry state variables. Blocks that
+ * are bypassed because their time constant is zero are skipped
+ * @param blk array of (at least) 4 block pointers
+ * @return number of blocks
+ */
+int gridpack::dynamic_simulation::Ieeet1Model::stateBlocks(Cblock **blk)
+{
+  int nblk = 0;
+  if (!zero_TR) blk[nblk++] = &Vmeas_blk;
+  blk[nblk++] = &Feedback_blk;
+  if (!zero_TA) blk[nblk++] = &Regulator_blk;
+  blk[nblk++] = &Output_blk;
+  return nblk;
+}
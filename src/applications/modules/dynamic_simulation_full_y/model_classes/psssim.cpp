@@ -242,3 +242,50 @@ void gridpack::dynamic_simulation::PsssimModel::setWideAreaFreqforPSS(double fre
 	wideareafreq = freq;
 }
 
+
+/**
+ * Return the number of state variables in the stabilizer that are used for
+ * small signal analysis
+ * @return number of states
+ */
+int gridpack::dynamic_simulation::PsssimModel::numStates()
+{
+  return 3;
+}
+
+/**
+ * Copy current values of state variables
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::PsssimModel::getStates(double *x)
+{
+  x[0] = x1pss;
+  x[1] = x2pss;
+  x[2] = x3pss;
+}
+
+/**
+ * Overwrite current values of state variables. Predicted values are reset
+ * to the same values
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::PsssimModel::setStates(const double *x)
+{
+  x1pss = x[0];
+  x2pss = x[1];
+  x3pss = x[2];
+  x1pss_1 = x[0];
+  x2pss_1 = x[1];
+  x3pss_1 = x[2];
+}
+
+/**
+ * Copy values of state variables computed by the last call to predictor
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::PsssimModel::getPredictedStates(double *x)
+{
+  x[0] = x1pss_1;
+  x[1] = x2pss_1;
+  x[2] = x3pss_1;
+}
@@ -233,3 +233,62 @@ bool gridpack::dynamic_simulation::SexsModel::getState(std::string name,
 {
   return false;
 }
+
+/**
+ * Return the number of state variables in the exciter that are used for
+ * small signal analysis
+ * @return number of states
+ */
+int gridpack::dynamic_simulation::SexsModel::numStates()
+{
+  Cblock *blk[2];
+  return stateBlocks(blk);
+}
+
+/**
+ * Copy current values of state variables
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::SexsModel::getStates(double *x)
+{
+  Cblock *blk[2];
+  int i, nblk = stateBlocks(blk);
+  for (i=0; i<nblk; i++) x[i] = blk[i]->getstate(CORRECTOR);
+}
+
+/**
+ * Overwrite current values of state variables. Predicted values are reset
+ * to the same values
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::SexsModel::setStates(const double *x)
+{
+  Cblock *blk[2];
+  int i, nblk = stateBlocks(blk);
+  for (i=0; i<nblk; i++) blk[i]->setstate(x[i]);
+}
+
+/**
+ * Copy values of state variables computed by the last call to predictor
+ * @param x array of length numStates()
+ */
+void gridpack::dynamic_simulation::SexsModel::getPredictedStates(double *x)
+{
+  Cblock *blk[2];
+  int i, nblk = stateBlocks(blk);
+  for (i=0; i<nblk; i++) x[i] = blk[i]->getstate(PREDICTOR);
+}
+
+/**
+ * Collect the control blocks that carry state variables. Blocks that
+ * are bypassed because their time constant is zero are skipped
+ * @param blk array of (at least) 2 block pointers
+ * @return number of blocks
+ */
+int gridpack::dynamic_simulation::SexsModel::stateBlocks(Cblock **blk)
+{
+  int nblk = 0;
+  blk[nblk++] = &leadlagblock;
+  if (!zero_TE) blk[nblk++] = &filterblock;
+  return nblk;
+}
@@ -139,8 +139,42 @@ class SexsModel : public BaseExciterModel
      */
     bool getState(std::string name, double *value);
 
+    /**
+     * Return the number of state variables in the exciter that are used for
+     * small signal analysis
+     * @return number of states
+     */
+    int numStates();
+
+    /**
+     * Copy current values of state variables
+     * @param x array of length numStates()
+     */
+    void getStates(double *x);
+
+    /**
+     * Overwrite current values of state variables. Predicted values are reset
+     * to the same values
+     * @param x array of length numStates()
+     */
+    void setStates(const double *x);
+
+    /**
+     * Copy values of state variables computed by the last call to predictor
+     * @param x array of length numStates()
+     */
+    void getPredictedStates(double *x);
+
   private:
 
+    /**
+     * Collect the control blocks that carry state variables. Blocks that
+     * are bypassed because their time constant is zero are skipped
+     * @param blk array of (at least) 2 block pointers
+     * @return number of blocks
+     */
+    int stateBlocks(Cblock **blk);
+
     // Internal variables
     bool zero_TE; // If TE == 0 then the filter block is replaced by gain block
 
@@ -0,0 +1,103 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   early_termination_test.cpp
+ * @date   October 19, 2026
+ *
+ * @brief  Simulate a short fault on the 9 bus, 3 generator system, once
+ * to the end of the simulation and once with early termination turned on.
+ * Check that the second simulation stops before the end time because the
+ * system has settled and that both simulations get the same
+ * classification. Run as "early_termination_test.x input_early.xml"
+ */
+// -------------------------------------------------------------
+
+#include "mpi.h"
+#include <ga.h>
+#include <macdecls.h>
+#include "gridpack/include/gridpack.hpp"
+#include "gridpack/applications/modules/powerflow/pf_app_module.hpp"
+#include "gridpack/applications/modules/dynamic_simulation_full_y/dsf_app_module.hpp"
+
+int
+main(int argc, char **argv)
+{
+  gridpack::Environment env(argc,argv);
+  int ret = 0;
+
+  if (1) {
+    gridpack::parallel::Communicator world;
+    gridpack::utility::Configuration *config =
+      gridpack::utility::Configuration::configuration();
+    if (argc >= 2 && argv[1] != NULL) {
+      config->open(argv[1],world);
+    } else {
+      config->open("input_early.xml",world);
+    }
+
+    // solve power flow and set up dynamic simulation
+    boost::shared_ptr<gridpack::powerflow::PFNetwork>
+      pf_network(new gridpack::powerflow::PFNetwork(world));
+    gridpack::powerflow::PFAppModule pf_app;
+    pf_app.readNetwork(pf_network,config);
+    pf_app.initialize();
+    pf_app.solve();
+    pf_app.saveData();
+    boost::shared_ptr<gridpack::dynamic_simulation::DSFullNetwork>
+      ds_network(new gridpack::dynamic_simulation::DSFullNetwork(world));
+    pf_network->clone<gridpack::dynamic_simulation::DSFullBus,
+      gridpack::dynamic_simulation::DSFullBranch>(ds_network);
+    gridpack::dynamic_simulation::DSFullApp ds_app;
+    ds_app.transferPFtoDS(pf_network,ds_network);
+    ds_app.setNetwork(ds_network,config);
+    ds_app.readGenerators();
+    ds_app.initialize();
+    gridpack::utility::Configuration::CursorPtr cursor;
+    cursor = config->getCursor("Configuration.Dynamic_simulation");
+    std::vector<gridpack::dynamic_simulation::Event> faults;
+    faults = ds_app.getEvents(cursor);
+    double tend = cursor->get("simulationTime",0.0);
+
+    // run simulation to the end
+    ds_app.setEarlyTermination(false);
+    ds_app.setGeneratorWatch("early_full.csv");
+    ds_app.solve(faults[0]);
+    int full_secure = ds_app.isSecure();
+    bool full_early = ds_app.terminatedEarly();
+
+    // run the same simulation with early termination. The generators are
+    // damped, so the system settles well before the end time
+    ds_app.transferPFtoDS(pf_network,ds_network);
+    ds_app.reload();
+    ds_app.setEarlyTermination(true,0.5,1.0,180.0,0.0);
+    ds_app.setGeneratorWatch("early_stop.csv");
+    ds_app.solve(faults[0]);
+    int early_secure = ds_app.isSecure();
+    bool early = ds_app.terminatedEarly();
+    double tstop = ds_app.terminationTime();
+
+    bool ok = (!full_early && full_secure == -1 && early
+        && tstop > faults[0].end && tstop < tend
+        && early_secure == full_secure);
+    if (world.rank() == 0) {
+      printf("\nFull simulation secure: %s terminated early: %s\n",
+          full_secure == -1 ? "true" : "false",
+          full_early ? "true" : "false");
+      printf("Early termination secure: %s terminated at: %f"
+          " end time: %f\n",early_secure == -1 ? "true" : "false",
+          tstop,tend);
+      if (ok) {
+        printf("\nEarly termination test passed\n");
+      } else {
+        printf("\nEarly termination test failed\n");
+      }
+    }
+    if (!ok) ret = 1;
+  }
+
+  return ret;
+}
@@ -0,0 +1,166 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   islands_test.cpp
+ * @date   October 19, 2026
+ *
+ * @brief  Trip the two lines connecting load bus 5 of the 9 bus, 3
+ * generator system during a dynamic simulation. Check that the tripped
+ * lines split the network into two islands and that the voltage on the
+ * island without generation is zero. The lines are tripped by a scheduled
+ * line trip action and by distance relays, both when the simulation is
+ * run with solve and one step at a time. Run as
+ * "islands_test.x input_islands.xml"
+ */
+// -------------------------------------------------------------
+
+#include "mpi.h"
+#include <ga.h>
+#include <macdecls.h>
+#include "gridpack/include/gridpack.hpp"
+#include "gridpack/applications/modules/powerflow/pf_app_module.hpp"
+#include "gridpack/applications/modules/dynamic_simulation_full_y/dsf_app_module.hpp"
+
+/**
+ * Run a dynamic simulation in which bus 5 is disconnected from the rest of
+ * the network and check the islands at the end of the simulation
+ * @param world communicator
+ * @param config configuration holding input deck
+ * @param relay if true, the lines are tripped by relays in the second
+ *              generator file. Otherwise a line trip action is scheduled
+ * @param step if true, simulation is run one step at a time, otherwise
+ *             it is run with solve
+ * @return true if check passed
+ */
+bool runIslands(gridpack::parallel::Communicator &world,
+    gridpack::utility::Configuration *config, bool relay, bool step)
+{
+  // solve power flow and set up dynamic simulation
+  boost::shared_ptr<gridpack::powerflow::PFNetwork>
+    pf_network(new gridpack::powerflow::PFNetwork(world));
+  gridpack::powerflow::PFAppModule pf_app;
+  pf_app.readNetwork(pf_network,config);
+  pf_app.initialize();
+  pf_app.solve();
+  pf_app.saveData();
+  boost::shared_ptr<gridpack::dynamic_simulation::DSFullNetwork>
+    ds_network(new gridpack::dynamic_simulation::DSFullNetwork(world));
+  pf_network->clone<gridpack::dynamic_simulation::DSFullBus,
+    gridpack::dynamic_simulation::DSFullBranch>(ds_network);
+  gridpack::dynamic_simulation::DSFullApp ds_app;
+  ds_app.transferPFtoDS(pf_network,ds_network);
+  ds_app.setNetwork(ds_network,config);
+  ds_app.readGenerators(relay ? 1 : 0);
+  ds_app.initialize();
+  gridpack::utility::Configuration::CursorPtr cursor;
+  cursor = config->getCursor("Configuration.Dynamic_simulation");
+  std::vector<gridpack::dynamic_simulation::Event> faults;
+  faults = ds_app.getEvents(cursor);
+
+  if (!step) {
+    ds_app.solve(faults[0]);
+  } else {
+    ds_app.solvePreInitialize(faults[0]);
+    if (!relay) {
+      // run past the fault and trip both lines connected to bus 5
+      while (!ds_app.isDynSimuDone() && ds_app.getCurrentTime() < 0.1) {
+        ds_app.executeOneSimuStep();
+      }
+      std::vector<int> from, to;
+      std::vector<std::string> ckt;
+      from.push_back(4);
+      to.push_back(5);
+      ckt.push_back("BL");
+      from.push_back(5);
+      to.push_back(6);
+      ckt.push_back("BL");
+      ds_app.setLineTripActions(from,to,ckt);
+    }
+    while (!ds_app.isDynSimuDone()) {
+      ds_app.executeOneSimuStep();
+    }
+  }
+
+  // count islands using the branch status seen by the application
+  int nbranch = ds_network->numBranches();
+  int i, j;
+  std::vector<bool> inService(nbranch);
+  for (i=0; i<nbranch; i++) {
+    std::vector<bool> status = ds_network->getBranch(i)->getLineStatus();
+    inService[i] = false;
+    for (j=0; j<status.size(); j++) {
+      if (status[j]) inService[i] = true;
+    }
+  }
+  std::vector<int> island;
+  int nisland = ds_network->findIslands(inService,island);
+
+  // buses in the dead island must have been dropped during the simulation
+  // and have zero voltage. All other buses must have a finite voltage
+  int nbus = ds_network->numBuses();
+  int ichk[2] = {0, 0};
+  double vdead = 0.0;
+  for (i=0; i<nbus; i++) {
+    if (!ds_network->getActiveBus(i)) continue;
+    gridpack::dynamic_simulation::DSFullBus *bus
+      = ds_network->getBus(i).get();
+    double v = abs(bus->getComplexVoltage());
+    if (ds_network->getOriginalBusIndex(i) == 5) {
+      if (!bus->getDeadIsland()) ichk[0]++;
+      if (v > vdead) vdead = v;
+    } else {
+      if (bus->getDeadIsland() || v < 0.5) ichk[1]++;
+    }
+  }
+  world.sum(ichk,2);
+  world.max(&vdead,1);
+  int nlive = ds_app.checkIslands();
+  bool ok = (nisland == 2 && nlive == 1 && ichk[0] == 0 && ichk[1] == 0
+      && vdead < 1.0e-8);
+  if (world.rank() == 0) {
+    printf("\nLines tripped by %s, simulation run %s\n",
+        relay ? "relays" : "line trip action",
+        step ? "one step at a time" : "with solve");
+    printf("Number of islands: %d islands with generation: %d\n",
+        nisland,nlive);
+    printf("Voltage on bus 5: %12.4e\n",vdead);
+    printf("Buses in live islands with bad voltage: %d\n",ichk[1]);
+  }
+  return ok;
+}
+
+int
+main(int argc, char **argv)
+{
+  gridpack::Environment env(argc,argv);
+  int ret = 0;
+
+  if (1) {
+    gridpack::parallel::Communicator world;
+    gridpack::utility::Configuration *config =
+      gridpack::utility::Configuration::configuration();
+    if (argc >= 2 && argv[1] != NULL) {
+      config->open(argv[1],world);
+    } else {
+      config->open("input_islands.xml",world);
+    }
+
+    bool ok = runIslands(world,config,false,true);
+    ok = runIslands(world,config,true,false) && ok;
+    ok = runIslands(world,config,true,true) && ok;
+    if (world.rank() == 0) {
+      if (ok) {
+        printf("\nIsland test passed\n");
+      } else {
+        printf("\nIsland test failed\n");
+      }
+    }
+    if (!ok) ret = 1;
+  }
+
+  return ret;
+}
@@ -0,0 +1,196 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   recorder_test.cpp
+ * @date   October 19, 2026
+ *
+ * @brief  Record time series from a few generators with known values with
+ * the TimeSeriesRecorder, once in memory and once with the data written to
+ * a binary file in chunks, and check that the complete series is returned
+ * in both cases, before and after the recorder is flushed
+ */
+// -------------------------------------------------------------
+
+#include <stdio.h>
+#include <math.h>
+#include <vector>
+#include <string>
+#include "mpi.h"
+#include "gridpack/include/gridpack.hpp"
+#include "gridpack/applications/modules/dynamic_simulation_full_y/dsf_recorder.hpp"
+
+#define NGEN 3
+#define NCALLS 2537
+#define DECIMATION 2
+#define CHUNK 100
+
+/**
+ * Generator that returns known values for the watched variables
+ */
+class TestGenerator
+  : public gridpack::dynamic_simulation::BaseGeneratorModel
+{
+  public:
+    TestGenerator(int idx) : p_idx(idx), p_time(0.0) {}
+    void setTime(double time) { p_time = time; }
+    void getWatchValues(std::vector<double> &vals)
+    {
+      vals.clear();
+      int j;
+      for (j=0; j<gridpack::dynamic_simulation::TimeSeriesRecorder::GEN_SIGNALS;
+          j++) {
+        vals.push_back(signalValue(p_idx,j,p_time));
+      }
+    }
+    static double signalValue(int gen, int sig, double time)
+    {
+      return static_cast<double>(10*gen+sig)+sin(time+0.1*sig);
+    }
+  private:
+    int p_idx;
+    double p_time;
+};
+
+/**
+ * Time of recorded call
+ * @param call index of call to record
+ * @return time
+ */
+double callTime(int call)
+{
+  return 0.005*static_cast<double>(call);
+}
+
+/**
+ * Check that the recorder holds all recorded steps
+ * @param recorder time series recorder
+ * @param ncalls number of calls to record so far
+ * @param label description of check
+ * @return true if all values are correct
+ */
+bool checkRecorder(const gridpack::dynamic_simulation::TimeSeriesRecorder
+    &recorder, int ncalls, const char *label)
+{
+  int nsig = gridpack::dynamic_simulation::TimeSeriesRecorder::GEN_SIGNALS;
+  int nsteps = (ncalls+DECIMATION-1)/DECIMATION;
+  bool ok = true;
+  if (recorder.totalSteps() != nsteps) {
+    printf("%s: total steps %d expected %d\n",label,
+        recorder.totalSteps(),nsteps);
+    ok = false;
+  }
+  std::vector<double> times;
+  recorder.getTimes(times);
+  if (times.size() != nsteps) {
+    printf("%s: number of times %d expected %d\n",label,
+        static_cast<int>(times.size()),nsteps);
+    return false;
+  }
+  int i, j, k;
+  for (k=0; k<nsteps; k++) {
+    if (times[k] != callTime(k*DECIMATION)) {
+      printf("%s: time of step %d is %f expected %f\n",label,k,times[k],
+          callTime(k*DECIMATION));
+      return false;
+    }
+  }
+  std::vector<double> vals;
+  for (i=0; i<NGEN; i++) {
+    for (j=0; j<nsig; j++) {
+      recorder.getSignal(i*nsig+j,vals);
+      if (vals.size() != nsteps) {
+        printf("%s: signal %d has %d steps expected %d\n",label,i*nsig+j,
+            static_cast<int>(vals.size()),nsteps);
+        return false;
+      }
+      for (k=0; k<nsteps; k++) {
+        double v = TestGenerator::signalValue(i,j,times[k]);
+        if (vals[k] != v) {
+          printf("%s: signal %d step %d is %f expected %f\n",label,
+              i*nsig+j,k,vals[k],v);
+          return false;
+        }
+      }
+    }
+  }
+  return ok;
+}
+
+/**
+ * Record NCALLS calls, checking the recorder part way through
+ * @param recorder time series recorder
+ * @param gens generators being recorded
+ * @param label description of test
+ * @return true if all checks pass
+ */
+bool recordAll(gridpack::dynamic_simulation::TimeSeriesRecorder &recorder,
+    std::vector<TestGenerator*> &gens, const char *label)
+{
+  bool ok = true;
+  int n, i;
+  for (n=0; n<NCALLS; n++) {
+    for (i=0; i<NGEN; i++) gens[i]->setTime(callTime(n));
+    recorder.record(callTime(n));
+    if (n == NCALLS/2) {
+      if (!checkRecorder(recorder,n+1,label)) ok = false;
+    }
+  }
+  if (!checkRecorder(recorder,NCALLS,label)) ok = false;
+  recorder.flush();
+  if (!checkRecorder(recorder,NCALLS,label)) ok = false;
+  return ok;
+}
+
+int
+main(int argc, char **argv)
+{
+  gridpack::Environment env(argc,argv);
+  int ret = 0;
+
+  if (1) {
+    gridpack::parallel::Communicator world;
+    std::vector<TestGenerator*> gens;
+    gridpack::dynamic_simulation::TimeSeriesRecorder recorder;
+    int i;
+    for (i=0; i<NGEN; i++) {
+      gens.push_back(new TestGenerator(i));
+      recorder.addGenerator(gens[i]);
+    }
+
+    // Keep all data in memory. The buffer is sized for fewer steps than are
+    // recorded so that it has to grow
+    int chk = 1;
+    recorder.setup(NCALLS/4,DECIMATION);
+    if (!recordAll(recorder,gens,"Memory")) chk = 0;
+
+    // Write data to file in chunks
+    char buf[128];
+    sprintf(buf,"recorder_test_%d.bin",world.rank());
+    recorder.setup(NCALLS,DECIMATION,buf,CHUNK);
+    if (!recordAll(recorder,gens,"File")) chk = 0;
+    if (recorder.numSteps() > CHUNK) {
+      printf("File: %d steps held in memory, chunk size is %d\n",
+          recorder.numSteps(),CHUNK);
+      chk = 0;
+    }
+    remove(buf);
+
+    for (i=0; i<NGEN; i++) delete gens[i];
+
+    world.min(&chk,1);
+    if (world.rank() == 0) {
+      if (chk) {
+        printf("\nTime series recorder test passed\n");
+      } else {
+        printf("\nTime series recorder test failed\n");
+      }
+    }
+    if (!chk) ret = 1;
+  }
+
+  return ret;
+}
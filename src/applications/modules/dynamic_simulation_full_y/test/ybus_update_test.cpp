@@ -0,0 +1,133 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   ybus_update_test.cpp
+ * @date   October 19, 2026
+ *
+ * @brief  Apply a set of line trips and constant Y load changes to the
+ * Y-matrix of the 9 bus, 3 generator system with the selective update in
+ * DSFullApp::applyYbusChanges and check the change in the Y-matrix against
+ * a full recomputation. The change due to the line trips is compared with
+ * the difference between network admittance matrices built from scratch
+ * before and after the trips, and the change due to the loads with the
+ * increment evaluated over every bus in the network. Run as
+ * "ybus_update_test.x input_early.xml"
+ */
+// -------------------------------------------------------------
+
+#include "mpi.h"
+#include <ga.h>
+#include <macdecls.h>
+#include "gridpack/include/gridpack.hpp"
+#include "gridpack/applications/modules/powerflow/pf_app_module.hpp"
+#include "gridpack/applications/modules/dynamic_simulation_full_y/dsf_app_module.hpp"
+
+int
+main(int argc, char **argv)
+{
+  gridpack::Environment env(argc,argv);
+  int ret = 0;
+
+  if (1) {
+    gridpack::parallel::Communicator world;
+    gridpack::utility::Configuration *config =
+      gridpack::utility::Configuration::configuration();
+    if (argc >= 2 && argv[1] != NULL) {
+      config->open(argv[1],world);
+    } else {
+      config->open("input_early.xml",world);
+    }
+
+    // solve power flow and set up dynamic simulation
+    boost::shared_ptr<gridpack::powerflow::PFNetwork>
+      pf_network(new gridpack::powerflow::PFNetwork(world));
+    gridpack::powerflow::PFAppModule pf_app;
+    pf_app.readNetwork(pf_network,config);
+    pf_app.initialize();
+    pf_app.solve();
+    pf_app.saveData();
+    boost::shared_ptr<gridpack::dynamic_simulation::DSFullNetwork>
+      ds_network(new gridpack::dynamic_simulation::DSFullNetwork(world));
+    pf_network->clone<gridpack::dynamic_simulation::DSFullBus,
+      gridpack::dynamic_simulation::DSFullBranch>(ds_network);
+    gridpack::dynamic_simulation::DSFullApp ds_app;
+    ds_app.transferPFtoDS(pf_network,ds_network);
+    ds_app.setNetwork(ds_network,config);
+    ds_app.readGenerators();
+    ds_app.initialize();
+
+    // build the Y-matrix without a disturbance
+    gridpack::dynamic_simulation::Event event;
+    event.start = ds_app.getFinalTime();
+    event.end = ds_app.getFinalTime();
+    ds_app.solvePreInitialize(event);
+    boost::shared_ptr<gridpack::math::Matrix> Y0(ds_app.getYbus()->clone());
+
+    // network admittance matrix before the line trips
+    gridpack::dynamic_simulation::DSFullFactory factory(ds_network);
+    gridpack::mapper::FullMatrixMap<gridpack::dynamic_simulation::DSFullNetwork>
+      map(ds_network);
+    factory.setMode(gridpack::dynamic_simulation::YBUS);
+    boost::shared_ptr<gridpack::math::Matrix> Yb0(map.mapToMatrix());
+
+    // change set: trip line 5-6 and change the loads on buses 7 and 9
+    std::vector<int> from, to;
+    std::vector<std::string> ckts;
+    from.push_back(5);
+    to.push_back(6);
+    ckts.push_back("BL");
+    ds_app.setLineTripActions(from,to,ckts);
+    ds_app.applyConstYLoad_Change_P(7,-20.0);
+    ds_app.applyConstYLoad_Change_Q(9,10.0);
+
+    // load increments evaluated over every bus
+    boost::shared_ptr<gridpack::math::Matrix> Yl(Y0->clone());
+    factory.setMode(gridpack::dynamic_simulation::bus_Yload_change_P);
+    map.incrementMatrix(*Yl);
+    factory.setMode(gridpack::dynamic_simulation::bus_Yload_change_Q);
+    map.incrementMatrix(*Yl);
+
+    // selective update
+    ds_app.applyYbusChanges();
+    boost::shared_ptr<gridpack::math::Matrix> Y1(ds_app.getYbus()->clone());
+
+    // network admittance matrix after the line trips
+    factory.setMode(gridpack::dynamic_simulation::YBUS);
+    boost::shared_ptr<gridpack::math::Matrix> Yb1(map.mapToMatrix());
+
+    // Y1 - Y0 should equal (Yb1 - Yb0) + (Yl - Y0)
+    Y0->scale(-1.0);
+    Yb0->scale(-1.0);
+    boost::shared_ptr<gridpack::math::Matrix> dtrip(Yb1->clone());
+    dtrip->add(*Yb0);
+    boost::shared_ptr<gridpack::math::Matrix> dload(Yl->clone());
+    dload->add(*Y0);
+    boost::shared_ptr<gridpack::math::Matrix> diff(Y1->clone());
+    diff->add(*Y0);
+    diff->scale(-1.0);
+    diff->add(*dtrip);
+    diff->add(*dload);
+    double dnorm = diff->norm2();
+    double tnorm = dtrip->norm2();
+    double lnorm = dload->norm2();
+    bool ok = (dnorm <= 1.0e-10*(tnorm+lnorm) && tnorm > 0.0 && lnorm > 0.0);
+    if (world.rank() == 0) {
+      printf("\nNorm of change due to line trip: %e\n",tnorm);
+      printf("Norm of change due to load changes: %e\n",lnorm);
+      printf("Difference between selective update and full recomputation:"
+          " %e\n",dnorm);
+      if (ok) {
+        printf("\nY-matrix update test passed\n");
+      } else {
+        printf("\nY-matrix update test failed\n");
+      }
+    }
+    if (!ok) ret = 1;
+  }
+
+  return ret;
+}
@@ -24,6 +24,7 @@
 #include "gridpack/mapper/full_map.hpp"
 #include "gridpack/mapper/gen_slab_map.hpp"
 #include "kds_app_module.hpp"
+#include "kds_ensemble.hpp"
 
 // Calling program for state estimation application
 
@@ -373,6 +374,7 @@ void gridpack::kalman_filter::KalmanApp::initialize()
   double noise = secursor->get("noiseScale",0.1);
   int iseed = secursor->get("randomSeed",11238);
   int maxstep = secursor->get("maxSteps",0);
+  p_denseEnsemble = secursor->get("denseEnsemble",false);
   p_Rm1 = 1.0/(noise*noise);
   if (p_CheckEqn) {
     nsize = 1; sigma = 0.0; noise = 0.0;
@@ -388,6 +390,9 @@ void gridpack::kalman_filter::KalmanApp::initialize()
   sprintf(ioBuf,"Gaussian Width: %16.8f\n",sigma); p_busIO->header(ioBuf);
   sprintf(ioBuf,"Noise Scale: %16.8f\n",noise); p_busIO->header(ioBuf);
   sprintf(ioBuf,"Random Number Seed: %d\n",iseed); p_busIO->header(ioBuf);
+  if (p_denseEnsemble && !p_CheckEqn) {
+    sprintf(ioBuf,"Using dense ensemble analysis\n"); p_busIO->header(ioBuf);
+  }
   
   // Initialize random number generator
   gridpack::random::Random random;
@@ -524,7 +529,26 @@ void gridpack::kalman_filter::KalmanApp::solve()
   // ensemble HX matrix
   p_factory->setMode(Measurements);
   p_factory->setCurrentTimeStep(p_TimeOffset+1);
-  boost::shared_ptr<gridpack::math::Matrix> D = hxSlab.mapToMatrix();
+  // Local column-major copies of the ensemble matrices are used by the
+  // dense analysis. These are allocated once and reused at every time step
+  bool dense = p_denseEnsemble && !p_CheckEqn;
+  boost::shared_ptr<KalmanEnsemble> ensemble;
+  boost::shared_ptr<gridpack::math::Matrix> D;
+  std::vector<ComplexType> A_d, HA_d, Y_d, D_d, X_inc_d;
+  int nx = xSlab.localRows();
+  int nh = hxSlab.localRows();
+  if (dense) {
+    int nens = xSlab.numColumns();
+    ensemble.reset(new KalmanEnsemble(p_comm,nens,p_Rm1,p_Rm1n,p_N_inv));
+    A_d.resize(nx*nens);
+    X_inc_d.resize(nx*nens);
+    HA_d.resize(nh*nens);
+    Y_d.resize(nh*nens);
+    D_d.resize(nh*nens);
+    hxSlab.mapToDense(&D_d[0]);
+  } else {
+    D = hxSlab.mapToMatrix();
+  }
 
   char ioBuf[128];
   sprintf(ioBuf,"%12.6f",static_cast<double>(0.0));
@@ -667,7 +691,55 @@ void gridpack::kalman_filter::KalmanApp::solve()
     timer->stop(t_onlyDAE);
     timer->start(t_EnKF);
     
-  if (!(p_CheckEqn)) {
+  if (dense) {
+    int t_A = timer->createCategory("KF: In-Loop EnKF A");
+    timer->start(t_A);
+    // Create perturbation matrix for X3
+    p_factory->setMode(Perturbation);
+    xSlab.mapToDense(&A_d[0]);
+    timer->stop(t_A);
+
+    int t_ensmb3 = timer->createCategory("KF: In-Loop EnKF E_ensmb3");
+    timer->start(t_ensmb3);
+    p_factory->setMode(E_Ensemble3);
+    boost::shared_ptr<gridpack::math::Matrix> E_ensmb3 = eSlab.mapToMatrix();
+    timer->stop(t_ensmb3);
+
+    int t_V3 = timer->createCategory("KF: In-Loop EnKF V3");
+    timer->start(t_V3);
+    boost::shared_ptr<gridpack::math::Matrix> v3(multiply(*RecV, *E_ensmb3));
+    p_factory->setMode(V3);
+    v3Slab.mapToNetwork(v3);
+    timer->stop(t_V3);
+
+    // Create Y = D-HX
+    int t_Y = timer->createCategory("KF: In-Loop EnKF Y");
+    timer->start(t_Y);
+    int i;
+    p_factory->setMode(HX);
+    hxSlab.mapToDense(&HA_d[0]);
+    for (i=0; i<static_cast<int>(Y_d.size()); i++) Y_d[i] = D_d[i]-HA_d[i];
+    timer->stop(t_Y);
+
+    int t_HA = timer->createCategory("KF: In-Loop EnKF HA");
+    timer->start(t_HA);
+    p_factory->setMode(HA);
+    hxSlab.mapToDense(&HA_d[0]);
+    timer->stop(t_HA);
+
+    int t_W = timer->createCategory("KF: In-Loop EnKF Dense Analysis");
+    timer->start(t_W);
+    if (!ensemble->analysis(nx,&A_d[0],nh,&HA_d[0],&Y_d[0],&X_inc_d[0])) {
+      throw gridpack::Exception("KalmanApp::solve: singular ensemble matrix");
+    }
+    timer->stop(t_W);
+
+    int t_Update = timer->createCategory("KF: In-Loop EnKF X Update");
+    timer->start(t_Update);
+    p_factory->setMode(X_INC);
+    xSlab.mapToNetwork(&X_inc_d[0]);
+    timer->stop(t_Update);
+  } else if (!(p_CheckEqn)) {
     int t_A = timer->createCategory("KF: In-Loop EnKF A");
     timer->start(t_A);    
     // Create perturbation matrix for X3
@@ -796,7 +868,11 @@ void gridpack::kalman_filter::KalmanApp::solve()
     
     // Create measurement matrix for next timestep
     p_factory->setMode(Measurements);
-    hxSlab.mapToMatrix(D);
+    if (dense) {
+      hxSlab.mapToDense(&D_d[0]);
+    } else {
+      hxSlab.mapToMatrix(D);
+    }
 
     sprintf(ioBuf,"%12.6f",static_cast<double>(I_Steps-1)*p_delta_t);
     p_deltaIO->header(ioBuf);
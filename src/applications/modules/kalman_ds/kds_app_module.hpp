@@ -140,6 +140,9 @@ class KalmanApp
     // Check equation flag
     int p_CheckEqn;
 
+    // Use dense BLAS-3 analysis step for the ensemble
+    bool p_denseEnsemble;
+
     // Fault list
     std::vector<gridpack::kalman_filter::KalmanBranch::Event> p_faults;
 
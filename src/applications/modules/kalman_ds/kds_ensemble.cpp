@@ -0,0 +1,116 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   kds_ensemble.cpp
+ * @date   October 19, 2026
+ *
+ * @brief
+ *
+ *
+ */
+// -------------------------------------------------------------
+
+#include "kds_ensemble.hpp"
+
+/**
+ * Basic constructor
+ * @param comm communicator for network
+ * @param nens number of ensemble members
+ * @param rm1 scale factor for H(A)^T*Y
+ * @param rm1n scale factor for H(A)^T*H(A)
+ * @param n_inv scale factor for state increment
+ */
+gridpack::kalman_filter::KalmanEnsemble::KalmanEnsemble(
+    const gridpack::parallel::Communicator &comm, int nens,
+    double rm1, double rm1n, double n_inv)
+  : p_comm(comm), p_nens(nens), p_rm1(rm1), p_rm1n(rm1n), p_n_inv(n_inv)
+{
+  p_H1Z1.resize(2*nens*nens);
+  p_Q.resize(nens*nens);
+  p_W.resize(nens*nens);
+  p_Z2.resize(nens*nens);
+  p_ipiv.resize(nens);
+}
+
+/**
+ * Basic destructor
+ */
+gridpack::kalman_filter::KalmanEnsemble::~KalmanEnsemble()
+{
+}
+
+/**
+ * Evaluate the increment to the ensemble of states
+ *   Q = rm1n*HA^T*HA + I, Z1 = rm1*HA^T*Y,
+ *   Z2 = Z1 - (Q-I)*Q^{-1}*Z1, X_inc = n_inv*A*Z2
+ * All arrays are column-major and hold only the rows on this processor
+ * @param nx number of local rows in state ensemble
+ * @param A perturbation of state ensemble (nx x nens)
+ * @param nh number of local rows in measurement ensemble
+ * @param HA measurement perturbation (nh x nens)
+ * @param Y innovation D - HX (nh x nens)
+ * @param X_inc returns increment of state ensemble (nx x nens)
+ * @return false if Q is singular
+ */
+bool gridpack::kalman_filter::KalmanEnsemble::analysis(int nx,
+    const ComplexType *A, int nh, const ComplexType *HA,
+    const ComplexType *Y, ComplexType *X_inc)
+{
+  typedef gridpack::math::LapackInt LapackInt;
+  LapackInt n = p_nens;
+  LapackInt nn = n*n;
+  LapackInt info;
+  int i, j;
+  LapackInt lnx = nx;
+  LapackInt lnh = nh;
+  LapackInt ldh = nh > 0 ? nh : 1;
+  LapackInt ldx = nx > 0 ? nx : 1;
+  ComplexType *H1 = &p_H1Z1[0];
+  ComplexType *Z1 = &p_H1Z1[nn];
+  ComplexType *Q = &p_Q[0];
+  ComplexType *W = &p_W[0];
+  ComplexType *Z2 = &p_Z2[0];
+  const ComplexType zero(0.0,0.0);
+  const ComplexType one(1.0,0.0);
+  const ComplexType mone(-1.0,0.0);
+
+  // Local contributions to H1 = rm1n*HA^T*HA and Z1 = rm1*HA^T*Y. H1 is
+  // symmetric so only the upper triangle is evaluated
+  ComplexType alpha(p_rm1n,0.0);
+  for (i=0; i<2*nn; i++) p_H1Z1[i] = zero;
+  if (nh > 0) {
+    zsyrk_("U","T",&n,&lnh,&alpha,HA,&ldh,&zero,H1,&n);
+    alpha = ComplexType(p_rm1,0.0);
+    zgemm_("T","N",&n,&n,&lnh,&alpha,HA,&ldh,Y,&ldh,&zero,Z1,&n);
+  }
+  p_comm.sum(&p_H1Z1[0],2*nn);
+  for (j=0; j<n; j++) {
+    for (i=j+1; i<n; i++) {
+      H1[j*n+i] = H1[i*n+j];
+    }
+  }
+
+  // Factor Q = H1 + I and solve Q*W = Z1
+  for (i=0; i<nn; i++) Q[i] = H1[i];
+  for (i=0; i<n; i++) Q[i*n+i] += one;
+  zgetrf_(&n,&n,Q,&n,&p_ipiv[0],&info);
+  if (info != 0) return false;
+  for (i=0; i<nn; i++) W[i] = Z1[i];
+  zgetrs_("N",&n,&n,Q,&n,&p_ipiv[0],W,&n,&info);
+  if (info != 0) return false;
+
+  // Z2 = Z1 - H1*W
+  for (i=0; i<nn; i++) Z2[i] = Z1[i];
+  zgemm_("N","N",&n,&n,&n,&mone,H1,&n,W,&n,&one,Z2,&n);
+
+  // X_inc = n_inv*A*Z2
+  if (nx > 0) {
+    alpha = ComplexType(p_n_inv,0.0);
+    zgemm_("N","N",&lnx,&n,&n,&alpha,A,&ldx,Z2,&n,&zero,X_inc,&ldx);
+  }
+  return true;
+}
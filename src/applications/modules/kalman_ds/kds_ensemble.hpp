@@ -0,0 +1,89 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   kds_ensemble.hpp
+ * @date   October 19, 2026
+ *
+ * @brief  Dense analysis step of the ensemble Kalman filter. The ensemble
+ * matrices are tall and skinny (many states, few ensemble members) so each
+ * processor keeps its rows of the ensemble in contiguous column-major
+ * arrays and the analysis is done with BLAS-3 and LAPACK calls. The only
+ * communication is a single reduction of the small ensemble-by-ensemble
+ * matrices. All work arrays are allocated once and reused at every time
+ * step.
+ *
+ *
+ */
+// -------------------------------------------------------------
+
+#ifndef _kds_ensemble_h_
+#define _kds_ensemble_h_
+
+#include <vector>
+#include "gridpack/parallel/communicator.hpp"
+#include "gridpack/utilities/complex.hpp"
+#include "gridpack/math/complex_lapack.hpp"
+
+namespace gridpack {
+namespace kalman_filter {
+
+class KalmanEnsemble
+{
+  public:
+    /**
+     * Basic constructor
+     * @param comm communicator for network
+     * @param nens number of ensemble members
+     * @param rm1 scale factor for H(A)^T*Y
+     * @param rm1n scale factor for H(A)^T*H(A)
+     * @param n_inv scale factor for state increment
+     */
+    KalmanEnsemble(const gridpack::parallel::Communicator &comm, int nens,
+        double rm1, double rm1n, double n_inv);
+
+    /**
+     * Basic destructor
+     */
+    ~KalmanEnsemble();
+
+    /**
+     * Evaluate the increment to the ensemble of states
+     *   Q = rm1n*HA^T*HA + I, Z1 = rm1*HA^T*Y,
+     *   Z2 = Z1 - (Q-I)*Q^{-1}*Z1, X_inc = n_inv*A*Z2
+     * All arrays are column-major and hold only the rows on this processor
+     * @param nx number of local rows in state ensemble
+     * @param A perturbation of state ensemble (nx x nens)
+     * @param nh number of local rows in measurement ensemble
+     * @param HA measurement perturbation (nh x nens)
+     * @param Y innovation D - HX (nh x nens)
+     * @param X_inc returns increment of state ensemble (nx x nens)
+     * @return false if Q is singular
+     */
+    bool analysis(int nx, const ComplexType *A, int nh, const ComplexType *HA,
+        const ComplexType *Y, ComplexType *X_inc);
+
+  private:
+
+    gridpack::parallel::Communicator p_comm;
+
+    int p_nens;
+    double p_rm1;
+    double p_rm1n;
+    double p_n_inv;
+
+    // Work arrays of size nens x nens. H1 and Z1 are contiguous so that
+    // they can be reduced in one call
+    std::vector<ComplexType> p_H1Z1;
+    std::vector<ComplexType> p_Q;
+    std::vector<ComplexType> p_W;
+    std::vector<ComplexType> p_Z2;
+    std::vector<gridpack::math::LapackInt> p_ipiv;
+};
+
+} // kalman_filter
+} // gridpack
+#endif
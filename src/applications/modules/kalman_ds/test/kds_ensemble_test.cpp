@@ -0,0 +1,181 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   kds_ensemble_test.cpp
+ * @date   October 19, 2026
+ *
+ * @brief  Evaluate the ensemble increment for a small ensemble with the
+ * dense analysis in KalmanEnsemble and with the distributed matrix
+ * operations and sparse solve used by the original Kalman filter and check
+ * that both give the same result. Processors own different numbers of rows
+ * so that the reduction in the dense analysis is exercised
+ */
+// -------------------------------------------------------------
+
+#include <math.h>
+#include <stdio.h>
+#include <vector>
+#include "mpi.h"
+#include <ga.h>
+#include <macdecls.h>
+#include "gridpack/include/gridpack.hpp"
+#include "kds_ensemble.hpp"
+
+#define NENS 5
+
+/**
+ * Deterministic value of an ensemble element
+ * @param seed different for each matrix
+ * @param row global row index
+ * @param col ensemble member
+ * @return element value
+ */
+gridpack::ComplexType ensembleValue(int seed, int row, int col)
+{
+  double x = static_cast<double>(seed*1000+row*NENS+col);
+  return gridpack::ComplexType(sin(0.7*x+0.3),0.5*cos(1.3*x));
+}
+
+/**
+ * Create a distributed dense matrix with nlocal rows on this processor and
+ * fill it with ensemble values. Also copy the local rows into a column-major
+ * array
+ * @param comm communicator
+ * @param seed different for each matrix
+ * @param nlocal number of local rows
+ * @param local returns column-major copy of local rows
+ * @return new matrix
+ */
+gridpack::math::Matrix* createEnsemble(
+    const gridpack::parallel::Communicator &comm, int seed, int nlocal,
+    std::vector<gridpack::ComplexType> &local)
+{
+  gridpack::math::Matrix *mat =
+    gridpack::math::Matrix::createDense(comm, 0, NENS, nlocal, 0);
+  int lo, hi;
+  mat->localRowRange(lo,hi);
+  local.resize(nlocal*NENS);
+  int i, j;
+  for (i=0; i<nlocal; i++) {
+    for (j=0; j<NENS; j++) {
+      gridpack::ComplexType v = ensembleValue(seed,lo+i,j);
+      mat->setElement(lo+i,j,v);
+      local[j*nlocal+i] = v;
+    }
+  }
+  mat->ready();
+  return mat;
+}
+
+int
+main(int argc, char **argv)
+{
+  gridpack::Environment env(argc,argv);
+  int ret = 0;
+
+  if (1) {
+    gridpack::parallel::Communicator world;
+    int me = world.rank();
+
+    // read configuration file
+    gridpack::utility::Configuration *config =
+      gridpack::utility::Configuration::configuration();
+    if (argc >= 2 && argv[1] != NULL) {
+      char inputfile[256];
+      sprintf(inputfile,"%s",argv[1]);
+      config->open(inputfile,world);
+    } else {
+      config->open("input_ensemble.xml",world);
+    }
+    gridpack::utility::Configuration::CursorPtr cursor =
+      config->getCursor("Configuration.Kalman_filter");
+
+    // Scale factors chosen as in the Kalman filter for a measurement
+    // variance of 0.1
+    double n_inv = 1.0/static_cast<double>(NENS-1);
+    double rm1 = 1.0/0.1;
+    double rm1n = rm1*n_inv;
+
+    int nx = 6 + me%3;
+    int nh = 3 + me%2;
+    std::vector<gridpack::ComplexType> a, ha, y;
+    boost::shared_ptr<gridpack::math::Matrix> A(createEnsemble(world,1,nx,a));
+    boost::shared_ptr<gridpack::math::Matrix>
+      HA(createEnsemble(world,2,nh,ha));
+    boost::shared_ptr<gridpack::math::Matrix> Y(createEnsemble(world,3,nh,y));
+
+    int chk = 1;
+
+    // Dense analysis
+    std::vector<gridpack::ComplexType> x_inc(nx*NENS);
+    gridpack::kalman_filter::KalmanEnsemble ensemble(world,NENS,rm1,rm1n,
+        n_inv);
+    if (!ensemble.analysis(nx,&a[0],nh,&ha[0],&y[0],&x_inc[0])) {
+      if (me == 0) printf("Dense analysis failed\n");
+      chk = 0;
+    }
+
+    // Sparse analysis, same sequence of operations as
+    // KalmanApp::solve
+    boost::shared_ptr<gridpack::math::Matrix> HA_t(transpose(*HA));
+    boost::shared_ptr<gridpack::math::Matrix> Q(multiply(*HA_t,*HA));
+    Q->scale(rm1n);
+    boost::shared_ptr<gridpack::math::Matrix> H1(Q->clone());
+    gridpack::ComplexType z_one(1.0,0.0);
+    Q->addDiagonal(z_one);
+    boost::shared_ptr<gridpack::math::Matrix> Z1(multiply(*HA_t,*Y));
+    Z1->scale(rm1);
+    boost::shared_ptr<gridpack::math::Matrix>
+      Q_sparse(gridpack::math::storageType(*Q,
+            gridpack::math::Sparse));
+    gridpack::math::LinearMatrixSolver solver(*Q_sparse);
+    solver.configure(cursor);
+    boost::shared_ptr<gridpack::math::Matrix> W(solver.solve(*Z1));
+    boost::shared_ptr<gridpack::math::Matrix> Z2(multiply(*H1,*W));
+    Z2->scale(-1);
+    Z2->add(*Z1);
+    boost::shared_ptr<gridpack::math::Matrix> X_inc(multiply(*A,*Z2));
+    X_inc->scale(n_inv);
+
+    // Compare local rows of both increments
+    int lo, hi;
+    X_inc->localRowRange(lo,hi);
+    double diff = 0.0;
+    double xmax = 0.0;
+    if (hi-lo != nx) {
+      printf("p[%d] Sparse increment has %d local rows, expected %d\n",
+          me,hi-lo,nx);
+      chk = 0;
+    } else {
+      int i, j;
+      for (i=0; i<nx; i++) {
+        for (j=0; j<NENS; j++) {
+          gridpack::ComplexType v;
+          X_inc->getElement(lo+i,j,v);
+          double d = abs(v-x_inc[j*nx+i]);
+          if (d > diff) diff = d;
+          if (abs(v) > xmax) xmax = abs(v);
+        }
+      }
+    }
+    world.max(&diff,1);
+    world.max(&xmax,1);
+    if (me == 0) printf("Maximum difference between dense and sparse"
+        " increments: %e (maximum increment: %e)\n",diff,xmax);
+    if (!(diff <= 1.0e-10*xmax) || xmax == 0.0) chk = 0;
+
+    world.min(&chk,1);
+    if (chk) {
+      if (me == 0) printf("\nKalman ensemble test passed\n");
+    } else {
+      if (me == 0) printf("\nKalman ensemble test failed\n");
+      ret = 1;
+    }
+  }
+
+  return ret;
+}
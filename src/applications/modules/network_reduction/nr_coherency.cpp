@@ -0,0 +1,724 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   nr_coherency.cpp
+ * @date   October 19, 2026
+ *
+ * @brief
+ *
+ *
+ */
+// -------------------------------------------------------------
+
+#include <math.h>
+#include <stdio.h>
+#include <map>
+#include <algorithm>
+#include "mpi.h"
+#include "gridpack/parser/dictionary.hpp"
+#include "gridpack/timer/coarse_timer.hpp"
+#include "gridpack/utilities/string_utils.hpp"
+#include "gridpack/utilities/exception.hpp"
+#include "nr_coherency.hpp"
+
+#define NR_MAX_PARAMS 20
+
+namespace {
+
+// Dynamic models that can be aggregated and written to DYR files. The
+// parameters are listed in the order they appear in the DYR record,
+// starting with the fourth field. The rule for aggregating each
+// parameter is
+//   w: MVA weighted average
+//   h: parallel combination (reactances and droop on machine base)
+//   r: MVA weighted average rounded to the nearest integer (flags)
+struct DyrModel {
+  const char *name;
+  int type;
+  int nparam;
+  const char *rules;
+  const char *keys[NR_MAX_PARAMS];
+};
+
+const DyrModel dyrModels[] = {
+  {"GENCLS", 0, 2, "ww",
+    {GENERATOR_INERTIA_CONSTANT_H, GENERATOR_DAMPING_COEFFICIENT_0}},
+  {"GENROU", 0, 14, "wwwwwwhhhhhhww",
+    {GENERATOR_TDOP, GENERATOR_TDOPP, GENERATOR_TQOP, GENERATOR_TQOPP,
+     GENERATOR_INERTIA_CONSTANT_H, GENERATOR_DAMPING_COEFFICIENT_0,
+     GENERATOR_XD, GENERATOR_XQ, GENERATOR_XDP, GENERATOR_XQP,
+     GENERATOR_XDPP, GENERATOR_XL, GENERATOR_S1, GENERATOR_S12}},
+  {"GENSAL", 0, 12, "wwwwwhhhhhww",
+    {GENERATOR_TDOP, GENERATOR_TDOPP, GENERATOR_TQOPP,
+     GENERATOR_INERTIA_CONSTANT_H, GENERATOR_DAMPING_COEFFICIENT_0,
+     GENERATOR_XD, GENERATOR_XQ, GENERATOR_XDP, GENERATOR_XDPP,
+     GENERATOR_XL, GENERATOR_S1, GENERATOR_S12}},
+  {"SEXS", 1, 6, "wwwwww",
+    {EXCITER_TA_OVER_TB, EXCITER_TB, EXCITER_K, EXCITER_TE, EXCITER_EMIN,
+     EXCITER_EMAX}},
+  {"EXDC1", 1, 16, "wwwwwwwwwwwrwwww",
+    {EXCITER_TR, EXCITER_KA, EXCITER_TA, EXCITER_TB, EXCITER_TC,
+     EXCITER_VRMAX, EXCITER_VRMIN, EXCITER_KE, EXCITER_TE, EXCITER_KF,
+     EXCITER_TF1, EXCITER_SWITCH, EXCITER_E1, EXCITER_SE1, EXCITER_E2,
+     EXCITER_SE2}},
+  {"IEEET1", 1, 14, "wwwwwwwwwrwwww",
+    {EXCITER_TR, EXCITER_KA, EXCITER_TA, EXCITER_VRMAX, EXCITER_VRMIN,
+     EXCITER_KE, EXCITER_TE, EXCITER_KF, EXCITER_TF1, EXCITER_SWITCH,
+     EXCITER_E1, EXCITER_SE1, EXCITER_E2, EXCITER_SE2}},
+  {"ESST1A", 1, 20, "rrwwwwwwwwwwwwwwwwww",
+    {EXCITER_UEL, EXCITER_VOS, EXCITER_TR, EXCITER_VIMAX, EXCITER_VIMIN,
+     EXCITER_TC, EXCITER_TB, EXCITER_TC1, EXCITER_TB1, EXCITER_KA,
+     EXCITER_TA, EXCITER_VAMAX, EXCITER_VAMIN, EXCITER_VRMAX, EXCITER_VRMIN,
+     EXCITER_KC, EXCITER_KF, EXCITER_TF, EXCITER_KLR, EXCITER_ILR}},
+  {"TGOV1", 2, 7, "hwwwwww",
+    {GOVERNOR_R, GOVERNOR_T1, GOVERNOR_VMAX, GOVERNOR_VMIN, GOVERNOR_T2,
+     GOVERNOR_T3, GOVERNOR_DT}},
+  {"GAST", 2, 9, "hwwwwwwww",
+    {GOVERNOR_R, GOVERNOR_T1, GOVERNOR_T2, GOVERNOR_T3, GOVERNOR_AT,
+     GOVERNOR_KT, GOVERNOR_VMAX, GOVERNOR_VMIN, GOVERNOR_DT}},
+  {"HYGOV", 2, 12, "hwwwwwwwwwww",
+    {GOVERNOR_R, GOVERNOR_r, GOVERNOR_TR, GOVERNOR_TF, GOVERNOR_TG,
+     GOVERNOR_VELM, GOVERNOR_GMAX, GOVERNOR_GMIN, GOVERNOR_TW, GOVERNOR_AT,
+     GOVERNOR_DT, GOVERNOR_QNL}}
+};
+
+const int numDyrModels = sizeof(dyrModels)/sizeof(DyrModel);
+
+// Data collection keys for the model name and the flag indicating that
+// the model is present, for each model type
+const char *modelKeys[3] = {GENERATOR_MODEL, EXCITER_MODEL, GOVERNOR_MODEL};
+const char *hasKeys[3] = {NULL, HAS_EXCITER, HAS_GOVERNOR};
+
+}
+
+/**
+ * Basic constructor
+ * @param network dynamic simulation network containing the full system.
+ *        Generator parameters must have been read in
+ */
+gridpack::network_reduction::CoherencyEquivalent::CoherencyEquivalent(
+    boost::shared_ptr<gridpack::dynamic_simulation::DSFullNetwork> network)
+  : p_network(network), p_comm(network->communicator())
+{
+  p_tolerance = 5.0;
+  p_probeTime = 2.0;
+  p_nGroups = 0;
+}
+
+/**
+ * Basic destructor
+ */
+gridpack::network_reduction::CoherencyEquivalent::~CoherencyEquivalent()
+{
+}
+
+/**
+ * Read parameters from the network reduction block of the input file
+ * @param cursor pointer to network reduction block
+ */
+void gridpack::network_reduction::CoherencyEquivalent::configure(
+    gridpack::utility::Configuration::CursorPtr cursor)
+{
+  if (cursor == NULL) return;
+  gridpack::utility::StringUtils util;
+  std::string list;
+  std::vector<std::string> tokens;
+  int i;
+  list = cursor->get("studyAreas","");
+  tokens = util.blankTokenizer(list);
+  p_areas.clear();
+  for (i=0; i<tokens.size(); i++) p_areas.push_back(atoi(tokens[i].c_str()));
+  list = cursor->get("studyZones","");
+  tokens = util.blankTokenizer(list);
+  p_zones.clear();
+  for (i=0; i<tokens.size(); i++) p_zones.push_back(atoi(tokens[i].c_str()));
+  p_tolerance = cursor->get("coherencyTolerance",5.0);
+  p_probeTime = cursor->get("probeTime",2.0);
+}
+
+/**
+ * Set areas that make up the study system
+ * @param areas list of area numbers
+ */
+void gridpack::network_reduction::CoherencyEquivalent::setStudyAreas(
+    const std::vector<int> &areas)
+{
+  p_areas = areas;
+}
+
+/**
+ * Restrict study system to buses in these zones
+ * @param zones list of zone numbers
+ */
+void gridpack::network_reduction::CoherencyEquivalent::setStudyZones(
+    const std::vector<int> &zones)
+{
+  p_zones = zones;
+}
+
+/**
+ * Set the maximum difference between the rotor angle swings of two
+ * generators that are considered coherent
+ * @param tol tolerance (degrees)
+ */
+void gridpack::network_reduction::CoherencyEquivalent::setCoherencyTolerance(
+    double tol)
+{
+  p_tolerance = tol;
+}
+
+/**
+ * Set length of probing simulation
+ * @param time simulation time (seconds)
+ */
+void gridpack::network_reduction::CoherencyEquivalent::setProbeTime(
+    double time)
+{
+  p_probeTime = time;
+}
+
+/**
+ * Run a probing simulation and sort external generator buses into
+ * coherent groups
+ * @param app dynamic simulation application
+ * @param probe disturbance used to excite the system
+ */
+void gridpack::network_reduction::CoherencyEquivalent::identifyGroups(
+    gridpack::dynamic_simulation::DSFullApp &app,
+    gridpack::dynamic_simulation::Event probe)
+{
+  gridpack::utility::CoarseTimer *timer =
+    gridpack::utility::CoarseTimer::instance();
+  int t_coh = timer->createCategory("Network Reduction: Coherency");
+  timer->start(t_coh);
+  if (p_areas.size() == 0) {
+    char buf[256];
+    sprintf(buf,"CoherencyEquivalent::identifyGroups: no study areas specified\n");
+    if (p_comm.rank() == 0) printf("%s",buf);
+    throw gridpack::Exception(buf);
+  }
+  int me = p_comm.rank();
+  int nprocs = p_comm.size();
+  int nbus = p_network->numBuses();
+  int i, j;
+
+  // The swing of each external generator bus is represented by the
+  // largest in-service machine with a supported model on the bus
+  std::vector<int> lbus, ltag;
+  std::vector<double> lmva;
+  for (i=0; i<nbus; i++) {
+    if (!p_network->getActiveBus(i)) continue;
+    boost::shared_ptr<gridpack::component::DataCollection> data
+      = p_network->getBusData(i);
+    if (inStudySystem(data)) continue;
+    int ngen = 0;
+    data->getValue(GENERATOR_NUMBER,&ngen);
+    double best = -1.0;
+    std::string tag;
+    for (j=0; j<ngen; j++) {
+      int stat = 0;
+      double mva = 0.0;
+      data->getValue(GENERATOR_STAT,&stat,j);
+      if (stat != 1 || getModel(data,j,0) < 0) continue;
+      data->getValue(GENERATOR_MBASE,&mva,j);
+      if (mva > best) {
+        best = mva;
+        data->getValue(GENERATOR_ID,&tag,j);
+      }
+    }
+    if (best < 0.0) continue;
+    lbus.push_back(p_network->getOriginalBusIndex(i));
+    lmva.push_back(best);
+    // encode 2-character tag as an integer so it can be summed
+    int code = 0;
+    if (tag.size() > 0) code = 256*static_cast<unsigned char>(tag[0]);
+    if (tag.size() > 1) code += static_cast<unsigned char>(tag[1]);
+    ltag.push_back(code);
+  }
+
+  // Replicate list of generator buses on all processors
+  std::vector<int> sizes(nprocs,0);
+  sizes[me] = lbus.size();
+  p_comm.sum(&sizes[0],nprocs);
+  int offset = 0;
+  int ngen = 0;
+  for (i=0; i<nprocs; i++) {
+    if (i < me) offset += sizes[i];
+    ngen += sizes[i];
+  }
+  std::vector<int> gbus(ngen > 0 ? ngen : 1,0);
+  std::vector<int> gtag(ngen > 0 ? ngen : 1,0);
+  std::vector<double> gmva(ngen > 0 ? ngen : 1,0.0);
+  for (i=0; i<lbus.size(); i++) {
+    gbus[offset+i] = lbus[i];
+    gtag[offset+i] = ltag[i];
+    gmva[offset+i] = lmva[i];
+  }
+  p_comm.sum(&gbus[0],gbus.size());
+  p_comm.sum(&gtag[0],gtag.size());
+  p_comm.sum(&gmva[0],gmva.size());
+  std::vector<int> buses(ngen);
+  std::vector<std::string> tags(ngen);
+  for (i=0; i<ngen; i++) {
+    buses[i] = gbus[i];
+    char c[3];
+    c[0] = static_cast<char>(gtag[i]/256);
+    c[1] = static_cast<char>(gtag[i]%256);
+    c[2] = '\0';
+    tags[i] = c;
+  }
+
+  // Run probing simulation, keeping the rotor angles of all external
+  // generators in memory
+  int nsteps;
+  std::vector<double> swing;
+  angleSwings(app,probe,buses,tags,p_probeTime,nsteps,swing);
+
+  // Form groups around the largest machines. A generator joins the group
+  // if its swing stays within the tolerance of the swing of the first
+  // (largest) generator in the group
+  std::vector<std::pair<double,int> > order(ngen);
+  for (i=0; i<ngen; i++) order[i] = std::pair<double,int>(-gmva[i],i);
+  std::sort(order.begin(),order.end());
+  double tol = p_tolerance*4.0*atan(1.0)/180.0;
+  p_group.assign(ngen,-1);
+  p_groupBus = buses;
+  p_nGroups = 0;
+  for (i=0; i<ngen; i++) {
+    int w = order[i].second;
+    if (p_group[w] >= 0) continue;
+    p_group[w] = p_nGroups;
+    for (j=i+1; j<ngen; j++) {
+      int v = order[j].second;
+      if (p_group[v] >= 0) continue;
+      double dmax = 0.0;
+      int k;
+      for (k=0; k<nsteps; k++) {
+        double d = fabs(swing[w*nsteps+k]-swing[v*nsteps+k]);
+        if (d > dmax) dmax = d;
+      }
+      if (dmax <= tol) p_group[v] = p_nGroups;
+    }
+    p_nGroups++;
+  }
+  if (me == 0) {
+    printf("\nCoherency: %d external generator buses in %d coherent groups\n",
+        ngen,p_nGroups);
+    int g;
+    for (g=0; g<p_nGroups; g++) {
+      printf("  Group %d:",g);
+      for (i=0; i<ngen; i++) {
+        if (p_group[i] == g) printf(" %d",p_groupBus[i]);
+      }
+      printf("\n");
+    }
+  }
+  timer->stop(t_coh);
+}
+
+/**
+ * Run a dynamic simulation and return the rotor angle swings of a set of
+ * generators, relative to their initial angles. The generator watch list
+ * and final time of the application are overwritten. This is a collective
+ * operation
+ * @param app initialized dynamic simulation application
+ * @param event disturbance applied during the simulation
+ * @param buses original indices of buses with watched generators
+ * @param tags IDs of watched generators
+ * @param time simulation time (seconds)
+ * @param nsteps number of recorded time steps
+ * @param swing rotor angle swings (radians) of all generators, stored
+ *        as swing[gen*nsteps+step]. This vector is replicated
+ */
+void gridpack::network_reduction::CoherencyEquivalent::angleSwings(
+    gridpack::dynamic_simulation::DSFullApp &app,
+    gridpack::dynamic_simulation::Event event,
+    const std::vector<int> &buses, const std::vector<std::string> &tags,
+    double time, int &nsteps, std::vector<double> &swing)
+{
+  std::vector<int> wbus = buses;
+  std::vector<std::string> wtag = tags;
+  app.saveTimeSeries(true);
+  app.setTimeSeriesOptions(1);
+  app.setGeneratorWatch(wbus,wtag,false);
+  app.setFinalTime(time);
+  app.solve(event);
+
+  const gridpack::dynamic_simulation::TimeSeriesRecorder &recorder
+    = app.getTimeSeriesRecorder();
+  std::vector<int> tsmap = app.getTimeSeriesMap();
+  int nsig = gridpack::dynamic_simulation::TimeSeriesRecorder::GEN_SIGNALS;
+  nsteps = recorder.totalSteps();
+  p_comm.max(&nsteps,1);
+  if (nsteps < 1) nsteps = 1;
+  int ngen = buses.size();
+  swing.assign(ngen > 0 ? ngen*nsteps : 1,0.0);
+  std::vector<double> vals;
+  int i, j;
+  for (i=0; i<tsmap.size(); i++) {
+    if (tsmap[i]%nsig != 0) continue;
+    int w = tsmap[i]/nsig;
+    recorder.getSignal(i,vals);
+    for (j=0; j<vals.size() && j<nsteps; j++) {
+      swing[w*nsteps+j] = vals[j]-vals[0];
+    }
+  }
+  p_comm.sum(&swing[0],swing.size());
+}
+
+/**
+ * @return number of coherent groups
+ */
+int gridpack::network_reduction::CoherencyEquivalent::numGroups() const
+{
+  return p_nGroups;
+}
+
+/**
+ * Get coherent groups in the form expected by
+ * WardReduction::setGeneratorGroups
+ * @param buses original indices of external generator buses
+ * @param groups group index of each bus
+ */
+void gridpack::network_reduction::CoherencyEquivalent::getGroups(
+    std::vector<int> &buses, std::vector<int> &groups) const
+{
+  buses = p_groupBus;
+  groups = p_group;
+}
+
+/**
+ * Replace the generator on the REI bus of each group by an equivalent
+ * machine
+ * @param reduced reduced network created by WardReduction
+ * @param reiBuses original index of REI bus for each group
+ */
+void gridpack::network_reduction::CoherencyEquivalent::aggregate(
+    boost::shared_ptr<gridpack::dynamic_simulation::DSFullNetwork> reduced,
+    const std::vector<int> &reiBuses)
+{
+  int ng = p_nGroups;
+  if (ng == 0) return;
+  int nbus = p_network->numBuses();
+  int i, j, k, t;
+  std::map<int,int> groupMap;
+  for (i=0; i<p_groupBus.size(); i++) {
+    groupMap.insert(std::pair<int,int>(p_groupBus[i],p_group[i]));
+  }
+
+  // Models of the largest machine in each group
+  std::vector<double> lead(ng,0.0);
+  std::vector<int> models(3*ng,-1);
+  for (k=0; k<2; k++) {
+    for (i=0; i<nbus; i++) {
+      if (!p_network->getActiveBus(i)) continue;
+      std::map<int,int>::iterator it
+        = groupMap.find(p_network->getOriginalBusIndex(i));
+      if (it == groupMap.end()) continue;
+      int g = it->second;
+      boost::shared_ptr<gridpack::component::DataCollection> data
+        = p_network->getBusData(i);
+      int ngen = 0;
+      data->getValue(GENERATOR_NUMBER,&ngen);
+      for (j=0; j<ngen; j++) {
+        int stat = 0;
+        double mva = 0.0;
+        data->getValue(GENERATOR_STAT,&stat,j);
+        if (stat != 1 || getModel(data,j,0) < 0) continue;
+        data->getValue(GENERATOR_MBASE,&mva,j);
+        if (k == 0 && mva > lead[g]) lead[g] = mva;
+        if (k == 1 && mva == lead[g]) {
+          for (t=0; t<3; t++) {
+            int m = getModel(data,j,t);
+            if (m > models[3*g+t]) models[3*g+t] = m;
+          }
+        }
+      }
+    }
+    if (k == 0) p_comm.max(&lead[0],ng);
+  }
+  p_comm.max(&models[0],3*ng);
+
+  // Accumulate parameters of members. For each group the buffer holds the
+  // parameter sums for the three model types, the weights for each type,
+  // the total MVA base of the group and the sum of the source admittances
+  // (on system base times the system MVA)
+  int nslot = 3*NR_MAX_PARAMS+6;
+  int iwgt = 3*NR_MAX_PARAMS;
+  int imva = iwgt+3;
+  std::vector<double> acc(ng*nslot,0.0);
+  for (i=0; i<nbus; i++) {
+    if (!p_network->getActiveBus(i)) continue;
+    std::map<int,int>::iterator it
+      = groupMap.find(p_network->getOriginalBusIndex(i));
+    if (it == groupMap.end()) continue;
+    int g = it->second;
+    double *sum = &acc[g*nslot];
+    boost::shared_ptr<gridpack::component::DataCollection> data
+      = p_network->getBusData(i);
+    int ngen = 0;
+    data->getValue(GENERATOR_NUMBER,&ngen);
+    for (j=0; j<ngen; j++) {
+      int stat = 0;
+      double mva = 0.0;
+      gridpack::ComplexType zsrc(0.0,0.0);
+      data->getValue(GENERATOR_STAT,&stat,j);
+      if (stat != 1) continue;
+      data->getValue(GENERATOR_MBASE,&mva,j);
+      sum[imva] += mva;
+      data->getValue(GENERATOR_ZSOURCE,&zsrc,j);
+      if (abs(zsrc) > 0.0) {
+        gridpack::ComplexType y = mva/zsrc;
+        sum[imva+1] += real(y);
+        sum[imva+2] += imag(y);
+      }
+      for (t=0; t<3; t++) {
+        int m = models[3*g+t];
+        if (m < 0 || getModel(data,j,t) != m) continue;
+        sum[iwgt+t] += mva;
+        const DyrModel &model = dyrModels[m];
+        for (k=0; k<model.nparam; k++) {
+          double v = 0.0;
+          data->getValue(model.keys[k],&v,j);
+          if (model.rules[k] == 'h') {
+            if (v > 0.0) sum[t*NR_MAX_PARAMS+k] += mva/v;
+          } else {
+            sum[t*NR_MAX_PARAMS+k] += mva*v;
+          }
+        }
+      }
+    }
+  }
+  p_comm.sum(&acc[0],ng*nslot);
+
+  // Set parameters of equivalent machines. REI buses may be present on
+  // several processors as ghost buses, so all copies are updated
+  int g;
+  for (g=0; g<ng; g++) {
+    if (g >= reiBuses.size() || reiBuses[g] < 0) continue;
+    if (models[3*g] < 0) continue;
+    double *sum = &acc[g*nslot];
+    std::vector<int> local = reduced->getLocalBusIndices(reiBuses[g]);
+    for (i=0; i<local.size(); i++) {
+      boost::shared_ptr<gridpack::component::DataCollection> data
+        = reduced->getBusData(local[i]);
+      storeValue(data,GENERATOR_MBASE,sum[imva],0);
+      gridpack::ComplexType ysrc(sum[imva+1],sum[imva+2]);
+      if (abs(ysrc) > 0.0) {
+        gridpack::ComplexType zsrc = sum[imva]/ysrc;
+        storeValue(data,GENERATOR_ZSOURCE,zsrc,0);
+        storeValue(data,GENERATOR_RESISTANCE,real(zsrc),0);
+        storeValue(data,GENERATOR_SUBTRANSIENT_REACTANCE,imag(zsrc),0);
+      }
+      for (t=0; t<3; t++) {
+        int m = models[3*g+t];
+        if (m < 0) {
+          if (hasKeys[t] != NULL) storeValue(data,hasKeys[t],false,0);
+          continue;
+        }
+        const DyrModel &model = dyrModels[m];
+        double wgt = sum[iwgt+t];
+        storeValue(data,modelKeys[t],model.name,0);
+        if (hasKeys[t] != NULL) storeValue(data,hasKeys[t],true,0);
+        for (k=0; k<model.nparam; k++) {
+          double v = sum[t*NR_MAX_PARAMS+k];
+          if (model.rules[k] == 'h') {
+            v = v > 0.0 ? wgt/v : 0.0;
+          } else {
+            v = v/wgt;
+            if (model.rules[k] == 'r') v = floor(v+0.5);
+          }
+          storeValue(data,model.keys[k],v,0);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Write generator, exciter and governor records for all generators in
+ * a network to a file in PSS/E DYR format
+ * @param network network containing dynamic data
+ * @param filename name of DYR file
+ */
+void gridpack::network_reduction::CoherencyEquivalent::writeDyr(
+    boost::shared_ptr<gridpack::dynamic_simulation::DSFullNetwork> network,
+    const char *filename)
+{
+  int me = p_comm.rank();
+  int nprocs = p_comm.size();
+  int nbus = network->numBuses();
+  int i, j, k, t;
+  int nskip = 0;
+  std::string buf;
+  char sbuf[128];
+  for (i=0; i<nbus; i++) {
+    if (!network->getActiveBus(i)) continue;
+    boost::shared_ptr<gridpack::component::DataCollection> data
+      = network->getBusData(i);
+    int ngen = 0;
+    data->getValue(GENERATOR_NUMBER,&ngen);
+    for (j=0; j<ngen; j++) {
+      std::string tag;
+      data->getValue(GENERATOR_ID,&tag,j);
+      for (t=0; t<3; t++) {
+        int m = getModel(data,j,t);
+        if (m < 0) {
+          std::string name;
+          bool has = (hasKeys[t] == NULL);
+          if (!has) data->getValue(hasKeys[t],&has,j);
+          if (has && data->getValue(modelKeys[t],&name,j)) nskip++;
+          continue;
+        }
+        const DyrModel &model = dyrModels[m];
+        sprintf(sbuf,"%d, '%s', '%-2s'",network->getOriginalBusIndex(i),
+            model.name,tag.c_str());
+        buf.append(sbuf);
+        for (k=0; k<model.nparam; k++) {
+          double v = 0.0;
+          data->getValue(model.keys[k],&v,j);
+          sprintf(sbuf,", %12.6f",v);
+          buf.append(sbuf);
+        }
+        buf.append(" /\n");
+      }
+    }
+  }
+  p_comm.sum(&nskip,1);
+
+  // Gather records on process 0 and write them out
+  MPI_Comm comm = static_cast<MPI_Comm>(p_comm);
+  int len = buf.size();
+  std::vector<int> lens(nprocs,0);
+  std::vector<int> displ(nprocs,0);
+  MPI_Gather(&len,1,MPI_INT,&lens[0],1,MPI_INT,0,comm);
+  int total = 0;
+  for (i=0; i<nprocs; i++) {
+    displ[i] = total;
+    total += lens[i];
+  }
+  std::vector<char> records(total > 0 ? total : 1);
+  MPI_Gatherv(const_cast<char*>(buf.c_str()),len,MPI_CHAR,&records[0],
+      &lens[0],&displ[0],MPI_CHAR,0,comm);
+  if (me == 0) {
+    FILE *fp = fopen(filename,"w");
+    if (fp == NULL) {
+      printf("CoherencyEquivalent::writeDyr: unable to open file %s\n",
+          filename);
+    } else {
+      if (total > 0) fwrite(&records[0],sizeof(char),total,fp);
+      fclose(fp);
+    }
+    if (nskip > 0) {
+      printf("CoherencyEquivalent::writeDyr: %d records with unsupported"
+          " models were not written\n",nskip);
+    }
+  }
+}
+
+/**
+ * @param data data collection of bus
+ * @return true if bus is in the study system
+ */
+bool gridpack::network_reduction::CoherencyEquivalent::inStudySystem(
+    boost::shared_ptr<gridpack::component::DataCollection> data)
+{
+  int area = 1;
+  int zone = 1;
+  int i;
+  data->getValue(BUS_AREA,&area);
+  data->getValue(BUS_ZONE,&zone);
+  bool ok = false;
+  for (i=0; i<p_areas.size(); i++) {
+    if (area == p_areas[i]) ok = true;
+  }
+  if (ok && p_zones.size() > 0) {
+    ok = false;
+    for (i=0; i<p_zones.size(); i++) {
+      if (zone == p_zones[i]) ok = true;
+    }
+  }
+  return ok;
+}
+
+/**
+ * Find the entry of a dynamic model in the model table
+ * @param type model type (0: generator, 1: exciter, 2: governor)
+ * @param model name of model
+ * @return index of model in table or -1 if model is not supported
+ */
+int gridpack::network_reduction::CoherencyEquivalent::findModel(int type,
+    const std::string &model) const
+{
+  gridpack::utility::StringUtils util;
+  std::string name = model;
+  util.trim(name);
+  util.toUpper(name);
+  int i;
+  for (i=0; i<numDyrModels; i++) {
+    if (dyrModels[i].type == type && name == dyrModels[i].name) return i;
+  }
+  return -1;
+}
+
+/**
+ * Find the model of the given type used by a generator
+ * @param data data collection of bus
+ * @param idx index of generator on bus
+ * @param type model type (0: generator, 1: exciter, 2: governor)
+ * @return index of model in table or -1 if generator does not have a
+ *         supported model of this type
+ */
+int gridpack::network_reduction::CoherencyEquivalent::getModel(
+    boost::shared_ptr<gridpack::component::DataCollection> data,
+    int idx, int type) const
+{
+  if (hasKeys[type] != NULL) {
+    bool has = false;
+    data->getValue(hasKeys[type],&has,idx);
+    if (!has) return -1;
+  }
+  std::string model;
+  if (!data->getValue(modelKeys[type],&model,idx)) return -1;
+  return findModel(type,model);
+}
+
+/**
+ * Set a parameter in a data collection, adding it if it does not
+ * exist
+ * @param data data collection of bus
+ * @param name parameter name
+ * @param value parameter value
+ * @param idx index of generator on bus
+ */
+void gridpack::network_reduction::CoherencyEquivalent::storeValue(
+    boost::shared_ptr<gridpack::component::DataCollection> data,
+    const char *name, double value, int idx)
+{
+  if (!data->setValue(name,value,idx)) data->addValue(name,value,idx);
+}
+
+void gridpack::network_reduction::CoherencyEquivalent::storeValue(
+    boost::shared_ptr<gridpack::component::DataCollection> data,
+    const char *name, const char *value, int idx)
+{
+  if (!data->setValue(name,value,idx)) data->addValue(name,value,idx);
+}
+
+void gridpack::network_reduction::CoherencyEquivalent::storeValue(
+    boost::shared_ptr<gridpack::component::DataCollection> data,
+    const char *name, bool value, int idx)
+{
+  if (!data->setValue(name,value,idx)) data->addValue(name,value,idx);
+}
+
+void gridpack::network_reduction::CoherencyEquivalent::storeValue(
+    boost::shared_ptr<gridpack::component::DataCollection> data,
+    const char *name, gridpack::ComplexType value, int idx)
+{
+  if (!data->setValue(name,value,idx)) data->addValue(name,value,idx);
+}
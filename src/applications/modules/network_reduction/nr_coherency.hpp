@@ -0,0 +1,223 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   nr_coherency.hpp
+ * @date   October 19, 2026
+ *
+ * @brief  Coherency based dynamic equivalent of the network outside a
+ * study area. Coherent groups of external generators are identified from
+ * the rotor angle swings of a short probing simulation with DSFullApp. The
+ * groups are passed to WardReduction::setGeneratorGroups so that each group
+ * is collected on its own REI bus, and the dynamic models of the group are
+ * aggregated into a single equivalent machine (with exciter and governor)
+ * on that bus. The reduced network and its dynamic data can be written out
+ * as RAW and DYR files or used directly by DSFullApp.
+ */
+// -------------------------------------------------------------
+
+#ifndef _nr_coherency_h_
+#define _nr_coherency_h_
+
+#include <vector>
+#include <string>
+#include "boost/smart_ptr/shared_ptr.hpp"
+#include "gridpack/parallel/communicator.hpp"
+#include "gridpack/configuration/configuration.hpp"
+#include "gridpack/applications/modules/dynamic_simulation_full_y/dsf_app_module.hpp"
+
+namespace gridpack {
+namespace network_reduction {
+
+class CoherencyEquivalent
+{
+  public:
+
+    /**
+     * Basic constructor
+     * @param network dynamic simulation network containing the full system.
+     *        Generator parameters must have been read in
+     */
+    CoherencyEquivalent(
+        boost::shared_ptr<gridpack::dynamic_simulation::DSFullNetwork> network);
+
+    /**
+     * Basic destructor
+     */
+    ~CoherencyEquivalent();
+
+    /**
+     * Read parameters from the network reduction block of the input file.
+     * The block can contain
+     *   studyAreas:          list of areas that are retained
+     *   studyZones:          list of zones that are retained (optional)
+     *   coherencyTolerance:  maximum difference in rotor angle swings
+     *                        (degrees) of coherent generators
+     *   probeTime:           length of the probing simulation (seconds)
+     * @param cursor pointer to network reduction block
+     */
+    void configure(gridpack::utility::Configuration::CursorPtr cursor);
+
+    /**
+     * Set areas that make up the study system
+     * @param areas list of area numbers
+     */
+    void setStudyAreas(const std::vector<int> &areas);
+
+    /**
+     * Restrict study system to buses in these zones
+     * @param zones list of zone numbers
+     */
+    void setStudyZones(const std::vector<int> &zones);
+
+    /**
+     * Set the maximum difference between the rotor angle swings of two
+     * generators that are considered coherent
+     * @param tol tolerance (degrees)
+     */
+    void setCoherencyTolerance(double tol);
+
+    /**
+     * Set length of probing simulation
+     * @param time simulation time (seconds)
+     */
+    void setProbeTime(double time);
+
+    /**
+     * Run a probing simulation and sort external generator buses into
+     * coherent groups. The application must have been initialized on the
+     * network passed to the constructor and its generator watch list and
+     * final time are overwritten. This is a collective operation
+     * @param app dynamic simulation application
+     * @param probe disturbance used to excite the system
+     */
+    void identifyGroups(gridpack::dynamic_simulation::DSFullApp &app,
+        gridpack::dynamic_simulation::Event probe);
+
+    /**
+     * Run a dynamic simulation and return the rotor angle swings of a set
+     * of generators, relative to their initial angles. The generator watch
+     * list and final time of the application are overwritten. This is a
+     * collective operation
+     * @param app initialized dynamic simulation application
+     * @param event disturbance applied during the simulation
+     * @param buses original indices of buses with watched generators
+     * @param tags IDs of watched generators
+     * @param time simulation time (seconds)
+     * @param nsteps number of recorded time steps
+     * @param swing rotor angle swings (radians) of all generators, stored
+     *        as swing[gen*nsteps+step]. This vector is replicated
+     */
+    void angleSwings(gridpack::dynamic_simulation::DSFullApp &app,
+        gridpack::dynamic_simulation::Event event,
+        const std::vector<int> &buses, const std::vector<std::string> &tags,
+        double time, int &nsteps, std::vector<double> &swing);
+
+    /**
+     * @return number of coherent groups
+     */
+    int numGroups() const;
+
+    /**
+     * Get coherent groups in the form expected by
+     * WardReduction::setGeneratorGroups
+     * @param buses original indices of external generator buses
+     * @param groups group index of each bus
+     */
+    void getGroups(std::vector<int> &buses, std::vector<int> &groups) const;
+
+    /**
+     * Replace the generator on the REI bus of each group by an equivalent
+     * machine. Inertia, damping, time constants and controller parameters
+     * are MVA weighted averages over the group, machine reactances, source
+     * impedance and governor droop are combined in parallel. Exciter and
+     * governor models are those of the largest machine in the group and
+     * are averaged over the members that use the same model. This is a
+     * collective operation
+     * @param reduced reduced network created by WardReduction
+     * @param reiBuses original index of REI bus for each group (from
+     *        WardReduction::getREIBus)
+     */
+    void aggregate(
+        boost::shared_ptr<gridpack::dynamic_simulation::DSFullNetwork> reduced,
+        const std::vector<int> &reiBuses);
+
+    /**
+     * Write generator, exciter and governor records for all generators in
+     * a network to a file in PSS/E DYR format. Only models listed in the
+     * aggregation table (GENCLS, GENROU, GENSAL, SEXS, EXDC1, IEEET1,
+     * ESST1A, TGOV1, GAST, HYGOV) are written. This is a collective
+     * operation
+     * @param network network containing dynamic data
+     * @param filename name of DYR file
+     */
+    void writeDyr(
+        boost::shared_ptr<gridpack::dynamic_simulation::DSFullNetwork> network,
+        const char *filename);
+
+  private:
+
+    /**
+     * @param data data collection of bus
+     * @return true if bus is in the study system
+     */
+    bool inStudySystem(
+        boost::shared_ptr<gridpack::component::DataCollection> data);
+
+    /**
+     * Find the entry of a dynamic model in the model table
+     * @param type model type (0: generator, 1: exciter, 2: governor)
+     * @param model name of model
+     * @return index of model in table or -1 if model is not supported
+     */
+    int findModel(int type, const std::string &model) const;
+
+    /**
+     * Find the model of the given type used by a generator
+     * @param data data collection of bus
+     * @param idx index of generator on bus
+     * @param type model type (0: generator, 1: exciter, 2: governor)
+     * @return index of model in table or -1 if generator does not have a
+     *         supported model of this type
+     */
+    int getModel(boost::shared_ptr<gridpack::component::DataCollection> data,
+        int idx, int type) const;
+
+    /**
+     * Set a parameter in a data collection, adding it if it does not
+     * exist
+     * @param data data collection of bus
+     * @param name parameter name
+     * @param value parameter value
+     * @param idx index of generator on bus
+     */
+    void storeValue(boost::shared_ptr<gridpack::component::DataCollection> data,
+        const char *name, double value, int idx);
+    void storeValue(boost::shared_ptr<gridpack::component::DataCollection> data,
+        const char *name, const char *value, int idx);
+    void storeValue(boost::shared_ptr<gridpack::component::DataCollection> data,
+        const char *name, bool value, int idx);
+    void storeValue(boost::shared_ptr<gridpack::component::DataCollection> data,
+        const char *name, gridpack::ComplexType value, int idx);
+
+    boost::shared_ptr<gridpack::dynamic_simulation::DSFullNetwork> p_network;
+    gridpack::parallel::Communicator p_comm;
+
+    // study system and options
+    std::vector<int> p_areas;
+    std::vector<int> p_zones;
+    double p_tolerance;
+    double p_probeTime;
+
+    // coherent groups of external generator buses (replicated)
+    int p_nGroups;
+    std::vector<int> p_groupBus;
+    std::vector<int> p_group;
+};
+
+} // network_reduction
+} // gridpack
+#endif
@@ -0,0 +1,1070 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   nr_ward_reduction.hpp
+ * @date   October 19, 2026
+ *
+ * @brief  Ward/REI equivalent of the network outside a study area. Buses in
+ * the study areas (and zones, if specified) are retained, the remaining
+ * buses are eliminated by partial Gaussian elimination of the Y-matrix
+ *
+ *   Ybb' = Ybb - Ybe*Yee^{-1}*Yeb
+ *
+ * and a reduced network containing only the retained buses is created.
+ * Retained buses connected to the external system (boundary buses) are
+ * coupled by equivalent branches and get an equivalent shunt and an
+ * equivalent load that reproduces the base case flows from the external
+ * system. If the REI option is selected, external generation is moved to a
+ * single fictitious PV bus connected to the boundary through a zero power
+ * balance network before the elimination. External generators can also be
+ * split into groups (e.g. coherent groups), in which case each group gets
+ * its own zero power balance network and REI bus.
+ *
+ * The network must have been loaded by a factory whose components inherit
+ * from YMBus and YMBranch (e.g. the powerflow or dynamic simulation
+ * networks) and should contain a solved base case. Bus voltages are taken
+ * from BUS_PF_VMAG and BUS_PF_VANG, if present, and otherwise from
+ * BUS_VOLTAGE_MAG and BUS_VOLTAGE_ANG. The reduced network is created from
+ * data collections, so it can be of any network type and can be passed
+ * directly to PFAppModule::setNetwork or DSFullApp::setNetwork.
+ */
+// -------------------------------------------------------------
+
+#ifndef _nr_ward_reduction_h_
+#define _nr_ward_reduction_h_
+
+#include <vector>
+#include <string>
+#include <map>
+#include <math.h>
+#include <stdio.h>
+#include <ga.h>
+#include <boost/smart_ptr/shared_ptr.hpp>
+#include "gridpack/parallel/communicator.hpp"
+#include "gridpack/configuration/configuration.hpp"
+#include "gridpack/component/data_collection.hpp"
+#include "gridpack/parser/dictionary.hpp"
+#include "gridpack/math/math.hpp"
+#include "gridpack/math/linear_matrix_solver.hpp"
+#include "gridpack/timer/coarse_timer.hpp"
+#include "gridpack/utilities/string_utils.hpp"
+#include "gridpack/utilities/exception.hpp"
+#include "gridpack/applications/components/y_matrix/ymatrix_components.hpp"
+
+namespace gridpack {
+namespace network_reduction {
+
+template <class _network>
+class WardReduction
+{
+  public:
+
+    /**
+     * Basic constructor
+     * @param network network that will be reduced
+     */
+    WardReduction(boost::shared_ptr<_network> network)
+      : p_network(network), p_comm(network->communicator())
+    {
+      p_rei = false;
+      p_tolerance = 1.0e-3;
+      p_reduced = false;
+      p_nBoundary = 0;
+      p_nExternal = 0;
+      p_nCols = 0;
+      p_refBoundary = -1;
+      p_nREI = 0;
+      p_sbase = 100.0;
+      p_caseID = 0;
+      p_cursor = NULL;
+    }
+
+    /**
+     * Basic destructor
+     */
+    ~WardReduction()
+    {
+    }
+
+    /**
+     * Read parameters from the network reduction block of the input file.
+     * The block can contain
+     *   studyAreas:      list of areas that are retained
+     *   studyZones:      list of zones that are retained (optional)
+     *   REI:             aggregate external generation on an REI bus
+     *   branchTolerance: smallest admittance of an equivalent branch
+     * The cursor is also used to configure the linear solver for the
+     * external system
+     * @param cursor pointer to network reduction block
+     */
+    void configure(gridpack::utility::Configuration::CursorPtr cursor)
+    {
+      p_cursor = cursor;
+      if (cursor == NULL) return;
+      gridpack::utility::StringUtils util;
+      std::string list;
+      std::vector<std::string> tokens;
+      int i;
+      list = cursor->get("studyAreas","");
+      tokens = util.blankTokenizer(list);
+      p_areas.clear();
+      for (i=0; i<tokens.size(); i++) p_areas.push_back(atoi(tokens[i].c_str()));
+      list = cursor->get("studyZones","");
+      tokens = util.blankTokenizer(list);
+      p_zones.clear();
+      for (i=0; i<tokens.size(); i++) p_zones.push_back(atoi(tokens[i].c_str()));
+      p_rei = cursor->get("REI",p_rei);
+      p_tolerance = cursor->get("branchTolerance",1.0e-3);
+    }
+
+    /**
+     * Set areas that make up the study system
+     * @param areas list of area numbers
+     */
+    void setStudyAreas(const std::vector<int> &areas)
+    {
+      p_areas = areas;
+    }
+
+    /**
+     * Restrict study system to buses in these zones. If no zones are set,
+     * all buses in the study areas are retained
+     * @param zones list of zone numbers
+     */
+    void setStudyZones(const std::vector<int> &zones)
+    {
+      p_zones = zones;
+    }
+
+    /**
+     * Aggregate external generation on a fictitious REI bus instead of
+     * representing it by equivalent loads at the boundary
+     * @param flag true if REI bus should be created
+     */
+    void setREI(bool flag)
+    {
+      p_rei = flag;
+    }
+
+    /**
+     * Aggregate external generation on one REI bus for each group of
+     * generator buses. Generators on external buses that are not assigned
+     * to a group are represented by equivalent loads at the boundary
+     * @param buses original indices of external generator buses
+     * @param groups group index (0,1,2,...) of each bus
+     */
+    void setGeneratorGroups(const std::vector<int> &buses,
+        const std::vector<int> &groups)
+    {
+      p_groupBuses = buses;
+      p_groupIDs = groups;
+      p_rei = true;
+    }
+
+    /**
+     * Set the smallest admittance (p.u.) for which an equivalent branch is
+     * created between two boundary buses
+     * @param tol admittance tolerance
+     */
+    void setBranchTolerance(double tol)
+    {
+      p_tolerance = tol;
+    }
+
+    /**
+     * Evaluate the equivalent of the external system. This is a collective
+     * operation
+     */
+    void reduce()
+    {
+      gridpack::utility::CoarseTimer *timer =
+        gridpack::utility::CoarseTimer::instance();
+      int t_total = timer->createCategory("Network Reduction: Total");
+      int t_solve = timer->createCategory("Network Reduction: Elimination");
+      timer->start(t_total);
+      if (p_areas.size() == 0) {
+        char buf[256];
+        sprintf(buf,"WardReduction::reduce: no study areas specified\n");
+        if (p_comm.rank() == 0) printf("%s",buf);
+        throw gridpack::Exception(buf);
+      }
+      classifyBuses();
+      assignIndices();
+      timer->start(t_solve);
+      eliminate();
+      timer->stop(t_solve);
+      equivalents();
+      p_reduced = true;
+      if (p_comm.rank() == 0) {
+        printf("\nNetwork reduction: %d external buses eliminated,"
+            " %d boundary buses\n",p_nExternal-p_nREI,p_nBoundary);
+      }
+      timer->stop(t_total);
+    }
+
+    /**
+     * @return number of boundary buses in the study system
+     */
+    int numBoundaryBuses() const
+    {
+      return p_nBoundary;
+    }
+
+    /**
+     * @return number of buses that are eliminated
+     */
+    int numExternalBuses() const
+    {
+      return p_nExternal-p_nREI;
+    }
+
+    /**
+     * @return number of REI buses in the reduced network
+     */
+    int numREIBuses() const
+    {
+      return p_nREI;
+    }
+
+    /**
+     * @param group index of generator group (0 if groups were not set)
+     * @return original index of the REI bus for the group or -1 if the
+     *         group does not have an REI bus
+     */
+    int getREIBus(int group) const
+    {
+      if (group < 0 || group >= p_groupREI.size()) return -1;
+      if (p_groupREI[group] < 0) return -1;
+      return p_reiBus[p_groupREI[group]];
+    }
+
+    /**
+     * Create the reduced network. Retained buses and branches are copied
+     * from the original network and the equivalent elements are added to
+     * the boundary buses. The new network is partitioned but no factory
+     * has been applied to it. This is a collective operation
+     * @param reduced empty network that is filled with reduced system
+     */
+    template <class _new_network>
+    void createNetwork(boost::shared_ptr<_new_network> reduced)
+    {
+      if (!p_reduced) {
+        char buf[256];
+        sprintf(buf,"WardReduction::createNetwork: reduce has not been called\n");
+        if (p_comm.rank() == 0) printf("%s",buf);
+        throw gridpack::Exception(buf);
+      }
+      gridpack::utility::CoarseTimer *timer =
+        gridpack::utility::CoarseTimer::instance();
+      int t_create = timer->createCategory("Network Reduction: Create Network");
+      timer->start(t_create);
+      int me = p_comm.rank();
+      int nprocs = p_comm.size();
+      int nbus = p_network->numBuses();
+      int nbranch = p_network->numBranches();
+      int nb = p_nCols;
+      int i, j, l1, l2;
+
+      // Find out which boundary buses are already connected by retained
+      // branches. Equivalent branches between these buses are added as an
+      // extra element of the existing branch
+      std::vector<int> covered(nb*nb,0);
+      std::vector<int> retainedBranch(nbranch,0);
+      int nrbus = 0;
+      int nrbranch = 0;
+      for (i=0; i<nbus; i++) {
+        if (p_network->getActiveBus(i) && retained(i)) nrbus++;
+      }
+      for (i=0; i<nbranch; i++) {
+        p_network->getBranchEndpoints(i,&l1,&l2);
+        if (retained(l1) && retained(l2)) {
+          retainedBranch[i] = 1;
+          if (p_network->getActiveBranch(i)) {
+            nrbranch++;
+            if (p_type[l1] == Boundary && p_type[l2] == Boundary) {
+              covered[p_index[l1]*nb+p_index[l2]] = 1;
+              covered[p_index[l2]*nb+p_index[l1]] = 1;
+            }
+          }
+        }
+      }
+      p_comm.sum(&covered[0],nb*nb);
+      std::vector<std::pair<int,int> > newBranches;
+      if (me == 0) {
+        for (i=0; i<nb; i++) {
+          for (j=i+1; j<nb; j++) {
+            if (p_keep[i*nb+j] && !covered[i*nb+j]) {
+              newBranches.push_back(std::pair<int,int>(i,j));
+            }
+          }
+        }
+        nrbus += p_nREI;
+        nrbranch += newBranches.size();
+      }
+
+      // Evaluate offsets for global indices of buses and branches
+      std::vector<int> nbuses(nprocs,0);
+      std::vector<int> nbranches(nprocs,0);
+      nbuses[me] = nrbus;
+      nbranches[me] = nrbranch;
+      p_comm.sum(&nbuses[0],nprocs);
+      p_comm.sum(&nbranches[0],nprocs);
+      int offset_bus = 0;
+      int offset_branch = 0;
+      for (i=0; i<me; i++) {
+        offset_bus += nbuses[i];
+        offset_branch += nbranches[i];
+      }
+
+      // Copy retained buses
+      int ncnt = 0;
+      for (i=0; i<nbus; i++) {
+        if (!p_network->getActiveBus(i) || !retained(i)) continue;
+        reduced->addBus(p_network->getOriginalBusIndex(i));
+        reduced->setGlobalBusIndex(ncnt,ncnt+offset_bus);
+        boost::shared_ptr<gridpack::component::DataCollection> data
+          = reduced->getBusData(ncnt);
+        *data = *(p_network->getBusData(i));
+        if (p_type[i] == Boundary) {
+          setBoundaryData(data, p_index[i]);
+        }
+        ncnt++;
+      }
+      for (i=0; i<p_nREI; i++) {
+        if (me != 0) break;
+        reduced->addBus(p_reiBus[i]);
+        reduced->setGlobalBusIndex(ncnt,ncnt+offset_bus);
+        boost::shared_ptr<gridpack::component::DataCollection> data
+          = reduced->getBusData(ncnt);
+        setREIBusData(data, i);
+        setBoundaryData(data, p_nBoundary+i);
+        ncnt++;
+      }
+
+      // Copy retained branches
+      ncnt = 0;
+      for (i=0; i<nbranch; i++) {
+        if (!p_network->getActiveBranch(i) || !retainedBranch[i]) continue;
+        p_network->getBranchEndpoints(i,&l1,&l2);
+        reduced->addBranch(p_network->getOriginalBusIndex(l1),
+            p_network->getOriginalBusIndex(l2));
+        reduced->setGlobalBranchIndex(ncnt,ncnt+offset_branch);
+        boost::shared_ptr<gridpack::component::DataCollection> data
+          = reduced->getBranchData(ncnt);
+        *data = *(p_network->getBranchData(i));
+        if (p_type[l1] == Boundary && p_type[l2] == Boundary &&
+            p_keep[p_index[l1]*nb+p_index[l2]]) {
+          int nelem = 0;
+          data->getValue(BRANCH_NUM_ELEMENTS,&nelem);
+          setBranchElement(data, nelem, p_yEquiv[p_index[l1]*nb+p_index[l2]]);
+          data->setValue(BRANCH_NUM_ELEMENTS,nelem+1);
+        }
+        ncnt++;
+      }
+      for (i=0; i<newBranches.size(); i++) {
+        int b1 = newBranches[i].first;
+        int b2 = newBranches[i].second;
+        reduced->addBranch(p_boundaryBus[b1],p_boundaryBus[b2]);
+        reduced->setGlobalBranchIndex(ncnt,ncnt+offset_branch);
+        boost::shared_ptr<gridpack::component::DataCollection> data
+          = reduced->getBranchData(ncnt);
+        data->addValue(BRANCH_FROMBUS,p_boundaryBus[b1]);
+        data->addValue(BRANCH_TOBUS,p_boundaryBus[b2]);
+        data->addValue(BRANCH_NUM_ELEMENTS,1);
+        data->addValue(CASE_ID,p_caseID);
+        data->addValue(CASE_SBASE,p_sbase);
+        setBranchElement(data, 0, p_yEquiv[b1*nb+b2]);
+        ncnt++;
+      }
+      *(reduced->getNetworkData()) = *(p_network->getNetworkData());
+      reduced->partition();
+      timer->stop(t_create);
+    }
+
+  private:
+
+    enum BusType{Interior, Boundary, External, Dropped};
+
+    /**
+     * @param idx local bus index
+     * @return true if bus is part of the reduced network
+     */
+    bool retained(int idx) const
+    {
+      return p_type[idx] == Interior || p_type[idx] == Boundary;
+    }
+
+    /**
+     * @param data data collection of bus
+     * @return true if bus is in the study system
+     */
+    bool inStudySystem(boost::shared_ptr<gridpack::component::DataCollection> data)
+    {
+      int area = 1;
+      int zone = 1;
+      int i;
+      data->getValue(BUS_AREA,&area);
+      data->getValue(BUS_ZONE,&zone);
+      bool ok = false;
+      for (i=0; i<p_areas.size(); i++) {
+        if (area == p_areas[i]) ok = true;
+      }
+      if (ok && p_zones.size() > 0) {
+        ok = false;
+        for (i=0; i<p_zones.size(); i++) {
+          if (zone == p_zones[i]) ok = true;
+        }
+      }
+      return ok;
+    }
+
+    /**
+     * @param data data collection of bus
+     * @return base case complex voltage of bus
+     */
+    ComplexType busVoltage(boost::shared_ptr<gridpack::component::DataCollection> data)
+    {
+      double vmag = 1.0;
+      double vang = 0.0;
+      if (!data->getValue("BUS_PF_VMAG",&vmag)) {
+        data->getValue(BUS_VOLTAGE_MAG,&vmag);
+      }
+      if (!data->getValue("BUS_PF_VANG",&vang)) {
+        data->getValue(BUS_VOLTAGE_ANG,&vang);
+      }
+      double pi = 4.0*atan(1.0);
+      vang = vang*pi/180.0;
+      return ComplexType(vmag*cos(vang),vmag*sin(vang));
+    }
+
+    /**
+     * Assign buses to the study system or the external system, evaluate
+     * base case voltages and, if REI buses are requested, the power and
+     * current of the aggregated external generation in each group
+     */
+    void classifyBuses()
+    {
+      int nbus = p_network->numBuses();
+      int nbranch = p_network->numBranches();
+      int i, l1, l2;
+      p_type.resize(nbus);
+      p_voltage.resize(nbus);
+      p_genPower.assign(nbus,ComplexType(0.0,0.0));
+      p_genGroup.assign(nbus,-1);
+      double sbase = 0.0;
+      int maxBus = 0;
+      int refBus = 0;
+      // If no groups are set, all external generation goes to group 0
+      std::map<int,int> groupMap;
+      int ngroups = 1;
+      for (i=0; i<p_groupBuses.size(); i++) {
+        groupMap.insert(std::pair<int,int>(p_groupBuses[i],p_groupIDs[i]));
+        if (p_groupIDs[i]+1 > ngroups) ngroups = p_groupIDs[i]+1;
+      }
+      std::vector<ComplexType> sums(2*ngroups,ComplexType(0.0,0.0));
+      for (i=0; i<nbus; i++) {
+        boost::shared_ptr<gridpack::component::DataCollection> data
+          = p_network->getBusData(i);
+        int itype = 1;
+        data->getValue(BUS_TYPE,&itype);
+        if (inStudySystem(data)) {
+          p_type[i] = Interior;
+          if (itype == 3 && p_network->getActiveBus(i)) refBus = 1;
+        } else if (itype == 4) {
+          p_type[i] = Dropped;
+        } else {
+          p_type[i] = External;
+        }
+        p_voltage[i] = busVoltage(data);
+        if (i == 0) {
+          data->getValue(CASE_SBASE,&sbase);
+          data->getValue(CASE_ID,&p_caseID);
+        }
+        if (p_network->getOriginalBusIndex(i) > maxBus) {
+          maxBus = p_network->getOriginalBusIndex(i);
+        }
+        if (p_rei && p_type[i] == External && p_network->getActiveBus(i)) {
+          if (groupMap.size() > 0) {
+            std::map<int,int>::iterator it
+              = groupMap.find(p_network->getOriginalBusIndex(i));
+            if (it == groupMap.end()) continue;
+            p_genGroup[i] = it->second;
+          } else {
+            p_genGroup[i] = 0;
+          }
+          int ngen = 0;
+          int j;
+          data->getValue(GENERATOR_NUMBER,&ngen);
+          for (j=0; j<ngen; j++) {
+            int status = 0;
+            double pg = 0.0;
+            double qg = 0.0;
+            data->getValue(GENERATOR_STAT,&status,j);
+            data->getValue(GENERATOR_PG,&pg,j);
+            data->getValue(GENERATOR_QG,&qg,j);
+            if (status == 1) p_genPower[i] += ComplexType(pg,qg);
+          }
+        }
+      }
+      p_comm.max(&sbase,1);
+      p_comm.max(&p_caseID,1);
+      p_comm.max(&maxBus,1);
+      p_comm.max(&refBus,1);
+      p_sbase = sbase;
+      for (i=0; i<nbus; i++) {
+        if (abs(p_genPower[i]) > 0.0) {
+          int g = p_genGroup[i];
+          p_genPower[i] = p_genPower[i]/p_sbase;
+          sums[2*g] += p_genPower[i];
+          sums[2*g+1] += conj(p_genPower[i]/p_voltage[i]);
+        }
+      }
+      p_comm.sum(&sums[0],2*ngroups);
+
+      // Boundary buses are retained buses that are connected to the
+      // external system. Only active buses see all their branches
+      for (i=0; i<nbranch; i++) {
+        p_network->getBranchEndpoints(i,&l1,&l2);
+        if (p_type[l1] == External && retained(l2) &&
+            p_network->getActiveBus(l2)) {
+          p_type[l2] = Boundary;
+        } else if (p_type[l2] == External && retained(l1) &&
+            p_network->getActiveBus(l1)) {
+          p_type[l1] = Boundary;
+        }
+      }
+
+      // Set up REI buses. A group without external generation does not
+      // need an REI bus and its generators (if any) are treated as
+      // ordinary external injections
+      p_reiBus.clear();
+      p_reiPower.clear();
+      p_reiVoltage.clear();
+      p_groupREI.assign(ngroups,-1);
+      p_nREI = 0;
+      if (p_rei) {
+        int g;
+        for (g=0; g<ngroups; g++) {
+          if (abs(sums[2*g+1]) > 1.0e-8) {
+            p_groupREI[g] = p_nREI;
+            p_reiPower.push_back(sums[2*g]);
+            p_reiVoltage.push_back(sums[2*g]/conj(sums[2*g+1]));
+            p_reiBus.push_back(maxBus+1+p_nREI);
+            p_nREI++;
+          }
+        }
+        for (i=0; i<nbus; i++) {
+          if (p_genGroup[i] < 0) continue;
+          p_genGroup[i] = p_groupREI[p_genGroup[i]];
+          if (p_genGroup[i] < 0) p_genPower[i] = ComplexType(0.0,0.0);
+        }
+        if (p_nREI == 0) {
+          p_rei = false;
+          if (p_comm.rank() == 0) {
+            printf("No external generation found. REI bus is not created\n");
+          }
+        }
+      }
+      p_hasReference = (refBus == 1);
+    }
+
+    /**
+     * Number external and boundary buses consecutively across processors
+     * and exchange the numbers for ghost buses
+     */
+    void assignIndices()
+    {
+      int me = p_comm.rank();
+      int nprocs = p_comm.size();
+      int nbus = p_network->numBuses();
+      int i;
+      std::vector<int> next(nprocs,0);
+      std::vector<int> nbnd(nprocs,0);
+      for (i=0; i<nbus; i++) {
+        if (!p_network->getActiveBus(i)) continue;
+        if (p_type[i] == External) next[me]++;
+        if (p_type[i] == Boundary) nbnd[me]++;
+      }
+      // Ground buses of zero power balance networks are owned by process 0
+      if (me == 0) next[me] += p_nREI;
+      p_localExternal = next[me];
+      p_localBoundary = nbnd[me];
+      p_comm.sum(&next[0],nprocs);
+      p_comm.sum(&nbnd[0],nprocs);
+      int eoff = 0;
+      int boff = 0;
+      p_nExternal = 0;
+      p_nBoundary = 0;
+      for (i=0; i<nprocs; i++) {
+        if (i < me) {
+          eoff += next[i];
+          boff += nbnd[i];
+        }
+        p_nExternal += next[i];
+        p_nBoundary += nbnd[i];
+      }
+      p_extOffset = eoff;
+      p_nCols = p_nBoundary + p_nREI;
+      // Ground buses are the last external buses on process 0
+      p_groundIndex = p_rei ? next[0]-p_nREI : -1;
+
+      // Index of external and boundary buses. The index is exchanged using
+      // a global array with the encoding
+      //   external bus e: e
+      //   boundary bus b: -2-b
+      //   interior bus:   -1
+      p_index.assign(nbus,-1);
+      std::vector<int> activeIdx, ghostIdx, activeBuf;
+      for (i=0; i<nbus; i++) {
+        if (p_network->getActiveBus(i)) {
+          if (p_type[i] == External) {
+            p_index[i] = eoff;
+            activeBuf.push_back(eoff);
+            eoff++;
+          } else if (p_type[i] == Boundary) {
+            p_index[i] = boff;
+            activeBuf.push_back(-2-boff);
+            boff++;
+          } else {
+            activeBuf.push_back(-1);
+          }
+          activeIdx.push_back(p_network->getGlobalBusIndex(i));
+        } else {
+          ghostIdx.push_back(p_network->getGlobalBusIndex(i));
+        }
+      }
+      int total = p_network->totalBuses();
+      int nactive = activeIdx.size();
+      int nghost = ghostIdx.size();
+      std::vector<int*> activePtr(nactive), ghostPtr(nghost);
+      for (i=0; i<nactive; i++) activePtr[i] = &activeIdx[i];
+      for (i=0; i<nghost; i++) ghostPtr[i] = &ghostIdx[i];
+      std::vector<int> ghostBuf(nghost);
+      int grp = p_comm.getGroup();
+      int g_index = GA_Create_handle();
+      int one = 1;
+      if (total < 1) total = 1;
+      GA_Set_data(g_index, one, &total, C_INT);
+      GA_Set_pgroup(g_index, grp);
+      if (!GA_Allocate(g_index)) {
+        char buf[256];
+        sprintf(buf,"WardReduction::assignIndices: Unable to allocate"
+            " distributed array for bus indices\n");
+        printf("%s",buf);
+        throw gridpack::Exception(buf);
+      }
+      GA_Pgroup_sync(grp);
+      if (nactive > 0) NGA_Scatter(g_index,&activeBuf[0],&activePtr[0],nactive);
+      GA_Pgroup_sync(grp);
+      if (nghost > 0) NGA_Gather(g_index,&ghostBuf[0],&ghostPtr[0],nghost);
+      GA_Pgroup_sync(grp);
+      GA_Destroy(g_index);
+      int ig = 0;
+      for (i=0; i<nbus; i++) {
+        if (p_network->getActiveBus(i)) continue;
+        int code = ghostBuf[ig];
+        ig++;
+        if (code >= 0) {
+          p_index[i] = code;
+        } else if (code <= -2) {
+          p_type[i] = Boundary;
+          p_index[i] = -2-code;
+        }
+      }
+
+      // Original bus numbers and base case voltages of boundary buses
+      p_boundaryBus.assign(p_nCols,0);
+      p_boundaryVoltage.assign(p_nCols,ComplexType(0.0,0.0));
+      for (i=0; i<nbus; i++) {
+        if (p_network->getActiveBus(i) && p_type[i] == Boundary) {
+          p_boundaryBus[p_index[i]] = p_network->getOriginalBusIndex(i);
+          p_boundaryVoltage[p_index[i]] = p_voltage[i];
+        }
+      }
+      p_comm.sum(&p_boundaryBus[0],p_nCols);
+      p_comm.sum(&p_boundaryVoltage[0],p_nCols);
+      for (i=0; i<p_nREI; i++) {
+        p_boundaryBus[p_nBoundary+i] = p_reiBus[i];
+        p_boundaryVoltage[p_nBoundary+i] = p_reiVoltage[i];
+      }
+    }
+
+    /**
+     * Form the Y-matrix blocks of the external system and evaluate the
+     * boundary equivalent E = -Ybe*Yee^{-1}*Yeb
+     */
+    void eliminate()
+    {
+      int me = p_comm.rank();
+      int nbus = p_network->numBuses();
+      int nbranch = p_network->numBranches();
+      int nb = p_nCols;
+      int i, j, k, l1, l2;
+      ComplexType zero(0.0,0.0);
+      p_tieDiag.assign(nb,zero);
+      p_tieFlow.assign(nb,zero);
+      std::vector<int> ncols(p_comm.size(),0);
+      ncols[me] = p_localBoundary;
+      if (me == 0) ncols[me] += p_nREI;
+
+      boost::shared_ptr<gridpack::math::Matrix>
+        Yee(new gridpack::math::Matrix(p_comm,p_localExternal,
+              p_localExternal));
+      boost::shared_ptr<gridpack::math::Matrix>
+        Yeb(gridpack::math::Matrix::createDense(p_comm,p_nExternal,nb,
+              p_localExternal,ncols[me]));
+      boost::shared_ptr<gridpack::math::Matrix>
+        YbeT(new gridpack::math::Matrix(p_comm,p_localExternal,ncols[me]));
+      Yee->zero();
+      Yeb->zero();
+      YbeT->zero();
+
+      // Diagonal elements of external buses and the zero power balance
+      // networks connecting external generators to the REI buses
+      for (i=0; i<nbus; i++) {
+        if (!p_network->getActiveBus(i) || p_type[i] != External) continue;
+        gridpack::ymatrix::YMBus *bus
+          = dynamic_cast<gridpack::ymatrix::YMBus*>(p_network->getBus(i).get());
+        bus->setYBus();
+        int e = p_index[i];
+        Yee->addElement(e,e,bus->getYBus());
+        if (p_rei && abs(p_genPower[i]) > 0.0) {
+          int ig = p_groundIndex+p_genGroup[i];
+          ComplexType ik = conj(p_genPower[i]/p_voltage[i]);
+          ComplexType y = -ik/p_voltage[i];
+          Yee->addElement(e,e,y);
+          Yee->addElement(e,ig,-y);
+          Yee->addElement(ig,e,-y);
+          Yee->addElement(ig,ig,y);
+        }
+      }
+      for (i=0; i<p_nREI; i++) {
+        if (me != 0) break;
+        ComplexType y = conj(p_reiPower[i]/p_reiVoltage[i])/p_reiVoltage[i];
+        int r = p_nBoundary+i;
+        int ig = p_groundIndex+i;
+        Yee->addElement(ig,ig,y);
+        Yeb->addElement(ig,r,-y);
+        YbeT->addElement(ig,r,-y);
+        p_tieDiag[r] += y;
+      }
+
+      // Off-diagonal elements from branches in the external system and tie
+      // branches between the external system and the boundary
+      for (i=0; i<nbranch; i++) {
+        if (!p_network->getActiveBranch(i)) continue;
+        p_network->getBranchEndpoints(i,&l1,&l2);
+        int t1 = p_type[l1];
+        int t2 = p_type[l2];
+        if (t1 != External && t2 != External) continue;
+        if (t1 == Dropped || t2 == Dropped) continue;
+        gridpack::ymatrix::YMBranch *branch
+          = dynamic_cast<gridpack::ymatrix::YMBranch*>(p_network->getBranch(i).get());
+        branch->setYBus();
+        ComplexType yf = branch->getForwardYBus();
+        ComplexType yr = branch->getReverseYBus();
+        if (t1 == External && t2 == External) {
+          Yee->addElement(p_index[l1],p_index[l2],yf);
+          Yee->addElement(p_index[l2],p_index[l1],yr);
+        } else {
+          // e is the external end and b the boundary end of the tie
+          int le = l1;
+          int lb = l2;
+          ComplexType yeb = yf;
+          ComplexType ybe = yr;
+          if (t2 == External) {
+            le = l2;
+            lb = l1;
+            yeb = yr;
+            ybe = yf;
+          }
+          int e = p_index[le];
+          int b = p_index[lb];
+          gridpack::ymatrix::YMBus *bus
+            = dynamic_cast<gridpack::ymatrix::YMBus*>(p_network->getBus(lb).get());
+          Yeb->addElement(e,b,yeb);
+          YbeT->addElement(e,b,ybe);
+          p_tieDiag[b] += -branch->getAdmittance() - branch->getTransformer(bus)
+            + branch->getShunt(bus);
+          p_tieFlow[b] += ybe*p_voltage[le];
+        }
+      }
+      Yee->ready();
+      Yeb->ready();
+      YbeT->ready();
+      p_comm.sum(&p_tieDiag[0],nb);
+      p_comm.sum(&p_tieFlow[0],nb);
+
+      // Solve Yee*X = Yeb for all boundary buses at once
+      gridpack::math::LinearMatrixSolver solver(*Yee);
+      if (p_cursor != NULL) solver.configure(p_cursor);
+      boost::shared_ptr<gridpack::math::Matrix> X(solver.solve(*Yeb));
+
+      // E = -Ybe*X. Each processor evaluates the contribution from the
+      // rows of X that it owns and the result is summed
+      int lo, hi;
+      Yee->localRowRange(lo,hi);
+      int nrow = hi-lo;
+      std::vector<int> rows(nrow > 0 ? nrow : 1);
+      std::vector<ComplexType> xblk(nrow > 0 ? nrow*nb : 1);
+      std::vector<ComplexType> yblk(nrow > 0 ? nrow*nb : 1);
+      for (i=0; i<nrow; i++) rows[i] = lo+i;
+      X->getRowBlock(nrow,&rows[0],&xblk[0]);
+      YbeT->getRowBlock(nrow,&rows[0],&yblk[0]);
+      p_E.assign(nb*nb,zero);
+      for (k=0; k<nrow; k++) {
+        ComplexType *xrow = &xblk[k*nb];
+        ComplexType *yrow = &yblk[k*nb];
+        for (i=0; i<nb; i++) {
+          if (yrow[i] == zero) continue;
+          for (j=0; j<nb; j++) {
+            p_E[i*nb+j] -= yrow[i]*xrow[j];
+          }
+        }
+      }
+      p_comm.sum(&p_E[0],nb*nb);
+    }
+
+    /**
+     * Evaluate equivalent branches, shunts and injections at the boundary
+     * buses from E. Equivalent branches use the symmetric part of E and
+     * branches with admittances below the tolerance are dropped. The
+     * equivalent injections are chosen so that the reduced network
+     * reproduces the base case exactly
+     */
+    void equivalents()
+    {
+      int nb = p_nCols;
+      int i, j;
+      ComplexType zero(0.0,0.0);
+      p_yEquiv.assign(nb*nb,zero);
+      p_keep.assign(nb*nb,0);
+      for (i=0; i<nb; i++) {
+        for (j=i+1; j<nb; j++) {
+          ComplexType y = -0.5*(p_E[i*nb+j]+p_E[j*nb+i]);
+          if (abs(y) >= p_tolerance) {
+            p_yEquiv[i*nb+j] = y;
+            p_yEquiv[j*nb+i] = y;
+            p_keep[i*nb+j] = 1;
+            p_keep[j*nb+i] = 1;
+          }
+        }
+      }
+      p_shunt.assign(nb,zero);
+      p_injection.assign(nb,zero);
+      std::vector<ComplexType> &v = p_boundaryVoltage;
+      for (i=0; i<nb; i++) {
+        p_shunt[i] = p_tieDiag[i] + p_E[i*nb+i];
+        for (j=0; j<nb; j++) {
+          if (j != i && p_keep[i*nb+j]) p_shunt[i] -= p_yEquiv[i*nb+j];
+        }
+        ComplexType equiv = p_shunt[i]*v[i];
+        for (j=0; j<nb; j++) {
+          if (j != i && p_keep[i*nb+j]) {
+            equiv += p_yEquiv[i*nb+j]*(v[i]-v[j]);
+          }
+        }
+        ComplexType tie = p_tieDiag[i]*v[i] + p_tieFlow[i];
+        // Equivalent load is the power drawn by the external system that
+        // is not already drawn by the equivalent elements
+        p_injection[i] = v[i]*conj(tie-equiv);
+      }
+
+      // If the study system has no reference bus, use the REI bus or the
+      // first boundary bus
+      p_refBoundary = -1;
+      if (!p_hasReference) {
+        p_refBoundary = p_rei ? p_nBoundary : 0;
+      }
+    }
+
+    /**
+     * Add equivalent shunt and load to data collection of boundary bus
+     * @param data data collection of boundary bus
+     * @param b boundary index
+     */
+    void setBoundaryData(boost::shared_ptr<gridpack::component::DataCollection> data,
+        int b)
+    {
+      double gl = 0.0;
+      double bl = 0.0;
+      double binit;
+      data->getValue(BUS_SHUNT_GL,&gl,0);
+      data->getValue(BUS_SHUNT_BL,&bl,0);
+      gl += real(p_shunt[b])*p_sbase;
+      bl += imag(p_shunt[b])*p_sbase;
+      if (!data->setValue(BUS_SHUNT_GL,gl,0)) data->addValue(BUS_SHUNT_GL,gl,0);
+      if (!data->setValue(BUS_SHUNT_BL,bl,0)) data->addValue(BUS_SHUNT_BL,bl,0);
+      if (data->getValue(SHUNT_BINIT,&binit)) {
+        data->setValue(SHUNT_BINIT,binit+imag(p_shunt[b])*p_sbase);
+      }
+
+      int nld = 0;
+      if (!data->getValue(LOAD_NUMBER,&nld)) data->addValue(LOAD_NUMBER,0);
+      data->addValue(LOAD_ID,"EQ",nld);
+      data->addValue(LOAD_STATUS,1,nld);
+      data->addValue(LOAD_PL,real(p_injection[b])*p_sbase,nld);
+      data->addValue(LOAD_QL,imag(p_injection[b])*p_sbase,nld);
+      data->addValue(LOAD_IP,0.0,nld);
+      data->addValue(LOAD_IQ,0.0,nld);
+      data->addValue(LOAD_YP,0.0,nld);
+      data->addValue(LOAD_YQ,0.0,nld);
+      data->setValue(LOAD_NUMBER,nld+1);
+
+      if (b != p_refBoundary) return;
+      // Boundary bus becomes reference bus. Add a generator if the bus
+      // does not have one in service
+      data->setValue(BUS_TYPE,3);
+      int ngen = 0;
+      int status = 0;
+      int i;
+      if (!data->getValue(GENERATOR_NUMBER,&ngen)) {
+        data->addValue(GENERATOR_NUMBER,0);
+      }
+      for (i=0; i<ngen; i++) {
+        int stat = 0;
+        data->getValue(GENERATOR_STAT,&stat,i);
+        if (stat == 1) status = 1;
+      }
+      if (status == 0) {
+        setGenerator(data, ngen, "EQ", ComplexType(0.0,0.0), abs(p_boundaryVoltage[b]));
+        data->setValue(GENERATOR_NUMBER,ngen+1);
+      }
+    }
+
+    /**
+     * Create data collection for REI bus
+     * @param data empty data collection
+     * @param idx index of REI bus
+     */
+    void setREIBusData(boost::shared_ptr<gridpack::component::DataCollection> data,
+        int idx)
+    {
+      double pi = 4.0*atan(1.0);
+      data->addValue(BUS_NUMBER,p_reiBus[idx]);
+      data->addValue(BUS_NAME,"REI");
+      data->addValue(BUS_TYPE,2);
+      data->addValue(BUS_AREA,p_areas[0]);
+      data->addValue(BUS_ZONE,p_zones.size() > 0 ? p_zones[0] : 1);
+      data->addValue(BUS_OWNER,1);
+      data->addValue(BUS_BASEKV,1.0);
+      data->addValue(BUS_VOLTAGE_MAG,abs(p_reiVoltage[idx]));
+      data->addValue(BUS_VOLTAGE_ANG,arg(p_reiVoltage[idx])*180.0/pi);
+      data->addValue(BUS_SHUNT_GL,0.0,0);
+      data->addValue(BUS_SHUNT_BL,0.0,0);
+      data->addValue(CASE_ID,p_caseID);
+      data->addValue(CASE_SBASE,p_sbase);
+      data->addValue(GENERATOR_NUMBER,1);
+      setGenerator(data, 0, "R", p_reiPower[idx], abs(p_reiVoltage[idx]));
+    }
+
+    /**
+     * Add a generator to a bus data collection
+     * @param data data collection for bus
+     * @param idx index of generator
+     * @param id generator ID
+     * @param s generator output (p.u.)
+     * @param vs voltage set point
+     */
+    void setGenerator(boost::shared_ptr<gridpack::component::DataCollection> data,
+        int idx, const char *id, ComplexType s, double vs)
+    {
+      double pmax = real(s)*p_sbase;
+      if (pmax < 0.0) pmax = 0.0;
+      data->addValue(GENERATOR_ID,id,idx);
+      data->addValue(GENERATOR_STAT,1,idx);
+      data->addValue(GENERATOR_PG,real(s)*p_sbase,idx);
+      data->addValue(GENERATOR_QG,imag(s)*p_sbase,idx);
+      data->addValue(GENERATOR_VS,vs,idx);
+      data->addValue(GENERATOR_QMAX,9999.0,idx);
+      data->addValue(GENERATOR_QMIN,-9999.0,idx);
+      data->addValue(GENERATOR_PMAX,pmax,idx);
+      data->addValue(GENERATOR_PMIN,0.0,idx);
+      data->addValue(GENERATOR_MBASE,p_sbase,idx);
+      data->addValue(GENERATOR_IREG,0,idx);
+    }
+
+    /**
+     * Add an equivalent transmission element to a branch data collection
+     * @param data data collection for branch
+     * @param idx index of element
+     * @param y series admittance of element (p.u.)
+     */
+    void setBranchElement(boost::shared_ptr<gridpack::component::DataCollection> data,
+        int idx, ComplexType y)
+    {
+      ComplexType z = 1.0/y;
+      data->addValue(BRANCH_R,real(z),idx);
+      data->addValue(BRANCH_X,imag(z),idx);
+      data->addValue(BRANCH_B,0.0,idx);
+      data->addValue(BRANCH_TAP,0.0,idx);
+      data->addValue(BRANCH_SHIFT,0.0,idx);
+      data->addValue(BRANCH_STATUS,1,idx);
+      data->addValue(BRANCH_CKT,"EQ",idx);
+      data->addValue(BRANCH_SWITCHED,false,idx);
+      data->addValue(BRANCH_SHUNT_ADMTTNC_G1,0.0,idx);
+      data->addValue(BRANCH_SHUNT_ADMTTNC_B1,0.0,idx);
+      data->addValue(BRANCH_SHUNT_ADMTTNC_G2,0.0,idx);
+      data->addValue(BRANCH_SHUNT_ADMTTNC_B2,0.0,idx);
+      data->addValue(BRANCH_RATING_A,0.0,idx);
+      data->addValue(BRANCH_RATING_B,0.0,idx);
+      data->addValue(BRANCH_RATING_C,0.0,idx);
+    }
+
+    boost::shared_ptr<_network> p_network;
+    gridpack::parallel::Communicator p_comm;
+    gridpack::utility::Configuration::CursorPtr p_cursor;
+
+    // study system and options
+    std::vector<int> p_areas;
+    std::vector<int> p_zones;
+    bool p_rei;
+    double p_tolerance;
+    bool p_reduced;
+
+    // classification and indices of local buses
+    std::vector<int> p_type;
+    std::vector<int> p_index;
+    std::vector<ComplexType> p_voltage;
+    std::vector<ComplexType> p_genPower;
+    std::vector<int> p_genGroup;
+    int p_localExternal;
+    int p_localBoundary;
+    int p_extOffset;
+    int p_nExternal;
+    int p_nBoundary;
+    int p_nCols;
+    int p_groundIndex;
+    bool p_hasReference;
+    int p_refBoundary;
+    double p_sbase;
+    int p_caseID;
+
+    // REI buses
+    std::vector<int> p_groupBuses;
+    std::vector<int> p_groupIDs;
+    std::vector<int> p_groupREI;
+    int p_nREI;
+    std::vector<int> p_reiBus;
+    std::vector<ComplexType> p_reiPower;
+    std::vector<ComplexType> p_reiVoltage;
+
+    // boundary equivalents (dense, replicated on all processors)
+    std::vector<int> p_boundaryBus;
+    std::vector<ComplexType> p_boundaryVoltage;
+    std::vector<ComplexType> p_tieDiag;
+    std::vector<ComplexType> p_tieFlow;
+    std::vector<ComplexType> p_E;
+    std::vector<ComplexType> p_yEquiv;
+    std::vector<int> p_keep;
+    std::vector<ComplexType> p_shunt;
+    std::vector<ComplexType> p_injection;
+};
+
+} // network_reduction
+} // gridpack
+#endif
@@ -0,0 +1,178 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   coherency_test.cpp
+ * @date   October 19, 2026
+ *
+ * @brief  Replace area 2 of the IEEE 145 bus system by a coherency based
+ * dynamic equivalent and check that the rotor angle swings of generators in
+ * the study area follow those of the full system after a fault in the study
+ * area. Run as "coherency_test coherency_input.xml"
+ */
+// -------------------------------------------------------------
+
+#include "mpi.h"
+#include <ga.h>
+#include <macdecls.h>
+#include "gridpack/include/gridpack.hpp"
+#include "gridpack/applications/modules/powerflow/pf_app_module.hpp"
+#include "gridpack/applications/modules/dynamic_simulation_full_y/dsf_app_module.hpp"
+#include "nr_ward_reduction.hpp"
+#include "nr_coherency.hpp"
+
+int
+main(int argc, char **argv)
+{
+  gridpack::Environment env(argc,argv);
+  int ret = 0;
+
+  if (1) {
+    gridpack::parallel::Communicator world;
+
+    // read configuration file
+    gridpack::utility::Configuration *config =
+      gridpack::utility::Configuration::configuration();
+    if (argc >= 2 && argv[1] != NULL) {
+      char inputfile[256];
+      sprintf(inputfile,"%s",argv[1]);
+      config->open(inputfile,world);
+    } else {
+      config->open("input.xml",world);
+    }
+    gridpack::utility::Configuration::CursorPtr cursor;
+    cursor = config->getCursor("Configuration.Network_reduction");
+    double time = cursor->get("simulationTime",5.0);
+
+    // solve powerflow on full network
+    boost::shared_ptr<gridpack::powerflow::PFNetwork>
+      pf_network(new gridpack::powerflow::PFNetwork(world));
+    gridpack::powerflow::PFAppModule pf_app;
+    pf_app.readNetwork(pf_network,config);
+    pf_app.initialize();
+    pf_app.solve();
+    pf_app.saveDataAlsotoOrg();
+
+    // identify coherent groups of generators in area 2
+    boost::shared_ptr<gridpack::dynamic_simulation::DSFullNetwork>
+      ds_network(new gridpack::dynamic_simulation::DSFullNetwork(world));
+    pf_network->clone<gridpack::dynamic_simulation::DSFullBus,
+      gridpack::dynamic_simulation::DSFullBranch>(ds_network);
+    gridpack::dynamic_simulation::DSFullApp ds_app;
+    ds_app.setNetwork(ds_network,config);
+    ds_app.readGenerators();
+    ds_app.initialize();
+    std::vector<gridpack::dynamic_simulation::Event> events
+      = ds_app.getEvents();
+    gridpack::network_reduction::CoherencyEquivalent coherency(ds_network);
+    coherency.configure(cursor);
+    coherency.identifyGroups(ds_app,events[0]);
+    int i, j;
+
+    // every external generator bus must belong to exactly one group
+    std::vector<int> gbuses, groups;
+    coherency.getGroups(gbuses,groups);
+    bool grouped = coherency.numGroups() > 0 && gbuses.size() > 0
+      && gbuses.size() == groups.size();
+    std::vector<int> gsize(coherency.numGroups(),0);
+    for (i=0; i<groups.size(); i++) {
+      if (groups[i] < 0 || groups[i] >= coherency.numGroups()) {
+        grouped = false;
+      } else {
+        gsize[groups[i]]++;
+      }
+    }
+    for (i=0; i<gsize.size(); i++) {
+      if (gsize[i] == 0) grouped = false;
+    }
+    // generators in the study area (area 1) must not be grouped
+    for (i=0; i<gbuses.size(); i++) {
+      if (gbuses[i] < 90) grouped = false;
+    }
+
+    // create equivalent with one REI bus for each coherent group
+    gridpack::network_reduction::WardReduction<gridpack::powerflow::PFNetwork>
+      reduction(pf_network);
+    reduction.configure(cursor);
+    reduction.setGeneratorGroups(gbuses,groups);
+    reduction.reduce();
+    boost::shared_ptr<gridpack::dynamic_simulation::DSFullNetwork>
+      nr_network(new gridpack::dynamic_simulation::DSFullNetwork(world));
+    reduction.createNetwork(nr_network);
+    std::vector<int> reiBuses;
+    for (i=0; i<coherency.numGroups(); i++) {
+      reiBuses.push_back(reduction.getREIBus(i));
+    }
+
+    // set up dynamic simulation on reduced network. Generators in the
+    // study area are read from the original DYR file, equivalent machines
+    // are created by aggregation
+    gridpack::dynamic_simulation::DSFullApp nr_app;
+    nr_app.setNetwork(nr_network,config);
+    nr_app.readGenerators();
+    coherency.aggregate(nr_network,reiBuses);
+    coherency.writeDyr(nr_network,"reduced.dyr");
+    nr_app.initialize();
+
+    // run reference simulation on a fresh copy of the full network and
+    // compare rotor angle swings of generators in the study area
+    boost::shared_ptr<gridpack::dynamic_simulation::DSFullNetwork>
+      ref_network(new gridpack::dynamic_simulation::DSFullNetwork(world));
+    pf_network->clone<gridpack::dynamic_simulation::DSFullBus,
+      gridpack::dynamic_simulation::DSFullBranch>(ref_network);
+    gridpack::dynamic_simulation::DSFullApp ref_app;
+    ref_app.setNetwork(ref_network,config);
+    ref_app.readGenerators();
+    ref_app.initialize();
+
+    std::vector<int> buses;
+    std::vector<std::string> tags;
+    buses.push_back(60);
+    buses.push_back(67);
+    buses.push_back(79);
+    for (i=0; i<buses.size(); i++) tags.push_back("1");
+    int nref, nred;
+    std::vector<double> ref_swing, red_swing;
+    coherency.angleSwings(ref_app,events[0],buses,tags,time,nref,ref_swing);
+    std::vector<gridpack::dynamic_simulation::Event> nr_events
+      = nr_app.getEvents();
+    coherency.angleSwings(nr_app,nr_events[0],buses,tags,time,nred,red_swing);
+
+    double maxda = 0.0;
+    double maxswing = 0.0;
+    int nsteps = nref < nred ? nref : nred;
+    for (i=0; i<buses.size(); i++) {
+      for (j=0; j<nsteps; j++) {
+        double d = fabs(ref_swing[i*nref+j]-red_swing[i*nred+j]);
+        if (d > maxda) maxda = d;
+        if (fabs(ref_swing[i*nref+j]) > maxswing)
+          maxswing = fabs(ref_swing[i*nref+j]);
+      }
+    }
+    if (world.rank() == 0) {
+      printf("\nCoherent groups: %d buses eliminated: %d boundary buses: %d\n",
+          coherency.numGroups(),reduction.numExternalBuses(),
+          reduction.numBoundaryBuses());
+      printf("Maximum rotor angle swing (full system):  %12.4e\n",maxswing);
+      printf("Maximum rotor angle swing difference:     %12.4e\n",maxda);
+      if (!grouped) {
+        printf("\nCoherent groups do not cover all external generators\n");
+      }
+    }
+    if (!grouped || nref != nred || maxswing <= 0.0 || maxda >= 0.1*maxswing) {
+      ret = 1;
+    }
+    if (world.rank() == 0) {
+      if (ret == 0) {
+        printf("\nCoherency equivalent test passed\n");
+      } else {
+        printf("\nCoherency equivalent test failed\n");
+      }
+    }
+  }
+
+  return ret;
+}
@@ -0,0 +1,113 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   nr_test.cpp
+ * @date   October 19, 2026
+ *
+ * @brief  Reduce the IEEE 14 bus system to area 1 and check that the
+ * powerflow solution of the reduced network matches the full solution at
+ * the retained buses
+ */
+// -------------------------------------------------------------
+
+#include "mpi.h"
+#include <ga.h>
+#include <macdecls.h>
+#include "gridpack/include/gridpack.hpp"
+#include "gridpack/applications/modules/powerflow/pf_app_module.hpp"
+#include "nr_ward_reduction.hpp"
+
+int
+main(int argc, char **argv)
+{
+  gridpack::Environment env(argc,argv);
+  int ret = 0;
+
+  if (1) {
+    gridpack::parallel::Communicator world;
+
+    // read configuration file
+    gridpack::utility::Configuration *config =
+      gridpack::utility::Configuration::configuration();
+    if (argc >= 2 && argv[1] != NULL) {
+      char inputfile[256];
+      sprintf(inputfile,"%s",argv[1]);
+      config->open(inputfile,world);
+    } else {
+      config->open("input.xml",world);
+    }
+
+    // solve powerflow on full network
+    boost::shared_ptr<gridpack::powerflow::PFNetwork>
+      pf_network(new gridpack::powerflow::PFNetwork(world));
+    gridpack::powerflow::PFAppModule pf_app;
+    pf_app.readNetwork(pf_network,config);
+    pf_app.initialize();
+    pf_app.solve();
+    pf_app.saveDataAlsotoOrg();
+
+    // create equivalent of area 2 and solve powerflow on reduced network
+    gridpack::utility::Configuration::CursorPtr cursor;
+    cursor = config->getCursor("Configuration.Network_reduction");
+    gridpack::network_reduction::WardReduction<gridpack::powerflow::PFNetwork>
+      reduction(pf_network);
+    reduction.configure(cursor);
+    reduction.reduce();
+    boost::shared_ptr<gridpack::powerflow::PFNetwork>
+      nr_network(new gridpack::powerflow::PFNetwork(world));
+    reduction.createNetwork(nr_network);
+
+    gridpack::powerflow::PFAppModule nr_app;
+    nr_app.setNetwork(nr_network,config);
+    nr_app.initialize();
+    nr_app.solve();
+    nr_app.write();
+
+    // compare voltages on retained buses
+    double maxdv = 0.0;
+    double maxda = 0.0;
+    int i;
+    for (i=6; i<=14; i++) {
+      // bus may be found on several processors as a ghost bus, so
+      // average values over all processors that have it
+      double v[6] = {0.0,0.0,0.0,0.0,0.0,0.0};
+      double vmag, vang;
+      if (pf_app.getPFSolutionSingleBus(i,vmag,vang)) {
+        v[0] = vmag;
+        v[1] = vang;
+        v[4] = 1.0;
+      }
+      if (nr_app.getPFSolutionSingleBus(i,vmag,vang)) {
+        v[2] = vmag;
+        v[3] = vang;
+        v[5] = 1.0;
+      }
+      world.sum(v,6);
+      v[0] /= v[4];
+      v[1] /= v[4];
+      v[2] /= v[5];
+      v[3] /= v[5];
+      if (fabs(v[0]-v[2]) > maxdv) maxdv = fabs(v[0]-v[2]);
+      if (fabs(v[1]-v[3]) > maxda) maxda = fabs(v[1]-v[3]);
+    }
+    bool ok = (maxdv < 1.0e-4 && maxda < 1.0e-3);
+    if (world.rank() == 0) {
+      printf("\nBuses eliminated: %d boundary buses: %d\n",
+          reduction.numExternalBuses(),reduction.numBoundaryBuses());
+      printf("Maximum voltage magnitude difference: %12.4e\n",maxdv);
+      printf("Maximum voltage angle difference:     %12.4e\n",maxda);
+      if (ok) {
+        printf("\nNetwork reduction test passed\n");
+      } else {
+        printf("\nNetwork reduction test failed\n");
+      }
+    }
+    if (!ok) ret = 1;
+  }
+
+  return ret;
+}
@@ -0,0 +1,376 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   parareal_driver.cpp
+ * @date   October 19, 2026
+ *
+ * @brief
+ *
+ *
+ */
+// -------------------------------------------------------------
+
+#include <math.h>
+#include <stdio.h>
+#include "parareal_driver.hpp"
+
+/**
+ * Basic constructor
+ * @param comm communicator that is divided into task groups
+ */
+gridpack::parareal::PararealDriver::PararealDriver(
+    gridpack::parallel::Communicator comm)
+  : p_comm(comm), p_task_comm(comm)
+{
+  p_root_comm = MPI_COMM_NULL;
+  p_grp_size = 1;
+  p_coarse_step = 0.0;
+  p_start_time = -1.0;
+  p_tolerance = 1.0e-4;
+  p_max_iterations = -1;
+  p_fine_step = 0.0;
+  p_num_windows = 0;
+  p_window = 0;
+  p_iterations = 0;
+  p_change = 0.0;
+}
+
+/**
+ * Basic destructor
+ */
+gridpack::parareal::PararealDriver::~PararealDriver()
+{
+  if (p_root_comm != MPI_COMM_NULL) MPI_Comm_free(&p_root_comm);
+}
+
+/**
+ * Read parameters from the Parareal block of the input file
+ * @param cursor pointer to Parareal block
+ */
+void gridpack::parareal::PararealDriver::configure(
+    gridpack::utility::Configuration::CursorPtr cursor)
+{
+  p_grp_size = cursor->get("groupSize",1);
+  if (p_grp_size < 1) p_grp_size = 1;
+  p_coarse_step = cursor->get("coarseTimeStep",0.0);
+  p_start_time = cursor->get("startTime",-1.0);
+  p_tolerance = cursor->get("tolerance",1.0e-4);
+  p_max_iterations = cursor->get("maxIterations",-1);
+}
+
+/**
+ * Divide processors into task groups, solve the power flow and set up the
+ * dynamic simulation on each group and run the simulation up to the start
+ * time of the parallel iteration
+ * @param config pointer to open configuration file
+ */
+void gridpack::parareal::PararealDriver::setup(
+    gridpack::utility::Configuration *config)
+{
+  // create task groups. Groups are ordered by the rank of their first
+  // processor, which is also the order of the time windows
+  p_task_comm = p_comm.divide(p_grp_size);
+  if (p_root_comm != MPI_COMM_NULL) MPI_Comm_free(&p_root_comm);
+  int color = (p_task_comm.rank() == 0) ? 0 : MPI_UNDEFINED;
+  MPI_Comm_split(static_cast<MPI_Comm>(p_comm),color,p_comm.rank(),
+      &p_root_comm);
+  int ibuf[2];
+  if (p_task_comm.rank() == 0) {
+    MPI_Comm_rank(p_root_comm,&ibuf[0]);
+    MPI_Comm_size(p_root_comm,&ibuf[1]);
+  }
+  MPI_Bcast(ibuf,2,MPI_INT,0,static_cast<MPI_Comm>(p_task_comm));
+  p_window = ibuf[0];
+  p_num_windows = ibuf[1];
+
+  // solve power flow and set up dynamic simulation on task group
+  gridpack::utility::Configuration::CursorPtr cursor;
+  cursor = config->getCursor("Configuration.Powerflow");
+  bool useNonLinear = cursor->get("UseNonLinear",false);
+  p_pf_network.reset(new gridpack::powerflow::PFNetwork(p_task_comm));
+  gridpack::powerflow::PFAppModule pf_app;
+  pf_app.readNetwork(p_pf_network,config);
+  pf_app.initialize();
+  if (useNonLinear) {
+    pf_app.nl_solve();
+  } else {
+    pf_app.solve();
+  }
+  pf_app.saveData();
+
+  p_ds_network.reset(
+      new gridpack::dynamic_simulation::DSFullNetwork(p_task_comm));
+  p_pf_network->clone<gridpack::dynamic_simulation::DSFullBus,
+    gridpack::dynamic_simulation::DSFullBranch>(p_ds_network);
+  p_app.reset(new gridpack::dynamic_simulation::DSFullApp(p_task_comm));
+  p_app->transferPFtoDS(p_pf_network,p_ds_network);
+  p_app->setNetwork(p_ds_network,config);
+  p_app->readGenerators();
+  p_app->initialize();
+  p_app->setup();
+
+  // the coarse time step is a multiple of the fine time step
+  p_fine_step = p_app->getTimeStep();
+  if (p_coarse_step <= 0.0) p_coarse_step = 10.0*p_fine_step;
+  int ratio = static_cast<int>(p_coarse_step/p_fine_step+0.5);
+  if (ratio < 1) ratio = 1;
+  p_coarse_step = static_cast<double>(ratio)*p_fine_step;
+
+  // the parallel iteration starts after the last event so that the
+  // Y-matrix does not change inside the time windows
+  std::vector<gridpack::dynamic_simulation::Event> events
+    = p_app->getEvents();
+  double last = 0.0;
+  int i;
+  for (i=0; i<events.size(); i++) {
+    double t = events[i].isBusFault ? events[i].end : events[i].time;
+    if (t > last) last = t;
+  }
+  double start = p_start_time;
+  if (start < last) {
+    if (p_start_time >= 0.0 && p_comm.rank() == 0) {
+      printf("Parareal start time %f is before the last event at %f\n",
+          p_start_time,last);
+    }
+    start = last;
+  }
+  int nstart = static_cast<int>(ceil(start/p_fine_step-1.0e-6));
+  start = static_cast<double>(nstart)*p_fine_step;
+
+  // divide the remaining horizon into windows made up of whole coarse
+  // time steps
+  int ncoarse = static_cast<int>((p_app->getFinalTime()-start)
+      /p_coarse_step+0.5);
+  p_bounds.clear();
+  if (ncoarse < p_num_windows) {
+    if (p_comm.rank() == 0) {
+      printf("Parareal: %d coarse time steps are too few for %d windows\n",
+          ncoarse,p_num_windows);
+    }
+    return;
+  }
+  for (i=0; i<=p_num_windows; i++) {
+    p_bounds.push_back(start+static_cast<double>((i*ncoarse)/p_num_windows)
+        *p_coarse_step);
+  }
+  if (p_max_iterations < 0) p_max_iterations = p_num_windows;
+
+  // run simulation through all events on all task groups
+  p_app->advance(start,p_fine_step);
+  p_app->getSystemState(p_initial);
+
+  // all task groups must use the same state vector layout
+  int nmin = p_initial.size();
+  int nmax = nmin;
+  p_comm.min(&nmin,1);
+  p_comm.max(&nmax,1);
+  if (nmin != nmax) {
+    if (p_comm.rank() == 0) {
+      printf("Parareal: task groups have different state vectors\n");
+    }
+    p_bounds.clear();
+  }
+  // the state vector only restores the system exactly if every model
+  // exposes its states
+  int nhidden = p_app->numHiddenStateDevices();
+  p_comm.max(&nhidden,1);
+  if (nhidden > 0) {
+    if (p_comm.rank() == 0) {
+      printf("Parareal: %d dynamic models do not provide access to their"
+          " states\n",nhidden);
+    }
+    p_bounds.clear();
+  }
+  if (p_comm.rank() == 0 && p_bounds.size() > 0) {
+    printf("\nParareal: %d windows from %f to %f, fine step %f"
+        " coarse step %f\n",p_num_windows,p_bounds[0],
+        p_bounds[p_num_windows],p_fine_step,p_coarse_step);
+    printf("Parareal: %d values in system state\n",nmax);
+  }
+}
+
+/**
+ * Run Parareal iterations until the states at the window boundaries
+ * converge
+ * @return true if the iteration converged
+ */
+bool gridpack::parareal::PararealDriver::solve()
+{
+  p_iterations = 0;
+  p_change = 0.0;
+  p_final.clear();
+  if (p_bounds.size() == 0) return false;
+  int nsize = p_initial.size();
+  double t0 = p_bounds[p_window];
+  double t1 = p_bounds[p_window+1];
+
+  // the initial coarse sweep is done redundantly by all task groups so that
+  // no communication is needed
+  std::vector<double> u, g, f, unew, gnew, next, sent;
+  p_app->setSystemState(p_initial,p_bounds[0]);
+  p_app->advance(t0,p_coarse_step);
+  p_app->getSystemState(u);
+  p_app->advance(t1,p_coarse_step);
+  p_app->getSystemState(g);
+  sent = g;
+  next.resize(nsize);
+
+  bool converged = false;
+  bool fine = true;
+  int i;
+  while (p_iterations < p_max_iterations) {
+    // fine propagation of all windows in parallel. It is skipped if the
+    // state at the start of the window has not changed
+    if (fine) propagate(u,p_fine_step,f);
+
+    // coarse correction, passed from window to window
+    if (p_window > 0) {
+      receive(unew);
+    } else {
+      unew = u;
+    }
+    bool changed = (unew != u);
+    if (changed) {
+      propagate(unew,p_coarse_step,gnew);
+    } else {
+      gnew = g;
+    }
+    double change = 0.0;
+    for (i=0; i<nsize; i++) {
+      next[i] = gnew[i] + f[i] - g[i];
+      double d = fabs(next[i]-sent[i]);
+      if (d > change) change = d;
+    }
+    if (p_window < p_num_windows-1) send(next);
+    u = unew;
+    g = gnew;
+    sent = next;
+    fine = changed;
+
+    p_comm.max(&change,1);
+    p_iterations++;
+    p_change = change;
+    if (p_comm.rank() == 0) {
+      printf("Parareal iteration %d: maximum change %12.4e\n",
+          p_iterations,change);
+    }
+    if (change < p_tolerance) {
+      converged = true;
+      break;
+    }
+  }
+
+  // distribute state at the end of the last window
+  int root = -1;
+  if (p_window == p_num_windows-1 && p_task_comm.rank() == 0) {
+    root = p_comm.rank();
+  }
+  p_comm.max(&root,1);
+  p_final = sent;
+  MPI_Bcast(&p_final[0],nsize,MPI_DOUBLE,root,static_cast<MPI_Comm>(p_comm));
+  return converged;
+}
+
+/**
+ * @return number of time windows (task groups)
+ */
+int gridpack::parareal::PararealDriver::numWindows() const
+{
+  return p_num_windows;
+}
+
+/**
+ * @return number of iterations used by the last call to solve
+ */
+int gridpack::parareal::PararealDriver::numIterations() const
+{
+  return p_iterations;
+}
+
+/**
+ * @return largest change of the boundary states in the last iteration
+ */
+double gridpack::parareal::PararealDriver::getChange() const
+{
+  return p_change;
+}
+
+/**
+ * Get the time window that is integrated by this task group
+ * @param start time at beginning of window
+ * @param end time at end of window
+ */
+void gridpack::parareal::PararealDriver::getWindow(double *start,
+    double *end) const
+{
+  if (p_bounds.size() == 0) {
+    *start = 0.0;
+    *end = 0.0;
+    return;
+  }
+  *start = p_bounds[p_window];
+  *end = p_bounds[p_window+1];
+}
+
+/**
+ * Get the system state at the end of the simulation
+ * @param x state vector
+ */
+void gridpack::parareal::PararealDriver::getFinalState(
+    std::vector<double> &x) const
+{
+  x = p_final;
+}
+
+/**
+ * @return dynamic simulation application of this task group
+ */
+gridpack::dynamic_simulation::DSFullApp&
+gridpack::parareal::PararealDriver::getApp()
+{
+  return *p_app;
+}
+
+/**
+ * Propagate a state across the window of this task group
+ * @param x state at beginning of window
+ * @param step time step
+ * @param y state at end of window
+ */
+void gridpack::parareal::PararealDriver::propagate(
+    const std::vector<double> &x, double step, std::vector<double> &y)
+{
+  p_app->setSystemState(x,p_bounds[p_window]);
+  p_app->advance(p_bounds[p_window+1],step);
+  p_app->getSystemState(y);
+}
+
+/**
+ * Receive state from previous window
+ * @param x state vector
+ */
+void gridpack::parareal::PararealDriver::receive(std::vector<double> &x)
+{
+  int nsize = p_initial.size();
+  x.resize(nsize);
+  if (p_task_comm.rank() == 0) {
+    MPI_Status status;
+    MPI_Recv(&x[0],nsize,MPI_DOUBLE,p_window-1,0,p_root_comm,&status);
+  }
+  MPI_Bcast(&x[0],nsize,MPI_DOUBLE,0,static_cast<MPI_Comm>(p_task_comm));
+}
+
+/**
+ * Send state to next window
+ * @param x state vector
+ */
+void gridpack::parareal::PararealDriver::send(std::vector<double> &x)
+{
+  if (p_task_comm.rank() == 0) {
+    MPI_Send(&x[0],x.size(),MPI_DOUBLE,p_window+1,0,p_root_comm);
+  }
+}
@@ -0,0 +1,187 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   parareal_driver.hpp
+ * @date   October 19, 2026
+ *
+ * @brief  Parallel-in-time (Parareal) driver for long full-Y dynamic
+ * simulations. The processors are divided into task groups and each group
+ * sets up its own copy of the network and a DSFullApp. The simulation up to
+ * the end of the last event is run redundantly on all groups. The remaining
+ * horizon is split into one time window per group. A coarse propagator G
+ * (the same integrator with a larger time step) and the fine propagator F
+ * (the integrator with the time step of the input deck) are combined in the
+ * Parareal iteration
+ *
+ *   U(n+1) <- G(U(n)) + F(Uold(n)) - G(Uold(n))
+ *
+ * The fine propagations of all windows run concurrently, the coarse
+ * corrections are passed from window to window. The iteration stops when
+ * the states at the window boundaries no longer change.
+ */
+// -------------------------------------------------------------
+
+#ifndef _parareal_driver_h_
+#define _parareal_driver_h_
+
+#include <vector>
+#include "mpi.h"
+#include "boost/smart_ptr/shared_ptr.hpp"
+#include "gridpack/parallel/communicator.hpp"
+#include "gridpack/configuration/configuration.hpp"
+#include "gridpack/applications/modules/powerflow/pf_app_module.hpp"
+#include "gridpack/applications/modules/dynamic_simulation_full_y/dsf_app_module.hpp"
+
+namespace gridpack {
+namespace parareal {
+
+class PararealDriver
+{
+  public:
+
+    /**
+     * Basic constructor
+     * @param comm communicator that is divided into task groups
+     */
+    PararealDriver(gridpack::parallel::Communicator comm);
+
+    /**
+     * Basic destructor
+     */
+    ~PararealDriver();
+
+    /**
+     * Read parameters from the Parareal block of the input file. The block
+     * can contain
+     *   groupSize:       number of processors in each task group
+     *   coarseTimeStep:  time step of the coarse propagator. It is rounded
+     *                    to a multiple of the fine time step
+     *   startTime:       time at which the parallel iteration starts. The
+     *                    default is the end of the last event. All events
+     *                    must be finished before this time
+     *   tolerance:       maximum change of the states at the window
+     *                    boundaries in a converged iteration
+     *   maxIterations:   maximum number of iterations. The default is the
+     *                    number of windows, after which the iteration is
+     *                    exact
+     * @param cursor pointer to Parareal block
+     */
+    void configure(gridpack::utility::Configuration::CursorPtr cursor);
+
+    /**
+     * Divide processors into task groups, solve the power flow and set up
+     * the dynamic simulation on each group and run the simulation up to
+     * the start time of the parallel iteration. Dynamic simulation
+     * parameters and events are taken from the Dynamic_simulation block.
+     * This is a collective operation
+     * @param config pointer to open configuration file
+     */
+    void setup(gridpack::utility::Configuration *config);
+
+    /**
+     * Run Parareal iterations until the states at the window boundaries
+     * converge. This is a collective operation
+     * @return true if the iteration converged
+     */
+    bool solve();
+
+    /**
+     * @return number of time windows (task groups)
+     */
+    int numWindows() const;
+
+    /**
+     * @return number of iterations used by the last call to solve
+     */
+    int numIterations() const;
+
+    /**
+     * @return largest change of the boundary states in the last iteration
+     */
+    double getChange() const;
+
+    /**
+     * Get the time window that is integrated by this task group
+     * @param start time at beginning of window
+     * @param end time at end of window
+     */
+    void getWindow(double *start, double *end) const;
+
+    /**
+     * Get the system state at the end of the simulation. The vector has the
+     * layout described in DSFullApp::getSystemState and is replicated on
+     * all processors
+     * @param x state vector
+     */
+    void getFinalState(std::vector<double> &x) const;
+
+    /**
+     * @return dynamic simulation application of this task group. Watch
+     * files and time series of the application contain all coarse and fine
+     * propagations of the window
+     */
+    gridpack::dynamic_simulation::DSFullApp& getApp();
+
+  private:
+
+    /**
+     * Propagate a state across the window of this task group
+     * @param x state at beginning of window
+     * @param step time step
+     * @param y state at end of window
+     */
+    void propagate(const std::vector<double> &x, double step,
+        std::vector<double> &y);
+
+    /**
+     * Receive state from previous window. The state is replicated on all
+     * processors in the task group
+     * @param x state vector
+     */
+    void receive(std::vector<double> &x);
+
+    /**
+     * Send state to next window
+     * @param x state vector
+     */
+    void send(std::vector<double> &x);
+
+    gridpack::parallel::Communicator p_comm;
+    gridpack::parallel::Communicator p_task_comm;
+
+    // communicator connecting the first processor of each task group
+    MPI_Comm p_root_comm;
+
+    boost::shared_ptr<gridpack::powerflow::PFNetwork> p_pf_network;
+    boost::shared_ptr<gridpack::dynamic_simulation::DSFullNetwork> p_ds_network;
+    boost::shared_ptr<gridpack::dynamic_simulation::DSFullApp> p_app;
+
+    // options
+    int p_grp_size;
+    double p_coarse_step;
+    double p_start_time;
+    double p_tolerance;
+    int p_max_iterations;
+
+    // time windows
+    double p_fine_step;
+    int p_num_windows;
+    int p_window;
+    std::vector<double> p_bounds;
+
+    // system state at the start of the first window
+    std::vector<double> p_initial;
+
+    // results
+    int p_iterations;
+    double p_change;
+    std::vector<double> p_final;
+};
+
+} // parareal
+} // gridpack
+#endif
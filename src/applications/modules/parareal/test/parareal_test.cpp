@@ -0,0 +1,111 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   parareal_test.cpp
+ * @date   October 19, 2026
+ *
+ * @brief  Simulate the response of the IEEE 145 bus system to a fault with
+ * the Parareal driver and check that the state at the end of the simulation
+ * agrees with a sequential simulation using the fine time step. Run as
+ * "mpirun -np 4 parareal_test input.xml"
+ */
+// -------------------------------------------------------------
+
+#include "mpi.h"
+#include <ga.h>
+#include <macdecls.h>
+#include "gridpack/include/gridpack.hpp"
+#include "gridpack/applications/modules/powerflow/pf_app_module.hpp"
+#include "gridpack/applications/modules/dynamic_simulation_full_y/dsf_app_module.hpp"
+#include "parareal_driver.hpp"
+
+int
+main(int argc, char **argv)
+{
+  gridpack::Environment env(argc,argv);
+  int ret = 0;
+
+  if (1) {
+    gridpack::parallel::Communicator world;
+
+    // read configuration file
+    gridpack::utility::Configuration *config =
+      gridpack::utility::Configuration::configuration();
+    if (argc >= 2 && argv[1] != NULL) {
+      char inputfile[256];
+      sprintf(inputfile,"%s",argv[1]);
+      config->open(inputfile,world);
+    } else {
+      config->open("input.xml",world);
+    }
+    gridpack::utility::Configuration::CursorPtr cursor;
+    cursor = config->getCursor("Configuration.Parareal");
+    double tol = cursor->get("tolerance",1.0e-4);
+
+    // run Parareal iteration with one time window per task group
+    gridpack::parareal::PararealDriver parareal(world);
+    parareal.configure(cursor);
+    parareal.setup(config);
+    bool converged = parareal.solve();
+    std::vector<double> xpar;
+    parareal.getFinalState(xpar);
+    double tstart, tend;
+    parareal.getWindow(&tstart,&tend);
+    world.max(&tend,1);
+
+    // run reference simulation on all processors
+    boost::shared_ptr<gridpack::powerflow::PFNetwork>
+      pf_network(new gridpack::powerflow::PFNetwork(world));
+    gridpack::powerflow::PFAppModule pf_app;
+    pf_app.readNetwork(pf_network,config);
+    pf_app.initialize();
+    pf_app.solve();
+    pf_app.saveData();
+    boost::shared_ptr<gridpack::dynamic_simulation::DSFullNetwork>
+      ds_network(new gridpack::dynamic_simulation::DSFullNetwork(world));
+    pf_network->clone<gridpack::dynamic_simulation::DSFullBus,
+      gridpack::dynamic_simulation::DSFullBranch>(ds_network);
+    gridpack::dynamic_simulation::DSFullApp ds_app;
+    ds_app.transferPFtoDS(pf_network,ds_network);
+    ds_app.setNetwork(ds_network,config);
+    ds_app.readGenerators();
+    ds_app.initialize();
+    ds_app.setup();
+    ds_app.advance(tend,ds_app.getTimeStep());
+    std::vector<double> xref;
+    ds_app.getSystemState(xref);
+
+    // the converged Parareal solution differs from the sequential solution
+    // by roughly the tolerance accumulated over the windows
+    double maxdiff = 0.0;
+    int i;
+    if (xref.size() == xpar.size()) {
+      for (i=0; i<xref.size(); i++) {
+        double d = fabs(xref[i]-xpar[i]);
+        if (d > maxdiff) maxdiff = d;
+      }
+    }
+    double bound = 10.0*static_cast<double>(parareal.numWindows())*tol;
+    if (!converged || xref.size() != xpar.size() || maxdiff >= bound) {
+      ret = 1;
+    }
+    if (world.rank() == 0) {
+      printf("\nWindows: %d iterations: %d final change: %12.4e\n",
+          parareal.numWindows(),parareal.numIterations(),
+          parareal.getChange());
+      printf("Simulation end time:                    %12.4f\n",tend);
+      printf("Maximum difference from sequential run: %12.4e\n",maxdiff);
+      if (ret == 0) {
+        printf("\nParareal test passed\n");
+      } else {
+        printf("\nParareal test failed\n");
+      }
+    }
+  }
+
+  return ret;
+}
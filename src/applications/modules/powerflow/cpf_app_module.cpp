@@ -0,0 +1,603 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   cpf_app_module.cpp
+ * @date   October 19, 2026
+ *
+ * @brief
+ *
+ *
+ */
+// -------------------------------------------------------------
+
+#include <math.h>
+#include <stdio.h>
+#include "cpf_app_module.hpp"
+#include "gridpack/mapper/full_map.hpp"
+#include "gridpack/mapper/bus_vector_map.hpp"
+#include "gridpack/utilities/exception.hpp"
+#include "gridpack/timer/coarse_timer.hpp"
+
+/**
+ * Basic constructor. The network should already have been read and
+ * initialized, e.g. by PFAppModule::readNetwork and
+ * PFAppModule::initialize, and the loads should be at their base values.
+ * Parameters are read from the block
+ * Configuration.Powerflow.ContinuationPowerFlow
+ * @param network power flow network
+ * @param config configuration containing input deck
+ */
+gridpack::powerflow::CPFAppModule::CPFAppModule(
+    boost::shared_ptr<PFNetwork> network,
+    gridpack::utility::Configuration *config)
+  : p_network(network), p_config(config)
+{
+  p_factory.reset(new PFFactoryModule(p_network));
+  p_initialStep = 0.1;
+  p_minStep = 1.0e-4;
+  p_maxStep = 0.5;
+  p_maxSteps = 200;
+  p_tolerance = 1.0e-6;
+  p_maxIteration = 10;
+  p_lowerBranchFraction = 1.0;
+  p_loadArea = 0;
+  p_monitorBus = -1;
+  p_margin = 0.0;
+  p_baseLoad = 0.0;
+  p_nose = false;
+  p_loadScale = 1.0;
+
+  gridpack::utility::Configuration::CursorPtr cursor;
+  cursor = p_config->getCursor("Configuration.Powerflow");
+  if (cursor) {
+    p_tolerance = cursor->get("tolerance",p_tolerance);
+  }
+  cursor = p_config->getCursor("Configuration.Powerflow.ContinuationPowerFlow");
+  if (cursor) {
+    p_initialStep = cursor->get("initialStep",p_initialStep);
+    p_minStep = cursor->get("minimumStep",p_minStep);
+    p_maxStep = cursor->get("maximumStep",p_maxStep);
+    p_maxSteps = cursor->get("maximumSteps",p_maxSteps);
+    p_tolerance = cursor->get("tolerance",p_tolerance);
+    p_maxIteration = cursor->get("maxIteration",p_maxIteration);
+    p_lowerBranchFraction = cursor->get("lowerBranchFraction",
+        p_lowerBranchFraction);
+    p_loadArea = cursor->get("loadArea",p_loadArea);
+    p_monitorBus = cursor->get("monitorBus",p_monitorBus);
+  }
+}
+
+/**
+ * Basic destructor
+ */
+gridpack::powerflow::CPFAppModule::~CPFAppModule()
+{
+}
+
+/**
+ * Only increase loads on buses in this area. If area is less than 1,
+ * all loads are increased
+ * @param area index of area
+ */
+void gridpack::powerflow::CPFAppModule::setLoadArea(int area)
+{
+  p_loadArea = area;
+}
+
+/**
+ * Record the voltage magnitude of this bus at each point of the PV curve
+ * @param bus original index of bus
+ */
+void gridpack::powerflow::CPFAppModule::setMonitoredBus(int bus)
+{
+  p_monitorBus = bus;
+}
+
+/**
+ * Scale loads that are part of the load increase
+ * @param scale scale factor for real and reactive power
+ */
+void gridpack::powerflow::CPFAppModule::scaleLoads(double scale)
+{
+  int nbus = p_network->numBuses();
+  int i, j;
+  for (i=0; i<nbus; i++) {
+    gridpack::powerflow::PFBus *bus = p_network->getBus(i).get();
+    if (p_loadArea > 0 && bus->getArea() != p_loadArea) continue;
+    std::vector<std::string> tags = bus->getLoads();
+    for (j=0; j<tags.size(); j++) {
+      bus->scaleLoadPower(tags[j],scale);
+    }
+  }
+}
+
+/**
+ * Set loads that are part of the load increase to a multiple of their
+ * base values
+ * @param scale ratio of loads to base loads
+ */
+void gridpack::powerflow::CPFAppModule::setLoadScale(double scale)
+{
+  if (scale == p_loadScale) return;
+  scaleLoads(scale/p_loadScale);
+  p_loadScale = scale;
+}
+
+/**
+ * Return the network to the state it was in before solve was called.
+ * Loads are set back to their base values and the bus voltages are
+ * restored
+ */
+void gridpack::powerflow::CPFAppModule::restore()
+{
+  setLoadScale(1.0);
+  if (p_shift) {
+    p_factory->setMode(RHS);
+    gridpack::mapper::BusVectorMap<PFNetwork> vMap(p_network);
+    p_shift->scale(-1.0);
+    vMap.mapToBus(p_shift);
+    p_network->updateBuses();
+    p_shift->zero();
+  }
+  p_factory->setSBus();
+}
+
+/**
+ * @return total real power of loads that are part of the load increase
+ */
+double gridpack::powerflow::CPFAppModule::totalLoad()
+{
+  double ret = 0.0;
+  int nbus = p_network->numBuses();
+  int i, j;
+  for (i=0; i<nbus; i++) {
+    if (!p_network->getActiveBus(i)) continue;
+    gridpack::powerflow::PFBus *bus = p_network->getBus(i).get();
+    if (p_loadArea > 0 && bus->getArea() != p_loadArea) continue;
+    std::vector<std::string> tags;
+    std::vector<double> pl, ql;
+    std::vector<int> status;
+    bus->getLoadPower(tags,pl,ql,status);
+    for (j=0; j<pl.size(); j++) {
+      if (status[j] == 1) ret += pl[j];
+    }
+  }
+  p_network->communicator().sum(&ret,1);
+  return ret;
+}
+
+/**
+ * @return minimum voltage magnitude over all buses
+ */
+double gridpack::powerflow::CPFAppModule::minimumVoltage()
+{
+  double ret = 1.0e30;
+  int nbus = p_network->numBuses();
+  int i;
+  for (i=0; i<nbus; i++) {
+    if (!p_network->getActiveBus(i)) continue;
+    gridpack::powerflow::PFBus *bus = p_network->getBus(i).get();
+    if (bus->isIsolated()) continue;
+    double v = bus->getVoltage();
+    if (v < ret) ret = v;
+  }
+  p_network->communicator().min(&ret,1);
+  return ret;
+}
+
+/**
+ * @return voltage magnitude of monitored bus
+ */
+double gridpack::powerflow::CPFAppModule::monitoredVoltage()
+{
+  double ret = 0.0;
+  int nbus = p_network->numBuses();
+  int i;
+  for (i=0; i<nbus; i++) {
+    if (!p_network->getActiveBus(i)) continue;
+    gridpack::powerflow::PFBus *bus = p_network->getBus(i).get();
+    if (bus->getOriginalIndex() == p_monitorBus) {
+      ret = bus->getVoltage();
+    }
+  }
+  p_network->communicator().sum(&ret,1);
+  return ret;
+}
+
+/**
+ * Dot product of two distributed vectors
+ * @param x first vector
+ * @param y second vector
+ * @return x.y
+ */
+double gridpack::powerflow::CPFAppModule::dot(gridpack::math::RealVector &x,
+    gridpack::math::RealVector &y)
+{
+  double ret = 0.0;
+  int n = x.localSize();
+  double *xl = x.getLocalElements();
+  double *yl = y.getLocalElements();
+  int i;
+  for (i=0; i<n; i++) ret += xl[i]*yl[i];
+  x.releaseLocalElements(xl);
+  y.releaseLocalElements(yl);
+  p_network->communicator().sum(&ret,1);
+  return ret;
+}
+
+/**
+ * Find the element of a distributed vector with the largest absolute
+ * value
+ * @param x vector
+ * @param value largest absolute value
+ * @return global index of element
+ */
+int gridpack::powerflow::CPFAppModule::maxElement(
+    gridpack::math::RealVector &x, double *value)
+{
+  int lo, hi;
+  x.localIndexRange(lo,hi);
+  double *xl = x.getLocalElements();
+  double lmax = -1.0;
+  int idx = x.size();
+  int i;
+  for (i=0; i<hi-lo; i++) {
+    if (fabs(xl[i]) > lmax) {
+      lmax = fabs(xl[i]);
+      idx = lo+i;
+    }
+  }
+  x.releaseLocalElements(xl);
+  double gmax = lmax;
+  p_network->communicator().max(&gmax,1);
+  // Break ties by choosing the lowest index
+  if (lmax != gmax) idx = x.size();
+  p_network->communicator().min(&idx,1);
+  *value = gmax;
+  return idx;
+}
+
+/**
+ * Get the value of an element of a distributed vector on all
+ * processors
+ * @param x vector
+ * @param idx global index of element
+ * @return value of element
+ */
+double gridpack::powerflow::CPFAppModule::globalElement(
+    gridpack::math::RealVector &x, int idx)
+{
+  int lo, hi;
+  x.localIndexRange(lo,hi);
+  double ret = 0.0;
+  if (idx >= lo && idx < hi) x.getElement(idx,ret);
+  p_network->communicator().sum(&ret,1);
+  return ret;
+}
+
+/**
+ * Store current point on the PV curve
+ * @param lambda load increase
+ */
+void gridpack::powerflow::CPFAppModule::addPoint(double lambda)
+{
+  p_lambda.push_back(lambda);
+  p_vmin.push_back(minimumVoltage());
+  if (p_monitorBus >= 0) p_vmon.push_back(monitoredVoltage());
+  if (lambda > p_margin) p_margin = lambda;
+}
+
+/**
+ * Trace the PV curve. On return, the network holds the last point on
+ * the curve, with loads scaled by (1+lambda) at that point
+ * @return true if the nose of the curve was located
+ */
+bool gridpack::powerflow::CPFAppModule::solve()
+{
+  gridpack::utility::CoarseTimer *timer =
+    gridpack::utility::CoarseTimer::instance();
+  int t_total = timer->createCategory("Continuation Powerflow: Total");
+  int t_lsolv = timer->createCategory("Continuation Powerflow: Linear Solve");
+  timer->start(t_total);
+  int me = p_network->communicator().rank();
+  p_lambda.clear();
+  p_vmin.clear();
+  p_vmon.clear();
+  p_margin = 0.0;
+  p_nose = false;
+  p_factory->setYBus();
+  restore();
+  p_baseLoad = totalLoad();
+
+  // The mismatch F(x,lambda) = F(x,0) + lambda*G is affine in lambda, so
+  // G = dF/dlambda is found from the mismatch with the loads doubled
+  p_factory->setMode(RHS);
+  gridpack::mapper::BusVectorMap<PFNetwork> vMap(p_network);
+  boost::shared_ptr<gridpack::math::RealVector> F = vMap.mapToRealVector();
+  boost::shared_ptr<gridpack::math::RealVector> G(F->clone());
+  scaleLoads(2.0);
+  p_factory->setSBus();
+  vMap.mapToRealVector(G);
+  scaleLoads(0.5);
+  p_factory->setSBus();
+  G->add(*F,-1.0);
+
+  boost::shared_ptr<gridpack::math::RealVector> X(F->clone());
+  boost::shared_ptr<gridpack::math::RealVector> A(F->clone());
+  boost::shared_ptr<gridpack::math::RealVector> B(F->clone());
+  boost::shared_ptr<gridpack::math::RealVector> Bprev(F->clone());
+  boost::shared_ptr<gridpack::math::RealVector> D(F->clone());
+  if (!p_shift) p_shift.reset(F->clone());
+  p_shift->zero();
+
+  p_factory->setMode(Jacobian);
+  gridpack::mapper::FullMatrixMap<PFNetwork> jMap(p_network);
+  boost::shared_ptr<gridpack::math::RealMatrix> J = jMap.mapToRealMatrix();
+  gridpack::utility::Configuration::CursorPtr cursor;
+  cursor = p_config->getCursor("Configuration.Powerflow");
+  gridpack::math::RealLinearSolver solver(*J);
+  solver.configure(cursor);
+
+  double lambda = 0.0;
+  double lambda_save = 0.0;
+  double step = p_initialStep;
+  double sign = 1.0;
+  bool have_prev = false;
+  bool first = true;
+  int nsteps = 0;
+  // Index of the voltage used as continuation parameter. If kidx is less
+  // than zero, lambda is the continuation parameter
+  int kidx = -1;
+  // D accumulates the updates applied to the network since the last point
+  // on the curve so that they can be undone if the corrector fails
+  D->zero();
+
+  while (true) {
+    // Corrector. The augmented Jacobian
+    //   [ J  G ]
+    //   [ ek 0 ]
+    // is solved by block elimination so that the Jacobian created by the
+    // power flow components can be used directly
+    bool converged = false;
+    int iter = 0;
+    double tol_org = 0.0;
+    try {
+      while (true) {
+        p_factory->setMode(RHS);
+        vMap.mapToRealVector(F);
+        F->add(*G,lambda);
+        double tol = F->normInfinity();
+        if (iter == 0) tol_org = tol;
+        if (tol < p_tolerance) {
+          converged = true;
+          break;
+        }
+        if (iter >= p_maxIteration || !(tol == tol) ||
+            tol > 100.0*tol_org + 1.0) break;
+        p_factory->setMode(Jacobian);
+        jMap.mapToRealMatrix(J);
+        timer->start(t_lsolv);
+        if (kidx < 0) {
+          X->zero();
+          solver.solve(*F,*X);
+        } else {
+          A->zero();
+          B->zero();
+          solver.solve(*F,*A);
+          solver.solve(*G,*B);
+          double dlambda = globalElement(*A,kidx)/globalElement(*B,kidx);
+          X->equate(*A);
+          X->add(*B,-dlambda);
+          lambda -= dlambda;
+        }
+        timer->stop(t_lsolv);
+        p_factory->setMode(RHS);
+        vMap.mapToBus(X);
+        p_network->updateBuses();
+        D->add(*X);
+        p_shift->add(*X);
+        iter++;
+      }
+    } catch (const gridpack::Exception &e) {
+      timer->stop(t_lsolv);
+      converged = false;
+    }
+
+    if (!converged) {
+      // Return to the last point on the curve and try a shorter step
+      D->scale(-1.0);
+      p_factory->setMode(RHS);
+      vMap.mapToBus(D);
+      p_network->updateBuses();
+      p_shift->add(*D);
+      lambda = lambda_save;
+      if (first) {
+        if (me == 0) {
+          printf("Continuation power flow: base case did not converge\n");
+        }
+        break;
+      }
+      step *= 0.5;
+      if (step < p_minStep) {
+        if (me == 0) {
+          printf("Continuation power flow: step reduced below minimum at"
+              " lambda: %f\n",lambda);
+        }
+        break;
+      }
+    } else {
+      first = false;
+      addPoint(lambda);
+      lambda_save = lambda;
+      nsteps++;
+      if (iter <= 3) {
+        step *= 1.5;
+        if (step > p_maxStep) step = p_maxStep;
+      }
+      if (p_nose && lambda < p_lowerBranchFraction*p_margin) break;
+      if (lambda < 0.0 || nsteps > p_maxSteps) break;
+    }
+    D->zero();
+
+    // Predictor. The tangent at the current point is proportional to
+    // (-B,1) where J*B = G
+    p_factory->setMode(Jacobian);
+    jMap.mapToRealMatrix(J);
+    B->zero();
+    try {
+      timer->start(t_lsolv);
+      solver.solve(*G,*B);
+      timer->stop(t_lsolv);
+    } catch (const gridpack::Exception &e) {
+      timer->stop(t_lsolv);
+      if (me == 0) {
+        printf("Continuation power flow: tangent could not be computed at"
+            " lambda: %f\n",lambda);
+      }
+      break;
+    }
+    if (have_prev) {
+      // Keep the direction of the tangent consistent with the previous
+      // step. A change in sign means that the nose has been passed
+      if (dot(*B,*Bprev)+1.0 < 0.0) {
+        sign = -sign;
+        if (sign < 0.0) p_nose = true;
+      }
+    }
+    if (p_nose && p_lowerBranchFraction >= 1.0) break;
+    Bprev->equate(*B);
+    have_prev = true;
+
+    // Use lambda as the continuation parameter unless a voltage is changing
+    // faster
+    double bmax;
+    int imax = maxElement(*B,&bmax);
+    if (bmax > 1.0) {
+      kidx = imax;
+    } else {
+      kidx = -1;
+    }
+
+    // Network values are decremented by the vector passed to mapToBus, so
+    // the step along the tangent is applied by passing sign*step*B/|t|
+    double bnorm = B->norm2();
+    double tnorm = sqrt(bnorm*bnorm+1.0);
+    X->equate(*B);
+    X->scale(sign*step/tnorm);
+    p_factory->setMode(RHS);
+    vMap.mapToBus(X);
+    p_network->updateBuses();
+    D->add(*X);
+    p_shift->add(*X);
+    lambda += sign*step/tnorm;
+  }
+  if (p_nose) refineMargin();
+
+  // Leave the network at the last point on the curve. Loads are set
+  // relative to their base values so that the next call to solve can
+  // restore them
+  setLoadScale(1.0+lambda);
+  p_factory->setSBus();
+  timer->stop(t_total);
+  return p_nose;
+}
+
+/**
+ * Estimate the value of lambda at the nose by fitting a parabola
+ * through the largest value of lambda found on the curve and its two
+ * neighbors
+ */
+void gridpack::powerflow::CPFAppModule::refineMargin()
+{
+  int n = p_lambda.size();
+  int imax = 0;
+  int i;
+  for (i=1; i<n; i++) {
+    if (p_lambda[i] > p_lambda[imax]) imax = i;
+  }
+  if (imax == 0 || imax == n-1) return;
+  const std::vector<double> &v = (p_monitorBus >= 0) ? p_vmon : p_vmin;
+  double x0 = v[imax-1];
+  double x1 = v[imax];
+  double x2 = v[imax+1];
+  double y0 = p_lambda[imax-1];
+  double y1 = p_lambda[imax];
+  double y2 = p_lambda[imax+1];
+  double denom = (x0-x1)*(x0-x2)*(x1-x2);
+  if (denom == 0.0) return;
+  double a = (x2*(y1-y0)+x1*(y0-y2)+x0*(y2-y1))/denom;
+  double b = (x2*x2*(y0-y1)+x1*x1*(y2-y0)+x0*x0*(y1-y2))/denom;
+  double c = (x1*x2*(x1-x2)*y0+x2*x0*(x2-x0)*y1+x0*x1*(x0-x1)*y2)/denom;
+  if (a >= 0.0) return;
+  double ymax = c-b*b/(4.0*a);
+  // Only accept the estimate if it is consistent with the points on the
+  // curve
+  double ylo = (y0 < y2) ? y0 : y2;
+  if (ymax >= y1 && ymax <= y1+(y1-ylo)) p_margin = ymax;
+}
+
+/**
+ * @return loading margin, as a fraction of the base value of the loads
+ * that are increased
+ */
+double gridpack::powerflow::CPFAppModule::getMargin()
+{
+  return p_margin;
+}
+
+/**
+ * @return loading margin in MW
+ */
+double gridpack::powerflow::CPFAppModule::getMarginMW()
+{
+  return p_margin*p_baseLoad;
+}
+
+/**
+ * Get the PV curve
+ * @param lambda load increase at each point on curve
+ * @param vmin minimum bus voltage magnitude at each point on curve
+ * @param vmon voltage magnitude of monitored bus at each point on curve.
+ *        This is empty if no bus is monitored
+ */
+void gridpack::powerflow::CPFAppModule::getPVCurve(std::vector<double> &lambda,
+    std::vector<double> &vmin, std::vector<double> &vmon)
+{
+  lambda = p_lambda;
+  vmin = p_vmin;
+  vmon = p_vmon;
+}
+
+/**
+ * Write PV curve and loading margin to standard out
+ */
+void gridpack::powerflow::CPFAppModule::write()
+{
+  if (p_network->communicator().rank() != 0) return;
+  int i;
+  printf("\nContinuation power flow PV curve\n\n");
+  if (p_monitorBus >= 0) {
+    printf("     Point        Lambda          Vmin     V(%8d)\n",p_monitorBus);
+  } else {
+    printf("     Point        Lambda          Vmin\n");
+  }
+  for (i=0; i<p_lambda.size(); i++) {
+    if (p_monitorBus >= 0) {
+      printf("  %8d  %12.6f  %12.6f  %12.6f\n",i,p_lambda[i],p_vmin[i],
+          p_vmon[i]);
+    } else {
+      printf("  %8d  %12.6f  %12.6f\n",i,p_lambda[i],p_vmin[i]);
+    }
+  }
+  if (p_nose) {
+    printf("\nLoading margin: %12.6f (%12.4f MW)\n",p_margin,
+        p_margin*p_baseLoad);
+  } else {
+    printf("\nNose of PV curve not reached. Largest load increase: %12.6f"
+        " (%12.4f MW)\n",p_margin,p_margin*p_baseLoad);
+  }
+}
@@ -0,0 +1,211 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   cpf_app_module.hpp
+ * @date   October 19, 2026
+ *
+ * @brief  Continuation power flow. Loads are increased along the direction
+ * P = P0*(1+lambda), Q = Q0*(1+lambda) and the solution is traced with a
+ * predictor-corrector method from the base case up to and, optionally, past
+ * the nose of the PV curve. The maximum value of lambda is the loading
+ * margin.
+ *
+ *
+ */
+// -------------------------------------------------------------
+
+#ifndef _cpf_app_module_h_
+#define _cpf_app_module_h_
+
+#include <vector>
+#include "boost/smart_ptr/shared_ptr.hpp"
+#include "gridpack/configuration/configuration.hpp"
+#include "gridpack/math/math.hpp"
+#include "pf_factory_module.hpp"
+
+namespace gridpack {
+namespace powerflow {
+
+class CPFAppModule
+{
+  public:
+    /**
+     * Basic constructor. The network should already have been read and
+     * initialized, e.g. by PFAppModule::readNetwork and
+     * PFAppModule::initialize, and the loads should be at their base values.
+     * Parameters are read from the block
+     * Configuration.Powerflow.ContinuationPowerFlow
+     * @param network power flow network
+     * @param config configuration containing input deck
+     */
+    CPFAppModule(boost::shared_ptr<PFNetwork> network,
+        gridpack::utility::Configuration *config);
+
+    /**
+     * Basic destructor
+     */
+    ~CPFAppModule();
+
+    /**
+     * Only increase loads on buses in this area. If area is less than 1,
+     * all loads are increased
+     * @param area index of area
+     */
+    void setLoadArea(int area);
+
+    /**
+     * Record the voltage magnitude of this bus at each point of the PV curve
+     * @param bus original index of bus
+     */
+    void setMonitoredBus(int bus);
+
+    /**
+     * Trace the PV curve. On return, the network holds the last point on
+     * the curve, with loads scaled by (1+lambda) at that point. The
+     * network is returned to its original state before the curve is
+     * traced, so repeated calls start from the same base case
+     * @return true if the nose of the curve was located
+     */
+    bool solve();
+
+    /**
+     * Return the network to the state it was in before solve was called.
+     * Loads are set back to their base values and the bus voltages are
+     * restored
+     */
+    void restore();
+
+    /**
+     * @return loading margin, as a fraction of the base value of the loads
+     * that are increased
+     */
+    double getMargin();
+
+    /**
+     * @return loading margin in MW
+     */
+    double getMarginMW();
+
+    /**
+     * Get the PV curve
+     * @param lambda load increase at each point on curve
+     * @param vmin minimum bus voltage magnitude at each point on curve
+     * @param vmon voltage magnitude of monitored bus at each point on curve.
+     *        This is empty if no bus is monitored
+     */
+    void getPVCurve(std::vector<double> &lambda, std::vector<double> &vmin,
+        std::vector<double> &vmon);
+
+    /**
+     * Write PV curve and loading margin to standard out
+     */
+    void write();
+
+  private:
+
+    /**
+     * Scale loads that are part of the load increase
+     * @param scale scale factor for real and reactive power
+     */
+    void scaleLoads(double scale);
+
+    /**
+     * Set loads that are part of the load increase to a multiple of their
+     * base values
+     * @param scale ratio of loads to base loads
+     */
+    void setLoadScale(double scale);
+
+    /**
+     * @return total real power of loads that are part of the load increase
+     */
+    double totalLoad();
+
+    /**
+     * @return minimum voltage magnitude over all buses
+     */
+    double minimumVoltage();
+
+    /**
+     * @return voltage magnitude of monitored bus
+     */
+    double monitoredVoltage();
+
+    /**
+     * Dot product of two distributed vectors
+     * @param x first vector
+     * @param y second vector
+     * @return x.y
+     */
+    double dot(gridpack::math::RealVector &x, gridpack::math::RealVector &y);
+
+    /**
+     * Find the element of a distributed vector with the largest absolute
+     * value
+     * @param x vector
+     * @param value largest absolute value
+     * @return global index of element
+     */
+    int maxElement(gridpack::math::RealVector &x, double *value);
+
+    /**
+     * Get the value of an element of a distributed vector on all
+     * processors
+     * @param x vector
+     * @param idx global index of element
+     * @return value of element
+     */
+    double globalElement(gridpack::math::RealVector &x, int idx);
+
+    /**
+     * Store current point on the PV curve
+     * @param lambda load increase
+     */
+    void addPoint(double lambda);
+
+    /**
+     * Estimate the value of lambda at the nose by fitting a parabola
+     * through the largest value of lambda found on the curve and its two
+     * neighbors
+     */
+    void refineMargin();
+
+    boost::shared_ptr<PFNetwork> p_network;
+
+    boost::shared_ptr<PFFactoryModule> p_factory;
+
+    gridpack::utility::Configuration *p_config;
+
+    // Parameters controlling continuation
+    double p_initialStep;
+    double p_minStep;
+    double p_maxStep;
+    int p_maxSteps;
+    double p_tolerance;
+    int p_maxIteration;
+    double p_lowerBranchFraction;
+    int p_loadArea;
+    int p_monitorBus;
+
+    // Results
+    std::vector<double> p_lambda;
+    std::vector<double> p_vmin;
+    std::vector<double> p_vmon;
+    double p_margin;
+    double p_baseLoad;
+    bool p_nose;
+
+    // Current ratio of loads to base loads
+    double p_loadScale;
+
+    // Sum of all updates applied to the bus voltages by solve
+    boost::shared_ptr<gridpack::math::RealVector> p_shift;
+};
+
+} // powerflow
+} // gridpack
+#endif
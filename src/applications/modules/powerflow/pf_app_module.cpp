@@ -17,6 +17,7 @@
 
 #include "pf_app_module.hpp"
 #include "pf_factory_module.hpp"
+#include "pf_kernel.hpp"
 #include "gridpack/mapper/full_map.hpp"
 #include "gridpack/mapper/bus_vector_map.hpp"
 #include "gridpack/parser/PTI23_parser.hpp"
@@ -77,6 +78,80 @@ void gridpack::powerflow::PFAppModule::readNetwork(
   // read configuration file
   config->enableLogging(&std::cout);
 
+  if (!parseNetwork(network,config,idx)) {
+    timer->stop(t_total);
+    return;
+  }
+  finishNetwork(network,config);
+  timer->stop(t_total);
+}
+
+/**
+ * Parse the powerflow network once on all processors in the communicator of
+ * a shared base case and store it in the base case. Task groups can then
+ * create their networks from the base case with readNetwork without reading
+ * the network file again. This is a collective operation on the
+ * communicator of the base case
+ * @param base shared base case
+ * @param config point to open configuration file
+ * @param idx index of configuration to use if set to a non-negative value
+ */
+void gridpack::powerflow::PFAppModule::readSharedCase(
+    gridpack::parser::SharedCase<PFNetwork> &base,
+    gridpack::utility::Configuration *config, int idx)
+{
+  config->enableLogging(&std::cout);
+  boost::shared_ptr<PFNetwork> network(new PFNetwork(base.communicator()));
+  if (!parseNetwork(network,config,idx)) return;
+  base.store(network);
+}
+
+/**
+ * Create and partition the powerflow network from a shared base case
+ * that has been filled by readSharedCase. Solver parameters are read from
+ * the Powerflow block in the configuration file
+ * @param network pointer to a PFNetwork object. This should not have any
+ * buses or branches defined on it.
+ * @param base shared base case
+ * @param config point to open configuration file
+ */
+void gridpack::powerflow::PFAppModule::readNetwork(
+    boost::shared_ptr<PFNetwork> &network,
+    gridpack::parser::SharedCase<PFNetwork> &base,
+    gridpack::utility::Configuration *config)
+{
+  p_network = network;
+  p_comm = network->communicator();
+  p_config = config;
+
+  gridpack::utility::CoarseTimer *timer =
+    gridpack::utility::CoarseTimer::instance();
+  int t_total = timer->createCategory("Powerflow: Total Application");
+  timer->start(t_total);
+  if (!base.instantiate(network)) {
+    timer->stop(t_total);
+    return;
+  }
+  finishNetwork(network,config);
+  timer->stop(t_total);
+}
+
+/**
+ * Find the network file in the Powerflow block of the configuration file
+ * and parse it. Buses and branches are created on the first processor in
+ * the network communicator and the network is not partitioned
+ * @param network pointer to a PFNetwork object. This should not have any
+ * buses or branches defined on it.
+ * @param config point to open configuration file
+ * @param idx index of configuration to use if set to a non-negative value
+ * @return false if no network file was found
+ */
+bool gridpack::powerflow::PFAppModule::parseNetwork(
+    boost::shared_ptr<PFNetwork> &network,
+    gridpack::utility::Configuration *config, int idx)
+{
+  gridpack::utility::CoarseTimer *timer =
+    gridpack::utility::CoarseTimer::instance();
   gridpack::utility::Configuration::CursorPtr cursor;
   cursor = config->getCursor("Configuration.Powerflow");
   if (cursor == NULL) {
@@ -98,7 +173,7 @@ void gridpack::powerflow::PFAppModule::readNetwork(
         filetype = GOSS;
       } else {
         printf("No network configuration file specified\n");
-        return;
+        return false;
       }
     }
   } else if (idx >= 0) {
@@ -119,22 +194,17 @@ void gridpack::powerflow::PFAppModule::readNetwork(
           filetype = MAT_POWER;
         } else {
           printf("Unknown network configuration file specified\n");
-          return;
+          return false;
         }
       }
     } else {
       printf("Unknown file index\n");
-      return;
+      return false;
     }
   } else {
     printf("No network configuration file specified\n");
-    return;
+    return false;
   }
-  // Convergence and iteration parameters
-  p_tolerance = cursor->get("tolerance",1.0e-6);
-  p_qlim = cursor->get("qlim",0);
-  p_max_iteration = cursor->get("maxIteration",50);
-  ComplexType tol;
   // Phase shift sign
   double phaseShiftSign = cursor->get("phaseShiftSign",1.0);
 
@@ -158,11 +228,10 @@ void gridpack::powerflow::PFAppModule::readNetwork(
         char ebuf[512];
         sprintf(ebuf,"p[%d] unable to open network file: %s with error: %s\n",
             filename.c_str(),w.c_str());
-        if (p_comm.rank() == 0) {
+        if (network->communicator().rank() == 0) {
           printf("%s",ebuf);
         }
       }
-      timer->stop(t_total);
     }
 #endif
     if (phaseShiftSign == -1.0) {
@@ -230,6 +299,28 @@ void gridpack::powerflow::PFAppModule::readNetwork(
     parser.parse(filename.c_str());
   }
   timer->stop(t_pti);
+  return true;
+}
+
+/**
+ * Read solver parameters, set up serial IO and partition a network that
+ * has been parsed or created from a shared base case
+ * @param network pointer to a PFNetwork object
+ * @param config point to open configuration file
+ */
+void gridpack::powerflow::PFAppModule::finishNetwork(
+    boost::shared_ptr<PFNetwork> &network,
+    gridpack::utility::Configuration *config)
+{
+  gridpack::utility::CoarseTimer *timer =
+    gridpack::utility::CoarseTimer::instance();
+  gridpack::utility::Configuration::CursorPtr cursor;
+  cursor = config->getCursor("Configuration.Powerflow");
+  // Convergence and iteration parameters
+  p_tolerance = cursor->get("tolerance",1.0e-6);
+  p_qlim = cursor->get("qlim",0);
+  p_max_iteration = cursor->get("maxIteration",50);
+  ComplexType tol;
 
   // Create serial IO object to export data from buses
   p_busIO.reset(new gridpack::serial_io::SerialBusIO<PFNetwork>(512,network));
@@ -250,7 +341,46 @@ void gridpack::powerflow::PFAppModule::readNetwork(
   timer->start(t_part);
   network->partition();
   timer->stop(t_part);
-  timer->stop(t_total);
+}
+
+/**
+ * Assume that PFNetwork already exists and just cache an internal pointer
+ * to it. This routine does not call the partition function. Also read in
+ * solver parameters from configuration file
+ * @param network pointer to a complete PFNetwork object.
+ * @param config pointer to open configuration file
+ */
+void gridpack::powerflow::PFAppModule::setNetwork(
+    boost::shared_ptr<PFNetwork> &network,
+    gridpack::utility::Configuration *config)
+{
+  p_network = network;
+  p_comm = network->communicator();
+  p_config = config;
+
+  gridpack::utility::Configuration::CursorPtr cursor;
+  cursor = config->getCursor("Configuration.Powerflow");
+  if (cursor == NULL) {
+    printf("No Powerflow block detected in input deck\n");
+  }
+  // Convergence and iteration parameters
+  p_tolerance = cursor->get("tolerance",1.0e-6);
+  p_qlim = cursor->get("qlim",0);
+  p_max_iteration = cursor->get("maxIteration",50);
+
+  // Create serial IO object to export data from buses
+  p_busIO.reset(new gridpack::serial_io::SerialBusIO<PFNetwork>(512,network));
+
+  // Create serial IO object to export data from branches
+  p_branchIO.reset(new gridpack::serial_io::SerialBranchIO<PFNetwork>(512,network));
+  char ioBuf[128];
+
+  if (!p_no_print) {
+    sprintf(ioBuf,"\nMaximum number of iterations: %d\n",p_max_iteration);
+    p_busIO->header(ioBuf);
+    sprintf(ioBuf,"\nConvergence tolerance: %f\n",p_tolerance);
+    p_busIO->header(ioBuf);
+  }
 }
 
 /**
@@ -313,6 +443,7 @@ void gridpack::powerflow::PFAppModule::reload()
  */
 bool gridpack::powerflow::PFAppModule::solve()
 {
+  if (p_scenario) return scenarioSolve();
   bool ret = true;
   gridpack::utility::CoarseTimer *timer =
     gridpack::utility::CoarseTimer::instance();
@@ -621,6 +752,232 @@ bool gridpack::powerflow::PFAppModule::nl_solve()
   return ret;
 }
 
+/**
+ * Data structures that are reused by solve between calls to beginScenarios
+ * and endScenarios
+ */
+struct gridpack::powerflow::PFAppModule::ScenarioContext
+{
+  boost::shared_ptr<gridpack::mapper::BusVectorMap<PFNetwork> > vMap;
+  boost::shared_ptr<gridpack::mapper::FullMatrixMap<PFNetwork> > jMap;
+  boost::shared_ptr<gridpack::math::RealVector> PQ;
+  boost::shared_ptr<gridpack::math::RealVector> X;
+  boost::shared_ptr<gridpack::math::RealMatrix> J;
+  boost::shared_ptr<gridpack::math::RealLinearSolver> solver;
+  boost::shared_ptr<PFKernel> kernel;
+};
+
+/**
+ * Create mappers, Jacobian, vectors and linear solver for the current
+ * network state
+ */
+void gridpack::powerflow::PFAppModule::setupScenarioContext()
+{
+  gridpack::utility::CoarseTimer *timer =
+    gridpack::utility::CoarseTimer::instance();
+  int t_cmap = timer->createCategory("Powerflow: Create Mappers");
+  int t_csolv = timer->createCategory("Powerflow: Create Linear Solver");
+  p_scenario.reset(new ScenarioContext);
+  timer->start(t_cmap);
+  p_factory->setYBus();
+  p_factory->setSBus();
+  p_factory->setMode(RHS);
+  p_scenario->vMap.reset(new gridpack::mapper::BusVectorMap<PFNetwork>(p_network));
+  p_scenario->PQ = p_scenario->vMap->mapToRealVector();
+  p_scenario->X.reset(p_scenario->PQ->clone());
+  p_factory->setMode(Jacobian);
+  p_scenario->jMap.reset(new gridpack::mapper::FullMatrixMap<PFNetwork>(p_network));
+  p_scenario->J = p_scenario->jMap->mapToRealMatrix();
+  timer->stop(t_cmap);
+
+  timer->start(t_csolv);
+  gridpack::utility::Configuration::CursorPtr cursor;
+  cursor = p_config->getCursor("Configuration.Powerflow");
+  p_scenario->solver.reset(new gridpack::math::RealLinearSolver(*(p_scenario->J)));
+  p_scenario->solver->configure(cursor);
+  timer->stop(t_csolv);
+
+  // Evaluate mismatches and Jacobian directly from the Y-bus instead of
+  // calling the network components
+  if (cursor->get("FusedKernel", false)) {
+    p_scenario->kernel.reset(new PFKernel(p_network));
+    p_scenario->kernel->setup(*(p_scenario->jMap));
+  }
+}
+
+/**
+ * Set up the mappers, Jacobian, vectors and linear solver used by the
+ * Newton-Raphson solver so that they can be reused by subsequent calls to
+ * solve
+ */
+void gridpack::powerflow::PFAppModule::beginScenarios()
+{
+  setupScenarioContext();
+}
+
+/**
+ * Release the data structures created by beginScenarios
+ */
+void gridpack::powerflow::PFAppModule::endScenarios()
+{
+  p_scenario.reset();
+}
+
+/**
+ * Execute the Newton-Raphson iterations using the data structures created by
+ * beginScenarios. Only the values of the Jacobian change between iterations
+ * and scenarios, so the linear solver can reuse the symbolic factorization
+ * @return false if an error was encountered in the solution
+ */
+bool gridpack::powerflow::PFAppModule::scenarioSolve()
+{
+  bool ret = true;
+  gridpack::utility::CoarseTimer *timer =
+    gridpack::utility::CoarseTimer::instance();
+  int t_total = timer->createCategory("Powerflow: Total Application");
+  int t_fact = timer->createCategory("Powerflow: Factory Operations");
+  int t_vmap = timer->createCategory("Powerflow: Map to Vector");
+  int t_mmap = timer->createCategory("Powerflow: Map to Matrix");
+  int t_lsolv = timer->createCategory("Powerflow: Solve Linear Equation");
+  int t_bmap = timer->createCategory("Powerflow: Map to Bus");
+  int t_updt = timer->createCategory("Powerflow: Bus Update");
+  timer->start(t_total);
+  p_factory->clearViolations();
+  char ioBuf[128];
+  bool repeat = true;
+  while (repeat) {
+    ret = true;
+    timer->start(t_fact);
+    p_factory->setYBus();
+    p_factory->setSBus();
+    if (p_scenario->kernel) p_scenario->kernel->loadYBus();
+    timer->stop(t_fact);
+
+    timer->start(t_vmap);
+    p_factory->setMode(RHS);
+    if (p_scenario->kernel) {
+      p_scenario->kernel->evaluate(*(p_scenario->PQ), *(p_scenario->J));
+    } else {
+      p_scenario->vMap->mapToRealVector(p_scenario->PQ);
+    }
+    timer->stop(t_vmap);
+    double tol_org = p_scenario->PQ->normInfinity();
+    double tol = tol_org;
+    int iter = 0;
+    while (iter == 0 || (tol > p_tolerance && iter < p_max_iteration)) {
+      if (iter > 0) {
+        // Push corrections back onto buses and evaluate new mismatches
+        timer->start(t_bmap);
+        p_factory->setMode(RHS);
+        p_scenario->vMap->mapToBus(p_scenario->X);
+        timer->stop(t_bmap);
+        timer->start(t_updt);
+        p_network->updateBuses();
+        timer->stop(t_updt);
+        timer->start(t_vmap);
+        if (p_scenario->kernel) {
+          p_scenario->kernel->evaluate(*(p_scenario->PQ), *(p_scenario->J));
+        } else {
+          p_scenario->vMap->mapToRealVector(p_scenario->PQ);
+        }
+        timer->stop(t_vmap);
+      }
+      if (!p_scenario->kernel) {
+        timer->start(t_mmap);
+        p_factory->setMode(Jacobian);
+        p_scenario->jMap->mapToRealMatrix(p_scenario->J);
+        timer->stop(t_mmap);
+      }
+
+      timer->start(t_lsolv);
+      p_scenario->X->zero();
+      try {
+        p_scenario->solver->solve(*(p_scenario->PQ), *(p_scenario->X));
+      } catch (const gridpack::Exception e) {
+        if (!p_no_print) {
+          sprintf(ioBuf,"p[%d] hit exception: %s\n",
+              p_network->communicator().rank(),e.what());
+          p_busIO->header(ioBuf);
+          p_busIO->header("Solver failure\n\n");
+        }
+        timer->stop(t_lsolv);
+        timer->stop(t_total);
+        return false;
+      }
+      timer->stop(t_lsolv);
+      tol = p_scenario->PQ->normInfinity();
+      iter++;
+      if (!p_no_print) {
+        sprintf(ioBuf,"\nIteration %d Tol: %12.6e\n",iter,tol);
+        p_busIO->header(ioBuf);
+      }
+      if (tol > 100.0*tol_org) {
+        ret = false;
+        break;
+      }
+    }
+    if (iter >= p_max_iteration && tol > p_tolerance) ret = false;
+
+    // Push final result back onto buses
+    timer->start(t_bmap);
+    p_factory->setMode(RHS);
+    p_scenario->vMap->mapToBus(p_scenario->X);
+    timer->stop(t_bmap);
+    timer->start(t_updt);
+    p_network->updateBuses();
+    timer->stop(t_updt);
+
+    repeat = false;
+    if (p_qlim != 0 && !p_factory->checkQlimViolations()) {
+      // Bus types have changed so the Jacobian has a different structure
+      if (!p_no_print) {
+        sprintf (ioBuf,"There are Qlim violations at iter =%d\n", iter);
+        p_busIO->header(ioBuf);
+      }
+      setupScenarioContext();
+      repeat = true;
+    }
+  }
+  timer->stop(t_total);
+  return ret;
+}
+
+/**
+ * Solve a batch of power flow problems that differ only in load and
+ * generation
+ * @param scenarios list of load and generation variants
+ * @param converged returns true for scenarios that converged
+ * @param callback optional function that is called after each scenario
+ * @return true if all scenarios converged
+ */
+bool gridpack::powerflow::PFAppModule::solveScenarios(
+    const std::vector<PFScenario> &scenarios,
+    std::vector<bool> &converged, ScenarioCallback callback)
+{
+  bool persistent = static_cast<bool>(p_scenario);
+  if (!persistent) beginScenarios();
+  int i;
+  int nscen = scenarios.size();
+  bool ret = true;
+  converged.resize(nscen);
+  for (i=0; i<nscen; i++) {
+    p_factory->resetPower();
+    p_factory->scaleLoadPower(scenarios[i].load_scale,
+        scenarios[i].load_area, scenarios[i].load_zone);
+    p_factory->scaleGeneratorRealPower(scenarios[i].gen_scale,
+        scenarios[i].gen_area, scenarios[i].gen_zone);
+    converged[i] = scenarioSolve();
+    if (!converged[i]) {
+      ret = false;
+      // Do not start the next scenario from a diverged state
+      p_factory->resetVoltages();
+    }
+    if (callback) callback(i);
+  }
+  p_factory->resetPower();
+  if (!persistent) endScenarios();
+  return ret;
+}
 
 /**
  * Write out results of powerflow calculation to standard output or a file
@@ -743,6 +1100,141 @@ std::vector<std::string> gridpack::powerflow::PFAppModule::writeBranchString(
   return ret;
 }
 
+/**
+ * Get voltage results for all buses owned by this process. This returns
+ * the same values as writeBusString("vr_str") without formatting them
+ * and without gathering them on process 0
+ * @param gidx global index of each bus
+ * @param ids original index of each bus
+ * @param vang voltage angle (degrees)
+ * @param vmag voltage magnitude
+ * @param use_vmag 0 if bus is a PV bus or was originally isolated, 1
+ *        otherwise
+ * @param changed 1 if bus has switched between PV and PQ, 0 otherwise
+ */
+void gridpack::powerflow::PFAppModule::getBusVoltages(std::vector<int> &gidx,
+    std::vector<int> &ids, std::vector<double> &vang,
+    std::vector<double> &vmag, std::vector<int> &use_vmag,
+    std::vector<int> &changed)
+{
+  gidx.clear();
+  ids.clear();
+  vang.clear();
+  vmag.clear();
+  use_vmag.clear();
+  changed.clear();
+  int nbus = p_network->numBuses();
+  int i;
+  for (i=0; i<nbus; i++) {
+    if (!p_network->getActiveBus(i)) continue;
+    gridpack::powerflow::PFBus *bus = p_network->getBus(i).get();
+    double ang, mag;
+    int iuse, ichg;
+    bus->getVoltageResults(&ang,&mag,&iuse,&ichg);
+    gidx.push_back(p_network->getGlobalBusIndex(i));
+    ids.push_back(bus->getOriginalIndex());
+    vang.push_back(ang);
+    vmag.push_back(mag);
+    use_vmag.push_back(iuse);
+    changed.push_back(ichg);
+  }
+}
+
+/**
+ * Get generator power for all generators on buses owned by this process.
+ * This returns the same values as writeBusString("power")
+ * @param gidx global index of bus for each generator
+ * @param ids original index of bus for each generator
+ * @param tags character ID for each generator
+ * @param pg generator real power (MW)
+ * @param qg generator reactive power (MVAR)
+ */
+void gridpack::powerflow::PFAppModule::getGeneratorPowers(
+    std::vector<int> &gidx, std::vector<int> &ids,
+    std::vector<std::string> &tags, std::vector<double> &pg,
+    std::vector<double> &qg)
+{
+  gidx.clear();
+  ids.clear();
+  tags.clear();
+  pg.clear();
+  qg.clear();
+  int nbus = p_network->numBuses();
+  int i, j;
+  std::vector<std::string> btags;
+  std::vector<double> bpg, bqg;
+  for (i=0; i<nbus; i++) {
+    if (!p_network->getActiveBus(i)) continue;
+    gridpack::powerflow::PFBus *bus = p_network->getBus(i).get();
+    bus->getGeneratorPower(btags,bpg,bqg);
+    int ngen = bpg.size();
+    int g_idx = p_network->getGlobalBusIndex(i);
+    int o_idx = bus->getOriginalIndex();
+    for (j=0; j<ngen; j++) {
+      gidx.push_back(g_idx);
+      ids.push_back(o_idx);
+      tags.push_back(btags[j]);
+      pg.push_back(bpg[j]);
+      qg.push_back(bqg[j]);
+    }
+  }
+}
+
+/**
+ * Get power flow for all lines on branches owned by this process. This
+ * returns the same values as writeBranchString("flow_str")
+ * @param gidx global index of branch for each line
+ * @param from original index of from bus for each line
+ * @param to original index of to bus for each line
+ * @param tags character ID for each line
+ * @param p real power flow
+ * @param q reactive power flow
+ * @param perf square of ratio of apparent power to rating
+ * @param rating line rating
+ * @param viol 1 if flow exceeds rating, 0 otherwise
+ */
+void gridpack::powerflow::PFAppModule::getBranchFlows(std::vector<int> &gidx,
+    std::vector<int> &from, std::vector<int> &to,
+    std::vector<std::string> &tags, std::vector<double> &p,
+    std::vector<double> &q, std::vector<double> &perf,
+    std::vector<double> &rating, std::vector<int> &viol)
+{
+  gidx.clear();
+  from.clear();
+  to.clear();
+  tags.clear();
+  p.clear();
+  q.clear();
+  perf.clear();
+  rating.clear();
+  viol.clear();
+  int nbranch = p_network->numBranches();
+  int i, j;
+  std::vector<std::string> btags;
+  std::vector<double> bp, bq, bperf, brate;
+  std::vector<int> bviol;
+  for (i=0; i<nbranch; i++) {
+    if (!p_network->getActiveBranch(i)) continue;
+    gridpack::powerflow::PFBranch *branch = p_network->getBranch(i).get();
+    if (!branch->getFlowResults(btags,bp,bq,bperf,brate,bviol)) continue;
+    int nline = bp.size();
+    int g_idx = p_network->getGlobalBranchIndex(i);
+    int idx1 = branch->getBus1OriginalIndex();
+    int idx2 = branch->getBus2OriginalIndex();
+    for (j=0; j<nline; j++) {
+      gidx.push_back(g_idx);
+      from.push_back(idx1);
+      to.push_back(idx2);
+      tags.push_back(btags[j]);
+      p.push_back(bp[j]);
+      q.push_back(bq[j]);
+      perf.push_back(bperf[j]);
+      rating.push_back(brate[j]);
+      viol.push_back(bviol[j]);
+    }
+  }
+}
+
 void gridpack::powerflow::PFAppModule::writeHeader(const char *msg)
 {
   if (p_no_print) return;
@@ -915,6 +1407,7 @@ bool gridpack::powerflow::PFAppModule::setContingency(
     p_contingency_name.clear();
   }
   p_factory->checkLoneBus();
+  p_factory->checkIslands();
   return ret;
 }
 
@@ -926,6 +1419,7 @@ bool gridpack::powerflow::PFAppModule::setContingency(
 bool gridpack::powerflow::PFAppModule::unSetContingency(
     gridpack::powerflow::Contingency &event)
 {
+  p_factory->clearIslands();
   p_factory->clearLoneBus();
   bool ret = true;
   if (event.p_type == Generator) {
@@ -1037,6 +1531,35 @@ bool gridpack::powerflow::PFAppModule::checkLineOverloadViolations(
   return p_factory->checkLineOverloadViolations(bus1,bus2,tags,violations);
 }
 
+/**
+ * Check for voltage violations and line overload violations in the
+ * network using a single collective
+ * @param voltage_ok true if no voltage violations found
+ * @param line_ok true if no line overload violations found
+ * @return true if no violations of either type found
+ */
+bool gridpack::powerflow::PFAppModule::checkViolations(bool &voltage_ok,
+    bool &line_ok)
+{
+  return p_factory->checkViolations(voltage_ok,line_ok);
+}
+
+/**
+ * Return the smallest loading margin on a set of lines. The margin on a line
+ * is (rating - |S|)/rating, so the margin is negative if the line is
+ * overloaded
+ * @param bus1 original index of "from" bus for branch
+ * @param bus2 original index of "to" bus for branch
+ * @param tags line IDs for individual lines
+ * @return smallest margin on all lines (1.0 if no lines are rated)
+ */
+double gridpack::powerflow::PFAppModule::getLineLoadingMargin(
+    std::vector<int> &bus1, std::vector<int> &bus2,
+    std::vector<std::string> &tags)
+{
+  return p_factory->getLineLoadingMargin(bus1,bus2,tags);
+}
+
 /**
  * Check to see if there are any Q limit violations in the network
  * @param area only check for violations in specified area
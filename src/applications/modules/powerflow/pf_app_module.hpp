@@ -19,10 +19,12 @@
 #define _pf_app_module_h_
 
 #include "boost/smart_ptr/shared_ptr.hpp"
+#include "boost/function.hpp"
 #include "gridpack/serial_io/serial_io.hpp"
 #include "gridpack/configuration/configuration.hpp"
 #include "pf_factory_module.hpp"
 #include "gridpack/parser/dictionary.hpp"
+#include "gridpack/parser/shared_case.hpp"
 #include "gridpack/utilities/string_utils.hpp"
 
 namespace gridpack {
@@ -71,6 +73,23 @@ struct Contingency
   std::vector<bool> p_saveGenStatus;
 };
 
+// Struct that is used to define one load and generation variant in a batch
+// of power flow calculations on the same network. Loads in the load area
+// (zone) are scaled by load_scale and generation in the generator area
+// (zone) is adjusted using gen_scale, using the same conventions as
+// scaleLoadPower and scaleGeneratorRealPower. Scenarios start from the
+// original loads and generation.
+
+struct PFScenario
+{
+  double load_scale;
+  int load_area;
+  int load_zone;
+  double gen_scale;
+  int gen_area;
+  int gen_zone;
+};
+
 // Calling program for powerflow application
 
 class PFAppModule
@@ -99,6 +118,43 @@ class PFAppModule
                      gridpack::utility::Configuration *config,
                      int idx = -1);
 
+    /**
+     * Parse the powerflow network once on all processors in the
+     * communicator of a shared base case and store it in node level shared
+     * memory. The network file is taken from the Powerflow block in the
+     * configuration file. This is a collective operation on the communicator
+     * of the base case
+     * @param base shared base case
+     * @param config point to open configuration file
+     * @param idx index of configuration to use if set to a non-negative value
+     */
+    void readSharedCase(gridpack::parser::SharedCase<PFNetwork> &base,
+                        gridpack::utility::Configuration *config,
+                        int idx = -1);
+
+    /**
+     * Create and partition the powerflow network from a shared base case
+     * instead of reading the network file. Solver parameters are read from
+     * the Powerflow block in the configuration file
+     * @param network pointer to a PFNetwork object. This should not have any
+     * buses or branches defined on it.
+     * @param base shared base case filled by readSharedCase
+     * @param config point to open configuration file
+     */
+    void readNetwork(boost::shared_ptr<PFNetwork> &network,
+                     gridpack::parser::SharedCase<PFNetwork> &base,
+                     gridpack::utility::Configuration *config);
+
+    /**
+     * Assume that PFNetwork already exists and just cache an internal
+     * pointer to it. This routine does not call the partition function.
+     * Also read in solver parameters from configuration file
+     * @param network pointer to a complete PFNetwork object.
+     * @param config pointer to open configuration file
+     */
+    void setNetwork(boost::shared_ptr<PFNetwork> &network,
+                    gridpack::utility::Configuration *config);
+
     /**
      * Set up exchange buffers and other internal parameters and initialize
      * network components using data from data collection
@@ -124,6 +180,47 @@ class PFAppModule
      */
     bool nl_solve();
 
+    /**
+     * Function that is called after each scenario in solveScenarios has been
+     * solved. The argument is the index of the scenario. The network holds
+     * the solution of the scenario when the function is called
+     */
+    typedef boost::function<void (int)> ScenarioCallback;
+
+    /**
+     * Set up the mappers, Jacobian, vectors and linear solver used by the
+     * Newton-Raphson solver so that they can be reused by subsequent calls to
+     * solve. This is useful when many power flow calculations that differ
+     * only in loads and generation are run on the same network, since the
+     * matrix structure and the symbolic factorization are shared. The
+     * network topology and bus types must not change until endScenarios is
+     * called; if Q-limit enforcement changes bus types the structures are
+     * rebuilt automatically
+     */
+    void beginScenarios();
+
+    /**
+     * Release the data structures created by beginScenarios. Subsequent
+     * calls to solve create new mappers and solvers
+     */
+    void endScenarios();
+
+    /**
+     * Solve a batch of power flow problems that differ only in load and
+     * generation. Each scenario is applied to the original loads and
+     * generation and is started from the solution of the previous scenario,
+     * so neighboring scenarios (e.g. points along a path rating search)
+     * should be adjacent in the list. Original loads and generation are
+     * restored when the batch is complete
+     * @param scenarios list of load and generation variants
+     * @param converged returns true for scenarios that converged
+     * @param callback optional function that is called after each scenario
+     * @return true if all scenarios converged
+     */
+    bool solveScenarios(const std::vector<PFScenario> &scenarios,
+        std::vector<bool> &converged,
+        ScenarioCallback callback = ScenarioCallback());
+
     /**
      * Write out results of powerflow calculation to standard output
      * Separate calls for writing only data from buses or branches
@@ -138,6 +235,54 @@ class PFAppModule
     std::vector<std::string> writeBusString(const char *signal = NULL);
     std::vector<std::string> writeBranchString(const char *signal = NULL);
 
+    /**
+     * Get voltage results for all buses owned by this process. This returns
+     * the same values as writeBusString("vr_str") without formatting them
+     * and without gathering them on process 0
+     * @param gidx global index of each bus
+     * @param ids original index of each bus
+     * @param vang voltage angle (degrees)
+     * @param vmag voltage magnitude
+     * @param use_vmag 0 if bus is a PV bus or was originally isolated, 1
+     *        otherwise
+     * @param changed 1 if bus has switched between PV and PQ, 0 otherwise
+     */
+    void getBusVoltages(std::vector<int> &gidx, std::vector<int> &ids,
+        std::vector<double> &vang, std::vector<double> &vmag,
+        std::vector<int> &use_vmag, std::vector<int> &changed);
+
+    /**
+     * Get generator power for all generators on buses owned by this process.
+     * This returns the same values as writeBusString("power")
+     * @param gidx global index of bus for each generator
+     * @param ids original index of bus for each generator
+     * @param tags character ID for each generator
+     * @param pg generator real power (MW)
+     * @param qg generator reactive power (MVAR)
+     */
+    void getGeneratorPowers(std::vector<int> &gidx, std::vector<int> &ids,
+        std::vector<std::string> &tags, std::vector<double> &pg,
+        std::vector<double> &qg);
+
+    /**
+     * Get power flow for all lines on branches owned by this process. This
+     * returns the same values as writeBranchString("flow_str")
+     * @param gidx global index of branch for each line
+     * @param from original index of from bus for each line
+     * @param to original index of to bus for each line
+     * @param tags character ID for each line
+     * @param p real power flow
+     * @param q reactive power flow
+     * @param perf square of ratio of apparent power to rating
+     * @param rating line rating
+     * @param viol 1 if flow exceeds rating, 0 otherwise
+     */
+    void getBranchFlows(std::vector<int> &gidx, std::vector<int> &from,
+        std::vector<int> &to, std::vector<std::string> &tags,
+        std::vector<double> &p, std::vector<double> &q,
+        std::vector<double> &perf, std::vector<double> &rating,
+        std::vector<int> &viol);
+
     /**
      * Redirect output from standard out
      * @param filename name of file to write results to
@@ -247,6 +392,28 @@ class PFAppModule
         std::vector<int> &bus2, std::vector<std::string> &tags,
         std::vector<bool> &violations);
 
+    /**
+     * Check for voltage violations and line overload violations in the
+     * network using a single collective
+     * @param voltage_ok true if no voltage violations found
+     * @param line_ok true if no line overload violations found
+     * @return true if no violations of either type found
+     */
+    bool checkViolations(bool &voltage_ok, bool &line_ok);
+
+    /**
+     * Return the smallest loading margin on a set of lines. The margin on a
+     * line is (rating - |S|)/rating, where S is the complex power flow on
+     * the line, so the margin is negative if the line is overloaded. Lines
+     * without a rating or flagged as ignored are skipped
+     * @param bus1 original index of "from" bus for branch
+     * @param bus2 original index of "to" bus for branch
+     * @param tags line IDs for individual lines
+     * @return smallest margin on all lines (1.0 if no lines are rated)
+     */
+    double getLineLoadingMargin(std::vector<int> &bus1, std::vector<int> &bus2,
+        std::vector<std::string> &tags);
+
     /**
      * Set "ignore" paramter on all lines with violations so that subsequent
      * checks are not counted as violations
@@ -474,6 +641,44 @@ class PFAppModule
 
   private:
 
+    /**
+     * Find the network file in the Powerflow block of the configuration
+     * file and parse it without partitioning the network
+     * @param network pointer to a PFNetwork object with no buses or branches
+     * @param config point to open configuration file
+     * @param idx index of configuration to use if set to a non-negative value
+     * @return false if no network file was found
+     */
+    bool parseNetwork(boost::shared_ptr<PFNetwork> &network,
+                      gridpack::utility::Configuration *config, int idx);
+
+    /**
+     * Read solver parameters, set up serial IO and partition network
+     * @param network pointer to a PFNetwork object
+     * @param config point to open configuration file
+     */
+    void finishNetwork(boost::shared_ptr<PFNetwork> &network,
+                       gridpack::utility::Configuration *config);
+
+    /**
+     * Data structures that are reused by solve between calls to
+     * beginScenarios and endScenarios
+     */
+    struct ScenarioContext;
+
+    /**
+     * Create mappers, Jacobian, vectors and linear solver for the current
+     * network state
+     */
+    void setupScenarioContext();
+
+    /**
+     * Execute the Newton-Raphson iterations using the data structures
+     * created by beginScenarios
+     * @return false if an error was encountered in the solution
+     */
+    bool scenarioSolve();
+
     /**
      * Template function for modifying generator parameters in data collection
      * for specified bus
@@ -889,6 +1094,9 @@ class PFAppModule
     // Flag to suppress all printing to standard out
     bool p_no_print;
 
+    // Data structures reused by solve between beginScenarios and endScenarios
+    boost::shared_ptr<ScenarioContext> p_scenario;
+
 #ifdef USE_GOSS
     gridpack::goss::GOSSClient p_goss_client;
 
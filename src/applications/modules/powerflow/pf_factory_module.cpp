@@ -225,6 +225,137 @@ void gridpack::powerflow::PFFactoryModule::clearLoneBus()
   }
 }
 
+/**
+ * Check whether the branches that are in service split the network
+ * into islands. Islands without any generators that are in service
+ * are de-energized by marking their buses as isolated. Islands with
+ * generators that do not contain a reference bus are assigned one, the
+ * bus with the largest generating capacity, so that each island is
+ * solved with its own angle reference
+ * @param stream optional stream pointer that can be used to print out
+ * the changes that were made
+ * @return number of energized islands
+ */
+int gridpack::powerflow::PFFactoryModule::checkIslands(std::ofstream *stream)
+{
+  clearIslands();
+  int numBus = p_network->numBuses();
+  int numBranch = p_network->numBranches();
+  int i, j;
+  std::vector<bool> inService(numBranch);
+  for (i=0; i<numBranch; i++) {
+    std::vector<bool> status = p_network->getBranch(i)->getLineStatus();
+    inService[i] = false;
+    for (j=0; j<status.size(); j++) {
+      if (status[j]) inService[i] = true;
+    }
+  }
+  std::vector<int> island;
+  int nisland = p_network->findIslands(inService, island);
+
+  // Find the number of buses, generators and reference buses in each island
+  // and the capacity of the largest generating bus
+  std::vector<int> nbus(nisland,0), ngen(nisland,0), nref(nisland,0);
+  std::vector<double> capacity(nisland,-1.0);
+  std::vector<int> candidate(nisland,0);
+  std::vector<double> bus_capacity(numBus,-1.0);
+  for (i=0; i<numBus; i++) {
+    if (!p_network->getActiveBus(i)) continue;
+    gridpack::powerflow::PFBus *bus = p_network->getBus(i).get();
+    if (bus->isIsolated()) continue;
+    int isl = island[i];
+    nbus[isl]++;
+    if (bus->getReferenceBus()) nref[isl]++;
+    std::vector<std::string> tags;
+    std::vector<double> current, pmin, pmax;
+    std::vector<int> status;
+    bus->getGeneratorMargins(tags,current,pmin,pmax,status);
+    for (j=0; j<status.size(); j++) {
+      if (status[j]) {
+        ngen[isl]++;
+        if (bus_capacity[i] < 0.0) bus_capacity[i] = 0.0;
+        bus_capacity[i] += pmax[j];
+      }
+    }
+    if (bus_capacity[i] > capacity[isl]) capacity[isl] = bus_capacity[i];
+  }
+  if (nisland > 0) {
+    p_network->communicator().sum(&nbus[0],nisland);
+    p_network->communicator().sum(&ngen[0],nisland);
+    p_network->communicator().sum(&nref[0],nisland);
+    p_network->communicator().max(&capacity[0],nisland);
+  }
+  // Break ties between buses with the same capacity using the global index
+  int nglobal = p_network->totalBuses();
+  for (i=0; i<nisland; i++) candidate[i] = nglobal;
+  for (i=0; i<numBus; i++) {
+    if (!p_network->getActiveBus(i)) continue;
+    if (p_network->getBus(i)->isIsolated()) continue;
+    int isl = island[i];
+    if (bus_capacity[i] >= 0.0 && bus_capacity[i] == capacity[isl]) {
+      int idx = p_network->getGlobalBusIndex(i);
+      if (idx < candidate[isl]) candidate[isl] = idx;
+    }
+  }
+  if (nisland > 0) p_network->communicator().min(&candidate[0],nisland);
+
+  // Modify buses on all processors, including ghost buses
+  std::vector<int> candidate_id(nisland,0);
+  for (i=0; i<numBus; i++) {
+    gridpack::powerflow::PFBus *bus = p_network->getBus(i).get();
+    if (bus->isIsolated()) continue;
+    int isl = island[i];
+    if (ngen[isl] == 0 && nref[isl] == 0) {
+      bus->setIsolated(true);
+      p_islandIsolated.push_back(i);
+    } else if (nref[isl] == 0 &&
+        p_network->getGlobalBusIndex(i) == candidate[isl]) {
+      bus->setReferenceBus(true);
+      p_islandReference.push_back(i);
+      if (p_network->getActiveBus(i)) {
+        candidate_id[isl] = bus->getOriginalIndex();
+      }
+    }
+  }
+  if (nisland > 0) p_network->communicator().sum(&candidate_id[0],nisland);
+
+  int nlive = 0;
+  char buf[128];
+  for (i=0; i<nisland; i++) {
+    if (nbus[i] == 0) continue;
+    if (ngen[i] == 0 && nref[i] == 0) {
+      sprintf(buf,"\nIsland with %d buses has no generation and is"
+          " de-energized\n",nbus[i]);
+    } else {
+      nlive++;
+      if (nref[i] > 0) continue;
+      sprintf(buf,"\nIsland with %d buses assigned reference bus %d\n",
+          nbus[i],candidate_id[i]);
+    }
+    if (p_network->communicator().rank() == 0) {
+      printf("%s",buf);
+      if (stream != NULL) *stream << buf;
+    }
+  }
+  return nlive;
+}
+
+/**
+ * Undo the changes made by checkIslands
+ */
+void gridpack::powerflow::PFFactoryModule::clearIslands()
+{
+  int i;
+  for (i=0; i<p_islandIsolated.size(); i++) {
+    p_network->getBus(p_islandIsolated[i])->setIsolated(false);
+  }
+  for (i=0; i<p_islandReference.size(); i++) {
+    p_network->getBus(p_islandReference[i])->setReferenceBus(false);
+  }
+  p_islandIsolated.clear();
+  p_islandReference.clear();
+}
+
 /**
  * Set voltage limits on all buses
  * @param Vmin lower bound on voltages
@@ -251,6 +382,15 @@ void gridpack::powerflow::PFFactoryModule::setVoltageLimits(double Vmin,
  * @return true if no violations found
  */
 bool gridpack::powerflow::PFFactoryModule::checkVoltageViolations()
+{
+  return checkTrue(checkLocalVoltageViolations());
+}
+
+/**
+ * Check for voltage violations on buses owned by this processor
+ * @return true if no violations found locally
+ */
+bool gridpack::powerflow::PFFactoryModule::checkLocalVoltageViolations()
 {
   int numBus = p_network->numBuses();
   int i;
@@ -266,7 +406,7 @@ bool gridpack::powerflow::PFFactoryModule::checkVoltageViolations()
       }
     }
   }
-  return checkTrue(bus_ok);
+  return bus_ok;
 }
 
 /**
@@ -344,6 +484,15 @@ void gridpack::powerflow::PFFactoryModule::clearVoltageViolations()
  * @return true if no violations found
  */
 bool gridpack::powerflow::PFFactoryModule::checkLineOverloadViolations()
+{
+  return checkTrue(checkLocalLineOverloadViolations());
+}
+
+/**
+ * Check for line overload violations on branches owned by this processor
+ * @return true if no violations found locally
+ */
+bool gridpack::powerflow::PFFactoryModule::checkLocalLineOverloadViolations()
 {
   int numBranch = p_network->numBranches();
   int i;
@@ -395,7 +544,25 @@ bool gridpack::powerflow::PFFactoryModule::checkLineOverloadViolations()
       }
     }
   }
-  return checkTrue(branch_ok);
+  return branch_ok;
+}
+
+/**
+ * Check for voltage violations and line overload violations in the
+ * network. Both checks are completed with a single collective
+ * @param voltage_ok true if no voltage violations found
+ * @param line_ok true if no line overload violations found
+ * @return true if no violations of either type found
+ */
+bool gridpack::powerflow::PFFactoryModule::checkViolations(bool &voltage_ok,
+    bool &line_ok)
+{
+  clearChecks();
+  int ivolt = addCheckTrue(checkLocalVoltageViolations());
+  int iline = addCheckTrue(checkLocalLineOverloadViolations());
+  voltage_ok = checkResult(ivolt);
+  line_ok = checkResult(iline);
+  return voltage_ok && line_ok;
 }
 
 /**
@@ -538,6 +705,58 @@ bool gridpack::powerflow::PFFactoryModule::checkLineOverloadViolations(
   return branch_ok;
 }
 
+/**
+ * Return the smallest loading margin on a set of lines. The margin on a line
+ * is (rating - |S|)/rating, so the margin is negative if the line is
+ * overloaded
+ * @param bus1 original index of "from" bus for branch
+ * @param bus2 original index of "to" bus for branch
+ * @param tags line IDs for individual lines
+ * @return smallest margin on all lines (1.0 if no lines are rated)
+ */
+double gridpack::powerflow::PFFactoryModule::getLineLoadingMargin(
+    std::vector<int> &bus1, std::vector<int> &bus2,
+    std::vector<std::string> &tags)
+{
+  double margin = 1.0;
+  int nbranch = bus1.size();
+  if (nbranch != bus2.size() || nbranch != tags.size()) {
+    printf("getLineLoadingMargin: number of entries"
+        " in bus1 and bus2 or bus1 and tags not equal\n");
+    return margin;
+  }
+  int i, j, k;
+  for (i=0; i<nbranch; i++) {
+    std::vector<int> indices = p_network->getLocalBranchIndices(bus1[i],bus2[i]);
+    for (j=0; j<indices.size(); j++) {
+      gridpack::powerflow::PFBranch *branch = p_network->getBranch(indices[j]).get();
+      gridpack::component::DataCollection *data
+        = p_network->getBranchData(indices[j]).get();
+      int nlines;
+      data->getValue(BRANCH_NUM_ELEMENTS,&nlines);
+      std::vector<std::string> alltags = branch->getLineTags();
+      double rate;
+      for (k=0; k<nlines; k++) {
+        if (tags[i] != alltags[k] || branch->getIgnore(alltags[k])) continue;
+        bool foundRating = false;
+        if (p_rateB) {
+          foundRating = data->getValue(BRANCH_RATING_B,&rate,k);
+        }
+        if (!foundRating) {
+          foundRating = data->getValue(BRANCH_RATING_A,&rate,k);
+        }
+        if (foundRating && rate > 0.0) {
+          gridpack::ComplexType s = branch->getComplexPower(alltags[k]);
+          double m = (rate-abs(s))/rate;
+          if (m < margin) margin = m;
+        }
+      }
+    }
+  }
+  p_network->communicator().min(&margin,1);
+  return margin;
+}
+
 /**
  * Set "ignore" parameter on all lines with violations so that subsequent
  * checks are not counted as violations
@@ -610,6 +829,10 @@ bool gridpack::powerflow::PFFactoryModule::checkQlimViolations()
       if (bus->chkQlim()) bus_ok = false;
     }
   }
+  // Start the reduction so that it overlaps with the ghost bus update
+  clearChecks();
+  int iok = addCheckTrue(bus_ok);
+  startChecks();
   p_network->updateBuses();
   for (i=0; i<numBus; i++) {
     if (!p_network->getActiveBus(i)) {
@@ -619,7 +842,7 @@ bool gridpack::powerflow::PFFactoryModule::checkQlimViolations()
       bus->pushIsPV();
     }
   }
-  return checkTrue(bus_ok);
+  return checkResult(iok);
 }
 
 /**
@@ -642,6 +865,10 @@ bool gridpack::powerflow::PFFactoryModule::checkQlimViolations(int area)
       }
     }
   }
+  // Start the reduction so that it overlaps with the ghost bus update
+  clearChecks();
+  int iok = addCheckTrue(bus_ok);
+  startChecks();
   p_network->updateBuses();
   for (i=0; i<numBus; i++) {
     if (!p_network->getActiveBus(i)) {
@@ -651,7 +878,7 @@ bool gridpack::powerflow::PFFactoryModule::checkQlimViolations(int area)
       bus->pushIsPV();
     }
   }
-  return checkTrue(bus_ok);
+  return checkResult(iok);
 }
 
 /**
@@ -96,6 +96,24 @@ class PFFactoryModule
      */
     void clearLoneBus();
 
+    /**
+     * Check whether the branches that are in service split the network
+     * into islands. Islands without any generators that are in service
+     * are de-energized by marking their buses as isolated. Islands with
+     * generators that do not contain a reference bus are assigned one, the
+     * bus with the largest generating capacity, so that each island is
+     * solved with its own angle reference
+     * @param stream optional stream pointer that can be used to print out
+     * the changes that were made
+     * @return number of energized islands
+     */
+    int checkIslands(std::ofstream *stream = NULL);
+
+    /**
+     * Undo the changes made by checkIslands
+     */
+    void clearIslands();
+
     /**
      * Set voltage limits on all buses
      * @param Vmin lower bound on voltages
@@ -151,6 +169,28 @@ class PFFactoryModule
     bool checkLineOverloadViolations(std::vector<int> &bus1, std::vector<int> &bus2,
         std::vector<std::string> &tags, std::vector<bool> &violations);
 
+    /**
+     * Check for voltage violations and line overload violations in the
+     * network. Both checks are completed with a single collective
+     * @param voltage_ok true if no voltage violations found
+     * @param line_ok true if no line overload violations found
+     * @return true if no violations of either type found
+     */
+    bool checkViolations(bool &voltage_ok, bool &line_ok);
+
+    /**
+     * Return the smallest loading margin on a set of lines. The margin on a
+     * line is (rating - |S|)/rating, where S is the complex power flow on
+     * the line, so the margin is negative if the line is overloaded. Lines
+     * without a rating or flagged as ignored are skipped
+     * @param bus1 original index of "from" bus for branch
+     * @param bus2 original index of "to" bus for branch
+     * @param tags line IDs for individual lines
+     * @return smallest margin on all lines (1.0 if no lines are rated)
+     */
+    double getLineLoadingMargin(std::vector<int> &bus1, std::vector<int> &bus2,
+        std::vector<std::string> &tags);
+
     /**
      * Set "ignore" parameter on all lines with violations so that subsequent
      * checks are not counted as violations
@@ -245,9 +285,27 @@ class PFFactoryModule
 
   private:
 
+    /**
+     * Check for voltage violations on buses owned by this processor
+     * @return true if no violations found locally
+     */
+    bool checkLocalVoltageViolations();
+
+    /**
+     * Check for line overload violations on branches owned by this
+     * processor
+     * @return true if no violations found locally
+     */
+    bool checkLocalLineOverloadViolations();
+
     NetworkPtr p_network;
     std::vector<bool> p_saveIsolatedStatus;
 
+    // Local indices of buses that were isolated or made reference buses by
+    // checkIslands
+    std::vector<int> p_islandIsolated;
+    std::vector<int> p_islandReference;
+
     std::vector<Violation> p_violations;
 
     bool p_rateB;
@@ -0,0 +1,292 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   pf_kernel.cpp
+ * @date   October 19, 2026
+ *
+ * @brief
+ *
+ *
+ */
+// -------------------------------------------------------------
+
+#include <math.h>
+#include <stdio.h>
+#include "pf_kernel.hpp"
+#include "gridpack/utilities/exception.hpp"
+
+/**
+ * Basic constructor
+ * @param network power flow network
+ */
+gridpack::powerflow::PFKernel::PFKernel(boost::shared_ptr<PFNetwork> network)
+  : p_network(network)
+{
+}
+
+/**
+ * Basic destructor
+ */
+gridpack::powerflow::PFKernel::~PFKernel()
+{
+}
+
+/**
+ * Copy the local Y-bus into CSR arrays and find the location of the
+ * values in the Jacobian. The Y-bus values must have been set on the
+ * components and the network must be in Jacobian mode. This must be
+ * called again if the bus types change
+ * @param jMap mapper used to create the Jacobian
+ */
+void gridpack::powerflow::PFKernel::setup(
+    gridpack::mapper::FullMatrixMap<PFNetwork> &jMap)
+{
+  int nbus = p_network->numBuses();
+  int i, k, ib, jb, nbr;
+  std::vector<int> iOffsets, jOffsets;
+  jMap.getBusOffsets(iOffsets, jOffsets);
+
+  p_buses.resize(nbus);
+  p_v.resize(nbus);
+  p_a.resize(nbus);
+  for (i=0; i<nbus; i++) {
+    p_buses[i] = p_network->getBus(i).get();
+  }
+
+  p_rowBus.clear();
+  p_rowSize.clear();
+  p_rowPtr.clear();
+  p_edgeRowBus.clear();
+  p_edgeBus.clear();
+  p_edgeBranch.clear();
+  p_edgeSize.clear();
+  p_edgeForward.clear();
+  p_edgeJacobian.clear();
+  p_fIdx.clear();
+  p_jIdx.clear();
+  p_jJdx.clear();
+  p_rowPtr.push_back(0);
+  for (i=0; i<nbus; i++) {
+    PFBus *bus = p_buses[i];
+    if (!p_network->getActiveBus(i) || bus->isIsolated()
+        || bus->getReferenceBus()) continue;
+    if (iOffsets[i] < 0) {
+      char buf[256];
+      sprintf(buf,"PFKernel::setup: no Jacobian block for bus %d\n",
+          bus->getOriginalIndex());
+      throw gridpack::Exception(buf);
+    }
+    int isize = bus->isPV() ? 1 : 2;
+    p_rowBus.push_back(i);
+    p_rowSize.push_back(isize);
+    nbr = p_network->numConnectedBranches(i);
+    const int *branches = p_network->connectedBranchList(i);
+    const int *buses = p_network->connectedBusList(i);
+    for (k=0; k<nbr; k++) {
+      PFBranch *branch = p_network->getBranch(branches[k]).get();
+      PFBus *nghbr = p_buses[buses[k]];
+      bool jac = branch->isActive() && !nghbr->isIsolated()
+        && !nghbr->getReferenceBus();
+      int jsize = nghbr->isPV() ? 1 : 2;
+      p_edgeRowBus.push_back(i);
+      p_edgeBus.push_back(buses[k]);
+      p_edgeBranch.push_back(branches[k]);
+      p_edgeSize.push_back(jsize);
+      p_edgeForward.push_back(branch->getBus1().get() == bus ? 1 : 0);
+      p_edgeJacobian.push_back(jac ? 1 : 0);
+      if (jac) {
+        if (jOffsets[buses[k]] < 0) {
+          char buf[256];
+          sprintf(buf,"PFKernel::setup: no Jacobian block for bus %d\n",
+              nghbr->getOriginalIndex());
+          throw gridpack::Exception(buf);
+        }
+        // Same ordering as the values generated by compute
+        for (jb=0; jb<jsize; jb++) {
+          for (ib=0; ib<isize; ib++) {
+            p_jIdx.push_back(iOffsets[i]+ib);
+            p_jJdx.push_back(jOffsets[buses[k]]+jb);
+          }
+        }
+      }
+    }
+    p_rowPtr.push_back(p_edgeBus.size());
+    for (jb=0; jb<isize; jb++) {
+      for (ib=0; ib<isize; ib++) {
+        p_jIdx.push_back(iOffsets[i]+ib);
+        p_jJdx.push_back(jOffsets[i]+jb);
+      }
+    }
+    for (ib=0; ib<isize; ib++) {
+      p_fIdx.push_back(iOffsets[i]+ib);
+    }
+  }
+  int nrow = p_rowBus.size();
+  int nedge = p_edgeBus.size();
+  p_gii.resize(nrow);
+  p_bii.resize(nrow);
+  p_gij.resize(nedge);
+  p_bij.resize(nedge);
+  p_edgeP.resize(nedge);
+  p_edgeQ.resize(nedge);
+  p_fVal.resize(p_fIdx.size());
+  p_jVal.resize(p_jIdx.size());
+  loadYBus();
+}
+
+/**
+ * Update the Y-bus values in the CSR arrays. The structure of the
+ * Y-bus must not have changed since setup was called
+ */
+void gridpack::powerflow::PFKernel::loadYBus()
+{
+  int r, e;
+  int nrow = p_rowBus.size();
+  int nedge = p_edgeBus.size();
+  gridpack::ComplexType y;
+  for (r=0; r<nrow; r++) {
+    y = p_buses[p_rowBus[r]]->getYBus();
+    p_gii[r] = real(y);
+    p_bii[r] = imag(y);
+  }
+  for (e=0; e<nedge; e++) {
+    PFBranch *branch = p_network->getBranch(p_edgeBranch[e]).get();
+    if (p_edgeForward[e]) {
+      y = branch->getForwardYBus();
+    } else {
+      y = branch->getReverseYBus();
+    }
+    p_gij[e] = real(y);
+    p_bij[e] = imag(y);
+  }
+}
+
+/**
+ * Copy a block of values into the list of Jacobian values, dropping
+ * rows and columns that are not present for PV buses
+ * @param block 2x2 block in column-major order
+ * @param isize number of rows in block
+ * @param jsize number of columns in block
+ * @param jcnt current position in list, updated on return
+ */
+inline void gridpack::powerflow::PFKernel::addBlock(const double *block,
+    int isize, int jsize, int *jcnt)
+{
+  int ib, jb;
+  for (jb=0; jb<jsize; jb++) {
+    for (ib=0; ib<isize; ib++) {
+      p_jVal[*jcnt] = block[2*jb+ib];
+      (*jcnt)++;
+    }
+  }
+}
+
+/**
+ * Evaluate branch flows, mismatches and, optionally, Jacobian values
+ * @param jacobian evaluate Jacobian values
+ */
+void gridpack::powerflow::PFKernel::compute(bool jacobian)
+{
+  int nbus = p_buses.size();
+  int nrow = p_rowBus.size();
+  int nedge = p_edgeBus.size();
+  int i, r, e;
+  for (i=0; i<nbus; i++) {
+    p_v[i] = p_buses[i]->getVoltage();
+    p_a[i] = p_buses[i]->getPhase();
+  }
+
+  // Flows on all branches. This loop has no branches or calls other than
+  // sin and cos so that it can be vectorized
+  const double *v = nedge > 0 ? &p_v[0] : NULL;
+  const double *a = nedge > 0 ? &p_a[0] : NULL;
+  const int *ibus = nedge > 0 ? &p_edgeRowBus[0] : NULL;
+  const int *jbus = nedge > 0 ? &p_edgeBus[0] : NULL;
+  const double *g = nedge > 0 ? &p_gij[0] : NULL;
+  const double *b = nedge > 0 ? &p_bij[0] : NULL;
+  double *ep = nedge > 0 ? &p_edgeP[0] : NULL;
+  double *eq = nedge > 0 ? &p_edgeQ[0] : NULL;
+  for (e=0; e<nedge; e++) {
+    double theta = a[ibus[e]] - a[jbus[e]];
+    double cs = cos(theta);
+    double sn = sin(theta);
+    double vv = v[ibus[e]]*v[jbus[e]];
+    ep[e] = vv*(g[e]*cs + b[e]*sn);
+    eq[e] = vv*(g[e]*sn - b[e]*cs);
+  }
+
+  // Accumulate injections for each bus and form the Jacobian blocks from
+  // the branch flows
+  int fcnt = 0;
+  int jcnt = 0;
+  double block[4];
+  for (r=0; r<nrow; r++) {
+    i = p_rowBus[r];
+    double vi = p_v[i];
+    double P = vi*vi*p_gii[r];
+    double Q = -vi*vi*p_bii[r];
+    int isize = p_rowSize[r];
+    for (e=p_rowPtr[r]; e<p_rowPtr[r+1]; e++) {
+      P += p_edgeP[e];
+      Q += p_edgeQ[e];
+      if (jacobian && p_edgeJacobian[e]) {
+        double vj = p_v[p_edgeBus[e]];
+        block[0] = p_edgeQ[e];
+        block[1] = -p_edgeP[e];
+        block[2] = p_edgeP[e]/vj;
+        block[3] = p_edgeQ[e]/vj;
+        addBlock(block, isize, p_edgeSize[e], &jcnt);
+      }
+    }
+    p_buses[i]->setPowerInjection(P, Q);
+    if (jacobian) {
+      block[0] = -Q - p_bii[r]*vi*vi;
+      block[1] = P - p_gii[r]*vi*vi;
+      block[2] = P/vi + p_gii[r]*vi;
+      block[3] = Q/vi - p_bii[r]*vi;
+      addBlock(block, isize, isize, &jcnt);
+    }
+    double p0, q0;
+    p_buses[i]->getScheduledPower(&p0, &q0);
+    p_fVal[fcnt] = P - p0;
+    fcnt++;
+    if (isize > 1) {
+      p_fVal[fcnt] = Q - q0;
+      fcnt++;
+    }
+  }
+}
+
+/**
+ * Evaluate power flow mismatches and Jacobian for the current bus
+ * voltages. Ghost buses must be up to date
+ * @param F mismatch vector (created by BusVectorMap in RHS mode)
+ * @param J Jacobian (created by FullMatrixMap in Jacobian mode)
+ */
+void gridpack::powerflow::PFKernel::evaluate(gridpack::math::RealVector &F,
+    gridpack::math::RealMatrix &J)
+{
+  compute(true);
+  int nf = p_fIdx.size();
+  if (nf > 0) F.setElements(nf, &p_fIdx[0], &p_fVal[0]);
+  F.ready();
+  int nj = p_jIdx.size();
+  if (nj > 0) J.setElements(nj, &p_jIdx[0], &p_jJdx[0], &p_jVal[0]);
+  J.ready();
+}
+
+/**
+ * Evaluate power flow mismatches for the current bus voltages
+ * @param F mismatch vector (created by BusVectorMap in RHS mode)
+ */
+void gridpack::powerflow::PFKernel::evaluate(gridpack::math::RealVector &F)
+{
+  compute(false);
+  int nf = p_fIdx.size();
+  if (nf > 0) F.setElements(nf, &p_fIdx[0], &p_fVal[0]);
+  F.ready();
+}
@@ -0,0 +1,134 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   pf_kernel.hpp
+ * @date   October 19, 2026
+ *
+ * @brief  Network-level evaluation of the power flow mismatches and
+ * Jacobian. The local part of the Y-bus is copied into compressed row
+ * (CSR) arrays once and the mismatch vector and Jacobian are then evaluated
+ * in a single pass over these arrays, without calling the bus and branch
+ * components. The sine and cosine of the angle difference across each
+ * branch are computed once and used for both the mismatches and the
+ * Jacobian. Values are written directly into a vector and matrix created
+ * by the BusVectorMap and FullMatrixMap used for the power flow.
+ *
+ *
+ */
+// -------------------------------------------------------------
+
+#ifndef _pf_kernel_h_
+#define _pf_kernel_h_
+
+#include <vector>
+#include "boost/smart_ptr/shared_ptr.hpp"
+#include "gridpack/math/math.hpp"
+#include "gridpack/mapper/full_map.hpp"
+#include "pf_factory_module.hpp"
+
+namespace gridpack {
+namespace powerflow {
+
+class PFKernel
+{
+  public:
+    /**
+     * Basic constructor
+     * @param network power flow network
+     */
+    PFKernel(boost::shared_ptr<PFNetwork> network);
+
+    /**
+     * Basic destructor
+     */
+    ~PFKernel();
+
+    /**
+     * Copy the local Y-bus into CSR arrays and find the location of the
+     * values in the Jacobian. The Y-bus values must have been set on the
+     * components and the network must be in Jacobian mode. This must be
+     * called again if the bus types change
+     * @param jMap mapper used to create the Jacobian
+     */
+    void setup(gridpack::mapper::FullMatrixMap<PFNetwork> &jMap);
+
+    /**
+     * Update the Y-bus values in the CSR arrays. The structure of the
+     * Y-bus must not have changed since setup was called
+     */
+    void loadYBus();
+
+    /**
+     * Evaluate power flow mismatches and Jacobian for the current bus
+     * voltages. Ghost buses must be up to date
+     * @param F mismatch vector (created by BusVectorMap in RHS mode)
+     * @param J Jacobian (created by FullMatrixMap in Jacobian mode)
+     */
+    void evaluate(gridpack::math::RealVector &F,
+        gridpack::math::RealMatrix &J);
+
+    /**
+     * Evaluate power flow mismatches for the current bus voltages
+     * @param F mismatch vector (created by BusVectorMap in RHS mode)
+     */
+    void evaluate(gridpack::math::RealVector &F);
+
+  private:
+
+    /**
+     * Evaluate branch flows, mismatches and, optionally, Jacobian values
+     * @param jacobian evaluate Jacobian values
+     */
+    void compute(bool jacobian);
+
+    /**
+     * Copy a block of values into the list of Jacobian values, dropping
+     * rows and columns that are not present for PV buses
+     * @param block 2x2 block in column-major order
+     * @param isize number of rows in block
+     * @param jsize number of columns in block
+     * @param jcnt current position in list, updated on return
+     */
+    void addBlock(const double *block, int isize, int jsize, int *jcnt);
+
+    boost::shared_ptr<PFNetwork> p_network;
+
+    // Local buses, including ghosts
+    std::vector<PFBus*> p_buses;
+    std::vector<double> p_v;
+    std::vector<double> p_a;
+
+    // Rows of the Jacobian (buses that are not isolated or reference buses)
+    std::vector<int> p_rowBus;
+    std::vector<int> p_rowSize;
+    std::vector<int> p_rowPtr;
+    std::vector<double> p_gii;
+    std::vector<double> p_bii;
+
+    // Branches connected to each row bus, in CSR order
+    std::vector<int> p_edgeRowBus;
+    std::vector<int> p_edgeBus;
+    std::vector<int> p_edgeBranch;
+    std::vector<int> p_edgeSize;
+    std::vector<char> p_edgeForward;
+    std::vector<char> p_edgeJacobian;
+    std::vector<double> p_gij;
+    std::vector<double> p_bij;
+    std::vector<double> p_edgeP;
+    std::vector<double> p_edgeQ;
+
+    // Locations and values of vector and matrix elements
+    std::vector<int> p_fIdx;
+    std::vector<double> p_fVal;
+    std::vector<int> p_jIdx;
+    std::vector<int> p_jJdx;
+    std::vector<double> p_jVal;
+};
+
+} // powerflow
+} // gridpack
+#endif
@@ -0,0 +1,103 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   cpf_test.cpp
+ * @date   October 19, 2026
+ *
+ * @brief  Trace the PV curve of a network with the continuation power flow
+ * and compare the loading margin with a reference value. The curve is
+ * traced twice to check that the second call starts from the base loads
+ */
+// -------------------------------------------------------------
+
+#include <math.h>
+#include "mpi.h"
+#include <ga.h>
+#include <macdecls.h>
+#include "gridpack/include/gridpack.hpp"
+#include "pf_app_module.hpp"
+#include "cpf_app_module.hpp"
+
+int
+main(int argc, char **argv)
+{
+  gridpack::Environment env(argc,argv);
+  int ret = 0;
+
+  if (1) {
+    gridpack::parallel::Communicator world;
+    int me = world.rank();
+
+    // read configuration file
+    gridpack::utility::Configuration *config =
+      gridpack::utility::Configuration::configuration();
+    if (argc >= 2 && argv[1] != NULL) {
+      char inputfile[256];
+      sprintf(inputfile,"%s",argv[1]);
+      config->open(inputfile,world);
+    } else {
+      config->open("input_cpf.xml",world);
+    }
+
+    gridpack::utility::Configuration::CursorPtr cursor;
+    cursor = config->getCursor(
+        "Configuration.Powerflow.ContinuationPowerFlow");
+    double refMargin = -1.0;
+    double refTol = 0.01;
+    if (cursor) {
+      refMargin = cursor->get("referenceMargin",refMargin);
+      refTol = cursor->get("referenceTolerance",refTol);
+    }
+
+    // solve base case
+    boost::shared_ptr<gridpack::powerflow::PFNetwork>
+      pf_network(new gridpack::powerflow::PFNetwork(world));
+    gridpack::powerflow::PFAppModule pf_app;
+    pf_app.readNetwork(pf_network,config);
+    pf_app.initialize();
+    pf_app.solve();
+
+    gridpack::powerflow::CPFAppModule cpf(pf_network,config);
+    int chk = 1;
+    bool nose = cpf.solve();
+    cpf.write();
+    double margin1 = cpf.getMargin();
+    double mw1 = cpf.getMarginMW();
+    if (!nose) {
+      if (me == 0) printf("Nose of PV curve not found\n");
+      chk = 0;
+    }
+    if (refMargin >= 0.0 && fabs(margin1-refMargin) > refTol) {
+      if (me == 0) printf("Loading margin %f differs from reference %f\n",
+          margin1,refMargin);
+      chk = 0;
+    }
+
+    // A second solve must start from the base loads and give the same
+    // curve
+    nose = cpf.solve();
+    double margin2 = cpf.getMargin();
+    double mw2 = cpf.getMarginMW();
+    if (!nose || fabs(margin2-margin1) > 1.0e-6*(1.0+fabs(margin1))
+        || fabs(mw2-mw1) > 1.0e-6*(1.0+fabs(mw1))) {
+      if (me == 0) printf("Repeated solve gives different margin: %f (%f MW)"
+          " %f (%f MW)\n",margin1,mw1,margin2,mw2);
+      chk = 0;
+    }
+    if (me == 0) printf("Loading margin: %f (%f MW)\n",margin1,mw1);
+
+    world.min(&chk,1);
+    if (chk) {
+      if (me == 0) printf("\nContinuation power flow test passed\n");
+    } else {
+      if (me == 0) printf("\nContinuation power flow test failed\n");
+      ret = 1;
+    }
+  }
+
+  return ret;
+}
@@ -0,0 +1,175 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   pf_export_test.cpp
+ * @date   October 19, 2026
+ *
+ * @brief  Export a network in PSS/E v23, v33 and v34 format using MPI-IO
+ * and by gathering records on process 0 and check that both files contain
+ * the same data blocks. Records within a block are written in process order
+ * by MPI-IO and in global order otherwise, so the blocks are compared as
+ * sorted lists of lines. On a single process the files must be identical
+ */
+// -------------------------------------------------------------
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+#include "mpi.h"
+#include <ga.h>
+#include <macdecls.h>
+#include "gridpack/include/gridpack.hpp"
+#include "gridpack/export/PSSE34Export.hpp"
+#include "pf_app_module.hpp"
+
+/**
+ * Read a file and split it into data blocks. A block starts at each line
+ * that marks the beginning or end of a PSS/E data block
+ * @param filename name of file
+ * @param lines returns all lines in file
+ * @param blocks returns the lines in each block, sorted
+ * @return false if file could not be read
+ */
+bool readBlocks(const char *filename, std::vector<std::string> &lines,
+    std::vector<std::vector<std::string> > &blocks)
+{
+  std::ifstream fin(filename);
+  if (!fin.is_open()) {
+    printf("Unable to open %s\n",filename);
+    return false;
+  }
+  lines.clear();
+  blocks.clear();
+  blocks.resize(1);
+  std::string line;
+  while (std::getline(fin,line)) {
+    lines.push_back(line);
+    if (line.find("/ BEGIN") != std::string::npos
+        || line.find("/ END") != std::string::npos || line == "Q") {
+      blocks.push_back(std::vector<std::string>());
+    }
+    blocks.back().push_back(line);
+  }
+  int i;
+  for (i=0; i<blocks.size(); i++) {
+    std::sort(blocks[i].begin(),blocks[i].end());
+  }
+  return !lines.empty();
+}
+
+/**
+ * Compare files written with MPI-IO and by process 0
+ * @param mpiio name of file written with MPI-IO
+ * @param serial name of file written by process 0
+ * @param exact if true, files must be identical
+ * @return true if files agree
+ */
+bool compareFiles(const char *mpiio, const char *serial, bool exact)
+{
+  std::vector<std::string> l1, l2;
+  std::vector<std::vector<std::string> > b1, b2;
+  if (!readBlocks(mpiio,l1,b1) || !readBlocks(serial,l2,b2)) return false;
+  if (exact && l1 != l2) {
+    printf("%s and %s are not identical\n",mpiio,serial);
+    return false;
+  }
+  if (b1.size() != b2.size()) {
+    printf("%s has %d blocks and %s has %d blocks\n",mpiio,
+        static_cast<int>(b1.size()),serial,static_cast<int>(b2.size()));
+    return false;
+  }
+  int i;
+  for (i=0; i<b1.size(); i++) {
+    if (b1[i] != b2[i]) {
+      printf("Block %d of %s and %s differs\n",i,mpiio,serial);
+      return false;
+    }
+  }
+  return true;
+}
+
+int
+main(int argc, char **argv)
+{
+  gridpack::Environment env(argc,argv);
+  int ret = 0;
+
+  if (1) {
+    gridpack::parallel::Communicator world;
+    int me = world.rank();
+
+    // read configuration file
+    gridpack::utility::Configuration *config =
+      gridpack::utility::Configuration::configuration();
+    if (argc >= 2 && argv[1] != NULL) {
+      char inputfile[256];
+      sprintf(inputfile,"%s",argv[1]);
+      config->open(inputfile,world);
+    } else {
+      config->open("input_export.xml",world);
+    }
+
+    boost::shared_ptr<gridpack::powerflow::PFNetwork>
+      pf_network(new gridpack::powerflow::PFNetwork(world));
+    gridpack::powerflow::PFAppModule pf_app;
+    pf_app.suppressOutput(true);
+    pf_app.readNetwork(pf_network,config);
+    pf_app.initialize();
+
+    int chk = 1;
+    bool exact = (world.size() == 1);
+
+    gridpack::expnet::PSSE23Export<gridpack::powerflow::PFNetwork>
+      exprt23(pf_network);
+    exprt23.writeFile("export_mpiio_23.raw");
+    exprt23.setMPIIO(false);
+    exprt23.writeFile("export_serial_23.raw");
+
+    gridpack::expnet::PSSE33Export<gridpack::powerflow::PFNetwork>
+      exprt33(pf_network);
+    exprt33.writeFile("export_mpiio_33.raw");
+    exprt33.setMPIIO(false);
+    exprt33.writeFile("export_serial_33.raw");
+
+    gridpack::expnet::PSSE34Export<gridpack::powerflow::PFNetwork>
+      exprt34(pf_network);
+    exprt34.writeFile("export_mpiio_34.raw");
+    exprt34.setMPIIO(false);
+    exprt34.writeFile("export_serial_34.raw");
+    world.sync();
+
+    if (me == 0) {
+      if (compareFiles("export_mpiio_23.raw","export_serial_23.raw",exact)) {
+        printf("PSS/E v23 export OK\n");
+      } else {
+        chk = 0;
+      }
+      if (compareFiles("export_mpiio_33.raw","export_serial_33.raw",exact)) {
+        printf("PSS/E v33 export OK\n");
+      } else {
+        chk = 0;
+      }
+      if (compareFiles("export_mpiio_34.raw","export_serial_34.raw",exact)) {
+        printf("PSS/E v34 export OK\n");
+      } else {
+        chk = 0;
+      }
+    }
+
+    world.min(&chk,1);
+    if (chk) {
+      if (me == 0) printf("\nPSS/E export test passed\n");
+    } else {
+      if (me == 0) printf("\nPSS/E export test failed\n");
+      ret = 1;
+    }
+  }
+
+  return ret;
+}
@@ -0,0 +1,169 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   pf_kernel_test.cpp
+ * @date   October 19, 2026
+ *
+ * @brief  Compare the mismatch vector and Jacobian evaluated by PFKernel
+ * with the values assembled from the power flow components by
+ * BusVectorMap and FullMatrixMap, and check that the Newton-Raphson solver
+ * gives the same solution with and without the kernel
+ */
+// -------------------------------------------------------------
+
+#include <math.h>
+#include "mpi.h"
+#include <ga.h>
+#include <macdecls.h>
+#include "gridpack/include/gridpack.hpp"
+#include "pf_app_module.hpp"
+#include "pf_factory_module.hpp"
+#include "pf_kernel.hpp"
+
+/**
+ * Evaluate mismatches and Jacobian for the current network state using the
+ * components and the kernel and return the relative differences
+ * @param network power flow network
+ * @param factory factory for network
+ * @param fdiff relative difference of mismatch vectors
+ * @param jdiff relative difference of Jacobians
+ */
+void compareKernel(boost::shared_ptr<gridpack::powerflow::PFNetwork> network,
+    gridpack::powerflow::PFFactoryModule &factory, double *fdiff,
+    double *jdiff)
+{
+  factory.setYBus();
+  factory.setSBus();
+  factory.setMode(gridpack::powerflow::RHS);
+  gridpack::mapper::BusVectorMap<gridpack::powerflow::PFNetwork>
+    vMap(network);
+  boost::shared_ptr<gridpack::math::RealVector> F = vMap.mapToRealVector();
+  factory.setMode(gridpack::powerflow::Jacobian);
+  gridpack::mapper::FullMatrixMap<gridpack::powerflow::PFNetwork>
+    jMap(network);
+  boost::shared_ptr<gridpack::math::RealMatrix> J = jMap.mapToRealMatrix();
+
+  gridpack::powerflow::PFKernel kernel(network);
+  kernel.setup(jMap);
+  boost::shared_ptr<gridpack::math::RealVector> Fk(F->clone());
+  boost::shared_ptr<gridpack::math::RealMatrix> Jk(J->clone());
+  Fk->zero();
+  Jk->zero();
+  kernel.evaluate(*Fk, *Jk);
+
+  double fnorm = F->normInfinity();
+  Fk->add(*F,-1.0);
+  *fdiff = Fk->normInfinity()/(fnorm > 1.0 ? fnorm : 1.0);
+  double jnorm = J->norm2();
+  Jk->scale(-1.0);
+  Jk->add(*J);
+  *jdiff = Jk->norm2()/(jnorm > 1.0 ? jnorm : 1.0);
+}
+
+/**
+ * Get the voltage magnitudes and angles of all locally owned buses
+ * @param network power flow network
+ * @param v voltage magnitudes
+ * @param a voltage angles
+ */
+void getVoltages(boost::shared_ptr<gridpack::powerflow::PFNetwork> network,
+    std::vector<double> &v, std::vector<double> &a)
+{
+  int nbus = network->numBuses();
+  int i;
+  v.clear();
+  a.clear();
+  for (i=0; i<nbus; i++) {
+    if (!network->getActiveBus(i)) continue;
+    v.push_back(network->getBus(i)->getVoltage());
+    a.push_back(network->getBus(i)->getPhase());
+  }
+}
+
+int
+main(int argc, char **argv)
+{
+  gridpack::Environment env(argc,argv);
+  int ret = 0;
+
+  if (1) {
+    gridpack::parallel::Communicator world;
+    int me = world.rank();
+
+    // read configuration file
+    gridpack::utility::Configuration *config =
+      gridpack::utility::Configuration::configuration();
+    if (argc >= 2 && argv[1] != NULL) {
+      char inputfile[256];
+      sprintf(inputfile,"%s",argv[1]);
+      config->open(inputfile,world);
+    } else {
+      config->open("input_kernel.xml",world);
+    }
+
+    boost::shared_ptr<gridpack::powerflow::PFNetwork>
+      pf_network(new gridpack::powerflow::PFNetwork(world));
+    gridpack::powerflow::PFAppModule pf_app;
+    pf_app.suppressOutput(true);
+    pf_app.readNetwork(pf_network,config);
+    pf_app.initialize();
+    gridpack::powerflow::PFFactoryModule factory(pf_network);
+
+    int chk = 1;
+    double tol = 1.0e-10;
+    double fdiff, jdiff;
+
+    // Starting point from the network configuration file
+    compareKernel(pf_network, factory, &fdiff, &jdiff);
+    if (me == 0) printf("Initial state: mismatch difference %e Jacobian"
+        " difference %e\n",fdiff,jdiff);
+    if (!(fdiff < tol && jdiff < tol)) chk = 0;
+
+    // Solved state with loads increased, so that the mismatches are not
+    // zero and the angles are not flat
+    pf_app.solve();
+    std::vector<double> vref, aref;
+    getVoltages(pf_network, vref, aref);
+    pf_app.scaleLoadPower(1.2,1,0);
+    compareKernel(pf_network, factory, &fdiff, &jdiff);
+    if (me == 0) printf("Loaded state: mismatch difference %e Jacobian"
+        " difference %e\n",fdiff,jdiff);
+    if (!(fdiff < tol && jdiff < tol)) chk = 0;
+    pf_app.scaleLoadPower(1.0/1.2,1,0);
+
+    // Solve again with the kernel. FusedKernel is set in the input file, so
+    // the kernel is used by solve between beginScenarios and endScenarios
+    pf_app.resetVoltages();
+    pf_app.beginScenarios();
+    if (!pf_app.solve()) {
+      if (me == 0) printf("Power flow with kernel did not converge\n");
+      chk = 0;
+    }
+    pf_app.endScenarios();
+    std::vector<double> v, a;
+    getVoltages(pf_network, v, a);
+    double vdiff = 0.0;
+    int i;
+    for (i=0; i<v.size(); i++) {
+      if (fabs(v[i]-vref[i]) > vdiff) vdiff = fabs(v[i]-vref[i]);
+      if (fabs(a[i]-aref[i]) > vdiff) vdiff = fabs(a[i]-aref[i]);
+    }
+    world.max(&vdiff,1);
+    if (me == 0) printf("Maximum difference of solutions: %e\n",vdiff);
+    if (!(vdiff < 1.0e-5)) chk = 0;
+
+    world.min(&chk,1);
+    if (chk) {
+      if (me == 0) printf("\nPower flow kernel test passed\n");
+    } else {
+      if (me == 0) printf("\nPower flow kernel test failed\n");
+      ret = 1;
+    }
+  }
+
+  return ret;
+}
@@ -0,0 +1,178 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   pf_scenario_test.cpp
+ * @date   October 19, 2026
+ *
+ * @brief  Solve a batch of load and generation scenarios with
+ * solveScenarios and compare each solution with an independent power flow
+ * calculation on the same network. Also check that the callback is called
+ * for every scenario and that the original loads are restored
+ */
+// -------------------------------------------------------------
+
+#include <math.h>
+#include "mpi.h"
+#include <ga.h>
+#include <macdecls.h>
+#include "gridpack/include/gridpack.hpp"
+#include "pf_app_module.hpp"
+
+/**
+ * Get the voltage magnitudes and angles of all locally owned buses
+ * @param network power flow network
+ * @param v voltage magnitudes
+ * @param a voltage angles
+ */
+void getVoltages(boost::shared_ptr<gridpack::powerflow::PFNetwork> network,
+    std::vector<double> &v, std::vector<double> &a)
+{
+  int nbus = network->numBuses();
+  int i;
+  v.clear();
+  a.clear();
+  for (i=0; i<nbus; i++) {
+    if (!network->getActiveBus(i)) continue;
+    v.push_back(network->getBus(i)->getVoltage());
+    a.push_back(network->getBus(i)->getPhase());
+  }
+}
+
+// Callback for solveScenarios that stores the solution of each scenario
+struct StoreVoltages
+{
+  boost::shared_ptr<gridpack::powerflow::PFNetwork> network;
+  std::vector<std::vector<double> > *v;
+  std::vector<std::vector<double> > *a;
+  std::vector<int> *order;
+
+  void operator()(int idx)
+  {
+    getVoltages(network, (*v)[idx], (*a)[idx]);
+    order->push_back(idx);
+  }
+};
+
+int
+main(int argc, char **argv)
+{
+  gridpack::Environment env(argc,argv);
+  int ret = 0;
+
+  if (1) {
+    gridpack::parallel::Communicator world;
+    int me = world.rank();
+
+    // read configuration file
+    gridpack::utility::Configuration *config =
+      gridpack::utility::Configuration::configuration();
+    if (argc >= 2 && argv[1] != NULL) {
+      char inputfile[256];
+      sprintf(inputfile,"%s",argv[1]);
+      config->open(inputfile,world);
+    } else {
+      config->open("input_scenarios.xml",world);
+    }
+
+    boost::shared_ptr<gridpack::powerflow::PFNetwork>
+      pf_network(new gridpack::powerflow::PFNetwork(world));
+    gridpack::powerflow::PFAppModule pf_app;
+    pf_app.suppressOutput(true);
+    pf_app.readNetwork(pf_network,config);
+    pf_app.initialize();
+
+    int chk = 1;
+    int i, j;
+    double load0 = pf_app.getTotalLoadRealPower(1,0);
+
+    // Scenarios are not in monotonic order, so that some scenarios start
+    // from a solution that is not close to their own
+    double lscale[] = {1.0, 1.1, 1.2, 0.9, 1.15};
+    double gscale[] = {0.0, 0.2, 0.4, -0.2, 0.3};
+    int nscen = sizeof(lscale)/sizeof(double);
+    std::vector<gridpack::powerflow::PFScenario> scenarios(nscen);
+    for (i=0; i<nscen; i++) {
+      scenarios[i].load_scale = lscale[i];
+      scenarios[i].load_area = 1;
+      scenarios[i].load_zone = 0;
+      scenarios[i].gen_scale = gscale[i];
+      scenarios[i].gen_area = 1;
+      scenarios[i].gen_zone = 0;
+    }
+
+    std::vector<std::vector<double> > vscen(nscen), ascen(nscen);
+    std::vector<int> order;
+    StoreVoltages store;
+    store.network = pf_network;
+    store.v = &vscen;
+    store.a = &ascen;
+    store.order = &order;
+    std::vector<bool> converged;
+    if (!pf_app.solveScenarios(scenarios, converged, store)) {
+      if (me == 0) printf("Not all scenarios converged\n");
+      chk = 0;
+    }
+    if (order.size() != nscen) {
+      printf("p[%d] Callback called %d times for %d scenarios\n",me,
+          static_cast<int>(order.size()),nscen);
+      chk = 0;
+    } else {
+      for (i=0; i<nscen; i++) {
+        if (order[i] != i) {
+          printf("p[%d] Callback for scenario %d called out of order\n",
+              me,order[i]);
+          chk = 0;
+        }
+      }
+    }
+    double load1 = pf_app.getTotalLoadRealPower(1,0);
+    if (fabs(load1-load0) > 1.0e-10*fabs(load0)) {
+      if (me == 0) printf("Loads not restored: %f original: %f\n",
+          load1,load0);
+      chk = 0;
+    }
+
+    // Solve each scenario independently from the original voltages
+    for (i=0; i<nscen; i++) {
+      pf_app.resetPower();
+      pf_app.scaleLoadPower(lscale[i],1,0);
+      pf_app.scaleGeneratorRealPower(gscale[i],1,0);
+      pf_app.resetVoltages();
+      bool ok = pf_app.solve();
+      if (ok != converged[i]) {
+        if (me == 0) printf("Scenario %d convergence differs\n",i);
+        chk = 0;
+      }
+      std::vector<double> v, a;
+      getVoltages(pf_network, v, a);
+      double vdiff = 0.0;
+      if (v.size() != vscen[i].size()) {
+        vdiff = 1.0;
+      } else {
+        for (j=0; j<v.size(); j++) {
+          if (fabs(v[j]-vscen[i][j]) > vdiff) vdiff = fabs(v[j]-vscen[i][j]);
+          if (fabs(a[j]-ascen[i][j]) > vdiff) vdiff = fabs(a[j]-ascen[i][j]);
+        }
+      }
+      world.max(&vdiff,1);
+      if (me == 0) printf("Scenario %d load scale %f generation scale %f"
+          " maximum difference: %e\n",i,lscale[i],gscale[i],vdiff);
+      if (!(vdiff < 1.0e-5)) chk = 0;
+    }
+    pf_app.resetPower();
+
+    world.min(&chk,1);
+    if (chk) {
+      if (me == 0) printf("\nPower flow scenario test passed\n");
+    } else {
+      if (me == 0) printf("\nPower flow scenario test failed\n");
+      ret = 1;
+    }
+  }
+
+  return ret;
+}
@@ -0,0 +1,563 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   ss_analysis.cpp
+ * @date   October 19, 2026
+ *
+ * @brief
+ *
+ *
+ */
+// -------------------------------------------------------------
+
+#include <math.h>
+#include <stdio.h>
+#include <algorithm>
+#include "gridpack/utilities/string_utils.hpp"
+#include "gridpack/math/complex_lapack.hpp"
+#include "ss_analysis.hpp"
+
+// time increment used to evaluate state derivatives with the model
+// predictors
+#define SS_TIME_INCREMENT 1.0e-3
+
+namespace {
+
+/**
+ * Copy the locally held elements of a vector to an array
+ */
+void getLocal(gridpack::math::Vector &v,
+    std::vector<gridpack::ComplexType> &a)
+{
+  int lo, hi;
+  v.localIndexRange(lo,hi);
+  a.resize(hi-lo);
+  gridpack::ComplexType *ptr = v.getLocalElements();
+  int i;
+  for (i=0; i<hi-lo; i++) a[i] = ptr[i];
+  v.releaseLocalElements(ptr);
+}
+
+/**
+ * Copy an array to the locally held elements of a vector
+ */
+void setLocal(gridpack::math::Vector &v,
+    const std::vector<gridpack::ComplexType> &a)
+{
+  int lo, hi;
+  v.localIndexRange(lo,hi);
+  gridpack::ComplexType *ptr = v.getLocalElements();
+  int i;
+  for (i=0; i<hi-lo; i++) ptr[i] = a[i];
+  v.releaseLocalElements(ptr);
+}
+
+const char *deviceNames[] = {"machine", "exciter", "governor", "stabilizer"};
+
+}
+
+/**
+ * Basic constructor
+ * @param network dynamic simulation network. Generator parameters must
+ *        have been read in
+ */
+gridpack::small_signal::SmallSignalAnalysis::SmallSignalAnalysis(
+    boost::shared_ptr<gridpack::dynamic_simulation::DSFullNetwork> network)
+  : p_network(network), p_comm(network->communicator())
+{
+  p_targets.push_back(0.5);
+  p_targets.push_back(1.5);
+  p_realPart = 0.0;
+  p_nev = 6;
+  p_krylov = 40;
+  p_tolerance = 1.0e-8;
+  p_delta = 1.0e-6;
+  p_threshold = 0.1;
+}
+
+/**
+ * Basic destructor
+ */
+gridpack::small_signal::SmallSignalAnalysis::~SmallSignalAnalysis()
+{
+}
+
+/**
+ * Read parameters from the small signal block of the input file
+ * @param cursor pointer to small signal block
+ */
+void gridpack::small_signal::SmallSignalAnalysis::configure(
+    gridpack::utility::Configuration::CursorPtr cursor)
+{
+  if (cursor == NULL) return;
+  p_cursor = cursor;
+  gridpack::utility::StringUtils util;
+  std::string list;
+  std::vector<std::string> tokens;
+  int i;
+  list = cursor->get("targetFrequencies","");
+  tokens = util.blankTokenizer(list);
+  if (tokens.size() > 0) {
+    p_targets.clear();
+    for (i=0; i<tokens.size(); i++) p_targets.push_back(atof(tokens[i].c_str()));
+  }
+  p_realPart = cursor->get("targetRealPart",0.0);
+  p_nev = cursor->get("numEigenvalues",6);
+  p_krylov = cursor->get("krylovDimension",40);
+  p_tolerance = cursor->get("tolerance",1.0e-8);
+  p_delta = cursor->get("perturbation",1.0e-6);
+  p_threshold = cursor->get("participationThreshold",0.1);
+}
+
+/**
+ * Set the frequencies around which modes are computed
+ * @param freq list of frequencies (Hz)
+ */
+void gridpack::small_signal::SmallSignalAnalysis::setTargetFrequencies(
+    const std::vector<double> &freq)
+{
+  p_targets = freq;
+}
+
+/**
+ * Set the number of modes computed for each target frequency
+ * @param nev number of modes
+ */
+void gridpack::small_signal::SmallSignalAnalysis::setNumEigenvalues(int nev)
+{
+  p_nev = nev;
+}
+
+/**
+ * Linearize the system at the initial operating point and compute the
+ * modes closest to the target frequencies
+ * @param app dynamic simulation application
+ */
+void gridpack::small_signal::SmallSignalAnalysis::analyze(
+    gridpack::dynamic_simulation::DSFullApp &app)
+{
+  // initialize the dynamic models and the Y-matrix without a disturbance
+  gridpack::dynamic_simulation::Event event;
+  event.start = app.getFinalTime();
+  event.end = app.getFinalTime();
+  app.solvePreInitialize(event);
+
+  // linearize models on all buses, including ghost buses, so that block
+  // sizes are known everywhere. Details of models that could not be
+  // linearized are only printed for active buses on the first processor,
+  // the other buses are included in the summary
+  int nbus = p_network->numBuses();
+  int i;
+  int nfail = 0;
+  for (i=0; i<nbus; i++) {
+    bool active = p_network->getActiveBus(i);
+    bool ok = p_network->getBus(i)->linearize(p_delta,SS_TIME_INCREMENT,
+        active && p_comm.rank() == 0);
+    if (!ok && active) nfail++;
+  }
+  p_comm.sum(&nfail,1);
+  if (nfail > 0 && p_comm.rank() == 0) {
+    printf("Warning: models on %d buses are only partially linearized\n",
+        nfail);
+  }
+
+  gridpack::dynamic_simulation::DSFullFactory factory(p_network);
+  factory.setMode(gridpack::dynamic_simulation::SMALL_SIGNAL);
+  p_vecMap.reset(new gridpack::mapper::BusVectorMap<
+      gridpack::dynamic_simulation::DSFullNetwork>(p_network));
+  p_mask = p_vecMap->mapToVector();
+  p_matMap.reset(new gridpack::mapper::FullMatrixMap<
+      gridpack::dynamic_simulation::DSFullNetwork>(p_network));
+  p_matrix.reset();
+
+  p_lambda.clear();
+  p_residual.clear();
+  p_evec.clear();
+  double pi = 4.0*atan(1.0);
+  for (i=0; i<p_targets.size(); i++) {
+    arnoldi(gridpack::ComplexType(p_realPart,2.0*pi*p_targets[i]));
+  }
+
+  p_partBus.resize(p_lambda.size());
+  p_partTag.resize(p_lambda.size());
+  p_partState.resize(p_lambda.size());
+  p_partFactor.resize(p_lambda.size());
+  for (i=0; i<p_lambda.size(); i++) participation(i);
+}
+
+/**
+ * @return number of computed modes
+ */
+int gridpack::small_signal::SmallSignalAnalysis::numEigenvalues() const
+{
+  return p_lambda.size();
+}
+
+/**
+ * @param idx index of mode
+ * @return eigenvalue (1/s)
+ */
+gridpack::ComplexType gridpack::small_signal::SmallSignalAnalysis::getEigenvalue(
+    int idx) const
+{
+  return p_lambda[idx];
+}
+
+/**
+ * @param idx index of mode
+ * @return frequency of mode (Hz)
+ */
+double gridpack::small_signal::SmallSignalAnalysis::getFrequency(int idx) const
+{
+  double pi = 4.0*atan(1.0);
+  return fabs(imag(p_lambda[idx]))/(2.0*pi);
+}
+
+/**
+ * @param idx index of mode
+ * @return damping ratio of mode
+ */
+double gridpack::small_signal::SmallSignalAnalysis::getDamping(int idx) const
+{
+  double mag = abs(p_lambda[idx]);
+  if (mag == 0.0) return 0.0;
+  return -real(p_lambda[idx])/mag;
+}
+
+/**
+ * @param idx index of mode
+ * @return residual of mode
+ */
+double gridpack::small_signal::SmallSignalAnalysis::getResidual(int idx) const
+{
+  return p_residual[idx];
+}
+
+/**
+ * Get states that participate in a mode
+ * @param idx index of mode
+ * @param buses original indices of buses
+ * @param tags generator IDs
+ * @param states labels of states
+ * @param factors participation factors
+ */
+void gridpack::small_signal::SmallSignalAnalysis::getParticipation(int idx,
+    std::vector<int> &buses, std::vector<std::string> &tags,
+    std::vector<std::string> &states, std::vector<double> &factors) const
+{
+  buses = p_partBus[idx];
+  tags = p_partTag[idx];
+  states = p_partState[idx];
+  factors = p_partFactor[idx];
+}
+
+/**
+ * Write the computed modes and their participation factors to standard
+ * output
+ */
+void gridpack::small_signal::SmallSignalAnalysis::write() const
+{
+  if (p_comm.rank() != 0) return;
+  int i, j;
+  printf("\nSmall signal analysis: %d modes\n\n",
+      static_cast<int>(p_lambda.size()));
+  printf("  Mode     Real part     Imag part  Freq (Hz)  Damping (%%)"
+      "    Residual\n");
+  for (i=0; i<p_lambda.size(); i++) {
+    printf("  %4d  %12.6f  %12.6f  %9.4f  %11.3f  %10.3e\n",i+1,
+        real(p_lambda[i]),imag(p_lambda[i]),getFrequency(i),
+        100.0*getDamping(i),p_residual[i]);
+  }
+  for (i=0; i<p_lambda.size(); i++) {
+    printf("\nParticipation factors for mode %d\n",i+1);
+    for (j=0; j<p_partBus[i].size(); j++) {
+      printf("    bus %8d  gen %2s  %-16s  %8.4f\n",p_partBus[i][j],
+          p_partTag[i][j].c_str(),p_partState[i][j].c_str(),
+          p_partFactor[i][j]);
+    }
+  }
+}
+
+/**
+ * Apply the shift-and-invert operator y = (J-sE)^-1 E x
+ * @param x input vector
+ * @param y output vector
+ */
+void gridpack::small_signal::SmallSignalAnalysis::applyOperator(
+    const gridpack::math::Vector &x, gridpack::math::Vector &y)
+{
+  boost::shared_ptr<gridpack::math::Vector> b(x.clone());
+  b->elementMultiply(*p_mask);
+  p_solver->solve(*b,y);
+}
+
+/**
+ * Compute modes closest to a shift and add them to the list of modes
+ * @param shift shift s
+ */
+void gridpack::small_signal::SmallSignalAnalysis::arnoldi(
+    gridpack::ComplexType shift)
+{
+  setShift(shift);
+  int lo, hi;
+  p_mask->localIndexRange(lo,hi);
+  int nloc = hi-lo;
+  int i, j, l, pass;
+
+  // the number of states bounds the number of finite eigenvalues
+  std::vector<gridpack::ComplexType> mask;
+  getLocal(*p_mask,mask);
+  double nstate = 0.0;
+  for (i=0; i<nloc; i++) nstate += real(mask[i]);
+  p_comm.sum(&nstate,1);
+  int m = p_krylov;
+  if (m > static_cast<int>(nstate)) m = static_cast<int>(nstate);
+  if (m < 1) return;
+
+  // starting vector is the image of a perturbed mask under the operator,
+  // which removes components along the infinite eigenvalues
+  boost::shared_ptr<gridpack::math::Vector> x(p_mask->clone());
+  boost::shared_ptr<gridpack::math::Vector> y(p_mask->clone());
+  std::vector<gridpack::ComplexType> w(nloc);
+  for (i=0; i<nloc; i++) w[i] = mask[i]*(1.0+0.1*sin(static_cast<double>(lo+i)));
+  setLocal(*x,w);
+  applyOperator(*x,*y);
+  std::vector<std::vector<gridpack::ComplexType> > V(m+1);
+  getLocal(*y,V[0]);
+  double norm = sqrt(real(dot(V[0],V[0])));
+  for (i=0; i<nloc; i++) V[0][i] /= norm;
+
+  // Arnoldi iteration with classical Gram-Schmidt, repeated once for
+  // stability. H is stored in column-major order
+  int ldh = m+1;
+  std::vector<gridpack::ComplexType> H(ldh*m,0.0);
+  std::vector<gridpack::ComplexType> h(m+1);
+  int k = m;
+  double beta = 0.0;
+  for (j=0; j<m; j++) {
+    setLocal(*x,V[j]);
+    applyOperator(*x,*y);
+    getLocal(*y,w);
+    double wnorm = sqrt(real(dot(w,w)));
+    for (pass=0; pass<2; pass++) {
+      for (l=0; l<=j; l++) {
+        h[l] = 0.0;
+        for (i=0; i<nloc; i++) h[l] += conj(V[l][i])*w[i];
+      }
+      p_comm.sum(&h[0],j+1);
+      for (l=0; l<=j; l++) {
+        H[j*ldh+l] += h[l];
+        for (i=0; i<nloc; i++) w[i] -= h[l]*V[l][i];
+      }
+    }
+    beta = sqrt(real(dot(w,w)));
+    H[j*ldh+j+1] = beta;
+    if (beta <= 1.0e-12*wnorm) {
+      // invariant subspace found
+      k = j+1;
+      beta = 0.0;
+      break;
+    }
+    V[j+1].resize(nloc);
+    for (i=0; i<nloc; i++) V[j+1][i] = w[i]/beta;
+  }
+
+  // Ritz values and vectors from the k x k Hessenberg matrix. All
+  // processors hold the same matrix and compute the same values
+  std::vector<gridpack::ComplexType> Hk(k*k), nu(k), vr(k*k), vl(1);
+  for (j=0; j<k; j++) {
+    for (i=0; i<k; i++) Hk[j*k+i] = H[j*ldh+i];
+  }
+  gridpack::math::LapackInt nk = k;
+  gridpack::math::LapackInt lwork = 4*k;
+  gridpack::math::LapackInt one = 1;
+  gridpack::math::LapackInt info;
+  std::vector<gridpack::ComplexType> work(lwork);
+  std::vector<double> rwork(2*k);
+  zgeev_("N","V",&nk,&Hk[0],&nk,&nu[0],&vl[0],&one,&vr[0],&nk,&work[0],
+      &lwork,&rwork[0],&info);
+  if (info != 0) {
+    if (p_comm.rank() == 0) {
+      printf("Warning: eigenvalues of Hessenberg matrix not found"
+          " (info = %d)\n",info);
+    }
+    return;
+  }
+
+  // keep Ritz values with the largest magnitude, these correspond to the
+  // eigenvalues closest to the shift
+  std::vector<std::pair<double,int> > order;
+  for (i=0; i<k; i++) order.push_back(std::pair<double,int>(-abs(nu[i]),i));
+  std::sort(order.begin(),order.end());
+  int nfound = 0;
+  for (l=0; l<k && nfound<p_nev; l++) {
+    int ir = order[l].second;
+    if (abs(nu[ir]) < 1.0e-14) break;
+    gridpack::ComplexType lambda = shift + 1.0/nu[ir];
+    bool dup = false;
+    for (i=0; i<p_lambda.size(); i++) {
+      double scale = std::max(1.0,abs(lambda));
+      if (abs(p_lambda[i]-lambda) < 1.0e-6*scale) dup = true;
+    }
+    nfound++;
+    if (dup) continue;
+    std::vector<gridpack::ComplexType> u(nloc,0.0);
+    for (j=0; j<k; j++) {
+      for (i=0; i<nloc; i++) u[i] += vr[ir*k+j]*V[j][i];
+    }
+    norm = sqrt(real(dot(u,u)));
+    for (i=0; i<nloc; i++) u[i] /= norm;
+    p_lambda.push_back(lambda);
+    p_residual.push_back(beta*abs(vr[ir*k+k-1])/abs(nu[ir]));
+    p_evec.push_back(u);
+  }
+}
+
+/**
+ * Compute the participation factors of a mode
+ * @param idx index of mode
+ */
+void gridpack::small_signal::SmallSignalAnalysis::participation(int idx)
+{
+  // left eigenvector from inverse iteration with (J-lambda E)^T
+  setShift(p_lambda[idx]);
+  boost::shared_ptr<gridpack::math::Matrix>
+    trans(gridpack::math::transpose(*p_matrix));
+  gridpack::math::LinearSolver solver(*trans);
+  if (p_cursor != NULL) solver.configure(p_cursor);
+  boost::shared_ptr<gridpack::math::Vector> w(p_mask->clone());
+  boost::shared_ptr<gridpack::math::Vector> b(p_mask->clone());
+  int it;
+  for (it=0; it<2; it++) {
+    b->equate(*w);
+    b->elementMultiply(*p_mask);
+    solver.solve(*b,*w);
+    w->scale(1.0/w->norm2());
+  }
+
+  // participation of state k is |w_k v_k|, normalized by the largest value
+  std::vector<gridpack::ComplexType> wloc, mask;
+  getLocal(*w,wloc);
+  getLocal(*p_mask,mask);
+  int i, j;
+  int nloc = wloc.size();
+  double pmax = 0.0;
+  for (i=0; i<nloc; i++) {
+    wloc[i] = abs(wloc[i]*p_evec[idx][i])*mask[i];
+    if (real(wloc[i]) > pmax) pmax = real(wloc[i]);
+  }
+  p_comm.max(&pmax,1);
+  if (pmax == 0.0) pmax = 1.0;
+  setLocal(*w,wloc);
+  p_vecMap->mapToBus(*w);
+
+  // collect states above threshold on locally owned buses
+  std::vector<int> lbus, lgen, ldev, lstate;
+  std::vector<double> lfactor;
+  std::vector<std::string> ltag;
+  int nbus = p_network->numBuses();
+  std::vector<gridpack::ComplexType> vals;
+  for (i=0; i<nbus; i++) {
+    if (!p_network->getActiveBus(i)) continue;
+    gridpack::dynamic_simulation::DSFullBus *bus = p_network->getBus(i).get();
+    int ns = bus->numSmallSignalStates();
+    if (ns == 0) continue;
+    vals.resize(ns+2);
+    bus->getSmallSignalVector(&vals[0]);
+    std::vector<std::string> ids = bus->getGenerators();
+    for (j=0; j<ns; j++) {
+      double f = real(vals[j])/pmax;
+      if (f < p_threshold) continue;
+      int gen, dev, st;
+      bus->getSmallSignalState(j,&gen,&dev,&st);
+      lbus.push_back(bus->getOriginalIndex());
+      ltag.push_back(gen < ids.size() ? ids[gen] : std::string(""));
+      ldev.push_back(dev);
+      lstate.push_back(st);
+      lfactor.push_back(f);
+    }
+  }
+
+  // replicate on all processors. Tags are packed as two characters
+  int nproc = p_comm.size();
+  int me = p_comm.rank();
+  std::vector<int> counts(nproc,0);
+  counts[me] = lbus.size();
+  p_comm.sum(&counts[0],nproc);
+  int offset = 0;
+  int ntot = 0;
+  for (i=0; i<nproc; i++) {
+    if (i < me) offset += counts[i];
+    ntot += counts[i];
+  }
+  std::vector<int> ibuf(5*ntot+1,0);
+  std::vector<double> fbuf(ntot+1,0.0);
+  for (i=0; i<lbus.size(); i++) {
+    int *ptr = &ibuf[5*(offset+i)];
+    ptr[0] = lbus[i];
+    ptr[1] = ldev[i];
+    ptr[2] = lstate[i];
+    ptr[3] = ltag[i].size() > 0 ? static_cast<int>(ltag[i][0]) : 0;
+    ptr[4] = ltag[i].size() > 1 ? static_cast<int>(ltag[i][1]) : 0;
+    fbuf[offset+i] = lfactor[i];
+  }
+  p_comm.sum(&ibuf[0],5*ntot+1);
+  p_comm.sum(&fbuf[0],ntot+1);
+
+  std::vector<std::pair<double,int> > order;
+  for (i=0; i<ntot; i++) order.push_back(std::pair<double,int>(-fbuf[i],i));
+  std::sort(order.begin(),order.end());
+  p_partBus[idx].clear();
+  p_partTag[idx].clear();
+  p_partState[idx].clear();
+  p_partFactor[idx].clear();
+  char buf[64];
+  for (i=0; i<ntot; i++) {
+    int *ptr = &ibuf[5*order[i].second];
+    std::string tag;
+    if (ptr[3] != 0) tag.push_back(static_cast<char>(ptr[3]));
+    if (ptr[4] != 0) tag.push_back(static_cast<char>(ptr[4]));
+    sprintf(buf,"%s.%d",deviceNames[ptr[1]],ptr[2]);
+    p_partBus[idx].push_back(ptr[0]);
+    p_partTag[idx].push_back(tag);
+    p_partState[idx].push_back(std::string(buf));
+    p_partFactor[idx].push_back(fbuf[order[i].second]);
+  }
+}
+
+/**
+ * Set the shift on all buses and map J-sE to a matrix
+ * @param shift shift s
+ */
+void gridpack::small_signal::SmallSignalAnalysis::setShift(
+    gridpack::ComplexType shift)
+{
+  int nbus = p_network->numBuses();
+  int i;
+  for (i=0; i<nbus; i++) p_network->getBus(i)->setSmallSignalShift(shift);
+  if (!p_matrix) {
+    p_matrix = p_matMap->mapToMatrix();
+  } else {
+    p_matMap->mapToMatrix(p_matrix);
+  }
+  p_solver.reset(new gridpack::math::LinearSolver(*p_matrix));
+  if (p_cursor != NULL) p_solver->configure(p_cursor);
+}
+
+/**
+ * Global inner product x^H y of two vectors
+ */
+gridpack::ComplexType gridpack::small_signal::SmallSignalAnalysis::dot(
+    const std::vector<gridpack::ComplexType> &x,
+    const std::vector<gridpack::ComplexType> &y) const
+{
+  gridpack::ComplexType ret(0.0,0.0);
+  int i;
+  for (i=0; i<x.size(); i++) ret += conj(x[i])*y[i];
+  p_comm.sum(&ret,1);
+  return ret;
+}
@@ -0,0 +1,215 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   ss_analysis.hpp
+ * @date   October 19, 2026
+ *
+ * @brief  Small signal stability analysis of the full-Y dynamic simulation
+ * network. The dynamic models are linearized around the initial operating
+ * point and the electromechanical modes closest to a set of target
+ * frequencies are found from the sparse descriptor system
+ *
+ *   E dx/dt = J x,   J = [A B; C D-Y]
+ *
+ * where x contains the model states and the real and imaginary parts of
+ * the bus voltages. Eigenvalues near each shift s are computed by Arnoldi
+ * iteration on the shift-and-invert operator (J-sE)^-1 E, so only sparse
+ * factorizations of J-sE are needed. Left eigenvectors are obtained by
+ * inverse iteration and are used to compute participation factors.
+ */
+// -------------------------------------------------------------
+
+#ifndef _ss_analysis_h_
+#define _ss_analysis_h_
+
+#include <vector>
+#include <string>
+#include "boost/smart_ptr/shared_ptr.hpp"
+#include "gridpack/parallel/communicator.hpp"
+#include "gridpack/configuration/configuration.hpp"
+#include "gridpack/math/vector.hpp"
+#include "gridpack/applications/modules/dynamic_simulation_full_y/dsf_app_module.hpp"
+
+namespace gridpack {
+namespace small_signal {
+
+class SmallSignalAnalysis
+{
+  public:
+
+    /**
+     * Basic constructor
+     * @param network dynamic simulation network. Generator parameters must
+     *        have been read in
+     */
+    SmallSignalAnalysis(
+        boost::shared_ptr<gridpack::dynamic_simulation::DSFullNetwork> network);
+
+    /**
+     * Basic destructor
+     */
+    ~SmallSignalAnalysis();
+
+    /**
+     * Read parameters from the small signal block of the input file. The
+     * block can contain
+     *   targetFrequencies:      list of frequencies (Hz) around which
+     *                           modes are computed
+     *   targetRealPart:         real part (1/s) of the shifts
+     *   numEigenvalues:         number of modes computed for each target
+     *   krylovDimension:        size of the Arnoldi basis
+     *   tolerance:              maximum residual of accepted modes
+     *   perturbation:           perturbation used to linearize the models
+     *   participationThreshold: smallest reported participation factor,
+     *                           relative to the largest one
+     *   LinearSolver:           solver block used to factor J-sE
+     * @param cursor pointer to small signal block
+     */
+    void configure(gridpack::utility::Configuration::CursorPtr cursor);
+
+    /**
+     * Set the frequencies around which modes are computed
+     * @param freq list of frequencies (Hz)
+     */
+    void setTargetFrequencies(const std::vector<double> &freq);
+
+    /**
+     * Set the number of modes computed for each target frequency
+     * @param nev number of modes
+     */
+    void setNumEigenvalues(int nev);
+
+    /**
+     * Linearize the system at the initial operating point and compute the
+     * modes closest to the target frequencies. The application must have
+     * been initialized on the network passed to the constructor. This is
+     * a collective operation
+     * @param app dynamic simulation application
+     */
+    void analyze(gridpack::dynamic_simulation::DSFullApp &app);
+
+    /**
+     * @return number of computed modes
+     */
+    int numEigenvalues() const;
+
+    /**
+     * @param idx index of mode
+     * @return eigenvalue (1/s)
+     */
+    gridpack::ComplexType getEigenvalue(int idx) const;
+
+    /**
+     * @param idx index of mode
+     * @return frequency of mode (Hz)
+     */
+    double getFrequency(int idx) const;
+
+    /**
+     * @param idx index of mode
+     * @return damping ratio of mode
+     */
+    double getDamping(int idx) const;
+
+    /**
+     * @param idx index of mode
+     * @return residual of mode, relative to the magnitude of the eigenvalue
+     *         of the shift-and-invert operator
+     */
+    double getResidual(int idx) const;
+
+    /**
+     * Get states that participate in a mode. Only states with a
+     * participation factor above the threshold are listed. Results are
+     * replicated on all processors
+     * @param idx index of mode
+     * @param buses original indices of buses
+     * @param tags generator IDs
+     * @param states labels of states
+     * @param factors participation factors, normalized so that the largest
+     *        factor is 1
+     */
+    void getParticipation(int idx, std::vector<int> &buses,
+        std::vector<std::string> &tags, std::vector<std::string> &states,
+        std::vector<double> &factors) const;
+
+    /**
+     * Write the computed modes and their participation factors to standard
+     * output
+     */
+    void write() const;
+
+  private:
+
+    /**
+     * Apply the shift-and-invert operator y = (J-sE)^-1 E x
+     * @param x input vector
+     * @param y output vector
+     */
+    void applyOperator(const gridpack::math::Vector &x,
+        gridpack::math::Vector &y);
+
+    /**
+     * Compute modes closest to a shift and add them to the list of modes
+     * @param shift shift s
+     */
+    void arnoldi(gridpack::ComplexType shift);
+
+    /**
+     * Compute the participation factors of a mode
+     * @param idx index of mode
+     */
+    void participation(int idx);
+
+    /**
+     * Set the shift on all buses and map J-sE to a matrix
+     * @param shift shift s
+     */
+    void setShift(gridpack::ComplexType shift);
+
+    /**
+     * Global inner product x^H y of two vectors
+     */
+    gridpack::ComplexType dot(const std::vector<gridpack::ComplexType> &x,
+        const std::vector<gridpack::ComplexType> &y) const;
+
+    boost::shared_ptr<gridpack::dynamic_simulation::DSFullNetwork> p_network;
+    gridpack::parallel::Communicator p_comm;
+    gridpack::utility::Configuration::CursorPtr p_cursor;
+
+    // options
+    std::vector<double> p_targets;
+    double p_realPart;
+    int p_nev;
+    int p_krylov;
+    double p_tolerance;
+    double p_delta;
+    double p_threshold;
+
+    // mappers and matrices for the current shift
+    boost::shared_ptr<gridpack::mapper::FullMatrixMap<
+      gridpack::dynamic_simulation::DSFullNetwork> > p_matMap;
+    boost::shared_ptr<gridpack::mapper::BusVectorMap<
+      gridpack::dynamic_simulation::DSFullNetwork> > p_vecMap;
+    boost::shared_ptr<gridpack::math::Matrix> p_matrix;
+    boost::shared_ptr<gridpack::math::LinearSolver> p_solver;
+    boost::shared_ptr<gridpack::math::Vector> p_mask;
+
+    // computed modes. Right eigenvectors are distributed like p_mask,
+    // participation data is replicated
+    std::vector<gridpack::ComplexType> p_lambda;
+    std::vector<double> p_residual;
+    std::vector<std::vector<gridpack::ComplexType> > p_evec;
+    std::vector<std::vector<int> > p_partBus;
+    std::vector<std::vector<std::string> > p_partTag;
+    std::vector<std::vector<std::string> > p_partState;
+    std::vector<std::vector<double> > p_partFactor;
+};
+
+} // small_signal
+} // gridpack
+#endif
@@ -0,0 +1,123 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   ss_test.cpp
+ * @date   October 19, 2026
+ *
+ * @brief  Compute electromechanical modes of a system with classical
+ * generator models. If the input file gives a reference frequency, check
+ * that an undamped mode with this frequency is found, otherwise check that
+ * all modes near the target frequencies converge and are stable. Run as
+ * "ss_test input.xml" (IEEE 145 bus system) or "ss_test input_2m.xml"
+ * (two machine system with an analytic mode)
+ */
+// -------------------------------------------------------------
+
+#include "mpi.h"
+#include <ga.h>
+#include <macdecls.h>
+#include "gridpack/include/gridpack.hpp"
+#include "gridpack/applications/modules/powerflow/pf_app_module.hpp"
+#include "gridpack/applications/modules/dynamic_simulation_full_y/dsf_app_module.hpp"
+#include "ss_analysis.hpp"
+
+int
+main(int argc, char **argv)
+{
+  gridpack::Environment env(argc,argv);
+  int ret = 0;
+
+  if (1) {
+    gridpack::parallel::Communicator world;
+
+    // read configuration file
+    gridpack::utility::Configuration *config =
+      gridpack::utility::Configuration::configuration();
+    if (argc >= 2 && argv[1] != NULL) {
+      char inputfile[256];
+      sprintf(inputfile,"%s",argv[1]);
+      config->open(inputfile,world);
+    } else {
+      config->open("input.xml",world);
+    }
+    gridpack::utility::Configuration::CursorPtr cursor;
+    cursor = config->getCursor("Configuration.Small_signal");
+    double tol = cursor->get("tolerance",1.0e-8);
+    double fref = cursor->get("referenceFrequency",0.0);
+    double reftol = cursor->get("referenceTolerance",1.0e-3);
+
+    // solve powerflow to get the operating point
+    boost::shared_ptr<gridpack::powerflow::PFNetwork>
+      pf_network(new gridpack::powerflow::PFNetwork(world));
+    gridpack::powerflow::PFAppModule pf_app;
+    pf_app.readNetwork(pf_network,config);
+    pf_app.initialize();
+    pf_app.solve();
+    pf_app.saveDataAlsotoOrg();
+
+    // set up dynamic simulation and compute modes
+    boost::shared_ptr<gridpack::dynamic_simulation::DSFullNetwork>
+      ds_network(new gridpack::dynamic_simulation::DSFullNetwork(world));
+    pf_network->clone<gridpack::dynamic_simulation::DSFullBus,
+      gridpack::dynamic_simulation::DSFullBranch>(ds_network);
+    gridpack::dynamic_simulation::DSFullApp ds_app;
+    ds_app.setNetwork(ds_network,config);
+    ds_app.readGenerators();
+    ds_app.initialize();
+
+    gridpack::small_signal::SmallSignalAnalysis analysis(ds_network);
+    analysis.configure(cursor);
+    analysis.analyze(ds_app);
+    analysis.write();
+
+    // the classical model has no controllers, so all electromechanical
+    // modes should be close to the imaginary axis
+    int i;
+    int nconv = 0;
+    double maxres = 0.0;
+    double maxreal = 0.0;
+    for (i=0; i<analysis.numEigenvalues(); i++) {
+      if (analysis.getResidual(i) > maxres) maxres = analysis.getResidual(i);
+      if (analysis.getResidual(i) < tol) nconv++;
+      double re = real(analysis.getEigenvalue(i));
+      if (re > maxreal) maxreal = re;
+    }
+    // mode closest to the reference frequency
+    int iref = -1;
+    for (i=0; i<analysis.numEigenvalues(); i++) {
+      if (iref < 0 || fabs(analysis.getFrequency(i)-fref)
+          < fabs(analysis.getFrequency(iref)-fref)) iref = i;
+    }
+    bool ok;
+    if (fref > 0.0) {
+      ok = iref >= 0 && analysis.getResidual(iref) < tol
+        && fabs(analysis.getFrequency(iref)-fref) < reftol*fref
+        && fabs(real(analysis.getEigenvalue(iref)))
+        < reftol*fabs(imag(analysis.getEigenvalue(iref)));
+    } else {
+      ok = nconv > 0 && nconv == analysis.numEigenvalues() && maxreal < 1.0e-3;
+    }
+    if (!ok) ret = 1;
+    if (world.rank() == 0) {
+      printf("\nModes found: %d converged: %d\n",analysis.numEigenvalues(),
+          nconv);
+      printf("Maximum residual:  %12.4e\n",maxres);
+      printf("Maximum real part: %12.4e\n",maxreal);
+      if (fref > 0.0 && iref >= 0) {
+        printf("Reference frequency: %12.6f computed: %12.6f (Hz)\n",fref,
+            analysis.getFrequency(iref));
+      }
+      if (ok) {
+        printf("\nSmall signal analysis test passed\n");
+      } else {
+        printf("\nSmall signal analysis test failed\n");
+      }
+    }
+  }
+
+  return ret;
+}
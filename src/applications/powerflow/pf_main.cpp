@@ -58,6 +58,8 @@ int main(int argc, char **argv)
     exportPSSE34 = cursor->get("exportPSSE_v34",&filename34);
     bool noPrint = false;
     cursor->get("suppressOutput",&noPrint);
+    bool fusedKernel = false;
+    fusedKernel = cursor->get("FusedKernel", fusedKernel);
 
     // setup and run powerflow calculation
     boost::shared_ptr<gridpack::powerflow::PFNetwork>
@@ -83,6 +85,12 @@ int main(int argc, char **argv)
 
     if (useNonLinear) {
       pf_app.nl_solve();
+    } else if (fusedKernel) {
+      // Mismatches and Jacobian are evaluated directly from the Y-bus by
+      // the fused kernel, which is set up by beginScenarios
+      pf_app.beginScenarios();
+      pf_app.solve();
+      pf_app.endScenarios();
     } else {
       pf_app.solve();
       //pf_app.write();
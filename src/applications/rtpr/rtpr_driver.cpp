@@ -26,6 +26,23 @@
 #define USE_STATBLOCK
 
 //#define USE_SUCCESS
+
+// Callback for solveScenarios that stores the tie-line loading margin of the
+// base case for each rating
+struct TieLineMargins
+{
+  gridpack::powerflow::PFAppModule *pf_app;
+  std::vector<int> *from_bus;
+  std::vector<int> *to_bus;
+  std::vector<std::string> *tags;
+  std::vector<double> *margins;
+
+  void operator()(int idx)
+  {
+    (*margins)[idx] = pf_app->getLineLoadingMargin(*from_bus,*to_bus,*tags);
+  }
+};
+
 // Sets up multiple communicators so that individual contingency calculations
 // can be run concurrently
 
@@ -34,6 +51,12 @@
  */
 gridpack::rtpr::RTPRDriver::RTPRDriver(void)
 {
+  p_incrementSearch = false;
+  p_ratingTolerance = 0.01;
+  p_ratingStep = 0.05;
+  p_screeningMargin = 0.1;
+  p_baseCaseScan = 6;
+  p_streamingStats = false;
 }
 
 /**
@@ -603,19 +626,17 @@ void  gridpack::rtpr::RTPRDriver::findWatchedGenerators(
 }
 
 /**
- * Scale loads by rating parameter and adjust generation to match the change
- * in load
- * @param scale scale factor on loads
- * @param flag signal system that should be scaled
- *             0: powerflow
- *             1: dynamic simulation
+ * Find the scaling of loads and generation that corresponds to a value of
+ * the rating parameter, starting from the original loads and generation
+ * @param rating value of rating parameter
+ * @param scenario returns load and generation scaling
  * @return true if generator capacity is sufficent to match change in load,
  *         false otherwise
  */
-bool gridpack::rtpr::RTPRDriver::adjustRating(double rating, int flag)
+bool gridpack::rtpr::RTPRDriver::ratingScenario(double rating,
+    gridpack::powerflow::PFScenario &scenario)
 {
   bool ret = true;
-  int idx;
   double ltotal = p_pf_app.getTotalLoadRealPower(p_dstArea,p_dstZone);
   double gtotal, pmin, pmax;
   p_pf_app.getGeneratorMargins(p_srcArea,p_srcZone,&gtotal,&pmin,&pmax);
@@ -659,8 +680,31 @@ bool gridpack::rtpr::RTPRDriver::adjustRating(double rating, int flag)
       ret = false;
     }
   }
-  p_pf_app.scaleLoadPower(rating,p_dstArea,p_dstZone);
-  p_pf_app.scaleGeneratorRealPower(g_rating,p_srcArea,p_srcZone);
+  scenario.load_scale = rating;
+  scenario.load_area = p_dstArea;
+  scenario.load_zone = p_dstZone;
+  scenario.gen_scale = g_rating;
+  scenario.gen_area = p_srcArea;
+  scenario.gen_zone = p_srcZone;
+  return ret;
+}
+
+/**
+ * Scale loads by rating parameter and adjust generation to match the change
+ * in load
+ * @param scale scale factor on loads
+ * @param flag signal system that should be scaled
+ *             0: powerflow
+ *             1: dynamic simulation
+ * @return true if generator capacity is sufficent to match change in load,
+ *         false otherwise
+ */
+bool gridpack::rtpr::RTPRDriver::adjustRating(double rating, int flag)
+{
+  gridpack::powerflow::PFScenario scenario;
+  bool ret = ratingScenario(rating, scenario);
+  p_pf_app.scaleLoadPower(scenario.load_scale,p_dstArea,p_dstZone);
+  p_pf_app.scaleGeneratorRealPower(scenario.gen_scale,p_srcArea,p_srcZone);
 #if 0
   char file[128];
   if (flag == 0) {
@@ -669,7 +713,7 @@ bool gridpack::rtpr::RTPRDriver::adjustRating(double rating, int flag)
     sprintf(file,"ds_diagnostic_%f.dat",rating);
   }
   p_pf_app.writeRTPRDiagnostics(p_srcArea,p_srcZone,p_dstArea,p_dstZone,
-      g_rating,rating,file);
+      scenario.gen_scale,scenario.load_scale,file);
 #endif
   return ret;
 }
@@ -839,6 +883,33 @@ void gridpack::rtpr::RTPRDriver::execute(int argc, char** argv, gridpack::Enviro
     printf("Using Branch Rating B parameter for checking line overloads\n");
   }
 
+  // Method used to search for the rating. The "increment" method steps the
+  // rating by 5% and then 1%, the default "secant" method brackets the
+  // rating and refines it using secant and bisection steps
+  std::string search_method;
+  if (!cursor->get("ratingSearchMethod",&search_method)) {
+    search_method = "secant";
+  }
+  util.toLower(search_method);
+  util.trim(search_method);
+  p_incrementSearch = (search_method == "increment");
+  p_ratingTolerance = cursor->get("ratingTolerance",0.01);
+  p_ratingStep = cursor->get("ratingStep",0.05);
+  p_screeningMargin = cursor->get("screeningMargin",0.1);
+  p_baseCaseScan = cursor->get("baseCaseScan",6);
+  // Accumulate branch flow statistics without storing the results of every
+  // contingency
+  p_streamingStats = cursor->get("streamingStatistics",false);
+  if (p_world.rank() == 0) {
+    if (p_incrementSearch) {
+      printf("Searching for rating using fixed increments\n");
+    } else {
+      printf("Searching for rating using secant/bisection steps\n");
+      printf("  Rating tolerance: %f Initial step: %f Screening margin: %f\n",
+          p_ratingTolerance,p_ratingStep,p_screeningMargin);
+    }
+  }
+
   // TODO: Set these values from input deck
   double start;
   if (!cursor->get("contingencyDSStart",&start)) {
@@ -862,10 +933,14 @@ void gridpack::rtpr::RTPRDriver::execute(int argc, char** argv, gridpack::Enviro
   p_task_comm = p_world.divide(grp_size);
   // Create powerflow applications on each task communicator
   p_pf_network.reset(new gridpack::powerflow::PFNetwork(p_task_comm));
-  // Read in the network from an external file and partition it over the
-  // processors in the task communicator. This will read in power flow
-  // parameters from the Powerflow block in the input
-  p_pf_app.readNetwork(p_pf_network,config);
+  // Read in the network from an external file once and keep it in shared
+  // memory on each node. Each task communicator creates its network from
+  // this copy and partitions it over its processors. This will read in power
+  // flow parameters from the Powerflow block in the input
+  gridpack::parser::SharedCase<gridpack::powerflow::PFNetwork>
+    base_case(p_world);
+  p_pf_app.readSharedCase(base_case,config);
+  p_pf_app.readNetwork(p_pf_network,base_case,config);
   // Finish initializing the network
   p_pf_app.initialize();
 
@@ -1017,74 +1092,79 @@ void gridpack::rtpr::RTPRDriver::execute(int argc, char** argv, gridpack::Enviro
   }
 
   p_rating = 1.0;
-  bool checkTie = runContingencies();
-  if (checkTie) {
-    // Tie lines are secure for all contingencies. Increase loads and generation
-    while (checkTie) {
-      p_rating += 0.05;
-      if (!adjustRating(p_rating,0)) {
-        if (p_world.rank() == 0) {
-          printf("Rating capacity exceeded: %f\n",p_rating);
+  bool checkTie;
+  if (p_incrementSearch) {
+    checkTie = runContingencies();
+    if (checkTie) {
+      // Tie lines are secure for all contingencies. Increase loads and generation
+      while (checkTie) {
+        p_rating += 0.05;
+        if (!adjustRating(p_rating,0)) {
+          if (p_world.rank() == 0) {
+            printf("Rating capacity exceeded: %f\n",p_rating);
+          }
+          p_rating -= 0.05;
+          p_pf_app.resetPower();
+          break;
         }
-        p_rating -= 0.05;
+        checkTie = runContingencies();
+        if (!checkTie) p_rating -= 0.05;
         p_pf_app.resetPower();
-        break;
       }
-      checkTie = runContingencies();
-      if (!checkTie) p_rating -= 0.05;
-      p_pf_app.resetPower();
-    }
-    // Refine estimate of rating
-    checkTie = true;
-    while (checkTie) {
-      p_rating += 0.01;
-      if (!adjustRating(p_rating,0)) {
-        p_rating -= 0.01;
-        if (p_world.rank() == 0) {
-          printf("Real power generation for power flow"
-              " is capacity-limited for Rating: %f\n",
-              p_rating);
+      // Refine estimate of rating
+      checkTie = true;
+      while (checkTie) {
+        p_rating += 0.01;
+        if (!adjustRating(p_rating,0)) {
+          p_rating -= 0.01;
+          if (p_world.rank() == 0) {
+            printf("Real power generation for power flow"
+                " is capacity-limited for Rating: %f\n",
+                p_rating);
+          }
+          p_pf_app.resetPower();
+          break;
         }
+        checkTie = runContingencies();
+        if (!checkTie) p_rating -= 0.01;
         p_pf_app.resetPower();
-        break;
       }
-      checkTie = runContingencies();
-      if (!checkTie) p_rating -= 0.01;
-      p_pf_app.resetPower();
-    }
-  } else {
-    // Tie lines are insecure for some contingencies. Decrease loads and generation
-    while (!checkTie && p_rating >= 0.0) {
-      p_rating -= 0.05;
-      if (!adjustRating(p_rating,0)) {
-        if (p_world.rank() == 0) {
-          printf("Rating capacity exceeded: %f\n",p_rating);
+    } else {
+      // Tie lines are insecure for some contingencies. Decrease loads and generation
+      while (!checkTie && p_rating >= 0.0) {
+        p_rating -= 0.05;
+        if (!adjustRating(p_rating,0)) {
+          if (p_world.rank() == 0) {
+            printf("Rating capacity exceeded: %f\n",p_rating);
+          }
+          p_rating += 0.05;
+          p_pf_app.resetPower();
+          break;
         }
-        p_rating += 0.05;
+        checkTie = runContingencies();
+        if (checkTie) p_rating += 0.05;
         p_pf_app.resetPower();
-        break;
       }
-      checkTie = runContingencies();
-      if (checkTie) p_rating += 0.05;
-      p_pf_app.resetPower();
-    }
-    // Refine estimate of rating
-    checkTie = false;
-    while (!checkTie && p_rating >= 0.0) {
-      p_rating -= 0.01;
-      if (!adjustRating(p_rating,0)) {
-        p_rating += 0.01;
-        if (p_world.rank() == 0) {
-          printf("Real power generation for power flow"
-              " is capacity-limited for Rating: %f\n",
-              p_rating);
+      // Refine estimate of rating
+      checkTie = false;
+      while (!checkTie && p_rating >= 0.0) {
+        p_rating -= 0.01;
+        if (!adjustRating(p_rating,0)) {
+          p_rating += 0.01;
+          if (p_world.rank() == 0) {
+            printf("Real power generation for power flow"
+                " is capacity-limited for Rating: %f\n",
+                p_rating);
+          }
+          p_pf_app.resetPower();
+          break;
         }
+        checkTie = runContingencies();
         p_pf_app.resetPower();
-        break;
       }
-      checkTie = runContingencies();
-      p_pf_app.resetPower();
     }
+  } else {
+    p_rating = searchPFRating();
   }
   if (p_world.rank() == 0) {
     printf("Final Power Flow Rating: %f\n",p_rating);
@@ -1116,43 +1196,47 @@ void gridpack::rtpr::RTPRDriver::execute(int argc, char** argv, gridpack::Enviro
 
 //    p_ds_app.scaleLoadPower(p_rating,p_dstArea,p_dstZone);
 //    p_ds_app.scaleGeneratorRealPower(p_rating,p_srcArea,p_srcZone);
-    p_pf_app.resetPower();
-    adjustRating(p_rating,1);
-    checkTie = runDSContingencies();
-    p_pf_app.resetPower();
-    p_ds_app.resetPower();
-
-    // Current rating is an upper bound. Only check lower values.
-    while (!checkTie && p_rating >= 0.0) {
-      p_rating -= 0.05;
-      if (!adjustRating(p_rating,1)) {
-        p_rating += 0.05;
-        p_pf_app.resetPower();
-        p_ds_app.resetPower();
-        break;
-      }
+    if (p_incrementSearch) {
+      p_pf_app.resetPower();
+      adjustRating(p_rating,1);
       checkTie = runDSContingencies();
       p_pf_app.resetPower();
       p_ds_app.resetPower();
-    }
-    // Refine estimate of rating
-    checkTie = false;
-    while (!checkTie && p_rating >= 0.0) {
-      p_rating -= 0.01;
-      if (!adjustRating(p_rating,1)) {
-        p_rating += 0.01;
-        if (p_world.rank() == 0) {
-          printf("Real power generation for dynamic simulation"
-              " is capacity-limited for Rating: %f\n",
-              p_rating);
+
+      // Current rating is an upper bound. Only check lower values.
+      while (!checkTie && p_rating >= 0.0) {
+        p_rating -= 0.05;
+        if (!adjustRating(p_rating,1)) {
+          p_rating += 0.05;
+          p_pf_app.resetPower();
+          p_ds_app.resetPower();
+          break;
         }
+        checkTie = runDSContingencies();
         p_pf_app.resetPower();
         p_ds_app.resetPower();
-        break;
       }
-      checkTie = runDSContingencies();
-      p_pf_app.resetPower();
-      p_ds_app.resetPower();
+      // Refine estimate of rating
+      checkTie = false;
+      while (!checkTie && p_rating >= 0.0) {
+        p_rating -= 0.01;
+        if (!adjustRating(p_rating,1)) {
+          p_rating += 0.01;
+          if (p_world.rank() == 0) {
+            printf("Real power generation for dynamic simulation"
+                " is capacity-limited for Rating: %f\n",
+                p_rating);
+          }
+          p_pf_app.resetPower();
+          p_ds_app.resetPower();
+          break;
+        }
+        checkTie = runDSContingencies();
+        p_pf_app.resetPower();
+        p_ds_app.resetPower();
+      }
+    } else {
+      p_rating = searchDSRating(p_rating);
     }
 
     if (p_world.rank() == 0) {
@@ -1174,6 +1258,22 @@ void gridpack::rtpr::RTPRDriver::execute(int argc, char** argv, gridpack::Enviro
  * @return true if no tie line violations found
  */
 bool gridpack::rtpr::RTPRDriver::runContingencies()
+{
+  return runContingencies(NULL, NULL);
+}
+
+/**
+ * Run the base case and a set of contingencies
+ * @param tasks indices of contingencies to run. If NULL, run all
+ * contingencies
+ * @param margins if not NULL, return the smallest tie-line loading margin
+ * for the base case in element 0 and for contingency i in element i+1.
+ * Divergent calculations have a margin of -1. Elements for contingencies
+ * that are not run are not modified
+ * @return true if no tie line violations found
+ */
+bool gridpack::rtpr::RTPRDriver::runContingencies(
+    const std::vector<int> *tasks, std::vector<double> *margins)
 {
   bool ret = true;
   bool chkLines;
@@ -1221,6 +1321,21 @@ bool gridpack::rtpr::RTPRDriver::runContingencies()
       p_tags, violations);
   ret = ret && chkLines;
   if (!chkLines) printf("Line overload on base case\n");
+  // Loading margins are reduced over all processors at the end. Entries
+  // that are not evaluated on this processor are set above the largest
+  // possible margin
+  int nevents = p_events.size();
+  std::vector<double> ctg_margin;
+  if (margins) {
+    margins->resize(nevents+1);
+    ctg_margin.assign(nevents+1, 2.0);
+    if (chkSolve) {
+      (*margins)[0] = p_pf_app.getLineLoadingMargin(p_from_bus, p_to_bus,
+          p_tags);
+    } else {
+      (*margins)[0] = -1.0;
+    }
+  }
   // Write out voltages and currents
   if (p_print_calcs) p_pf_app.write();
   if (p_print_calcs) p_pf_app.close();
@@ -1228,9 +1343,10 @@ bool gridpack::rtpr::RTPRDriver::runContingencies()
   // Set up task manager on the world communicator. The number of tasks is
   // equal to the number of contingencies
   gridpack::parallel::TaskManager taskmgr(p_world);
-  int ntasks = p_events.size();
+  int ntasks = nevents;
+  if (tasks) ntasks = tasks->size();
   if (ntasks == 0) {
-    return chkSolve;
+    return chkSolve && ret;
   }
   taskmgr.set(ntasks);
 #ifdef USE_STATBLOCK
@@ -1266,7 +1382,8 @@ bool gridpack::rtpr::RTPRDriver::runContingencies()
       }
     }
   }
-  gridpack::analysis::StatBlock pflow_stats(p_world,nsize,ntasks+1);
+  gridpack::analysis::StatBlock pflow_stats(p_world,nsize,nevents+1,
+      p_streamingStats);
   if (p_world.rank() == 0) {
     pflow_stats.addRowLabels(id1, id2, tags);
     pflow_stats.addColumnValues(0,pflow,mask);
@@ -1283,6 +1400,9 @@ bool gridpack::rtpr::RTPRDriver::runContingencies()
   // nextTask returns the same task_id on all processors in task_comm. When the
   // calculation runs out of task, nextTask will return false.
   while (taskmgr.nextTask(p_task_comm, &task_id)) {
+    // index of contingency corresponding to this task
+    int ctg_id = task_id;
+    if (tasks) ctg_id = (*tasks)[task_id];
 #ifdef RTPR_DEBUG
     int nsize = violationDesc.size();
     if (task_id == 0 && nsize>0) {
@@ -1299,7 +1419,7 @@ bool gridpack::rtpr::RTPRDriver::runContingencies()
     }
 #endif
     printf("Executing task %d on process %d\n",task_id,p_world.rank());
-    sprintf(sbuf,"%s_%f.out",p_events[task_id].p_name.c_str(),fabs(p_rating));
+    sprintf(sbuf,"%s_%f.out",p_events[ctg_id].p_name.c_str(),fabs(p_rating));
     // Open a new file, based on the contingency name, to store results from
     // this particular contingency calculation
     if (p_print_calcs) p_pf_app.open(sbuf);
@@ -1307,37 +1427,37 @@ bool gridpack::rtpr::RTPRDriver::runContingencies()
     // information on the contingency
     sprintf(sbuf,"\nRunning task on %d processes\n",p_task_comm.size());
     if (p_print_calcs) p_pf_app.writeHeader(sbuf);
-    if (p_events[task_id].p_type == Branch) {
-      int nlines = p_events[task_id].p_from.size();
+    if (p_events[ctg_id].p_type == Branch) {
+      int nlines = p_events[ctg_id].p_from.size();
       int j;
       for (j=0; j<nlines; j++) {
         sprintf(sbuf," Line: (from) %d (to) %d (line) \'%s\'\n",
-            p_events[task_id].p_from[j],p_events[task_id].p_to[j],
-            p_events[task_id].p_ckt[j].c_str());
+            p_events[ctg_id].p_from[j],p_events[ctg_id].p_to[j],
+            p_events[ctg_id].p_ckt[j].c_str());
         printf("p[%d] Line: (from) %d (to) %d (line) \'%s\'\n",
             p_pf_network->communicator().rank(),
-            p_events[task_id].p_from[j],p_events[task_id].p_to[j],
-            p_events[task_id].p_ckt[j].c_str());
+            p_events[ctg_id].p_from[j],p_events[ctg_id].p_to[j],
+            p_events[ctg_id].p_ckt[j].c_str());
       }
-    } else if (p_events[task_id].p_type == Generator) {
-      int nbus = p_events[task_id].p_busid.size();
+    } else if (p_events[ctg_id].p_type == Generator) {
+      int nbus = p_events[ctg_id].p_busid.size();
       int j;
       for (j=0; j<nbus; j++) {
         sprintf(sbuf," Generator: (bus) %d (generator ID) \'%s\'\n",
-            p_events[task_id].p_busid[j],p_events[task_id].p_genid[j].c_str());
+            p_events[ctg_id].p_busid[j],p_events[ctg_id].p_genid[j].c_str());
         printf("p[%d] Generator: (bus) %d (generator ID) \'%s\'\n",
             p_pf_network->communicator().rank(),
-            p_events[task_id].p_busid[j],p_events[task_id].p_genid[j].c_str());
+            p_events[ctg_id].p_busid[j],p_events[ctg_id].p_genid[j].c_str());
       }
     }
     if (p_print_calcs) p_pf_app.writeHeader(sbuf);
     // Reset all voltages back to their original values
     p_pf_app.resetVoltages();
     // Set contingency
-    p_pf_app.setContingency(p_events[task_id]);
+    p_pf_app.setContingency(p_events[ctg_id]);
     // Solve power flow equations for this system
 #ifdef USE_SUCCESS
-    contingency_idx.push_back(task_id);
+    contingency_idx.push_back(ctg_id);
 #endif
     if (p_pf_app.solve()) {
       chkSolve = true;
@@ -1347,12 +1467,16 @@ bool gridpack::rtpr::RTPRDriver::runContingencies()
       if (p_check_Qlim && !p_pf_app.checkQlimViolations()) {
         chkSolve = p_pf_app.solve();
       }
-      if (!chkSolve) printf("Failed solution on continency %d\n",task_id+1);
+      if (!chkSolve) printf("Failed solution on continency %d\n",ctg_id+1);
       // If power flow solution is successful, write out voltages and currents
       if (p_print_calcs) p_pf_app.write();
       chkLines = p_pf_app.checkLineOverloadViolations(p_from_bus, p_to_bus, p_tags,
           violations);
       ret = ret && chkLines;
+      if (margins) {
+        ctg_margin[ctg_id+1] = p_pf_app.getLineLoadingMargin(p_from_bus,
+            p_to_bus, p_tags);
+      }
       // Check for violations
       bool ok1 = p_pf_app.checkVoltageViolations();
       bool ok2 = p_pf_app.checkLineOverloadViolations();
@@ -1360,20 +1484,20 @@ bool gridpack::rtpr::RTPRDriver::runContingencies()
       // Include results of violation checks in output
       if (ok) {
         sprintf(sbuf,"\nNo violation for contingency %s\n",
-            p_events[task_id].p_name.c_str());
+            p_events[ctg_id].p_name.c_str());
 #ifdef USE_SUCCESS
         contingency_violation.push_back(1);
 #endif
       } 
       if (!ok1) {
         sprintf(sbuf,"\nBus Violation for contingency %s\n",
-            p_events[task_id].p_name.c_str());
+            p_events[ctg_id].p_name.c_str());
       }
       if (p_print_calcs) p_pf_app.print(sbuf);
       if (p_print_calcs) p_pf_app.writeCABus();
       if (!ok2) {
         sprintf(sbuf,"\nBranch Violation for contingency %s\n",
-            p_events[task_id].p_name.c_str());
+            p_events[ctg_id].p_name.c_str());
       }
 
 #ifdef USE_SUCCESS
@@ -1408,7 +1532,7 @@ bool gridpack::rtpr::RTPRDriver::runContingencies()
         }
       }
       if (p_task_comm.rank() == 0) {
-        pflow_stats.addColumnValues(task_id+1,pflow,mask);
+        pflow_stats.addColumnValues(ctg_id+1,pflow,mask);
       }
 #endif
 
@@ -1416,7 +1540,7 @@ bool gridpack::rtpr::RTPRDriver::runContingencies()
       violationDesc = p_pf_app.getContingencyFailures();
       nsize = violationDesc.size();
       if (nsize>0) {
-        sprintf(sbuf,"%s_%f.desc",p_events[task_id].p_name.c_str(),p_rating);
+        sprintf(sbuf,"%s_%f.desc",p_events[ctg_id].p_name.c_str(),p_rating);
         if (p_task_comm.rank() == 0) {
           int i;
           std::ofstream fout;
@@ -1432,13 +1556,14 @@ bool gridpack::rtpr::RTPRDriver::runContingencies()
       if (p_print_calcs) p_pf_app.writeCABranch();
       if (p_check_Qlim) p_pf_app.clearQlimViolations();
     } else {
-      if (!chkSolve) printf("Failed solution on continency %d\n",task_id+1);
+      if (!chkSolve) printf("Failed solution on continency %d\n",ctg_id+1);
 #ifdef USE_SUCCESS
       contingency_success.push_back(false);
       contingency_violation.push_back(0);
 #endif
+      if (margins) ctg_margin[ctg_id+1] = -1.0;
       sprintf(sbuf,"\nDivergent for contingency %s\n",
-          p_events[task_id].p_name.c_str());
+          p_events[ctg_id].p_name.c_str());
       if (p_print_calcs) p_pf_app.print(sbuf);
 #ifdef USE_STATBLOCK
       pflow.clear();
@@ -1459,12 +1584,12 @@ bool gridpack::rtpr::RTPRDriver::runContingencies()
         }
       }
       if (p_task_comm.rank() == 0) {
-        pflow_stats.addColumnValues(task_id+1,pflow,mask);
+        pflow_stats.addColumnValues(ctg_id+1,pflow,mask);
       }
 #endif
     } 
     // Return network to its original base case state
-    p_pf_app.unSetContingency(p_events[task_id]);
+    p_pf_app.unSetContingency(p_events[ctg_id]);
     // Close output file for this contingency
     if (p_print_calcs) p_pf_app.close();
   }
@@ -1472,6 +1597,15 @@ bool gridpack::rtpr::RTPRDriver::runContingencies()
   // per processor
   taskmgr.printStats();
 
+  // Combine loading margins from all task communicators
+  if (margins) {
+    p_world.min(&ctg_margin[1],nevents);
+    int i;
+    for (i=1; i<=nevents; i++) {
+      if (ctg_margin[i] <= 1.0) (*margins)[i] = ctg_margin[i];
+    }
+  }
+
   // Gather stats on successful contingency calculations
 #ifdef USE_SUCCESS
   if (p_task_comm.rank() == 0) {
@@ -1487,7 +1621,13 @@ bool gridpack::rtpr::RTPRDriver::runContingencies()
     contingency_success.clear();
     contingency_violation.clear();
     int i;
-    for (i=0; i<ntasks; i++) contingency_idx.push_back(i);
+    for (i=0; i<ntasks; i++) {
+      if (tasks) {
+        contingency_idx.push_back((*tasks)[i]);
+      } else {
+        contingency_idx.push_back(i);
+      }
+    }
     ca_success.getData(contingency_idx, contingency_success);
     contingency_success.clear();
     ca_violation.getData(contingency_idx, contingency_violation);
@@ -1496,7 +1636,8 @@ bool gridpack::rtpr::RTPRDriver::runContingencies()
     fout.open(sbuf);
     for (i=0; i<ntasks; i++) {
       if (contingency_success[i]) {
-        fout << "contingency: " << p_events[i].p_name << " success: true";
+        fout << "contingency: " << p_events[contingency_idx[i]].p_name
+          << " success: true";
         if (contingency_violation[i] == 1) {
           fout << " violation: none" << std::endl;
         } else if (contingency_violation[i] == 2) {
@@ -1507,7 +1648,7 @@ bool gridpack::rtpr::RTPRDriver::runContingencies()
           fout << " violation: bus and branch" << std::endl;
         }
       } else {
-        fout << "contingency: " << p_events[i].p_name
+        fout << "contingency: " << p_events[contingency_idx[i]].p_name
           << " success: false" << std::endl;
       }
     }
@@ -1534,6 +1675,373 @@ bool gridpack::rtpr::RTPRDriver::runContingencies()
   return ret;
 }
 
+/**
+ * Evaluate the power flow contingencies for a single value of the rating
+ * parameter. Loads and generation are restored to their original values
+ * before returning
+ * @param rating value of rating parameter
+ * @param tasks indices of contingencies to run. If NULL, run all
+ * contingencies
+ * @param margins tie-line loading margins for the base case and each
+ * contingency (see runContingencies)
+ * @param margin returns the smallest loading margin of the base case and the
+ * contingencies that were run
+ * @return true if the rating is secure
+ */
+bool gridpack::rtpr::RTPRDriver::evaluatePFRating(double rating,
+    const std::vector<int> *tasks, std::vector<double> &margins,
+    double *margin)
+{
+  p_rating = rating;
+  bool ret = adjustRating(rating,0);
+  if (!ret && p_world.rank() == 0) {
+    printf("Real power generation for power flow"
+        " is capacity-limited for Rating: %f\n",rating);
+  }
+  bool secure = runContingencies(tasks, &margins);
+  p_pf_app.resetPower();
+  int i;
+  *margin = margins[0];
+  if (tasks) {
+    for (i=0; i<tasks->size(); i++) {
+      if (margins[(*tasks)[i]+1] < *margin) *margin = margins[(*tasks)[i]+1];
+    }
+  } else {
+    for (i=1; i<margins.size(); i++) {
+      if (margins[i] < *margin) *margin = margins[i];
+    }
+  }
+  if (p_world.rank() == 0) {
+    printf("Rating: %f secure: %s tie-line margin: %f contingencies: %d\n",
+        rating,secure && ret ? "true" : "false",*margin,
+        tasks ? static_cast<int>(tasks->size())
+        : static_cast<int>(p_events.size()));
+  }
+  // If generation is capacity limited, the requested rating cannot be
+  // reached
+  return ret && secure;
+}
+
+/**
+ * Complete the evaluation of a rating that is secure for the screened
+ * contingencies by running the contingencies that were screened out. The
+ * screened contingencies are then chosen again from the margins at this
+ * rating, so that the screening follows the loading as the search moves
+ * @param rating value of rating parameter
+ * @param screened indices of contingencies that are re-evaluated during the
+ * search. This is updated on return
+ * @param margins tie-line loading margins for the base case and each
+ * contingency (see runContingencies)
+ * @param margin returns the smallest loading margin of the base case and all
+ * contingencies
+ * @return true if the rating is secure for all contingencies
+ */
+bool gridpack::rtpr::RTPRDriver::acceptPFRating(double rating,
+    std::vector<int> &screened, std::vector<double> &margins, double *margin)
+{
+  int nevents = p_events.size();
+  int i;
+  std::vector<bool> listed(nevents, false);
+  for (i=0; i<screened.size(); i++) listed[screened[i]] = true;
+  std::vector<int> others;
+  for (i=0; i<nevents; i++) {
+    if (!listed[i]) others.push_back(i);
+  }
+  bool secure = true;
+  if (!others.empty()) {
+    double m;
+    secure = evaluatePFRating(rating, &others, margins, &m);
+  }
+  *margin = margins[0];
+  screened.clear();
+  for (i=0; i<nevents; i++) {
+    if (margins[i+1] < *margin) *margin = margins[i+1];
+    if (margins[i+1] < p_screeningMargin) screened.push_back(i);
+  }
+  if (p_world.rank() == 0) {
+    printf("Rating: %f accepted: %s screened contingencies: %d\n",
+        rating,secure ? "true" : "false",static_cast<int>(screened.size()));
+  }
+  return secure;
+}
+
+/**
+ * Find the power flow rating. The rating is bracketed by stepping away from
+ * 1.0 using extrapolation of the tie-line loading margin and a step that
+ * doubles after every evaluation. The bracket is then refined with secant
+ * steps on the margin, safeguarded by bisection. Each rating is first
+ * evaluated with the contingencies whose loading margin was below the
+ * screening margin at the last accepted rating. A violation of one of these
+ * is enough to reject the rating. A rating that passes is only accepted
+ * after the remaining contingencies have been run, and the screened
+ * contingencies are then chosen again at that rating. If the base case is
+ * secure at a rating of 1.0, the base case alone is solved at the ratings
+ * used by the bracketing steps, and the first insecure rating bounds the
+ * search from above
+ * @return power flow rating
+ */
+double gridpack::rtpr::RTPRDriver::searchPFRating()
+{
+  int nevents = p_events.size();
+  std::vector<double> margins(nevents+1, -1.0);
+  std::vector<int> screened;
+  double lo = 0.0, hi = 0.0, mlo = 0.0, mhi = 0.0, margin;
+  bool have_lo = false, have_hi = false;
+  int i;
+
+  // Evaluate all contingencies at the starting rating and choose the
+  // contingencies that are close to binding
+  double rating = 1.0;
+  bool secure = evaluatePFRating(rating, NULL, margins, &margin);
+  for (i=0; i<nevents; i++) {
+    if (margins[i+1] < p_screeningMargin) screened.push_back(i);
+  }
+  if (secure) {
+    lo = rating;
+    mlo = margin;
+    have_lo = true;
+    // An upper bound from the base case alone avoids running the
+    // contingencies while the rating is bracketed
+    if (scanBaseCase(&hi, &mhi)) have_hi = true;
+  } else {
+    hi = rating;
+    mhi = margin;
+    have_hi = true;
+  }
+
+  // Bracket the rating. Once two points are available, extrapolate the
+  // margin to estimate where it changes sign, limited by a step that
+  // doubles after every evaluation
+  double step = p_ratingStep;
+  bool have_prev = false;
+  double r_prev = 0.0, m_prev = 0.0;
+  while (!have_lo || !have_hi) {
+    double r0 = have_lo ? lo : hi;
+    double m0 = have_lo ? mlo : mhi;
+    if (have_lo) {
+      rating = r0 + step;
+    } else {
+      rating = r0 - step;
+    }
+    if (have_prev && m_prev != m0) {
+      double r = r0 + m0*(r0-r_prev)/(m_prev-m0);
+      if (have_lo) {
+        r += p_ratingTolerance;
+        if (r < r0 + p_ratingStep) r = r0 + p_ratingStep;
+        if (r < rating) rating = r;
+      } else {
+        r -= p_ratingTolerance;
+        if (r > r0 - p_ratingStep) r = r0 - p_ratingStep;
+        if (r > rating) rating = r;
+      }
+    }
+    if (rating < 0.0) rating = 0.0;
+    step *= 2.0;
+    r_prev = r0;
+    m_prev = m0;
+    have_prev = true;
+    secure = evaluatePFRating(rating, &screened, margins, &margin);
+    if (secure) secure = acceptPFRating(rating, screened, margins, &margin);
+    if (secure) {
+      lo = rating;
+      mlo = margin;
+      have_lo = true;
+    } else {
+      hi = rating;
+      mhi = margin;
+      have_hi = true;
+      if (rating <= 0.0 && !have_lo) {
+        if (p_world.rank() == 0) {
+          printf("No secure rating found\n");
+        }
+        return 0.0;
+      }
+    }
+  }
+
+  // Refine the bracket. Use a secant step on the tie-line margin, offset
+  // slightly towards the end of the bracket that did not move last so that
+  // both ends converge. If two successive steps move the same end of the
+  // bracket, bisect so that the bracket always shrinks
+  int last_side = 0;
+  bool bisect = false;
+  while (hi - lo > p_ratingTolerance) {
+    double width = hi - lo;
+    rating = 0.5*(lo+hi);
+    if (!bisect && mlo > 0.0 && mhi < mlo) {
+      rating = lo + mlo*width/(mlo-mhi);
+      if (last_side == 1) rating += 0.5*p_ratingTolerance;
+      if (last_side == -1) rating -= 0.5*p_ratingTolerance;
+      if (rating < lo + 0.25*p_ratingTolerance) {
+        rating = lo + 0.25*p_ratingTolerance;
+      }
+      if (rating > hi - 0.25*p_ratingTolerance) {
+        rating = hi - 0.25*p_ratingTolerance;
+      }
+    }
+    secure = evaluatePFRating(rating, &screened, margins, &margin);
+    if (secure) secure = acceptPFRating(rating, screened, margins, &margin);
+    int side;
+    if (secure) {
+      lo = rating;
+      mlo = margin;
+      side = 1;
+    } else {
+      hi = rating;
+      mhi = margin;
+      side = -1;
+    }
+    bisect = (side == last_side);
+    last_side = side;
+  }
+  // Every accepted rating has been evaluated with all contingencies, so no
+  // final confirmation is needed
+  return lo;
+}
+
+/**
+ * Evaluate the base case and all contingencies at a single value of the
+ * rating parameter, independently of the rating search
+ * @param rating value of rating parameter
+ * @return true if the rating is secure
+ */
+bool gridpack::rtpr::RTPRDriver::checkPFRating(double rating)
+{
+  double save = p_rating;
+  std::vector<double> margins(p_events.size()+1, -1.0);
+  double margin;
+  bool ret = evaluatePFRating(rating, NULL, margins, &margin);
+  p_rating = save;
+  return ret;
+}
+
+/**
+ * @return rating found by the last call to execute
+ */
+double gridpack::rtpr::RTPRDriver::getRating() const
+{
+  return p_rating;
+}
+
+/**
+ * Solve the base case at the ratings that are tried when the rating is
+ * bracketed from above as a single batch of power flow scenarios. A rating
+ * at which the base case is not secure cannot be secure, so the first of
+ * these is an upper bound for the search
+ * @param bound returns the smallest scanned rating at which the base case
+ * is not secure
+ * @param margin returns the tie-line loading margin of the base case at the
+ * bound
+ * @return true if an upper bound was found
+ */
+bool gridpack::rtpr::RTPRDriver::scanBaseCase(double *bound, double *margin)
+{
+  // Checking Q limits changes bus types after the base case is solved, which
+  // is not supported by the scenario solver
+  if (p_baseCaseScan <= 0 || p_check_Qlim) return false;
+  std::vector<gridpack::powerflow::PFScenario> scenarios;
+  std::vector<double> ratings;
+  double rating = 1.0;
+  double step = p_ratingStep;
+  int i;
+  for (i=0; i<p_baseCaseScan; i++) {
+    rating += step;
+    step *= 2.0;
+    gridpack::powerflow::PFScenario scenario;
+    // Ratings that exceed the generation capacity are evaluated by the
+    // search
+    if (!ratingScenario(rating, scenario)) break;
+    ratings.push_back(rating);
+    scenarios.push_back(scenario);
+  }
+  if (scenarios.empty()) return false;
+
+  p_pf_app.useRateB(p_useRateB);
+  std::vector<double> margins(scenarios.size(), -1.0);
+  std::vector<bool> converged;
+  TieLineMargins store;
+  store.pf_app = &p_pf_app;
+  store.from_bus = &p_from_bus;
+  store.to_bus = &p_to_bus;
+  store.tags = &p_tags;
+  store.margins = &margins;
+  p_pf_app.resetVoltages();
+  p_pf_app.solveScenarios(scenarios, converged, store);
+  p_pf_app.resetVoltages();
+  for (i=0; i<ratings.size(); i++) {
+    if (!converged[i]) margins[i] = -1.0;
+    if (p_world.rank() == 0) {
+      printf("Base case rating: %f converged: %s tie-line margin: %f\n",
+          ratings[i],converged[i] ? "true" : "false",margins[i]);
+    }
+    if (margins[i] < 0.0) {
+      *bound = ratings[i];
+      *margin = margins[i];
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Evaluate the dynamic simulation contingencies for a single value of the
+ * rating parameter
+ * @param rating value of rating parameter
+ * @return true if the rating is secure
+ */
+bool gridpack::rtpr::RTPRDriver::evaluateDSRating(double rating)
+{
+  p_rating = rating;
+  p_pf_app.resetPower();
+  bool ret = adjustRating(rating,1);
+  bool secure = runDSContingencies();
+  p_pf_app.resetPower();
+  p_ds_app.resetPower();
+  if (p_world.rank() == 0) {
+    printf("Dynamic simulation rating: %f secure: %s\n",rating,
+        secure && ret ? "true" : "false");
+  }
+  return ret && secure;
+}
+
+/**
+ * Find the dynamic simulation rating. The power flow rating is an upper
+ * bound. A lower bound is found by stepping down with a step that doubles
+ * after every evaluation and the bracket is refined by bisection
+ * @param upper upper bound on the rating
+ * @return dynamic simulation rating
+ */
+double gridpack::rtpr::RTPRDriver::searchDSRating(double upper)
+{
+  if (evaluateDSRating(upper)) return upper;
+  double hi = upper;
+  double lo = upper;
+  double step = p_ratingStep;
+  bool secure = false;
+  while (!secure) {
+    hi = lo;
+    lo = hi - step;
+    if (lo < 0.0) lo = 0.0;
+    step *= 2.0;
+    secure = evaluateDSRating(lo);
+    if (!secure && lo <= 0.0) {
+      if (p_world.rank() == 0) {
+        printf("No secure dynamic simulation rating found\n");
+      }
+      return 0.0;
+    }
+  }
+  while (hi - lo > p_ratingTolerance) {
+    double rating = 0.5*(lo+hi);
+    if (evaluateDSRating(rating)) {
+      lo = rating;
+    } else {
+      hi = rating;
+    }
+  }
+  return lo;
+}
+
 /**
  * Transfer data from power flow to dynamic simulation
  * @param pf_network power flow network
@@ -144,6 +144,18 @@ class RTPRDriver
      */
     bool adjustRating(double rating, int flag);
 
+    /**
+     * Find the scaling of loads and generation that corresponds to a value
+     * of the rating parameter, starting from the original loads and
+     * generation
+     * @param rating value of rating parameter
+     * @param scenario returns load and generation scaling
+     * @return true if generator capacity is sufficent to match change in load,
+     *         false otherwise
+     */
+    bool ratingScenario(double rating,
+        gridpack::powerflow::PFScenario &scenario);
+
     /**
      * Execute application
      * @param argc number of arguments
@@ -157,6 +169,82 @@ class RTPRDriver
      */
     bool runContingencies();
 
+    /**
+     * Run the base case and a set of contingencies
+     * @param tasks indices of contingencies to run. If NULL, run all
+     * contingencies
+     * @param margins if not NULL, return the smallest tie-line loading margin
+     * for the base case in element 0 and for contingency i in element i+1.
+     * Divergent calculations have a margin of -1. Elements for contingencies
+     * that are not run are not modified
+     * @return true if no tie line violations found
+     */
+    bool runContingencies(const std::vector<int> *tasks,
+        std::vector<double> *margins);
+
+    /**
+     * Find the power flow rating by bracketing the rating and refining the
+     * bracket with secant and bisection steps on the tie-line loading
+     * margin. Ratings are rejected using only contingencies that were close
+     * to binding at the last accepted rating, and the screening is refreshed
+     * at every accepted rating. If the base case is secure at a rating of
+     * 1.0, the base case is first scanned for an upper bound using
+     * scanBaseCase
+     * @return power flow rating
+     */
+    double searchPFRating();
+
+    /**
+     * Solve the base case at the ratings that are tried when the rating is
+     * bracketed from above as a single batch of power flow scenarios. A
+     * rating at which the base case is not secure cannot be secure, so the
+     * first of these is an upper bound for the search
+     * @param bound returns the smallest scanned rating at which the base case
+     * is not secure
+     * @param margin returns the tie-line loading margin of the base case at
+     * the bound
+     * @return true if an upper bound was found
+     */
+    bool scanBaseCase(double *bound, double *margin);
+
+    /**
+     * Complete the evaluation of a rating that is secure for the screened
+     * contingencies by running the contingencies that were screened out,
+     * and choose the screened contingencies again from the margins at this
+     * rating
+     * @param rating value of rating parameter
+     * @param screened indices of contingencies that are re-evaluated during
+     * the search. This is updated on return
+     * @param margins tie-line loading margins for the base case and each
+     * contingency (see runContingencies)
+     * @param margin returns the smallest loading margin of the base case and
+     * all contingencies
+     * @return true if the rating is secure for all contingencies
+     */
+    bool acceptPFRating(double rating, std::vector<int> &screened,
+        std::vector<double> &margins, double *margin);
+
+    /**
+     * Evaluate the base case and all contingencies at a single value of the
+     * rating parameter, independently of the rating search
+     * @param rating value of rating parameter
+     * @return true if the rating is secure
+     */
+    bool checkPFRating(double rating);
+
+    /**
+     * @return rating found by the last call to execute
+     */
+    double getRating() const;
+
+    /**
+     * Find the dynamic simulation rating by bracketing the rating below an
+     * upper bound and refining the bracket by bisection
+     * @param upper upper bound on the rating
+     * @return dynamic simulation rating
+     */
+    double searchDSRating(double upper);
+
     /**
      * Run dynamic simulations over full set of contingencies
      * @return true if no violations found on complete set of contingencies
@@ -175,6 +263,29 @@ class RTPRDriver
 
     private:
 
+    /**
+     * Evaluate the power flow contingencies for a single value of the rating
+     * parameter
+     * @param rating value of rating parameter
+     * @param tasks indices of contingencies to run. If NULL, run all
+     * contingencies
+     * @param margins tie-line loading margins for the base case and each
+     * contingency (see runContingencies)
+     * @param margin returns the smallest loading margin of the base case and
+     * the contingencies that were run
+     * @return true if the rating is secure
+     */
+    bool evaluatePFRating(double rating, const std::vector<int> *tasks,
+        std::vector<double> &margins, double *margin);
+
+    /**
+     * Evaluate the dynamic simulation contingencies for a single value of the
+     * rating parameter
+     * @param rating value of rating parameter
+     * @return true if the rating is secure
+     */
+    bool evaluateDSRating(double rating);
+
     boost::shared_ptr<gridpack::powerflow::PFNetwork> p_pf_network;
 
     boost::shared_ptr<gridpack::dynamic_simulation::DSFullNetwork>
@@ -211,6 +322,26 @@ class RTPRDriver
 
     bool p_useRateB;
 
+    // Use fixed increments instead of secant/bisection search for rating
+    bool p_incrementSearch;
+
+    // Resolution of rating search
+    double p_ratingTolerance;
+
+    // Initial step used to bracket the rating
+    double p_ratingStep;
+
+    // Contingencies with a tie-line loading margin below this value are
+    // re-evaluated during the rating search
+    double p_screeningMargin;
+
+    // Number of ratings above 1.0 at which the base case is solved before
+    // contingencies are run
+    int p_baseCaseScan;
+
+    // Accumulate branch flow statistics in streaming mode
+    bool p_streamingStats;
+
     std::vector<int> p_watch_busIDs;
     std::vector<std::string> p_watch_genIDs;
 
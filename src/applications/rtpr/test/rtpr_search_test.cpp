@@ -0,0 +1,97 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   rtpr_search_test.cpp
+ * @date   October 19, 2026
+ *
+ * @brief  Find the power flow rating of the 14 bus system with the
+ * secant/bisection search, using a screened set of contingencies and a
+ * batched scan of the base case, and check it against a brute force scan
+ * that evaluates all contingencies at every rating in steps of the rating
+ * tolerance. Run as "rtpr_search_test.x input_14_search.xml"
+ */
+// -------------------------------------------------------------
+
+#include <math.h>
+#include "mpi.h"
+#include <ga.h>
+#include <macdecls.h>
+#include "gridpack/include/gridpack.hpp"
+#include "rtpr_driver.hpp"
+
+// Limit on the number of ratings evaluated by the brute force scan
+#define MAX_SCAN 200
+
+int
+main(int argc, char **argv)
+{
+  gridpack::Environment env(argc,argv);
+  int ret = 0;
+
+  if (1) {
+    gridpack::parallel::Communicator world;
+    char inputfile[256];
+    if (argc >= 2 && argv[1] != NULL) {
+      sprintf(inputfile,"%s",argv[1]);
+    } else {
+      sprintf(inputfile,"%s","input_14_search.xml");
+    }
+    char *args[2];
+    args[0] = argv[0];
+    args[1] = inputfile;
+
+    gridpack::rtpr::RTPRDriver driver;
+    driver.execute(2,args,env);
+    double rating = driver.getRating();
+
+    gridpack::utility::Configuration *config =
+      gridpack::utility::Configuration::configuration();
+    gridpack::utility::Configuration::CursorPtr cursor =
+      config->getCursor("Configuration.RealTimePathRating");
+    double tol = cursor->get("ratingTolerance",0.01);
+
+    // Brute force scan. Step away from 1.0 in increments of the tolerance
+    // until security changes and keep the largest secure rating
+    double scan = 1.0;
+    bool found = true;
+    int n = 0;
+    if (driver.checkPFRating(1.0)) {
+      while (n < MAX_SCAN && driver.checkPFRating(scan+tol)) {
+        scan += tol;
+        n++;
+      }
+      if (n == MAX_SCAN) found = false;
+    } else {
+      scan = 1.0 - tol;
+      while (scan >= 0.0 && !driver.checkPFRating(scan)) {
+        scan -= tol;
+      }
+      if (scan < 0.0) scan = 0.0;
+    }
+
+    // The search stops when the bracket is narrower than the tolerance, so
+    // it can differ from the scan by up to one tolerance. The rating it
+    // returns must itself be secure
+    bool secure = (rating == 0.0 || driver.checkPFRating(rating));
+    bool ok = found && secure && fabs(rating-scan) <= tol+1.0e-8;
+    if (world.rank() == 0) {
+      printf("\nSearch rating: %f secure: %s brute force rating: %f"
+          " tolerance: %f\n",rating,secure ? "true" : "false",scan,tol);
+      if (!found) {
+        printf("No insecure rating found in %d steps\n",MAX_SCAN);
+      }
+      if (ok) {
+        printf("\nRTPR rating search test passed\n");
+      } else {
+        printf("\nRTPR rating search test failed\n");
+      }
+    }
+    if (!ok) ret = 1;
+  }
+
+  return ret;
+}
@@ -612,6 +612,7 @@ BaseBusComponent::addBranch(const
 {
   boost::weak_ptr<BaseComponent> tbranch(branch);
   p_branches.push_back(tbranch);
+  p_branchPtrs.push_back(branch.get());
 }
 
 /**
@@ -625,6 +626,7 @@ BaseBusComponent::addBus(const
 {
   boost::weak_ptr<BaseComponent> tbus(bus);
   p_buses.push_back(tbus);
+  p_busPtrs.push_back(bus.get());
 }
 
 /**
@@ -665,6 +667,7 @@ void BaseBusComponent::getNeighborBuses(
 void BaseBusComponent::clearBranches(void)
 {
   p_branches.clear();
+  p_branchPtrs.clear();
 }
 
 /**
@@ -673,6 +676,45 @@ void BaseBusComponent::clearBranches(void)
 void BaseBusComponent::clearBuses(void)
 {
   p_buses.clear();
+  p_busPtrs.clear();
+}
+
+/**
+ * Get number of branches that are connected to bus
+ * @return number of neighboring branches
+ */
+int BaseBusComponent::numNeighborBranches(void) const
+{
+  return p_branchPtrs.size();
+}
+
+/**
+ * Get pointer to a branch that is connected to bus
+ * @param idx index of neighboring branch
+ * @return pointer to neighboring branch
+ */
+BaseComponent* BaseBusComponent::getNeighborBranch(int idx) const
+{
+  return p_branchPtrs[idx];
+}
+
+/**
+ * Get number of buses that are connected to bus via a branch
+ * @return number of neighboring buses
+ */
+int BaseBusComponent::numNeighborBuses(void) const
+{
+  return p_busPtrs.size();
+}
+
+/**
+ * Get pointer to a bus that is connected to calling bus via a branch
+ * @param idx index of neighboring bus
+ * @return pointer to neighboring bus
+ */
+BaseComponent* BaseBusComponent::getNeighborBus(int idx) const
+{
+  return p_busPtrs[idx];
 }
 
 /**
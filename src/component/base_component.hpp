@@ -562,6 +562,35 @@ class BaseBusComponent
      */
     void clearBuses(void);
 
+    /**
+     * Get number of branches that are connected to bus
+     * @return number of neighboring branches
+     */
+    int numNeighborBranches(void) const;
+
+    /**
+     * Get pointer to a branch that is connected to bus. Unlike
+     * getNeighborBranches, this does not allocate a list or lock any
+     * pointers so it can be used in loops that are evaluated many times
+     * @param idx index of neighboring branch
+     * @return pointer to neighboring branch
+     */
+    BaseComponent* getNeighborBranch(int idx) const;
+
+    /**
+     * Get number of buses that are connected to bus via a branch
+     * @return number of neighboring buses
+     */
+    int numNeighborBuses(void) const;
+
+    /**
+     * Get pointer to a bus that is connected to calling bus via a branch.
+     * This does not allocate a list or lock any pointers
+     * @param idx index of neighboring bus
+     * @return pointer to neighboring bus
+     */
+    BaseComponent* getNeighborBus(int idx) const;
+
     /**
      * Set reference bus status
      * @param status reference bus status
@@ -608,6 +637,13 @@ class BaseBusComponent
      */
     std::vector<boost::weak_ptr<BaseComponent> > p_buses;
 
+    /**
+     * Plain pointers to neighboring branches and buses, in the same order
+     * as p_branches and p_buses. The components are owned by the network
+     */
+    std::vector<BaseComponent*> p_branchPtrs;
+    std::vector<BaseComponent*> p_busPtrs;
+
     /**
      * Is this a reference bus?
      */
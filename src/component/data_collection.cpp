@@ -7,6 +7,47 @@
 #include <iostream>
 #include <cstdio>
 
+namespace {
+
+/**
+ * Heap memory used by a string. Short strings are stored inside the string
+ * object and do not use any additional memory
+ * @param str string
+ * @return memory in bytes
+ */
+size_t heapMemory(const std::string &str)
+{
+  if (str.capacity() > 15) return str.capacity()+1;
+  return 0;
+}
+
+template <class _value>
+size_t heapMemory(const _value &)
+{
+  return 0;
+}
+
+/**
+ * Estimate memory used by map. Each entry is a node holding the key and
+ * value and pointers to its parent and children
+ * @param map map of keys and values
+ * @return memory in bytes
+ */
+template <class _map>
+size_t mapMemory(const _map &map)
+{
+  size_t bytes = sizeof(_map);
+  typename _map::const_iterator it;
+  for (it = map.begin(); it != map.end(); it++) {
+    bytes += sizeof(typename _map::value_type) + 4*sizeof(void*);
+    bytes += heapMemory(it->first);
+    bytes += heapMemory(it->second);
+  }
+  return bytes;
+}
+
+}
+
 /**
  * Simple constructor
  */
@@ -854,3 +895,21 @@ void gridpack::component::DataCollection::dump(void)
     cmplx_it++;
   }
 }
+
+/**
+ * Estimate memory used by data collection, including keys and string
+ * values
+ * @return memory in bytes
+ */
+size_t gridpack::component::DataCollection::memoryUsage(void) const
+{
+  size_t bytes = sizeof(DataCollection);
+  bytes += mapMemory(p_ints);
+  bytes += mapMemory(p_longs);
+  bytes += mapMemory(p_bools);
+  bytes += mapMemory(p_strings);
+  bytes += mapMemory(p_floats);
+  bytes += mapMemory(p_doubles);
+  bytes += mapMemory(p_complexType);
+  return bytes;
+}
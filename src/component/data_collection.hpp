@@ -143,6 +143,13 @@ public:
    * Dump contents of data collection to standard out
    */
   void dump(void);
+
+  /**
+   * Estimate memory used by data collection, including keys and string
+   * values
+   * @return memory in bytes
+   */
+  size_t memoryUsage(void) const;
 private:
 #ifdef OLD_MAP
   std::map<std::string, int> p_ints; 
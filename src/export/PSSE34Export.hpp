@@ -51,7 +51,8 @@ class PSSE34Export
      * Constructor
      */
     explicit PSSE34Export(boost::shared_ptr<_network> network) :
-      p_network(network), p_comm(network->communicator())
+      p_network(network), p_comm(network->communicator()),
+      p_useMPIIO(true)
     {
     }
 
@@ -68,10 +69,19 @@ class PSSE34Export
      */
     void  writeFile(std::string filename) {
       int me = p_comm.rank();
-      std::ofstream fout;
-      if (me == 0) {
-        fout.open(filename.c_str());
+      std::ofstream sout;
+      ExportStream pout(p_comm);
+      std::ostream *fptr;
+      if (p_useMPIIO) {
+        pout.open(filename);
+        fptr = &pout;
+      } else {
+        if (me == 0) {
+          sout.open(filename.c_str());
+        }
+        fptr = &sout;
       }
+      std::ostream &fout = *fptr;
       // Write out individual data blocks
       ExportBus34<_network> buses(p_network);
       buses.writeBusBlock(fout);
@@ -112,14 +122,31 @@ class PSSE34Export
       if (me == 0) {
         // Write closing 'Q'
         fout << "Q" << std::endl;
-        fout.close();
       }
+      if (p_useMPIIO) {
+        pout.close();
+      } else if (me == 0) {
+        sout.close();
+      }
+    }
+
+    /**
+     * Select how the file is written. By default, all processes write
+     * their own records using MPI-IO. Otherwise, records are gathered and
+     * written by process 0
+     * @param flag if true, use MPI-IO
+     */
+    void setMPIIO(bool flag)
+    {
+      p_useMPIIO = flag;
     }
 
   private:
     boost::shared_ptr<_network>      p_network;
 
     gridpack::parallel::Communicator p_comm;
+
+    bool p_useMPIIO;
 };
 
 } /* namespace export */
@@ -16,28 +16,243 @@
 #ifndef BASEEXPORT_HPP_
 #define BASEEXPORT_HPP_
 
+#include <stdio.h>
+#include <string.h>
 #include <iostream>
 #include <string>
 #include <vector>
 #include <map>
+#include <sstream>
+#include <algorithm>
 
 #include "gridpack/parallel/communicator.hpp"
 #include "gridpack/network/base_network.hpp"
+#include "gridpack/utilities/exception.hpp"
 
 #define MAX_STRING_SIZE 1024
 
 namespace gridpack {
 namespace expnet {
 
-  // Data structure used to move around text lines
-  struct text_line {
-    // Global index associated with text line
-    int global_idx;
-    // Device index associated with text line
-    int device_idx;
-    // Output text
-    char text[MAX_STRING_SIZE];
-  }; 
+/**
+ * Records of a data block that are held by one process. The text of all
+ * records is appended to a single buffer, so each record only takes as much
+ * space as its text. Records are identified by the global index of the bus
+ * or branch and the index of the device on the bus or branch.
+ */
+class TextBlock
+{
+  public:
+
+    /**
+     * Constructor
+     */
+    TextBlock()
+    {
+    }
+
+    /**
+     * Add a record to the block
+     * @param global_idx global index of bus or branch
+     * @param device_idx index of device on bus or branch
+     * @param text text of record, including the terminating newline
+     */
+    void add(int global_idx, int device_idx, const char *text)
+    {
+      p_keys.push_back(global_idx);
+      p_keys.push_back(device_idx);
+      p_keys.push_back(strlen(text));
+      p_offsets.push_back(p_text.size());
+      p_text.append(text);
+    }
+
+    /**
+     * @return number of records in block
+     */
+    int size() const
+    {
+      return p_offsets.size();
+    }
+
+    /**
+     * Get the text of all records, ordered by global index and device index
+     * @param text returns concatenated text of records
+     */
+    void sortedText(std::string &text) const
+    {
+      int i;
+      int nsize = size();
+      std::vector<std::pair<std::pair<int,int>,int> > order(nsize);
+      for (i=0; i<nsize; i++) {
+        order[i] = std::make_pair(std::make_pair(p_keys[3*i],
+              p_keys[3*i+1]),i);
+      }
+      std::sort(order.begin(),order.end());
+      text.clear();
+      text.reserve(p_text.size());
+      for (i=0; i<nsize; i++) {
+        int idx = order[i].second;
+        text.append(p_text,p_offsets[idx],p_keys[3*idx+2]);
+      }
+    }
+
+    /**
+     * @return global index, device index and length of each record, stored
+     * consecutively
+     */
+    const std::vector<int>& keys() const
+    {
+      return p_keys;
+    }
+
+    /**
+     * @return text of all records in the order they were added
+     */
+    const std::string& text() const
+    {
+      return p_text;
+    }
+
+  private:
+
+    // Global index, device index and length of each record
+    std::vector<int> p_keys;
+
+    // Offset of each record in p_text
+    std::vector<size_t> p_offsets;
+
+    std::string p_text;
+};
+
+/**
+ * Output stream that writes a file collectively using MPI-IO. Text
+ * written to the stream with the << operator is buffered on the calling
+ * process. Each call to writeBlock appends the buffered text, followed by
+ * the records held by the process, to the file. The contribution from each
+ * process is a variable length buffer and byte offsets are found with an
+ * exclusive scan over processes, so records in a data block are written in
+ * process order. Within a process, records are ordered by global index and
+ * device index. The file must be closed explicitly with close, since
+ * closing the file is a collective operation.
+ */
+class ExportStream : public std::ostream
+{
+  public:
+
+    /**
+     * Constructor
+     * @param comm communicator used to write file
+     */
+    explicit ExportStream(gridpack::parallel::Communicator comm)
+      : std::ostream(NULL), p_comm(comm), p_open(false), p_offset(0)
+    {
+      rdbuf(&p_buf);
+    }
+
+    /**
+     * Destructor. The file is not closed here, since this would require
+     * all processes to destroy the stream at the same time. Files that are
+     * still open are reported
+     */
+    virtual ~ExportStream()
+    {
+      if (p_open) {
+        printf("p[%d] ExportStream destroyed without calling close\n",
+            p_comm.rank());
+      }
+    }
+
+    /**
+     * Open file. This is a collective call. Any existing file is truncated
+     * @param filename name of file
+     */
+    void open(const std::string &filename)
+    {
+      MPI_Comm comm = static_cast<MPI_Comm>(p_comm);
+      int ierr = MPI_File_open(comm, const_cast<char*>(filename.c_str()),
+          MPI_MODE_WRONLY|MPI_MODE_CREATE, MPI_INFO_NULL, &p_fh);
+      if (ierr != MPI_SUCCESS) {
+        char buf[512];
+        sprintf(buf,"ExportStream::open: unable to open file %s\n",
+            filename.c_str());
+        throw gridpack::Exception(buf);
+      }
+      MPI_File_set_size(p_fh, 0);
+      p_open = true;
+      p_offset = 0;
+      p_buf.str("");
+    }
+
+    /**
+     * @return true if file is open
+     */
+    bool is_open() const
+    {
+      return p_open;
+    }
+
+    /**
+     * Write any buffered text and close file. This is a collective call
+     * and must be made on all processes before the stream is destroyed
+     */
+    void close()
+    {
+      if (!p_open) return;
+      std::string chunk = p_buf.str();
+      p_buf.str("");
+      writeChunk(chunk);
+      MPI_File_close(&p_fh);
+      p_open = false;
+    }
+
+    /**
+     * Append buffered text and records from all processes to the file.
+     * This is a collective call
+     * @param block records held by this process
+     */
+    void writeBlock(const TextBlock &block)
+    {
+      std::string records;
+      block.sortedText(records);
+      std::string chunk = p_buf.str();
+      p_buf.str("");
+      chunk.append(records);
+      writeChunk(chunk);
+    }
+
+  private:
+
+    /**
+     * Write contributions from all processes at the current end of the file
+     * @param chunk text contributed by this process
+     */
+    void writeChunk(const std::string &chunk)
+    {
+      MPI_Comm comm = static_cast<MPI_Comm>(p_comm);
+      long long size = chunk.size();
+      long long offset = 0;
+      long long total = 0;
+      MPI_Exscan(&size, &offset, 1, MPI_LONG_LONG, MPI_SUM, comm);
+      if (p_comm.rank() == 0) offset = 0;
+      MPI_Allreduce(&size, &total, 1, MPI_LONG_LONG, MPI_SUM, comm);
+      MPI_Status status;
+      MPI_File_write_at_all(p_fh, static_cast<MPI_Offset>(p_offset+offset),
+          const_cast<char*>(chunk.data()), static_cast<int>(size), MPI_CHAR,
+          &status);
+      p_offset += total;
+    }
+
+    gridpack::parallel::Communicator p_comm;
+
+    std::stringbuf p_buf;
+
+    MPI_File p_fh;
+
+    bool p_open;
+
+    // Current size of file
+    long long p_offset;
+};
 
 template<class _network>
 class BaseExport
@@ -60,126 +275,76 @@ class BaseExport
     /**
      * export text to fstream
      * @param fout stream object to export data
-     * @param text_data vector of text strings that should be written out
-     *                  consecutively, based on values in text_line data
-     *                  data structures.
+     * @param text_data records held by this process. Records are written
+     *                  in order of global index and device index for
+     *                  ordinary streams and in process order for
+     *                  ExportStream
      */
-    void writeDataBlock(std::ofstream &fout, std::vector<text_line> &text_data)
+    void writeDataBlock(std::ostream &fout, const TextBlock &text_data)
     {
-      // Loop through all text_line data structures and find highest value of
-      // global index
-      int i;
-      int nsize = text_data.size();
-      int gmax = -1;
-      for (i=0; i<nsize; i++) {
-        if (text_data[i].global_idx > gmax) gmax = text_data[i].global_idx;
+      // Files opened with MPI-IO are written directly by all processes
+      ExportStream *pout = dynamic_cast<ExportStream*>(&fout);
+      if (pout) {
+        pout->writeBlock(text_data);
+        return;
       }
-      gmax++;
-      p_comm.max(&gmax,1);
-      if (gmax == 0) return;
-      // Create a global array to evaluate offsets
-      int grp = p_comm.getGroup();
-      int one = 1;
-      int ttype = NGA_Register_type(sizeof(text_line));
-      int g_offset = NGA_Create_handle();
-      if (gmax == 0) return;
-      NGA_Set_data(g_offset,one,&gmax,C_INT);
-      NGA_Set_pgroup(g_offset,grp);
-      NGA_Allocate(g_offset);
-      NGA_Zero(g_offset);
-      // Evaluate offsets by accumulating number of text strings to each global
-      // index
-      std::vector<int*> indices;
-      indices.resize(nsize);
-      std::vector<int> ones;
-      ones.resize(nsize);
-      for (i=0; i<nsize; i++) {
-        indices[i] = &text_data[i].global_idx;
-        ones[i] = one;
-      }
-      if (nsize > 0) {
-        NGA_Scatter_acc(g_offset,&ones[0],&indices[0],nsize,&one);
-      }
-      GA_Pgroup_sync(grp);
-      // We now have all the sizes in the g_offset array for each global index.
-      // Count the offsets for each global element locally and then get the
-      // global offsets
-      int lo,hi;
+      // Gather the records on process 0. Each process sends the keys and the
+      // variable length text of its records
+      MPI_Comm comm = static_cast<MPI_Comm>(p_comm);
       int me = p_comm.rank();
       int nproc = p_comm.size();
-      NGA_Distribution(g_offset,me,&lo,&hi);
-      int nelem = hi-lo+1;
-      int ld;
-      int *ptr;
-      if (nelem > 0) {
-        NGA_Access(g_offset,&lo,&hi,&ptr,&ld);
-      }
-      std::vector<int> offsets;
-      offsets.resize(nelem);
-      if (nelem > 0) offsets[0] = 0;
-      int tmp;
-      int total = 0;
-      if (nelem > 0) total = ptr[0];
-      for (i=1; i<nelem; i++) {
-        offsets[i] = offsets[i-1]+ptr[i-1];
-        total += ptr[i];
-      }
-      for (i=0; i<nelem; i++) {
-        ptr[i] = offsets[i];
-      }
-      // Get total number of elements across all processors
-      std::vector<int> block_sizes;
-      block_sizes.resize(nproc);
-      for (i=0; i<nproc; i++) block_sizes[i] = 0;
-      block_sizes[me] = total;
-      p_comm.sum(&block_sizes[0],nproc);
-      int loffset = 0;
-      for (i=0; i<me; i++) loffset += block_sizes[i];
-      total = 0;
-      for (i=0; i<nproc; i++) total += block_sizes[i];
-      // finish up evaluation of offset array
-      for (i=0; i<nelem; i++) ptr[i] = ptr[i]+loffset;
-      if (nelem > 0) {
-        NGA_Release(g_offset,&lo,&hi);
-      }
-
-      // Create global array to hold all text_data
-      int g_txt = NGA_Create_handle();
-      NGA_Set_pgroup(g_txt,grp);
-      NGA_Set_data(g_txt,one,&total,ttype);
-      NGA_Allocate(g_txt);
-      // Find location of each text_line in g_txt
-      std::vector<int> tidx;
-      tidx.resize(nsize);
-      NGA_Gather(g_offset,&tidx[0],&indices[0],nsize);
-      // We now have the offset for the global index. Need to augment it by the
-      // device index to get a unique location
-      for (i=0; i<nsize; i++) {
-        tidx[i] = tidx[i] + text_data[i].device_idx;
-        indices[i] = &tidx[i];
+      int i;
+      int sizes[2];
+      sizes[0] = text_data.keys().size();
+      sizes[1] = text_data.text().size();
+      std::vector<int> all_sizes(2*nproc);
+      MPI_Gather(sizes,2,MPI_INT,&all_sizes[0],2,MPI_INT,0,comm);
+      std::vector<int> nkeys(nproc), koffset(nproc);
+      std::vector<int> nchar(nproc), coffset(nproc);
+      int ktotal = 0;
+      int ctotal = 0;
+      if (me == 0) {
+        for (i=0; i<nproc; i++) {
+          nkeys[i] = all_sizes[2*i];
+          nchar[i] = all_sizes[2*i+1];
+          koffset[i] = ktotal;
+          coffset[i] = ctotal;
+          ktotal += nkeys[i];
+          ctotal += nchar[i];
+        }
       }
-      // Scatter all text strings to g_txt
-      NGA_Scatter(g_txt,&text_data[0],&indices[0],nsize);
-      NGA_Pgroup_sync(grp);
+      std::vector<int> keys(ktotal+1);
+      std::vector<char> text(ctotal+1);
+      MPI_Gatherv(const_cast<int*>(sizes[0] > 0 ? &text_data.keys()[0] : NULL),
+          sizes[0],MPI_INT,&keys[0],&nkeys[0],&koffset[0],MPI_INT,0,comm);
+      MPI_Gatherv(const_cast<char*>(text_data.text().data()),sizes[1],
+          MPI_CHAR,&text[0],&nchar[0],&coffset[0],MPI_CHAR,0,comm);
 
-      // Write out strings from rank 0
+      // Sort all records by global index and device index and write them
+      // out from process 0
       if (me == 0) {
+        int nrec = ktotal/3;
+        std::vector<std::pair<std::pair<int,int>,int> > order(nrec);
+        std::vector<int> start(nrec);
+        int irec = 0;
         int iproc;
         for (iproc=0; iproc<nproc; iproc++) {
-          NGA_Distribution(g_txt,iproc,&lo,&hi);
-          std::vector<text_line> lines;
-          int nlines = hi-lo+1;
-          lines.resize(nlines);
-          if (nlines > 0) NGA_Get(g_txt,&lo,&hi,&lines[0],&one);
-          for (i=0; i<nlines; i++) {
-            fout << lines[i].text;
+          int ioff = coffset[iproc];
+          int nlocal = nkeys[iproc]/3;
+          for (i=0; i<nlocal; i++) {
+            int *key = &keys[3*irec];
+            order[irec] = std::make_pair(std::make_pair(key[0],key[1]),irec);
+            start[irec] = ioff;
+            ioff += key[2];
+            irec++;
           }
         }
+        std::sort(order.begin(),order.end());
+        for (i=0; i<nrec; i++) {
+          int idx = order[i].second;
+          fout.write(&text[start[idx]],keys[3*idx+2]);
+        }
       }
-      // Clean up data
-      NGA_Destroy(g_offset);
-      NGA_Destroy(g_txt);
-      NGA_Deregister_type(ttype);
     }
 
   private:
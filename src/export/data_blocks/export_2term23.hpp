@@ -54,7 +54,7 @@ class Export2Term23
      *                  consecutively, based on values in text_line data
      *                  data structures.
      */
-    void write2TermBlock(std::ofstream &fout)
+    void write2TermBlock(std::ostream &fout)
     {
       int me = p_comm.rank();
       // BaseExport<_network> exprt(p_comm);
@@ -54,7 +54,7 @@ class ExportArea23
      *                  consecutively, based on values in text_line data
      *                  data structures.
      */
-    void writeAreaBlock(std::ofstream &fout)
+    void writeAreaBlock(std::ostream &fout)
     {
       BaseExport<_network> exprt(p_comm);
       int me = p_comm.rank();
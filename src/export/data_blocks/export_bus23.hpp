@@ -54,7 +54,7 @@ class ExportBus23
      *                  consecutively, based on values in text_line data
      *                  data structures.
      */
-    void writeBusBlock(std::ofstream &fout)
+    void writeBusBlock(std::ostream &fout)
     {
       BaseExport<_network> exprt(p_comm);
       int me = p_comm.rank();
@@ -63,7 +63,7 @@ class ExportBus23
       gridpack::component::DataCollection *data;
       int i;
       char buf[MAX_STRING_SIZE];
-      std::vector<text_line> text_data;
+      TextBlock text_data;
       // Find value of SBASE and CASE_ID
       double sbase = 0.0;
       double case_id = 0;
@@ -134,11 +134,7 @@ class ExportBus23
           ival = 1;
           data->getValue(BUS_ZONE,&ival); 
           sprintf(ptr," %d\n",ival);
-          text_line text;
-          strcpy(text.text,buf);
-          text.global_idx = p_network->getGlobalBusIndex(i);
-          text.device_idx = 0;
-          text_data.push_back(text);
+          text_data.add(p_network->getGlobalBusIndex(i),0,buf);
         }
       }
       if (me == 0) {
@@ -54,7 +54,7 @@ class ExportBus33
      *                  consecutively, based on values in text_line data
      *                  data structures.
      */
-    void writeBusBlock(std::ofstream &fout)
+    void writeBusBlock(std::ostream &fout)
     {
       BaseExport<_network> exprt(p_comm);
       int me = p_comm.rank();
@@ -63,7 +63,7 @@ class ExportBus33
       gridpack::component::DataCollection *data;
       int i;
       char buf[MAX_STRING_SIZE];
-      std::vector<text_line> text_data;
+      TextBlock text_data;
       // Find value of SBASE and CASE_ID
       double sbase = 0.0;
       double case_id = 0;
@@ -133,11 +133,7 @@ class ExportBus33
           ptr += strlen(ptr);
           // Just write default values for emergency max and min limits
           sprintf(ptr," 1.1, 0.9\n");
-          text_line text;
-          strcpy(text.text,buf);
-          text.global_idx = p_network->getGlobalBusIndex(i);
-          text.device_idx = 0;
-          text_data.push_back(text);
+          text_data.add(p_network->getGlobalBusIndex(i),0,buf);
         }
       }
       if (me == 0) {
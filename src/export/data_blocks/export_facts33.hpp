@@ -54,7 +54,7 @@ class ExportFACTS33
      *                  consecutively, based on values in text_line data
      *                  data structures.
      */
-    void writeFACTSBlock(std::ofstream &fout)
+    void writeFACTSBlock(std::ostream &fout)
     {
       int me = p_comm.rank();
       // BaseExport<_network> exprt(p_comm);
@@ -54,7 +54,7 @@ class ExportGen23
      *                  consecutively, based on values in text_line data
      *                  data structures.
      */
-    void writeGenBlock(std::ofstream &fout)
+    void writeGenBlock(std::ostream &fout)
     {
       BaseExport<_network> exprt(p_comm);
       int me = p_comm.rank();
@@ -63,7 +63,7 @@ class ExportGen23
       gridpack::component::DataCollection *data;
       int i, j;
       char buf[MAX_STRING_SIZE];
-      std::vector<text_line> text_data;
+      TextBlock text_data;
       for (i=0; i<nbus; i++) {
         if (p_network->getActiveBus(i)) {
           data = p_network->getBusData(i).get();
@@ -179,11 +179,7 @@ class ExportGen23
             rval = -9999.0;
             data->getValue(GENERATOR_PMIN,&rval,j);
             sprintf(ptr," %f\n",rval);
-            text_line text;
-            strcpy(text.text,buf);
-            text.global_idx = p_network->getGlobalBusIndex(i);
-            text.device_idx = j;
-            text_data.push_back(text);
+            text_data.add(p_network->getGlobalBusIndex(i),j,buf);
           }
         }
       }
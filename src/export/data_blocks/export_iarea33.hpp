@@ -54,7 +54,7 @@ class ExportInterArea33
      *                  consecutively, based on values in text_line data
      *                  data structures.
      */
-    void writeInterAreaBlock(std::ofstream &fout)
+    void writeInterAreaBlock(std::ostream &fout)
     {
       int me = p_comm.rank();
       // BaseExport<_network> exprt(p_comm);
@@ -54,7 +54,7 @@ class ExportImpedCorr33
      *                  consecutively, based on values in text_line data
      *                  data structures.
      */
-    void writeImpedCorrBlock(std::ofstream &fout)
+    void writeImpedCorrBlock(std::ostream &fout)
     {
       int me = p_comm.rank();
       // BaseExport<_network> exprt(p_comm);
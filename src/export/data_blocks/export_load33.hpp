@@ -54,7 +54,7 @@ class ExportLoad33
      *                  consecutively, based on values in text_line data
      *                  data structures.
      */
-    void writeLoadBlock(std::ofstream &fout)
+    void writeLoadBlock(std::ostream &fout)
     {
       BaseExport<_network> exprt(p_comm);
       int me = p_comm.rank();
@@ -63,7 +63,7 @@ class ExportLoad33
       gridpack::component::DataCollection *data;
       int i, j;
       char buf[MAX_STRING_SIZE];
-      std::vector<text_line> text_data;
+      TextBlock text_data;
       double pl, ql;
       for (i=0; i<nbus; i++) {
         if (p_network->getActiveBus(i)) {
@@ -131,11 +131,7 @@ class ExportLoad33
             sprintf(ptr," %d,",ival);
             ptr += strlen(ptr);
             sprintf(ptr," 1, 0\n");
-            text_line text;
-            strcpy(text.text,buf);
-            text.global_idx = p_network->getGlobalBusIndex(i);
-            text.device_idx = j;
-            text_data.push_back(text);
+            text_data.add(p_network->getGlobalBusIndex(i),j,buf);
           }
         }
       }
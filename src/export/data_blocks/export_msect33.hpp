@@ -54,7 +54,7 @@ class ExportMultiSect33
      *                  consecutively, based on values in text_line data
      *                  data structures.
      */
-    void writeMultiSectBlock(std::ofstream &fout)
+    void writeMultiSectBlock(std::ostream &fout)
     {
       int me = p_comm.rank();
       // BaseExport<_network> exprt(p_comm);
@@ -54,7 +54,7 @@ class ExportMultiTerm33
      *                  consecutively, based on values in text_line data
      *                  data structures.
      */
-    void writeMultiTermBlock(std::ofstream &fout)
+    void writeMultiTermBlock(std::ostream &fout)
     {
       int me = p_comm.rank();
       // BaseExport<_network> exprt(p_comm);
@@ -54,7 +54,7 @@ class ExportOwner33
      *                  consecutively, based on values in text_line data
      *                  data structures.
      */
-    void writeOwnerBlock(std::ofstream &fout)
+    void writeOwnerBlock(std::ostream &fout)
     {
       int me = p_comm.rank();
       // BaseExport<_network> exprt(p_comm);
@@ -54,7 +54,7 @@ class ExportSwShnt33
      *                  consecutively, based on values in text_line data
      *                  data structures.
      */
-    void writeSwShntBlock(std::ofstream &fout)
+    void writeSwShntBlock(std::ostream &fout)
     {
       BaseExport<_network> exprt(p_comm);
       int me = p_comm.rank();
@@ -63,7 +63,7 @@ class ExportSwShnt33
       gridpack::component::DataCollection *data;
       int i;
       char buf[MAX_STRING_SIZE];
-      std::vector<text_line> text_data;
+      TextBlock text_data;
       for (i=0; i<nbus; i++) {
         if (p_network->getActiveBus(i)) {
           data = p_network->getBusData(i).get();
@@ -124,11 +124,7 @@ class ExportSwShnt33
               icnt++;
             }
             sprintf(ptr,"\n");
-            text_line text;
-            strcpy(text.text,buf);
-            text.global_idx = p_network->getGlobalBusIndex(i);
-            text.device_idx = 0;
-            text_data.push_back(text);
+            text_data.add(p_network->getGlobalBusIndex(i),0,buf);
           }
         }
       }
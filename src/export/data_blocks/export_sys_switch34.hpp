@@ -54,7 +54,7 @@ class ExportSysSwitch34
      *                  consecutively, based on values in text_line data
      *                  data structures.
      */
-    void writeSysSwitchBlock(std::ofstream &fout)
+    void writeSysSwitchBlock(std::ostream &fout)
     {
       int me = p_comm.rank();
       // BaseExport<_network> exprt(p_comm);
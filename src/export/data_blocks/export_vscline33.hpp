@@ -54,7 +54,7 @@ class ExportVSCLine33
      *                  consecutively, based on values in text_line data
      *                  data structures.
      */
-    void writeVSCLineBlock(std::ofstream &fout)
+    void writeVSCLineBlock(std::ostream &fout)
     {
       int me = p_comm.rank();
       // BaseExport<_network> exprt(p_comm);
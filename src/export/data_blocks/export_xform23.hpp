@@ -54,7 +54,7 @@ class ExportXform23
      *                  consecutively, based on values in text_line data
      *                  data structures.
      */
-    void writeXformBlock(std::ofstream &fout)
+    void writeXformBlock(std::ostream &fout)
     {
       BaseExport<_network> exprt(p_comm);
       int me = p_comm.rank();
@@ -63,7 +63,7 @@ class ExportXform23
       gridpack::component::DataCollection *data;
       int i, j;
       char buf[MAX_STRING_SIZE];
-      std::vector<text_line> text_data;
+      TextBlock text_data;
       for (i=0; i<nbranch; i++) {
         if (p_network->getActiveBranch(i)) {
           data = p_network->getBranchData(i).get();
@@ -126,11 +126,7 @@ class ExportXform23
               ival = 0;
               data->getValue(TRANSFORMER_TAB,&ival,j);
               sprintf(ptr," %d\n",ival);
-              text_line text;
-              strcpy(text.text,buf);
-              text.global_idx = p_network->getGlobalBranchIndex(i);
-              text.device_idx = j;
-              text_data.push_back(text);
+              text_data.add(p_network->getGlobalBranchIndex(i),j,buf);
             }
           }
         }
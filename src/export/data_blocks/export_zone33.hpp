@@ -54,7 +54,7 @@ class ExportZone33
      *                  consecutively, based on values in text_line data
      *                  data structures.
      */
-    void writeZoneBlock(std::ofstream &fout)
+    void writeZoneBlock(std::ostream &fout)
     {
       int me = p_comm.rank();
       // BaseExport<_network> exprt(p_comm);
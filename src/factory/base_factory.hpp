@@ -21,6 +21,7 @@
 #include <vector>
 #include "boost/smart_ptr/shared_ptr.hpp"
 #include "gridpack/timer/coarse_timer.hpp"
+#include "gridpack/parallel/reduction_batch.hpp"
 #include "gridpack/network/base_network.hpp"
 #include "gridpack/component/base_component.hpp"
 
@@ -407,22 +408,9 @@ class BaseFactory {
      * @return true if flag is true on all processors, false otherwise
      */
     bool checkTrue(bool flag) {
-      int iok;
-      if (flag) {
-        iok = 1;
-      } else {
-        iok = 0;
-      }
-      int grp = p_network->communicator().getGroup();
-      int nprocs = GA_Pgroup_nnodes(grp);
-      char cplus[2];
-      strcpy(cplus,"+");
-      GA_Pgroup_igop(grp,&iok,1,cplus);
-      if (iok == nprocs) {
-        return true;
-      } else {
-        return false;
-      }
+      flags().set(p_flagAll, flag ? 1.0 : 0.0);
+      p_flags->reduce();
+      return p_flags->flag(p_flagAll);
     }
 
     /**
@@ -432,22 +420,61 @@ class BaseFactory {
      * @return true if flag is true on at least one processor, false otherwise
      */
     bool checkTrueSomewhere(bool flag) {
-      int iok;
-      if (flag) {
-        iok = 1;
-      } else {
-        iok = 0;
-      }
-      int grp = p_network->communicator().getGroup();
-      int nprocs = GA_Pgroup_nnodes(grp);
-      char cplus[2];
-      strcpy(cplus,"+");
-      GA_Pgroup_igop(grp,&iok,1,cplus);
-      if (iok > 0) {
-        return true;
-      } else {
-        return false;
-      }
+      flags().set(p_flagAny, flag ? 1.0 : 0.0);
+      p_flags->reduce();
+      return p_flags->flag(p_flagAny);
+    }
+
+    /**
+     * Add a check to see if something is true on all processors to the
+     * current group of checks. All checks in the group are completed with a
+     * single collective, which is started by startChecks and completed by
+     * the first call to checkResult
+     * @param flag boolean flag on each processor
+     * @return handle that can be passed to checkResult
+     */
+    int addCheckTrue(bool flag) {
+      return checks().addAll(flag);
+    }
+
+    /**
+     * Add a check to see if something is true on at least one processor to
+     * the current group of checks
+     * @param flag boolean flag on each processor
+     * @return handle that can be passed to checkResult
+     */
+    int addCheckTrueSomewhere(bool flag) {
+      return checks().addAny(flag);
+    }
+
+    /**
+     * Start a non-blocking reduction of all checks in the current group.
+     * Local work can be done before the results are retrieved with
+     * checkResult
+     */
+    void startChecks(void) {
+      checks().start();
+    }
+
+    /**
+     * Get the result of a check. This waits for the reduction started by
+     * startChecks to complete, or reduces the group if it has not been
+     * started
+     * @param handle handle returned by addCheckTrue or addCheckTrueSomewhere
+     * @return result of check
+     */
+    bool checkResult(int handle) {
+      gridpack::parallel::ReductionBatch &batch = checks();
+      if (!batch.test() && !batch.pending()) batch.reduce();
+      return batch.flag(handle);
+    }
+
+    /**
+     * Remove all checks from the current group so that a new group can be
+     * started. Handles from the previous group are no longer valid
+     */
+    void clearChecks(void) {
+      checks().clear();
     }
 
     /**
@@ -557,6 +584,42 @@ class BaseFactory {
     gridpack::component::BaseBusComponent **p_buses;
 
     gridpack::component::BaseBranchComponent **p_branches;
+
+  private:
+
+    /**
+     * @return batch used by checkTrue and checkTrueSomewhere
+     */
+    gridpack::parallel::ReductionBatch& flags(void) {
+      if (!p_flags) {
+        p_flags.reset(new gridpack::parallel::ReductionBatch(
+              p_network->communicator()));
+        p_flagAll = p_flags->addAll(true);
+        p_flagAny = p_flags->addAny(false);
+      }
+      return *p_flags;
+    }
+
+    /**
+     * @return batch holding the current group of checks
+     */
+    gridpack::parallel::ReductionBatch& checks(void) {
+      if (!p_checks) {
+        p_checks.reset(new gridpack::parallel::ReductionBatch(
+              p_network->communicator()));
+      }
+      return *p_checks;
+    }
+
+    /// Reusable batch for checkTrue and checkTrueSomewhere
+    boost::shared_ptr<gridpack::parallel::ReductionBatch> p_flags;
+
+    int p_flagAll;
+
+    int p_flagAny;
+
+    /// Group of checks started with addCheckTrue and addCheckTrueSomewhere
+    boost::shared_ptr<gridpack::parallel::ReductionBatch> p_checks;
 };
 
 }    // factory
@@ -13,6 +13,8 @@
 #include "gridpack/component/base_analytics_intfc.hpp"
 #include "gridpack/stream/input_stream.hpp"
 #include "gridpack/analysis/stat_block.hpp"
+#include "gridpack/analysis/streaming_stats.hpp"
+#include "gridpack/analysis/streaming_stat_block.hpp"
 #include "gridpack/analysis/network_analytics.hpp"
 #include "gridpack/configuration/configurable.hpp"
 #include "gridpack/configuration/configuration.hpp"
@@ -36,6 +38,7 @@
 #include "gridpack/parallel/printit.hpp"
 #include "gridpack/parallel/shuffler.hpp"
 #include "gridpack/parallel/task_manager.hpp"
+#include "gridpack/parallel/cost_task_manager.hpp"
 #include "gridpack/parallel/global_store.hpp"
 #include "gridpack/parallel/global_vector.hpp"
 #include "gridpack/parser/PTI23_parser.hpp"
@@ -56,6 +59,8 @@
 #endif
 #include "gridpack/timer/coarse_timer.hpp"
 #include "gridpack/timer/local_timer.hpp"
+#include "gridpack/timer/scoped_timer.hpp"
+#include "gridpack/timer/memory_tracker.hpp"
 #include "gridpack/applications/components/pf_matrix/pf_components.hpp"
 #include "gridpack/applications/components/y_matrix/ymatrix_components.hpp"
 #include "gridpack/applications/components/se_matrix/se_components.hpp"
@@ -69,3 +74,7 @@
 #include "gridpack/applications/modules/dynamic_simulation_full_y/dsf_app_module.hpp"
 #include "gridpack/applications/modules/kalman_ds/kds_factory_module.hpp"
 #include "gridpack/applications/modules/kalman_ds/kds_app_module.hpp"
+#include "gridpack/applications/modules/network_reduction/nr_ward_reduction.hpp"
+#include "gridpack/applications/modules/network_reduction/nr_coherency.hpp"
+#include "gridpack/applications/modules/small_signal/ss_analysis.hpp"
+#include "gridpack/applications/modules/parareal/parareal_driver.hpp"
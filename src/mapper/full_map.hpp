@@ -19,6 +19,7 @@
 
 //#define NZ_PER_ROW
 
+#include <vector>
 #include <boost/smart_ptr/shared_ptr.hpp>
 #include <ga.h>
 #include "gridpack/parallel/parallel.hpp"
@@ -27,6 +28,7 @@
 #include <gridpack/network/base_network.hpp>
 #include <gridpack/math/matrix.hpp>
 #include <gridpack/utilities/exception.hpp>
+#include <gridpack/timer/memory_tracker.hpp>
 
 #define DBG_CHECK
 
@@ -77,11 +79,16 @@ FullMatrixMap(boost::shared_ptr<_network> network)
   GA_Pgroup_sync(p_GAgrp);
   setBusOffsets();
   setBranchOffsets();
+  setContributionSlots();
+  recordMemory();
 
 }
 
 ~FullMatrixMap()
 {
+  gridpack::utility::MemoryTracker *tracker
+    = gridpack::utility::MemoryTracker::instance();
+  tracker->release(tracker->createCategory("Mapper: Index Arrays"), this);
   if (p_i_busOffsets != NULL) delete [] p_i_busOffsets;
   if (p_j_busOffsets != NULL) delete [] p_j_busOffsets;
   if (p_i_branchOffsets != NULL) delete [] p_i_branchOffsets;
@@ -344,6 +351,123 @@ void incrementMatrix(boost::shared_ptr<gridpack::math::Matrix> &matrix)
   incrementMatrix(*matrix);
 }
 
+/**
+ * Increment elements of existing matrix using only the contributions from a
+ * selected set of buses and branches. This can be used to apply a small
+ * number of changes (e.g. branch trips or load changes) without evaluating
+ * every component in the network. The sparsity pattern of the matrix is
+ * unchanged so a solver built on this matrix can reuse its symbolic
+ * factorization. This is a collective operation; processors with no changes
+ * should pass empty lists.
+ * @param matrix existing matrix (should be generated from same mapper)
+ * @param buses local indices of buses that contribute changes
+ * @param branches local indices of branches that contribute changes
+ */
+void incrementMatrix(gridpack::math::Matrix &matrix,
+    const std::vector<int> &buses, const std::vector<int> &branches)
+{
+  GA_Pgroup_sync(p_GAgrp);
+  loadBusData(matrix,true,buses);
+  loadBranchData(matrix,true,branches);
+  GA_Pgroup_sync(p_GAgrp);
+  matrix.ready();
+}
+
+/**
+ * Increment elements of existing matrix using only the contributions from a
+ * selected set of buses and branches
+ * @param matrix existing matrix (should be generated from same mapper)
+ * @param buses local indices of buses that contribute changes
+ * @param branches local indices of branches that contribute changes
+ */
+void incrementMatrix(boost::shared_ptr<gridpack::math::Matrix> &matrix,
+    const std::vector<int> &buses, const std::vector<int> &branches)
+{
+  incrementMatrix(*matrix, buses, branches);
+}
+
+/**
+ * Overwrite elements of existing matrix using only the contributions from a
+ * selected set of buses and branches
+ * @param matrix existing matrix (should be generated from same mapper)
+ * @param buses local indices of buses that contribute changes
+ * @param branches local indices of branches that contribute changes
+ */
+void overwriteMatrix(gridpack::math::Matrix &matrix,
+    const std::vector<int> &buses, const std::vector<int> &branches)
+{
+  GA_Pgroup_sync(p_GAgrp);
+  loadBusData(matrix,false,buses);
+  loadBranchData(matrix,false,branches);
+  GA_Pgroup_sync(p_GAgrp);
+  matrix.ready();
+}
+
+/**
+ * Overwrite elements of existing matrix using only the contributions from a
+ * selected set of buses and branches
+ * @param matrix existing matrix (should be generated from same mapper)
+ * @param buses local indices of buses that contribute changes
+ * @param branches local indices of branches that contribute changes
+ */
+void overwriteMatrix(boost::shared_ptr<gridpack::math::Matrix> &matrix,
+    const std::vector<int> &buses, const std::vector<int> &branches)
+{
+  overwriteMatrix(*matrix, buses, branches);
+}
+
+/**
+ * Get the location in the matrix of the blocks associated with each bus.
+ * Offsets are returned for all active buses that contribute a diagonal block
+ * and for all ghost buses that are at the end of a branch contributing an
+ * off-diagonal block to a row on this processor. Other buses have offsets of
+ * -1. The network must be in the same mode as when the mapper was created.
+ * This can be used to write values directly into a matrix generated by this
+ * mapper
+ * @param iOffsets row offset of the block for each local bus
+ * @param jOffsets column offset of the block for each local bus
+ */
+void getBusOffsets(std::vector<int> &iOffsets, std::vector<int> &jOffsets)
+{
+  int i,idx,jdx,isize,jsize,bus1,bus2;
+  iOffsets.assign(p_nBuses,-1);
+  jOffsets.assign(p_nBuses,-1);
+  int jcnt = 0;
+  for (i=0; i<p_nBuses; i++) {
+    if (p_network->getActiveBus(i)) {
+      if (p_network->getBus(i)->matrixDiagSize(&isize,&jsize)) {
+        iOffsets[i] = p_i_busOffsets[jcnt];
+        jOffsets[i] = p_j_busOffsets[jcnt];
+        jcnt++;
+      }
+    }
+  }
+  // Ghost buses only appear in the off-diagonal blocks, so use the offsets
+  // gathered for the branches (same ordering as setBranchOffsets)
+  boost::shared_ptr<gridpack::component::BaseBranchComponent> branch;
+  jcnt = 0;
+  for (i=0; i<p_nBranches; i++) {
+    branch = p_network->getBranch(i);
+    p_network->getBranchEndpoints(i,&bus1,&bus2);
+    if (branch->matrixForwardSize(&isize,&jsize)) {
+      branch->getMatVecIndices(&idx, &jdx);
+      if (idx >= p_minRowIndex && idx <= p_maxRowIndex) {
+        iOffsets[bus1] = p_i_branchOffsets[jcnt];
+        jOffsets[bus2] = p_j_branchOffsets[jcnt];
+        jcnt++;
+      }
+    }
+    if (branch->matrixReverseSize(&isize,&jsize)) {
+      branch->getMatVecIndices(&idx, &jdx);
+      if (jdx >= p_minRowIndex && jdx <= p_maxRowIndex) {
+        iOffsets[bus2] = p_i_branchOffsets[jcnt];
+        jOffsets[bus1] = p_j_branchOffsets[jcnt];
+        jcnt++;
+      }
+    }
+  }
+}
+
 /**
  * Check to see if matrix looks well formed. This method runs through all
  * branches and verifies that the dimensions of the branch contributions match
@@ -1270,6 +1394,172 @@ void loadBranchData(boost::shared_ptr<gridpack::math::Matrix> &matrix, bool flag
   loadBranchData(*matrix, flag);
 }
 
+/**
+ * Record the location in the offset arrays of the contribution from each
+ * bus and branch so that contributions from selected components can be
+ * added without looping over the whole network. Must be called after
+ * setBusOffsets and setBranchOffsets
+ */
+void setContributionSlots(void)
+{
+  int i,idx,jdx,isize,jsize;
+  int icnt = 0;
+  p_busSlot.assign(p_nBuses,-1);
+  for (i=0; i<p_nBuses; i++) {
+    if (p_network->getActiveBus(i)) {
+      if (p_network->getBus(i)->matrixDiagSize(&isize,&jsize)) {
+        p_busSlot[i] = icnt;
+        icnt++;
+      }
+    }
+  }
+  icnt = 0;
+  p_forwardSlot.assign(p_nBranches,-1);
+  p_reverseSlot.assign(p_nBranches,-1);
+  boost::shared_ptr<gridpack::component::BaseBranchComponent> branch;
+  for (i=0; i<p_nBranches; i++) {
+    branch = p_network->getBranch(i);
+    if (branch->matrixForwardSize(&isize,&jsize)) {
+      branch->getMatVecIndices(&idx, &jdx);
+      if (idx >= p_minRowIndex && idx <= p_maxRowIndex) {
+        p_forwardSlot[i] = icnt;
+        icnt++;
+      }
+    }
+    if (branch->matrixReverseSize(&isize,&jsize)) {
+      branch->getMatVecIndices(&idx, &jdx);
+      if (jdx >= p_minRowIndex && jdx <= p_maxRowIndex) {
+        p_reverseSlot[i] = icnt;
+        icnt++;
+      }
+    }
+  }
+}
+
+/**
+ * Add diagonal block contributions from selected buses to matrix
+ * @param matrix matrix to which contributions are added
+ * @param flag flag to distinguish new matrix (true) from old (false)
+ * @param buses local indices of buses
+ */
+void loadBusData(gridpack::math::Matrix &matrix, bool flag,
+    const std::vector<int> &buses)
+{
+  int i,idx,jdx,isize,jsize,icnt,slot;
+  int nbus = buses.size();
+  if (nbus == 0) return;
+  boost::shared_ptr<gridpack::component::BaseBusComponent> bus;
+  ComplexType *values = new ComplexType[p_maxIBlock*p_maxJBlock];
+  int j,k;
+  for (i=0; i<nbus; i++) {
+    if (buses[i] < 0 || buses[i] >= p_nBuses) {
+      char buf[256];
+      sprintf(buf,"FullMatrixMap::loadBusData: illegal bus index: %d\n",
+          buses[i]);
+      printf("%s",buf);
+      throw gridpack::Exception(buf);
+    }
+    slot = p_busSlot[buses[i]];
+    if (slot < 0) continue;
+    bus = p_network->getBus(buses[i]);
+    if (bus->matrixDiagSize(&isize,&jsize)) {
+#ifdef DBG_CHECK
+      int ijsize = isize*jsize;
+      for (k=0; k<ijsize; k++) values[k] = 0.0;
+#endif
+      if (bus->matrixDiagValues(values)) {
+        icnt = 0;
+        for (k=0; k<jsize; k++) {
+          jdx = p_j_busOffsets[slot] + k;
+          for (j=0; j<isize; j++) {
+            idx = p_i_busOffsets[slot] + j;
+            if (flag) {
+              matrix.addElement(idx, jdx, values[icnt]);
+            } else {
+              matrix.setElement(idx, jdx, values[icnt]);
+            }
+            icnt++;
+          }
+        }
+      }
+    }
+  }
+  delete [] values;
+}
+
+/**
+ * Add off-diagonal block contributions from selected branches to matrix
+ * @param matrix matrix to which contributions are added
+ * @param flag flag to distinguish new matrix (true) from old (false)
+ * @param branches local indices of branches
+ */
+void loadBranchData(gridpack::math::Matrix &matrix, bool flag,
+    const std::vector<int> &branches)
+{
+  int i,idx,jdx,isize,jsize,icnt,slot;
+  int nbranch = branches.size();
+  if (nbranch == 0) return;
+  boost::shared_ptr<gridpack::component::BaseBranchComponent> branch;
+  ComplexType *values = new ComplexType[p_maxIBlock*p_maxJBlock];
+  int j,k;
+  for (i=0; i<nbranch; i++) {
+    if (branches[i] < 0 || branches[i] >= p_nBranches) {
+      char buf[256];
+      sprintf(buf,"FullMatrixMap::loadBranchData: illegal branch index: %d\n",
+          branches[i]);
+      printf("%s",buf);
+      throw gridpack::Exception(buf);
+    }
+    branch = p_network->getBranch(branches[i]);
+    slot = p_forwardSlot[branches[i]];
+    if (slot >= 0 && branch->matrixForwardSize(&isize,&jsize)) {
+#ifdef DBG_CHECK
+      int ijsize = isize*jsize;
+      for (k=0; k<ijsize; k++) values[k] = 0.0;
+#endif
+      if (branch->matrixForwardValues(values)) {
+        icnt = 0;
+        for (k=0; k<jsize; k++) {
+          jdx = p_j_branchOffsets[slot] + k;
+          for (j=0; j<isize; j++) {
+            idx = p_i_branchOffsets[slot] + j;
+            if (flag) {
+              matrix.addElement(idx, jdx, values[icnt]);
+            } else {
+              matrix.setElement(idx, jdx, values[icnt]);
+            }
+            icnt++;
+          }
+        }
+      }
+    }
+    slot = p_reverseSlot[branches[i]];
+    if (slot >= 0 && branch->matrixReverseSize(&isize,&jsize)) {
+#ifdef DBG_CHECK
+      int ijsize = isize*jsize;
+      for (k=0; k<ijsize; k++) values[k] = 0.0;
+#endif
+      if (branch->matrixReverseValues(values)) {
+        icnt = 0;
+        // Indices are reversed, so switch the ordering of the offsets
+        for (k=0; k<jsize; k++) {
+          idx = p_j_branchOffsets[slot] + k;
+          for (j=0; j<isize; j++) {
+            jdx = p_i_branchOffsets[slot] + j;
+            if (flag) {
+              matrix.addElement(jdx, idx, values[icnt]);
+            } else {
+              matrix.setElement(jdx, idx, values[icnt]);
+            }
+            icnt++;
+          }
+        }
+      }
+    }
+  }
+  delete [] values;
+}
+
 /**
  * Add off-diagonal block contributions from branches to real matrix
  * @param matrix matrix to which contributions are added
@@ -1314,6 +1604,28 @@ void contributions(void)
   }
 }
 
+/**
+ * Report the memory held by the offset arrays to the memory tracker. This
+ * includes the locally held portions of the offset global arrays
+ */
+void recordMemory(void)
+{
+  long bytes = 2*static_cast<long>(p_busContribution)*sizeof(int);
+  bytes += 2*static_cast<long>(p_branchContribution)*sizeof(int);
+  bytes += static_cast<long>(p_busSlot.capacity()+p_forwardSlot.capacity()
+      + p_reverseSlot.capacity())*sizeof(int);
+#ifdef NZ_PER_ROW
+  bytes += static_cast<long>(p_rowBlockSize)*sizeof(int);
+#endif
+  int lo, hi;
+  NGA_Distribution(gaOffsetI, p_me, &lo, &hi);
+  if (lo >= 0 && hi >= lo) bytes += 2*static_cast<long>(hi-lo+1)*sizeof(int);
+  gridpack::utility::MemoryTracker *tracker
+    = gridpack::utility::MemoryTracker::instance();
+  tracker->update(tracker->createCategory("Mapper: Index Arrays"), this,
+      bytes);
+}
+
     // GA information
 int                         p_me;
 int                         p_nNodes;
@@ -1344,6 +1656,12 @@ int*                        p_j_busOffsets;
 int*                        p_i_branchOffsets;
 int*                        p_j_branchOffsets;
 
+    // location of each bus and branch contribution in offset arrays
+    // (-1 if component does not contribute)
+std::vector<int>            p_busSlot;
+std::vector<int>            p_forwardSlot;
+std::vector<int>            p_reverseSlot;
+
     // global matrix block size array
 int                         gaMatBlksI; // g_idx
 int                         gaMatBlksJ; // g_jdx
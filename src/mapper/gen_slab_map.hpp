@@ -266,6 +266,117 @@ void mapToNetwork(boost::shared_ptr<gridpack::math::Matrix> &matrix)
   mapToNetwork(*matrix);
 }
 
+/**
+ * @return number of rows of the slab held by this processor
+ */
+int localRows(void) const
+{
+  return p_maxIndex-p_minIndex+1;
+}
+
+/**
+ * @return number of columns in slab
+ */
+int numColumns(void) const
+{
+  return p_nColumns;
+}
+
+/**
+ * Copy the rows of the slab held by this processor into a dense array in
+ * column-major order. The leading dimension of the array is localRows().
+ * No communication is required
+ * @param data array of size localRows()*numColumns()
+ */
+void mapToDense(ComplexType *data)
+{
+  int i, j, k, ivals, jvals;
+  int nrows = localRows();
+  for (k=0; k<nrows*p_nColumns; k++) data[k] = ComplexType(0.0,0.0);
+  std::vector<ComplexType*> values;
+  for (i=0; i<p_maxValues; i++) {
+    values.push_back(new ComplexType[p_nColumns]);
+  }
+  int *idx = new int[p_maxValues];
+  for (i=0; i<p_nBuses; i++) {
+    if (p_network->getActiveBus(i)) {
+      p_network->getBus(i)->slabSize(&ivals,&jvals);
+      p_network->getBus(i)->slabGetValues(values, idx);
+      for (j=0; j<ivals; j++) {
+        int irow = idx[j] - p_minIndex;
+        for (k=0; k<p_nColumns; k++) {
+          data[k*nrows+irow] = (values[j])[k];
+        }
+      }
+    }
+  }
+  for (i=0; i<p_nBranches; i++) {
+    if (p_network->getActiveBranch(i)) {
+      p_network->getBranch(i)->slabSize(&ivals,&jvals);
+      p_network->getBranch(i)->slabGetValues(values,idx);
+      for (j=0; j<ivals; j++) {
+        if (idx[j] >= p_minIndex && idx[j] <= p_maxIndex) {
+          int irow = idx[j] - p_minIndex;
+          for (k=0; k<p_nColumns; k++) {
+            data[k*nrows+irow] = (values[j])[k];
+          }
+        }
+      }
+    }
+  }
+  for (i=0; i<p_maxValues; i++) {
+    delete [] values[i];
+  }
+  delete [] idx;
+}
+
+/**
+ * Push data from a dense array created by mapToDense onto buses and
+ * branches. All rows used by a component must be held by this processor
+ * @param data array of size localRows()*numColumns() in column-major order
+ */
+void mapToNetwork(const ComplexType *data)
+{
+  int i, j, k, ivals, jvals;
+  int nrows = localRows();
+  ComplexType **values = new ComplexType*[p_maxValues];
+  for (i=0; i<p_maxValues; i++) {
+    values[i] = new ComplexType[p_nColumns];
+  }
+  int *idx = new int[p_maxValues];
+  for (i=0; i<p_nBuses+p_nBranches; i++) {
+    gridpack::component::GenMatVecInterface *comp;
+    if (i < p_nBuses) {
+      if (!p_network->getActiveBus(i)) continue;
+      comp = p_network->getBus(i).get();
+    } else {
+      if (!p_network->getActiveBranch(i-p_nBuses)) continue;
+      comp = p_network->getBranch(i-p_nBuses).get();
+    }
+    comp->slabSize(&ivals,&jvals);
+    if (ivals == 0) continue;
+    comp->slabGetRowIndices(idx);
+    for (j=0; j<ivals; j++) {
+      if (idx[j] < p_minIndex || idx[j] > p_maxIndex) {
+        char buf[256];
+        sprintf(buf,"(GenSlabMap) Slab row %d is not held by process %d\n",
+            idx[j],p_me);
+        throw gridpack::Exception(buf);
+      }
+      int irow = idx[j] - p_minIndex;
+      for (k=0; k<p_nColumns; k++) {
+        (values[j])[k] = data[k*nrows+irow];
+      }
+    }
+    comp->slabSetValues(values);
+  }
+  for (i=0; i<p_maxValues; i++) {
+    delete [] values[i];
+  }
+  delete [] values;
+  delete [] idx;
+}
+
 private:
 
 /**
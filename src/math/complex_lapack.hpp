@@ -0,0 +1,82 @@
+// Emacs Mode Line: -*- Mode:c++;-*-
+// -------------------------------------------------------------
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+// -------------------------------------------------------------
+/**
+ * @file   complex_lapack.hpp
+ * @date   October 19, 2026
+ *
+ * @brief Declarations of the complex double precision BLAS and LAPACK
+ * routines used for small dense problems. These are always complex,
+ * independent of the scalar type of the math library implementation, so
+ * they cannot go through the PETSc BLAS/LAPACK wrappers. Code using them
+ * must link against ${LAPACK_LIBRARIES}, which are located when GridPACK
+ * is configured.
+ *
+ */
+// -------------------------------------------------------------
+
+#ifndef _complex_lapack_hpp_
+#define _complex_lapack_hpp_
+
+#include "gridpack/utilities/complex.hpp"
+
+namespace gridpack {
+namespace math {
+
+/// Integer type used by the (LP64) BLAS and LAPACK libraries
+typedef int LapackInt;
+
+} // namespace math
+} // namespace gridpack
+
+extern "C" {
+
+  /// C = alpha*op(A)*op(A)^T + beta*C, C symmetric
+  void zsyrk_(const char *uplo, const char *trans,
+      const gridpack::math::LapackInt *n, const gridpack::math::LapackInt *k,
+      const gridpack::ComplexType *alpha, const gridpack::ComplexType *a,
+      const gridpack::math::LapackInt *lda,
+      const gridpack::ComplexType *beta, gridpack::ComplexType *c,
+      const gridpack::math::LapackInt *ldc);
+
+  /// C = alpha*op(A)*op(B) + beta*C
+  void zgemm_(const char *transa, const char *transb,
+      const gridpack::math::LapackInt *m, const gridpack::math::LapackInt *n,
+      const gridpack::math::LapackInt *k,
+      const gridpack::ComplexType *alpha, const gridpack::ComplexType *a,
+      const gridpack::math::LapackInt *lda, const gridpack::ComplexType *b,
+      const gridpack::math::LapackInt *ldb,
+      const gridpack::ComplexType *beta, gridpack::ComplexType *c,
+      const gridpack::math::LapackInt *ldc);
+
+  /// LU factorization of a general matrix
+  void zgetrf_(const gridpack::math::LapackInt *m,
+      const gridpack::math::LapackInt *n, gridpack::ComplexType *a,
+      const gridpack::math::LapackInt *lda, gridpack::math::LapackInt *ipiv,
+      gridpack::math::LapackInt *info);
+
+  /// Solve using the LU factorization from zgetrf_
+  void zgetrs_(const char *trans, const gridpack::math::LapackInt *n,
+      const gridpack::math::LapackInt *nrhs, const gridpack::ComplexType *a,
+      const gridpack::math::LapackInt *lda,
+      const gridpack::math::LapackInt *ipiv, gridpack::ComplexType *b,
+      const gridpack::math::LapackInt *ldb, gridpack::math::LapackInt *info);
+
+  /// Eigenvalues and, optionally, left and right eigenvectors of a
+  /// general matrix
+  void zgeev_(const char *jobvl, const char *jobvr,
+      const gridpack::math::LapackInt *n, gridpack::ComplexType *a,
+      const gridpack::math::LapackInt *lda, gridpack::ComplexType *w,
+      gridpack::ComplexType *vl, const gridpack::math::LapackInt *ldvl,
+      gridpack::ComplexType *vr, const gridpack::math::LapackInt *ldvr,
+      gridpack::ComplexType *work, const gridpack::math::LapackInt *lwork,
+      double *rwork, gridpack::math::LapackInt *info);
+}
+
+#endif
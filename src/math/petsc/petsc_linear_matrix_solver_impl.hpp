@@ -51,6 +51,7 @@ public:
     : LinearMatrixSolverImplementation<T, I>(A),
       PETScConfigurable(this->communicator()),
       p_factored(false),
+      p_Aaij(NULL),
       p_orderingType(MATORDERINGND),
 #if defined(PETSC_HAVE_SUPERLU_DIST)
       p_solverPackage(MATSOLVERSUPERLU_DIST),
@@ -75,6 +76,9 @@ public:
       if (ok && p_factored) {
         ierr = MatDestroy(&p_Fmat);
       }
+      if (ok && p_Aaij != NULL) {
+        ierr = MatDestroy(&p_Aaij);
+      }
     } catch (...) {
       // just eat it
     }
@@ -93,6 +97,9 @@ protected:
   /// Is p_Fmat ready?
   mutable bool p_factored;
 
+  /// AIJ copy of a block coefficient matrix, if the solver package needs it
+  mutable Mat p_Aaij;
+
   /// List of supported matrix ordering
   static MatOrderingType p_supportedOrderingType[];
 
@@ -228,6 +235,21 @@ protected:
       MatFactorInfo  info;
       IS perm, iperm;
 
+      // Not all solver packages can factor block (BAIJ) matrices
+      if (matIsBlocked(*A)) {
+        PetscBool available(PETSC_FALSE);
+        ierr = MatGetFactorAvailable(*A, p_solverPackage, p_factorType,
+                                     &available); CHKERRXX(ierr);
+        if (!available) {
+          if (p_Aaij != NULL) {
+            ierr = matConvertAIJ(*A, MAT_REUSE_MATRIX, &p_Aaij); CHKERRXX(ierr);
+          } else {
+            ierr = matConvertAIJ(*A, MAT_INITIAL_MATRIX, &p_Aaij); CHKERRXX(ierr);
+          }
+          A = &p_Aaij;
+        }
+      }
+
       ierr = MatGetOrdering(*A, p_orderingType, &perm, &iperm); CHKERRXX(ierr);
       ierr = MatGetFactor(*A, p_solverPackage, p_factorType, &p_Fmat);CHKERRXX(ierr);
       info.fill = p_fill;
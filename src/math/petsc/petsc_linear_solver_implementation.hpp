@@ -27,6 +27,7 @@
 #include "linear_solver_implementation.hpp"
 #include "petsc_configurable.hpp"
 #include "petsc/petsc_matrix_extractor.hpp"
+#include "petsc/petsc_misc.hpp"
 #include "petsc/petsc_vector_extractor.hpp"
 
 namespace gridpack {
@@ -50,7 +51,9 @@ public:
   PETScLinearSolverImplementation(MatrixType& A)
     : LinearSolverImplementation<T, I>(A),
       PETScConfigurable(this->communicator()),
-      p_matrixSet(false)
+      p_matrixSet(false),
+      p_Aaij(NULL),
+      p_AaijState(0)
   {
     p_no_print = gridpack::NoPrint::instance()->status();
   }
@@ -65,6 +68,9 @@ public:
       if (ok) {
         ierr = KSPDestroy(&p_KSP); CHKERRXX(ierr);
       }
+      if (ok && p_Aaij != NULL) {
+        ierr = MatDestroy(&p_Aaij);
+      }
     } catch (...) {
       // just eat it
     }
@@ -79,6 +85,12 @@ protected:
   /// For constant matrices, has the coefficient matrix been set
   mutable bool p_matrixSet;
 
+  /// AIJ copy of a block coefficient matrix, if the factorization needs it
+  mutable Mat p_Aaij;
+
+  /// Nonzero state of the block matrix when @c p_Aaij was created
+  mutable PetscObjectState p_AaijState;
+
   // Turn off printing
   bool p_no_print;
 
@@ -111,6 +123,48 @@ protected:
     }
   }  
 
+  /// Does the preconditioner use a factorization that cannot handle a block matrix?
+  /**
+   * Some external direct solver packages (e.g. SuperLU_DIST) only
+   * support AIJ matrices.
+   * 
+   * @param A block coefficient matrix
+   * 
+   * @return true if an AIJ copy of @c A is needed
+   */
+  bool p_factorNeedsAIJ(Mat A) const
+  {
+    PetscErrorCode ierr(0);
+    PC pc;
+    PetscBool match(PETSC_FALSE);
+    MatFactorType ftype;
+    ierr = KSPGetPC(p_KSP, &pc); CHKERRXX(ierr);
+    ierr = PetscObjectTypeCompare((PetscObject)pc, PCLU, &match); CHKERRXX(ierr);
+    if (match) {
+      ftype = MAT_FACTOR_LU;
+    } else {
+      ierr = PetscObjectTypeCompare((PetscObject)pc, PCILU, &match); CHKERRXX(ierr);
+      if (match) {
+        ftype = MAT_FACTOR_ILU;
+      } else {
+        ierr = PetscObjectTypeCompare((PetscObject)pc, PCCHOLESKY, &match); CHKERRXX(ierr);
+        if (match) {
+          ftype = MAT_FACTOR_CHOLESKY;
+        } else {
+          ierr = PetscObjectTypeCompare((PetscObject)pc, PCICC, &match); CHKERRXX(ierr);
+          if (!match) return false;
+          ftype = MAT_FACTOR_ICC;
+        }
+      }
+    }
+    MatSolverType stype(NULL);
+    ierr = PCFactorGetMatSolverType(pc, &stype); CHKERRXX(ierr);
+    if (stype == NULL) return false;
+    PetscBool available(PETSC_FALSE);
+    ierr = MatGetFactorAvailable(A, stype, ftype, &available); CHKERRXX(ierr);
+    return !available;
+  }
+
   /// Solve w/ the specified RHS and estimate (result in x)
   void p_solveImpl(MatrixType& A, const VectorType& b, VectorType& x) const
   {
@@ -120,6 +174,23 @@ protected:
 
       if (p_matrixSet && this->p_constSerialMatrix) {
         // KSPSetOperators can be skipped
+      } else if (matIsBlocked(*Amat) && p_factorNeedsAIJ(*Amat)) {
+        // The AIJ copy is kept, so later solves only copy the values and
+        // the KSP only needs a numeric factorization. It is only rebuilt
+        // if the nonzero pattern of the block matrix changes
+        PetscObjectState state;
+        ierr = MatGetNonzeroState(*Amat, &state); CHKERRXX(ierr);
+        if (p_Aaij != NULL && state == p_AaijState) {
+          ierr = matConvertAIJ(*Amat, MAT_REUSE_MATRIX, &p_Aaij); CHKERRXX(ierr);
+        } else {
+          if (p_Aaij != NULL) {
+            ierr = MatDestroy(&p_Aaij); CHKERRXX(ierr);
+          }
+          ierr = matConvertAIJ(*Amat, MAT_INITIAL_MATRIX, &p_Aaij); CHKERRXX(ierr);
+          p_AaijState = state;
+        }
+        ierr = KSPSetOperators(p_KSP, p_Aaij, p_Aaij); CHKERRXX(ierr);
+        p_matrixSet = true;
       } else {
         ierr = KSPSetOperators(p_KSP, *Amat, *Amat); CHKERRXX(ierr);
         p_matrixSet = true;
@@ -63,6 +63,22 @@ public:
 
   /// The number of library elements used to represent a single vector element
   static const unsigned int elementSize = PetscElementSize<TheType>::value;
+
+  /// Block size used for sparse storage
+  /**
+   * If complex values are represented by real values, each element is
+   * a dense 2x2 block, so the matrix can be stored in block (BAIJ)
+   * format.
+   * 
+   * @return block size, 1 if AIJ storage is to be used
+   */
+  static PetscInt sparseBlockSize(void)
+  {
+    if (elementSize > 1 && useBlockMatrix()) {
+      return elementSize;
+    }
+    return 1;
+  }
   
 
   /// Default constructor
@@ -73,7 +89,8 @@ public:
       p_mwrap(new PetscMatrixWrapper(comm, 
                                      local_rows*elementSize, 
                                      local_cols*elementSize, 
-                                     dense))
+                                     dense,
+                                     (dense ? 1 : sparseBlockSize())))
   {
   }
 
@@ -88,7 +105,7 @@ public:
     p_mwrap.reset(new PetscMatrixWrapper(comm, 
                                          local_rows*elementSize, 
                                          local_cols*elementSize, 
-                                         tmp));
+                                         tmp, sparseBlockSize()));
   }
 
   /// Construct a sparse matrix with number of nonzeros in each row
@@ -107,7 +124,7 @@ public:
     p_mwrap.reset(new PetscMatrixWrapper(comm, 
                                          local_rows*elementSize, 
                                          local_cols*elementSize, 
-                                         &tmp[0]));
+                                         &tmp[0], sparseBlockSize()));
   }
 
   /// Make a new instance from an existing PETSc matrix
@@ -342,6 +359,12 @@ protected:
       PetscScalar px[elementSize*elementSize];
       MatrixValueTransferToLibrary<TheType, PetscScalar> trans(1, &tmp, &px[0]);
       trans.go();
+      if (elementSize > 1 && p_mwrap->blockSize() == elementSize) {
+        // the element is a single block, no need to expand indexes
+        PetscInt bi(i), bj(j);
+        ierr = MatSetValuesBlocked(*mat, 1, &bi, 1, &bj, &px[0], mode); CHKERRXX(ierr);
+        return;
+      }
       int n(elementSize);
       PetscInt iidx[elementSize], jidx[elementSize];
       for (int ii = 0; ii < elementSize; ++ii) {
@@ -492,6 +515,14 @@ protected:
       Mat *mat = p_mwrap->getMatrix();
       MPI_Comm comm(PetscObjectComm((PetscObject)*mat));
       PetscInt ncol(this->cols()*elementSize);
+
+      // sub-matrix extraction from a block matrix only works with
+      // whole blocks, so use an AIJ copy
+      Mat aij(NULL);
+      if (p_mwrap->blocked()) {
+        ierr = matConvertAIJ(*mat, MAT_INITIAL_MATRIX, &aij); CHKERRXX(ierr);
+        mat = &aij;
+      }
       
       std::vector<PetscInt> ridx(nrow);
       std::vector<PetscInt> cidx(ncol);
@@ -561,6 +592,9 @@ protected:
       ierr = ISDestroy(&icol); CHKERRXX(ierr);
 
       ierr = MatDestroySubMatrices(1, &sub); CHKERRXX(ierr);
+      if (aij != NULL) {
+        ierr = MatDestroy(&aij); CHKERRXX(ierr);
+      }
       
     } catch (const PETSC_EXCEPTION_TYPE& e) {
       throw PETScException(ierr, e);
@@ -366,6 +366,36 @@ multiply(const MatrixT<RealType, int>& A,
 // -------------------------------------------------------------
 // (Matrix) multiply
 // -------------------------------------------------------------
+// -------------------------------------------------------------
+// blockMatMatMult
+// -------------------------------------------------------------
+/// Matrix-matrix multiply that works if either matrix uses block storage
+/**
+ * PETSc does not support products of block (BAIJ) matrices, so AIJ
+ * copies are used.  The result uses AIJ storage.
+ */
+static PetscErrorCode
+blockMatMatMult(const Mat& A, const Mat& B, Mat *C)
+{
+  PetscErrorCode ierr(0);
+  Mat Atmp(NULL), Btmp(NULL);
+  if (matIsBlocked(A)) {
+    ierr = matConvertAIJ(A, MAT_INITIAL_MATRIX, &Atmp); CHKERRQ(ierr);
+  }
+  if (matIsBlocked(B)) {
+    ierr = matConvertAIJ(B, MAT_INITIAL_MATRIX, &Btmp); CHKERRQ(ierr);
+  }
+  ierr = MatMatMult((Atmp != NULL ? Atmp : A), (Btmp != NULL ? Btmp : B),
+                    MAT_INITIAL_MATRIX, PETSC_DEFAULT, C); CHKERRQ(ierr);
+  if (Atmp != NULL) {
+    ierr = MatDestroy(&Atmp); CHKERRQ(ierr);
+  }
+  if (Btmp != NULL) {
+    ierr = MatDestroy(&Btmp); CHKERRQ(ierr);
+  }
+  return ierr;
+}
+
 template <typename T, typename I>
 void
 multiply(const MatrixT<T, I>& A, const MatrixT<T, I>& B, MatrixT<T, I>& result)
@@ -378,7 +408,7 @@ multiply(const MatrixT<T, I>& A, const MatrixT<T, I>& B, MatrixT<T, I>& result)
     
     try {
       ierr = MatDestroy(Cmat); CHKERRXX(ierr);
-      ierr = MatMatMult(*Amat, *Bmat, MAT_INITIAL_MATRIX, PETSC_DEFAULT, Cmat); CHKERRXX(ierr);
+      ierr = blockMatMatMult(*Amat, *Bmat, Cmat); CHKERRXX(ierr);
     } catch (const PETSC_EXCEPTION_TYPE& e) {
       throw PETScException(ierr, e);
     }
@@ -408,7 +438,7 @@ multiply(const MatrixT<T, I>& A, const MatrixT<T, I>& B)
     Mat Cmat;
 
     try {
-      ierr = MatMatMult(*Amat, *Bmat, MAT_INITIAL_MATRIX, PETSC_DEFAULT, &Cmat); CHKERRXX(ierr);
+      ierr = blockMatMatMult(*Amat, *Bmat, &Cmat); CHKERRXX(ierr);
     } catch (const PETSC_EXCEPTION_TYPE& e) {
       throw PETScException(ierr, e);
     }
@@ -452,7 +482,10 @@ MatrixT<T, I>::storageType(void) const
       result = Dense;
     } else if (stype == MATAIJ || 
                stype == MATSEQAIJ || 
-               stype == MATMPIAIJ) {
+               stype == MATMPIAIJ ||
+               stype == MATBAIJ ||
+               stype == MATSEQBAIJ ||
+               stype == MATMPIBAIJ) {
       result = Sparse;
     } else {
       std::string msg("Matrix: unexpected PETSc storage type: ");
@@ -24,7 +24,9 @@
 #include "mpi.h"
 #include "petsc/petsc_exception.hpp"
 #include "petsc_matrix_wrapper.hpp"
+#include "petsc_misc.hpp"
 #include "implementation_visitor.hpp"
+#include "gridpack/timer/memory_tracker.hpp"
 
 namespace gridpack {
 namespace math {
@@ -58,9 +60,11 @@ PetscMatrixWrapper::getCommunicator(const Mat& m)
  */
 PetscMatrixWrapper::PetscMatrixWrapper(const parallel::Communicator& comm,
                                        const PetscInt& local_rows, const PetscInt& local_cols,
-                                       const bool& dense)
+                                       const bool& dense,
+                                       const PetscInt& block_size)
   : ImplementationVisitable(),
-    p_matrix(), p_matrixWrapped(false), p_destroyWrapped(true)
+    p_matrix(), p_matrixWrapped(false), p_destroyWrapped(true),
+    p_blockSize(block_size)
 {
   p_build_matrix(comm, local_rows, local_cols);
   if (dense) {
@@ -72,9 +76,11 @@ PetscMatrixWrapper::PetscMatrixWrapper(const parallel::Communicator& comm,
 
 PetscMatrixWrapper::PetscMatrixWrapper(const parallel::Communicator& comm,
                                        const PetscInt& local_rows, const PetscInt& local_cols,
-                                       const PetscInt& max_nonzero_per_row)
+                                       const PetscInt& max_nonzero_per_row,
+                                       const PetscInt& block_size)
   : ImplementationVisitable(),
-    p_matrix(), p_matrixWrapped(false), p_destroyWrapped(true)
+    p_matrix(), p_matrixWrapped(false), p_destroyWrapped(true),
+    p_blockSize(block_size)
 {
   p_build_matrix(comm, local_rows, local_cols);
   p_set_sparse_matrix(max_nonzero_per_row);
@@ -82,9 +88,11 @@ PetscMatrixWrapper::PetscMatrixWrapper(const parallel::Communicator& comm,
 
 PetscMatrixWrapper::PetscMatrixWrapper(const parallel::Communicator& comm,
                                        const PetscInt& local_rows, const PetscInt& local_cols,
-                                       const PetscInt *nonzeros_by_row)
+                                       const PetscInt *nonzeros_by_row,
+                                       const PetscInt& block_size)
   : ImplementationVisitable(),
-    p_matrix(), p_matrixWrapped(false), p_destroyWrapped(true)
+    p_matrix(), p_matrixWrapped(false), p_destroyWrapped(true),
+    p_blockSize(block_size)
 {
   p_build_matrix(comm, local_rows, local_cols);
   p_set_sparse_matrix(nonzeros_by_row);
@@ -93,7 +101,8 @@ PetscMatrixWrapper::PetscMatrixWrapper(const parallel::Communicator& comm,
 PetscMatrixWrapper::PetscMatrixWrapper(Mat& m, const bool& copyMat, const bool& destroyMat)
   : ImplementationVisitable(),
     p_matrix(), p_matrixWrapped(false),
-    p_destroyWrapped(p_matrixWrapped ? destroyMat : true)
+    p_destroyWrapped(p_matrixWrapped ? destroyMat : true),
+    p_blockSize(1)
 {
   PetscErrorCode ierr;
   try {
@@ -104,6 +113,7 @@ PetscMatrixWrapper::PetscMatrixWrapper(Mat& m, const bool& copyMat, const bool&
       p_matrix = m;
       p_matrixWrapped = true;
     }
+    ierr = MatGetBlockSize(p_matrix, &p_blockSize); CHKERRXX(ierr);
 
   } catch (const PETSC_EXCEPTION_TYPE& e) {
     throw PETScException(ierr, e);
@@ -114,6 +124,8 @@ PetscMatrixWrapper::PetscMatrixWrapper(Mat& m, const bool& copyMat, const bool&
 PetscMatrixWrapper::~PetscMatrixWrapper(void)
 {
   PetscErrorCode ierr(0);
+  utility::MemoryTracker *tracker = utility::MemoryTracker::instance();
+  tracker->release(tracker->createCategory("Math: PETSc Matrices"), this);
   if (!p_matrixWrapped || (p_matrixWrapped && p_destroyWrapped)) {
     try  {
       PetscBool ok;
@@ -148,8 +160,18 @@ PetscMatrixWrapper::p_build_matrix(const parallel::Communicator& comm,
     PetscInt lcols(local_cols), gcols(PETSC_DECIDE);
     ierr = PetscSplitOwnership(comm, &lcols, &gcols); CHKERRXX(ierr);
     
+    // Block storage is only possible if the blocks do not straddle
+    // processor boundaries
+    if (p_blockSize > 1 &&
+        (lrows % p_blockSize != 0 || lcols % p_blockSize != 0)) {
+      p_blockSize = 1;
+    }
+
     ierr = MatCreate(comm, &p_matrix); CHKERRXX(ierr);
     ierr = MatSetSizes(p_matrix, lrows, lcols, grows, gcols); CHKERRXX(ierr);
+    if (p_blockSize > 1) {
+      ierr = MatSetBlockSize(p_matrix, p_blockSize); CHKERRXX(ierr);
+    }
   } catch (const PETSC_EXCEPTION_TYPE& e) {
     throw PETScException(ierr, e);
   }
@@ -185,10 +207,18 @@ PetscMatrixWrapper::p_set_sparse_matrix(void)
   PetscErrorCode ierr(0);
   try {
     parallel::Communicator comm(getCommunicator(p_matrix));
-    if (comm.size() == 1) {
-      ierr = MatSetType(p_matrix, MATSEQAIJ); CHKERRXX(ierr);
+    if (p_blockSize > 1) {
+      if (comm.size() == 1) {
+        ierr = MatSetType(p_matrix, MATSEQBAIJ); CHKERRXX(ierr);
+      } else {
+        ierr = MatSetType(p_matrix, MATMPIBAIJ); CHKERRXX(ierr);
+      }
     } else {
-      ierr = MatSetType(p_matrix, MATMPIAIJ); CHKERRXX(ierr);
+      if (comm.size() == 1) {
+        ierr = MatSetType(p_matrix, MATSEQAIJ); CHKERRXX(ierr);
+      } else {
+        ierr = MatSetType(p_matrix, MATMPIAIJ); CHKERRXX(ierr);
+      }
     }
     ierr = MatSetFromOptions(p_matrix); CHKERRXX(ierr);
     ierr = MatSetUp(p_matrix); CHKERRXX(ierr);
@@ -207,7 +237,21 @@ PetscMatrixWrapper::p_set_sparse_matrix(const PetscInt& max_nz_per_row)
 
   try {
     parallel::Communicator comm(getCommunicator(p_matrix));
-    if (comm.size() == 1) {
+    if (p_blockSize > 1) {
+      // preallocation of block matrices is by blocks, not rows
+      PetscInt bs(p_blockSize);
+      PetscInt dnz(diagonal_non_zero_guess/bs);
+      PetscInt onz(offdiagonal_non_zero_guess/bs);
+      if (comm.size() == 1) {
+        ierr = MatSetType(p_matrix, MATSEQBAIJ); CHKERRXX(ierr);
+        ierr = MatSeqBAIJSetPreallocation(p_matrix, bs, dnz + onz,
+                                          PETSC_NULL); CHKERRXX(ierr);
+      } else {
+        ierr = MatSetType(p_matrix, MATMPIBAIJ); CHKERRXX(ierr);
+        ierr = MatMPIBAIJSetPreallocation(p_matrix, bs, dnz, PETSC_NULL,
+                                          onz, PETSC_NULL); CHKERRXX(ierr);
+      }
+    } else if (comm.size() == 1) {
       ierr = MatSetType(p_matrix, MATSEQAIJ); CHKERRXX(ierr);
       ierr = MatSeqAIJSetPreallocation(p_matrix, 
                                        diagonal_non_zero_guess + offdiagonal_non_zero_guess,
@@ -239,7 +283,25 @@ PetscMatrixWrapper::p_set_sparse_matrix(const PetscInt *nz_by_row)
   PetscErrorCode ierr(0);
   try {
     parallel::Communicator comm(getCommunicator(p_matrix));
-    if (comm.size() == 1) {
+    if (p_blockSize > 1) {
+      // preallocation of block matrices is by block rows; use the first
+      // row of each block
+      PetscInt bs(p_blockSize);
+      std::vector<PetscInt> blocknz(lrows/bs);
+      for (PetscInt i = 0; i < lrows/bs; ++i) {
+        blocknz[i] = std::max<PetscInt>(nz_by_row[i*bs]/bs, 1);
+      }
+      if (comm.size() == 1) {
+        ierr = MatSetType(p_matrix, MATSEQBAIJ); CHKERRXX(ierr);
+        ierr = MatSeqBAIJSetPreallocation(p_matrix, bs, PETSC_DECIDE,
+                                          &blocknz[0]); CHKERRXX(ierr);
+      } else {
+        ierr = MatSetType(p_matrix, MATMPIBAIJ); CHKERRXX(ierr);
+        ierr = MatMPIBAIJSetPreallocation(p_matrix, bs,
+                                          PETSC_DECIDE, &blocknz[0],
+                                          PETSC_DECIDE, &blocknz[0]); CHKERRXX(ierr);
+      }
+    } else if (comm.size() == 1) {
       ierr = MatSetType(p_matrix, MATSEQAIJ); CHKERRXX(ierr);
       ierr = MatSeqAIJSetPreallocation(p_matrix, 
                                        PETSC_DECIDE,
@@ -263,6 +325,24 @@ PetscMatrixWrapper::p_set_sparse_matrix(const PetscInt *nz_by_row)
   }
 }
 
+// -------------------------------------------------------------
+// PetscMatrixWrapper::blockSize
+// -------------------------------------------------------------
+PetscInt
+PetscMatrixWrapper::blockSize(void) const
+{
+  return p_blockSize;
+}
+
+// -------------------------------------------------------------
+// PetscMatrixWrapper::blocked
+// -------------------------------------------------------------
+bool
+PetscMatrixWrapper::blocked(void) const
+{
+  return matIsBlocked(p_matrix);
+}
+
 // -------------------------------------------------------------
 // PetscMatrixWrapper::localRowRange
 // -------------------------------------------------------------
@@ -437,9 +517,12 @@ PetscMatrixWrapper::ready(void)
   try {
     ierr = MatAssemblyBegin(p_matrix, MAT_FINAL_ASSEMBLY); CHKERRXX(ierr);
     ierr = MatAssemblyEnd(p_matrix, MAT_FINAL_ASSEMBLY); CHKERRXX(ierr);
+    MatInfo info;
+    ierr = MatGetInfo(p_matrix,MAT_LOCAL,&info); CHKERRXX(ierr);
+    utility::MemoryTracker *tracker = utility::MemoryTracker::instance();
+    tracker->update(tracker->createCategory("Math: PETSc Matrices"), this,
+                    static_cast<long>(info.memory));
     if (false) {
-      MatInfo info;
-      ierr = MatGetInfo(p_matrix,MAT_LOCAL,&info);
       parallel::Communicator comm(getCommunicator(p_matrix));
       std::cerr << comm.rank() << ": Matrix::ready(): "
                 << "size = (" << this->rows() << "x" << this->cols() << "), "
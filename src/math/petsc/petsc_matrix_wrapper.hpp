@@ -40,17 +40,20 @@ public:
   /// Default constructor.
   PetscMatrixWrapper(const parallel::Communicator& comm,
                      const PetscInt& local_rows, const PetscInt& local_cols,
-                     const bool& dense = false);
+                     const bool& dense = false,
+                     const PetscInt& block_size = 1);
 
   /// Construct a sparse matrix allocating the same number of nonzeros in all rows
   PetscMatrixWrapper(const parallel::Communicator& comm,
                      const PetscInt& local_rows, const PetscInt& local_cols,
-                     const PetscInt& max_nonzero_per_row);
+                     const PetscInt& max_nonzero_per_row,
+                     const PetscInt& block_size = 1);
 
   /// Construct a sparse matrix with nonzero count specified for each (local) row
   PetscMatrixWrapper(const parallel::Communicator& comm,
                      const PetscInt& local_rows, const PetscInt& local_cols,
-                     const PetscInt *nonzeros_by_row);
+                     const PetscInt *nonzeros_by_row,
+                     const PetscInt& block_size = 1);
 
   /// Constructor that wraps an existing Mat instance
   PetscMatrixWrapper(Mat& m, const bool& copymat = true,
@@ -59,6 +62,12 @@ public:
   /// Destructor
   ~PetscMatrixWrapper(void);
 
+  /// Get the size of the dense blocks used to store the matrix
+  PetscInt blockSize(void) const;
+
+  /// Is the matrix stored in block (BAIJ) format?
+  bool blocked(void) const;
+
   /// Get the total number of rows in this matrix (specialized)
   PetscInt rows(void) const;
 
@@ -127,6 +136,9 @@ protected:
   /// Destroy wrapped @c p_matrix even if it's wrapped
   bool p_destroyWrapped;
 
+  /// Size of dense blocks used for sparse storage (1 means AIJ)
+  PetscInt p_blockSize;
+
   /// Build the generic PETSc matrix instance
   void p_build_matrix(const parallel::Communicator& comm,
                       const PetscInt& local_rows, const PetscInt& cols);
@@ -66,8 +66,58 @@ sillyMatScaleComplex(Mat A, const gridpack::ComplexType& px)
   return ierr;
 }
 
+// -------------------------------------------------------------
+// useBlockMatrix
+// -------------------------------------------------------------
+/** 
+ * When complex values are represented by real values, each complex
+ * matrix element is a 2x2 block of real values. Storing the matrix in
+ * block (BAIJ) format reduces index storage and lets the matrix
+ * multiply and factorizations work on the dense blocks. This can be
+ * turned off with the PETSc option -gridpack_block_matrix false,
+ * e.g. if the solver packages being used do not support BAIJ.
+ * 
+ * @return PETSC_TRUE if block storage should be used
+ */
+PetscBool
+useBlockMatrix(void)
+{
+  PetscBool result(PETSC_TRUE), set;
+  PetscOptionsGetBool(NULL, NULL, "-gridpack_block_matrix", &result, &set);
+  return result;
+}
 
+// -------------------------------------------------------------
+// matIsBlocked
+// -------------------------------------------------------------
+PetscBool
+matIsBlocked(Mat A)
+{
+  PetscBool result(PETSC_FALSE);
+  PetscObjectTypeCompareAny((PetscObject)A, &result,
+                            MATSEQBAIJ, MATMPIBAIJ, MATBAIJ, "");
+  return result;
+}
 
-
-
-
+// -------------------------------------------------------------
+// matConvertAIJ
+// -------------------------------------------------------------
+/** 
+ * Some operations (matrix-matrix multiply, some external direct
+ * solvers) are only available for AIJ matrices.  This makes an AIJ
+ * copy of a block matrix.
+ * 
+ * @param A block matrix
+ * @param reuse MAT_INITIAL_MATRIX or MAT_REUSE_MATRIX if @c B came
+ * from a previous call with a matrix with the same nonzero pattern
+ * @param B AIJ copy of @c A
+ * 
+ * @return PETSc error code
+ */
+PetscErrorCode
+matConvertAIJ(Mat A, MatReuse reuse, Mat *B)
+{
+  PetscErrorCode ierr(0);
+  ierr = MatConvert(A, MATAIJ, reuse, B); CHKERRQ(ierr);
+  return ierr;
+}
@@ -25,6 +25,7 @@
 #define _petsc_misc_hpp_
 
 #include <petscsys.h>
+#include <petscmat.h>
 #include <vector>
 #include <algorithm>
 #include "gridpack/utilities/complex.hpp"
@@ -32,6 +33,15 @@
 /// Scale a complex DENSE matrix
 extern PetscErrorCode sillyMatScaleComplex(Mat A, const gridpack::ComplexType& px);
 
+/// Should complex matrices be stored as real 2x2 blocks (BAIJ)?
+extern PetscBool useBlockMatrix(void);
+
+/// Is the matrix stored in block (BAIJ) format?
+extern PetscBool matIsBlocked(Mat A);
+
+/// Make an AIJ copy of a matrix, for operations not supported by BAIJ
+extern PetscErrorCode matConvertAIJ(Mat A, MatReuse reuse, Mat *B);
+
 // -------------------------------------------------------------
 // sortPermutation
 // 
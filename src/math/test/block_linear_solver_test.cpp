@@ -0,0 +1,129 @@
+// -------------------------------------------------------------
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+// -------------------------------------------------------------
+/**
+ * @file   block_linear_solver_test.cpp
+ * @date   October 19, 2026
+ *
+ * @brief Solve the same complex system with the matrix stored in 2x2
+ * block (BAIJ) format and in AIJ format and check that both give the
+ * same answer, for a direct and an iterative solver configuration.
+ * Each solver is used twice with different matrix values, so that the
+ * AIJ copy kept for factorization packages without BAIJ support is
+ * refreshed.
+ *
+ */
+// -------------------------------------------------------------
+
+#include <iostream>
+#include <petscsys.h>
+#include <boost/scoped_ptr.hpp>
+#include "linear_solver.hpp"
+
+#include "test_main.cpp"
+
+using namespace gridpack;
+
+/// Assemble the Helmholtz matrix from PETSc KSP example 11
+static math::ComplexMatrix *
+assemble_matrix(const parallel::Communicator& comm, const bool& block)
+{
+  const int n(6), dim(n*n);
+
+  int local_size(dim/comm.size());
+  if (comm.rank() == comm.size() - 1) {
+    local_size = dim - local_size*(comm.size() - 1);
+  }
+
+  // Block storage is chosen when the matrix is created
+  PetscOptionsSetValue(NULL, "-gridpack_block_matrix",
+                       (block ? "true" : "false"));
+  math::ComplexMatrix *A(new math::ComplexMatrix(comm, local_size, local_size, 6));
+  PetscOptionsClearValue(NULL, "-gridpack_block_matrix");
+
+  const RealType h2(1.0/static_cast<RealType>((n+1)*(n+1)));
+  const RealType sigma1(100.0);
+  const ComplexType sigma2(0.0, 10.0);
+
+  int lo, hi;
+  A->localRowRange(lo, hi);
+  for (int row = lo; row < hi; ++row) {
+    ComplexType v(-1.0);
+    int i(row/n), j(row - i*n);
+    if (i > 0) A->addElement(row, row - n, v);
+    if (i < n-1) A->addElement(row, row + n, v);
+    if (j > 0) A->addElement(row, row - 1, v);
+    if (j < n-1) A->addElement(row, row + 1, v);
+    v = 4.0 - sigma1*h2 + sigma2*h2;
+    A->addElement(row, row, v);
+  }
+  A->ready();
+  return A;
+}
+
+/// Solve twice with the same solver, changing the matrix in between
+static void
+solve_twice(const std::string& config, const bool& block,
+            boost::shared_ptr<math::ComplexVector> x[2])
+{
+  parallel::Communicator world;
+  boost::scoped_ptr<math::ComplexMatrix> A(assemble_matrix(world, block));
+
+  boost::shared_ptr<math::ComplexVector> u(new math::ComplexVector(world, A->localRows()));
+  u->fill(ComplexType(0.5, -0.25));
+  u->ready();
+
+  BOOST_REQUIRE(test_config);
+  boost::scoped_ptr<math::LinearSolver> solver(new math::LinearSolver(*A));
+  solver->configure(test_config->getCursor(config));
+
+  for (int k = 0; k < 2; ++k) {
+    if (k > 0) {
+      // same nonzero pattern, different values
+      A->addDiagonal(ComplexType(0.5, 0.1));
+    }
+    boost::scoped_ptr<math::ComplexVector> b(math::multiply(*A, *u));
+    x[k].reset(u->clone());
+    x[k]->zero();
+    solver->solve(*b, *x[k]);
+
+    boost::scoped_ptr<math::ComplexVector> e(x[k]->clone());
+    e->add(*u, -1.0);
+    BOOST_CHECK(e->norm2() < 1.0E-06);
+  }
+}
+
+/// Compare block and AIJ solutions for one configuration
+static void
+compare_storage(const std::string& config)
+{
+  boost::shared_ptr<math::ComplexVector> xblock[2], xaij[2];
+  solve_twice(config, true, xblock);
+  solve_twice(config, false, xaij);
+  for (int k = 0; k < 2; ++k) {
+    xblock[k]->add(*xaij[k], -1.0);
+    BOOST_TEST_MESSAGE(config << " solve " << k
+                       << ": block and AIJ solutions differ by "
+                       << xblock[k]->norm2());
+    BOOST_CHECK(xblock[k]->norm2() < 1.0E-08);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(BlockLinearSolverTest)
+
+BOOST_AUTO_TEST_CASE(Direct)
+{
+  compare_storage("BlockDirect");
+}
+
+BOOST_AUTO_TEST_CASE(Iterative)
+{
+  compare_storage("BlockIterative");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -21,14 +21,19 @@
 #include <fstream>
 #include <iomanip>
 #include <vector>
+#include <algorithm>
 #include <map>
 #include <boost/smart_ptr/shared_ptr.hpp>
 #include <boost/serialization/singleton.hpp>
 #include <boost/serialization/extended_type_info.hpp>
 #include <boost/serialization/shared_ptr.hpp>
+#include <boost/mpi/packed_iarchive.hpp>
+#include <boost/mpi/packed_oarchive.hpp>
+#include <boost/mpi/collectives.hpp>
 #include <boost/type_traits.hpp>
 #include <ga.h>
 #include "gridpack/network/network_topology_interface.hpp"
+#include "gridpack/network/component_arena.hpp"
 #include "gridpack/parallel/index_hash.hpp"
 #include "gridpack/component/base_component.hpp"
 #include "gridpack/component/data_collection.hpp"
@@ -36,6 +41,7 @@
 #include "gridpack/parallel/shuffler.hpp"
 #include "gridpack/parallel/ga_shuffler.hpp"
 #include "gridpack/timer/coarse_timer.hpp"
+#include "gridpack/timer/memory_tracker.hpp"
 #include "gridpack/utilities/exception.hpp"
 #include "gridpack/environment/environment.hpp"
 #include "gridpack/configuration/no_print.hpp"
@@ -309,6 +315,8 @@ explicit BaseNetwork(const parallel::Communicator& comm)
   p_external_branch = false;
   p_allocatedBus = false;
   p_allocatedBranch = false;
+  p_contiguous = false;
+  p_csrValid = false;
   p_network_data.reset(new gridpack::component::DataCollection);
 
   gridpack::NoPrint *noprint = gridpack::NoPrint::instance();
@@ -321,6 +329,7 @@ explicit BaseNetwork(const parallel::Communicator& comm)
 virtual ~BaseNetwork(void)
 {
   int i, size;
+  releaseMemory();
   // Clean up exchange buffers if they have been allocated
   if (p_busXCBufSize != 0 && p_busXCBuffers != NULL) {
     int size = p_buses.size();
@@ -404,6 +413,7 @@ void addBus(int idx)
   bus->p_originalBusIndex = idx;
   bus->p_globalBusIndex = -1;
   p_buses.push_back(*bus);
+  p_csrValid = false;
 }
 
 /**
@@ -420,6 +430,7 @@ void addBranch(int idx1, int idx2)
   branch->p_globalBusIndex1 = -1;
   branch->p_globalBusIndex2 = -1;
   p_branches.push_back(*branch);
+  p_csrValid = false;
 }
 
 /**
@@ -633,6 +644,7 @@ bool setLocalBusIndex1(int idx, int b_idx)
     return false;
   } else {
     p_branches[idx].p_localBusIndex1 = b_idx;
+    p_csrValid = false;
     return true;
   }
 }
@@ -649,6 +661,7 @@ bool setLocalBusIndex2(int idx, int b_idx)
     return false;
   } else {
     p_branches[idx].p_localBusIndex2 = b_idx;
+    p_csrValid = false;
     return true;
   }
 }
@@ -696,6 +709,7 @@ bool clearBranchNeighbors(int idx)
     return false;
   } else {
     p_buses[idx].p_branchNeighbors.clear();
+    p_csrValid = false;
     return true;
   }
 }
@@ -712,6 +726,7 @@ bool addBranchNeighbor(int idx, int br_idx)
     return false;
   } else {
     p_buses[idx].p_branchNeighbors.push_back(br_idx);
+    p_csrValid = false;
     return true;
   }
 }
@@ -1013,6 +1028,46 @@ std::vector<int> getConnectedBuses(int idx) const
 
 
 
+/**
+ * Get the number of branches connected to a bus. This function and
+ * connectedBranchList and connectedBusList use a compressed (CSR) copy of
+ * the network connectivity that is stored in local index order. They do
+ * not allocate memory or check the index, so they can be used in loops
+ * over the network that are evaluated many times
+ * @param idx local bus index
+ * @return number of branches connected to bus
+ */
+int numConnectedBranches(int idx) const
+{
+  if (!p_csrValid) buildConnectivity();
+  return p_csrOffsets[idx+1]-p_csrOffsets[idx];
+}
+
+/**
+ * Get the local indices of branches connected to a bus. The list remains
+ * valid until the network connectivity is modified
+ * @param idx local bus index
+ * @return pointer to numConnectedBranches(idx) local branch indices
+ */
+const int* connectedBranchList(int idx) const
+{
+  if (!p_csrValid) buildConnectivity();
+  return &p_csrBranches[0]+p_csrOffsets[idx];
+}
+
+/**
+ * Get the local indices of buses connected to a bus via one branch. The
+ * buses are in the same order as the branches returned by
+ * connectedBranchList
+ * @param idx local bus index
+ * @return pointer to numConnectedBranches(idx) local bus indices
+ */
+const int* connectedBusList(int idx) const
+{
+  if (!p_csrValid) buildConnectivity();
+  return &p_csrBuses[0]+p_csrOffsets[idx];
+}
+
 /**
  * Return indices of buses at either end of branch
  * @param idx local branch index
@@ -1035,11 +1090,161 @@ void getBranchEndpoints(int idx, int *bus1, int *bus2) const
   }
 }
 
+/**
+ * Find the islands (connected components) of the network. Two buses are in
+ * the same island if they are connected by a path of branches that are in
+ * service. Islands that span several processors are found by repeatedly
+ * exchanging the smallest global bus index in each group of locally
+ * connected buses between active buses and their ghost copies. This is a
+ * collective operation
+ * @param inService flag for each local branch, including ghost branches,
+ *        that is true if the branch connects its end buses. Ghost copies
+ *        of a branch must have the same value as the active copy
+ * @param island returns the island index of each local bus, including
+ *        ghost buses. Islands are numbered from 0 in order of the smallest
+ *        global bus index in each island
+ * @return total number of islands
+ */
+int findIslands(const std::vector<bool> &inService, std::vector<int> &island)
+{
+  int nbus = p_buses.size();
+  int nbranch = p_branches.size();
+  if (inService.size() != nbranch) {
+    char buf[256];
+    sprintf(buf,"BaseNetwork::findIslands: number of branch flags: %d"
+        " does not match number of branches: %d\n",
+        static_cast<int>(inService.size()), nbranch);
+    if (!p_no_print) {
+      printf("%s",buf);
+    }
+    throw gridpack::Exception(buf);
+  }
+  int i;
+  // Group buses that are connected by local branches
+  std::vector<int> root(nbus);
+  for (i=0; i<nbus; i++) root[i] = i;
+  for (i=0; i<nbranch; i++) {
+    if (!inService[i]) continue;
+    int r1 = findRoot(root, p_branches[i].p_localBusIndex1);
+    int r2 = findRoot(root, p_branches[i].p_localBusIndex2);
+    if (r1 < r2) {
+      root[r2] = r1;
+    } else if (r2 < r1) {
+      root[r1] = r2;
+    }
+  }
+  for (i=0; i<nbus; i++) root[i] = findRoot(root, i);
+
+  // Label each bus with its global index and set up lists of active and
+  // ghost buses for exchanging labels
+  std::vector<int> label(nbus);
+  std::vector<int> activeIdx, ghostIdx;
+  int total = 0;
+  for (i=0; i<nbus; i++) {
+    label[i] = p_buses[i].p_globalBusIndex;
+    if (label[i]+1 > total) total = label[i]+1;
+    if (p_buses[i].p_activeBus) {
+      activeIdx.push_back(label[i]);
+    } else {
+      ghostIdx.push_back(label[i]);
+    }
+  }
+  communicator().max(&total,1);
+  int nactive = activeIdx.size();
+  int nghost = ghostIdx.size();
+  std::vector<int*> activePtr(nactive), ghostPtr(nghost);
+  for (i=0; i<nactive; i++) activePtr[i] = &activeIdx[i];
+  for (i=0; i<nghost; i++) ghostPtr[i] = &ghostIdx[i];
+  std::vector<int> activeBuf(nactive), ghostBuf(nghost);
+  std::vector<int> groupMin(nbus);
+
+  int grp = communicator().getGroup();
+  int g_label = GA_Create_handle();
+  int one = 1;
+  if (total < 1) total = 1;
+  GA_Set_data(g_label, one, &total, C_INT);
+  GA_Set_pgroup(g_label, grp);
+  GA_Allocate(g_label);
+
+  // Propagate the smallest label in each island until no labels change
+  while (true) {
+    int changed = 0;
+    for (i=0; i<nbus; i++) groupMin[i] = label[i];
+    for (i=0; i<nbus; i++) {
+      if (label[i] < groupMin[root[i]]) groupMin[root[i]] = label[i];
+    }
+    for (i=0; i<nbus; i++) {
+      if (groupMin[root[i]] < label[i]) {
+        label[i] = groupMin[root[i]];
+        changed = 1;
+      }
+    }
+    int ia = 0, ig = 0;
+    for (i=0; i<nbus; i++) {
+      if (p_buses[i].p_activeBus) {
+        activeBuf[ia] = label[i];
+        ia++;
+      }
+    }
+    GA_Pgroup_sync(grp);
+    if (nactive > 0) NGA_Scatter(g_label,&activeBuf[0],&activePtr[0],nactive);
+    GA_Pgroup_sync(grp);
+    if (nghost > 0) NGA_Gather(g_label,&ghostBuf[0],&ghostPtr[0],nghost);
+    for (i=0; i<nbus; i++) {
+      if (!p_buses[i].p_activeBus) {
+        if (ghostBuf[ig] < label[i]) {
+          label[i] = ghostBuf[ig];
+          changed = 1;
+        }
+        ig++;
+      }
+    }
+    communicator().max(&changed,1);
+    if (!changed) break;
+  }
+  GA_Pgroup_sync(grp);
+  GA_Destroy(g_label);
+
+  // Number islands in order of their smallest global bus index
+  std::vector<int> roots;
+  for (i=0; i<nbus; i++) {
+    if (p_buses[i].p_activeBus && label[i] == p_buses[i].p_globalBusIndex) {
+      roots.push_back(label[i]);
+    }
+  }
+  std::vector<std::vector<int> > allRoots;
+  boost::mpi::all_gather(communicator().getCommunicator(), roots, allRoots);
+  roots.clear();
+  for (i=0; i<allRoots.size(); i++) {
+    roots.insert(roots.end(), allRoots[i].begin(), allRoots[i].end());
+  }
+  std::sort(roots.begin(), roots.end());
+  island.resize(nbus);
+  for (i=0; i<nbus; i++) {
+    island[i] = std::lower_bound(roots.begin(), roots.end(), label[i])
+      - roots.begin();
+  }
+  return roots.size();
+}
+
 /// Assemble local part of network
 void assemble(void) 
 {
 }
 
+/**
+ * Store bus and branch components contiguously in local index order when
+ * the network is partitioned. This must be called before partition and
+ * the components must have default constructors and serialize methods
+ * that copy all the data that has been assigned to them before
+ * partitioning.
+ * @param flag if true, use contiguous storage for components
+ */
+void setContiguousComponents(bool flag)
+{
+  p_contiguous = flag;
+}
+
 /**
  * Partition the network over the available processes
  */
@@ -1181,6 +1386,8 @@ void partition(void)
   // At this point, each process should have a self-contained
   // network, update local and global indexes, etc.
 
+  if (p_contiguous) compactComponents();
+
   // make an index of global bus index to local index and update
   // the branch local bus indexes
   int active_buses(0), active_branches(0);
@@ -1253,6 +1460,8 @@ void partition(void)
       << std::endl;
   }
 
+  recordDataMemory();
+  recordExchangeMemory();
   if (timer != NULL) timer->stop(t_total);
 }
 
@@ -1372,6 +1581,7 @@ void clean(void)
     std::vector<int> neighbors = p_buses[i].p_branchNeighbors;
     jsize = neighbors.size();
     p_buses[i].p_branchNeighbors.clear();
+    p_csrValid = false;
     for (j=0; j<jsize; j++) {
       p = branches.find(neighbors[j]);
       if (p != branches.end()) {
@@ -1685,6 +1895,7 @@ void clear(void)
   // Get rid of all buses and branches
   p_buses.clear();
   p_branches.clear();
+  p_csrValid = false;
 
   //reset all internal parameters to their initial state
   p_refBus = -1;
@@ -1708,6 +1919,8 @@ void clear(void)
   p_external_branch = false;
   p_allocatedBus = false;
   p_allocatedBranch = false;
+  recordDataMemory();
+  recordExchangeMemory();
 }
 
 /**
@@ -1750,6 +1963,7 @@ void allocXCBus(int size)
     p_allocatedBus = true;
     p_external_bus = false;
   }
+  recordExchangeMemory();
 }
 
 /**
@@ -1773,6 +1987,7 @@ void freeXCBus(void)
     p_external_bus = false;
     p_busXCBufSize = 0;
   }
+  recordExchangeMemory();
 }
 
 /**
@@ -1802,6 +2017,7 @@ void allocXCBusPointers(int size)
     p_busXCBufSize = size;
   }
   p_external_bus = true;
+  recordExchangeMemory();
 }
 
 /**
@@ -1889,6 +2105,7 @@ void allocXCBranch(int size)
     p_allocatedBranch = true;
     p_branchXCBufSize = size;
   }
+  recordExchangeMemory();
 }
 
 /**
@@ -1912,6 +2129,7 @@ void freeXCBranch(void)
     p_branchXCBufSize = 0;
     p_external_branch = false;
   }
+  recordExchangeMemory();
 }
 
 /**
@@ -1962,6 +2180,7 @@ void allocXCBranchPointers(int size)
     p_branchXCBufSize = size;
   }
   p_external_branch = true;
+  recordExchangeMemory();
 }
 
 /**
@@ -2123,6 +2342,7 @@ void initBusUpdate(void)
     delete [] totBuses;
     delete [] distr;
   }
+  recordExchangeMemory();
   GA_Pgroup_sync(grp);
 }
 
@@ -2305,6 +2525,7 @@ void initBranchUpdate(void)
     delete totBranches;
     delete distr;
   }
+  recordExchangeMemory();
   GA_Pgroup_sync(grp);
 }
 
@@ -2584,6 +2805,203 @@ private:
   typedef std::vector< BranchData<BranchType> > BranchDataVector;
   typedef typename BranchDataVector::iterator BranchIterator;
 
+/**
+ * Find the representative of a group of buses, compressing the path to it
+ * @param root representative of each bus
+ * @param idx local bus index
+ * @return representative of group containing bus
+ */
+static int findRoot(std::vector<int> &root, int idx)
+{
+  while (root[idx] != idx) {
+    root[idx] = root[root[idx]];
+    idx = root[idx];
+  }
+  return idx;
+}
+
+/**
+ * Build compressed copy of network connectivity from the branch neighbor
+ * lists of the buses
+ */
+void buildConnectivity(void) const
+{
+  int nbus = p_buses.size();
+  int i, j;
+  p_csrOffsets.resize(nbus+1);
+  p_csrOffsets[0] = 0;
+  for (i=0; i<nbus; i++) {
+    p_csrOffsets[i+1] = p_csrOffsets[i]+p_buses[i].p_branchNeighbors.size();
+  }
+  // Keep at least one element so that pointers into the lists are valid
+  p_csrBranches.resize(p_csrOffsets[nbus]+1);
+  p_csrBuses.resize(p_csrOffsets[nbus]+1);
+  for (i=0; i<nbus; i++) {
+    const std::vector<int> &nghbrs = p_buses[i].p_branchNeighbors;
+    int offset = p_csrOffsets[i];
+    int size = nghbrs.size();
+    for (j=0; j<size; j++) {
+      int br = nghbrs[j];
+      p_csrBranches[offset+j] = br;
+      if (p_branches[br].p_localBusIndex1 != i) {
+        p_csrBuses[offset+j] = p_branches[br].p_localBusIndex1;
+      } else {
+        p_csrBuses[offset+j] = p_branches[br].p_localBusIndex2;
+      }
+    }
+  }
+  p_csrValid = true;
+}
+
+/**
+ * Copy the state of a component into another component using its
+ * serialize method
+ * @param comm communicator used by archives
+ * @param src component to be copied
+ * @param dest component receiving copy
+ */
+template <class _component>
+static void copyComponent(const boost::mpi::communicator &comm,
+    const _component &src, _component &dest)
+{
+  boost::mpi::packed_oarchive::buffer_type buffer;
+  boost::mpi::packed_oarchive oarchive(comm, buffer);
+  oarchive << src;
+  boost::mpi::packed_iarchive iarchive(comm, buffer);
+  iarchive >> dest;
+}
+
+/**
+ * Report memory held by bus and branch components and their data
+ * collections to the memory tracker
+ */
+void recordDataMemory(void)
+{
+  gridpack::utility::MemoryTracker *tracker =
+    gridpack::utility::MemoryTracker::instance();
+  int t_comp = tracker->createCategory("Network: Components");
+  int t_data = tracker->createCategory("Network: Data Collections");
+  int nbus = p_buses.size();
+  int nbranch = p_branches.size();
+  int i;
+  long comp = static_cast<long>(nbus)*(sizeof(BusData<_bus>)+sizeof(_bus))
+    + static_cast<long>(nbranch)*(sizeof(BranchData<_branch>)+sizeof(_branch));
+  long data = 0;
+  for (i=0; i<nbus; i++) {
+    comp += p_buses[i].p_branchNeighbors.capacity()*sizeof(int);
+    data += p_buses[i].p_data->memoryUsage();
+  }
+  for (i=0; i<nbranch; i++) {
+    data += p_branches[i].p_data->memoryUsage();
+  }
+  tracker->update(t_comp, this, comp);
+  tracker->update(t_data, this, data);
+}
+
+/**
+ * Report memory held by ghost exchange buffers to the memory tracker. This
+ * includes the local part of the global arrays used for the exchange
+ */
+void recordExchangeMemory(void)
+{
+  gridpack::utility::MemoryTracker *tracker =
+    gridpack::utility::MemoryTracker::instance();
+  int t_xc = tracker->createCategory("Network: Ghost Exchange Buffers");
+  long bytes = 0;
+  if (p_busXCBufSize != 0 && p_busXCBuffers != NULL) {
+    bytes += static_cast<long>(p_buses.size())*sizeof(void*);
+    if (p_allocatedBus && !p_external_bus) {
+      bytes += static_cast<long>(p_buses.size())*p_busXCBufSize;
+    }
+  }
+  if (p_branchXCBufSize != 0 && p_branchXCBuffers != NULL) {
+    bytes += static_cast<long>(p_branches.size())*sizeof(void*);
+    if (p_allocatedBranch && !p_external_branch) {
+      bytes += static_cast<long>(p_branches.size())*p_branchXCBufSize;
+    }
+  }
+  if (p_busSndBuf) {
+    bytes += static_cast<long>(p_numActiveBuses)*p_busXCBufSize;
+  }
+  if (p_busRcvBuf) {
+    bytes += static_cast<long>(p_numInactiveBuses)*p_busXCBufSize;
+  }
+  if (p_busGASet) {
+    bytes += static_cast<long>(p_numActiveBuses)*p_busXCBufSize;
+  }
+  if (p_branchSndBuf) {
+    bytes += static_cast<long>(p_numActiveBranches)*p_branchXCBufSize;
+  }
+  if (p_branchRcvBuf) {
+    bytes += static_cast<long>(p_numInactiveBranches)*p_branchXCBufSize;
+  }
+  if (p_branchGASet) {
+    bytes += static_cast<long>(p_numActiveBranches)*p_branchXCBufSize;
+  }
+  tracker->update(t_xc, this, bytes);
+}
+
+/**
+ * Remove all memory held by this network from the memory tracker
+ */
+void releaseMemory(void)
+{
+  gridpack::utility::MemoryTracker *tracker =
+    gridpack::utility::MemoryTracker::instance();
+  tracker->release(tracker->createCategory("Network: Components"), this);
+  tracker->release(tracker->createCategory("Network: Data Collections"),
+      this);
+  tracker->release(tracker->createCategory("Network: Ghost Exchange Buffers"),
+      this);
+}
+
+/**
+ * Move bus and branch components into contiguous arenas in local index
+ * order. Buses and branches that share a component keep sharing it
+ */
+void compactComponents(void)
+{
+  boost::mpi::communicator comm = this->communicator().getCommunicator();
+  int nbus = p_buses.size();
+  int nbranch = p_branches.size();
+  int i;
+  boost::shared_ptr<ComponentArena<_bus> >
+    bus_arena(new ComponentArena<_bus>(nbus));
+  std::map<_bus*, _bus*> bus_copies;
+  typename std::map<_bus*, _bus*>::iterator bit;
+  for (i=0; i<nbus; i++) {
+    _bus *old_bus = p_buses[i].p_bus.get();
+    _bus *new_bus;
+    bit = bus_copies.find(old_bus);
+    if (bit != bus_copies.end()) {
+      new_bus = bit->second;
+    } else {
+      new_bus = bus_arena->create();
+      copyComponent(comm, *old_bus, *new_bus);
+      bus_copies.insert(std::pair<_bus*, _bus*>(old_bus, new_bus));
+    }
+    p_buses[i].p_bus = BusPtr(bus_arena, new_bus);
+  }
+  boost::shared_ptr<ComponentArena<_branch> >
+    branch_arena(new ComponentArena<_branch>(nbranch));
+  std::map<_branch*, _branch*> branch_copies;
+  typename std::map<_branch*, _branch*>::iterator rit;
+  for (i=0; i<nbranch; i++) {
+    _branch *old_branch = p_branches[i].p_branch.get();
+    _branch *new_branch;
+    rit = branch_copies.find(old_branch);
+    if (rit != branch_copies.end()) {
+      new_branch = rit->second;
+    } else {
+      new_branch = branch_arena->create();
+      copyComponent(comm, *old_branch, *new_branch);
+      branch_copies.insert(std::pair<_branch*, _branch*>(old_branch,
+            new_branch));
+    }
+    p_branches[i].p_branch = BranchPtr(branch_arena, new_branch);
+  }
+}
+
   /**
    * Vector of bus data and objects
    */
@@ -2653,6 +3071,22 @@ private:
   std::multimap<int,int> p_busMap;
   std::multimap<std::pair<int,int>,int> p_branchMap;
 
+  /**
+   * Store components contiguously when network is partitioned
+   */
+  bool p_contiguous;
+
+  /**
+   * Compressed copy of network connectivity. p_csrOffsets[i] is the start
+   * of the entries for bus i in p_csrBranches (local indices of connected
+   * branches) and p_csrBuses (local indices of buses at the other end of
+   * each branch). These are rebuilt when connectivity is modified
+   */
+  mutable bool p_csrValid;
+  mutable std::vector<int> p_csrOffsets;
+  mutable std::vector<int> p_csrBranches;
+  mutable std::vector<int> p_csrBuses;
+
   /**
    * Data collection object associated with network as a whole
    */
@@ -0,0 +1,107 @@
+// -------------------------------------------------------------
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   component_arena.hpp
+ * @date   October 19, 2026
+ *
+ * @brief  A fixed size block of memory that holds network components of a
+ * single type contiguously. Components are constructed in the order they
+ * are created and are destroyed when the arena is destroyed. Shared
+ * pointers to individual components can be created using the aliasing
+ * constructor of boost::shared_ptr so that the arena stays alive as long
+ * as any of its components are in use.
+ */
+// -------------------------------------------------------------
+
+#ifndef _component_arena_h_
+#define _component_arena_h_
+
+#include <new>
+#include <cstddef>
+#include "gridpack/utilities/exception.hpp"
+#include "gridpack/utilities/uncopyable.hpp"
+
+namespace gridpack {
+namespace network {
+
+template <class _component>
+class ComponentArena
+  : private utility::Uncopyable
+{
+public:
+
+  /**
+   * Constructor
+   * @param capacity maximum number of components held by arena
+   */
+  explicit ComponentArena(int capacity)
+    : p_size(0), p_capacity(capacity), p_storage(NULL)
+  {
+    if (p_capacity > 0) {
+      p_storage = static_cast<char*>(
+          ::operator new(static_cast<size_t>(p_capacity)*sizeof(_component)));
+    }
+  }
+
+  /**
+   * Destructor. Components are destroyed in reverse order of creation
+   */
+  ~ComponentArena(void)
+  {
+    int i;
+    for (i=p_size-1; i>=0; i--) {
+      at(i)->~_component();
+    }
+    if (p_storage) ::operator delete(p_storage);
+  }
+
+  /**
+   * Construct a new component at the end of the arena using its default
+   * constructor
+   * @return pointer to new component
+   */
+  _component* create(void)
+  {
+    if (p_size >= p_capacity) {
+      throw gridpack::Exception("ComponentArena::create: arena is full");
+    }
+    _component *ret = new (p_storage+static_cast<size_t>(p_size)
+        *sizeof(_component)) _component();
+    p_size++;
+    return ret;
+  }
+
+  /**
+   * @param idx index of component
+   * @return pointer to component
+   */
+  _component* at(int idx)
+  {
+    return reinterpret_cast<_component*>(p_storage
+        +static_cast<size_t>(idx)*sizeof(_component));
+  }
+
+  /**
+   * @return number of components in arena
+   */
+  int size(void) const
+  {
+    return p_size;
+  }
+
+private:
+
+  int p_size;
+  int p_capacity;
+  char *p_storage;
+};
+
+}  // namespace network
+}  // namespace gridpack
+
+#endif
@@ -427,6 +427,61 @@ BOOST_AUTO_TEST_CASE ( lattice_partition )
   net.writeGraph("lattice-after.dot");
 }
 
+BOOST_AUTO_TEST_CASE ( contiguous_partition )
+{
+  gridpack::parallel::Communicator world;
+  static const int rows(5), cols(5);
+  BogusLatticeNetwork net(world, rows, cols);
+
+  // mark one bus before partitioning to check that component state is
+  // copied into the arena
+  if (world.rank() == 0) {
+    net.getBus(0)->setReferenceBus(true);
+  }
+  net.setContiguousComponents(true);
+  net.partition();
+
+  // components are stored in local index order, so each new component
+  // follows the previous one. Components may only repeat if they are shared
+  int nbus(net.numBuses());
+  int nref(0);
+  bool ok(true);
+  if (nbus > 0) {
+    BogusBus *next = net.getBus(0).get();
+    for (int i = 0; i < nbus; ++i) {
+      BogusBus *bus = net.getBus(i).get();
+      if (bus == next) {
+        ++next;
+      } else if (bus > next) {
+        ok = false;
+      }
+      bool ref(bus->getReferenceBus());
+      BOOST_CHECK_EQUAL(ref, net.getGlobalBusIndex(i) == 0);
+      if (ref && net.getActiveBus(i)) nref += 1;
+    }
+  }
+  int nbranch(net.numBranches());
+  if (nbranch > 0) {
+    BogusBranch *next = net.getBranch(0).get();
+    for (int i = 0; i < nbranch; ++i) {
+      BogusBranch *branch = net.getBranch(i).get();
+      if (branch == next) {
+        ++next;
+      } else if (branch > next) {
+        ok = false;
+      }
+    }
+  }
+  BOOST_CHECK(ok);
+
+  // the reference bus is owned by exactly one process
+  int allref(0);
+  boost::mpi::all_reduce(world.getCommunicator(), nref, allref,
+      std::plus<int>());
+  BOOST_CHECK_EQUAL(allref, 1);
+  BOOST_CHECK_EQUAL(net.totalBuses(), rows*cols);
+}
+
 
 BOOST_AUTO_TEST_SUITE_END( )
 
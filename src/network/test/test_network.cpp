@@ -454,6 +454,81 @@ BOOST_AUTO_TEST_CASE( TestNetworkTopology )
   }
   BOOST_CHECK(ok);
 
+  // Check compressed connectivity against neighbor lists
+  for (i=0; i<nbus; i++) {
+    std::vector<int> branches = network.getConnectedBranches(i);
+    std::vector<int> buses = network.getConnectedBuses(i);
+    n = network.numConnectedBranches(i);
+    if (n != branches.size()) {
+      printf("p[%d] incorrect number of connected branches on bus %d\n",me,i);
+      ok = false;
+      continue;
+    }
+    const int *brlist = network.connectedBranchList(i);
+    const int *buslist = network.connectedBusList(i);
+    for (j=0; j<n; j++) {
+      if (brlist[j] != branches[j] || buslist[j] != buses[j]) {
+        printf("p[%d] incorrect connectivity list on bus %d\n",me,i);
+        ok = false;
+      }
+    }
+  }
+  oks = (int)ok;
+  ierr = MPI_Allreduce(&oks, &okr, 1, MPI_INT, MPI_PROD, mpi_world);
+  ok = (bool)okr;
+  if (me == 0 && ok) {
+    printf("\nConnectivity lists are ok\n");
+  }
+  BOOST_CHECK(ok);
+
+  // Split network into islands by removing the branches between columns
+  // XDIM/2-1 and XDIM/2 and all branches connected to the last bus
+  {
+    int nbranch = network.numBranches();
+    std::vector<bool> inService(nbranch);
+    int last = XDIM*YDIM-1;
+    for (i=0; i<nbranch; i++) {
+      int o1, o2;
+      network.getOriginalBranchEndpoints(i,&o1,&o2);
+      o1 = o1/2;
+      o2 = o2/2;
+      inService[i] = true;
+      int x1 = o1%XDIM;
+      int x2 = o2%XDIM;
+      if ((x1 == XDIM/2-1 && x2 == XDIM/2) ||
+          (x2 == XDIM/2-1 && x1 == XDIM/2)) inService[i] = false;
+      if (o1 == last || o2 == last) inService[i] = false;
+    }
+    std::vector<int> island;
+    int nisland = network.findIslands(inService, island);
+    if (nisland != 3) {
+      printf("p[%d] incorrect number of islands: %d\n",me,nisland);
+      ok = false;
+    }
+    for (i=0; i<nbus; i++) {
+      int o = network.getOriginalBusIndex(i)/2;
+      int expected;
+      if (o == last) {
+        expected = 2;
+      } else if (o%XDIM < XDIM/2) {
+        expected = 0;
+      } else {
+        expected = 1;
+      }
+      if (island[i] != expected) {
+        printf("p[%d] incorrect island %d for bus %d\n",me,island[i],o);
+        ok = false;
+      }
+    }
+  }
+  oks = (int)ok;
+  ierr = MPI_Allreduce(&oks, &okr, 1, MPI_INT, MPI_PROD, mpi_world);
+  ok = (bool)okr;
+  if (me == 0 && ok) {
+    printf("\nIslands are ok\n");
+  }
+  BOOST_CHECK(ok);
+
   // Test clone operation
   bool test_clone = true;
   if (test_clone) {
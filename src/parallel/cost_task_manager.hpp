@@ -0,0 +1,448 @@
+// Emacs Mode Line: -*- Mode:c++;-*-
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   cost_task_manager.hpp
+ * @date   October 19, 2026
+ *
+ * @brief  Task manager that uses estimated task costs to schedule the most
+ *         expensive tasks first and balances the remaining work between
+ *         task groups using work stealing
+ *
+ *
+ */
+
+// -------------------------------------------------------------
+
+#ifndef _cost_task_manager_hpp_
+#define _cost_task_manager_hpp_
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include <queue>
+#include <string>
+#include <fstream>
+#include <algorithm>
+#include <functional>
+#include "gridpack/utilities/exception.hpp"
+#include "gridpack/parallel/communicator.hpp"
+#include <ga.h>
+
+namespace gridpack {
+namespace parallel {
+
+// -------------------------------------------------------------
+//  class CostTaskManager
+//
+//  Tasks are sorted by estimated cost and dealt out longest first to one
+//  queue per task group so that each queue carries roughly the same
+//  estimated load. A task group takes tasks from the front of its own queue
+//  (most expensive first). When its queue is empty it steals the next task
+//  from the queue with the most estimated work remaining. The only shared
+//  state is one counter per queue, so both local and stolen tasks are
+//  obtained with a single atomic read-and-increment.
+//
+//  The wall clock time spent on each task is recorded and can be written
+//  to a file that is read back with readTaskCosts to provide the cost
+//  estimates for the next run.
+// -------------------------------------------------------------
+class CostTaskManager {
+public:
+
+  /**
+   * Constructor on a user-specified communicator. All task groups must be
+   * subsets of this communicator.
+   * @param comm communicator containing all task groups
+   */
+  CostTaskManager(Communicator &comm)
+    : p_comm(comm)
+  {
+    p_grp = comm.getGroup();
+    p_GAcounter = -1;
+    p_ntasks = 0;
+    p_ngroups = 0;
+    p_mygroup = 0;
+    p_task_count = 0;
+    p_steal_count = 0;
+    p_current = -1;
+    p_start = 0.0;
+    p_root = true;
+  }
+
+  /**
+   * Destructor
+   */
+  ~CostTaskManager(void)
+  {
+    if (p_GAcounter != -1) GA_Destroy(p_GAcounter);
+  }
+
+  /**
+   * Specify task costs for the case where each process evaluates tasks by
+   * itself. This is a collective operation on the communicator used in the
+   * constructor.
+   * @param costs estimated cost of each task. The number of tasks is equal
+   *        to the length of this vector. Costs must be the same on all
+   *        processes
+   */
+  void set(const std::vector<double> &costs)
+  {
+    Communicator self = p_comm.self();
+    set(costs, self);
+  }
+
+  /**
+   * Specify task costs for the case where tasks are evaluated on task
+   * groups. This is a collective operation on the communicator used in the
+   * constructor. Throws gridpack::Exception if the task counters cannot be
+   * allocated.
+   * @param costs estimated cost of each task. Costs must be the same on all
+   *        processes
+   * @param task_comm communicator for the task group that this process
+   *        belongs to
+   */
+  void set(const std::vector<double> &costs, Communicator &task_comm)
+  {
+    int i;
+    MPI_Comm comm = static_cast<MPI_Comm>(p_comm);
+    p_ntasks = costs.size();
+    p_costs = costs;
+    p_times.assign(p_ntasks,0.0);
+    p_task_count = 0;
+    p_steal_count = 0;
+    p_current = -1;
+
+    // Number task groups consecutively using the root process of each group
+    int root = (task_comm.rank() == 0) ? 1 : 0;
+    p_root = (root == 1);
+    int group = 0;
+    MPI_Exscan(&root, &group, 1, MPI_INT, MPI_SUM, comm);
+    if (p_comm.rank() == 0) group = 0;
+    MPI_Allreduce(&root, &p_ngroups, 1, MPI_INT, MPI_SUM, comm);
+    MPI_Bcast(&group, 1, MPI_INT, 0, static_cast<MPI_Comm>(task_comm));
+    p_mygroup = group;
+
+    // Deal out tasks longest first to the queue with the smallest estimated
+    // load. This is done redundantly on all processes so no communication
+    // is required.
+    std::vector<int> order(p_ntasks);
+    for (i=0; i<p_ntasks; i++) order[i] = i;
+    std::stable_sort(order.begin(), order.end(), CostCompare(p_costs));
+    p_queues.assign(p_ngroups, std::vector<int>());
+    std::priority_queue<std::pair<double,int>,
+      std::vector<std::pair<double,int> >,
+      std::greater<std::pair<double,int> > > load;
+    for (i=0; i<p_ngroups; i++) load.push(std::pair<double,int>(0.0,i));
+    for (i=0; i<p_ntasks; i++) {
+      std::pair<double,int> next = load.top();
+      load.pop();
+      p_queues[next.second].push_back(order[i]);
+      next.first += p_costs[order[i]];
+      load.push(next);
+    }
+
+    // Estimated cost remaining in each queue as a function of the position
+    // of the queue counter
+    p_remaining.assign(p_ngroups, std::vector<double>());
+    for (i=0; i<p_ngroups; i++) {
+      int len = p_queues[i].size();
+      p_remaining[i].assign(len+1,0.0);
+      int j;
+      for (j=len-1; j>=0; j--) {
+        p_remaining[i][j] = p_remaining[i][j+1]+p_costs[p_queues[i][j]];
+      }
+    }
+
+    // Create one counter per queue
+    if (p_GAcounter != -1) GA_Destroy(p_GAcounter);
+    p_GAcounter = GA_Create_handle();
+    int ndim = 1;
+    GA_Set_data(p_GAcounter,ndim,&p_ngroups,C_INT);
+    GA_Set_pgroup(p_GAcounter,p_grp);
+    if (!GA_Allocate(p_GAcounter)) {
+      char buf[256];
+      sprintf(buf,"CostTaskManager::set: unable to allocate %d task"
+          " counters on process %d\n",p_ngroups,p_comm.rank());
+      printf("%s",buf);
+      p_GAcounter = -1;
+      throw gridpack::Exception(buf);
+    }
+    GA_Zero(p_GAcounter);
+    GA_Pgroup_sync(p_grp);
+  }
+
+  /**
+   * Get the next task for a process that evaluates tasks by itself. If the
+   * manager finds a task it returns true and next is set to the index of the
+   * task, otherwise it returns false and next is set to -1
+   * @param next index of next task
+   * @return false if no other tasks are found
+   */
+  bool nextTask(int *next)
+  {
+    recordTime();
+    *next = getTask();
+    return checkTask(next);
+  }
+
+  /**
+   * Get the next task for the whole task group. The same value of next is
+   * returned for all processors in the communicator comm. If the manager
+   * finds a task it returns true and next is set to the index of the task,
+   * otherwise it returns false and next is set to -1
+   * @param comm communicator for task group
+   * @param next index of next task
+   * @return false if no other tasks are found
+   */
+  bool nextTask(Communicator &comm, int *next)
+  {
+    recordTime();
+    if (comm.rank() == 0) {
+      *next = getTask();
+    } else {
+      *next = -1;
+    }
+    MPI_Bcast(next, 1, MPI_INT, 0, static_cast<MPI_Comm>(comm));
+    return checkTask(next);
+  }
+
+  /**
+   * Set all queue counters to their maximum value so that all subsequent
+   * calls to nextTask return false.
+   * NOTE: nextTask must be called at least once by any process that calls
+   * this function or the counter will hang
+   */
+  void cancel(void)
+  {
+    int i;
+    for (i=0; i<p_ngroups; i++) {
+      NGA_Read_inc(p_GAcounter,&i,static_cast<long>(p_ntasks));
+    }
+  }
+
+  /**
+   * Get the wall clock time spent on each task. This is a collective
+   * operation on the communicator used in the constructor.
+   * @param times time in seconds spent on each task
+   */
+  void getTaskTimes(std::vector<double> &times)
+  {
+    times.assign(p_ntasks,0.0);
+    if (p_root) times = p_times;
+    if (p_ntasks > 0) p_comm.sum(&times[0],p_ntasks);
+  }
+
+  /**
+   * Write the time spent on each task to a file so that it can be used as
+   * the cost estimate for a subsequent run. This is a collective operation
+   * on the communicator used in the constructor.
+   * @param filename name of file
+   * @return false if file could not be opened
+   */
+  bool saveTaskTimes(const std::string &filename)
+  {
+    std::vector<double> times;
+    getTaskTimes(times);
+    int ok = 1;
+    if (p_comm.rank() == 0) {
+      std::ofstream fout(filename.c_str());
+      if (fout.is_open()) {
+        char buf[128];
+        int i;
+        for (i=0; i<p_ntasks; i++) {
+          sprintf(buf,"%d %16.8e\n",i,times[i]);
+          fout << buf;
+        }
+        fout.close();
+      } else {
+        ok = 0;
+      }
+    }
+    MPI_Bcast(&ok, 1, MPI_INT, 0, static_cast<MPI_Comm>(p_comm));
+    return (ok == 1);
+  }
+
+  /**
+   * Read task costs from a file written by saveTaskTimes. Tasks that do not
+   * appear in the file are assigned the average cost of the tasks that do.
+   * If the file cannot be read, all tasks are assigned unit cost. This is a
+   * collective operation on comm.
+   * @param comm communicator
+   * @param filename name of file
+   * @param ntasks total number of tasks
+   * @param costs estimated cost of each task
+   * @return false if the file could not be read
+   */
+  static bool readTaskCosts(const Communicator &comm,
+      const std::string &filename, int ntasks, std::vector<double> &costs)
+  {
+    costs.assign(ntasks,0.0);
+    std::vector<int> found(ntasks,0);
+    int ok = 0;
+    if (comm.rank() == 0) {
+      std::ifstream fin(filename.c_str());
+      if (fin.is_open()) {
+        ok = 1;
+        int idx;
+        double cost;
+        while (fin >> idx >> cost) {
+          if (idx >= 0 && idx < ntasks && cost >= 0.0) {
+            costs[idx] = cost;
+            found[idx] = 1;
+          }
+        }
+        fin.close();
+      }
+      int i;
+      int nfound = 0;
+      double avg = 0.0;
+      for (i=0; i<ntasks; i++) {
+        if (found[i]) {
+          avg += costs[i];
+          nfound++;
+        }
+      }
+      if (nfound > 0 && avg > 0.0) {
+        avg /= static_cast<double>(nfound);
+      } else {
+        avg = 1.0;
+      }
+      for (i=0; i<ntasks; i++) {
+        if (!found[i] || costs[i] <= 0.0) costs[i] = avg;
+      }
+    }
+    MPI_Comm mpi_comm = static_cast<MPI_Comm>(comm);
+    MPI_Bcast(&ok, 1, MPI_INT, 0, mpi_comm);
+    if (ntasks > 0) MPI_Bcast(&costs[0], ntasks, MPI_DOUBLE, 0, mpi_comm);
+    return (ok == 1);
+  }
+
+  /**
+   * Print out statistics on how tasks are distributed on processors
+   */
+  void printStats()
+  {
+    int nprocs = GA_Pgroup_nnodes(p_grp);
+    int me = GA_Pgroup_nodeid(p_grp);
+    std::vector<int> procs(2*nprocs);
+    std::vector<double> ptime(nprocs);
+    int i;
+    for (i=0; i<2*nprocs; i++) procs[i] = 0;
+    for (i=0; i<nprocs; i++) ptime[i] = 0.0;
+    procs[2*me] = p_task_count;
+    procs[2*me+1] = p_steal_count;
+    for (i=0; i<p_ntasks; i++) ptime[me] += p_times[i];
+    char plus[2];
+    strcpy(plus,"+");
+    GA_Pgroup_igop(p_grp,&(procs[0]),2*nprocs,plus);
+    GA_Pgroup_dgop(p_grp,&(ptime[0]),nprocs,plus);
+    // print out number of tasks evaluated on each processor
+    if (me == 0) {
+      printf("\nNumber of tasks per processors\n");
+      for (i=0; i<nprocs; i++) {
+        printf("  Number of tasks on process %6d: %6d (stolen: %6d)"
+            " time: %12.4f\n",i,procs[2*i],procs[2*i+1],ptime[i]);
+      }
+    }
+  }
+
+protected:
+
+  // Sort task indices by decreasing cost
+  struct CostCompare {
+    CostCompare(const std::vector<double> &costs) : p_c(costs) {}
+    bool operator()(int a, int b) const { return p_c[a] > p_c[b]; }
+    const std::vector<double> &p_c;
+  };
+
+  /**
+   * Accumulate time spent on the current task
+   */
+  void recordTime(void)
+  {
+    double now = MPI_Wtime();
+    if (p_current >= 0) p_times[p_current] += now - p_start;
+    p_start = now;
+  }
+
+  /**
+   * Finish up a call to nextTask
+   */
+  bool checkTask(int *next)
+  {
+    if (*next >= 0) {
+      p_current = *next;
+      p_task_count++;
+      return true;
+    } else {
+      p_current = -1;
+      GA_Pgroup_sync(p_grp);
+      return false;
+    }
+  }
+
+  /**
+   * Get a task from the local queue or, if that is empty, steal a task from
+   * the queue with the most estimated work remaining
+   * @return task index or -1 if no tasks remain
+   */
+  int getTask(void)
+  {
+    long one = 1;
+    int q = p_mygroup;
+    int len = p_queues[q].size();
+    int idx = static_cast<int>(NGA_Read_inc(p_GAcounter,&q,one));
+    if (idx < len) return p_queues[q][idx];
+    std::vector<int> counters(p_ngroups);
+    int lo = 0;
+    int hi = p_ngroups-1;
+    int ld = 1;
+    while (true) {
+      NGA_Get(p_GAcounter,&lo,&hi,&counters[0],&ld);
+      int victim = -1;
+      double rmax = 0.0;
+      int i;
+      for (i=0; i<p_ngroups; i++) {
+        len = p_queues[i].size();
+        if (counters[i] < len && p_remaining[i][counters[i]] > rmax) {
+          rmax = p_remaining[i][counters[i]];
+          victim = i;
+        }
+      }
+      if (victim < 0) return -1;
+      idx = static_cast<int>(NGA_Read_inc(p_GAcounter,&victim,one));
+      if (idx < static_cast<int>(p_queues[victim].size())) {
+        p_steal_count++;
+        return p_queues[victim][idx];
+      }
+    }
+    return -1;
+  }
+
+  Communicator p_comm;
+  int p_GAcounter;
+  int p_ntasks;
+  int p_grp;
+  int p_ngroups;
+  int p_mygroup;
+  int p_task_count;
+  int p_steal_count;
+  int p_current;
+  double p_start;
+  bool p_root;
+  std::vector<double> p_costs;
+  std::vector<double> p_times;
+  std::vector<std::vector<int> > p_queues;
+  std::vector<std::vector<double> > p_remaining;
+};
+
+
+} // namespace gridpack
+} // namespace parallel
+
+#endif
@@ -0,0 +1,279 @@
+// -------------------------------------------------------------
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+// -------------------------------------------------------------
+/**
+ * @file   reduction_batch.cpp
+ * @date   October 19, 2026
+ *
+ * @brief
+ *
+ *
+ */
+// -------------------------------------------------------------
+
+#include <stdio.h>
+#include "gridpack/utilities/exception.hpp"
+#include "reduction_batch.hpp"
+
+#if defined(MPI_VERSION) && MPI_VERSION >= 3
+#define GRIDPACK_HAVE_IALLREDUCE 1
+#endif
+
+namespace gridpack {
+namespace parallel {
+
+/**
+ * Combine operation/value pairs. Each pair carries its own operation code
+ * so that entries with different operations can be reduced with a single
+ * call to MPI_Allreduce
+ */
+static void batchReduceOp(void *invec, void *inoutvec, int *len,
+    MPI_Datatype *type)
+{
+  double *in = static_cast<double*>(invec);
+  double *inout = static_cast<double*>(inoutvec);
+  int i;
+  for (i=0; i<*len; i++) {
+    double a = in[2*i+1];
+    double b = inout[2*i+1];
+    switch (static_cast<int>(in[2*i])) {
+      case ReductionBatch::SUM:
+        inout[2*i+1] = a+b;
+        break;
+      case ReductionBatch::MAX:
+      case ReductionBatch::ANY:
+        if (a > b) inout[2*i+1] = a;
+        break;
+      case ReductionBatch::MIN:
+      case ReductionBatch::ALL:
+        if (a < b) inout[2*i+1] = a;
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+// -------------------------------------------------------------
+// ReductionBatch constructor
+// -------------------------------------------------------------
+ReductionBatch::ReductionBatch(const Communicator &comm)
+  : p_comm(comm), p_pending(false), p_reduced(false)
+{
+  MPI_Type_contiguous(2, MPI_DOUBLE, &p_type);
+  MPI_Type_commit(&p_type);
+  MPI_Op_create(&batchReduceOp, 1, &p_op);
+  p_request = MPI_REQUEST_NULL;
+}
+
+// -------------------------------------------------------------
+// ReductionBatch destructor
+// -------------------------------------------------------------
+ReductionBatch::~ReductionBatch(void)
+{
+  wait();
+  MPI_Op_free(&p_op);
+  MPI_Type_free(&p_type);
+}
+
+/**
+ * Add a value to the batch
+ * @param op reduction operation
+ * @param value local value
+ * @return index that can be used to retrieve the reduced value
+ */
+int ReductionBatch::add(Operation op, double value)
+{
+  wait();
+  int idx = p_send.size()/2;
+  p_send.push_back(static_cast<double>(op));
+  p_send.push_back(value);
+  p_reduced = false;
+  return idx;
+}
+
+/**
+ * Convenience functions for adding values to the batch
+ * @param value local value
+ * @return index that can be used to retrieve the reduced value
+ */
+int ReductionBatch::addSum(double value)
+{
+  return add(SUM, value);
+}
+
+int ReductionBatch::addMax(double value)
+{
+  return add(MAX, value);
+}
+
+int ReductionBatch::addMin(double value)
+{
+  return add(MIN, value);
+}
+
+/**
+ * Add a flag that is true if it is true on all processors
+ * @param flag local value of flag
+ * @return index that can be used to retrieve the reduced value
+ */
+int ReductionBatch::addAll(bool flag)
+{
+  return add(ALL, flag ? 1.0 : 0.0);
+}
+
+/**
+ * Add a flag that is true if it is true on at least one processor
+ * @param flag local value of flag
+ * @return index that can be used to retrieve the reduced value
+ */
+int ReductionBatch::addAny(bool flag)
+{
+  return add(ANY, flag ? 1.0 : 0.0);
+}
+
+/**
+ * Reset the local value of an entry so that a batch can be reused
+ * without adding the entries again
+ * @param idx index of entry
+ * @param value new local value
+ */
+void ReductionBatch::set(int idx, double value)
+{
+  wait();
+  p_send[2*idx+1] = value;
+  p_reduced = false;
+}
+
+/**
+ * Remove all entries from the batch. Any outstanding reduction is
+ * completed first
+ */
+void ReductionBatch::clear(void)
+{
+  wait();
+  p_send.clear();
+  p_recv.clear();
+  p_reduced = false;
+}
+
+/**
+ * @return number of entries in batch
+ */
+int ReductionBatch::size(void) const
+{
+  return p_send.size()/2;
+}
+
+/**
+ * Reduce all entries using a single blocking collective
+ */
+void ReductionBatch::reduce(void)
+{
+  wait();
+  int n = size();
+  p_recv.resize(p_send.size());
+  if (n > 0) {
+    MPI_Allreduce(&p_send[0], &p_recv[0], n, p_type, p_op,
+        static_cast<MPI_Comm>(p_comm));
+  }
+  p_reduced = true;
+}
+
+/**
+ * Start a non-blocking reduction of all entries. The reduced values are
+ * not available until wait has been called or test has returned true.
+ * If the MPI library does not support non-blocking collectives, the
+ * reduction is completed before this function returns
+ */
+void ReductionBatch::start(void)
+{
+#ifdef GRIDPACK_HAVE_IALLREDUCE
+  wait();
+  int n = size();
+  p_recv.resize(p_send.size());
+  p_reduced = false;
+  if (n > 0) {
+    MPI_Iallreduce(&p_send[0], &p_recv[0], n, p_type, p_op,
+        static_cast<MPI_Comm>(p_comm), &p_request);
+    p_pending = true;
+  } else {
+    p_reduced = true;
+  }
+#else
+  reduce();
+#endif
+}
+
+/**
+ * Check if an outstanding reduction has completed
+ * @return true if reduced values are available
+ */
+bool ReductionBatch::test(void)
+{
+  if (p_pending) {
+    int flag = 0;
+    MPI_Test(&p_request, &flag, MPI_STATUS_IGNORE);
+    if (flag) {
+      p_pending = false;
+      p_reduced = true;
+    }
+  }
+  return p_reduced;
+}
+
+/**
+ * Wait for an outstanding reduction to complete
+ */
+void ReductionBatch::wait(void)
+{
+  if (p_pending) {
+    MPI_Wait(&p_request, MPI_STATUS_IGNORE);
+    p_pending = false;
+    p_reduced = true;
+  }
+}
+
+/**
+ * @return true if a reduction has been started but not completed
+ */
+bool ReductionBatch::pending(void) const
+{
+  return p_pending;
+}
+
+/**
+ * Get a reduced value. If a non-blocking reduction is outstanding, this
+ * waits for it to complete. It is an error to call this before the
+ * batch has been reduced
+ * @param idx index of entry
+ * @return value
+ */
+double ReductionBatch::value(int idx)
+{
+  wait();
+  if (!p_reduced) {
+    char buf[128];
+    sprintf(buf,"ReductionBatch::value: entry %d has not been reduced",idx);
+    throw gridpack::Exception(buf);
+  }
+  return p_recv[2*idx+1];
+}
+
+/**
+ * Get a reduced flag added by addAll or addAny
+ * @param idx index of entry
+ * @return flag
+ */
+bool ReductionBatch::flag(int idx)
+{
+  return value(idx) != 0.0;
+}
+
+} // namespace parallel
+} // namespace gridpack
@@ -0,0 +1,190 @@
+// Emacs Mode Line: -*- Mode:c++;-*-
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   reduction_batch.hpp
+ * @date   October 19, 2026
+ *
+ * @brief  Collect several scalar reductions (sum, max, min, logical and,
+ *         logical or) and complete them with a single collective. The
+ *         reduction can be blocking or, if the MPI library supports
+ *         MPI_Iallreduce, non-blocking so that it can overlap with other
+ *         work.
+ *
+ *
+ */
+
+// -------------------------------------------------------------
+
+#ifndef _reduction_batch_hpp_
+#define _reduction_batch_hpp_
+
+#include <vector>
+#include "gridpack/parallel/communicator.hpp"
+#include "gridpack/utilities/uncopyable.hpp"
+
+namespace gridpack {
+namespace parallel {
+
+// -------------------------------------------------------------
+//  class ReductionBatch
+//
+//  Typical use:
+//
+//    ReductionBatch batch(comm);
+//    int iconv = batch.addAll(converged);
+//    int ierr = batch.addMax(error);
+//    batch.start();
+//    ... other work ...
+//    batch.wait();
+//    if (batch.flag(iconv) && batch.value(ierr) < tol) ...
+// -------------------------------------------------------------
+class ReductionBatch
+  : private utility::Uncopyable
+{
+public:
+
+  /// Reduction operations that can be combined in a batch
+  enum Operation { SUM = 0, MAX, MIN, ALL, ANY };
+
+  /**
+   * Constructor
+   * @param comm communicator over which values are reduced
+   */
+  ReductionBatch(const Communicator &comm);
+
+  /**
+   * Destructor. Completes any outstanding reduction
+   */
+  ~ReductionBatch(void);
+
+  /**
+   * Add a value to the batch
+   * @param op reduction operation
+   * @param value local value
+   * @return index that can be used to retrieve the reduced value
+   */
+  int add(Operation op, double value);
+
+  /**
+   * Convenience functions for adding values to the batch
+   * @param value local value
+   * @return index that can be used to retrieve the reduced value
+   */
+  int addSum(double value);
+  int addMax(double value);
+  int addMin(double value);
+
+  /**
+   * Add a flag that is true if it is true on all processors
+   * @param flag local value of flag
+   * @return index that can be used to retrieve the reduced value
+   */
+  int addAll(bool flag);
+
+  /**
+   * Add a flag that is true if it is true on at least one processor
+   * @param flag local value of flag
+   * @return index that can be used to retrieve the reduced value
+   */
+  int addAny(bool flag);
+
+  /**
+   * Reset the local value of an entry so that a batch can be reused
+   * without adding the entries again
+   * @param idx index of entry
+   * @param value new local value
+   */
+  void set(int idx, double value);
+
+  /**
+   * Remove all entries from the batch. Any outstanding reduction is
+   * completed first
+   */
+  void clear(void);
+
+  /**
+   * @return number of entries in batch
+   */
+  int size(void) const;
+
+  /**
+   * Reduce all entries using a single blocking collective
+   */
+  void reduce(void);
+
+  /**
+   * Start a non-blocking reduction of all entries. The reduced values are
+   * not available until wait has been called or test has returned true.
+   * If the MPI library does not support non-blocking collectives, the
+   * reduction is completed before this function returns
+   */
+  void start(void);
+
+  /**
+   * Check if an outstanding reduction has completed
+   * @return true if reduced values are available
+   */
+  bool test(void);
+
+  /**
+   * Wait for an outstanding reduction to complete
+   */
+  void wait(void);
+
+  /**
+   * @return true if a reduction has been started but not completed
+   */
+  bool pending(void) const;
+
+  /**
+   * Get a reduced value. If a non-blocking reduction is outstanding, this
+   * waits for it to complete. It is an error to call this before the
+   * batch has been reduced
+   * @param idx index of entry
+   * @return value
+   */
+  double value(int idx);
+
+  /**
+   * Get a reduced flag added by addAll or addAny
+   * @param idx index of entry
+   * @return flag
+   */
+  bool flag(int idx);
+
+private:
+
+  /// Communicator for reduction
+  Communicator p_comm;
+
+  /// Pairs of operation codes and values, stored as [2*idx], [2*idx+1]
+  std::vector<double> p_send;
+
+  /// Reduced pairs of operation codes and values
+  std::vector<double> p_recv;
+
+  /// MPI datatype for an operation/value pair
+  MPI_Datatype p_type;
+
+  /// MPI operation that applies the operation stored with each value
+  MPI_Op p_op;
+
+  /// Request handle for non-blocking reduction
+  MPI_Request p_request;
+
+  /// True if non-blocking reduction is outstanding
+  bool p_pending;
+
+  /// True if reduced values are available
+  bool p_reduced;
+};
+
+} // namespace parallel
+} // namespace gridpack
+
+#endif
@@ -0,0 +1,131 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   reduction_test.cpp
+ * @date   October 19, 2026
+ *
+ * @brief  A simple test of the GridPACK batched reduction module
+ *
+ *
+ */
+
+// -------------------------------------------------------------
+// -------------------------------------------------------------
+// Battelle Memorial Institute
+// Pacific Northwest Laboratory
+// -------------------------------------------------------------
+
+#include <iostream>
+#include <ga.h>
+#include "gridpack/parallel/parallel.hpp"
+#include "gridpack/parallel/reduction_batch.hpp"
+#include "gridpack/utilities/exception.hpp"
+#include "gridpack/environment/environment.hpp"
+
+// -------------------------------------------------------------
+//  Main Program
+// -------------------------------------------------------------
+int
+main(int argc, char **argv)
+{
+  gridpack::Environment env(argc, argv);
+  int ret = 0;
+  // Create an artificial scope so that all objects call their destructors
+  // before GA_Terminate is called
+  if (1) {
+    gridpack::parallel::Communicator world;
+    int me = world.rank();
+    int nproc = world.size();
+    if (me == 0) {
+      printf("Testing ReductionBatch on %d processors\n\n",nproc);
+    }
+    double rme = static_cast<double>(me);
+    int chk = 1;
+
+    // Blocking reduction of mixed operations
+    gridpack::parallel::ReductionBatch batch(world);
+    int isum = batch.addSum(rme+1.0);
+    int imax = batch.addMax(rme);
+    int imin = batch.addMin(rme);
+    int iall = batch.addAll(me != 0);
+    int iany = batch.addAny(me == nproc-1);
+    batch.reduce();
+    double sum = 0.5*static_cast<double>(nproc*(nproc+1));
+    if (batch.value(isum) != sum) {
+      printf("p[%d] Incorrect sum: %f expected: %f\n",me,batch.value(isum),sum);
+      chk = 0;
+    }
+    if (batch.value(imax) != static_cast<double>(nproc-1)) {
+      printf("p[%d] Incorrect max: %f\n",me,batch.value(imax));
+      chk = 0;
+    }
+    if (batch.value(imin) != 0.0) {
+      printf("p[%d] Incorrect min: %f\n",me,batch.value(imin));
+      chk = 0;
+    }
+    if (batch.flag(iall)) {
+      printf("p[%d] Incorrect all flag\n",me);
+      chk = 0;
+    }
+    if (!batch.flag(iany)) {
+      printf("p[%d] Incorrect any flag\n",me);
+      chk = 0;
+    }
+
+    // Non-blocking reduction, reusing entries
+    batch.set(isum, 2.0);
+    batch.set(iall, 1.0);
+    batch.start();
+    batch.test();
+    batch.wait();
+    if (batch.value(isum) != 2.0*static_cast<double>(nproc)) {
+      printf("p[%d] Incorrect non-blocking sum: %f\n",me,batch.value(isum));
+      chk = 0;
+    }
+    if (!batch.flag(iall)) {
+      printf("p[%d] Incorrect non-blocking all flag\n",me);
+      chk = 0;
+    }
+
+    // Values retrieved directly after starting a non-blocking reduction
+    // must be the reduced values, not the local values
+    batch.set(imax, rme+10.0);
+    batch.start();
+    if (batch.value(imax) != static_cast<double>(nproc+9)) {
+      printf("p[%d] Value returned before reduction completed: %f\n",me,
+          batch.value(imax));
+      chk = 0;
+    }
+    if (batch.pending()) {
+      printf("p[%d] Reduction still pending after value\n",me);
+      chk = 0;
+    }
+
+    // Values that have not been reduced cannot be retrieved
+    gridpack::parallel::ReductionBatch unreduced(world);
+    int iloc = unreduced.addSum(rme);
+    bool caught = false;
+    try {
+      unreduced.value(iloc);
+    } catch (const gridpack::Exception &e) {
+      caught = true;
+    }
+    if (!caught) {
+      printf("p[%d] No error for value that was not reduced\n",me);
+      chk = 0;
+    }
+
+    world.sum(&chk,1);
+    if (chk == nproc && me == 0) {
+      printf("Reductions OK\n");
+    } else if (chk < nproc && me == 0) {
+      printf("Error found in reductions\n");
+    }
+    if (chk < nproc) ret = 1;
+  }
+  return ret;
+}
@@ -25,12 +25,47 @@
 // -------------------------------------------------------------
 
 #include <iostream>
+#include <stdio.h>
+#include <math.h>
 #include <ga.h>
 #include "gridpack/parallel/parallel.hpp"
 #include "gridpack/parallel/task_manager.hpp"
+#include "gridpack/parallel/cost_task_manager.hpp"
 #include "gridpack/timer/local_timer.hpp"
 #include "gridpack/environment/environment.hpp"
 
+/**
+ * Check that every task was handed out exactly once
+ * @param comm communicator containing all processes
+ * @param count number of times each task was evaluated on this process
+ * @param name description of the test
+ * @return true if all tasks were evaluated exactly once
+ */
+bool checkCounts(gridpack::parallel::Communicator &comm,
+    std::vector<int> &count, const char *name)
+{
+  int ntasks = count.size();
+  if (ntasks > 0) comm.sum(&count[0],ntasks);
+  int i;
+  bool ok = true;
+  for (i=0; i<ntasks; i++) {
+    if (count[i] != 1) {
+      if (comm.rank() == 0) {
+        printf("%s: task %d evaluated %d times\n",name,i,count[i]);
+      }
+      ok = false;
+    }
+  }
+  if (comm.rank() == 0) {
+    if (ok) {
+      printf("\n%s evaluated all tasks once\n",name);
+    } else {
+      printf("\n%s failed\n",name);
+    }
+  }
+  return ok;
+}
+
 // -------------------------------------------------------------
 //  Main Program
 // -------------------------------------------------------------
@@ -39,6 +74,7 @@ main(int argc, char **argv)
 {
   gridpack::Environment env(argc, argv);
   GA_Initialize();
+  int ret = 0;
   // Create an artificial scope so that all objects call their destructors
   // before GA_Terminate is called
   if (1) {
@@ -94,9 +130,121 @@ main(int argc, char **argv)
     if (me == 0) {
       printf("\nOverhead per task is %e seconds\n",elapsed);
     }
+
+    // Test cost-aware task manager. Assign tasks costs that vary by a factor
+    // of 100 and check that every task is evaluated exactly once
+    ntasks = 10*nprocs;
+    std::vector<double> costs(ntasks);
+    for (i=0; i<ntasks; i++) {
+      costs[i] = (i%7 == 0) ? 100.0 : static_cast<double>(i%5+1);
+    }
+    gridpack::parallel::CostTaskManager cstmgr(world);
+    cstmgr.set(costs);
+    std::vector<int> count(ntasks,0);
+    while (cstmgr.nextTask(&itask)) {
+      count[itask]++;
+    }
+    if (!checkCounts(world,count,"Cost-aware task manager")) ret = 1;
+    cstmgr.printStats();
+
+    // Repeat on task groups
+    if (nprocs > 1) {
+      int color = (static_cast<double>(me)/static_cast<double>(nprocs) < 0.5)
+        ? 0 : 1;
+      gridpack::parallel::Communicator lcomm = world.split(color);
+      cstmgr.set(costs, lcomm);
+      for (i=0; i<ntasks; i++) count[i] = 0;
+      while (cstmgr.nextTask(lcomm,&itask)) {
+        if (lcomm.rank() == 0) count[itask]++;
+      }
+      if (!checkCounts(world,count,"Cost-aware task manager on groups")) {
+        ret = 1;
+      }
+    }
+
+    // Read costs from a file that is missing some tasks. Missing tasks get
+    // the average cost of the tasks in the file
+    if (me == 0) {
+      FILE *fp = fopen("task_costs.txt","w");
+      for (i=0; i<ntasks; i+=2) {
+        fprintf(fp,"%d %16.8e\n",i,static_cast<double>(i+1));
+      }
+      fclose(fp);
+    }
+    bool ok = gridpack::parallel::CostTaskManager::readTaskCosts(world,
+        "task_costs.txt", ntasks, costs);
+    double avg = 0.0;
+    int nfile = 0;
+    for (i=0; i<ntasks; i+=2) {
+      avg += static_cast<double>(i+1);
+      nfile++;
+    }
+    avg /= static_cast<double>(nfile);
+    for (i=0; i<ntasks; i++) {
+      double expect = (i%2 == 0) ? static_cast<double>(i+1) : avg;
+      if (fabs(costs[i]-expect) > 1.0e-6*expect) ok = false;
+    }
+    if (me == 0) {
+      if (ok) {
+        printf("\nTask costs read from file\n");
+      } else {
+        printf("\nTask costs read from file are incorrect\n");
+      }
+    }
+    if (!ok) ret = 1;
+
+    // Save the recorded task times and use them as cost estimates for
+    // another run
+    std::vector<double> times;
+    cstmgr.getTaskTimes(times);
+    if (!cstmgr.saveTaskTimes("task_times.txt")) {
+      if (me == 0) printf("\nUnable to save task times\n");
+      ret = 1;
+    }
+    ok = gridpack::parallel::CostTaskManager::readTaskCosts(world,
+        "task_times.txt", ntasks, costs);
+    for (i=0; i<ntasks; i++) {
+      if (times[i] > 0.0 && fabs(costs[i]-times[i]) > 1.0e-6*times[i]) {
+        ok = false;
+      }
+    }
+    if (me == 0) {
+      if (ok) {
+        printf("\nTask times read back as task costs\n");
+      } else {
+        printf("\nTask times read back as task costs are incorrect\n");
+      }
+    }
+    if (!ok) ret = 1;
+    cstmgr.set(costs);
+    for (i=0; i<ntasks; i++) count[i] = 0;
+    while (cstmgr.nextTask(&itask)) {
+      count[itask]++;
+    }
+    if (!checkCounts(world,count,"Cost-aware task manager with saved times")) {
+      ret = 1;
+    }
+
+    // A missing cost file gives unit costs
+    ok = !gridpack::parallel::CostTaskManager::readTaskCosts(world,
+        "no_such_task_costs.txt", ntasks, costs);
+    for (i=0; i<ntasks; i++) {
+      if (costs[i] != 1.0) ok = false;
+    }
+    if (me == 0 && !ok) {
+      printf("\nMissing cost file not handled correctly\n");
+    }
+    if (!ok) ret = 1;
+    if (me == 0) {
+      if (ret == 0) {
+        printf("\nTask manager test passed\n");
+      } else {
+        printf("\nTask manager test failed\n");
+      }
+    }
   }
 
   GA_Terminate();
-  return 0;
+  return ret;
 }
 
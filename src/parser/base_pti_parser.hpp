@@ -38,6 +38,7 @@
 #include "gridpack/network/base_network.hpp"
 #include "gridpack/parser/base_parser.hpp"
 #include "gridpack/parser/hash_distr.hpp"
+#include "gridpack/parser/psse_tokenizer.hpp"
 #include "gridpack/factory/base_factory.hpp"
 #include "parser_classes/gencls.hpp"
 #include "parser_classes/gensal.hpp"
@@ -120,26 +121,7 @@ class BasePTIParser : public BaseParser<_network>
     std::vector<std::string> splitPSSELine (std::string line)
     {
       std::vector<std::string> ret;
-      int i, j;
-      std::vector<std::string>  split_line;
-      // split line into tokens based on comma delimiters
-      boost::algorithm::split(split_line, line, boost::algorithm::is_any_of(","),
-                    boost::token_compress_off);
-      int slen = split_line.size();
-      // parse each token based on blank spaces
-      for (i=0; i<slen; i++) {
-        if (isBlank(split_line[i])) {
-          // If two consecutive commas have nothing in between, replace it with
-          // a zero "0" character. This should be converted to 0 and 0.0 by the
-          // atoi and atof functions, respectively
-          ret.push_back("0");
-        } else {
-          std::vector<std::string> tokens;
-          tokens = p_util.blankTokenizer(split_line[i]);
-          int tlen = tokens.size();
-          for (j=0; j<tlen; j++) ret.push_back(tokens[j]);
-        }
-      }
+      PSSETokenizer::splitLine(line, ret);
       return ret;
     }
 
@@ -1519,35 +1501,24 @@ class BasePTIParser : public BaseParser<_network>
 
     void find_ds_par(std::ifstream & input)
     {
-      std::string          line;
       gridpack::component::DataCollection *data;
-      while(std::getline(input,line)) {
-        // Check to see if line is blank
-        int idx = line.find_first_not_of(' ');
-        if (idx == std::string::npos) continue;
-
-        std::string record = line;
-        idx = line.find('/');
-        while (idx == std::string::npos) {
-          std::getline(input,line);
-          idx = line.find('/');
-          record.append(line);
-        }
-        idx = record.find('/');
-        if (idx != std::string::npos) record.erase(idx,record.length()-idx);
-        std::vector<std::string>  split_line;
-        split_line = splitPSSELine(record);
+      // Read complete file into memory and split records in place
+      PSSETokenizer tokenizer;
+      tokenizer.read(input);
+      while (tokenizer.nextRecord()) {
+        if (tokenizer.numTokens() < 2) continue;
+        const std::vector<PSSEToken> &split_line = tokenizer.tokens();
 
         std::string sval;
         // MODEL TYPE              "MODEL"                  string
         gridpack::utility::StringUtils util;
-        sval = util.trimQuotes(split_line[1]);
+        sval = split_line[1].unquoted().str();
         util.toUpper(sval);
 
         if (onGenerator(sval)) {
           // GENERATOR_BUSNUMBER               "I"                   integer
           int l_idx, o_idx;
-          o_idx = atoi(split_line[0].c_str());
+          o_idx = split_line[0].toInt();
 #ifdef OLD_MAP
           std::map<int, int>::iterator it;
 #else
@@ -1569,7 +1540,7 @@ class BasePTIParser : public BaseParser<_network>
           int g_id = -1;
           if (ngen > 0) {
             // Clean up 2 character tag for generator ID
-            std::string tag = util.clean2Char(split_line[2]);
+            std::string tag = split_line[2].tag();
             int i;
             for (i=0; i<ngen; i++) {
               std::string t_id;
@@ -1669,9 +1640,9 @@ class BasePTIParser : public BaseParser<_network>
         } else if (onBus(sval)) {
           int l_idx, o_idx;
           if (sval == "LVSHBL") {
-            o_idx = atoi(split_line[0].c_str());
+            o_idx = split_line[0].toInt();
           } else if (sval == "FRQTPAT") {
-            o_idx = atoi(split_line[3].c_str());
+            o_idx = split_line[3].toInt();
           }
 #ifdef OLD_MAP
           std::map<int, int>::iterator it;
@@ -1696,7 +1667,7 @@ class BasePTIParser : public BaseParser<_network>
         } else if (onLoad(sval)) {
           // Load bus number
           int l_idx, o_idx;
-          o_idx = atoi(split_line[0].c_str());
+          o_idx = split_line[0].toInt();
 #ifdef OLD_MAP
           std::map<int, int>::iterator it;
 #else
@@ -1718,7 +1689,7 @@ class BasePTIParser : public BaseParser<_network>
           int l_id = -1;
           if (nload > 0) {
             // Clean up 2 character tag for load ID
-            std::string tag = util.clean2Char(split_line[2]);
+            std::string tag = split_line[2].tag();
             int i;
             for (i=0; i<nload; i++) {
               std::string t_id;
@@ -1737,7 +1708,7 @@ class BasePTIParser : public BaseParser<_network>
             parser.parse(split_line, data, l_id);
           } else if (sval == "USRLOD") {
             std::string sdev;
-            sdev = util.trimQuotes(split_line[3]);
+            sdev = split_line[3].unquoted().str();
             if (sdev == "ACMTBLU1") {
               Acmtblu1Parser<load_params> parser;
               parser.parse(split_line, data, l_id);
@@ -1748,8 +1719,8 @@ class BasePTIParser : public BaseParser<_network>
           }
         } else if (onBranch(sval)) {
           int l_idx, from_idx, to_idx;
-          from_idx = atoi(split_line[0].c_str());
-          to_idx = atoi(split_line[2].c_str());
+          from_idx = split_line[0].toInt();
+          to_idx = split_line[2].toInt();
           std::map<std::pair<int, int>, int>::iterator it;
           it = p_branchMap->find(std::pair<int,int>(from_idx,to_idx));
           if (it != p_branchMap->end()) {
@@ -1771,34 +1742,17 @@ class BasePTIParser : public BaseParser<_network>
         std::vector<branch_relay_params> *branch_relay_vector,
         std::vector<load_params> *load_vector)
     {
-      std::string          line;
       gen_vector->clear();
-      while(std::getline(input,line)) {
-        // Check to see if line is blank
-        int idx = line.find_first_not_of(' ');
-	int idx2 = line.find_first_not_of('\r'); // Some systems use \r\n for line ends.
-        if (idx == std::string::npos || idx2 == std::string::npos) continue;
-        // Check to see if line is a comment
-        if (line[idx] == '/') {
-          if (line.length() > idx+2 && line[idx+1] == '/') {
-            continue;
-          }
-        }
-
-        std::string record = line;
-        idx = line.find('/');
-        while (idx == std::string::npos) {
-          std::getline(input,line);
-          idx = line.find('/');
-          record.append(line);
-        }
-        idx = record.find('/');
-        if (idx != std::string::npos) record.erase(idx,record.length()-idx);
-        std::vector<std::string>  split_line;
-        split_line = splitPSSELine(record);
+      // Read complete file into memory and split records in place. Blank
+      // lines, comment lines and \r\n line ends are handled by the tokenizer
+      PSSETokenizer tokenizer;
+      tokenizer.read(input);
+      while (tokenizer.nextRecord()) {
+        if (tokenizer.numTokens() < 2) continue;
+        const std::vector<PSSEToken> &split_line = tokenizer.tokens();
         std::string sval;
         gridpack::utility::StringUtils util;
-        sval = util.trimQuotes(split_line[1]);
+        sval = split_line[1].unquoted().str();
         util.toUpper(sval);
 
         if (onGenerator(sval)) {
@@ -1806,11 +1760,11 @@ class BasePTIParser : public BaseParser<_network>
 
           // GENERATOR_BUSNUMBER               "I"                   integer
           int o_idx;
-          o_idx = atoi(split_line[0].c_str());
+          o_idx = split_line[0].toInt();
           data.bus_id = o_idx;
 
           // Clean up 2 character tag for generator ID
-          std::string tag = util.clean2Char(split_line[2]);
+          std::string tag = split_line[2].tag();
 	  
 
 	  
@@ -1909,14 +1863,14 @@ class BasePTIParser : public BaseParser<_network>
           int o_idx;
           if (sval == "LVSHBL") {
             bus_relay_params data;
-            o_idx = atoi(split_line[0].c_str());
+            o_idx = split_line[0].toInt();
             data.bus_id = o_idx;
             LvshblParser<bus_relay_params> parser;
             parser.store(split_line,data);
             bus_relay_vector->push_back(data);
           } else if (sval == "FRQTPAT") {
             bus_relay_params data;
-            o_idx = atoi(split_line[3].c_str());
+            o_idx = split_line[3].toInt();
             data.bus_id = o_idx;
             FrqtpatParser<bus_relay_params> parser;
             parser.store(split_line,data);
@@ -1925,11 +1879,11 @@ class BasePTIParser : public BaseParser<_network>
         } else if (onLoad(sval)) {
           // ID of bus that owns load
           load_params data;
-          int o_idx = atoi(split_line[0].c_str());
+          int o_idx = split_line[0].toInt();
           data.bus_id = o_idx;
 
           // Clean up 2 character tag for load ID
-          std::string tag = util.clean2Char(split_line[2]);
+          std::string tag = split_line[2].tag();
           strcpy(data.id, tag.c_str());
           if (sval == "CIM6BL") {
             Cim6blParser<load_params> parser;
@@ -1939,7 +1893,7 @@ class BasePTIParser : public BaseParser<_network>
             parser.store(split_line,data);
           } else if (sval == "USRLOD") {
             std::string sdev;
-            sdev = util.trimQuotes(split_line[3]);
+            sdev = split_line[3].unquoted().str();
             if (sdev == "ACMTBLU1") {
               Acmtblu1Parser<load_params> parser;
               parser.store(split_line,data);
@@ -1954,8 +1908,8 @@ class BasePTIParser : public BaseParser<_network>
 
           int from_idx, to_idx;
           if (sval == "DISTR1") {
-            from_idx = atoi(split_line[0].c_str());
-            to_idx = atoi(split_line[3].c_str());
+            from_idx = split_line[0].toInt();
+            to_idx = split_line[3].toInt();
             data.from_bus = from_idx;
             data.to_bus = to_idx;
             Distr1Parser<branch_relay_params> parser;
@@ -48,28 +48,28 @@ void gridpack::parser::AreaParser33::parse(
 
   int ncnt = 0;
   while(test_end(line)) {
-    std::vector<std::string>  split_line;
+    PSSERecord split_line;
     if (check_comment(line)) {
       stream.nextLine(line);
       continue;
     }
     this->cleanComment(line);
-    split_line = this->splitPSSELine(line);
+    this->splitPSSELine(line, split_line);
 
     // AREAINTG_ISW             "I"                    integer
-    p_network_data->addValue(AREAINTG_ISW, atoi(split_line[1].c_str()),ncnt);
+    p_network_data->addValue(AREAINTG_ISW, split_line[1].toInt(),ncnt);
 
     // AREAINTG_NUMBER             "I"                    integer
-    p_network_data->addValue(AREAINTG_NUMBER, atoi(split_line[0].c_str()),ncnt);
+    p_network_data->addValue(AREAINTG_NUMBER, split_line[0].toInt(),ncnt);
 
     // AREAINTG_PDES          "PDES"                 float
-    p_network_data->addValue(AREAINTG_PDES, atof(split_line[2].c_str()),ncnt);
+    p_network_data->addValue(AREAINTG_PDES, split_line[2].toDouble(),ncnt);
 
     // AREAINTG_PTOL          "PTOL"                 float
-    p_network_data->addValue(AREAINTG_PTOL, atof(split_line[3].c_str()),ncnt);
+    p_network_data->addValue(AREAINTG_PTOL, split_line[3].toDouble(),ncnt);
 
     // AREAINTG_NAME         "ARNAM"                string
-    p_network_data->addValue(AREAINTG_NAME, split_line[4].c_str(),ncnt);
+    p_network_data->addValue(AREAINTG_NAME, split_line[4].str().c_str(),ncnt);
     ncnt++;
 
     stream.nextLine(line);
@@ -9,6 +9,7 @@
  *           Author: Bruce Palmer
  */
 #include "gridpack/parser/block_parsers/base_block_parser.hpp"
+#include "gridpack/parser/psse_tokenizer.hpp"
 
 /**
  * Constructor
@@ -198,30 +199,23 @@ std::vector<std::string> gridpack::parser::BaseBlockParser::splitPSSELine (
     std::string line)
 {
   std::vector<std::string> ret;
-  int i, j;
-  std::vector<std::string>  split_line;
-  // split line into tokens based on comma delimiters
-  boost::algorithm::split(split_line, line, boost::algorithm::is_any_of(","),
-      boost::token_compress_off);
-  int slen = split_line.size();
-  gridpack::utility::StringUtils p_util;
-  // parse each token based on blank spaces
-  for (i=0; i<slen; i++) {
-    if (isBlank(split_line[i])) {
-      // If two consecutive commas have nothing in between, replace it with
-      // a zero "0" character. This should be converted to 0 and 0.0 by the
-      // atoi and atof functions, respectively
-      ret.push_back("0");
-    } else {
-      std::vector<std::string> tokens;
-      tokens = p_util.blankTokenizer(split_line[i]);
-      int tlen = tokens.size();
-      for (j=0; j<tlen; j++) ret.push_back(tokens[j]);
-    }
-  }
+  PSSETokenizer::splitLine(line, ret);
   return ret;
 }
 
+/**
+ * Split PSS/E formatted lines into individual tokens using both blanks and
+ * commas as delimiters. The tokens are stored in the record without
+ * creating a string for each token
+ * @param line input string from PSS/E file
+ * @param record record that holds a copy of the line and its tokens
+ */
+void gridpack::parser::BaseBlockParser::splitPSSELine (
+    const std::string &line, PSSERecord &record)
+{
+  record.split(line);
+}
+
 /**
  * Check to see if string is blank
  * @param string string that needs to checked for non-blank characters
@@ -234,6 +228,20 @@ bool gridpack::parser::BaseBlockParser::isBlank(std::string string)
   return true;
 }
 
+/**
+ * Check to see if token is blank
+ * @param token token that needs to checked for non-blank characters
+ * @return true if no non-blank characters are found
+ */
+bool gridpack::parser::BaseBlockParser::isBlank(const PSSEToken &token)
+{
+  int i;
+  for (i=0; i<token.len; i++) {
+    if (token.ptr[i] != ' ') return false;
+  }
+  return true;
+}
+
 /**
  * Get bus index from bus name string. If the bus name string does not
  * have quotes, assume it represents an integer index. If it does have
@@ -256,3 +264,16 @@ int gridpack::parser::BaseBlockParser::getBusIndex(std::string str)
     return abs(atoi(str.c_str()));
   }
 }
+
+/**
+ * Get bus index from a token. Unquoted tokens are converted directly to
+ * an integer index
+ */
+int gridpack::parser::BaseBlockParser::getBusIndex(const PSSEToken &token)
+{
+  if (token.quoted()) {
+    return getBusIndex(token.str());
+  } else {
+    return abs(token.toInt());
+  }
+}
@@ -21,6 +21,7 @@
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/utilities/string_utils.hpp"
 #include "gridpack/parser/dictionary.hpp"
+#include "gridpack/parser/psse_tokenizer.hpp"
 #include <string>
 #include <map>
 
@@ -101,6 +102,15 @@ class BaseBlockParser{
    */
   std::vector<std::string> splitPSSELine (std::string line);
 
+  /**
+   * Split PSS/E formatted lines into individual tokens using both blanks and
+   * commas as delimiters. The tokens are stored in the record without
+   * creating a string for each token
+   * @param line input string from PSS/E file
+   * @param record record that holds a copy of the line and its tokens
+   */
+  void splitPSSELine (const std::string &line, PSSERecord &record);
+
   /**
    * Check to see if string is blank
    * @param string string that needs to checked for non-blank characters
@@ -108,12 +118,25 @@ class BaseBlockParser{
    */
   bool isBlank(std::string string);
 
+  /**
+   * Check to see if token is blank
+   * @param token token that needs to checked for non-blank characters
+   * @return true if no non-blank characters are found
+   */
+  bool isBlank(const PSSEToken &token);
+
   /**
    * Get bus index from bus name string. If the bus name string does not
    * have quotes, assume it represents an integer index. If it does have
    * quotes, find the corresponding index in the p_nameMap data structure
    */
   int getBusIndex(std::string str);
+
+  /**
+   * Get bus index from a token. Unquoted tokens are converted directly to
+   * an integer index
+   */
+  int getBusIndex(const PSSEToken &token);
   
 protected:
   std::map<int,int> *p_busMap;
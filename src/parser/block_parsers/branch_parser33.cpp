@@ -53,13 +53,13 @@ void gridpack::parser::BranchParser33::parse(
   int nelems;
   while(test_end(line)) {
     std::pair<int, int> branch_pair;
-    std::vector<std::string>  split_line;
+    PSSERecord split_line;
     if (check_comment(line)) {
       stream.nextLine(line);
       continue;
     }
     this->cleanComment(line);
-    split_line = this->splitPSSELine(line);
+    this->splitPSSELine(line, split_line);
 
     o_idx1 = getBusIndex(split_line[0]);
     o_idx2 = getBusIndex(split_line[1]);
@@ -117,94 +117,94 @@ void gridpack::parser::BranchParser33::parse(
     int nstr = split_line.size();
     // Clean up 2 character tag
     gridpack::utility::StringUtils util;
-    std::string tag = util.clean2Char(split_line[2]);
+    std::string tag = split_line[2].tag();
     // BRANCH_CKT          "CKT"                 character
     if (nstr > 2) p_branchData[l_idx]->addValue(BRANCH_CKT,
         tag.c_str(), nelems);
 
     // BRANCH_R            "R"                   float
     if (nstr > 3) p_branchData[l_idx]->addValue(BRANCH_R,
-        atof(split_line[3].c_str()), nelems);
+        split_line[3].toDouble(), nelems);
 
     // BRANCH_X            "X"                   float
     if (nstr > 4) p_branchData[l_idx]->addValue(BRANCH_X,
-        atof(split_line[4].c_str()), nelems);
+        split_line[4].toDouble(), nelems);
 
     // BRANCH_B            "B"                   float
     if (nstr > 5) p_branchData[l_idx]->addValue(BRANCH_B,
-        atof(split_line[5].c_str()), nelems);
+        split_line[5].toDouble(), nelems);
 
     // BRANCH_RATING_A        "RATEA"               float
     if (nstr > 6) p_branchData[l_idx]->addValue(BRANCH_RATING_A,
-        atof(split_line[6].c_str()), nelems);
+        split_line[6].toDouble(), nelems);
 
     // BBRANCH_RATING_        "RATEB"               float
     if (nstr > 7) p_branchData[l_idx]->addValue(BRANCH_RATING_B,
-        atof(split_line[7].c_str()), nelems);
+        split_line[7].toDouble(), nelems);
 
     // BRANCH_RATING_C        "RATEC"               float
     if (nstr > 8) p_branchData[l_idx]->addValue(BRANCH_RATING_C,
-        atof(split_line[8].c_str()), nelems);
+        split_line[8].toDouble(), nelems);
 
     // BRANCH_SHUNT_ADMTTNC_G1        "GI"               float
     if (nstr > 9) p_branchData[l_idx]->addValue(BRANCH_SHUNT_ADMTTNC_G1,
-        atof(split_line[9].c_str()), nelems);
+        split_line[9].toDouble(), nelems);
 
     // BRANCH_SHUNT_ADMTTNC_B1        "BI"               float
     if (nstr > 10) p_branchData[l_idx]->addValue(BRANCH_SHUNT_ADMTTNC_B1,
-        atof(split_line[10].c_str()), nelems);
+        split_line[10].toDouble(), nelems);
 
     // BRANCH_SHUNT_ADMTTNC_G2        "GJ"               float
     if (nstr > 11) p_branchData[l_idx]->addValue(BRANCH_SHUNT_ADMTTNC_G2,
-        atof(split_line[11].c_str()), nelems);
+        split_line[11].toDouble(), nelems);
 
     // BRANCH_SHUNT_ADMTTNC_B2        "BJ"               float
     if (nstr > 12) p_branchData[l_idx]->addValue(BRANCH_SHUNT_ADMTTNC_B2,
-        atof(split_line[12].c_str()), nelems);
+        split_line[12].toDouble(), nelems);
 
     // BRANCH_STATUS        "STATUS"               integer
     if (nstr > 13) p_branchData[l_idx]->addValue(BRANCH_STATUS,
-        atoi(split_line[13].c_str()), nelems);
+        split_line[13].toInt(), nelems);
 
     // BRANCH_METER         "MET"                  integer
     if (nstr > 14) p_branchData[l_idx]->addValue(BRANCH_METER,
-        atoi(split_line[14].c_str()), nelems);
+        split_line[14].toInt(), nelems);
 
     // BRANCH_LENGTH        "LEN"                        float
     if (nstr > 15) p_branchData[l_idx]->addValue(BRANCH_LENGTH,
-        atof(split_line[15].c_str()), nelems);
+        split_line[15].toDouble(), nelems);
 
     // BRANCH_O1        "O1"                       integer
     if (nstr > 16) p_branchData[l_idx]->addValue(BRANCH_O1,
-        atoi(split_line[16].c_str()), nelems);
+        split_line[16].toInt(), nelems);
 
     // BRANCH_F1        "F1"                             float
     if (nstr > 17) p_branchData[l_idx]->addValue(BRANCH_F1,
-        atoi(split_line[17].c_str()), nelems);
+        split_line[17].toInt(), nelems);
 
     // BRANCH_O2        "O2"                       integer
     if (nstr > 18) p_branchData[l_idx]->addValue(BRANCH_O2,
-        atoi(split_line[18].c_str()), nelems);
+        split_line[18].toInt(), nelems);
 
     // BRANCH_F2        "F2"                             float
     if (nstr > 19) p_branchData[l_idx]->addValue(BRANCH_F2,
-        atoi(split_line[19].c_str()), nelems);
+        split_line[19].toInt(), nelems);
 
     // BRANCH_O3        "O3"                       integer
     if (nstr > 20) p_branchData[l_idx]->addValue(BRANCH_O3,
-        atoi(split_line[20].c_str()), nelems);
+        split_line[20].toInt(), nelems);
 
     // BRANCH_F3        "F3"                             float
     if (nstr > 21) p_branchData[l_idx]->addValue(BRANCH_F3,
-        atoi(split_line[21].c_str()), nelems);
+        split_line[21].toInt(), nelems);
 
     // BRANCH_O4        "O4"                       integer
     if (nstr > 22) p_branchData[l_idx]->addValue(BRANCH_O4,
-        atoi(split_line[22].c_str()), nelems);
+        split_line[22].toInt(), nelems);
 
     // BRANCH_F4        "F4"                             float
     if (nstr > 23) p_branchData[l_idx]->addValue(BRANCH_F4,
-        atoi(split_line[23].c_str()), nelems);
+        split_line[23].toInt(), nelems);
 
     // TODO: add variables MET, LEN, Oi, Fi
 
@@ -53,13 +53,13 @@ void gridpack::parser::BranchParser34::parse(
   int nelems;
   while(test_end(line)) {
     std::pair<int, int> branch_pair;
-    std::vector<std::string>  split_line;
+    PSSERecord split_line;
     if (check_comment(line)) {
       stream.nextLine(line);
       continue;
     }
     this->cleanComment(line);
-    split_line = this->splitPSSELine(line);
+    this->splitPSSELine(line, split_line);
 
     o_idx1 = getBusIndex(split_line[0]);
     o_idx2 = getBusIndex(split_line[1]);
@@ -117,130 +117,128 @@ void gridpack::parser::BranchParser34::parse(
     int nstr = split_line.size();
     // Clean up 2 character tag
     gridpack::utility::StringUtils util;
-    std::string tag = util.clean2Char(split_line[2]);
+    std::string tag = split_line[2].tag();
     // BRANCH_CKT          "CKT"                 character
     if (nstr > 2) p_branchData[l_idx]->addValue(BRANCH_CKT,
         tag.c_str(), nelems);
 
     // BRANCH_R            "R"                   float
     if (nstr > 3) p_branchData[l_idx]->addValue(BRANCH_R,
-        atof(split_line[3].c_str()), nelems);
+        split_line[3].toDouble(), nelems);
 
     // BRANCH_X            "X"                   float
     if (nstr > 4) p_branchData[l_idx]->addValue(BRANCH_X,
-        atof(split_line[4].c_str()), nelems);
+        split_line[4].toDouble(), nelems);
 
     // BRANCH_B            "B"                   float
     if (nstr > 5) p_branchData[l_idx]->addValue(BRANCH_B,
-        atof(split_line[5].c_str()), nelems);
+        split_line[5].toDouble(), nelems);
 
 
     // BRANCH_NAME             "NAME"                 string
     if (nstr > 6) {
-      if (split_line[6].find_first_of('\'',0) != std::string::npos) {
-        gridpack::utility::StringUtils util;
-        util.trim(split_line[6]);
-        std::string tmp = util.trimQuotes(split_line[6]);
+      if (split_line[6].quoted()) {
+        std::string tmp = split_line[6].unquoted().str();
         p_branchData[l_idx]->addValue(BRANCH_NAME, tmp.c_str(), nelems);
       }
     }
     // BRANCH_RATE1-12                              float
     if (nstr > 7) {
       p_branchData[l_idx]->addValue(BRANCH_RATE1,
-        atof(split_line[7].c_str()), nelems);
+        split_line[7].toDouble(), nelems);
       p_branchData[l_idx]->addValue(BRANCH_RATING_A,
-        atof(split_line[7].c_str()), nelems);
+        split_line[7].toDouble(), nelems);
     }
     if (nstr > 8) {
       p_branchData[l_idx]->addValue(BRANCH_RATE2,
-        atof(split_line[8].c_str()), nelems);
+        split_line[8].toDouble(), nelems);
       p_branchData[l_idx]->addValue(BRANCH_RATING_B,
-        atof(split_line[8].c_str()), nelems);
+        split_line[8].toDouble(), nelems);
     }
     if (nstr > 9) {
       p_branchData[l_idx]->addValue(BRANCH_RATE3,
-        atof(split_line[9].c_str()), nelems);
+        split_line[9].toDouble(), nelems);
       p_branchData[l_idx]->addValue(BRANCH_RATING_C,
-        atof(split_line[9].c_str()), nelems);
+        split_line[9].toDouble(), nelems);
     }
     if (nstr > 10) p_branchData[l_idx]->addValue(BRANCH_RATE4,
-        atof(split_line[10].c_str()), nelems);
+        split_line[10].toDouble(), nelems);
     if (nstr > 11) p_branchData[l_idx]->addValue(BRANCH_RATE5,
-        atof(split_line[11].c_str()), nelems);
+        split_line[11].toDouble(), nelems);
     if (nstr > 12) p_branchData[l_idx]->addValue(BRANCH_RATE6,
-        atof(split_line[12].c_str()), nelems);
+        split_line[12].toDouble(), nelems);
     if (nstr > 13) p_branchData[l_idx]->addValue(BRANCH_RATE7,
-        atof(split_line[13].c_str()), nelems);
+        split_line[13].toDouble(), nelems);
     if (nstr > 14) p_branchData[l_idx]->addValue(BRANCH_RATE8,
-        atof(split_line[14].c_str()), nelems);
+        split_line[14].toDouble(), nelems);
     if (nstr > 15) p_branchData[l_idx]->addValue(BRANCH_RATE9,
-        atof(split_line[15].c_str()), nelems);
+        split_line[15].toDouble(), nelems);
     if (nstr > 16) p_branchData[l_idx]->addValue(BRANCH_RATE10,
-        atof(split_line[16].c_str()), nelems);
+        split_line[16].toDouble(), nelems);
     if (nstr > 17) p_branchData[l_idx]->addValue(BRANCH_RATE11,
-        atof(split_line[17].c_str()), nelems);
+        split_line[17].toDouble(), nelems);
     if (nstr > 18) p_branchData[l_idx]->addValue(BRANCH_RATE12,
-        atof(split_line[18].c_str()), nelems);
+        split_line[18].toDouble(), nelems);
 
     // BRANCH_SHUNT_ADMTTNC_G1        "GI"               float
     if (nstr > 19) p_branchData[l_idx]->addValue(BRANCH_SHUNT_ADMTTNC_G1,
-        atof(split_line[19].c_str()), nelems);
+        split_line[19].toDouble(), nelems);
 
     // BRANCH_SHUNT_ADMTTNC_B1        "BI"               float
     if (nstr > 20) p_branchData[l_idx]->addValue(BRANCH_SHUNT_ADMTTNC_B1,
-        atof(split_line[20].c_str()), nelems);
+        split_line[20].toDouble(), nelems);
 
     // BRANCH_SHUNT_ADMTTNC_G2        "GJ"               float
     if (nstr > 21) p_branchData[l_idx]->addValue(BRANCH_SHUNT_ADMTTNC_G2,
-        atof(split_line[21].c_str()), nelems);
+        split_line[21].toDouble(), nelems);
 
     // BRANCH_SHUNT_ADMTTNC_B2        "BJ"               float
     if (nstr > 22) p_branchData[l_idx]->addValue(BRANCH_SHUNT_ADMTTNC_B2,
-        atof(split_line[22].c_str()), nelems);
+        split_line[22].toDouble(), nelems);
 
     // BRANCH_STATUS        "STATUS"               integer
     if (nstr > 23) p_branchData[l_idx]->addValue(BRANCH_STATUS,
-        atoi(split_line[23].c_str()), nelems);
+        split_line[23].toInt(), nelems);
 
     // BRANCH_METER         "MET"                  integer
     if (nstr > 24) p_branchData[l_idx]->addValue(BRANCH_METER,
-        atoi(split_line[24].c_str()), nelems);
+        split_line[24].toInt(), nelems);
 
     // BRANCH_LENGTH        "LEN"                        float
     if (nstr > 25) p_branchData[l_idx]->addValue(BRANCH_LENGTH,
-        atof(split_line[25].c_str()), nelems);
+        split_line[25].toDouble(), nelems);
 
     // BRANCH_O1        "O1"                       integer
     if (nstr > 26) p_branchData[l_idx]->addValue(BRANCH_O1,
-        atoi(split_line[26].c_str()), nelems);
+        split_line[26].toInt(), nelems);
 
     // BRANCH_F1        "F1"                             float
     if (nstr > 27) p_branchData[l_idx]->addValue(BRANCH_F1,
-        atoi(split_line[27].c_str()), nelems);
+        split_line[27].toInt(), nelems);
 
     // BRANCH_O2        "O2"                       integer
     if (nstr > 28) p_branchData[l_idx]->addValue(BRANCH_O2,
-        atoi(split_line[28].c_str()), nelems);
+        split_line[28].toInt(), nelems);
 
     // BRANCH_F2        "F2"                             float
     if (nstr > 29) p_branchData[l_idx]->addValue(BRANCH_F2,
-        atoi(split_line[29].c_str()), nelems);
+        split_line[29].toInt(), nelems);
 
     // BRANCH_O3        "O3"                       integer
     if (nstr > 30) p_branchData[l_idx]->addValue(BRANCH_O3,
-        atoi(split_line[30].c_str()), nelems);
+        split_line[30].toInt(), nelems);
 
     // BRANCH_F3        "F3"                             float
     if (nstr > 31) p_branchData[l_idx]->addValue(BRANCH_F3,
-        atoi(split_line[31].c_str()), nelems);
+        split_line[31].toInt(), nelems);
 
     // BRANCH_O4        "O4"                       integer
     if (nstr > 32) p_branchData[l_idx]->addValue(BRANCH_O4,
-        atoi(split_line[32].c_str()), nelems);
+        split_line[32].toInt(), nelems);
 
     // BRANCH_F4        "F4"                             float
     if (nstr > 33) p_branchData[l_idx]->addValue(BRANCH_F4,
-        atoi(split_line[33].c_str()), nelems);
+        split_line[33].toInt(), nelems);
 
     // TODO: add variables MET, LEN, Oi, Fi
 
@@ -54,19 +54,19 @@ void gridpack::parser::BusParser33::parse(
   stream.nextLine(line);
 
   while(test_end(line)) {
-    std::vector<std::string>  split_line;
+    PSSERecord split_line;
     if (check_comment(line)) {
       stream.nextLine(line);
       continue;
     }
     this->cleanComment(line);
-    split_line = this->splitPSSELine(line);
+    this->splitPSSELine(line, split_line);
     boost::shared_ptr<gridpack::component::DataCollection>
       data(new gridpack::component::DataCollection);
     int nstr = split_line.size();
 
     // BUS_I               "I"                   integer
-    o_idx = atoi(split_line[0].c_str());
+    o_idx = split_line[0].toInt();
     if (*p_maxBusIndex<o_idx) *p_maxBusIndex = o_idx;
     data->addValue(BUS_NUMBER, o_idx);
     p_busData.push_back(data);
@@ -77,7 +77,7 @@ void gridpack::parser::BusParser33::parse(
     data->addValue(CASE_ID, p_case_id);
 
     // BUS_NAME             "NAME"                 string
-    std::string bus_name = split_line[1];
+    std::string bus_name = split_line[1].str();
 
     //store bus and index as a pair
     {
@@ -86,38 +86,34 @@ void gridpack::parser::BusParser33::parse(
       name_pair = std::pair<std::string,int>(bus_name,abs(o_idx));
       p_nameMap->insert(name_pair);
     }
-    if (split_line[1].find_first_of('\'',0) != std::string::npos) {
-      gridpack::utility::StringUtils util;
-      util.trim(split_line[1]);
-    }
     if (nstr > 1) data->addValue(BUS_NAME, bus_name.c_str());
 
     // BUS_BASEKV           "BASKV"               float
-    if (nstr > 2) data->addValue(BUS_BASEKV, atof(split_line[2].c_str()));
+    if (nstr > 2) data->addValue(BUS_BASEKV, split_line[2].toDouble());
 
     // BUS_TYPE               "IDE"                   integer
-    if (nstr > 3) data->addValue(BUS_TYPE, atoi(split_line[3].c_str()));
+    if (nstr > 3) data->addValue(BUS_TYPE, split_line[3].toInt());
 
     // BUS_AREA            "IA"                integer
-    if (nstr > 4) data->addValue(BUS_AREA, atoi(split_line[4].c_str()));
+    if (nstr > 4) data->addValue(BUS_AREA, split_line[4].toInt());
 
     // BUS_ZONE            "ZONE"                integer
-    if (nstr > 5) data->addValue(BUS_ZONE, atoi(split_line[5].c_str()));
+    if (nstr > 5) data->addValue(BUS_ZONE, split_line[5].toInt());
 
     // BUS_OWNER              "IA"                  integer
-    if (nstr > 6) data->addValue(BUS_OWNER, atoi(split_line[6].c_str()));
+    if (nstr > 6) data->addValue(BUS_OWNER, split_line[6].toInt());
 
     // BUS_VOLTAGE_MAG              "VM"                  float
-    if (nstr > 7) data->addValue(BUS_VOLTAGE_MAG, atof(split_line[7].c_str()));
+    if (nstr > 7) data->addValue(BUS_VOLTAGE_MAG, split_line[7].toDouble());
 
     // BUS_VOLTAGE_ANG              "VA"                  float
-    if (nstr > 8) data->addValue(BUS_VOLTAGE_ANG, atof(split_line[8].c_str()));
+    if (nstr > 8) data->addValue(BUS_VOLTAGE_ANG, split_line[8].toDouble());
 
     // BUS_VOLTAGE_MAX              "VOLTAGE_MAX"               float
-    if (nstr > 9) data->addValue(BUS_VOLTAGE_MAX, atof(split_line[9].c_str()));
+    if (nstr > 9) data->addValue(BUS_VOLTAGE_MAX, split_line[9].toDouble());
 
     // BUS_VOLTAGE_MIN              "VOLTAGE_MIN"              float
-    if (nstr > 10) data->addValue(BUS_VOLTAGE_MIN, atof(split_line[10].c_str()));
+    if (nstr > 10) data->addValue(BUS_VOLTAGE_MIN, split_line[10].toDouble());
 
     // TODO: Need to add EVHI, EVLO
     index++;
@@ -48,13 +48,13 @@ void gridpack::parser::FixedShuntParser33::parse(
   stream.nextLine(line); //this should be the first line of the block
 
   while(test_end(line)) {
-    std::vector<std::string>  split_line;
+    PSSERecord split_line;
     if (check_comment(line)) {
       stream.nextLine(line);
       continue;
     }
     this->cleanComment(line);
-    split_line = this->splitPSSELine(line);
+    this->splitPSSELine(line, split_line);
 
     // SHUNT_BUSNUMBER               "I"                   integer
     int l_idx, o_idx;
@@ -78,29 +78,29 @@ void gridpack::parser::FixedShuntParser33::parse(
     if (nstr > 1) {
       // Clean up 2 character tag
       gridpack::utility::StringUtils util;
-      std::string tag = util.clean2Char(split_line[1]);
+      std::string tag = split_line[1].tag();
       // SHUNT_ID              "ID"                  integer
       p_busData[l_idx]->addValue(SHUNT_ID, tag.c_str(), nshnt);
     }
 
     // SHUNT_STATUS              "STATUS"                  integer
     if (nstr > 2) p_busData[l_idx]->addValue(SHUNT_STATUS,
-        atoi(split_line[2].c_str()), nshnt);
+        split_line[2].toInt(), nshnt);
 
     // BUS_SHUNT_GL              "GL"                  float
     if (nstr > 3) {
       if (nshnt==0) p_busData[l_idx]->addValue(BUS_SHUNT_GL,
-          atof(split_line[3].c_str()));
+          split_line[3].toDouble());
       p_busData[l_idx]->addValue(BUS_SHUNT_GL,
-          atof(split_line[3].c_str()),nshnt);
+          split_line[3].toDouble(),nshnt);
     }
 
     // BUS_SHUNT_BL              "BL"                  float
     if (nstr > 4) {
       if (nshnt == 0) p_busData[l_idx]->addValue(BUS_SHUNT_BL,
-          atof(split_line[4].c_str()));
+          split_line[4].toDouble());
       p_busData[l_idx]->addValue(BUS_SHUNT_BL,
-          atof(split_line[4].c_str()),nshnt);
+          split_line[4].toDouble(),nshnt);
     }
 
     // Increment number of shunts in data object
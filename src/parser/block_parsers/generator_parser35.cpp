@@ -50,13 +50,13 @@ void gridpack::parser::GeneratorParser35::parse(
   std::string          line;
   stream.nextLine(line); //this should be the first line of the block
   while(test_end(line)) {
-    std::vector<std::string>  split_line;
+    PSSERecord split_line;
     if (check_comment(line)) {
       stream.nextLine(line);
       continue;
     }
     this->cleanComment(line);
-    split_line = this->splitPSSELine(line);
+    this->splitPSSELine(line, split_line);
 
     // GENERATOR_BUSNUMBER               "I"                   integer
     int l_idx, o_idx;
@@ -80,75 +80,75 @@ void gridpack::parser::GeneratorParser35::parse(
 
     // Clean up 2 character tag
     gridpack::utility::StringUtils util;
-    std::string tag = util.clean2Char(split_line[1]);
+    std::string tag = split_line[1].tag();
     // GENERATOR_ID              "ID"                  integer
     p_busData[l_idx]->addValue(GENERATOR_ID, tag.c_str(), ngen);
 
     // GENERATOR_PG              "PG"                  float
-    if (nstr > 2) p_busData[l_idx]->addValue(GENERATOR_PG, atof(split_line[2].c_str()),
+    if (nstr > 2) p_busData[l_idx]->addValue(GENERATOR_PG, split_line[2].toDouble(),
         ngen);
 
     // GENERATOR_QG              "QG"                  float
-    if (nstr > 3) p_busData[l_idx]->addValue(GENERATOR_QG, atof(split_line[3].c_str()),
+    if (nstr > 3) p_busData[l_idx]->addValue(GENERATOR_QG, split_line[3].toDouble(),
         ngen);
 
     // GENERATOR_QMAX              "QT"                  float
     if (nstr > 4) p_busData[l_idx]->addValue(GENERATOR_QMAX,
-        atof(split_line[4].c_str()), ngen);
+        split_line[4].toDouble(), ngen);
 
     // GENERATOR_QMIN              "QB"                  float
     if (nstr > 5) p_busData[l_idx]->addValue(GENERATOR_QMIN,
-        atof(split_line[5].c_str()), ngen);
+        split_line[5].toDouble(), ngen);
 
     // GENERATOR_VS              "VS"                  float
-    if (nstr > 6) p_busData[l_idx]->addValue(GENERATOR_VS, atof(split_line[6].c_str()),
+    if (nstr > 6) p_busData[l_idx]->addValue(GENERATOR_VS, split_line[6].toDouble(),
         ngen);
 
     // GENERATOR_IREG            "IREG"                integer
     if (nstr > 7) p_busData[l_idx]->addValue(GENERATOR_IREG,
-        atoi(split_line[7].c_str()), ngen);
+        split_line[7].toInt(), ngen);
 
     // GENERATOR_NREG            "NREG"                integer
     if (nstr > 8) p_busData[l_idx]->addValue(GENERATOR_NREG,
-        atoi(split_line[8].c_str()), ngen);
+        split_line[8].toInt(), ngen);
 
     // GENERATOR_MBASE           "MBASE"               float
     if (nstr > 9) p_busData[l_idx]->addValue(GENERATOR_MBASE,
-        atof(split_line[9].c_str()), ngen);
+        split_line[9].toDouble(), ngen);
 
     // GENERATOR_ZSOURCE                                complex
     if (nstr > 11) p_busData[l_idx]->addValue(GENERATOR_ZSOURCE,
-        gridpack::ComplexType(atof(split_line[10].c_str()),
-          atof(split_line[11].c_str())), ngen);
+        gridpack::ComplexType(split_line[10].toDouble(),
+          split_line[11].toDouble()), ngen);
 
     // GENERATOR_XTRAN                              complex
     if (nstr > 13) p_busData[l_idx]->addValue(GENERATOR_XTRAN,
-        gridpack::ComplexType(atof(split_line[12].c_str()),
-          atof(split_line[13].c_str())), ngen);
+        gridpack::ComplexType(split_line[12].toDouble(),
+          split_line[13].toDouble()), ngen);
 
     // GENERATOR_GTAP              "GTAP"                  float
     if (nstr > 14) p_busData[l_idx]->addValue(GENERATOR_GTAP,
-        atof(split_line[14].c_str()), ngen);
+        split_line[14].toDouble(), ngen);
 
     // GENERATOR_STAT              "STAT"                  float
     if (nstr > 15)  p_busData[l_idx]->addValue(GENERATOR_STAT,
-        atoi(split_line[15].c_str()), ngen);
+        split_line[15].toInt(), ngen);
 
     // GENERATOR_RMPCT           "RMPCT"               float
     if (nstr > 16) p_busData[l_idx]->addValue(GENERATOR_RMPCT,
-        atof(split_line[16].c_str()), ngen);
+        split_line[16].toDouble(), ngen);
 
     // GENERATOR_PMAX              "PT"                  float
     if (nstr > 17) p_busData[l_idx]->addValue(GENERATOR_PMAX,
-        atof(split_line[17].c_str()), ngen);
+        split_line[17].toDouble(), ngen);
 
     // GENERATOR_PMIN              "PB"                  float
     if (nstr > 18) p_busData[l_idx]->addValue(GENERATOR_PMIN,
-        atof(split_line[18].c_str()), ngen);
+        split_line[18].toDouble(), ngen);
 
     // GENERATOR_BASLOD              "BASLOD"            integer 
     if (nstr > 19) p_busData[l_idx]->addValue(GENERATOR_BASLOD,
-        atof(split_line[19].c_str()), ngen);
+        split_line[19].toDouble(), ngen);
 
     // TODO: add variables Oi, Fi, WMOD, WPF
     // There may be between 0 and 4 owner pairs.
@@ -159,13 +159,13 @@ void gridpack::parser::GeneratorParser35::parse(
       if (this->isBlank(split_line[20])) {
         p_busData[l_idx]->getValue(BUS_OWNER,&owner);
       } else {
-        owner = atoi(split_line[20].c_str());
+        owner = split_line[20].toInt();
       }
       p_busData[l_idx]->addValue(GENERATOR_OWNER1, owner, ngen);
       double frac = 1.0;
       if (nstr > 21) {
         if (!this->isBlank(split_line[21])) {
-          frac = atof(split_line[21].c_str());
+          frac = split_line[21].toDouble();
         }
       }
       p_busData[l_idx]->addValue(GENERATOR_OFRAC1, frac, ngen);
@@ -175,13 +175,13 @@ void gridpack::parser::GeneratorParser35::parse(
       if (this->isBlank(split_line[22])) {
         owner = 0;
       } else {
-        owner = atoi(split_line[22].c_str());
+        owner = split_line[22].toInt();
       }
       p_busData[l_idx]->addValue(GENERATOR_OWNER2, owner, ngen);
       double frac = 0.0;
       if (nstr > 23) {
         if (!this->isBlank(split_line[23])) {
-          frac = atof(split_line[23].c_str());
+          frac = split_line[23].toDouble();
         }
       }
       p_busData[l_idx]->addValue(GENERATOR_OFRAC2, frac, ngen);
@@ -191,13 +191,13 @@ void gridpack::parser::GeneratorParser35::parse(
       if (this->isBlank(split_line[24])) {
         owner = 0;
       } else {
-        owner = atoi(split_line[24].c_str());
+        owner = split_line[24].toInt();
       }
       p_busData[l_idx]->addValue(GENERATOR_OWNER3, owner, ngen);
       double frac = 0.0;
       if (nstr > 25) {
         if (!this->isBlank(split_line[25])) {
-          frac = atof(split_line[25].c_str());
+          frac = split_line[25].toDouble();
         }
       }
       p_busData[l_idx]->addValue(GENERATOR_OFRAC3, frac, ngen);
@@ -207,13 +207,13 @@ void gridpack::parser::GeneratorParser35::parse(
       if (this->isBlank(split_line[26])) {
         owner = 0;
       } else {
-        owner = atoi(split_line[26].c_str());
+        owner = split_line[26].toInt();
       }
       p_busData[l_idx]->addValue(GENERATOR_OWNER4, owner, ngen);
       double frac = 0.0;
       if (nstr > 27) {
         if (!this->isBlank(split_line[27])) {
-          frac = atof(split_line[27].c_str());
+          frac = split_line[27].toDouble();
         }
       }
       p_busData[l_idx]->addValue(GENERATOR_OFRAC4, frac, ngen);
@@ -222,11 +222,11 @@ void gridpack::parser::GeneratorParser35::parse(
     // Last two entries are WMOD and WPF
     if (nstr > 28) {
       p_busData[l_idx]->addValue(GENERATOR_WMOD,
-          atoi(split_line[28].c_str()), ngen);
+          split_line[28].toInt(), ngen);
     }
     if (nstr > 29) {
       p_busData[l_idx]->addValue(GENERATOR_WPF,
-          atof(split_line[29].c_str()), ngen);
+          split_line[29].toDouble(), ngen);
     }
 
     // Increment number of generators in data object
@@ -49,13 +49,13 @@ void gridpack::parser::ImpedCorrParser33::parse(
   stream.nextLine(line); //this should be the first line of the block
 
   while(test_end(line)) {
-    std::vector<std::string>  split_line;
+    PSSERecord split_line;
     if (check_comment(line)) {
       stream.nextLine(line);
       continue;
     }
     this->cleanComment(line);
-    split_line = this->splitPSSELine(line);
+    this->splitPSSELine(line, split_line);
     int nval = split_line.size();
     int entries = nval-1;
     entries =  entries - entries%2;
@@ -68,7 +68,7 @@ void gridpack::parser::ImpedCorrParser33::parse(
      * type: integer
      * #define XFMR_CORR_TABLE_NUMBER "XFMR_CORR_TABLE_NUMBER"
      */
-    int tableid = atoi(split_line[0].c_str());
+    int tableid = split_line[0].toInt();
     data->addValue(XFMR_CORR_TABLE_NUMBER, tableid);
 
     int i;
@@ -79,14 +79,14 @@ void gridpack::parser::ImpedCorrParser33::parse(
        * #define XFMR_CORR_TABLE_Ti "XFMR_CORR_TABLE_Ti"
        */
       sprintf(buf,"XFMR_CORR_TABLE_T%d",i+1);
-      data->addValue(buf, atof(split_line[1+2*i].c_str()));
+      data->addValue(buf, split_line[1+2*i].toDouble());
 
       /*
        * type: real float
        * #define XFMR_CORR_TABLE_Fi "XFMR_CORR_TABLE_Fi"
        */
       sprintf(buf,"XFMR_CORR_TABLE_F%d",i+1);
-      data->addValue(buf, atof(split_line[2+2*i].c_str()));
+      data->addValue(buf, split_line[2+2*i].toDouble());
     }
 
     p_imp_corr_table.insert(std::pair<int,
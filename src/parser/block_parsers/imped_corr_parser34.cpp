@@ -54,20 +54,27 @@ void gridpack::parser::ImpedCorrParser34::parse(
       continue;
     }
     this->cleanComment(line);
-    std::vector<std::string>  split_line;
-    // accumulate lines for table into one line
+    // accumulate values for table from all lines. The table number is
+    // stored as the first value
+    std::vector<double> split_line;
+    PSSERecord tmp_list;
     bool end_table = false;
     while (!end_table && test_end(line)) {
-      std::vector<std::string>  tmp_list;
-      tmp_list = this->splitPSSELine(line);
-      if (tmp_list.size() >= 3 && atof(tmp_list[0].c_str()) == 0.0 &&
-          atof(tmp_list[1].c_str()) == 0.0 &&
-          atof(tmp_list[2].c_str()) == 0.0) {
+      this->splitPSSELine(line, tmp_list);
+      if (tmp_list.size() >= 3 && tmp_list[0].toDouble() == 0.0 &&
+          tmp_list[1].toDouble() == 0.0 &&
+          tmp_list[2].toDouble() == 0.0) {
         end_table = true;
       } else {
         int i;
         int n = tmp_list.size();
-        for (i=0; i<n; i++) split_line.push_back(tmp_list[i]);
+        for (i=0; i<n; i++) {
+          if (split_line.empty()) {
+            split_line.push_back(static_cast<double>(tmp_list[i].toInt()));
+          } else {
+            split_line.push_back(tmp_list[i].toDouble());
+          }
+        }
       }
       if (!end_table) stream.nextLine(line);
     }
@@ -87,7 +94,7 @@ void gridpack::parser::ImpedCorrParser34::parse(
      * type: integer
      * #define XFMR_CORR_TABLE_NUMBER "XFMR_CORR_TABLE_NUMBER"
      */
-    int tableid = atoi(split_line[0].c_str());
+    int tableid = static_cast<int>(split_line[0]);
     data->addValue(XFMR_CORR_TABLE_NUMBER, tableid);
 
     int i;
@@ -98,14 +105,14 @@ void gridpack::parser::ImpedCorrParser34::parse(
        * #define XFMR_CORR_TABLE_Ti "XFMR_CORR_TABLE_Ti"
        */
       sprintf(buf,"XFMR_CORR_TABLE_T%d",i+1);
-      data->addValue(buf, atof(split_line[1+2*i].c_str()));
+      data->addValue(buf, split_line[1+2*i]);
 
       /*
        * type: real float
        * #define XFMR_CORR_TABLE_Fi "XFMR_CORR_TABLE_Fi"
        */
       sprintf(buf,"XFMR_CORR_TABLE_F%d",i+1);
-      data->addValue(buf, atof(split_line[2+2*i].c_str()));
+      data->addValue(buf, split_line[2+2*i]);
     }
 
     p_imp_corr_table.insert(std::pair<int,
@@ -46,12 +46,12 @@ void gridpack::parser::InterAreaParser33::parse(
 
       while(test_end(line)) {
 #if 0
-        std::vector<std::string>  split_line;
+        PSSERecord split_line;
         if (check_comment(line)) {
           stream.nextLine(line);
           continue;
         }
-        split_line = this->splitPSSELine(line);
+        this->splitPSSELine(line, split_line);
         std::vector<gridpack::component::DataCollection>   inter_area_instance;
         gridpack::component::DataCollection          data;
 
@@ -59,28 +59,28 @@ void gridpack::parser::InterAreaParser33::parse(
          * type: integer
          * #define INTERAREA_TRANSFER_FROM "INTERAREA_TRANSFER_FROM"
          */
-        data.addValue(INTERAREA_TRANSFER_FROM, atoi(split_line[0].c_str()));
+        data.addValue(INTERAREA_TRANSFER_FROM, split_line[0].toInt());
         inter_area_instance.push_back(data);
 
         /*
          * type: integer
          * #define INTERAREA_TRANSFER_TO "INTERAREA_TRANSFER_TO"
          */
-        data.addValue(INTERAREA_TRANSFER_TO, atoi(split_line[0].c_str()));
+        data.addValue(INTERAREA_TRANSFER_TO, split_line[0].toInt());
         inter_area_instance.push_back(data);
 
         /*
          * type: character
          * #define INTERAREA_TRANSFER_TRID "INTERAREA_TRANSFER_TRID"
          */
-        data.addValue(INTERAREA_TRANSFER_TRID, split_line[0].c_str()[0]);
+        data.addValue(INTERAREA_TRANSFER_TRID, split_line[0].str().c_str()[0]);
         inter_area_instance.push_back(data);
 
         /*
          * type: real float
          * #define INTERAREA_TRANSFER_PTRAN "INTERAREA_TRANSFER_PTRAN"
          */
-        data.addValue(INTERAREA_TRANSFER_PTRAN, atof(split_line[0].c_str()));
+        data.addValue(INTERAREA_TRANSFER_PTRAN, split_line[0].toDouble());
         inter_area_instance.push_back(data);
 
         inter_area.push_back(inter_area_instance);
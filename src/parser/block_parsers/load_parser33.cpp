@@ -48,13 +48,13 @@ void gridpack::parser::LoadParser33::parse(
   stream.nextLine(line); //this should be the first line of the block
 
   while(test_end(line)) {
-    std::vector<std::string>  split_line;
+    PSSERecord split_line;
     if (check_comment(line)) {
       stream.nextLine(line);
       continue;
     }
     this->cleanComment(line);
-    split_line = this->splitPSSELine(line);
+    this->splitPSSELine(line, split_line);
 
     // LOAD_BUSNUMBER               "I"                   integer
     int l_idx, o_idx;
@@ -82,50 +82,50 @@ void gridpack::parser::LoadParser33::parse(
     gridpack::utility::StringUtils util;
     if (nstr > 1) {
       // Clean up 2 character tag
-      std::string tag = util.clean2Char(split_line[1]);
+      std::string tag = split_line[1].tag();
       // LOAD_ID              "ID"                  integer
       p_busData[l_idx]->addValue(LOAD_ID, tag.c_str(), nld);
     }
 
     // LOAD_STATUS              "ID"                  integer
     if (nstr > 2) p_busData[l_idx]->addValue(LOAD_STATUS,
-        atoi(split_line[2].c_str()), nld);
+        split_line[2].toInt(), nld);
 
     // LOAD_AREA            "AREA"                integer
     if (nstr > 3) p_busData[l_idx]->addValue(LOAD_AREA,
-        atoi(split_line[3].c_str()), nld);
+        split_line[3].toInt(), nld);
 
     // LOAD_ZONE            "ZONE"                integer
     if (nstr > 4) p_busData[l_idx]->addValue(LOAD_ZONE,
-        atoi(split_line[4].c_str()), nld);
+        split_line[4].toInt(), nld);
 
     // LOAD_PL              "PL"                  float
     if (nstr > 5) {
-      if (nld == 0) p_busData[l_idx]->addValue(LOAD_PL, atof(split_line[5].c_str()));
-      p_busData[l_idx]->addValue(LOAD_PL, atof(split_line[5].c_str()), nld);
+      if (nld == 0) p_busData[l_idx]->addValue(LOAD_PL, split_line[5].toDouble());
+      p_busData[l_idx]->addValue(LOAD_PL, split_line[5].toDouble(), nld);
     }
 
     // LOAD_QL              "QL"                  float
     if (nstr > 6) {
-      if (nld == 0) p_busData[l_idx]->addValue(LOAD_QL, atof(split_line[6].c_str()));
-      p_busData[l_idx]->addValue(LOAD_QL, atof(split_line[6].c_str()), nld);
+      if (nld == 0) p_busData[l_idx]->addValue(LOAD_QL, split_line[6].toDouble());
+      p_busData[l_idx]->addValue(LOAD_QL, split_line[6].toDouble(), nld);
     }
 
     // LOAD_IP              "IP"                  float
     if (nstr > 7) p_busData[l_idx]->addValue(LOAD_IP,
-        atof(split_line[7].c_str()), nld);
+        split_line[7].toDouble(), nld);
 
     // LOAD_IQ              "IQ"                  float
     if (nstr > 8) p_busData[l_idx]->addValue(LOAD_IQ,
-        atof(split_line[8].c_str()), nld);
+        split_line[8].toDouble(), nld);
 
     // LOAD_YP              "YP"                  float
     if (nstr > 9) p_busData[l_idx]->addValue(LOAD_YP,
-        atof(split_line[9].c_str()), nld);
+        split_line[9].toDouble(), nld);
 
     // LOAD_YQ            "YQ"                integer
     if (nstr > 10) p_busData[l_idx]->addValue(LOAD_YQ,
-        atof(split_line[10].c_str()), nld);
+        split_line[10].toDouble(), nld);
 
     // TODO: add variables OWNER, SCALE, INTRPT
 
@@ -49,13 +49,13 @@ void gridpack::parser::MultiSectParser33::parse(
   stream.nextLine(line); //this should be the first line of the block
 
   while(test_end(line)) {
-    std::vector<std::string>  split_line;
+    PSSERecord split_line;
     if (check_comment(line)) {
       stream.nextLine(line);
       continue;
     }
     this->cleanComment(line);
-    split_line = this->splitPSSELine(line);
+    this->splitPSSELine(line, split_line);
     int o_idx1, o_idx2;
     o_idx1 = getBusIndex(split_line[0]);
     o_idx2 = getBusIndex(split_line[1]);
@@ -86,7 +86,7 @@ void gridpack::parser::MultiSectParser33::parse(
 
     // Clean up 2 character tag
     gridpack::utility::StringUtils util;
-    std::string tag = util.clean2Char(split_line[2]);
+    std::string tag = split_line[2].tag();
     if (tag.length() != 2 || tag[0] != '&') {
       tag = "&1";
     }
@@ -101,14 +101,14 @@ void gridpack::parser::MultiSectParser33::parse(
      * type: integer
      * #define MULTI_SEC_LINE_MET "MULTI_SEC_LINE_MET"
      */
-    p_branchData[l_idx]->addValue(MULTI_SEC_LINE_MET, atoi(split_line[3].c_str()));
+    p_branchData[l_idx]->addValue(MULTI_SEC_LINE_MET, split_line[3].toInt());
 
 
     int i;
     char buf[32];
     for (i=0; i<9; i++) {
       sprintf(buf,"MULTI_SEC_LINE_DUM%d",i+1);
-      p_branchData[l_idx]->addValue(buf,atoi(split_line[i+4].c_str()));
+      p_branchData[l_idx]->addValue(buf,split_line[i+4].toInt());
     }
 
     stream.nextLine(line);
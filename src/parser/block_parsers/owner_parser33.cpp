@@ -45,19 +45,19 @@ void gridpack::parser::OwnerParser33::parse(
 
   while(test_end(line)) {
 #if 0
-    std::vector<std::string>  split_line;
+    PSSERecord split_line;
     if (check_comment(line)) {
       stream.nextLine(line);
       continue;
     }
-    split_line = this->splitPSSELine(line);
+    this->splitPSSELine(line, split_line);
     std::vector<gridpack::component::DataCollection>   owner_instance;
     gridpack::component::DataCollection          data;
 
-    data.addValue(OWNER_NUMBER, atoi(split_line[0].c_str()));
+    data.addValue(OWNER_NUMBER, split_line[0].toInt());
     owner_instance.push_back(data);
 
-    data.addValue(OWNER_NAME, split_line[1].c_str());
+    data.addValue(OWNER_NAME, split_line[1].str().c_str());
     owner_instance.push_back(data);
 
     owner.push_back(owner_instance);
@@ -48,20 +48,20 @@ void gridpack::parser::SwitchedShuntParser33::parse(
 
   stream.nextLine(line); //this should be the first line of the block
   while(test_end(line)) {
-    std::vector<std::string>  split_line;
+    PSSERecord split_line;
     if (check_comment(line)) {
       stream.nextLine(line);
       continue;
     }
     this->cleanComment(line);
-    split_line = this->splitPSSELine(line);
+    this->splitPSSELine(line, split_line);
 
     /*
      * type: integer
      * #define SWSHUNT_BUSNUMBER "SWSHUNT_BUSNUMBER"
      */
     int l_idx, o_idx;
-    l_idx = atoi(split_line[0].c_str());
+    l_idx = split_line[0].toInt();
     std::map<int, int>::iterator it;
     it = p_busMap->find(l_idx);
     if (it != p_busMap->end()) {
@@ -72,169 +72,169 @@ void gridpack::parser::SwitchedShuntParser33::parse(
     }
     int nval = split_line.size();
 
-    p_busData[o_idx]->addValue(SWSHUNT_BUSNUMBER, atoi(split_line[0].c_str()));
+    p_busData[o_idx]->addValue(SWSHUNT_BUSNUMBER, split_line[0].toInt());
 
     /*
      * type: integer
      * #define SHUNT_MODSW "SHUNT_MODSW"
      */
-    p_busData[o_idx]->addValue(SHUNT_MODSW, atoi(split_line[1].c_str()));
+    p_busData[o_idx]->addValue(SHUNT_MODSW, split_line[1].toInt());
 
     /*
      * type: integer
      * #define SHUNT_ADJM "SHUNT_ADJM"
      */
-    p_busData[o_idx]->addValue(SHUNT_ADJM, atoi(split_line[2].c_str()));
+    p_busData[o_idx]->addValue(SHUNT_ADJM, split_line[2].toInt());
 
     /*
      * type: integer
      * #define SHUNT_SWCH_STAT "SHUNT_SWCH_STAT"
      */
-    p_busData[o_idx]->addValue(SHUNT_SWCH_STAT, atoi(split_line[3].c_str()));
+    p_busData[o_idx]->addValue(SHUNT_SWCH_STAT, split_line[3].toInt());
 
     /*
      * type: real float
      * #define SHUNT_VSWHI "SHUNT_VSWHI"
      */
-    p_busData[o_idx]->addValue(SHUNT_VSWHI, atof(split_line[4].c_str()));
+    p_busData[o_idx]->addValue(SHUNT_VSWHI, split_line[4].toDouble());
 
     /*
      * type: real float
      * #define SHUNT_VSWLO "SHUNT_VSWLO"
      */
-    p_busData[o_idx]->addValue(SHUNT_VSWLO, atof(split_line[5].c_str()));
+    p_busData[o_idx]->addValue(SHUNT_VSWLO, split_line[5].toDouble());
 
     /*
      * type: integer
      * #define SHUNT_SWREM "SHUNT_SWREM"
      */
-    p_busData[o_idx]->addValue(SHUNT_SWREM, atoi(split_line[6].c_str()));
+    p_busData[o_idx]->addValue(SHUNT_SWREM, split_line[6].toInt());
 
     /*
      * type: real float
      * #define SHUNT_RMPCT "SHUNT_RMPCT"
      */
-    p_busData[o_idx]->addValue(SHUNT_RMPCT, atof(split_line[7].c_str()));
+    p_busData[o_idx]->addValue(SHUNT_RMPCT, split_line[7].toDouble());
 
     /*
      * type: string
      * #define SHUNT_RMIDNT "SHUNT_RMIDNT"
      */
-    p_busData[o_idx]->addValue(SHUNT_RMIDNT, split_line[8].c_str());
+    p_busData[o_idx]->addValue(SHUNT_RMIDNT, split_line[8].str().c_str());
 
     /*
      * type: real float
      * #define SHUNT_BINIT "SHUNT_BINIT"
      */
-    p_busData[o_idx]->addValue(SHUNT_BINIT, atof(split_line[9].c_str()));
+    p_busData[o_idx]->addValue(SHUNT_BINIT, split_line[9].toDouble());
 
     if (nval > 10)
-      p_busData[o_idx]->addValue(SHUNT_N1, atoi(split_line[10].c_str()));
+      p_busData[o_idx]->addValue(SHUNT_N1, split_line[10].toInt());
 
     /*
      * type: integer
      * #define SHUNT_N2 "SHUNT_N2"
      */
     if (nval > 12)
-      p_busData[o_idx]->addValue(SHUNT_N2, atoi(split_line[12].c_str()));
+      p_busData[o_idx]->addValue(SHUNT_N2, split_line[12].toInt());
 
     /*
      * type: integer
      * #define SHUNT_N3 "SHUNT_N3"
      */
     if (nval > 14)
-      p_busData[o_idx]->addValue(SHUNT_N3, atoi(split_line[14].c_str()));
+      p_busData[o_idx]->addValue(SHUNT_N3, split_line[14].toInt());
 
     /*
      * type: integer
      * #define SHUNT_N4 "SHUNT_N4"
      */
     if (nval > 16)
-      p_busData[o_idx]->addValue(SHUNT_N4, atoi(split_line[16].c_str()));
+      p_busData[o_idx]->addValue(SHUNT_N4, split_line[16].toInt());
 
     /*
      * type: integer
      * #define SHUNT_N5 "SHUNT_N5"
      */
     if (nval > 18)
-      p_busData[o_idx]->addValue(SHUNT_N5, atoi(split_line[18].c_str()));
+      p_busData[o_idx]->addValue(SHUNT_N5, split_line[18].toInt());
 
     /*
      * type: integer
      * #define SHUNT_N6 "SHUNT_N6"
      */
     if (nval > 20)
-      p_busData[o_idx]->addValue(SHUNT_N6, atoi(split_line[20].c_str()));
+      p_busData[o_idx]->addValue(SHUNT_N6, split_line[20].toInt());
 
     /*
      * type: integer
      * #define SHUNT_N7 "SHUNT_N7"
      */
     if (nval > 22) 
-      p_busData[o_idx]->addValue(SHUNT_N7, atoi(split_line[22].c_str()));
+      p_busData[o_idx]->addValue(SHUNT_N7, split_line[22].toInt());
 
     /*
      * type: integer
      * #define SHUNT_N8 "SHUNT_N8"
      */
     if (nval > 24) 
-      p_busData[o_idx]->addValue(SHUNT_N8, atoi(split_line[24].c_str()));
+      p_busData[o_idx]->addValue(SHUNT_N8, split_line[24].toInt());
 
     /*
      * type: real float
      * #define SHUNT_B1 "SHUNT_B1"
      */
     if (nval > 11) 
-      p_busData[o_idx]->addValue(SHUNT_B1, atof(split_line[11].c_str()));
+      p_busData[o_idx]->addValue(SHUNT_B1, split_line[11].toDouble());
 
     /*
      * type: real float
      * #define SHUNT_B2 "SHUNT_B2"
      */
     if (nval > 13) 
-      p_busData[o_idx]->addValue(SHUNT_B2, atof(split_line[13].c_str()));
+      p_busData[o_idx]->addValue(SHUNT_B2, split_line[13].toDouble());
 
     /*
      * type: real float
      * #define SHUNT_B3 "SHUNT_B3"
      */
     if (nval > 15) 
-      p_busData[o_idx]->addValue(SHUNT_B3, atof(split_line[15].c_str()));
+      p_busData[o_idx]->addValue(SHUNT_B3, split_line[15].toDouble());
 
     /*
      * type: real float
      * #define SHUNT_B4 "SHUNT_B4"
      */
     if (nval > 17) 
-      p_busData[o_idx]->addValue(SHUNT_B4, atof(split_line[17].c_str()));
+      p_busData[o_idx]->addValue(SHUNT_B4, split_line[17].toDouble());
 
     /*
      * type: real float
      * #define SHUNT_B5 "SHUNT_B5"
      */
     if (nval > 19) 
-      p_busData[o_idx]->addValue(SHUNT_B5, atof(split_line[19].c_str()));
+      p_busData[o_idx]->addValue(SHUNT_B5, split_line[19].toDouble());
 
     /*
      * type: real float
      * #define SHUNT_B6 "SHUNT_B6"
      */
     if (nval > 21) 
-      p_busData[o_idx]->addValue(SHUNT_B6, atof(split_line[21].c_str()));
+      p_busData[o_idx]->addValue(SHUNT_B6, split_line[21].toDouble());
 
     /*
      * type: real float
      * #define SHUNT_B7 "SHUNT_B7"
      */
     if (nval > 23) 
-      p_busData[o_idx]->addValue(SHUNT_B7, atof(split_line[23].c_str()));
+      p_busData[o_idx]->addValue(SHUNT_B7, split_line[23].toDouble());
 
     /*
      * type: real float
      * #define SHUNT_B8 "SHUNT_B8"
      */
     if (nval > 25) 
-      p_busData[o_idx]->addValue(SHUNT_B8, atof(split_line[25].c_str()));
+      p_busData[o_idx]->addValue(SHUNT_B8, split_line[25].toDouble());
 
     stream.nextLine(line);
   }
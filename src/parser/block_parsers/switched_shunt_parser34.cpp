@@ -48,20 +48,20 @@ void gridpack::parser::SwitchedShuntParser34::parse(
 
   stream.nextLine(line); //this should be the first line of the block
   while(test_end(line)) {
-    std::vector<std::string>  split_line;
+    PSSERecord split_line;
     if (check_comment(line)) {
       stream.nextLine(line);
       continue;
     }
     this->cleanComment(line);
-    split_line = this->splitPSSELine(line);
+    this->splitPSSELine(line, split_line);
 
     /*
      * type: integer
      * #define SWSHUNT_BUSNUMBER "SWSHUNT_BUSNUMBER"
      */
     int l_idx, o_idx;
-    l_idx = atoi(split_line[0].c_str());
+    l_idx = split_line[0].toInt();
     std::map<int, int>::iterator it;
     it = p_busMap->find(l_idx);
     if (it != p_busMap->end()) {
@@ -73,8 +73,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
     int nval = split_line.size();
 
     if (!p_busData[o_idx]->setValue(SWSHUNT_BUSNUMBER,
-          atoi(split_line[0].c_str()))) {
-      p_busData[o_idx]->addValue(SWSHUNT_BUSNUMBER, atoi(split_line[0].c_str()));
+          split_line[0].toInt())) {
+      p_busData[o_idx]->addValue(SWSHUNT_BUSNUMBER, split_line[0].toInt());
     }
 
     // Currently ignoring the shunt ID. Assume one switched shunt per bus
@@ -83,8 +83,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      * #define SHUNT_MODSW "SHUNT_MODSW"
      */
     if (!p_busData[o_idx]->setValue(SHUNT_MODSW,
-          atoi(split_line[1].c_str()))) {
-      p_busData[o_idx]->addValue(SHUNT_MODSW, atoi(split_line[1].c_str()));
+          split_line[1].toInt())) {
+      p_busData[o_idx]->addValue(SHUNT_MODSW, split_line[1].toInt());
     }
 
     /*
@@ -92,8 +92,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      * #define SHUNT_ADJM "SHUNT_ADJM"
      */
     if (!p_busData[o_idx]->setValue(SHUNT_ADJM,
-          atoi(split_line[2].c_str()))) {
-      p_busData[o_idx]->addValue(SHUNT_ADJM, atoi(split_line[2].c_str()));
+          split_line[2].toInt())) {
+      p_busData[o_idx]->addValue(SHUNT_ADJM, split_line[2].toInt());
     }
 
     /*
@@ -101,8 +101,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      * #define SHUNT_SWCH_STAT "SHUNT_SWCH_STAT"
      */
     if (!p_busData[o_idx]->setValue(SHUNT_SWCH_STAT,
-          atoi(split_line[3].c_str()))) {
-      p_busData[o_idx]->addValue(SHUNT_SWCH_STAT, atoi(split_line[3].c_str()));
+          split_line[3].toInt())) {
+      p_busData[o_idx]->addValue(SHUNT_SWCH_STAT, split_line[3].toInt());
     }
 
     /*
@@ -110,8 +110,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      * #define SHUNT_VSWHI "SHUNT_VSWHI"
      */
     if (!p_busData[o_idx]->setValue(SHUNT_VSWHI,
-          atof(split_line[4].c_str()))) {
-      p_busData[o_idx]->addValue(SHUNT_VSWHI, atof(split_line[4].c_str()));
+          split_line[4].toDouble())) {
+      p_busData[o_idx]->addValue(SHUNT_VSWHI, split_line[4].toDouble());
     }
 
     /*
@@ -119,8 +119,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      * #define SHUNT_VSWLO "SHUNT_VSWLO"
      */
     if (!p_busData[o_idx]->setValue(SHUNT_VSWLO,
-          atof(split_line[5].c_str()))) {
-      p_busData[o_idx]->addValue(SHUNT_VSWLO, atof(split_line[5].c_str()));
+          split_line[5].toDouble())) {
+      p_busData[o_idx]->addValue(SHUNT_VSWLO, split_line[5].toDouble());
     }
 
     /*
@@ -128,8 +128,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      * #define SHUNT_SWREG "SHUNT_SWREG"
      */
     if (!p_busData[o_idx]->setValue(SHUNT_SWREG,
-          atoi(split_line[6].c_str()))) {
-      p_busData[o_idx]->addValue(SHUNT_SWREG, atoi(split_line[6].c_str()));
+          split_line[6].toInt())) {
+      p_busData[o_idx]->addValue(SHUNT_SWREG, split_line[6].toInt());
     }
 
     /*
@@ -137,8 +137,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      * #define SHUNT_RMPCT "SHUNT_RMPCT"
      */
     if (!p_busData[o_idx]->setValue(SHUNT_RMPCT,
-          atof(split_line[7].c_str()))) {
-      p_busData[o_idx]->addValue(SHUNT_RMPCT, atof(split_line[7].c_str()));
+          split_line[7].toDouble())) {
+      p_busData[o_idx]->addValue(SHUNT_RMPCT, split_line[7].toDouble());
     }
 
     /*
@@ -146,8 +146,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      * #define SHUNT_RMIDNT "SHUNT_RMIDNT"
      */
     if (!p_busData[o_idx]->setValue(SHUNT_RMIDNT,
-          split_line[8].c_str())) {
-      p_busData[o_idx]->addValue(SHUNT_RMIDNT, split_line[8].c_str());
+          split_line[8].str().c_str())) {
+      p_busData[o_idx]->addValue(SHUNT_RMIDNT, split_line[8].str().c_str());
     }
 
     /*
@@ -155,8 +155,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      * #define SHUNT_BINIT "SHUNT_BINIT"
      */
     if (!p_busData[o_idx]->setValue(SHUNT_BINIT,
-          atof(split_line[9].c_str()))) {
-      p_busData[o_idx]->addValue(SHUNT_BINIT, atof(split_line[9].c_str()));
+          split_line[9].toDouble())) {
+      p_busData[o_idx]->addValue(SHUNT_BINIT, split_line[9].toDouble());
     }
 
     /*
@@ -165,8 +165,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      */
     if (nval > 10) {
       if (!p_busData[o_idx]->setValue(SHUNT_N1,
-            atoi(split_line[10].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_N1, atoi(split_line[10].c_str()));
+            split_line[10].toInt())) {
+        p_busData[o_idx]->addValue(SHUNT_N1, split_line[10].toInt());
       }
     }
 
@@ -176,8 +176,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      */
     if (nval > 12) {
       if (!p_busData[o_idx]->setValue(SHUNT_N2,
-            atoi(split_line[12].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_N2, atoi(split_line[12].c_str()));
+            split_line[12].toInt())) {
+        p_busData[o_idx]->addValue(SHUNT_N2, split_line[12].toInt());
       }
     }
 
@@ -187,8 +187,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      */
     if (nval > 14) {
       if (!p_busData[o_idx]->setValue(SHUNT_N3,
-            atoi(split_line[14].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_N3, atoi(split_line[14].c_str()));
+            split_line[14].toInt())) {
+        p_busData[o_idx]->addValue(SHUNT_N3, split_line[14].toInt());
       }
     }
 
@@ -198,8 +198,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      */
     if (nval > 16) {
       if (!p_busData[o_idx]->setValue(SHUNT_N4,
-            atoi(split_line[16].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_N4, atoi(split_line[16].c_str()));
+            split_line[16].toInt())) {
+        p_busData[o_idx]->addValue(SHUNT_N4, split_line[16].toInt());
       }
     }
 
@@ -209,8 +209,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      */
     if (nval > 18) {
       if (!p_busData[o_idx]->setValue(SHUNT_N5,
-            atoi(split_line[18].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_N5, atoi(split_line[18].c_str()));
+            split_line[18].toInt())) {
+        p_busData[o_idx]->addValue(SHUNT_N5, split_line[18].toInt());
       }
     }
 
@@ -220,8 +220,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      */
     if (nval > 20) {
       if (!p_busData[o_idx]->setValue(SHUNT_N6,
-            atoi(split_line[20].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_N6, atoi(split_line[20].c_str()));
+            split_line[20].toInt())) {
+        p_busData[o_idx]->addValue(SHUNT_N6, split_line[20].toInt());
       }
     }
 
@@ -231,8 +231,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      */
     if (nval > 22) {
       if (!p_busData[o_idx]->setValue(SHUNT_N7,
-            atoi(split_line[22].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_N7, atoi(split_line[22].c_str()));
+            split_line[22].toInt())) {
+        p_busData[o_idx]->addValue(SHUNT_N7, split_line[22].toInt());
       }
     }
 
@@ -242,8 +242,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      */
     if (nval > 24) {
       if (!p_busData[o_idx]->setValue(SHUNT_N8,
-            atoi(split_line[24].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_N8, atoi(split_line[24].c_str()));
+            split_line[24].toInt())) {
+        p_busData[o_idx]->addValue(SHUNT_N8, split_line[24].toInt());
       }
     }
 
@@ -253,8 +253,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      */
     if (nval > 11) {
       if (!p_busData[o_idx]->setValue(SHUNT_B1,
-            atof(split_line[11].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_B1, atof(split_line[11].c_str()));
+            split_line[11].toDouble())) {
+        p_busData[o_idx]->addValue(SHUNT_B1, split_line[11].toDouble());
       }
     }
 
@@ -264,8 +264,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      */
     if (nval > 13) {
       if (!p_busData[o_idx]->setValue(SHUNT_B2,
-            atof(split_line[13].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_B2, atof(split_line[13].c_str()));
+            split_line[13].toDouble())) {
+        p_busData[o_idx]->addValue(SHUNT_B2, split_line[13].toDouble());
       }
     }
 
@@ -275,8 +275,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      */
     if (nval > 15) {
       if (!p_busData[o_idx]->setValue(SHUNT_B3,
-            atof(split_line[15].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_B3, atof(split_line[15].c_str()));
+            split_line[15].toDouble())) {
+        p_busData[o_idx]->addValue(SHUNT_B3, split_line[15].toDouble());
       }
     }
 
@@ -286,8 +286,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      */
     if (nval > 17) {
       if (!p_busData[o_idx]->setValue(SHUNT_B4,
-            atof(split_line[17].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_B4, atof(split_line[17].c_str()));
+            split_line[17].toDouble())) {
+        p_busData[o_idx]->addValue(SHUNT_B4, split_line[17].toDouble());
       }
     }
 
@@ -298,8 +298,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      */
     if (nval > 19) {
       if (!p_busData[o_idx]->setValue(SHUNT_B5,
-            atof(split_line[19].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_B5, atof(split_line[19].c_str()));
+            split_line[19].toDouble())) {
+        p_busData[o_idx]->addValue(SHUNT_B5, split_line[19].toDouble());
       }
     }
 
@@ -309,8 +309,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      */
     if (nval > 21) {
       if (!p_busData[o_idx]->setValue(SHUNT_B6,
-            atof(split_line[21].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_B6, atof(split_line[21].c_str()));
+            split_line[21].toDouble())) {
+        p_busData[o_idx]->addValue(SHUNT_B6, split_line[21].toDouble());
       }
     }
 
@@ -320,8 +320,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      */
     if (nval > 23) {
       if (!p_busData[o_idx]->setValue(SHUNT_B7,
-            atof(split_line[23].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_B7, atof(split_line[23].c_str()));
+            split_line[23].toDouble())) {
+        p_busData[o_idx]->addValue(SHUNT_B7, split_line[23].toDouble());
       }
     }
 
@@ -331,8 +331,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      */
     if (nval > 25) {
       if (!p_busData[o_idx]->setValue(SHUNT_B8,
-            atof(split_line[25].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_B8, atof(split_line[25].c_str()));
+            split_line[25].toDouble())) {
+        p_busData[o_idx]->addValue(SHUNT_B8, split_line[25].toDouble());
       }
     }
 
@@ -342,8 +342,8 @@ void gridpack::parser::SwitchedShuntParser34::parse(
      */
     if (nval > 26) {
       if (!p_busData[o_idx]->setValue(SHUNT_NREG,
-            atoi(split_line[26].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_NREG, atof(split_line[26].c_str()));
+            split_line[26].toInt())) {
+        p_busData[o_idx]->addValue(SHUNT_NREG, split_line[26].toDouble());
       }
     }
 
@@ -48,20 +48,20 @@ void gridpack::parser::SwitchedShuntParser35::parse(
 
   stream.nextLine(line); //this should be the first line of the block
   while(test_end(line)) {
-    std::vector<std::string>  split_line;
+    PSSERecord split_line;
     if (check_comment(line)) {
       stream.nextLine(line);
       continue;
     }
     this->cleanComment(line);
-    split_line = this->splitPSSELine(line);
+    this->splitPSSELine(line, split_line);
 
     /*
      * type: integer
      * #define SWSHUNT_BUSNUMBER "SWSHUNT_BUSNUMBER"
      */
     int l_idx, o_idx;
-    l_idx = atoi(split_line[0].c_str());
+    l_idx = split_line[0].toInt();
     std::map<int, int>::iterator it;
     it = p_busMap->find(l_idx);
     if (it != p_busMap->end()) {
@@ -73,8 +73,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
     int nval = split_line.size();
 
     if (!p_busData[o_idx]->setValue(SWSHUNT_BUSNUMBER,
-          atoi(split_line[0].c_str()))) {
-      p_busData[o_idx]->addValue(SWSHUNT_BUSNUMBER, atoi(split_line[0].c_str()));
+          split_line[0].toInt())) {
+      p_busData[o_idx]->addValue(SWSHUNT_BUSNUMBER, split_line[0].toInt());
     }
 
     // Currently ignoring the shunt ID. Assume one switched shunt per bus
@@ -83,8 +83,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      * #define SHUNT_MODSW "SHUNT_MODSW"
      */
     if (!p_busData[o_idx]->setValue(SHUNT_MODSW,
-          atoi(split_line[2].c_str()))) {
-      p_busData[o_idx]->addValue(SHUNT_MODSW, atoi(split_line[2].c_str()));
+          split_line[2].toInt())) {
+      p_busData[o_idx]->addValue(SHUNT_MODSW, split_line[2].toInt());
     }
 
     /*
@@ -92,8 +92,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      * #define SHUNT_ADJM "SHUNT_ADJM"
      */
     if (!p_busData[o_idx]->setValue(SHUNT_ADJM,
-          atoi(split_line[3].c_str()))) {
-      p_busData[o_idx]->addValue(SHUNT_ADJM, atoi(split_line[3].c_str()));
+          split_line[3].toInt())) {
+      p_busData[o_idx]->addValue(SHUNT_ADJM, split_line[3].toInt());
     }
 
     /*
@@ -101,8 +101,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      * #define SHUNT_SWCH_STAT "SHUNT_SWCH_STAT"
      */
     if (!p_busData[o_idx]->setValue(SHUNT_SWCH_STAT,
-          atoi(split_line[4].c_str()))) {
-      p_busData[o_idx]->addValue(SHUNT_SWCH_STAT, atoi(split_line[4].c_str()));
+          split_line[4].toInt())) {
+      p_busData[o_idx]->addValue(SHUNT_SWCH_STAT, split_line[4].toInt());
     }
 
     /*
@@ -110,8 +110,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      * #define SHUNT_VSWHI "SHUNT_VSWHI"
      */
     if (!p_busData[o_idx]->setValue(SHUNT_VSWHI,
-          atof(split_line[5].c_str()))) {
-      p_busData[o_idx]->addValue(SHUNT_VSWHI, atof(split_line[5].c_str()));
+          split_line[5].toDouble())) {
+      p_busData[o_idx]->addValue(SHUNT_VSWHI, split_line[5].toDouble());
     }
 
     /*
@@ -119,8 +119,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      * #define SHUNT_VSWLO "SHUNT_VSWLO"
      */
     if (!p_busData[o_idx]->setValue(SHUNT_VSWLO,
-          atof(split_line[6].c_str()))) {
-      p_busData[o_idx]->addValue(SHUNT_VSWLO, atof(split_line[6].c_str()));
+          split_line[6].toDouble())) {
+      p_busData[o_idx]->addValue(SHUNT_VSWLO, split_line[6].toDouble());
     }
 
     /*
@@ -128,8 +128,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      * #define SHUNT_SWREG "SHUNT_SWREG"
      */
     if (!p_busData[o_idx]->setValue(SHUNT_SWREG,
-          atoi(split_line[7].c_str()))) {
-      p_busData[o_idx]->addValue(SHUNT_SWREG, atoi(split_line[7].c_str()));
+          split_line[7].toInt())) {
+      p_busData[o_idx]->addValue(SHUNT_SWREG, split_line[7].toInt());
     }
 
     /*
@@ -137,8 +137,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      * #define SHUNT_NREG "SHUNT_NREG"
      */
     if (!p_busData[o_idx]->setValue(SHUNT_NREG,
-          atoi(split_line[8].c_str()))) {
-      p_busData[o_idx]->addValue(SHUNT_SWREG, atoi(split_line[8].c_str()));
+          split_line[8].toInt())) {
+      p_busData[o_idx]->addValue(SHUNT_SWREG, split_line[8].toInt());
     }
 
     /*
@@ -146,8 +146,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      * #define SHUNT_RMPCT "SHUNT_RMPCT"
      */
     if (!p_busData[o_idx]->setValue(SHUNT_RMPCT,
-          atof(split_line[9].c_str()))) {
-      p_busData[o_idx]->addValue(SHUNT_RMPCT, atof(split_line[9].c_str()));
+          split_line[9].toDouble())) {
+      p_busData[o_idx]->addValue(SHUNT_RMPCT, split_line[9].toDouble());
     }
 
     /*
@@ -155,8 +155,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      * #define SHUNT_RMIDNT "SHUNT_RMIDNT"
      */
     if (!p_busData[o_idx]->setValue(SHUNT_RMIDNT,
-          split_line[10].c_str())) {
-      p_busData[o_idx]->addValue(SHUNT_RMIDNT, split_line[10].c_str());
+          split_line[10].str().c_str())) {
+      p_busData[o_idx]->addValue(SHUNT_RMIDNT, split_line[10].str().c_str());
     }
 
     /*
@@ -164,8 +164,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      * #define SHUNT_BINIT "SHUNT_BINIT"
      */
     if (!p_busData[o_idx]->setValue(SHUNT_BINIT,
-          atof(split_line[11].c_str()))) {
-      p_busData[o_idx]->addValue(SHUNT_BINIT, atof(split_line[11].c_str()));
+          split_line[11].toDouble())) {
+      p_busData[o_idx]->addValue(SHUNT_BINIT, split_line[11].toDouble());
     }
 
     /*
@@ -174,8 +174,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      */
     if (nval > 12) {
       if (!p_busData[o_idx]->setValue(SHUNT_S1,
-            atoi(split_line[12].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_S1, atoi(split_line[12].c_str()));
+            split_line[12].toInt())) {
+        p_busData[o_idx]->addValue(SHUNT_S1, split_line[12].toInt());
       }
     }
 
@@ -185,8 +185,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      */
     if (nval > 15) {
       if (!p_busData[o_idx]->setValue(SHUNT_S2,
-            atoi(split_line[15].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_S2, atoi(split_line[15].c_str()));
+            split_line[15].toInt())) {
+        p_busData[o_idx]->addValue(SHUNT_S2, split_line[15].toInt());
       }
     }
 
@@ -196,8 +196,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      */
     if (nval > 18) {
       if (!p_busData[o_idx]->setValue(SHUNT_S3,
-            atoi(split_line[18].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_S3, atoi(split_line[18].c_str()));
+            split_line[18].toInt())) {
+        p_busData[o_idx]->addValue(SHUNT_S3, split_line[18].toInt());
       }
     }
 
@@ -207,8 +207,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      */
     if (nval > 21) {
       if (!p_busData[o_idx]->setValue(SHUNT_S4,
-            atoi(split_line[21].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_S4, atoi(split_line[21].c_str()));
+            split_line[21].toInt())) {
+        p_busData[o_idx]->addValue(SHUNT_S4, split_line[21].toInt());
       }
     }
 
@@ -218,8 +218,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      */
     if (nval > 24) {
       if (!p_busData[o_idx]->setValue(SHUNT_S5,
-            atoi(split_line[24].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_S5, atoi(split_line[24].c_str()));
+            split_line[24].toInt())) {
+        p_busData[o_idx]->addValue(SHUNT_S5, split_line[24].toInt());
       }
     }
 
@@ -229,8 +229,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      */
     if (nval > 27) {
       if (!p_busData[o_idx]->setValue(SHUNT_S6,
-            atoi(split_line[27].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_S6, atoi(split_line[27].c_str()));
+            split_line[27].toInt())) {
+        p_busData[o_idx]->addValue(SHUNT_S6, split_line[27].toInt());
       }
     }
 
@@ -240,8 +240,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      */
     if (nval > 30) {
       if (!p_busData[o_idx]->setValue(SHUNT_S7,
-            atoi(split_line[30].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_S7, atoi(split_line[30].c_str()));
+            split_line[30].toInt())) {
+        p_busData[o_idx]->addValue(SHUNT_S7, split_line[30].toInt());
       }
     }
 
@@ -251,8 +251,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      */
     if (nval > 33) {
       if (!p_busData[o_idx]->setValue(SHUNT_S8,
-            atoi(split_line[33].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_S8, atoi(split_line[33].c_str()));
+            split_line[33].toInt())) {
+        p_busData[o_idx]->addValue(SHUNT_S8, split_line[33].toInt());
       }
     }
 
@@ -262,8 +262,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      */
     if (nval > 13) {
       if (!p_busData[o_idx]->setValue(SHUNT_N1,
-            atoi(split_line[13].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_N1, atoi(split_line[13].c_str()));
+            split_line[13].toInt())) {
+        p_busData[o_idx]->addValue(SHUNT_N1, split_line[13].toInt());
       }
     }
 
@@ -273,8 +273,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      */
     if (nval > 16) {
       if (!p_busData[o_idx]->setValue(SHUNT_N2,
-            atoi(split_line[16].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_N2, atoi(split_line[16].c_str()));
+            split_line[16].toInt())) {
+        p_busData[o_idx]->addValue(SHUNT_N2, split_line[16].toInt());
       }
     }
 
@@ -284,8 +284,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      */
     if (nval > 19) {
       if (!p_busData[o_idx]->setValue(SHUNT_N3,
-            atoi(split_line[19].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_N3, atoi(split_line[19].c_str()));
+            split_line[19].toInt())) {
+        p_busData[o_idx]->addValue(SHUNT_N3, split_line[19].toInt());
       }
     }
 
@@ -295,8 +295,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      */
     if (nval > 22) {
       if (!p_busData[o_idx]->setValue(SHUNT_N4,
-            atoi(split_line[22].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_N4, atoi(split_line[22].c_str()));
+            split_line[22].toInt())) {
+        p_busData[o_idx]->addValue(SHUNT_N4, split_line[22].toInt());
       }
     }
 
@@ -306,8 +306,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      */
     if (nval > 25) {
       if (!p_busData[o_idx]->setValue(SHUNT_N5,
-            atoi(split_line[25].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_N5, atoi(split_line[25].c_str()));
+            split_line[25].toInt())) {
+        p_busData[o_idx]->addValue(SHUNT_N5, split_line[25].toInt());
       }
     }
 
@@ -317,8 +317,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      */
     if (nval > 28) {
       if (!p_busData[o_idx]->setValue(SHUNT_N6,
-            atoi(split_line[28].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_N6, atoi(split_line[28].c_str()));
+            split_line[28].toInt())) {
+        p_busData[o_idx]->addValue(SHUNT_N6, split_line[28].toInt());
       }
     }
 
@@ -328,8 +328,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      */
     if (nval > 31) {
       if (!p_busData[o_idx]->setValue(SHUNT_N7,
-            atoi(split_line[31].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_N7, atoi(split_line[31].c_str()));
+            split_line[31].toInt())) {
+        p_busData[o_idx]->addValue(SHUNT_N7, split_line[31].toInt());
       }
     }
 
@@ -339,8 +339,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      */
     if (nval > 34) {
       if (!p_busData[o_idx]->setValue(SHUNT_N8,
-            atoi(split_line[34].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_N8, atoi(split_line[34].c_str()));
+            split_line[34].toInt())) {
+        p_busData[o_idx]->addValue(SHUNT_N8, split_line[34].toInt());
       }
     }
 
@@ -350,8 +350,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      */
     if (nval > 14) {
       if (!p_busData[o_idx]->setValue(SHUNT_B1,
-            atof(split_line[14].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_B1, atof(split_line[14].c_str()));
+            split_line[14].toDouble())) {
+        p_busData[o_idx]->addValue(SHUNT_B1, split_line[14].toDouble());
       }
     }
 
@@ -361,8 +361,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      */
     if (nval > 17) {
       if (!p_busData[o_idx]->setValue(SHUNT_B2,
-            atof(split_line[17].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_B2, atof(split_line[17].c_str()));
+            split_line[17].toDouble())) {
+        p_busData[o_idx]->addValue(SHUNT_B2, split_line[17].toDouble());
       }
     }
 
@@ -372,8 +372,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      */
     if (nval > 20) {
       if (!p_busData[o_idx]->setValue(SHUNT_B3,
-            atof(split_line[20].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_B3, atof(split_line[20].c_str()));
+            split_line[20].toDouble())) {
+        p_busData[o_idx]->addValue(SHUNT_B3, split_line[20].toDouble());
       }
     }
 
@@ -383,8 +383,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      */
     if (nval > 23) {
       if (!p_busData[o_idx]->setValue(SHUNT_B4,
-            atof(split_line[23].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_B4, atof(split_line[23].c_str()));
+            split_line[23].toDouble())) {
+        p_busData[o_idx]->addValue(SHUNT_B4, split_line[23].toDouble());
       }
     }
 
@@ -395,8 +395,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      */
     if (nval > 26) {
       if (!p_busData[o_idx]->setValue(SHUNT_B5,
-            atof(split_line[26].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_B5, atof(split_line[26].c_str()));
+            split_line[26].toDouble())) {
+        p_busData[o_idx]->addValue(SHUNT_B5, split_line[26].toDouble());
       }
     }
 
@@ -406,8 +406,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      */
     if (nval > 29) {
       if (!p_busData[o_idx]->setValue(SHUNT_B6,
-            atof(split_line[29].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_B6, atof(split_line[29].c_str()));
+            split_line[29].toDouble())) {
+        p_busData[o_idx]->addValue(SHUNT_B6, split_line[29].toDouble());
       }
     }
 
@@ -417,8 +417,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      */
     if (nval > 32) {
       if (!p_busData[o_idx]->setValue(SHUNT_B7,
-            atof(split_line[32].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_B7, atof(split_line[32].c_str()));
+            split_line[32].toDouble())) {
+        p_busData[o_idx]->addValue(SHUNT_B7, split_line[32].toDouble());
       }
     }
 
@@ -428,8 +428,8 @@ void gridpack::parser::SwitchedShuntParser35::parse(
      */
     if (nval > 35) {
       if (!p_busData[o_idx]->setValue(SHUNT_B8,
-            atof(split_line[35].c_str()))) {
-        p_busData[o_idx]->addValue(SHUNT_B8, atof(split_line[35].c_str()));
+            split_line[35].toDouble())) {
+        p_busData[o_idx]->addValue(SHUNT_B8, split_line[35].toDouble());
       }
     }
 
@@ -62,14 +62,14 @@ class TransformerParser33 : public BaseBlockParser {
    * @param ratea, rateb, ratec rating parameters
    * @return true if all parameters found
    */
-  bool parse3WindXForm(std::vector<std::string>split_line, double *windv,
+  bool parse3WindXForm(const PSSERecord &split_line, double *windv,
       double* ang, double *ratea, double *rateb, double *ratec)
   {
-    *windv = atof(split_line[0].c_str());
-    *ang = atof(split_line[2].c_str());
-    *ratea = atof(split_line[3].c_str());
-    *rateb = atof(split_line[4].c_str());
-    *ratec = atof(split_line[5].c_str());
+    *windv = split_line[0].toDouble();
+    *ang = split_line[2].toDouble();
+    *ratea = split_line[3].toDouble();
+    *rateb = split_line[4].toDouble();
+    *ratec = split_line[5].toDouble();
     bool ret = true;
     return ret && (split_line.size() > 5);
   }
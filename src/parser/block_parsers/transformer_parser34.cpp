@@ -65,13 +65,13 @@ void gridpack::parser::TransformerParser34::parse(
   bool wind3X = true;
 
   while(test_end(line)) {
-    std::vector<std::string>  split_line;
+    PSSERecord split_line;
     if (check_comment(line)) {
       stream.nextLine(line);
       continue;
     }
     this->cleanComment(line);
-    split_line = this->splitPSSELine(line);
+    this->splitPSSELine(line, split_line);
     int o_idx1, o_idx2;
     o_idx1 = getBusIndex(split_line[0]);
     o_idx2 = getBusIndex(split_line[1]);
@@ -82,16 +82,16 @@ void gridpack::parser::TransformerParser34::parse(
       if (wind3X) {
         int o_idx3 = k;
         stream.nextLine(line);
-        std::vector<std::string>  split_line2;
+        PSSERecord split_line2;
         if (check_comment(line)) {
           stream.nextLine(line);
           continue;
         }
         this->cleanComment(line);
-        split_line2 = this->splitPSSELine(line);
+        this->splitPSSELine(line, split_line2);
         // Check to see if transformer is active
         int stat;
-        stat = atoi(split_line[11].c_str());
+        stat = split_line[11].toInt();
         if (split_line2.size() < 4 || stat == 0) {
           stream.nextLine(line);
           stream.nextLine(line);
@@ -106,19 +106,19 @@ void gridpack::parser::TransformerParser34::parse(
         if (it != p_busMap->end()) {
           l_idx1 = it->second;
         } else {
-          printf("No match found for bus %s\n",split_line[0].c_str());
+          printf("No match found for bus %s\n",split_line[0].str().c_str());
         }
         it = p_busMap->find(o_idx2);
         if (it != p_busMap->end()) {
           l_idx2 = it->second;
         } else {
-          printf("No match found for bus %s\n",split_line[1].c_str());
+          printf("No match found for bus %s\n",split_line[1].str().c_str());
         }
         it = p_busMap->find(o_idx3);
         if (it != p_busMap->end()) {
           l_idx3 = it->second;
         } else {
-          printf("No match found for bus %s\n",split_line[2].c_str());
+          printf("No match found for bus %s\n",split_line[2].str().c_str());
         }
         // Create a new bus and three new branches. No need to check
         // previous branches to see if they match since they are all
@@ -165,24 +165,24 @@ void gridpack::parser::TransformerParser34::parse(
 
         // parse remainder of line 1
         double mag1, mag2;
-        mag1 = atof(split_line[7].c_str());
-        mag2 = atof(split_line[8].c_str());
+        mag1 = split_line[7].toDouble();
+        mag2 = split_line[8].toDouble();
         // Clean up 2 character tag
         gridpack::utility::StringUtils util;
-        std::string tag = util.clean2Char(split_line[3]);
+        std::string tag = split_line[3].tag();
 
         // parse line 2
         double r12, r23, r31, x12, x23, x31, sb12, sb23, sb31;
         double r1, r2, r3, x1, x2, x3, b1, b2, b3;
-        r12 = atof(split_line2[0].c_str());
-        x12 = atof(split_line2[1].c_str());
-        sb12 = atof(split_line2[2].c_str());
-        r23 = atof(split_line2[3].c_str());
-        x23 = atof(split_line2[4].c_str());
-        sb23 = atof(split_line2[5].c_str());
-        r31 = atof(split_line2[6].c_str());
-        x31 = atof(split_line2[7].c_str());
-        sb31 = atof(split_line2[8].c_str());
+        r12 = split_line2[0].toDouble();
+        x12 = split_line2[1].toDouble();
+        sb12 = split_line2[2].toDouble();
+        r23 = split_line2[3].toDouble();
+        x23 = split_line2[4].toDouble();
+        sb23 = split_line2[5].toDouble();
+        r31 = split_line2[6].toDouble();
+        x31 = split_line2[7].toDouble();
+        sb31 = split_line2[8].toDouble();
         r1 = 0.5*(r12+r31-r23);
         x1 = 0.5*(x12+x31-x23);
         b1 = 0.0;
@@ -212,13 +212,13 @@ void gridpack::parser::TransformerParser34::parse(
           data1(new gridpack::component::DataCollection);
         p_branchData.push_back(data1);
         stream.nextLine(line);
-        std::vector<std::string> split_line3;
+        PSSERecord split_line3;
         if (check_comment(line)) {
           stream.nextLine(line);
           continue;
         }
         this->cleanComment(line);
-        split_line3 = this->splitPSSELine(line);
+        this->splitPSSELine(line, split_line3);
         double windv, ang, rate[12];
         parse3WindXForm(split_line3, &windv, &ang, rate);
         data1->addValue(BRANCH_INDEX,index);
@@ -263,13 +263,13 @@ void gridpack::parser::TransformerParser34::parse(
           data2(new gridpack::component::DataCollection);
         p_branchData.push_back(data2);
         stream.nextLine(line);
-        std::vector<std::string> split_line4;
+        PSSERecord split_line4;
         if (check_comment(line)) {
           stream.nextLine(line);
           continue;
         }
         this->cleanComment(line);
-        split_line4 = this->splitPSSELine(line);
+        this->splitPSSELine(line, split_line4);
         parse3WindXForm(split_line4, &windv, &ang, rate);
         data2->addValue(BRANCH_INDEX,index);
         data2->addValue(BRANCH_FROMBUS,o_idx2);
@@ -313,13 +313,13 @@ void gridpack::parser::TransformerParser34::parse(
           data3(new gridpack::component::DataCollection);
         p_branchData.push_back(data3);
         stream.nextLine(line);
-        std::vector<std::string> split_line5;
+        PSSERecord split_line5;
         if (check_comment(line)) {
           stream.nextLine(line);
           continue;
         }
         this->cleanComment(line);
-        split_line5 = this->splitPSSELine(line);
+        this->splitPSSELine(line, split_line5);
         parse3WindXForm(split_line5, &windv, &ang, rate);
         data3->addValue(BRANCH_INDEX,index);
         data3->addValue(BRANCH_FROMBUS,o_idx3);
@@ -367,31 +367,31 @@ void gridpack::parser::TransformerParser34::parse(
     } else {
       int ntoken = split_line.size();
       stream.nextLine(line);
-      std::vector<std::string>  split_line2;
+      PSSERecord split_line2;
       if (check_comment(line)) {
         stream.nextLine(line);
         continue;
       }
       this->cleanComment(line);
-      split_line2 = this->splitPSSELine(line);
+      this->splitPSSELine(line, split_line2);
 
       stream.nextLine(line);
-      std::vector<std::string>  split_line3;
+      PSSERecord split_line3;
       if (check_comment(line)) {
         stream.nextLine(line);
         continue;
       }
       this->cleanComment(line);
-      split_line3 = this->splitPSSELine(line);
+      this->splitPSSELine(line, split_line3);
 
       stream.nextLine(line);
-      std::vector<std::string>  split_line4;
+      PSSERecord split_line4;
       if (check_comment(line)) {
         stream.nextLine(line);
         continue;
       }
       this->cleanComment(line);
-      split_line4 = this->splitPSSELine(line);
+      this->splitPSSELine(line, split_line4);
       // find branch corresponding to this transformer line. If it doesn't
       // exist, create one
       int l_idx = 0;
@@ -448,7 +448,7 @@ void gridpack::parser::TransformerParser34::parse(
 
       // Clean up 2 character tag
       gridpack::utility::StringUtils util;
-      std::string tag = util.clean2Char(split_line[3]);
+      std::string tag = split_line[3].tag();
       // BRANCH_CKT          "CKT"                 character
       p_branchData[l_idx]->addValue(BRANCH_CKT, tag.c_str(), nelems);
 
@@ -457,7 +457,7 @@ void gridpack::parser::TransformerParser34::parse(
        * type: integer
        * TRANSFORMER_CW
        */
-      int cw =  atoi(split_line[4].c_str()); 
+      int cw =  split_line[4].toInt(); 
       p_branchData[l_idx]->addValue(TRANSFORMER_CW,
          cw,nelems);
 
@@ -466,101 +466,101 @@ void gridpack::parser::TransformerParser34::parse(
        * TRANSFORMER_CZ
        */
       p_branchData[l_idx]->addValue(TRANSFORMER_CZ,
-          atoi(split_line[5].c_str()),nelems);
+          split_line[5].toInt(),nelems);
 
       /*
        * type: integer
        * TRANSFORMER_CM
        */
       p_branchData[l_idx]->addValue(TRANSFORMER_CM,
-          atoi(split_line[6].c_str()),nelems);
+          split_line[6].toInt(),nelems);
 
       /*
        * type: float
        * TRANSFORMER_MAG1
        */
       p_branchData[l_idx]->addValue(TRANSFORMER_MAG1,
-          atof(split_line[7].c_str()),nelems);
+          split_line[7].toDouble(),nelems);
 
       /*
        * type: float
        * TRANSFORMER_MAG2
        */
       p_branchData[l_idx]->addValue(TRANSFORMER_MAG2,
-          atof(split_line[8].c_str()),nelems);
+          split_line[8].toDouble(),nelems);
 
       p_branchData[l_idx]->addValue(BRANCH_B,
-          atof(split_line[8].c_str()),nelems);										   
+          split_line[8].toDouble(),nelems);										   
 
       /*
        * type: integer
        * BRANCH_STATUS
        */
       p_branchData[l_idx]->addValue(BRANCH_STATUS,
-          atoi(split_line[11].c_str()),nelems);
+          split_line[11].toInt(),nelems);
 
       /**
        * type: integer
        * TRANSFORMER_NMETR
        */
       p_branchData[l_idx]->addValue(TRANSFORMER_NMETR,
-          atoi(split_line[9].c_str()),nelems);
+          split_line[9].toInt(),nelems);
 
       /*
        * type: integer
        * BRANCH_O1
        */
       if (ntoken > 12) p_branchData[l_idx]->addValue(BRANCH_O1,
-          atoi(split_line[12].c_str()), nelems);
+          split_line[12].toInt(), nelems);
 
       /*
        * type: float
        * BRANCH_F1
        */
       if (ntoken > 13) p_branchData[l_idx]->addValue(BRANCH_F1,
-          atoi(split_line[13].c_str()), nelems);
+          split_line[13].toInt(), nelems);
 
       /*
        * type: integer
        * BRANCH_O2
        */
       if (ntoken > 14) p_branchData[l_idx]->addValue(BRANCH_O2,
-          atoi(split_line[14].c_str()), nelems);
+          split_line[14].toInt(), nelems);
 
       /*
        * type: float
        * BRANCH_F2
        */
       if (ntoken > 15) p_branchData[l_idx]->addValue(BRANCH_F2,
-          atoi(split_line[15].c_str()), nelems);
+          split_line[15].toInt(), nelems);
 
       /*
        * type: integer
        * BRANCH_O3
        */
       if (ntoken > 16) p_branchData[l_idx]->addValue(BRANCH_O3,
-          atoi(split_line[16].c_str()), nelems);
+          split_line[16].toInt(), nelems);
 
       /*
        * type: float
        * BRANCH_F3
        */
       if (ntoken > 17) p_branchData[l_idx]->addValue(BRANCH_F3,
-          atoi(split_line[17].c_str()), nelems);
+          split_line[17].toInt(), nelems);
 
       /*
        * type: integer
        * BRANCH_O4
        */
       if (ntoken > 18) p_branchData[l_idx]->addValue(BRANCH_O4,
-          atoi(split_line[18].c_str()), nelems);
+          split_line[18].toInt(), nelems);
 
       /*
        * type: float
        * BRANCH_F4
        */
       if (ntoken > 19) p_branchData[l_idx]->addValue(BRANCH_F4,
-          atoi(split_line[19].c_str()), nelems);
+          split_line[19].toInt(), nelems);
 
 
       // Add parameters from line 2
@@ -568,7 +568,7 @@ void gridpack::parser::TransformerParser34::parse(
        * type: float
        * SBASE2
        */
-      double sbase2 = atof(split_line2[2].c_str());
+      double sbase2 = split_line2[2].toDouble();
       p_branchData[l_idx]->addValue(TRANSFORMER_SBASE1_2,sbase2,nelems);
 
 
@@ -579,11 +579,11 @@ void gridpack::parser::TransformerParser34::parse(
        * BRANCH_TAP: This is the ratio of WINDV1 and WINDV2
        */
       ntoken = split_line3.size();
-      double windv1 = atof(split_line3[0].c_str());
-      double windv2 = atof(split_line4[0].c_str());
+      double windv1 = split_line3[0].toDouble();
+      double windv2 = split_line4[0].toDouble();
       if(cw == 2) {
-        double nomv1 = atof(split_line3[1].c_str());
-        double nomv2 = atof(split_line4[1].c_str());
+        double nomv1 = split_line3[1].toDouble();
+        double nomv2 = split_line4[1].toDouble();
         windv1 = windv1/nomv1;
         windv2 = windv2/nomv2;
       }
@@ -597,7 +597,7 @@ void gridpack::parser::TransformerParser34::parse(
        * type: float
        * BRANCH_R
        */
-      double rval = atof(split_line2[0].c_str());
+      double rval = split_line2[0].toDouble();
       p_branchData[l_idx]->addValue(TRANSFORMER_R1_2,rval,nelems);
       rval  = rval * windv2 * windv2; // need to consider the wnd2 ratio to the req of the transformer
       if (sbase2 == p_case_sbase || sbase2 == 0.0) {
@@ -612,7 +612,7 @@ void gridpack::parser::TransformerParser34::parse(
        * type: float
        * BRANCH_X
        */
-      rval = atof(split_line2[1].c_str());
+      rval = split_line2[1].toDouble();
       p_branchData[l_idx]->addValue(TRANSFORMER_X1_2,rval,nelems);
       rval  = rval * windv2 * windv2; // need to consider the wnd2 ratio to the xeq of the transformer
       if (sbase2 == p_case_sbase || sbase2 == 0.0) {
@@ -629,59 +629,59 @@ void gridpack::parser::TransformerParser34::parse(
        * BRANCH_SHIFT
        */
       p_branchData[l_idx]->addValue(BRANCH_SHIFT,
-          atof(split_line3[2].c_str()),nelems);
+          split_line3[2].toDouble(),nelems);
       p_branchData[l_idx]->addValue(TRANSFORMER_ANG1,
-          atof(split_line3[2].c_str()),nelems);
+          split_line3[2].toDouble(),nelems);
 
       /*
        * type: float
        * BRANCH_RATE1-12
        */
       p_branchData[l_idx]->addValue(BRANCH_RATE1,
-          atof(split_line3[3].c_str()),nelems);
+          split_line3[3].toDouble(),nelems);
       p_branchData[l_idx]->addValue(BRANCH_RATE2,
-          atof(split_line3[4].c_str()),nelems);
+          split_line3[4].toDouble(),nelems);
       p_branchData[l_idx]->addValue(BRANCH_RATE3,
-          atof(split_line3[5].c_str()),nelems);
+          split_line3[5].toDouble(),nelems);
       p_branchData[l_idx]->addValue(BRANCH_RATE4,
-          atof(split_line3[6].c_str()),nelems);
+          split_line3[6].toDouble(),nelems);
       p_branchData[l_idx]->addValue(BRANCH_RATE5,
-          atof(split_line3[7].c_str()),nelems);
+          split_line3[7].toDouble(),nelems);
       p_branchData[l_idx]->addValue(BRANCH_RATE6,
-          atof(split_line3[8].c_str()),nelems);
+          split_line3[8].toDouble(),nelems);
       p_branchData[l_idx]->addValue(BRANCH_RATE7,
-          atof(split_line3[9].c_str()),nelems);
+          split_line3[9].toDouble(),nelems);
       p_branchData[l_idx]->addValue(BRANCH_RATE8,
-          atof(split_line3[10].c_str()),nelems);
+          split_line3[10].toDouble(),nelems);
       p_branchData[l_idx]->addValue(BRANCH_RATE9,
-          atof(split_line3[11].c_str()),nelems);
+          split_line3[11].toDouble(),nelems);
       p_branchData[l_idx]->addValue(BRANCH_RATE10,
-          atof(split_line3[12].c_str()),nelems);
+          split_line3[12].toDouble(),nelems);
       p_branchData[l_idx]->addValue(BRANCH_RATE11,
-          atof(split_line3[13].c_str()),nelems);
+          split_line3[13].toDouble(),nelems);
       p_branchData[l_idx]->addValue(BRANCH_RATE12,
-          atof(split_line3[14].c_str()),nelems);
+          split_line3[14].toDouble(),nelems);
 
       /*
        * type: integer
        * TRANSFORMER_CODE1
        */
       p_branchData[l_idx]->addValue(TRANSFORMER_CODE1,
-          atoi(split_line3[15].c_str()),nelems);
+          split_line3[15].toInt(),nelems);
 
       /*
        * type: float
        * TRANSFORMER_RMA
        */
       p_branchData[l_idx]->addValue(TRANSFORMER_RMA,
-          atof(split_line3[17].c_str()),nelems);
+          split_line3[17].toDouble(),nelems);
 
       /*
        * type: float
        * TRANSFORMER_RMI
        */
       p_branchData[l_idx]->addValue(TRANSFORMER_RMI,
-          atof(split_line3[18].c_str()),nelems);
+          split_line3[18].toDouble(),nelems);
 
       /*
        * type: float
@@ -689,7 +689,7 @@ void gridpack::parser::TransformerParser34::parse(
        */
       if (ntoken > 19) {
         p_branchData[l_idx]->addValue(TRANSFORMER_VMA,
-            atof(split_line3[19].c_str()),nelems);
+            split_line3[19].toDouble(),nelems);
       }
 
       /*
@@ -698,7 +698,7 @@ void gridpack::parser::TransformerParser34::parse(
        */
       if (ntoken > 20) {
         p_branchData[l_idx]->addValue(TRANSFORMER_VMI,
-            atof(split_line3[20].c_str()),nelems);
+            split_line3[20].toDouble(),nelems);
       }
 
       /* Ignore line 4 for now */
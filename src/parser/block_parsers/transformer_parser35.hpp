@@ -62,23 +62,23 @@ class TransformerParser35 : public BaseBlockParser {
    * @param ratea, rateb, ratec rating parameters
    * @return true if all parameters found
    */
-  bool parse3WindXForm(std::vector<std::string>split_line, double *windv,
+  bool parse3WindXForm(const PSSERecord &split_line, double *windv,
       double* ang, double *rate)
   {
-    *windv = atof(split_line[0].c_str());
-    *ang = atof(split_line[2].c_str());
-    rate[0] = atof(split_line[3].c_str());
-    rate[1] = atof(split_line[4].c_str());
-    rate[2] = atof(split_line[5].c_str());
-    rate[3] = atof(split_line[6].c_str());
-    rate[4] = atof(split_line[7].c_str());
-    rate[5] = atof(split_line[8].c_str());
-    rate[6] = atof(split_line[9].c_str());
-    rate[7] = atof(split_line[10].c_str());
-    rate[8] = atof(split_line[11].c_str());
-    rate[9] = atof(split_line[12].c_str());
-    rate[10] = atof(split_line[13].c_str());
-    rate[11] = atof(split_line[14].c_str());
+    *windv = split_line[0].toDouble();
+    *ang = split_line[2].toDouble();
+    rate[0] = split_line[3].toDouble();
+    rate[1] = split_line[4].toDouble();
+    rate[2] = split_line[5].toDouble();
+    rate[3] = split_line[6].toDouble();
+    rate[4] = split_line[7].toDouble();
+    rate[5] = split_line[8].toDouble();
+    rate[6] = split_line[9].toDouble();
+    rate[7] = split_line[10].toDouble();
+    rate[8] = split_line[11].toDouble();
+    rate[9] = split_line[12].toDouble();
+    rate[10] = split_line[13].toDouble();
+    rate[11] = split_line[14].toDouble();
     bool ret = true;
     return ret && (split_line.size() > 14);
   }
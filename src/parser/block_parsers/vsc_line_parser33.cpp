@@ -45,15 +45,15 @@ void gridpack::parser::VSCLineParser33::parse(
   stream.nextLine(line); //this should be the first line of the block
 
   while(test_end(line)) {
-    std::vector<std::string>  split_line;
+    PSSERecord split_line;
     if (check_comment(line)) {
       stream.nextLine(line);
       continue;
     }
     this->cleanComment(line);
-    split_line = this->splitPSSELine(line);
+    this->splitPSSELine(line, split_line);
     int l_idx, o_idx;
-    o_idx = atoi(split_line[1].c_str());
+    o_idx = split_line[1].toInt();
     std::map<int, int>::iterator it;
     it = p_busMap->find(o_idx);
     if (it != p_busMap->end()) {
@@ -11,6 +11,7 @@
 #define CIM6BL_HPP
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
+#include "gridpack/parser/psse_tokenizer.hpp"
 #include "gridpack/utilities/string_utils.hpp"
 namespace gridpack {
 namespace parser {
@@ -235,7 +236,7 @@ template <class _data_struct> class Cim6blParser
      * @param model name of generator model
      * @param gen_id index of generator
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const std::vector<PSSEToken> &split_line,
         gridpack::component::DataCollection *data, int l_id)
     {
       double rval;
@@ -245,7 +246,7 @@ template <class _data_struct> class Cim6blParser
       // LOAD_MODEL
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted().str();
       util.toUpper(model);
       if (!data->getValue(LOAD_MODEL,&stmp,l_id)) {
         data->addValue(LOAD_MODEL, model.c_str(), l_id);
@@ -256,225 +257,225 @@ template <class _data_struct> class Cim6blParser
       // LOAD_IT
       if (nstr > 3) {
         if (!data->getValue(LOAD_IT,&ival,l_id)) {
-          data->addValue(LOAD_IT, atoi(split_line[3].c_str()), l_id);
+          data->addValue(LOAD_IT, split_line[3].toInt(), l_id);
         } else {
-          data->setValue(LOAD_IT, atoi(split_line[3].c_str()), l_id);
+          data->setValue(LOAD_IT, split_line[3].toInt(), l_id);
         }
       }
 
       // LOAD_RA
       if (nstr > 4) {
         if (!data->getValue(LOAD_RA,&rval,l_id)) {
-          data->addValue(LOAD_RA, atof(split_line[4].c_str()), l_id);
+          data->addValue(LOAD_RA, split_line[4].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_RA, atof(split_line[4].c_str()), l_id);
+          data->setValue(LOAD_RA, split_line[4].toDouble(), l_id);
         }
       } 
 
       // LOAD_XA
       if (nstr > 5) {
         if (!data->getValue(LOAD_XA,&rval,l_id)) {
-          data->addValue(LOAD_XA, atof(split_line[5].c_str()), l_id);
+          data->addValue(LOAD_XA, split_line[5].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_XA, atof(split_line[5].c_str()), l_id);
+          data->setValue(LOAD_XA, split_line[5].toDouble(), l_id);
         }
       } 
 
       // LOAD_XM
       if (nstr > 6) {
         if (!data->getValue(LOAD_XM,&rval,l_id)) {
-          data->addValue(LOAD_XM, atof(split_line[6].c_str()), l_id);
+          data->addValue(LOAD_XM, split_line[6].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_XM, atof(split_line[6].c_str()), l_id);
+          data->setValue(LOAD_XM, split_line[6].toDouble(), l_id);
         }
       } 
 
       // LOAD_R1
       if (nstr > 7) {
         if (!data->getValue(LOAD_R1,&rval,l_id)) {
-          data->addValue(LOAD_R1, atof(split_line[7].c_str()), l_id);
+          data->addValue(LOAD_R1, split_line[7].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_R1, atof(split_line[7].c_str()), l_id);
+          data->setValue(LOAD_R1, split_line[7].toDouble(), l_id);
         }
       } 
 
       // LOAD_X1
       if (nstr > 8) {
         if (!data->getValue(LOAD_X1,&rval,l_id)) {
-          data->addValue(LOAD_X1, atof(split_line[8].c_str()), l_id);
+          data->addValue(LOAD_X1, split_line[8].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_X1, atof(split_line[8].c_str()), l_id);
+          data->setValue(LOAD_X1, split_line[8].toDouble(), l_id);
         }
       } 
 
       // LOAD_R2
       if (nstr > 9) {
         if (!data->getValue(LOAD_R2,&rval,l_id)) {
-          data->addValue(LOAD_R2, atof(split_line[9].c_str()), l_id);
+          data->addValue(LOAD_R2, split_line[9].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_R2, atof(split_line[9].c_str()), l_id);
+          data->setValue(LOAD_R2, split_line[9].toDouble(), l_id);
         }
       } 
 
       // LOAD_X2
       if (nstr > 10) {
         if (!data->getValue(LOAD_X2,&rval,l_id)) {
-          data->addValue(LOAD_X2, atof(split_line[10].c_str()), l_id);
+          data->addValue(LOAD_X2, split_line[10].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_X2, atof(split_line[10].c_str()), l_id);
+          data->setValue(LOAD_X2, split_line[10].toDouble(), l_id);
         }
       } 
 
       // LOAD_E1
       if (nstr > 11) {
         if (!data->getValue(LOAD_E1,&rval,l_id)) {
-          data->addValue(LOAD_E1, atof(split_line[11].c_str()), l_id);
+          data->addValue(LOAD_E1, split_line[11].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_E1, atof(split_line[11].c_str()), l_id);
+          data->setValue(LOAD_E1, split_line[11].toDouble(), l_id);
         }
       } 
 
       // LOAD_SE1
       if (nstr > 12) {
         if (!data->getValue(LOAD_SE1,&rval,l_id)) {
-          data->addValue(LOAD_SE1, atof(split_line[12].c_str()), l_id);
+          data->addValue(LOAD_SE1, split_line[12].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_SE1, atof(split_line[12].c_str()), l_id);
+          data->setValue(LOAD_SE1, split_line[12].toDouble(), l_id);
         }
       } 
 
       // LOAD_E2
       if (nstr > 13) {
         if (!data->getValue(LOAD_E2,&rval,l_id)) {
-          data->addValue(LOAD_E2, atof(split_line[13].c_str()), l_id);
+          data->addValue(LOAD_E2, split_line[13].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_E2, atof(split_line[13].c_str()), l_id);
+          data->setValue(LOAD_E2, split_line[13].toDouble(), l_id);
         }
       } 
 
       // LOAD_SE2
       if (nstr > 14) {
         if (!data->getValue(LOAD_SE2,&rval,l_id)) {
-          data->addValue(LOAD_SE2, atof(split_line[14].c_str()), l_id);
+          data->addValue(LOAD_SE2, split_line[14].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_SE2, atof(split_line[14].c_str()), l_id);
+          data->setValue(LOAD_SE2, split_line[14].toDouble(), l_id);
         }
       } 
 
       // LOAD_MBASE
       if (nstr > 15) {
         if (!data->getValue(LOAD_MBASE,&rval,l_id)) {
-          data->addValue(LOAD_MBASE, atof(split_line[15].c_str()), l_id);
+          data->addValue(LOAD_MBASE, split_line[15].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_MBASE, atof(split_line[15].c_str()), l_id);
+          data->setValue(LOAD_MBASE, split_line[15].toDouble(), l_id);
         }
       } 
 
       // LOAD_PMULT
       if (nstr > 16) {
         if (!data->getValue(LOAD_PMULT,&rval,l_id)) {
-          data->addValue(LOAD_PMULT, atof(split_line[16].c_str()), l_id);
+          data->addValue(LOAD_PMULT, split_line[16].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_PMULT, atof(split_line[16].c_str()), l_id);
+          data->setValue(LOAD_PMULT, split_line[16].toDouble(), l_id);
         }
       } 
 
       // LOAD_H
       if (nstr > 17) {
         if (!data->getValue(LOAD_H,&rval,l_id)) {
-          data->addValue(LOAD_H, atof(split_line[17].c_str()), l_id);
+          data->addValue(LOAD_H, split_line[17].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_H, atof(split_line[17].c_str()), l_id);
+          data->setValue(LOAD_H, split_line[17].toDouble(), l_id);
         }
       }
 
       // LOAD_VI
       if (nstr > 18) {
         if (!data->getValue(LOAD_VI,&rval,l_id)) {
-          data->addValue(LOAD_VI, atof(split_line[18].c_str()), l_id);
+          data->addValue(LOAD_VI, split_line[18].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_VI, atof(split_line[18].c_str()), l_id);
+          data->setValue(LOAD_VI, split_line[18].toDouble(), l_id);
         }
       }
 
       // LOAD_TI
       if (nstr > 19) {
         if (!data->getValue(LOAD_TI,&rval,l_id)) {
-          data->addValue(LOAD_TI, atof(split_line[19].c_str()), l_id);
+          data->addValue(LOAD_TI, split_line[19].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TI, atof(split_line[19].c_str()), l_id);
+          data->setValue(LOAD_TI, split_line[19].toDouble(), l_id);
         }
       }
 
       // LOAD_TB
       if (nstr > 20) {
         if (!data->getValue(LOAD_TB,&rval,l_id)) {
-          data->addValue(LOAD_TB, atof(split_line[20].c_str()), l_id);
+          data->addValue(LOAD_TB, split_line[20].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TB, atof(split_line[20].c_str()), l_id);
+          data->setValue(LOAD_TB, split_line[20].toDouble(), l_id);
         }
       }
 
       // LOAD_A
       if (nstr > 21) {
         if (!data->getValue(LOAD_A,&rval,l_id)) {
-          data->addValue(LOAD_A, atof(split_line[21].c_str()), l_id);
+          data->addValue(LOAD_A, split_line[21].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_A, atof(split_line[21].c_str()), l_id);
+          data->setValue(LOAD_A, split_line[21].toDouble(), l_id);
         }
       }
 
       // LOAD_B
       if (nstr > 22) {
         if (!data->getValue(LOAD_B,&rval,l_id)) {
-          data->addValue(LOAD_B, atof(split_line[22].c_str()), l_id);
+          data->addValue(LOAD_B, split_line[22].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_B, atof(split_line[22].c_str()), l_id);
+          data->setValue(LOAD_B, split_line[22].toDouble(), l_id);
         }
       }
 
       // LOAD_D
       if (nstr > 23) {
         if (!data->getValue(LOAD_D,&rval,l_id)) {
-          data->addValue(LOAD_D, atof(split_line[23].c_str()), l_id);
+          data->addValue(LOAD_D, split_line[23].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_D, atof(split_line[23].c_str()), l_id);
+          data->setValue(LOAD_D, split_line[23].toDouble(), l_id);
         }
       }
 
       // LOAD_E
       if (nstr > 24) {
         if (!data->getValue(LOAD_E,&rval,l_id)) {
-          data->addValue(LOAD_E, atof(split_line[24].c_str()), l_id);
+          data->addValue(LOAD_E, split_line[24].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_E, atof(split_line[24].c_str()), l_id);
+          data->setValue(LOAD_E, split_line[24].toDouble(), l_id);
         }
       } 
 
       // LOAD_C0
       if (nstr > 25) {
         if (!data->getValue(LOAD_C0,&rval,l_id)) {
-          data->addValue(LOAD_C0, atof(split_line[25].c_str()), l_id);
+          data->addValue(LOAD_C0, split_line[25].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_C0, atof(split_line[25].c_str()), l_id);
+          data->setValue(LOAD_C0, split_line[25].toDouble(), l_id);
         }
       } 
 
       // LOAD_TNOM
       if (nstr > 26) {
         if (!data->getValue(LOAD_TNOM,&rval,l_id)) {
-          data->addValue(LOAD_TNOM, atof(split_line[26].c_str()), l_id);
+          data->addValue(LOAD_TNOM, split_line[26].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_TNOM, atof(split_line[26].c_str()), l_id);
+          data->setValue(LOAD_TNOM, split_line[26].toDouble(), l_id);
         }
       }
 	  
 	  // LOAD_DYN_PERC
       if (nstr > 27) {
         if (!data->getValue(LOAD_DYN_PERC,&rval,l_id)) {
-          data->addValue(LOAD_DYN_PERC, atof(split_line[27].c_str()), l_id);
+          data->addValue(LOAD_DYN_PERC, split_line[27].toDouble(), l_id);
         } else {
-          data->setValue(LOAD_DYN_PERC, atof(split_line[27].c_str()), l_id);
+          data->setValue(LOAD_DYN_PERC, split_line[27].toDouble(), l_id);
         }
       }
 	  
@@ -485,11 +486,11 @@ template <class _data_struct> class Cim6blParser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const std::vector<PSSEToken> &split_line,_data_struct &data)
     {
       std::string sval;
       gridpack::utility::StringUtils util;
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted().str();
       util.toUpper(sval);
 
       // LOAD_MODEL              "MODEL"                  integer
@@ -498,132 +499,132 @@ template <class _data_struct> class Cim6blParser
 
       // LOAD_ID
       if (nstr > 2) {
-        sval = util.clean2Char(split_line[2]);
+        sval = split_line[2].tag();
         strcpy(data.id, sval.c_str());
       }
 
       // LOAD_IT
       if (nstr > 3) {
-        data.it = atoi(split_line[3].c_str());
+        data.it = split_line[3].toInt();
       }
 
       // LOAD_RA
       if (nstr > 4) {
-        data.ra = atof(split_line[4].c_str());
+        data.ra = split_line[4].toDouble();
       }
       // LOAD_XA
       if (nstr > 5) {
-        data.xa = atof(split_line[5].c_str());
+        data.xa = split_line[5].toDouble();
       }
 
       // LOAD_XM
       if (nstr > 6) {
-        data.xm = atof(split_line[6].c_str());
+        data.xm = split_line[6].toDouble();
       }
 
       // LOAD_R1
       if (nstr > 7) {
-        data.r1 = atof(split_line[7].c_str());
+        data.r1 = split_line[7].toDouble();
       }
 
       // LOAD_X1
       if (nstr > 8) {
-        data.x1 = atof(split_line[8].c_str());
+        data.x1 = split_line[8].toDouble();
       }
 
       // LOAD_R2
       if (nstr > 9) {
-        data.r2 = atof(split_line[9].c_str());
+        data.r2 = split_line[9].toDouble();
       }
 
       // LOAD_X2
       if (nstr > 10) {
-        data.x2 = atof(split_line[10].c_str());
+        data.x2 = split_line[10].toDouble();
       }
 
       // LOAD_E1
       if (nstr > 11) {
-        data.e1 = atof(split_line[11].c_str());
+        data.e1 = split_line[11].toDouble();
       }
 
       // LOAD_SE1
       if (nstr > 12) {
-        data.se1 = atof(split_line[12].c_str());
+        data.se1 = split_line[12].toDouble();
       }
 
       // LOAD_E2
       if (nstr > 13) {
-        data.e2 = atof(split_line[13].c_str());
+        data.e2 = split_line[13].toDouble();
       }
 
       // LOAD_SE2
       if (nstr > 14) {
-        data.se2 = atof(split_line[14].c_str());
+        data.se2 = split_line[14].toDouble();
       }
 
       // LOAD_MBASE
       if (nstr > 15) {
-        data.mbase = atof(split_line[15].c_str());
+        data.mbase = split_line[15].toDouble();
       }
 
       // LOAD_PMULT
       if (nstr > 16) {
-        data.pmult = atof(split_line[16].c_str());
+        data.pmult = split_line[16].toDouble();
       }
 
       // LOAD_H
       if (nstr > 17) {
-        data.h = atof(split_line[17].c_str());
+        data.h = split_line[17].toDouble();
       }
 
       // LOAD_VI
       if (nstr > 18) {
-        data.vi = atof(split_line[18].c_str());
+        data.vi = split_line[18].toDouble();
       }
 
       // LOAD_TI
       if (nstr > 19) {
-        data.ti = atof(split_line[19].c_str());
+        data.ti = split_line[19].toDouble();
       }
 
       // LOAD_TB
       if (nstr > 20) {
-        data.tb = atof(split_line[20].c_str());
+        data.tb = split_line[20].toDouble();
       }
 
       // LOAD_A
       if (nstr > 21) {
-        data.a = atof(split_line[21].c_str());
+        data.a = split_line[21].toDouble();
       }
 
       // LOAD_B
       if (nstr > 22) {
-        data.b = atof(split_line[22].c_str());
+        data.b = split_line[22].toDouble();
       }
 
       // LOAD_D
       if (nstr > 23) {
-        data.d = atof(split_line[23].c_str());
+        data.d = split_line[23].toDouble();
       }
 
       // LOAD_E
       if (nstr > 24) {
-        data.e = atof(split_line[24].c_str());
+        data.e = split_line[24].toDouble();
       }
 
       // LOAD_C0
       if (nstr > 25) {
-        data.c0 = atof(split_line[25].c_str());
+        data.c0 = split_line[25].toDouble();
       }
 
       // LOAD_TNOM
       if (nstr > 26) {
-        data.tnom = atof(split_line[26].c_str());
+        data.tnom = split_line[26].toDouble();
       }
 	  
 	  // LOAD_DYN_PERC
       if (nstr > 27) {
-        data.dynload_perc = atof(split_line[27].c_str());
+        data.dynload_perc = split_line[27].toDouble();
       }
 	  
     }
@@ -11,6 +11,7 @@
 #define DISTR1_HPP
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
+#include "gridpack/parser/psse_tokenizer.hpp"
 #include "gridpack/utilities/string_utils.hpp"
 namespace gridpack {
 namespace parser {
@@ -326,7 +327,7 @@ template <class _data_struct> class Distr1Parser
      * @param model name of generator model
      * @param gen_id index of generator
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const std::vector<PSSEToken> &split_line,
         gridpack::component::DataCollection *data)
     {
       double rval;
@@ -345,7 +346,7 @@ template <class _data_struct> class Distr1Parser
       // RELAY_MODEL
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted().str();
       util.toUpper(model);
       if (!data->getValue(RELAY_MODEL,&stmp,r_id)) {
         data->addValue(RELAY_MODEL, model.c_str(), r_id);
@@ -355,7 +356,7 @@ template <class _data_struct> class Distr1Parser
 
       // RELAY_ID
       if (nstr > 3) {
-        model = util.clean2Char(split_line[3]);
+        model = split_line[3].tag();
         if (!data->getValue(RELAY_ID,&stmp,r_id)) {
           data->addValue(RELAY_ID, model.c_str(), r_id);
         } else {
@@ -366,51 +367,51 @@ template <class _data_struct> class Distr1Parser
       // RELAY_RS
       if (nstr > 4) {
         if (!data->getValue(RELAY_RS,&ival,r_id)) {
-          data->addValue(RELAY_RS, atoi(split_line[4].c_str()), r_id);
+          data->addValue(RELAY_RS, split_line[4].toInt(), r_id);
         } else {
-          data->setValue(RELAY_RS, atoi(split_line[4].c_str()), r_id);
+          data->setValue(RELAY_RS, split_line[4].toInt(), r_id);
         }
       }
 
       // RELAY_MTYPE
       if (nstr > 5) {
         if (!data->getValue(RELAY_MTYPE,&ival,r_id)) {
-          data->addValue(RELAY_MTYPE, atoi(split_line[5].c_str()), r_id);
+          data->addValue(RELAY_MTYPE, split_line[5].toInt(), r_id);
         } else {
-          data->setValue(RELAY_MTYPE, atoi(split_line[5].c_str()), r_id);
+          data->setValue(RELAY_MTYPE, split_line[5].toInt(), r_id);
         }
       }
 
       // RELAY_BMON
       if (nstr > 6) {
         if (!data->getValue(RELAY_BMON,&ival,r_id)) {
-          data->addValue(RELAY_BMON, atoi(split_line[6].c_str()), r_id);
+          data->addValue(RELAY_BMON, split_line[6].toInt(), r_id);
         } else {
-          data->setValue(RELAY_BMON, atoi(split_line[6].c_str()), r_id);
+          data->setValue(RELAY_BMON, split_line[6].toInt(), r_id);
         }
       }
 
       // RELAY_IBUS1
       if (nstr > 7) {
         if (!data->getValue(RELAY_IBUS1,&ival,r_id)) {
-          data->addValue(RELAY_IBUS1, atoi(split_line[7].c_str()), r_id);
+          data->addValue(RELAY_IBUS1, split_line[7].toInt(), r_id);
         } else {
-          data->setValue(RELAY_IBUS1, atoi(split_line[7].c_str()), r_id);
+          data->setValue(RELAY_IBUS1, split_line[7].toInt(), r_id);
         }
       }
 
       // RELAY_JBUS1
       if (nstr > 8) {
         if (!data->getValue(RELAY_JBUS1,&ival,r_id)) {
-          data->addValue(RELAY_JBUS1, atoi(split_line[8].c_str()), r_id);
+          data->addValue(RELAY_JBUS1, split_line[8].toInt(), r_id);
         } else {
-          data->setValue(RELAY_JBUS1, atoi(split_line[8].c_str()), r_id);
+          data->setValue(RELAY_JBUS1, split_line[8].toInt(), r_id);
         }
       }
 
       // RELAY_ID1
       if (nstr > 9) {
-        model = util.clean2Char(split_line[9]);
+        model = split_line[9].tag();
         if (!data->getValue(RELAY_ID1,&stmp,r_id)) {
           data->addValue(RELAY_ID1, model.c_str(), r_id);
         } else {
@@ -421,24 +422,24 @@ template <class _data_struct> class Distr1Parser
       // RELAY_IBUS2
       if (nstr > 10) {
         if (!data->getValue(RELAY_IBUS2,&ival,r_id)) {
-          data->addValue(RELAY_IBUS2, atoi(split_line[10].c_str()), r_id);
+          data->addValue(RELAY_IBUS2, split_line[10].toInt(), r_id);
         } else {
-          data->setValue(RELAY_IBUS2, atoi(split_line[10].c_str()), r_id);
+          data->setValue(RELAY_IBUS2, split_line[10].toInt(), r_id);
         }
       }
 
       // RELAY_JBUS2
       if (nstr > 11) {
         if (!data->getValue(RELAY_JBUS2,&ival,r_id)) {
-          data->addValue(RELAY_JBUS2, atoi(split_line[11].c_str()), r_id);
+          data->addValue(RELAY_JBUS2, split_line[11].toInt(), r_id);
         } else {
-          data->setValue(RELAY_JBUS2, atoi(split_line[11].c_str()), r_id);
+          data->setValue(RELAY_JBUS2, split_line[11].toInt(), r_id);
         }
       }
 
       // RELAY_ID2
       if (nstr > 12) {
-        model = util.clean2Char(split_line[12]);
+        model = split_line[12].tag();
         if (!data->getValue(RELAY_ID2,&stmp,r_id)) {
           data->addValue(RELAY_ID2, model.c_str(), r_id);
         } else {
@@ -449,24 +450,24 @@ template <class _data_struct> class Distr1Parser
       // RELAY_IBUS3
       if (nstr > 13) {
         if (!data->getValue(RELAY_IBUS3,&ival,r_id)) {
-          data->addValue(RELAY_IBUS3, atoi(split_line[13].c_str()), r_id);
+          data->addValue(RELAY_IBUS3, split_line[13].toInt(), r_id);
         } else {
-          data->setValue(RELAY_IBUS3, atoi(split_line[13].c_str()), r_id);
+          data->setValue(RELAY_IBUS3, split_line[13].toInt(), r_id);
         }
       }
 
       // RELAY_JBUS3
       if (nstr > 14) {
         if (!data->getValue(RELAY_JBUS3,&ival,r_id)) {
-          data->addValue(RELAY_JBUS3, atoi(split_line[14].c_str()), r_id);
+          data->addValue(RELAY_JBUS3, split_line[14].toInt(), r_id);
         } else {
-          data->setValue(RELAY_JBUS3, atoi(split_line[14].c_str()), r_id);
+          data->setValue(RELAY_JBUS3, split_line[14].toInt(), r_id);
         }
       }
 
       // RELAY_ID3
       if (nstr > 15) {
-        model = util.clean2Char(split_line[15]);
+        model = split_line[15].tag();
         if (!data->getValue(RELAY_ID3,&stmp,r_id)) {
           data->addValue(RELAY_ID3, model.c_str(), r_id);
         } else {
@@ -477,216 +478,216 @@ template <class _data_struct> class Distr1Parser
       // RELAY_ZONE1_TIME
       if (nstr > 16) {
         if (!data->getValue(RELAY_ZONE1_TIME,&rval,r_id)) {
-          data->addValue(RELAY_ZONE1_TIME, atof(split_line[16].c_str()), r_id);
+          data->addValue(RELAY_ZONE1_TIME, split_line[16].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_ZONE1_TIME, atof(split_line[16].c_str()), r_id);
+          data->setValue(RELAY_ZONE1_TIME, split_line[16].toDouble(), r_id);
         }
       } 
 
       // RELAY_ZONE1_REACH
       if (nstr > 17) {
         if (!data->getValue(RELAY_ZONE1_REACH,&rval,r_id)) {
-          data->addValue(RELAY_ZONE1_REACH, atof(split_line[17].c_str()), r_id);
+          data->addValue(RELAY_ZONE1_REACH, split_line[17].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_ZONE1_REACH, atof(split_line[17].c_str()), r_id);
+          data->setValue(RELAY_ZONE1_REACH, split_line[17].toDouble(), r_id);
         }
       } 
 
       // RELAY_ZONE1_CENANG
       if (nstr > 18) {
         if (!data->getValue(RELAY_ZONE1_CENANG,&rval,r_id)) {
-          data->addValue(RELAY_ZONE1_CENANG, atof(split_line[18].c_str()), r_id);
+          data->addValue(RELAY_ZONE1_CENANG, split_line[18].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_ZONE1_CENANG, atof(split_line[18].c_str()), r_id);
+          data->setValue(RELAY_ZONE1_CENANG, split_line[18].toDouble(), r_id);
         }
       } 
 
       // RELAY_ZONE1_CENDIS
       if (nstr > 19) {
         if (!data->getValue(RELAY_ZONE1_CENDIS,&rval,r_id)) {
-          data->addValue(RELAY_ZONE1_CENDIS, atof(split_line[19].c_str()), r_id);
+          data->addValue(RELAY_ZONE1_CENDIS, split_line[19].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_ZONE1_CENDIS, atof(split_line[19].c_str()), r_id);
+          data->setValue(RELAY_ZONE1_CENDIS, split_line[19].toDouble(), r_id);
         }
       } 
 
       // RELAY_ZONE2_TIME
       if (nstr > 20) {
         if (!data->getValue(RELAY_ZONE2_TIME,&rval,r_id)) {
-          data->addValue(RELAY_ZONE2_TIME, atof(split_line[20].c_str()), r_id);
+          data->addValue(RELAY_ZONE2_TIME, split_line[20].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_ZONE2_TIME, atof(split_line[20].c_str()), r_id);
+          data->setValue(RELAY_ZONE2_TIME, split_line[20].toDouble(), r_id);
         }
       } 
 
       // RELAY_ZONE2_REACH
       if (nstr > 21) {
         if (!data->getValue(RELAY_ZONE2_REACH,&rval,r_id)) {
-          data->addValue(RELAY_ZONE2_REACH, atof(split_line[21].c_str()), r_id);
+          data->addValue(RELAY_ZONE2_REACH, split_line[21].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_ZONE2_REACH, atof(split_line[21].c_str()), r_id);
+          data->setValue(RELAY_ZONE2_REACH, split_line[21].toDouble(), r_id);
         }
       } 
 
       // RELAY_ZONE2_CENANG
       if (nstr > 22) {
         if (!data->getValue(RELAY_ZONE2_CENANG,&rval,r_id)) {
-          data->addValue(RELAY_ZONE2_CENANG, atof(split_line[22].c_str()), r_id);
+          data->addValue(RELAY_ZONE2_CENANG, split_line[22].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_ZONE2_CENANG, atof(split_line[22].c_str()), r_id);
+          data->setValue(RELAY_ZONE2_CENANG, split_line[22].toDouble(), r_id);
         }
       } 
 
       // RELAY_ZONE2_CENDIS
       if (nstr > 23) {
         if (!data->getValue(RELAY_ZONE2_CENDIS,&rval,r_id)) {
-          data->addValue(RELAY_ZONE2_CENDIS, atof(split_line[23].c_str()), r_id);
+          data->addValue(RELAY_ZONE2_CENDIS, split_line[23].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_ZONE2_CENDIS, atof(split_line[23].c_str()), r_id);
+          data->setValue(RELAY_ZONE2_CENDIS, split_line[23].toDouble(), r_id);
         }
       } 
 
       // RELAY_ZONE3_TIME
       if (nstr > 24) {
         if (!data->getValue(RELAY_ZONE3_TIME,&rval,r_id)) {
-          data->addValue(RELAY_ZONE3_TIME, atof(split_line[24].c_str()), r_id);
+          data->addValue(RELAY_ZONE3_TIME, split_line[24].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_ZONE3_TIME, atof(split_line[24].c_str()), r_id);
+          data->setValue(RELAY_ZONE3_TIME, split_line[24].toDouble(), r_id);
         }
       } 
 
       // RELAY_ZONE3_REACH
       if (nstr > 25) {
         if (!data->getValue(RELAY_ZONE3_REACH,&rval,r_id)) {
-          data->addValue(RELAY_ZONE3_REACH, atof(split_line[25].c_str()), r_id);
+          data->addValue(RELAY_ZONE3_REACH, split_line[25].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_ZONE3_REACH, atof(split_line[25].c_str()), r_id);
+          data->setValue(RELAY_ZONE3_REACH, split_line[25].toDouble(), r_id);
         }
       } 
 
       // RELAY_ZONE3_CENANG
       if (nstr > 26) {
         if (!data->getValue(RELAY_ZONE3_CENANG,&rval,r_id)) {
-          data->addValue(RELAY_ZONE3_CENANG, atof(split_line[26].c_str()), r_id);
+          data->addValue(RELAY_ZONE3_CENANG, split_line[26].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_ZONE3_CENANG, atof(split_line[26].c_str()), r_id);
+          data->setValue(RELAY_ZONE3_CENANG, split_line[26].toDouble(), r_id);
         }
       } 
 
       // RELAY_ZONE3_CENDIS
       if (nstr > 27) {
         if (!data->getValue(RELAY_ZONE3_CENDIS,&rval,r_id)) {
-          data->addValue(RELAY_ZONE3_CENDIS, atof(split_line[27].c_str()), r_id);
+          data->addValue(RELAY_ZONE3_CENDIS, split_line[27].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_ZONE3_CENDIS, atof(split_line[27].c_str()), r_id);
+          data->setValue(RELAY_ZONE3_CENDIS, split_line[27].toDouble(), r_id);
         }
       } 
 
       // RELAY_DIRANG
       if (nstr > 28) {
         if (!data->getValue(RELAY_DIRANG,&rval,r_id)) {
-          data->addValue(RELAY_DIRANG, atof(split_line[28].c_str()), r_id);
+          data->addValue(RELAY_DIRANG, split_line[28].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_DIRANG, atof(split_line[28].c_str()), r_id);
+          data->setValue(RELAY_DIRANG, split_line[28].toDouble(), r_id);
         }
       }
 
       // RELAY_THCUR
       if (nstr > 29) {
         if (!data->getValue(RELAY_THCUR,&rval,r_id)) {
-          data->addValue(RELAY_THCUR, atof(split_line[29].c_str()), r_id);
+          data->addValue(RELAY_THCUR, split_line[29].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_THCUR, atof(split_line[29].c_str()), r_id);
+          data->setValue(RELAY_THCUR, split_line[29].toDouble(), r_id);
         }
       }
 
       // RELAY_SEBTIME
       if (nstr > 30) {
         if (!data->getValue(RELAY_SEBTIME,&rval,r_id)) {
-          data->addValue(RELAY_SEBTIME, atof(split_line[30].c_str()), r_id);
+          data->addValue(RELAY_SEBTIME, split_line[30].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_SEBTIME, atof(split_line[30].c_str()), r_id);
+          data->setValue(RELAY_SEBTIME, split_line[30].toDouble(), r_id);
         }
       }
 
       // RELAY_SERCTIME
       if (nstr > 31) {
         if (!data->getValue(RELAY_SERCTIME,&rval,r_id)) {
-          data->addValue(RELAY_SERCTIME, atof(split_line[31].c_str()), r_id);
+          data->addValue(RELAY_SERCTIME, split_line[31].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_SERCTIME, atof(split_line[31].c_str()), r_id);
+          data->setValue(RELAY_SERCTIME, split_line[31].toDouble(), r_id);
         }
       }
 
       // RELAY_TRBTIME
       if (nstr > 32) {
         if (!data->getValue(RELAY_TRBTIME,&rval,r_id)) {
-          data->addValue(RELAY_TRBTIME, atof(split_line[32].c_str()), r_id);
+          data->addValue(RELAY_TRBTIME, split_line[32].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_TRBTIME, atof(split_line[32].c_str()), r_id);
+          data->setValue(RELAY_TRBTIME, split_line[32].toDouble(), r_id);
         }
       }
 
       // RELAY_TRRCTIME
       if (nstr > 33) {
         if (!data->getValue(RELAY_TRRCTIME,&rval,r_id)) {
-          data->addValue(RELAY_TRRCTIME, atof(split_line[33].c_str()), r_id);
+          data->addValue(RELAY_TRRCTIME, split_line[33].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_TRRCTIME, atof(split_line[33].c_str()), r_id);
+          data->setValue(RELAY_TRRCTIME, split_line[33].toDouble(), r_id);
         }
       }
 
       // RELAY_BLTYPE1
       if (nstr > 34) {
         if (!data->getValue(RELAY_BLTYPE1,&ival,r_id)) {
-          data->addValue(RELAY_BLTYPE1, atoi(split_line[34].c_str()), r_id);
+          data->addValue(RELAY_BLTYPE1, split_line[34].toInt(), r_id);
         } else {
-          data->setValue(RELAY_BLTYPE1, atoi(split_line[34].c_str()), r_id);
+          data->setValue(RELAY_BLTYPE1, split_line[34].toInt(), r_id);
         }
       }
 
       // RELAY_BLINT1
       if (nstr > 35) {
         if (!data->getValue(RELAY_BLINT1,&rval,r_id)) {
-          data->addValue(RELAY_BLINT1, atof(split_line[35].c_str()), r_id);
+          data->addValue(RELAY_BLINT1, split_line[35].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_BLINT1, atof(split_line[35].c_str()), r_id);
+          data->setValue(RELAY_BLINT1, split_line[35].toDouble(), r_id);
         }
       } 
 
       // RELAY_BLRO1
       if (nstr > 36) {
         if (!data->getValue(RELAY_BLRO1,&rval,r_id)) {
-          data->addValue(RELAY_BLRO1, atof(split_line[36].c_str()), r_id);
+          data->addValue(RELAY_BLRO1, split_line[36].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_BLRO1, atof(split_line[36].c_str()), r_id);
+          data->setValue(RELAY_BLRO1, split_line[36].toDouble(), r_id);
         }
       } 
 
       // RELAY_BLTYPE2
       if (nstr > 37) {
         if (!data->getValue(RELAY_BLTYPE2,&ival,r_id)) {
-          data->addValue(RELAY_BLTYPE2, atoi(split_line[37].c_str()), r_id);
+          data->addValue(RELAY_BLTYPE2, split_line[37].toInt(), r_id);
         } else {
-          data->setValue(RELAY_BLTYPE2, atoi(split_line[37].c_str()), r_id);
+          data->setValue(RELAY_BLTYPE2, split_line[37].toInt(), r_id);
         }
       }
 
       // RELAY_BLINT2
       if (nstr > 38) {
         if (!data->getValue(RELAY_BLINT2,&rval,r_id)) {
-          data->addValue(RELAY_BLINT2, atof(split_line[38].c_str()), r_id);
+          data->addValue(RELAY_BLINT2, split_line[38].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_BLINT2, atof(split_line[38].c_str()), r_id);
+          data->setValue(RELAY_BLINT2, split_line[38].toDouble(), r_id);
         }
       } 
 
       // RELAY_BLRO2
       if (nstr > 39) {
         if (!data->getValue(RELAY_BLRO2,&rval,r_id)) {
-          data->addValue(RELAY_BLRO2, atof(split_line[39].c_str()), r_id);
+          data->addValue(RELAY_BLRO2, split_line[39].toDouble(), r_id);
         } else {
-          data->setValue(RELAY_BLRO2, atof(split_line[39].c_str()), r_id);
+          data->setValue(RELAY_BLRO2, split_line[39].toDouble(), r_id);
         }
       } 
     }
@@ -696,18 +697,18 @@ template <class _data_struct> class Distr1Parser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const std::vector<PSSEToken> &split_line,_data_struct &data)
     {
       // RELAY_FROM_BUS
       int from_idx, to_idx;
-      from_idx = atoi(split_line[0].c_str());
+      from_idx = split_line[0].toInt();
       data.from_bus = from_idx;
-      to_idx = atoi(split_line[2].c_str());
+      to_idx = split_line[2].toInt();
       data.to_bus = to_idx;
 
       std::string sval;
       gridpack::utility::StringUtils util;
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted().str();
       util.toUpper(sval);
 
       // RELAY_MODEL              "MODEL"                  integer
@@ -716,191 +717,191 @@ template <class _data_struct> class Distr1Parser
 
       // RELAY_ID
       if (nstr > 3) {
-        sval = util.clean2Char(split_line[3]);
+        sval = split_line[3].tag();
         strcpy(data.id, sval.c_str());
       }
 
       // RELAY_RS
       if (nstr > 4) {
-        data.rs = atoi(split_line[4].c_str());
+        data.rs = split_line[4].toInt();
       }
 
       // RELAY_MTYPE
       if (nstr > 5) {
-        data.mtype = atoi(split_line[5].c_str());
+        data.mtype = split_line[5].toInt();
       }
 
       // RELAY_BMON
       if (nstr > 6) {
-        data.bmon = atoi(split_line[6].c_str());
+        data.bmon = split_line[6].toInt();
       }
 
       // RELAY_IBUS1
       if (nstr > 7) {
-        data.ibus1 = atoi(split_line[7].c_str());
+        data.ibus1 = split_line[7].toInt();
       }
 
       // RELAY_JBUS1
       if (nstr > 8) {
-        data.jbus1 = atoi(split_line[8].c_str());
+        data.jbus1 = split_line[8].toInt();
       }
 
       // RELAY_ID1
       if (nstr > 9) {
-        sval = util.clean2Char(split_line[9]);
+        sval = split_line[9].tag();
         strcpy(data.id1, sval.c_str());
       }
 
       // RELAY_IBUS2
       if (nstr > 10) {
-        data.ibus2 = atoi(split_line[10].c_str());
+        data.ibus2 = split_line[10].toInt();
       }
 
       // RELAY_JBUS2
       if (nstr > 11) {
-        data.jbus2 = atoi(split_line[11].c_str());
+        data.jbus2 = split_line[11].toInt();
       }
 
       // RELAY_ID2
       if (nstr > 12) {
-        sval = util.clean2Char(split_line[12]);
+        sval = split_line[12].tag();
         strcpy(data.id2, sval.c_str());
       }
 
       // RELAY_IBUS3
       if (nstr > 13) {
-        data.ibus3 = atoi(split_line[13].c_str());
+        data.ibus3 = split_line[13].toInt();
       }
 
       // RELAY_JBUS3
       if (nstr > 14) {
-        data.jbus3 = atoi(split_line[14].c_str());
+        data.jbus3 = split_line[14].toInt();
       }
 
       // RELAY_ID3
       if (nstr > 15) {
-        sval = util.clean2Char(split_line[15]);
+        sval = split_line[15].tag();
         strcpy(data.id3, sval.c_str());
       }
 
       // RELAY_ZONE1_TIME
       if (nstr > 16) {
-        data.zone1_time = atof(split_line[16].c_str());
+        data.zone1_time = split_line[16].toDouble();
       }
 
       // RELAY_ZONE1_REACH
       if (nstr > 17) {
-        data.zone1_reach = atof(split_line[17].c_str());
+        data.zone1_reach = split_line[17].toDouble();
       }
 
       // RELAY_ZONE1_CENANG
       if (nstr > 18) {
-        data.zone1_cenang = atof(split_line[18].c_str());
+        data.zone1_cenang = split_line[18].toDouble();
       }
 
       // RELAY_ZONE1_CENDIS
       if (nstr > 19) {
-        data.zone1_cendis = atof(split_line[19].c_str());
+        data.zone1_cendis = split_line[19].toDouble();
       }
 
       // RELAY_ZONE2_TIME
       if (nstr > 20) {
-        data.zone2_time = atof(split_line[20].c_str());
+        data.zone2_time = split_line[20].toDouble();
       }
 
       // RELAY_ZONE2_REACH
       if (nstr > 21) {
-        data.zone2_reach = atof(split_line[21].c_str());
+        data.zone2_reach = split_line[21].toDouble();
       }
 
       // RELAY_ZONE2_CENANG
       if (nstr > 22) {
-        data.zone2_cenang = atof(split_line[22].c_str());
+        data.zone2_cenang = split_line[22].toDouble();
       }
 
       // RELAY_ZONE2_CENDIS
       if (nstr > 23) {
-        data.zone2_cendis = atof(split_line[23].c_str());
+        data.zone2_cendis = split_line[23].toDouble();
       }
 
       // RELAY_ZONE3_TIME
       if (nstr > 24) {
-        data.zone3_time = atof(split_line[24].c_str());
+        data.zone3_time = split_line[24].toDouble();
       }
 
       // RELAY_ZONE3_REACH
       if (nstr > 25) {
-        data.zone3_reach = atof(split_line[25].c_str());
+        data.zone3_reach = split_line[25].toDouble();
       }
 
       // RELAY_ZONE3_CENANG
       if (nstr > 26) {
-        data.zone3_cenang = atof(split_line[26].c_str());
+        data.zone3_cenang = split_line[26].toDouble();
       }
 
       // RELAY_ZONE3_CENDIS
       if (nstr > 27) {
-        data.zone3_cendis = atof(split_line[27].c_str());
+        data.zone3_cendis = split_line[27].toDouble();
       }
 
       // RELAY_DIRANG
       if (nstr > 28) {
-        data.dirang = atof(split_line[28].c_str());
+        data.dirang = split_line[28].toDouble();
       }
 
       // RELAY_THCUR
       if (nstr > 29) {
-        data.thcur = atof(split_line[29].c_str());
+        data.thcur = split_line[29].toDouble();
       }
 
       // RELAY_SEBTIME
       if (nstr > 30) {
-        data.sebtime = atof(split_line[30].c_str());
+        data.sebtime = split_line[30].toDouble();
       }
 
       // RELAY_SERCTIME
       if (nstr > 31) {
-        data.serctime = atof(split_line[31].c_str());
+        data.serctime = split_line[31].toDouble();
       }
 
       // RELAY_TRBTIME
       if (nstr > 32) {
-        data.trbtime = atof(split_line[32].c_str());
+        data.trbtime = split_line[32].toDouble();
       }
 
       // RELAY_TRRCTIME
       if (nstr > 33) {
-        data.trrctime = atof(split_line[33].c_str());
+        data.trrctime = split_line[33].toDouble();
       }
 
       // RELAY_BLTYPE1
       if (nstr > 34) {
-        data.bltype1 = atoi(split_line[34].c_str());
+        data.bltype1 = split_line[34].toInt();
       }
 
       // RELAY_BLINT1
       if (nstr > 35) {
-        data.blint1 = atof(split_line[35].c_str());
+        data.blint1 = split_line[35].toDouble();
       }
 
       // RELAY_BLRO1
       if (nstr > 36) {
-        data.blro1 = atof(split_line[36].c_str());
+        data.blro1 = split_line[36].toDouble();
       }
 
       // RELAY_BLTYPE2
       if (nstr > 37) {
-        data.bltype2 = atoi(split_line[37].c_str());
+        data.bltype2 = split_line[37].toInt();
       }
 
       // RELAY_BLINT2
       if (nstr > 38) {
-        data.blint2 = atof(split_line[38].c_str());
+        data.blint2 = split_line[38].toDouble();
       }
 
       // RELAY_BLRO2
       if (nstr > 39) {
-        data.blro2 = atof(split_line[39].c_str());
+        data.blro2 = split_line[39].toDouble();
       }
     }
 };
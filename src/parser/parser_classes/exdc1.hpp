@@ -11,6 +11,7 @@
 #define EXDC1_HPP
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
+#include "gridpack/parser/psse_tokenizer.hpp"
 #include "gridpack/utilities/string_utils.hpp"
 namespace gridpack {
 namespace parser {
@@ -176,7 +177,7 @@ template <class _data_struct> class Exdc1Parser
      * @param data data collection object
      * @param gen_id index of generator
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const std::vector<PSSEToken> &split_line,
         gridpack::component::DataCollection *data, int g_id)
     {
       double rval;
@@ -192,7 +193,7 @@ template <class _data_struct> class Exdc1Parser
       // EXCITER_MODEL
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted().str();
       util.toUpper(model);
       if (!data->getValue(EXCITER_MODEL,&stmp,g_id)) {
         data->addValue(EXCITER_MODEL, model.c_str(), g_id);
@@ -204,10 +205,10 @@ template <class _data_struct> class Exdc1Parser
       if (nstr > 3) {
         if (!data->getValue(EXCITER_TR,&rval,g_id)) {
           data->addValue(EXCITER_TR,
-              atof(split_line[3].c_str()), g_id);
+              split_line[3].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_TR,
-              atof(split_line[3].c_str()), g_id);
+              split_line[3].toDouble(), g_id);
         }
       } 
 
@@ -215,10 +216,10 @@ template <class _data_struct> class Exdc1Parser
       if (nstr > 4) {
         if (!data->getValue(EXCITER_KA,&rval,g_id)) {
           data->addValue(EXCITER_KA,
-              atof(split_line[4].c_str()), g_id);
+              split_line[4].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_KA,
-              atof(split_line[4].c_str()), g_id);
+              split_line[4].toDouble(), g_id);
         }
       } 
 
@@ -226,10 +227,10 @@ template <class _data_struct> class Exdc1Parser
       if (nstr > 5) {
         if (!data->getValue(EXCITER_TA,&rval,g_id)) {
           data->addValue(EXCITER_TA,
-              atof(split_line[5].c_str()), g_id);
+              split_line[5].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_TA,
-              atof(split_line[5].c_str()), g_id);
+              split_line[5].toDouble(), g_id);
         }
       }
 
@@ -237,10 +238,10 @@ template <class _data_struct> class Exdc1Parser
       if (nstr > 6) {
         if (!data->getValue(EXCITER_TB,&rval,g_id)) {
           data->addValue(EXCITER_TB,
-              atof(split_line[6].c_str()), g_id);
+              split_line[6].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_TB,
-              atof(split_line[6].c_str()), g_id);
+              split_line[6].toDouble(), g_id);
         }
       }
 
@@ -248,10 +249,10 @@ template <class _data_struct> class Exdc1Parser
       if (nstr > 7) {
         if (!data->getValue(EXCITER_TC,&rval,g_id)) {
           data->addValue(EXCITER_TC,
-              atof(split_line[7].c_str()), g_id);
+              split_line[7].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_TC,
-              atof(split_line[7].c_str()), g_id);
+              split_line[7].toDouble(), g_id);
         }
       }
 
@@ -259,10 +260,10 @@ template <class _data_struct> class Exdc1Parser
       if (nstr > 8) {
         if (!data->getValue(EXCITER_VRMAX,&rval,g_id)) {
           data->addValue(EXCITER_VRMAX,
-              atof(split_line[8].c_str()), g_id);
+              split_line[8].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_VRMAX,
-              atof(split_line[8].c_str()), g_id);
+              split_line[8].toDouble(), g_id);
         }
       } 
 
@@ -270,10 +271,10 @@ template <class _data_struct> class Exdc1Parser
       if (nstr > 9) {
         if (!data->getValue(EXCITER_VRMIN,&rval,g_id)) {
           data->addValue(EXCITER_VRMIN,
-              atof(split_line[9].c_str()), g_id);
+              split_line[9].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_VRMIN,
-              atof(split_line[9].c_str()), g_id);
+              split_line[9].toDouble(), g_id);
         }
       } 
 
@@ -281,10 +282,10 @@ template <class _data_struct> class Exdc1Parser
       if (nstr > 10) {
         if (!data->getValue(EXCITER_KE,&rval,g_id)) {
           data->addValue(EXCITER_KE,
-              atof(split_line[10].c_str()), g_id);
+              split_line[10].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_KE,
-              atof(split_line[10].c_str()), g_id);
+              split_line[10].toDouble(), g_id);
         }
       } 
 
@@ -292,10 +293,10 @@ template <class _data_struct> class Exdc1Parser
       if (nstr > 11) {
         if (!data->getValue(EXCITER_TE,&rval,g_id)) {
           data->addValue(EXCITER_TE,
-              atof(split_line[11].c_str()), g_id);
+              split_line[11].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_TE,
-              atof(split_line[11].c_str()), g_id);
+              split_line[11].toDouble(), g_id);
         }
       } 
 
@@ -303,10 +304,10 @@ template <class _data_struct> class Exdc1Parser
       if (nstr > 12) {
         if (!data->getValue(EXCITER_KF,&rval,g_id)) {
           data->addValue(EXCITER_KF,
-              atof(split_line[12].c_str()), g_id);
+              split_line[12].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_KF,
-              atof(split_line[12].c_str()), g_id);
+              split_line[12].toDouble(), g_id);
         }
       } 
 
@@ -314,10 +315,10 @@ template <class _data_struct> class Exdc1Parser
       if (nstr > 13) {
         if (!data->getValue(EXCITER_TF1,&rval,g_id)) {
           data->addValue(EXCITER_TF1,
-              atof(split_line[13].c_str()), g_id);
+              split_line[13].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_TF1,
-              atof(split_line[13].c_str()), g_id);
+              split_line[13].toDouble(), g_id);
         }
       } 
 
@@ -325,10 +326,10 @@ template <class _data_struct> class Exdc1Parser
       if (nstr > 14) {
         if (!data->getValue(EXCITER_SWITCH,&rval,g_id)) {
           data->addValue(EXCITER_SWITCH,
-              atof(split_line[14].c_str()), g_id);
+              split_line[14].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_SWITCH,
-              atof(split_line[14].c_str()), g_id);
+              split_line[14].toDouble(), g_id);
         }
       } 
 
@@ -336,10 +337,10 @@ template <class _data_struct> class Exdc1Parser
       if (nstr > 15) {
         if (!data->getValue(EXCITER_E1,&rval,g_id)) {
           data->addValue(EXCITER_E1,
-              atof(split_line[15].c_str()), g_id);
+              split_line[15].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_E1,
-              atof(split_line[15].c_str()), g_id);
+              split_line[15].toDouble(), g_id);
         }
       } 
 
@@ -347,10 +348,10 @@ template <class _data_struct> class Exdc1Parser
       if (nstr > 16) {
         if (!data->getValue(EXCITER_SE1,&rval,g_id)) {
           data->addValue(EXCITER_SE1,
-              atof(split_line[16].c_str()), g_id);
+              split_line[16].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_SE1,
-              atof(split_line[16].c_str()), g_id);
+              split_line[16].toDouble(), g_id);
         }
       } 
 
@@ -358,10 +359,10 @@ template <class _data_struct> class Exdc1Parser
       if (nstr > 17) {
         if (!data->getValue(EXCITER_E2,&rval,g_id)) {
           data->addValue(EXCITER_E2,
-              atof(split_line[17].c_str()), g_id);
+              split_line[17].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_E2,
-              atof(split_line[17].c_str()), g_id);
+              split_line[17].toDouble(), g_id);
         }
       } 
 
@@ -369,10 +370,10 @@ template <class _data_struct> class Exdc1Parser
       if (nstr > 18) {
         if (!data->getValue(EXCITER_SE2,&rval,g_id)) {
           data->addValue(EXCITER_SE2,
-              atof(split_line[18].c_str()), g_id);
+              split_line[18].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_SE2,
-              atof(split_line[18].c_str()), g_id);
+              split_line[18].toDouble(), g_id);
         }
       } 
     }
@@ -382,23 +383,23 @@ template <class _data_struct> class Exdc1Parser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const std::vector<PSSEToken> &split_line,_data_struct &data)
     {
       // EXCITER_BUSNUMBER               "I"                   integer
       int o_idx;
-      o_idx = atoi(split_line[0].c_str());
+      o_idx = split_line[0].toInt();
       data.bus_id = o_idx;
 
       // Clean up 2 character tag for generator ID
       gridpack::utility::StringUtils util;
-      std::string tag = util.clean2Char(split_line[2]);
+      std::string tag = split_line[2].tag();
       strcpy(data.gen_id, tag.c_str());
 
       std::string sval;
       double rval;
       int ival;
 
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted().str();
       util.toUpper(sval);
 
       // EXCITER_MODEL              "MODEL"                  integer
@@ -407,82 +408,82 @@ template <class _data_struct> class Exdc1Parser
       int nstr = split_line.size();
       // EXCITER_TR
       if (nstr > 3) {
-        data.ex_tr = atof(split_line[3].c_str());
+        data.ex_tr = split_line[3].toDouble();
       }
 
       // EXCITER_KA
       if (nstr > 4) {
-        data.ex_ka = atof(split_line[4].c_str());
+        data.ex_ka = split_line[4].toDouble();
       }
 
       // EXCITER_TA
       if (nstr > 5) {
-        data.ex_ta = atof(split_line[5].c_str());
+        data.ex_ta = split_line[5].toDouble();
       }
 
       // EXCITER_TB
       if (nstr > 6) {
-        data.ex_tb = atof(split_line[6].c_str());
+        data.ex_tb = split_line[6].toDouble();
       }
 
       // EXCITER_TC
       if (nstr > 7) {
-        data.ex_tc = atof(split_line[7].c_str());
+        data.ex_tc = split_line[7].toDouble();
       }
 
       // EXCITER_VRMAX
       if (nstr > 8) {
-        data.vrmax = atof(split_line[8].c_str());
+        data.vrmax = split_line[8].toDouble();
       }
 
       // EXCITER_VRMIN
       if (nstr > 9) {
-        data.vrmin = atof(split_line[9].c_str());
+        data.vrmin = split_line[9].toDouble();
       }
 
       // EXCITER_KE
       if (nstr > 10) {
-        data.ex_ke = atof(split_line[10].c_str());
+        data.ex_ke = split_line[10].toDouble();
       }
 
       // EXCITER_TE
       if (nstr > 11) {
-        data.ex_te = atof(split_line[11].c_str());
+        data.ex_te = split_line[11].toDouble();
       }
 
       // EXCITER_KF
       if (nstr > 12) {
-        data.ex_kf = atof(split_line[12].c_str());
+        data.ex_kf = split_line[12].toDouble();
       }
 
       // EXCITER_TF1
       if (nstr > 13) {
-        data.tf1 = atof(split_line[13].c_str());
+        data.tf1 = split_line[13].toDouble();
       }
 
       // EXCITER_SWITCH
       if (nstr > 14) {
-        data.rswitch = atof(split_line[14].c_str());
+        data.rswitch = split_line[14].toDouble();
       }
 
       // EXCITER_E1
       if (nstr > 15) {
-        data.ex_e1 = atof(split_line[15].c_str());
+        data.ex_e1 = split_line[15].toDouble();
       }
 
       // EXCITER_SE1
       if (nstr > 16) {
-        data.se1 = atof(split_line[16].c_str());
+        data.se1 = split_line[16].toDouble();
       }
 
       // EXCITER_E2
       if (nstr > 17) {
-        data.ex_e2 = atof(split_line[17].c_str());
+        data.ex_e2 = split_line[17].toDouble();
       }
 
       // EXCITER_SE2
       if (nstr > 18) {
-        data.se2 = atof(split_line[18].c_str());
+        data.se2 = split_line[18].toDouble();
       }
     }
 };
@@ -11,6 +11,7 @@
 #define GDFORM_HPP
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
+#include "gridpack/parser/psse_tokenizer.hpp"
 #include "gridpack/utilities/string_utils.hpp"
 namespace gridpack {
 namespace parser {
@@ -192,7 +193,7 @@ template <class _data_struct> class GdformParser
      * @param data data collection object
      * @param gen_id index of generator
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const std::vector<PSSEToken> &split_line,
         gridpack::component::DataCollection *data, int g_id)
     {
       double rval;
@@ -200,7 +201,7 @@ template <class _data_struct> class GdformParser
       // GENERATOR_MODEL              "MODEL"                  string
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted().str();
       util.toUpper(model);
       if (!data->getValue(GENERATOR_MODEL, &stmp, g_id)) {
         data->addValue(GENERATOR_MODEL, model.c_str(), g_id);
@@ -211,54 +212,54 @@ template <class _data_struct> class GdformParser
             // GENERATOR_MQ
       if (nstr > 3) {
         if (!data->getValue(GENERATOR_MQ,&rval,g_id)) {
-          data->addValue(GENERATOR_MQ, atof(split_line[3].c_str()), g_id);
+          data->addValue(GENERATOR_MQ, split_line[3].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_MQ, atof(split_line[3].c_str()), g_id);
+          data->setValue(GENERATOR_MQ, split_line[3].toDouble(), g_id);
         }
       } 
 
       // GENERATOR_KPV                           float
       if (nstr > 4) {
         if (!data->getValue(GENERATOR_KPV,&rval,g_id)) {
-          data->addValue(GENERATOR_KPV, atof(split_line[4].c_str()), g_id);
+          data->addValue(GENERATOR_KPV, split_line[4].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_KPV, atof(split_line[4].c_str()), g_id);
+          data->setValue(GENERATOR_KPV, split_line[4].toDouble(), g_id);
         }
       } 
 
       // GENERATOR_KIV                           float
       if (nstr > 5) {
         if (!data->getValue(GENERATOR_KIV,&rval,g_id)) {
-          data->addValue(GENERATOR_KIV, atof(split_line[5].c_str()), g_id);
+          data->addValue(GENERATOR_KIV, split_line[5].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_KIV, atof(split_line[5].c_str()), g_id);
+          data->setValue(GENERATOR_KIV, split_line[5].toDouble(), g_id);
         }
       }
 
       // GENERATOR_MP
       if (nstr > 6) {
         if (!data->getValue(GENERATOR_MP,&rval,g_id)) {
-          data->addValue(GENERATOR_MP, atof(split_line[6].c_str()), g_id);
+          data->addValue(GENERATOR_MP, split_line[6].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_MP, atof(split_line[10].c_str()), g_id);
+          data->setValue(GENERATOR_MP, split_line[10].toDouble(), g_id);
         }
       } 
 
       // GENERATOR_KPPMAX
       if (nstr > 7) {
         if (!data->getValue(GENERATOR_KPPMAX,&rval,g_id)) {
-          data->addValue(GENERATOR_KPPMAX, atof(split_line[7].c_str()), g_id);
+          data->addValue(GENERATOR_KPPMAX, split_line[7].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_KPPMAX, atof(split_line[7].c_str()), g_id);
+          data->setValue(GENERATOR_KPPMAX, split_line[7].toDouble(), g_id);
         }
       } 
 
       // GENERATOR_KIPMAX
       if (nstr > 8) {
         if (!data->getValue(GENERATOR_KIPMAX,&rval,g_id)) {
-          data->addValue(GENERATOR_KIPMAX, atof(split_line[8].c_str()), g_id);
+          data->addValue(GENERATOR_KIPMAX, split_line[8].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_KIPMAX, atof(split_line[8].c_str()), g_id);
+          data->setValue(GENERATOR_KIPMAX, split_line[8].toDouble(), g_id);
         }
       }
 
@@ -266,108 +267,108 @@ template <class _data_struct> class GdformParser
       // GENERATOR_PMAX
       if (nstr > 9) {
         if (!data->getValue(GENERATOR_PMAX,&rval,g_id)) {
-          data->addValue(GENERATOR_PMAX, atof(split_line[9].c_str()), g_id);
+          data->addValue(GENERATOR_PMAX, split_line[9].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_PMAX, atof(split_line[9].c_str()), g_id);
+          data->setValue(GENERATOR_PMAX, split_line[9].toDouble(), g_id);
         }
       } 
 
       // GENERATOR_PMIN
       if (nstr > 10) {
         if (!data->getValue(GENERATOR_PMIN,&rval,g_id)) {
-          data->addValue(GENERATOR_PMIN, atof(split_line[10].c_str()), g_id);
+          data->addValue(GENERATOR_PMIN, split_line[10].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_PMIN, atof(split_line[10].c_str()), g_id);
+          data->setValue(GENERATOR_PMIN, split_line[10].toDouble(), g_id);
         }
       } 
 
       // GENERATOR_EMAX
       if (nstr > 11) {
         if (!data->getValue(GENERATOR_EMAX,&rval,g_id)) {
-          data->addValue(GENERATOR_EMAX, atof(split_line[11].c_str()), g_id);
+          data->addValue(GENERATOR_EMAX, split_line[11].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_EMAX, atof(split_line[11].c_str()), g_id);
+          data->setValue(GENERATOR_EMAX, split_line[11].toDouble(), g_id);
         }
       } 
 
       // GENERATOR_EMIN
       if (nstr > 12) {
         if (!data->getValue(GENERATOR_EMIN,&rval,g_id)) {
-          data->addValue(GENERATOR_EMIN, atof(split_line[12].c_str()), g_id);
+          data->addValue(GENERATOR_EMIN, split_line[12].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_EMIN, atof(split_line[12].c_str()), g_id);
+          data->setValue(GENERATOR_EMIN, split_line[12].toDouble(), g_id);
         }
       } 
 
       // GENERATOR_TPF
       if (nstr > 13) {
         if (!data->getValue(GENERATOR_TPF,&rval,g_id)) {
-          data->addValue(GENERATOR_TPF, atof(split_line[13].c_str()), g_id);
+          data->addValue(GENERATOR_TPF, split_line[13].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_TPF, atof(split_line[13].c_str()), g_id);
+          data->setValue(GENERATOR_TPF, split_line[13].toDouble(), g_id);
         }
       } 
 
       // GENERATOR_IMAX
       if (nstr > 14) {
         if (!data->getValue(GENERATOR_IMAX,&rval,g_id)) {
-          data->addValue(GENERATOR_IMAX, atof(split_line[14].c_str()), g_id);
+          data->addValue(GENERATOR_IMAX, split_line[14].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_IMAX, atof(split_line[14].c_str()), g_id);
+          data->setValue(GENERATOR_IMAX, split_line[14].toDouble(), g_id);
         }
       }
 
       // GENERATOR_QMAX
       if (nstr > 15) {
         if (!data->getValue(GENERATOR_QMAX,&rval,g_id)) {
-          data->addValue(GENERATOR_QMAX, atof(split_line[15].c_str()), g_id);
+          data->addValue(GENERATOR_QMAX, split_line[15].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_QMAX, atof(split_line[15].c_str()), g_id);
+          data->setValue(GENERATOR_QMAX, split_line[15].toDouble(), g_id);
         }
       }
 
       // GENERATOR_QMIN
       if (nstr > 16) {
         if (!data->getValue(GENERATOR_QMIN,&rval,g_id)) {
-          data->addValue(GENERATOR_QMIN, atof(split_line[16].c_str()), g_id);
+          data->addValue(GENERATOR_QMIN, split_line[16].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_QMIN, atof(split_line[16].c_str()), g_id);
+          data->setValue(GENERATOR_QMIN, split_line[16].toDouble(), g_id);
         }
       }
 
       // GENERATOR_KPQMAX
       if (nstr > 17) {
         if (!data->getValue(GENERATOR_KPQMAX,&rval,g_id)) {
-          data->addValue(GENERATOR_KPQMAX, atof(split_line[17].c_str()), g_id);
+          data->addValue(GENERATOR_KPQMAX, split_line[17].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_KPQMAX, atof(split_line[17].c_str()), g_id);
+          data->setValue(GENERATOR_KPQMAX, split_line[17].toDouble(), g_id);
         }
       } 
 
       // GENERATOR_KIQMAX
       if (nstr > 18) {
         if (!data->getValue(GENERATOR_KIQMAX,&rval,g_id)) {
-          data->addValue(GENERATOR_KIQMAX, atof(split_line[18].c_str()), g_id);
+          data->addValue(GENERATOR_KIQMAX, split_line[18].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_KIQMAX, atof(split_line[18].c_str()), g_id);
+          data->setValue(GENERATOR_KIQMAX, split_line[18].toDouble(), g_id);
         }
       }
 
       // GENERATOR_TQF
       if (nstr > 19) {
         if (!data->getValue(GENERATOR_TQF,&rval,g_id)) {
-          data->addValue(GENERATOR_TQF, atof(split_line[19].c_str()), g_id);
+          data->addValue(GENERATOR_TQF, split_line[19].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_TQF, atof(split_line[19].c_str()), g_id);
+          data->setValue(GENERATOR_TQF, split_line[19].toDouble(), g_id);
         }
       } 
 
       // GENERATOR_TVF
       if (nstr > 20) {
         if (!data->getValue(GENERATOR_TVF,&rval,g_id)) {
-          data->addValue(GENERATOR_TVF, atof(split_line[20].c_str()), g_id);
+          data->addValue(GENERATOR_TVF, split_line[20].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_TVF, atof(split_line[20].c_str()), g_id);
+          data->setValue(GENERATOR_TVF, split_line[20].toDouble(), g_id);
         }
       } 
 
@@ -375,10 +376,10 @@ template <class _data_struct> class GdformParser
       if (nstr > 21) {
         if (!data->getValue(GENERATOR_VFLAG,&rval,g_id)) {
           data->addValue(GENERATOR_VFLAG,
-              atoi(split_line[21].c_str()), g_id);
+              split_line[21].toInt(), g_id);
         } else {
           data->setValue(GENERATOR_VFLAG,
-              atoi(split_line[21].c_str()), g_id);
+              split_line[21].toInt(), g_id);
         }
       } 
 
@@ -389,21 +390,21 @@ template <class _data_struct> class GdformParser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const std::vector<PSSEToken> &split_line,_data_struct &data)
     {
       // GENERATOR_BUSNUMBER               "I"                   integer
       int o_idx;
-      o_idx = atoi(split_line[0].c_str());
+      o_idx = split_line[0].toInt();
       data.bus_id = o_idx;
 
       // Clean up 2 character tag for generator ID
       gridpack::utility::StringUtils util;
-      std::string tag = util.clean2Char(split_line[2]);
+      std::string tag = split_line[2].tag();
       strcpy(data.gen_id, tag.c_str());
 
       std::string sval;
 
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted().str();
       util.toUpper(sval);
 
       // GENERATOR_MODEL              "MODEL"                  integer
@@ -413,98 +414,98 @@ template <class _data_struct> class GdformParser
 
       // GENERATOR_MQ
       if (nstr > 3) {
-        data.mq = atof(split_line[3].c_str());
+        data.mq = split_line[3].toDouble();
       } 
 
       // GENERATOR_KPV                           float
       if (nstr > 4) {
-        data.kpv = atof(split_line[4].c_str());
+        data.kpv = split_line[4].toDouble();
       } 
 
       // GENERATOR_KIV                           float
       if (nstr > 5) {
-        data.kiv = atof(split_line[5].c_str());
+        data.kiv = split_line[5].toDouble();
       }
 
       // GENERATOR_MP
       if (nstr > 6) {
-        data.mp = atof(split_line[6].c_str());
+        data.mp = split_line[6].toDouble();
       } 
 
       // GENERATOR_KPPMAX
       if (nstr > 7) {
-        data.kppmax = atof(split_line[7].c_str());
+        data.kppmax = split_line[7].toDouble();
       } 
 
       // GENERATOR_KIPMAX
       if (nstr > 8) {
-        data.kipmax = atof(split_line[8].c_str());
+        data.kipmax = split_line[8].toDouble();
       } 
 
       // GENERATOR_PMAX
       if (nstr > 9) {
-        data.pmax = atof(split_line[9].c_str());
+        data.pmax = split_line[9].toDouble();
       } 
 
       // GENERATOR_PMIN
       if (nstr > 10) {
-        data.pmin = atof(split_line[10].c_str());
+        data.pmin = split_line[10].toDouble();
       } 
 
 
       // GENERATOR_EMAX
       if (nstr > 11) {
-        data.emax = atof(split_line[11].c_str());
+        data.emax = split_line[11].toDouble();
       } 
 
       // GENERATOR_EMIN
       if (nstr > 12) {
-        data.emin = atof(split_line[12].c_str());
+        data.emin = split_line[12].toDouble();
       } 
 
       // GENERATOR_TPF
       if (nstr > 13) {
-        data.tpf = atof(split_line[13].c_str());
+        data.tpf = split_line[13].toDouble();
       } 
 
       // GENERATOR_IMAX
       if (nstr > 14) {
-        data.imax = atof(split_line[14].c_str());
+        data.imax = split_line[14].toDouble();
       }
 
       // GENERATOR_QMAX
       if (nstr > 15) {
-        data.qmax = atof(split_line[15].c_str());
+        data.qmax = split_line[15].toDouble();
       } 
 
       // GENERATOR_QMIN
       if (nstr > 16) {
-        data.qmin = atof(split_line[16].c_str());
+        data.qmin = split_line[16].toDouble();
       }
 
       // GENERATOR_KPQMAX
       if (nstr > 17) {
-        data.kpqmax = atof(split_line[17].c_str());
+        data.kpqmax = split_line[17].toDouble();
       } 
 
       // GENERATOR_KIQMAX
       if (nstr > 18) {
-        data.kiqmax = atof(split_line[18].c_str());
+        data.kiqmax = split_line[18].toDouble();
       }
 
       // GENERATOR_TQF
       if (nstr > 19) {
-        data.tqf = atof(split_line[19].c_str());
+        data.tqf = split_line[19].toDouble();
       } 
 
       // GENERATOR_TVF
       if (nstr > 20) {
-        data.tvf = atof(split_line[20].c_str());
+        data.tvf = split_line[20].toDouble();
       }
 
       // GENERATOR_VFLAG
       if (nstr > 21) {
-        data.vflag = atoi(split_line[21].c_str());
+        data.vflag = split_line[21].toInt();
       } 
     }
 };
@@ -11,6 +11,7 @@
 #define GENSAL_HPP
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
+#include "gridpack/parser/psse_tokenizer.hpp"
 #include "gridpack/utilities/string_utils.hpp"
 namespace gridpack {
 namespace parser {
@@ -147,7 +148,7 @@ template <class _data_struct> class GensalParser
      * @param data data collection object
      * @param gen_id index of generator
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const std::vector<PSSEToken> &split_line,
         gridpack::component::DataCollection *data, int g_id)
     {
       double rval;
@@ -155,7 +156,7 @@ template <class _data_struct> class GensalParser
       // GENERATOR_MODEL              "MODEL"                  string
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted().str();
       util.toUpper(model);
       if (!data->getValue(GENERATOR_MODEL, &stmp, g_id)) {
         data->addValue(GENERATOR_MODEL, model.c_str(), g_id);
@@ -167,10 +168,10 @@ template <class _data_struct> class GensalParser
       if (nstr > 3) {
         if (!data->getValue(GENERATOR_TDOP,&rval,g_id)) {
           data->addValue(GENERATOR_TDOP,
-              atof(split_line[3].c_str()), g_id);
+              split_line[3].toDouble(), g_id);
         } else {
           data->setValue(GENERATOR_TDOP,
-              atof(split_line[3].c_str()), g_id);
+              split_line[3].toDouble(), g_id);
         }
       } 
 
@@ -178,10 +179,10 @@ template <class _data_struct> class GensalParser
       if (nstr > 4) {
         if (!data->getValue(GENERATOR_TDOPP,&rval,g_id)) {
           data->addValue(GENERATOR_TDOPP,
-              atof(split_line[4].c_str()), g_id);
+              split_line[4].toDouble(), g_id);
         } else {
           data->setValue(GENERATOR_TDOPP,
-              atof(split_line[4].c_str()), g_id);
+              split_line[4].toDouble(), g_id);
         }
       } 
 
@@ -189,10 +190,10 @@ template <class _data_struct> class GensalParser
       if (nstr > 5) {
         if (!data->getValue(GENERATOR_TQOPP,&rval,g_id)) {
           data->addValue(GENERATOR_TQOPP,
-              atof(split_line[5].c_str()), g_id);
+              split_line[5].toDouble(), g_id);
         } else {
           data->setValue(GENERATOR_TQOPP,
-              atof(split_line[5].c_str()), g_id);
+              split_line[5].toDouble(), g_id);
         }
       } 
 
@@ -200,10 +201,10 @@ template <class _data_struct> class GensalParser
       if (nstr > 6) {
         if (!data->getValue(GENERATOR_INERTIA_CONSTANT_H,&rval,g_id)) {
           data->addValue(GENERATOR_INERTIA_CONSTANT_H,
-              atof(split_line[6].c_str()), g_id);
+              split_line[6].toDouble(), g_id);
         } else {
           data->setValue(GENERATOR_INERTIA_CONSTANT_H,
-              atof(split_line[6].c_str()), g_id);
+              split_line[6].toDouble(), g_id);
         }
       } 
 
@@ -211,10 +212,10 @@ template <class _data_struct> class GensalParser
       if (nstr > 7) {
         if (!data->getValue(GENERATOR_DAMPING_COEFFICIENT_0,&rval,g_id)) {
           data->addValue(GENERATOR_DAMPING_COEFFICIENT_0,
-              atof(split_line[7].c_str()), g_id);
+              split_line[7].toDouble(), g_id);
         } else {
           data->setValue(GENERATOR_DAMPING_COEFFICIENT_0,
-              atof(split_line[7].c_str()), g_id);
+              split_line[7].toDouble(), g_id);
         }
       }
 
@@ -222,10 +223,10 @@ template <class _data_struct> class GensalParser
       if (nstr > 8) {
         if (!data->getValue(GENERATOR_XD,&rval,g_id)) {
           data->addValue(GENERATOR_XD,
-              atof(split_line[8].c_str()), g_id);
+              split_line[8].toDouble(), g_id);
         } else {
           data->setValue(GENERATOR_XD,
-              atof(split_line[8].c_str()), g_id);
+              split_line[8].toDouble(), g_id);
         }
       } 
 
@@ -233,10 +234,10 @@ template <class _data_struct> class GensalParser
       if (nstr > 9) {
         if (!data->getValue(GENERATOR_XQ,&rval,g_id)) {
           data->addValue(GENERATOR_XQ,
-              atof(split_line[9].c_str()), g_id);
+              split_line[9].toDouble(), g_id);
         } else {
           data->setValue(GENERATOR_XQ,
-              atof(split_line[9].c_str()), g_id);
+              split_line[9].toDouble(), g_id);
         }
       } 
 
@@ -244,10 +245,10 @@ template <class _data_struct> class GensalParser
       if (nstr > 10) {
         if (!data->getValue(GENERATOR_XDP,&rval,g_id)) {
           data->addValue(GENERATOR_XDP,
-              atof(split_line[10].c_str()), g_id);
+              split_line[10].toDouble(), g_id);
         } else {
           data->setValue(GENERATOR_XDP,
-              atof(split_line[10].c_str()), g_id);
+              split_line[10].toDouble(), g_id);
         }
       } 
 
@@ -255,10 +256,10 @@ template <class _data_struct> class GensalParser
       if (nstr > 11) {
         if (!data->getValue(GENERATOR_XDPP,&rval,g_id)) {
           data->addValue(GENERATOR_XDPP,
-              atof(split_line[11].c_str()), g_id);
+              split_line[11].toDouble(), g_id);
         } else {
           data->setValue(GENERATOR_XDPP,
-              atof(split_line[11].c_str()), g_id);
+              split_line[11].toDouble(), g_id);
         }
       } 
 
@@ -266,10 +267,10 @@ template <class _data_struct> class GensalParser
       if (nstr > 12) {
         if (!data->getValue(GENERATOR_XL,&rval,g_id)) {
           data->addValue(GENERATOR_XL,
-              atof(split_line[12].c_str()), g_id);
+              split_line[12].toDouble(), g_id);
         } else {
           data->setValue(GENERATOR_XL,
-              atof(split_line[12].c_str()), g_id);
+              split_line[12].toDouble(), g_id);
         }
       } 
 
@@ -277,10 +278,10 @@ template <class _data_struct> class GensalParser
       if (nstr > 13) {
         if (!data->getValue(GENERATOR_S1,&rval,g_id)) {
           data->addValue(GENERATOR_S1,
-              atof(split_line[13].c_str()), g_id);
+              split_line[13].toDouble(), g_id);
         } else {
           data->setValue(GENERATOR_S1,
-              atof(split_line[13].c_str()), g_id);
+              split_line[13].toDouble(), g_id);
         }
       } 
 
@@ -288,10 +289,10 @@ template <class _data_struct> class GensalParser
       if (nstr > 14) {
         if (!data->getValue(GENERATOR_S12,&rval,g_id)) {
           data->addValue(GENERATOR_S12,
-              atof(split_line[14].c_str()), g_id);
+              split_line[14].toDouble(), g_id);
         } else {
           data->setValue(GENERATOR_S12,
-              atof(split_line[14].c_str()), g_id);
+              split_line[14].toDouble(), g_id);
         }
       } 
     }
@@ -301,21 +302,21 @@ template <class _data_struct> class GensalParser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const std::vector<PSSEToken> &split_line,_data_struct &data)
     {
       // GENERATOR_BUSNUMBER               "I"                   integer
       int o_idx;
-      o_idx = atoi(split_line[0].c_str());
+      o_idx = split_line[0].toInt();
       data.bus_id = o_idx;
 
       // Clean up 2 character tag for generator ID
       gridpack::utility::StringUtils util;
-      std::string tag = util.clean2Char(split_line[2]);
+      std::string tag = split_line[2].tag();
       strcpy(data.gen_id, tag.c_str());
 
       std::string sval;
 
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted().str();
       util.toUpper(sval);
 
       // GENERATOR_MODEL              "MODEL"                  integer
@@ -324,62 +325,62 @@ template <class _data_struct> class GensalParser
       int nstr = split_line.size();
       // GENERATOR_TDOP
       if (nstr > 3) {
-        data.tdop = atof(split_line[3].c_str());
+        data.tdop = split_line[3].toDouble();
       } 
 
       // GENERATOR_TDOPP
       if (nstr > 4) {
-        data.tdopp = atof(split_line[4].c_str());
+        data.tdopp = split_line[4].toDouble();
       } 
 
       // GENERATOR_TQOPP
       if (nstr > 5) {
-        data.tqopp = atof(split_line[5].c_str());
+        data.tqopp = split_line[5].toDouble();
       } 
 
       // GENERATOR_INERTIA_CONSTANT_H                           float
       if (nstr > 6) {
-        data.inertia = atof(split_line[6].c_str());
+        data.inertia = split_line[6].toDouble();
       } 
 
       // GENERATOR_DAMPING_COEFFICIENT_0                           float
       if (nstr > 7) {
-        data.damping = atof(split_line[7].c_str());
+        data.damping = split_line[7].toDouble();
       }
 
       // GENERATOR_XD
       if (nstr > 8) {
-        data.gn_xd = atof(split_line[8].c_str());
+        data.gn_xd = split_line[8].toDouble();
       } 
 
       // GENERATOR_XQ
       if (nstr > 9) {
-        data.gn_xq = atof(split_line[9].c_str());
+        data.gn_xq = split_line[9].toDouble();
       } 
 
       // GENERATOR_XDP
       if (nstr > 10) {
-        data.xdp = atof(split_line[10].c_str());
+        data.xdp = split_line[10].toDouble();
       } 
 
       // GENERATOR_XDPP
       if (nstr > 11) {
-        data.xdpp = atof(split_line[11].c_str());
+        data.xdpp = split_line[11].toDouble();
       } 
 
       // GENERATOR_XL
       if (nstr > 12) {
-        data.gn_xl = atof(split_line[12].c_str());
+        data.gn_xl = split_line[12].toDouble();
       } 
 
       // GENERATOR_S1
       if (nstr > 13) {
-        data.gn_s1 = atof(split_line[13].c_str());
+        data.gn_s1 = split_line[13].toDouble();
       } 
 
       // GENERATOR_S12
       if (nstr > 14) {
-        data.s12 = atof(split_line[14].c_str());
+        data.s12 = split_line[14].toDouble();
       } 
     }
 };
@@ -11,6 +11,7 @@
 #define GGOV1_HPP
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
+#include "gridpack/parser/psse_tokenizer.hpp"
 #include "gridpack/utilities/string_utils.hpp"
 namespace gridpack {
 namespace parser {
@@ -309,7 +310,7 @@ template <class _data_struct> class Ggov1Parser
      * @param data data collection object
      * @param gen_id index of generator
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const std::vector<PSSEToken> &split_line,
         gridpack::component::DataCollection *data, int g_id)
     {
       double rval;
@@ -325,7 +326,7 @@ template <class _data_struct> class Ggov1Parser
       // GOVERNOR_MODEL
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted().str();
       util.toUpper(model);
       if (!data->getValue(GOVERNOR_MODEL,&stmp,g_id)) {
         data->addValue(GOVERNOR_MODEL, model.c_str(), g_id);
@@ -337,10 +338,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 3) {
         if (!data->getValue(GOVERNOR_RSELECT,&rval,g_id)) {
           data->addValue(GOVERNOR_RSELECT,
-              atof(split_line[3].c_str()), g_id);
+              split_line[3].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_RSELECT,
-              atof(split_line[3].c_str()), g_id);
+              split_line[3].toDouble(), g_id);
         }
       } 
 
@@ -348,10 +349,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 4) {
         if (!data->getValue(GOVERNOR_FLAGSWITCH,&rval,g_id)) {
           data->addValue(GOVERNOR_FLAGSWITCH,
-              atof(split_line[4].c_str()), g_id);
+              split_line[4].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_FLAGSWITCH,
-              atof(split_line[4].c_str()), g_id);
+              split_line[4].toDouble(), g_id);
         }
       } 
 
@@ -359,10 +360,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 5) {
         if (!data->getValue(GOVERNOR_R,&rval,g_id)) {
           data->addValue(GOVERNOR_R,
-              atof(split_line[5].c_str()), g_id);
+              split_line[5].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_R,
-              atof(split_line[5].c_str()), g_id);
+              split_line[5].toDouble(), g_id);
         }
       } 
 
@@ -370,10 +371,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 6) {
         if (!data->getValue(GOVERNOR_TPELEC,&rval,g_id)) {
           data->addValue(GOVERNOR_TPELEC,
-              atof(split_line[6].c_str()), g_id);
+              split_line[6].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_TPELEC,
-              atof(split_line[6].c_str()), g_id);
+              split_line[6].toDouble(), g_id);
         }
       } 
 
@@ -381,10 +382,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 7) {
         if (!data->getValue(GOVERNOR_MAXERR,&rval,g_id)) {
           data->addValue(GOVERNOR_MAXERR,
-              atof(split_line[7].c_str()), g_id);
+              split_line[7].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_MAXERR,
-              atof(split_line[7].c_str()), g_id);
+              split_line[7].toDouble(), g_id);
         }
       } 
 
@@ -392,10 +393,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 8) {
         if (!data->getValue(GOVERNOR_MINERR,&rval,g_id)) {
           data->addValue(GOVERNOR_MINERR,
-              atof(split_line[8].c_str()), g_id);
+              split_line[8].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_MINERR,
-              atof(split_line[8].c_str()), g_id);
+              split_line[8].toDouble(), g_id);
         }
       } 
 
@@ -403,10 +404,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 9) {
         if (!data->getValue(GOVERNOR_KPGOV,&rval,g_id)) {
           data->addValue(GOVERNOR_KPGOV,
-              atof(split_line[9].c_str()), g_id);
+              split_line[9].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_KPGOV,
-              atof(split_line[9].c_str()), g_id);
+              split_line[9].toDouble(), g_id);
         }
       }
 
@@ -414,10 +415,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 10) {
         if (!data->getValue(GOVERNOR_KIGOV,&rval,g_id)) {
           data->addValue(GOVERNOR_KIGOV,
-              atof(split_line[10].c_str()), g_id);
+              split_line[10].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_KIGOV,
-              atof(split_line[10].c_str()), g_id);
+              split_line[10].toDouble(), g_id);
         }
       } 
 
@@ -425,10 +426,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 11) {
         if (!data->getValue(GOVERNOR_KDGOV,&rval,g_id)) {
           data->addValue(GOVERNOR_KDGOV,
-              atof(split_line[11].c_str()), g_id);
+              split_line[11].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_KDGOV,
-              atof(split_line[11].c_str()), g_id);
+              split_line[11].toDouble(), g_id);
         }
       } 
 
@@ -436,10 +437,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 12) {
         if (!data->getValue(GOVERNOR_TDGOV,&rval,g_id)) {
           data->addValue(GOVERNOR_TDGOV,
-              atof(split_line[12].c_str()), g_id);
+              split_line[12].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_TDGOV,
-              atof(split_line[12].c_str()), g_id);
+              split_line[12].toDouble(), g_id);
         }
       } 
 
@@ -447,10 +448,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 13) {
         if (!data->getValue(GOVERNOR_VMAX,&rval,g_id)) {
           data->addValue(GOVERNOR_VMAX,
-              atof(split_line[13].c_str()), g_id);
+              split_line[13].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_VMAX,
-              atof(split_line[13].c_str()), g_id);
+              split_line[13].toDouble(), g_id);
         }
       } 
 
@@ -458,10 +459,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 14) {
         if (!data->getValue(GOVERNOR_VMIN,&rval,g_id)) {
           data->addValue(GOVERNOR_VMIN,
-              atof(split_line[14].c_str()), g_id);
+              split_line[14].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_VMIN,
-              atof(split_line[14].c_str()), g_id);
+              split_line[14].toDouble(), g_id);
         }
       } 
 
@@ -469,10 +470,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 15) {
         if (!data->getValue(GOVERNOR_TACT,&rval,g_id)) {
           data->addValue(GOVERNOR_TACT,
-              atof(split_line[15].c_str()), g_id);
+              split_line[15].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_TACT,
-              atof(split_line[15].c_str()), g_id);
+              split_line[15].toDouble(), g_id);
         }
       } 
 
@@ -480,10 +481,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 16) {
         if (!data->getValue(GOVERNOR_KTURB,&rval,g_id)) {
           data->addValue(GOVERNOR_KTURB,
-              atof(split_line[16].c_str()), g_id);
+              split_line[16].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_KTURB,
-              atof(split_line[16].c_str()), g_id);
+              split_line[16].toDouble(), g_id);
         }
       } 
 
@@ -491,10 +492,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 17) {
         if (!data->getValue(GOVERNOR_WFNL,&rval,g_id)) {
           data->addValue(GOVERNOR_WFNL,
-              atof(split_line[17].c_str()), g_id);
+              split_line[17].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_WFNL,
-              atof(split_line[17].c_str()), g_id);
+              split_line[17].toDouble(), g_id);
         }
       } 
 
@@ -502,10 +503,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 18) {
         if (!data->getValue(GOVERNOR_TB,&rval,g_id)) {
           data->addValue(GOVERNOR_TB,
-              atof(split_line[18].c_str()), g_id);
+              split_line[18].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_TB,
-              atof(split_line[18].c_str()), g_id);
+              split_line[18].toDouble(), g_id);
         }
       } 
 
@@ -513,10 +514,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 19) {
         if (!data->getValue(GOVERNOR_TC,&rval,g_id)) {
           data->addValue(GOVERNOR_TC,
-              atof(split_line[19].c_str()), g_id);
+              split_line[19].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_TC,
-              atof(split_line[19].c_str()), g_id);
+              split_line[19].toDouble(), g_id);
         }
       } 
 
@@ -524,10 +525,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 20) {
         if (!data->getValue(GOVERNOR_TENG,&rval,g_id)) {
           data->addValue(GOVERNOR_TENG,
-              atof(split_line[20].c_str()), g_id);
+              split_line[20].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_TENG,
-              atof(split_line[20].c_str()), g_id);
+              split_line[20].toDouble(), g_id);
         }
       } 
 
@@ -535,10 +536,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 21) {
         if (!data->getValue(GOVERNOR_TFLOAD,&rval,g_id)) {
           data->addValue(GOVERNOR_TFLOAD,
-              atof(split_line[21].c_str()), g_id);
+              split_line[21].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_TFLOAD,
-              atof(split_line[21].c_str()), g_id);
+              split_line[21].toDouble(), g_id);
         }
       } 
 
@@ -546,10 +547,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 22) {
         if (!data->getValue(GOVERNOR_KPLOAD,&rval,g_id)) {
           data->addValue(GOVERNOR_KPLOAD,
-              atof(split_line[22].c_str()), g_id);
+              split_line[22].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_KPLOAD,
-              atof(split_line[22].c_str()), g_id);
+              split_line[22].toDouble(), g_id);
         }
       } 
 
@@ -557,10 +558,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 23) {
         if (!data->getValue(GOVERNOR_KILOAD,&rval,g_id)) {
           data->addValue(GOVERNOR_KILOAD,
-              atof(split_line[23].c_str()), g_id);
+              split_line[23].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_KILOAD,
-              atof(split_line[23].c_str()), g_id);
+              split_line[23].toDouble(), g_id);
         }
       } 
 
@@ -568,10 +569,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 24) {
         if (!data->getValue(GOVERNOR_LDREF,&rval,g_id)) {
           data->addValue(GOVERNOR_LDREF,
-              atof(split_line[24].c_str()), g_id);
+              split_line[24].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_LDREF,
-              atof(split_line[24].c_str()), g_id);
+              split_line[24].toDouble(), g_id);
         }
       } 
 
@@ -579,10 +580,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 25) {
         if (!data->getValue(GOVERNOR_DM,&rval,g_id)) {
           data->addValue(GOVERNOR_DM,
-              atof(split_line[25].c_str()), g_id);
+              split_line[25].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_DM,
-              atof(split_line[25].c_str()), g_id);
+              split_line[25].toDouble(), g_id);
         }
       } 
 
@@ -590,10 +591,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 26) {
         if (!data->getValue(GOVERNOR_ROPEN,&rval,g_id)) {
           data->addValue(GOVERNOR_ROPEN,
-              atof(split_line[26].c_str()), g_id);
+              split_line[26].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_ROPEN,
-              atof(split_line[26].c_str()), g_id);
+              split_line[26].toDouble(), g_id);
         }
       } 
 
@@ -601,10 +602,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 27) {
         if (!data->getValue(GOVERNOR_RCLOSE,&rval,g_id)) {
           data->addValue(GOVERNOR_RCLOSE,
-              atof(split_line[27].c_str()), g_id);
+              split_line[27].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_RCLOSE,
-              atof(split_line[27].c_str()), g_id);
+              split_line[27].toDouble(), g_id);
         }
       } 
 
@@ -612,10 +613,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 28) {
         if (!data->getValue(GOVERNOR_KIMW,&rval,g_id)) {
           data->addValue(GOVERNOR_KIMW,
-              atof(split_line[28].c_str()), g_id);
+              split_line[28].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_KIMW,
-              atof(split_line[28].c_str()), g_id);
+              split_line[28].toDouble(), g_id);
         }
       } 
 
@@ -623,10 +624,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 29) {
         if (!data->getValue(GOVERNOR_ASET,&rval,g_id)) {
           data->addValue(GOVERNOR_ASET,
-              atof(split_line[29].c_str()), g_id);
+              split_line[29].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_ASET,
-              atof(split_line[29].c_str()), g_id);
+              split_line[29].toDouble(), g_id);
         }
       } 
 
@@ -634,10 +635,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 30) {
         if (!data->getValue(GOVERNOR_KA,&rval,g_id)) {
           data->addValue(GOVERNOR_KA,
-              atof(split_line[30].c_str()), g_id);
+              split_line[30].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_KA,
-              atof(split_line[30].c_str()), g_id);
+              split_line[30].toDouble(), g_id);
         }
       } 
 
@@ -645,10 +646,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 31) {
         if (!data->getValue(GOVERNOR_TA,&rval,g_id)) {
           data->addValue(GOVERNOR_TA,
-              atof(split_line[31].c_str()), g_id);
+              split_line[31].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_TA,
-              atof(split_line[31].c_str()), g_id);
+              split_line[31].toDouble(), g_id);
         }
       } 
 
@@ -656,10 +657,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 32) {
         if (!data->getValue(GOVERNOR_TRATE,&rval,g_id)) {
           data->addValue(GOVERNOR_TRATE,
-              atof(split_line[32].c_str()), g_id);
+              split_line[32].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_TRATE,
-              atof(split_line[32].c_str()), g_id);
+              split_line[32].toDouble(), g_id);
         }
       } 
 
@@ -667,10 +668,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 33) {
         if (!data->getValue(GOVERNOR_DB,&rval,g_id)) {
           data->addValue(GOVERNOR_DB,
-              atof(split_line[33].c_str()), g_id);
+              split_line[33].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_DB,
-              atof(split_line[33].c_str()), g_id);
+              split_line[33].toDouble(), g_id);
         }
       } 
 
@@ -678,10 +679,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 34) {
         if (!data->getValue(GOVERNOR_TSA,&rval,g_id)) {
           data->addValue(GOVERNOR_TSA,
-              atof(split_line[34].c_str()), g_id);
+              split_line[34].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_TSA,
-              atof(split_line[34].c_str()), g_id);
+              split_line[34].toDouble(), g_id);
         }
       } 
 
@@ -689,10 +690,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 35) {
         if (!data->getValue(GOVERNOR_TSB,&rval,g_id)) {
           data->addValue(GOVERNOR_TSB,
-              atof(split_line[35].c_str()), g_id);
+              split_line[35].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_TSB,
-              atof(split_line[35].c_str()), g_id);
+              split_line[35].toDouble(), g_id);
         }
       } 
 
@@ -700,10 +701,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 36) {
         if (!data->getValue(GOVERNOR_RUP,&rval,g_id)) {
           data->addValue(GOVERNOR_RUP,
-              atof(split_line[36].c_str()), g_id);
+              split_line[36].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_RUP,
-              atof(split_line[36].c_str()), g_id);
+              split_line[36].toDouble(), g_id);
         }
       } 
 
@@ -711,10 +712,10 @@ template <class _data_struct> class Ggov1Parser
       if (nstr > 37) {
         if (!data->getValue(GOVERNOR_RDOWN,&rval,g_id)) {
           data->addValue(GOVERNOR_RDOWN,
-              atof(split_line[37].c_str()), g_id);
+              split_line[37].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_RDOWN,
-              atof(split_line[37].c_str()), g_id);
+              split_line[37].toDouble(), g_id);
         }
       } 
     }
@@ -724,20 +725,20 @@ template <class _data_struct> class Ggov1Parser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const std::vector<PSSEToken> &split_line,_data_struct &data)
     {
       // GOVERNOR_BUSNUMBER               "I"                   integer
       int o_idx;
-      o_idx = atoi(split_line[0].c_str());
+      o_idx = split_line[0].toInt();
       data.bus_id = o_idx;
 
       // Clean up 2 character tag for generator ID
       gridpack::utility::StringUtils util;
-      std::string tag = util.clean2Char(split_line[2]);
+      std::string tag = split_line[2].tag();
       strcpy(data.gen_id, tag.c_str());
 
       std::string sval;
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted().str();
       util.toUpper(sval);
 
       // GOVERNOR_MODEL              "MODEL"                  integer
@@ -746,177 +747,177 @@ template <class _data_struct> class Ggov1Parser
       int nstr = split_line.size();
       // GOVERNOR_RSELECT
       if (nstr > 3) {
-        data.rselect = atof(split_line[3].c_str());
+        data.rselect = split_line[3].toDouble();
       }
 
       // GOVERNOR_FLAGSWITCH
       if (nstr > 4) {
-        data.flagswitch = atof(split_line[4].c_str());
+        data.flagswitch = split_line[4].toDouble();
       }
 
       // GOVERNOR_R
       if (nstr > 5) {
-        data.gv_r = atof(split_line[5].c_str());
+        data.gv_r = split_line[5].toDouble();
       }
 
       // GOVERNOR_TPELEC
       if (nstr > 6) {
-        data.tpelec = atof(split_line[6].c_str());
+        data.tpelec = split_line[6].toDouble();
       }
 
       // GOVERNOR_MAXERR
       if (nstr > 7) {
-        data.maxerr = atof(split_line[7].c_str());
+        data.maxerr = split_line[7].toDouble();
       }
 
       // GOVERNOR_MINERR
       if (nstr > 8) {
-        data.minerr = atof(split_line[8].c_str());
+        data.minerr = split_line[8].toDouble();
       }
 
       // GOVERNOR_KPGOV
       if (nstr > 9) {
-        data.kpgov = atof(split_line[9].c_str());
+        data.kpgov = split_line[9].toDouble();
       }
 
       // GOVERNOR_KIGOV
       if (nstr > 10) {
-        data.kigov = atof(split_line[10].c_str());
+        data.kigov = split_line[10].toDouble();
       }
 
       // GOVERNOR_KDGOV
       if (nstr > 11) {
-        data.kdgov = atof(split_line[11].c_str());
+        data.kdgov = split_line[11].toDouble();
       }
 
       // GOVERNOR_TDGOV
       if (nstr > 12) {
-        data.tdgov = atof(split_line[12].c_str());
+        data.tdgov = split_line[12].toDouble();
       }
 
       // GOVERNOR_VMAX
       if (nstr > 13) {
-        data.vmax = atof(split_line[13].c_str());
+        data.vmax = split_line[13].toDouble();
       }
 
       // GOVERNOR_VMIN
       if (nstr > 14) {
-        data.vmin = atof(split_line[14].c_str());
+        data.vmin = split_line[14].toDouble();
       }
 
       // GOVERNOR_TACT
       if (nstr > 15) {
-        data.tact = atof(split_line[15].c_str());
+        data.tact = split_line[15].toDouble();
       }
 
       // GOVERNOR_KTURB
       if (nstr > 16) {
-        data.kturb = atof(split_line[16].c_str());
+        data.kturb = split_line[16].toDouble();
       }
 
       // GOVERNOR_WFNL
       if (nstr > 17) {
-        data.wfnl = atof(split_line[17].c_str());
+        data.wfnl = split_line[17].toDouble();
       }
 
       // GOVERNOR_TB
       if (nstr > 18) {
-        data.gv_tb = atof(split_line[18].c_str());
+        data.gv_tb = split_line[18].toDouble();
       }
 
       // GOVERNOR_TC
       if (nstr > 19) {
-        data.gv_tc = atof(split_line[19].c_str());
+        data.gv_tc = split_line[19].toDouble();
       }
 
       // GOVERNOR_TENG
       if (nstr > 20) {
-        data.teng = atof(split_line[20].c_str());
+        data.teng = split_line[20].toDouble();
       }
 
       // GOVERNOR_TFLOAD
       if (nstr > 21) {
-        data.tfload = atof(split_line[21].c_str());
+        data.tfload = split_line[21].toDouble();
       }
 
       // GOVERNOR_KPLOAD
       if (nstr > 22) {
-        data.kpload = atof(split_line[22].c_str());
+        data.kpload = split_line[22].toDouble();
       }
 
       // GOVERNOR_KILOAD
       if (nstr > 23) {
-        data.kiload = atof(split_line[23].c_str());
+        data.kiload = split_line[23].toDouble();
       }
 
       // GOVERNOR_LDREF
       if (nstr > 24) {
-        data.ldref = atof(split_line[24].c_str());
+        data.ldref = split_line[24].toDouble();
       }
 
       // GOVERNOR_DM
       if (nstr > 25) {
-        data.gv_dm = atof(split_line[25].c_str());
+        data.gv_dm = split_line[25].toDouble();
       }
 
       // GOVERNOR_ROPEN
       if (nstr > 26) {
-        data.ropen = atof(split_line[26].c_str());
+        data.ropen = split_line[26].toDouble();
       }
 
       // GOVERNOR_RCLOSE
       if (nstr > 27) {
-        data.rclose = atof(split_line[27].c_str());
+        data.rclose = split_line[27].toDouble();
       }
 
       // GOVERNOR_KIMW
       if (nstr > 28) {
-        data.kimw = atof(split_line[28].c_str());
+        data.kimw = split_line[28].toDouble();
       }
 
       // GOVERNOR_ASET
       if (nstr > 29) {
-        data.aset = atof(split_line[29].c_str());
+        data.aset = split_line[29].toDouble();
       }
 
       // GOVERNOR_KA
       if (nstr > 30) {
-        data.gv_ka = atof(split_line[30].c_str());
+        data.gv_ka = split_line[30].toDouble();
       }
 
       // GOVERNOR_TA
       if (nstr > 31) {
-        data.gv_ta = atof(split_line[31].c_str());
+        data.gv_ta = split_line[31].toDouble();
       }
 
       // GOVERNOR_TRATE
       if (nstr > 32) {
-        data.trate = atof(split_line[32].c_str());
+        data.trate = split_line[32].toDouble();
       }
 
       // GOVERNOR_DB
       if (nstr > 33) {
-        data.gv_db = atof(split_line[33].c_str());
+        data.gv_db = split_line[33].toDouble();
       }
 
       // GOVERNOR_TSA
       if (nstr > 34) {
-        data.tsa = atof(split_line[34].c_str());
+        data.tsa = split_line[34].toDouble();
       }
 
       // GOVERNOR_TSB
       if (nstr > 35) {
-        data.tsb = atof(split_line[35].c_str());
+        data.tsb = split_line[35].toDouble();
       }
 
       // GOVERNOR_RUP
       if (nstr > 36) {
-        data.rup = atof(split_line[36].c_str());
+        data.rup = split_line[36].toDouble();
       }
 
       // GOVERNOR_RDOWN
       if (nstr > 37) {
-        data.rdown = atof(split_line[37].c_str());
+        data.rdown = split_line[37].toDouble();
       }
     }
 };
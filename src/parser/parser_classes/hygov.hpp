@@ -11,6 +11,7 @@
 #define HYGOV_HPP
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
+#include "gridpack/parser/psse_tokenizer.hpp"
 #include "gridpack/utilities/string_utils.hpp"
 namespace gridpack {
 namespace parser {
@@ -150,7 +151,7 @@ template <class _data_struct> class HygovParser
      * @param data data collection object
      * @param gen_id index of generator
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const std::vector<PSSEToken> &split_line,
         gridpack::component::DataCollection *data, int g_id)
     {
       double rval;
@@ -166,7 +167,7 @@ template <class _data_struct> class HygovParser
       // GOVERNOR_MODEL
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted().str();
       util.toUpper(model);
       if (!data->getValue(GOVERNOR_MODEL,&stmp,g_id)) {
         data->addValue(GOVERNOR_MODEL, model.c_str(), g_id);
@@ -177,108 +178,108 @@ template <class _data_struct> class HygovParser
       // GOVERNOR_R
       if (nstr > 3) {
         if (!data->getValue(GOVERNOR_R,&rval,g_id)) {
-          data->addValue(GOVERNOR_R, atof(split_line[3].c_str()), g_id);
+          data->addValue(GOVERNOR_R, split_line[3].toDouble(), g_id);
         } else {
-          data->setValue(GOVERNOR_R, atof(split_line[3].c_str()), g_id);
+          data->setValue(GOVERNOR_R, split_line[3].toDouble(), g_id);
         }
       } 
 
       // GOVERNOR_r
       if (nstr > 4) {
         if (!data->getValue(GOVERNOR_r,&rval,g_id)) {
-          data->addValue(GOVERNOR_r, atof(split_line[4].c_str()), g_id);
+          data->addValue(GOVERNOR_r, split_line[4].toDouble(), g_id);
         } else {
-          data->setValue(GOVERNOR_r, atof(split_line[4].c_str()), g_id);
+          data->setValue(GOVERNOR_r, split_line[4].toDouble(), g_id);
         }
       } 
 
       // GOVERNOR_TR
       if (nstr > 5) {
         if (!data->getValue(GOVERNOR_TR,&rval,g_id)) {
-          data->addValue(GOVERNOR_TR, atof(split_line[5].c_str()), g_id);
+          data->addValue(GOVERNOR_TR, split_line[5].toDouble(), g_id);
         } else {
-          data->setValue(GOVERNOR_TR, atof(split_line[5].c_str()), g_id);
+          data->setValue(GOVERNOR_TR, split_line[5].toDouble(), g_id);
         }
       } 
 
       // GOVERNOR_TF
       if (nstr > 6) {
         if (!data->getValue(GOVERNOR_TF,&rval,g_id)) {
-          data->addValue(GOVERNOR_TF, atof(split_line[6].c_str()), g_id);
+          data->addValue(GOVERNOR_TF, split_line[6].toDouble(), g_id);
         } else {
-          data->setValue(GOVERNOR_TF, atof(split_line[6].c_str()), g_id);
+          data->setValue(GOVERNOR_TF, split_line[6].toDouble(), g_id);
         }
       } 
 
       // GOVERNOR_TG
       if (nstr > 7) {
         if (!data->getValue(GOVERNOR_TG,&rval,g_id)) {
-          data->addValue(GOVERNOR_TG, atof(split_line[7].c_str()), g_id);
+          data->addValue(GOVERNOR_TG, split_line[7].toDouble(), g_id);
         } else {
-          data->setValue(GOVERNOR_TG, atof(split_line[7].c_str()), g_id);
+          data->setValue(GOVERNOR_TG, split_line[7].toDouble(), g_id);
         }
       } 
 
       // GOVERNOR_VELM
       if (nstr > 8) {
         if (!data->getValue(GOVERNOR_VELM,&rval,g_id)) {
-          data->addValue(GOVERNOR_VELM, atof(split_line[8].c_str()), g_id);
+          data->addValue(GOVERNOR_VELM, split_line[8].toDouble(), g_id);
         } else {
-          data->setValue(GOVERNOR_VELM, atof(split_line[8].c_str()), g_id);
+          data->setValue(GOVERNOR_VELM, split_line[8].toDouble(), g_id);
         }
       } 
 
       // GOVERNOR_GMAX
       if (nstr > 9) {
         if (!data->getValue(GOVERNOR_GMAX,&rval,g_id)) {
-          data->addValue(GOVERNOR_GMAX, atof(split_line[9].c_str()), g_id);
+          data->addValue(GOVERNOR_GMAX, split_line[9].toDouble(), g_id);
         } else {
-          data->setValue(GOVERNOR_GMAX, atof(split_line[9].c_str()), g_id);
+          data->setValue(GOVERNOR_GMAX, split_line[9].toDouble(), g_id);
         }
       } 
 
       // GOVERNOR_GMIN
       if (nstr > 10) {
         if (!data->getValue(GOVERNOR_GMIN,&rval,g_id)) {
-          data->addValue(GOVERNOR_GMIN, atof(split_line[10].c_str()), g_id);
+          data->addValue(GOVERNOR_GMIN, split_line[10].toDouble(), g_id);
         } else {
-          data->setValue(GOVERNOR_GMIN, atof(split_line[10].c_str()), g_id);
+          data->setValue(GOVERNOR_GMIN, split_line[10].toDouble(), g_id);
         }
       } 
 
       // GOVERNOR_TW
       if (nstr > 11) {
         if (!data->getValue(GOVERNOR_TW,&rval,g_id)) {
-          data->addValue(GOVERNOR_TW, atof(split_line[11].c_str()), g_id);
+          data->addValue(GOVERNOR_TW, split_line[11].toDouble(), g_id);
         } else {
-          data->setValue(GOVERNOR_TW, atof(split_line[11].c_str()), g_id);
+          data->setValue(GOVERNOR_TW, split_line[11].toDouble(), g_id);
         }
       }
 
       // GOVERNOR_AT
       if (nstr > 12) {
         if (!data->getValue(GOVERNOR_AT,&rval,g_id)) {
-          data->addValue(GOVERNOR_AT, atof(split_line[12].c_str()), g_id);
+          data->addValue(GOVERNOR_AT, split_line[12].toDouble(), g_id);
         } else {
-          data->setValue(GOVERNOR_AT, atof(split_line[12].c_str()), g_id);
+          data->setValue(GOVERNOR_AT, split_line[12].toDouble(), g_id);
         }
       }
 
       // GOVERNOR_DT
       if (nstr > 13) {
         if (!data->getValue(GOVERNOR_DT,&rval,g_id)) {
-          data->addValue(GOVERNOR_DT, atof(split_line[13].c_str()), g_id);
+          data->addValue(GOVERNOR_DT, split_line[13].toDouble(), g_id);
         } else {
-          data->setValue(GOVERNOR_DT, atof(split_line[13].c_str()), g_id);
+          data->setValue(GOVERNOR_DT, split_line[13].toDouble(), g_id);
         }
       }
 
       // GOVERNOR_QNL
       if (nstr > 14) {
         if (!data->getValue(GOVERNOR_QNL,&rval,g_id)) {
-          data->addValue(GOVERNOR_QNL, atof(split_line[14].c_str()), g_id);
+          data->addValue(GOVERNOR_QNL, split_line[14].toDouble(), g_id);
         } else {
-          data->setValue(GOVERNOR_QNL, atof(split_line[14].c_str()), g_id);
+          data->setValue(GOVERNOR_QNL, split_line[14].toDouble(), g_id);
         }
       } 
     }
@@ -288,20 +289,20 @@ template <class _data_struct> class HygovParser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const std::vector<PSSEToken> &split_line,_data_struct &data)
     {
       // GOVERNOR_BUSNUMBER               "I"                   integer
       int o_idx;
-      o_idx = atoi(split_line[0].c_str());
+      o_idx = split_line[0].toInt();
       data.bus_id = o_idx;
 
       // Clean up 2 character tag for generator ID
       gridpack::utility::StringUtils util;
-      std::string tag = util.clean2Char(split_line[2]);
+      std::string tag = split_line[2].tag();
       strcpy(data.gen_id, tag.c_str());
 
       std::string sval;
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted().str();
       util.toUpper(sval);
 
       // GOVERNOR_MODEL              "MODEL"                  integer
@@ -310,62 +311,62 @@ template <class _data_struct> class HygovParser
       int nstr = split_line.size();
       // GOVERNOR_R
       if (nstr > 3) {
-        data.gv_r = atof(split_line[3].c_str());
+        data.gv_r = split_line[3].toDouble();
       }
 
       // GOVERNOR_r
       if (nstr > 4) {
-        data.gv_r2 = atof(split_line[4].c_str());
+        data.gv_r2 = split_line[4].toDouble();
       }
 
       // GOVERNOR_TR
       if (nstr > 5) {
-        data.gv_tr = atof(split_line[5].c_str());
+        data.gv_tr = split_line[5].toDouble();
       }
 
       // GOVERNOR_TF
       if (nstr > 6) {
-        data.gv_tf = atof(split_line[6].c_str());
+        data.gv_tf = split_line[6].toDouble();
       }
 
       // GOVERNOR_TG
       if (nstr > 7) {
-        data.gv_tg = atof(split_line[7].c_str());
+        data.gv_tg = split_line[7].toDouble();
       }
 
       // GOVERNOR_VELM
       if (nstr > 8) {
-        data.gv_velm = atof(split_line[8].c_str());
+        data.gv_velm = split_line[8].toDouble();
       }
 
       // GOVERNOR_GMAX
       if (nstr > 9) {
-        data.gv_gmax = atof(split_line[9].c_str());
+        data.gv_gmax = split_line[9].toDouble();
       }
 
       // GOVERNOR_GMIN
       if (nstr > 10) {
-        data.gv_gmin = atof(split_line[10].c_str());
+        data.gv_gmin = split_line[10].toDouble();
       }
 
       // GOVERNOR_TW
       if (nstr > 11) {
-        data.gv_tw = atof(split_line[11].c_str());
+        data.gv_tw = split_line[11].toDouble();
       }
 
       // GOVERNOR_AT
       if (nstr > 12) {
-        data.gv_at = atof(split_line[12].c_str());
+        data.gv_at = split_line[12].toDouble();
       }
 
       // GOVERNOR_DT
       if (nstr > 13) {
-        data.gv_dt = atof(split_line[13].c_str());
+        data.gv_dt = split_line[13].toDouble();
       }
 
       // GOVERNOR_QNL
       if (nstr > 14) {
-        data.gv_qnl = atof(split_line[14].c_str());
+        data.gv_qnl = split_line[14].toDouble();
       }
     }
 };
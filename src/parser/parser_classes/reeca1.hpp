@@ -11,6 +11,7 @@
 #define REECA1_HPP
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
+#include "gridpack/parser/psse_tokenizer.hpp"
 #include "gridpack/utilities/string_utils.hpp"
 namespace gridpack {
 namespace parser {
@@ -377,7 +378,7 @@ template <class _data_struct> class Reeca1Parser
      * @param data data collection object
      * @param gen_id index of generator
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const std::vector<PSSEToken> &split_line,
         gridpack::component::DataCollection *data, int g_id)
     {
       double rval;
@@ -393,7 +394,7 @@ template <class _data_struct> class Reeca1Parser
       // EXCITER_MODEL              "MODEL"                  string
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted().str();
       util.toUpper(model);
       if (!data->getValue(EXCITER_MODEL, &stmp, g_id)) {
         data->addValue(EXCITER_MODEL, model.c_str(), g_id);
@@ -404,53 +405,53 @@ template <class _data_struct> class Reeca1Parser
       int ival;
       if (nstr > 3) {
         if (!data->getValue(GENERATOR_REECA_IREG,&ival,g_id)) {
-          data->addValue(GENERATOR_REECA_IREG, atoi(split_line[3].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_IREG, split_line[3].toInt(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_IREG, atoi(split_line[3].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_IREG, split_line[3].toInt(), g_id);
         }
       } 
 
       if (nstr > 4) {
         if (!data->getValue(GENERATOR_REECA_PFFLAG,&ival,g_id)) {
-          data->addValue(GENERATOR_REECA_PFFLAG, atoi(split_line[4].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_PFFLAG, split_line[4].toInt(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_PFFLAG, atoi(split_line[4].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_PFFLAG, split_line[4].toInt(), g_id);
         }
       } 
 
 
       if (nstr > 5) {
         if (!data->getValue(GENERATOR_REECA_VFLAG,&ival,g_id)) {
-          data->addValue(GENERATOR_REECA_VFLAG, atoi(split_line[5].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_VFLAG, split_line[5].toInt(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_VFLAG, atoi(split_line[5].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_VFLAG, split_line[5].toInt(), g_id);
         }
       } 
 
       if (nstr > 6) {
 
         if (!data->getValue(GENERATOR_REECA_QFLAG,&ival,g_id)) {
-          data->addValue(GENERATOR_REECA_QFLAG, atoi(split_line[6].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_QFLAG, split_line[6].toInt(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_QFLAG, atoi(split_line[6].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_QFLAG, split_line[6].toInt(), g_id);
         }
 		
       } 
 
       if (nstr > 7) {
         if (!data->getValue(GENERATOR_REECA_PFLAG,&ival,g_id)) {
-          data->addValue(GENERATOR_REECA_PFLAG, atoi(split_line[7].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_PFLAG, split_line[7].toInt(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_PFLAG, atoi(split_line[7].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_PFLAG, split_line[7].toInt(), g_id);
         }
       }
 
 
       if (nstr > 8) {
         if (!data->getValue(GENERATOR_REECA_PQFLAG,&ival,g_id)) {
-          data->addValue(GENERATOR_REECA_PQFLAG, atoi(split_line[8].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_PQFLAG, split_line[8].toInt(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_PQFLAG, atoi(split_line[8].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_PQFLAG, split_line[8].toInt(), g_id);
         }
       } 
 
@@ -459,368 +460,368 @@ template <class _data_struct> class Reeca1Parser
 
       if (nstr > 9) {
         if (!data->getValue(GENERATOR_REECA_VDIP,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_VDIP, atof(split_line[9].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_VDIP, split_line[9].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_VDIP, atof(split_line[9].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_VDIP, split_line[9].toDouble(), g_id);
         }
       } 
 
       if (nstr > 10) {
         if (!data->getValue(GENERATOR_REECA_VUP,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_VUP, atof(split_line[10].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_VUP, split_line[10].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_VUP, atof(split_line[10].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_VUP, split_line[10].toDouble(), g_id);
         }
       } 
 
 
       if (nstr > 11) {
         if (!data->getValue(GENERATOR_REECA_TRV,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_TRV, atof(split_line[11].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_TRV, split_line[11].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_TRV, atof(split_line[11].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_TRV, split_line[11].toDouble(), g_id);
         }
       } 
 
 
       if (nstr > 12) {
         if (!data->getValue(GENERATOR_REECA_DBD1,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_DBD1, atof(split_line[12].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_DBD1, split_line[12].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_DBD1, atof(split_line[12].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_DBD1, split_line[12].toDouble(), g_id);
         }
       } 
 
       if (nstr > 13) {
         if (!data->getValue(GENERATOR_REECA_DBD2,&rval,g_id)) {
           data->addValue(GENERATOR_REECA_DBD2,
-              atof(split_line[13].c_str()), g_id);
+              split_line[13].toDouble(), g_id);
         } else {
           data->setValue(GENERATOR_REECA_DBD2,
-              atof(split_line[13].c_str()), g_id);
+              split_line[13].toDouble(), g_id);
         }
       } 
 
 
       if (nstr > 14) {
         if (!data->getValue(GENERATOR_REECA_KQV,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_KQV, atof(split_line[14].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_KQV, split_line[14].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_KQV, atof(split_line[14].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_KQV, split_line[14].toDouble(), g_id);
         }
       } 
 
 
       if (nstr > 15) {
         if (!data->getValue(GENERATOR_REECA_IQH1,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_IQH1, atof(split_line[15].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_IQH1, split_line[15].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_IQH1, atof(split_line[15].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_IQH1, split_line[15].toDouble(), g_id);
         }
       } 
 	  
 
       if (nstr > 16) {
         if (!data->getValue(GENERATOR_REECA_IQL1,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_IQL1, atof(split_line[16].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_IQL1, split_line[16].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_IQL1, atof(split_line[16].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_IQL1, split_line[16].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr > 17) {
         if (!data->getValue(GENERATOR_REECA_VREF0,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_VREF0, atof(split_line[17].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_VREF0, split_line[17].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_VREF0, atof(split_line[17].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_VREF0, split_line[17].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr > 18  ) {
         if (!data->getValue(GENERATOR_REECA_IQFRZ,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_IQFRZ, atof(split_line[ 18].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_IQFRZ, split_line[18].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_IQFRZ, atof(split_line[ 18].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_IQFRZ, split_line[18].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  19 ) {
         if (!data->getValue(GENERATOR_REECA_THLD,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_THLD, atof(split_line[ 19].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_THLD, split_line[19].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_THLD, atof(split_line[ 19].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_THLD, split_line[19].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  20 ) {
         if (!data->getValue(GENERATOR_REECA_THLD2,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_THLD2, atof(split_line[ 20].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_THLD2, split_line[20].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_THLD2, atof(split_line[ 20].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_THLD2, split_line[20].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  21 ) {
         if (!data->getValue(GENERATOR_REECA_TP,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_TP, atof(split_line[ 21].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_TP, split_line[21].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_TP, atof(split_line[ 21].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_TP, split_line[21].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  22 ) {
         if (!data->getValue(GENERATOR_REECA_QMAX,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_QMAX, atof(split_line[ 22].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_QMAX, split_line[22].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_QMAX, atof(split_line[ 22].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_QMAX, split_line[22].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  23 ) {
         if (!data->getValue(GENERATOR_REECA_QMIN,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_QMIN, atof(split_line[ 23].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_QMIN, split_line[23].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_QMIN, atof(split_line[ 23].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_QMIN, split_line[23].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  24 ) {
         if (!data->getValue(GENERATOR_REECA_VMAX,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_VMAX, atof(split_line[ 24].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_VMAX, split_line[24].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_VMAX, atof(split_line[ 24].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_VMAX, split_line[24].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  25 ) {
         if (!data->getValue(GENERATOR_REECA_VMIN,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_VMIN, atof(split_line[ 25].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_VMIN, split_line[25].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_VMIN, atof(split_line[ 25].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_VMIN, split_line[25].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  26 ) {
         if (!data->getValue(GENERATOR_REECA_KQP,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_KQP, atof(split_line[ 26].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_KQP, split_line[26].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_KQP, atof(split_line[ 26].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_KQP, split_line[26].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  27 ) {
         if (!data->getValue(GENERATOR_REECA_KQI,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_KQI, atof(split_line[ 27].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_KQI, split_line[27].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_KQI, atof(split_line[ 27].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_KQI, split_line[27].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  28 ) {
         if (!data->getValue(GENERATOR_REECA_KVP,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_KVP, atof(split_line[ 28].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_KVP, split_line[28].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_KVP, atof(split_line[ 28].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_KVP, split_line[28].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  29 ) {
         if (!data->getValue(GENERATOR_REECA_KVI,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_KVI, atof(split_line[ 29].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_KVI, split_line[29].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_KVI, atof(split_line[ 29].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_KVI, split_line[29].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  30 ) {
         if (!data->getValue(GENERATOR_REECA_VBIAS,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_VBIAS, atof(split_line[ 30].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_VBIAS, split_line[30].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_VBIAS, atof(split_line[ 30].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_VBIAS, split_line[30].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  31 ) {
         if (!data->getValue(GENERATOR_REECA_TIQ,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_TIQ, atof(split_line[ 31].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_TIQ, split_line[31].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_TIQ, atof(split_line[ 32].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_TIQ, split_line[32].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  32 ) {
         if (!data->getValue(GENERATOR_REECA_DPMAX,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_DPMAX, atof(split_line[ 32].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_DPMAX, split_line[32].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_DPMAX, atof(split_line[ 32].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_DPMAX, split_line[32].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  33 ) {
         if (!data->getValue(GENERATOR_REECA_DPMIN,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_DPMIN, atof(split_line[ 33].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_DPMIN, split_line[33].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_DPMIN, atof(split_line[ 33].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_DPMIN, split_line[33].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  34 ) {
         if (!data->getValue(GENERATOR_REECA_PMAX,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_PMAX, atof(split_line[ 34].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_PMAX, split_line[34].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_PMAX, atof(split_line[ 34].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_PMAX, split_line[34].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >   35) {
         if (!data->getValue(GENERATOR_REECA_PMIN,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_PMIN, atof(split_line[ 35].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_PMIN, split_line[35].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_PMIN, atof(split_line[ 35].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_PMIN, split_line[35].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >   36) {
         if (!data->getValue(GENERATOR_REECA_IMAX,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_IMAX, atof(split_line[ 36].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_IMAX, split_line[36].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_IMAX, atof(split_line[ 36].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_IMAX, split_line[36].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >   37) {
         if (!data->getValue(GENERATOR_REECA_TPORD,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_TPORD, atof(split_line[ 37].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_TPORD, split_line[37].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_TPORD, atof(split_line[ 37].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_TPORD, split_line[37].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >   38) {
         if (!data->getValue(GENERATOR_REECA_VQ1,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_VQ1, atof(split_line[ 38 ].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_VQ1, split_line[38].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_VQ1, atof(split_line[ 38 ].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_VQ1, split_line[38].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >   39) {
         if (!data->getValue(GENERATOR_REECA_IQ1,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_IQ1, atof(split_line[ 39 ].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_IQ1, split_line[39].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_IQ1, atof(split_line[ 39 ].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_IQ1, split_line[39].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >   40) {
         if (!data->getValue(GENERATOR_REECA_VQ2,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_VQ2, atof(split_line[ 40 ].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_VQ2, split_line[40].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_VQ2, atof(split_line[ 40 ].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_VQ2, split_line[40].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >   41) {
         if (!data->getValue(GENERATOR_REECA_IQ2,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_IQ2, atof(split_line[ 41 ].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_IQ2, split_line[41].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_IQ2, atof(split_line[ 41 ].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_IQ2, split_line[41].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >   42) {
         if (!data->getValue(GENERATOR_REECA_VQ3,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_VQ3, atof(split_line[ 42 ].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_VQ3, split_line[42].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_VQ3, atof(split_line[ 42 ].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_VQ3, split_line[42].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >   43) {
         if (!data->getValue(GENERATOR_REECA_IQ3,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_IQ3, atof(split_line[ 43 ].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_IQ3, split_line[43].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_IQ3, atof(split_line[ 43 ].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_IQ3, split_line[43].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >   44) {
         if (!data->getValue(GENERATOR_REECA_VQ4,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_VQ4, atof(split_line[ 44 ].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_VQ4, split_line[44].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_VQ4, atof(split_line[ 44 ].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_VQ4, split_line[44].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >   45) {
         if (!data->getValue(GENERATOR_REECA_IQ4,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_IQ4, atof(split_line[ 45 ].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_IQ4, split_line[45].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_IQ4, atof(split_line[  45].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_IQ4, split_line[45].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >   46) {
         if (!data->getValue(GENERATOR_REECA_VP1,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_VP1, atof(split_line[ 46 ].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_VP1, split_line[46].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_VP1, atof(split_line[ 46 ].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_VP1, split_line[46].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >   47) {
         if (!data->getValue(GENERATOR_REECA_IP1,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_IP1, atof(split_line[ 47 ].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_IP1, split_line[47].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_IP1, atof(split_line[  47].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_IP1, split_line[47].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >   48) {
         if (!data->getValue(GENERATOR_REECA_VP2,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_VP2, atof(split_line[ 48 ].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_VP2, split_line[48].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_VP2, atof(split_line[ 48 ].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_VP2, split_line[48].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >   49) {
         if (!data->getValue(GENERATOR_REECA_IP2,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_IP2, atof(split_line[ 49 ].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_IP2, split_line[49].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_IP2, atof(split_line[  49].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_IP2, split_line[49].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >   50) {
         if (!data->getValue(GENERATOR_REECA_VP3,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_VP3, atof(split_line[ 50 ].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_VP3, split_line[50].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_VP3, atof(split_line[  50].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_VP3, split_line[50].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >   51) {
         if (!data->getValue(GENERATOR_REECA_IP3,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_IP3, atof(split_line[ 51 ].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_IP3, split_line[51].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_IP3, atof(split_line[  51].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_IP3, split_line[51].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >   52) {
         if (!data->getValue(GENERATOR_REECA_VP4,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_VP4, atof(split_line[  52].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_VP4, split_line[52].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_VP4, atof(split_line[ 52 ].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_VP4, split_line[52].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >   53) {
         if (!data->getValue(GENERATOR_REECA_IP4,&rval,g_id)) {
-          data->addValue(GENERATOR_REECA_IP4, atof(split_line[ 53 ].c_str()), g_id);
+          data->addValue(GENERATOR_REECA_IP4, split_line[53].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REECA_IP4, atof(split_line[ 53 ].c_str()), g_id);
+          data->setValue(GENERATOR_REECA_IP4, split_line[53].toDouble(), g_id);
         }
       } 
 	  
@@ -831,22 +832,22 @@ template <class _data_struct> class Reeca1Parser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const std::vector<PSSEToken> &split_line,_data_struct &data)
     {
       // GENERATOR_BUSNUMBER               "I"                   integer
       int o_idx;
-      o_idx = atoi(split_line[0].c_str());
+      o_idx = split_line[0].toInt();
       data.bus_id = o_idx;
 
       // Clean up 2 character tag for generator ID
       gridpack::utility::StringUtils util;
-      std::string tag = util.clean2Char(split_line[2]);
+      std::string tag = split_line[2].tag();
       
       strcpy(data.gen_id, tag.c_str());
 
       std::string sval;
 
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted().str();
       util.toUpper(sval);
 
       // GENERATOR_MODEL              "MODEL"                  integer
@@ -855,218 +856,218 @@ template <class _data_struct> class Reeca1Parser
       int nstr = split_line.size();
      
       if (nstr > 3) {
-        data.reeca1_ireg = atoi(split_line[3].c_str());
+        data.reeca1_ireg = split_line[3].toInt();
       } 
 
      
       if (nstr > 4) {
-        data.reeca1_pfflag = atoi(split_line[4].c_str());
+        data.reeca1_pfflag = split_line[4].toInt();
       } 
 
     
       if (nstr > 5) {
-        data.reeca1_vflag = atoi(split_line[5].c_str());
+        data.reeca1_vflag = split_line[5].toInt();
       } 
 
                              
       if (nstr > 6) {
-        data.reeca1_qflag = atoi(split_line[6].c_str());
+        data.reeca1_qflag = split_line[6].toInt();
       } 
 
 
       if (nstr > 7) {
-        data.reeca1_pflag = atoi(split_line[7].c_str());
+        data.reeca1_pflag = split_line[7].toInt();
       }
 
 
       if (nstr > 8) {
-        data.reeca1_pqflag = atoi(split_line[8].c_str());
+        data.reeca1_pqflag = split_line[8].toInt();
       } 
 
 // J parameters start here
       if (nstr > 9) {
-        data.reeca1_vdip = atof(split_line[9].c_str());
+        data.reeca1_vdip = split_line[9].toDouble();
       } 
 
 
       if (nstr > 10) {
-        data.reeca1_vup = atof(split_line[10].c_str());
+        data.reeca1_vup = split_line[10].toDouble();
       } 
 
       if (nstr > 11) {
-        data.reeca1_trv = atof(split_line[11].c_str());
+        data.reeca1_trv = split_line[11].toDouble();
       } 
 
 
       if (nstr > 12) {
-        data.reeca1_dbd1 = atof(split_line[12].c_str());
+        data.reeca1_dbd1 = split_line[12].toDouble();
       } 
 
 
       if (nstr > 13) {
-        data.reeca1_dbd2 = atof(split_line[13].c_str());
+        data.reeca1_dbd2 = split_line[13].toDouble();
       } 
 
 
       if (nstr > 14) {
-        data.reeca1_kqv = atof(split_line[14].c_str());
+        data.reeca1_kqv = split_line[14].toDouble();
       } 
 
 
       if (nstr > 15) {
-        data.reeca1_lqh1 = atof(split_line[15].c_str());
+        data.reeca1_lqh1 = split_line[15].toDouble();
       } 
 	  
 	  if (nstr > 16) {
-        data.reeca1_lql1 = atof(split_line[16].c_str());
+        data.reeca1_lql1 = split_line[16].toDouble();
       } 
 	  
 	  if (nstr > 17) {
-        data.reeca1_vref0 = atof(split_line[17].c_str());
+        data.reeca1_vref0 = split_line[17].toDouble();
       } 
 	  
 	  	  if (nstr >  18) {
-        data.reeca1_lqfrz = atof(split_line[ 18 ].c_str());
+        data.reeca1_lqfrz = split_line[18].toDouble();
       } 
 	  
 	  if (nstr >  19) {
-        data.reeca1_thld = atof(split_line[ 19 ].c_str());
+        data.reeca1_thld = split_line[19].toDouble();
       } 
 	  
 	  if (nstr >  20) {
-        data.reeca1_thld2 = atof(split_line[ 20 ].c_str());
+        data.reeca1_thld2 = split_line[20].toDouble();
       } 
 	  
 	  if (nstr >  21) {
-        data.reeca1_tp = atof(split_line[ 21 ].c_str());
+        data.reeca1_tp = split_line[21].toDouble();
       } 
 	  
 	  if (nstr >  22) {
-        data.reeca1_qmax = atof(split_line[ 22 ].c_str());
+        data.reeca1_qmax = split_line[22].toDouble();
       } 
 	  
 	  if (nstr >  23) {
-        data.reeca1_qmin = atof(split_line[ 23 ].c_str());
+        data.reeca1_qmin = split_line[23].toDouble();
       } 
 	  
 	  if (nstr >  24) {
-        data.reeca1_vmax = atof(split_line[ 24 ].c_str());
+        data.reeca1_vmax = split_line[24].toDouble();
       } 
 	  
 	  if (nstr >  25) {
-        data.reeca1_vmin = atof(split_line[  25].c_str());
+        data.reeca1_vmin = split_line[25].toDouble();
       } 
 	  
 	  if (nstr >  26) {
-        data.reeca1_kqp = atof(split_line[ 26 ].c_str());
+        data.reeca1_kqp = split_line[26].toDouble();
       } 
 	  
 	  if (nstr >  27) {
-        data.reeca1_kqi = atof(split_line[  27].c_str());
+        data.reeca1_kqi = split_line[27].toDouble();
       } 
 	  
 	  if (nstr >  28) {
-        data.reeca1_kvp = atof(split_line[ 28 ].c_str());
+        data.reeca1_kvp = split_line[28].toDouble();
       } 
 	  
 	  if (nstr >  29) {
-        data.reeca1_kvi = atof(split_line[ 29 ].c_str());
+        data.reeca1_kvi = split_line[29].toDouble();
       } 
 	  
 	  if (nstr >  30) {
-        data.reeca1_vbias = atof(split_line[  30].c_str());
+        data.reeca1_vbias = split_line[30].toDouble();
       } 
 	  
 	  if (nstr >  31) {
-        data.reeca1_tiq = atof(split_line[  31].c_str());
+        data.reeca1_tiq = split_line[31].toDouble();
       } 
 	  
 	  if (nstr >  32) {
-        data.reeca1_dpmax = atof(split_line[  32].c_str());
+        data.reeca1_dpmax = split_line[32].toDouble();
       } 
 	  
 	  if (nstr >  33) {
-        data.reeca1_dpmin = atof(split_line[  33].c_str());
+        data.reeca1_dpmin = split_line[33].toDouble();
       } 
 	  
 	  if (nstr >  34) {
-        data.reeca1_pmax = atof(split_line[  34].c_str());
+        data.reeca1_pmax = split_line[34].toDouble();
       } 
 	  
 	  if (nstr >  35) {
-        data.reeca1_pmin = atof(split_line[  35].c_str());
+        data.reeca1_pmin = split_line[35].toDouble();
       } 
 	  
 	  if (nstr >  36) {
-        data.reeca1_imax = atof(split_line[ 36 ].c_str());
+        data.reeca1_imax = split_line[36].toDouble();
       } 
 	  
 	  if (nstr >  37 ) {
-        data.reeca1_tpord = atof(split_line[ 37].c_str());
+        data.reeca1_tpord = split_line[37].toDouble();
       } 
 	  
 	  if (nstr >   38) {
-        data.reeca1_vq1 = atof(split_line[ 38 ].c_str());
+        data.reeca1_vq1 = split_line[38].toDouble();
       } 
 	  
 	  if (nstr >   39) {
-        data.reeca1_iq1 = atof(split_line[ 39 ].c_str());
+        data.reeca1_iq1 = split_line[39].toDouble();
       } 
 	  
 	  if (nstr >   40) {
-        data.reeca1_vq2 = atof(split_line[ 40].c_str());
+        data.reeca1_vq2 = split_line[40].toDouble();
       } 
 	  
 	  if (nstr >   41) {
-        data.reeca1_iq2 = atof(split_line[ 41].c_str());
+        data.reeca1_iq2 = split_line[41].toDouble();
       } 
 	  
 	  if (nstr >   42) {
-        data.reeca1_vq3 = atof(split_line[ 42].c_str());
+        data.reeca1_vq3 = split_line[42].toDouble();
       } 
 	  
 	  if (nstr >   43) {
-        data.reeca1_iq3 = atof(split_line[ 43].c_str());
+        data.reeca1_iq3 = split_line[43].toDouble();
       } 
 	  
 	  if (nstr >   44) {
-        data.reeca1_vq4 = atof(split_line[ 44].c_str());
+        data.reeca1_vq4 = split_line[44].toDouble();
       } 
 	  
 	  if (nstr >   45) {
-        data.reeca1_iq4 = atof(split_line[ 45].c_str());
+        data.reeca1_iq4 = split_line[45].toDouble();
       } 
 	  
 	  if (nstr >   46) {
-        data.reeca1_vp1 = atof(split_line[ 46].c_str());
+        data.reeca1_vp1 = split_line[46].toDouble();
       } 
 	  
 	  if (nstr >   47) {
-        data.reeca1_ip1 = atof(split_line[ 47].c_str());
+        data.reeca1_ip1 = split_line[47].toDouble();
       } 
 	  
 	  if (nstr >   48) {
-        data.reeca1_vp2 = atof(split_line[ 48].c_str());
+        data.reeca1_vp2 = split_line[48].toDouble();
       } 
 	  
 	  if (nstr >   49) {
-        data.reeca1_ip2 = atof(split_line[ 49].c_str());
+        data.reeca1_ip2 = split_line[49].toDouble();
       } 
 	  
 	  if (nstr >  50 ) {
-        data.reeca1_vp3 = atof(split_line[ 50].c_str());
+        data.reeca1_vp3 = split_line[50].toDouble();
       } 
 	  
 	  if (nstr >  51 ) {
-        data.reeca1_ip3 = atof(split_line[ 51].c_str());
+        data.reeca1_ip3 = split_line[51].toDouble();
       } 
 	  
 	  if (nstr >  52 ) {
-        data.reeca1_vp4 = atof(split_line[ 52].c_str());
+        data.reeca1_vp4 = split_line[52].toDouble();
       } 
 	  
 	  if (nstr >  53 ) {
-        data.reeca1_ip4 = atof(split_line[ 53].c_str());
+        data.reeca1_ip4 = split_line[53].toDouble();
       } 
 	  
 	  
@@ -11,6 +11,7 @@
 #define REGCA1_HPP
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
+#include "gridpack/parser/psse_tokenizer.hpp"
 #include "gridpack/utilities/string_utils.hpp"
 namespace gridpack {
 namespace parser {
@@ -149,7 +150,7 @@ template <class _data_struct> class Regca1Parser
      * @param data data collection object
      * @param gen_id index of generator
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const std::vector<PSSEToken> &split_line,
         gridpack::component::DataCollection *data, int g_id)
     {
       double rval;
@@ -157,7 +158,7 @@ template <class _data_struct> class Regca1Parser
       // GENERATOR_MODEL              "MODEL"                  string
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted().str();
       util.toUpper(model);
       if (!data->getValue(GENERATOR_MODEL, &stmp, g_id)) {
         data->addValue(GENERATOR_MODEL, model.c_str(), g_id);
@@ -168,134 +169,134 @@ template <class _data_struct> class Regca1Parser
       int ival;
       if (nstr > 3) {
         if (!data->getValue(GENERATOR_REGC_LVPLSW,&ival,g_id)) {
-          data->addValue(GENERATOR_REGC_LVPLSW, atoi(split_line[3].c_str()), g_id);
+          data->addValue(GENERATOR_REGC_LVPLSW, split_line[3].toInt(), g_id);
         } else {
-          data->setValue(GENERATOR_REGC_LVPLSW, atoi(split_line[3].c_str()), g_id);
+          data->setValue(GENERATOR_REGC_LVPLSW, split_line[3].toInt(), g_id);
         }
       } 
 
       if (nstr > 4) {
         if (!data->getValue(GENERATOR_REGC_TG,&rval,g_id)) {
-          data->addValue(GENERATOR_REGC_TG, atof(split_line[4].c_str()), g_id);
+          data->addValue(GENERATOR_REGC_TG, split_line[4].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REGC_TG, atof(split_line[4].c_str()), g_id);
+          data->setValue(GENERATOR_REGC_TG, split_line[4].toDouble(), g_id);
         }
       } 
 
 
       if (nstr > 5) {
         if (!data->getValue(GENERATOR_REGC_RRPWR,&rval,g_id)) {
-          data->addValue(GENERATOR_REGC_RRPWR, atof(split_line[5].c_str()), g_id);
+          data->addValue(GENERATOR_REGC_RRPWR, split_line[5].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REGC_RRPWR, atof(split_line[5].c_str()), g_id);
+          data->setValue(GENERATOR_REGC_RRPWR, split_line[5].toDouble(), g_id);
         }
       } 
 
 
       if (nstr > 6) {
         if (!data->getValue(GENERATOR_REGC_BRKPT,&rval,g_id)) {
-          data->addValue(GENERATOR_REGC_BRKPT, atof(split_line[6].c_str()), g_id);
+          data->addValue(GENERATOR_REGC_BRKPT, split_line[6].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REGC_BRKPT, atof(split_line[6].c_str()), g_id);
+          data->setValue(GENERATOR_REGC_BRKPT, split_line[6].toDouble(), g_id);
         }
       } 
 
 
       if (nstr > 7) {
         if (!data->getValue(GENERATOR_REGC_ZEROX,&rval,g_id)) {
-          data->addValue(GENERATOR_REGC_ZEROX, atof(split_line[7].c_str()), g_id);
+          data->addValue(GENERATOR_REGC_ZEROX, split_line[7].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REGC_ZEROX, atof(split_line[7].c_str()), g_id);
+          data->setValue(GENERATOR_REGC_ZEROX, split_line[7].toDouble(), g_id);
         }
       }
 
 
       if (nstr > 8) {
         if (!data->getValue(GENERATOR_REGC_LVPL1,&rval,g_id)) {
-          data->addValue(GENERATOR_REGC_LVPL1, atof(split_line[8].c_str()), g_id);
+          data->addValue(GENERATOR_REGC_LVPL1, split_line[8].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REGC_LVPL1, atof(split_line[8].c_str()), g_id);
+          data->setValue(GENERATOR_REGC_LVPL1, split_line[8].toDouble(), g_id);
         }
       } 
 
 
       if (nstr > 9) {
         if (!data->getValue(GENERATOR_REGC_VOLIM,&rval,g_id)) {
-          data->addValue(GENERATOR_REGC_VOLIM, atof(split_line[9].c_str()), g_id);
+          data->addValue(GENERATOR_REGC_VOLIM, split_line[9].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REGC_VOLIM, atof(split_line[9].c_str()), g_id);
+          data->setValue(GENERATOR_REGC_VOLIM, split_line[9].toDouble(), g_id);
         }
       } 
 
 
       if (nstr > 10) {
         if (!data->getValue(GENERATOR_REGC_LVPNT1,&rval,g_id)) {
-          data->addValue(GENERATOR_REGC_LVPNT1, atof(split_line[10].c_str()), g_id);
+          data->addValue(GENERATOR_REGC_LVPNT1, split_line[10].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REGC_LVPNT1, atof(split_line[10].c_str()), g_id);
+          data->setValue(GENERATOR_REGC_LVPNT1, split_line[10].toDouble(), g_id);
         }
       } 
 
 
       if (nstr > 11) {
         if (!data->getValue(GENERATOR_REGC_LVPNT0,&rval,g_id)) {
-          data->addValue(GENERATOR_REGC_LVPNT0, atof(split_line[11].c_str()), g_id);
+          data->addValue(GENERATOR_REGC_LVPNT0, split_line[11].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REGC_LVPNT0, atof(split_line[11].c_str()), g_id);
+          data->setValue(GENERATOR_REGC_LVPNT0, split_line[11].toDouble(), g_id);
         }
       } 
 
 
       if (nstr > 12) {
         if (!data->getValue(GENERATOR_REGC_LOLIM,&rval,g_id)) {
-          data->addValue(GENERATOR_REGC_LOLIM, atof(split_line[12].c_str()), g_id);
+          data->addValue(GENERATOR_REGC_LOLIM, split_line[12].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REGC_LOLIM, atof(split_line[12].c_str()), g_id);
+          data->setValue(GENERATOR_REGC_LOLIM, split_line[12].toDouble(), g_id);
         }
       } 
 
       if (nstr > 13) {
         if (!data->getValue(GENERATOR_REGC_TFLTR,&rval,g_id)) {
           data->addValue(GENERATOR_REGC_TFLTR,
-              atof(split_line[13].c_str()), g_id);
+              split_line[13].toDouble(), g_id);
         } else {
           data->setValue(GENERATOR_REGC_TFLTR,
-              atof(split_line[13].c_str()), g_id);
+              split_line[13].toDouble(), g_id);
         }
       } 
 
 
       if (nstr > 14) {
         if (!data->getValue(GENERATOR_REGC_KHV,&rval,g_id)) {
-          data->addValue(GENERATOR_REGC_KHV, atof(split_line[14].c_str()), g_id);
+          data->addValue(GENERATOR_REGC_KHV, split_line[14].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REGC_KHV, atof(split_line[14].c_str()), g_id);
+          data->setValue(GENERATOR_REGC_KHV, split_line[14].toDouble(), g_id);
         }
       } 
 
 
       if (nstr > 15) {
         if (!data->getValue(GENERATOR_REGC_IQRMAX,&rval,g_id)) {
-          data->addValue(GENERATOR_REGC_IQRMAX, atof(split_line[15].c_str()), g_id);
+          data->addValue(GENERATOR_REGC_IQRMAX, split_line[15].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REGC_IQRMAX, atof(split_line[15].c_str()), g_id);
+          data->setValue(GENERATOR_REGC_IQRMAX, split_line[15].toDouble(), g_id);
         }
       } 
 	  
 
       if (nstr > 16) {
         if (!data->getValue(GENERATOR_REGC_IQRMIN,&rval,g_id)) {
-          data->addValue(GENERATOR_REGC_IQRMIN, atof(split_line[16].c_str()), g_id);
+          data->addValue(GENERATOR_REGC_IQRMIN, split_line[16].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REGC_IQRMIN, atof(split_line[16].c_str()), g_id);
+          data->setValue(GENERATOR_REGC_IQRMIN, split_line[16].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr > 17) {
         if (!data->getValue(GENERATOR_REGC_ACCEL,&rval,g_id)) {
-          data->addValue(GENERATOR_REGC_ACCEL, atof(split_line[17].c_str()), g_id);
+          data->addValue(GENERATOR_REGC_ACCEL, split_line[17].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REGC_ACCEL, atof(split_line[17].c_str()), g_id);
+          data->setValue(GENERATOR_REGC_ACCEL, split_line[17].toDouble(), g_id);
         }
       } 
 	  
@@ -306,21 +307,21 @@ template <class _data_struct> class Regca1Parser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const std::vector<PSSEToken> &split_line,_data_struct &data)
     {
       // GENERATOR_BUSNUMBER               "I"                   integer
       int o_idx;
-      o_idx = atoi(split_line[0].c_str());
+      o_idx = split_line[0].toInt();
       data.bus_id = o_idx;
 
       // Clean up 2 character tag for generator ID
       gridpack::utility::StringUtils util;
-      std::string tag = util.clean2Char(split_line[2]);
+      std::string tag = split_line[2].tag();
       strcpy(data.gen_id, tag.c_str());
 
       std::string sval;
 
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted().str();
       util.toUpper(sval);
 
       // GENERATOR_MODEL              "MODEL"                  integer
@@ -329,74 +330,74 @@ template <class _data_struct> class Regca1Parser
       int nstr = split_line.size();
      
       if (nstr > 3) {
-        data.regc_lvplsw = atoi(split_line[3].c_str());
+        data.regc_lvplsw = split_line[3].toInt();
       } 
 
      
       if (nstr > 4) {
-        data.regc_tg = atof(split_line[4].c_str());
+        data.regc_tg = split_line[4].toDouble();
       } 
 
     
       if (nstr > 5) {
-        data.regc_rrpwr = atof(split_line[5].c_str());
+        data.regc_rrpwr = split_line[5].toDouble();
       } 
 
                              
       if (nstr > 6) {
-        data.regc_brkpt = atof(split_line[6].c_str());
+        data.regc_brkpt = split_line[6].toDouble();
       } 
 
 
       if (nstr > 7) {
-        data.regc_zerox = atof(split_line[7].c_str());
+        data.regc_zerox = split_line[7].toDouble();
       }
 
 
       if (nstr > 8) {
-        data.regc_lvpl1 = atof(split_line[8].c_str());
+        data.regc_lvpl1 = split_line[8].toDouble();
       } 
 
 
       if (nstr > 9) {
-        data.regc_volim = atof(split_line[9].c_str());
+        data.regc_volim = split_line[9].toDouble();
       } 
 
 
       if (nstr > 10) {
-        data.regc_lvpnt1 = atof(split_line[10].c_str());
+        data.regc_lvpnt1 = split_line[10].toDouble();
       } 
 
       if (nstr > 11) {
-        data.regc_lvpnt0 = atof(split_line[11].c_str());
+        data.regc_lvpnt0 = split_line[11].toDouble();
       } 
 
 
       if (nstr > 12) {
-        data.regc_lolim = atof(split_line[12].c_str());
+        data.regc_lolim = split_line[12].toDouble();
       } 
 
 
       if (nstr > 13) {
-        data.regc_tfltr = atof(split_line[13].c_str());
+        data.regc_tfltr = split_line[13].toDouble();
       } 
 
 
       if (nstr > 14) {
-        data.regc_khv = atof(split_line[14].c_str());
+        data.regc_khv = split_line[14].toDouble();
       } 
 
 
       if (nstr > 15) {
-        data.regc_iqrmax = atof(split_line[15].c_str());
+        data.regc_iqrmax = split_line[15].toDouble();
       } 
 	  
       if (nstr > 16) {
-        data.regc_iqrmin = atof(split_line[16].c_str());
+        data.regc_iqrmin = split_line[16].toDouble();
       } 
 	  
 	  if (nstr > 17) {
-        data.regc_accel = atof(split_line[17].c_str());
+        data.regc_accel = split_line[17].toDouble();
       } 
     }
 	
@@ -11,6 +11,7 @@
 #define REGCB1_HPP
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
+#include "gridpack/parser/psse_tokenizer.hpp"
 #include "gridpack/utilities/string_utils.hpp"
 namespace gridpack {
 namespace parser {
@@ -112,7 +113,7 @@ template <class _data_struct> class Regcb1Parser
      * @param data data collection object
      * @param gen_id index of generator
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const std::vector<PSSEToken> &split_line,
         gridpack::component::DataCollection *data, int g_id)
     {
       double rval;
@@ -120,7 +121,7 @@ template <class _data_struct> class Regcb1Parser
       // GENERATOR_MODEL              "MODEL"                  string
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted().str();
       util.toUpper(model);
       if (!data->getValue(GENERATOR_MODEL, &stmp, g_id)) {
         data->addValue(GENERATOR_MODEL, model.c_str(), g_id);
@@ -131,75 +132,75 @@ template <class _data_struct> class Regcb1Parser
       int ival;
       if (nstr > 3) {
         if (!data->getValue(GENERATOR_REGC_RATEFLAG,&ival,g_id)) {
-          data->addValue(GENERATOR_REGC_RATEFLAG, atoi(split_line[3].c_str()), g_id);
+          data->addValue(GENERATOR_REGC_RATEFLAG, split_line[3].toInt(), g_id);
         } else {
-          data->setValue(GENERATOR_REGC_RATEFLAG, atoi(split_line[3].c_str()), g_id);
+          data->setValue(GENERATOR_REGC_RATEFLAG, split_line[3].toInt(), g_id);
         }
       } 
 
       if (nstr > 4) {
         if (!data->getValue(GENERATOR_REGC_PQFLAG,&ival,g_id)) {
-          data->addValue(GENERATOR_REGC_PQFLAG, atoi(split_line[4].c_str()), g_id);
+          data->addValue(GENERATOR_REGC_PQFLAG, split_line[4].toInt(), g_id);
         } else {
-          data->setValue(GENERATOR_REGC_PQFLAG, atoi(split_line[4].c_str()), g_id);
+          data->setValue(GENERATOR_REGC_PQFLAG, split_line[4].toInt(), g_id);
         }
       } 
 
       if (nstr > 5) {
         if (!data->getValue(GENERATOR_REGC_TG,&rval,g_id)) {
-          data->addValue(GENERATOR_REGC_TG, atof(split_line[5].c_str()), g_id);
+          data->addValue(GENERATOR_REGC_TG, split_line[5].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REGC_TG, atof(split_line[5].c_str()), g_id);
+          data->setValue(GENERATOR_REGC_TG, split_line[5].toDouble(), g_id);
         }
       } 
 
 
       if (nstr > 6) {
         if (!data->getValue(GENERATOR_REGC_TFLTR,&rval,g_id)) {
-          data->addValue(GENERATOR_REGC_TFLTR, atof(split_line[6].c_str()), g_id);
+          data->addValue(GENERATOR_REGC_TFLTR, split_line[6].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REGC_TFLTR, atof(split_line[6].c_str()), g_id);
+          data->setValue(GENERATOR_REGC_TFLTR, split_line[6].toDouble(), g_id);
         }
       } 
 
       if (nstr > 7) {
         if (!data->getValue(GENERATOR_REGC_IQRMAX,&rval,g_id)) {
-          data->addValue(GENERATOR_REGC_IQRMAX, atof(split_line[7].c_str()), g_id);
+          data->addValue(GENERATOR_REGC_IQRMAX, split_line[7].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REGC_IQRMAX, atof(split_line[7].c_str()), g_id);
+          data->setValue(GENERATOR_REGC_IQRMAX, split_line[7].toDouble(), g_id);
         }
       } 
 	  
 
       if (nstr > 8) {
         if (!data->getValue(GENERATOR_REGC_IQRMIN,&rval,g_id)) {
-          data->addValue(GENERATOR_REGC_IQRMIN, atof(split_line[8].c_str()), g_id);
+          data->addValue(GENERATOR_REGC_IQRMIN, split_line[8].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REGC_IQRMIN, atof(split_line[8].c_str()), g_id);
+          data->setValue(GENERATOR_REGC_IQRMIN, split_line[8].toDouble(), g_id);
         }
       } 
 
       if (nstr > 9) {
         if (!data->getValue(GENERATOR_REGC_RRPWR,&rval,g_id)) {
-          data->addValue(GENERATOR_REGC_RRPWR, atof(split_line[9].c_str()), g_id);
+          data->addValue(GENERATOR_REGC_RRPWR, split_line[9].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REGC_RRPWR, atof(split_line[9].c_str()), g_id);
+          data->setValue(GENERATOR_REGC_RRPWR, split_line[9].toDouble(), g_id);
         }
       }
 
       if (nstr > 10) {
         if (!data->getValue(GENERATOR_REGC_TE,&rval,g_id)) {
-          data->addValue(GENERATOR_REGC_TE, atof(split_line[10].c_str()), g_id);
+          data->addValue(GENERATOR_REGC_TE, split_line[10].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REGC_TE, atof(split_line[10].c_str()), g_id);
+          data->setValue(GENERATOR_REGC_TE, split_line[10].toDouble(), g_id);
         }
       } 
 
       if (nstr > 11) {
         if (!data->getValue(GENERATOR_REGC_IMAX,&rval,g_id)) {
-          data->addValue(GENERATOR_REGC_IMAX, atof(split_line[11].c_str()), g_id);
+          data->addValue(GENERATOR_REGC_IMAX, split_line[11].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REGC_IMAX, atof(split_line[11].c_str()), g_id);
+          data->setValue(GENERATOR_REGC_IMAX, split_line[11].toDouble(), g_id);
         }
       } 
     }
@@ -209,21 +210,21 @@ template <class _data_struct> class Regcb1Parser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const std::vector<PSSEToken> &split_line,_data_struct &data)
     {
       // GENERATOR_BUSNUMBER               "I"                   integer
       int o_idx;
-      o_idx = atoi(split_line[0].c_str());
+      o_idx = split_line[0].toInt();
       data.bus_id = o_idx;
 
       // Clean up 2 character tag for generator ID
       gridpack::utility::StringUtils util;
-      std::string tag = util.clean2Char(split_line[2]);
+      std::string tag = split_line[2].tag();
       strcpy(data.gen_id, tag.c_str());
 
       std::string sval;
 
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted().str();
       util.toUpper(sval);
 
       // GENERATOR_MODEL              "MODEL"                  integer
@@ -232,39 +233,39 @@ template <class _data_struct> class Regcb1Parser
       int nstr = split_line.size();
      
       if (nstr > 3) {
-        data.regc_rateflag = atoi(split_line[3].c_str());
+        data.regc_rateflag = split_line[3].toInt();
       } 
 
       if (nstr > 4) {
-        data.regc_pqflag = atoi(split_line[4].c_str());
+        data.regc_pqflag = split_line[4].toInt();
       } 
 
       if (nstr > 5) {
-        data.regc_tg = atof(split_line[5].c_str());
+        data.regc_tg = split_line[5].toDouble();
       } 
 
       if (nstr > 6) {
-        data.regc_tfltr = atof(split_line[6].c_str());
+        data.regc_tfltr = split_line[6].toDouble();
       } 
 
       if (nstr > 7) {
-        data.regc_iqrmax = atof(split_line[7].c_str());
+        data.regc_iqrmax = split_line[7].toDouble();
       } 
 	  
       if (nstr > 8) {
-        data.regc_iqrmin = atof(split_line[8].c_str());
+        data.regc_iqrmin = split_line[8].toDouble();
       } 
     
       if (nstr > 9) {
-        data.regc_rrpwr = atof(split_line[9].c_str());
+        data.regc_rrpwr = split_line[9].toDouble();
       } 
 
       if (nstr > 10) {
-        data.regc_te = atof(split_line[10].c_str());
+        data.regc_te = split_line[10].toDouble();
       } 
 	  
       if (nstr > 11) {
-        data.regc_imax = atof(split_line[11].c_str());
+        data.regc_imax = split_line[11].toDouble();
       } 
     }
 	
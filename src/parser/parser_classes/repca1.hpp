@@ -11,6 +11,7 @@
 #define REPCA1_HPP
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
+#include "gridpack/parser/psse_tokenizer.hpp"
 #include "gridpack/utilities/string_utils.hpp"
 namespace gridpack {
 namespace parser {
@@ -274,7 +275,7 @@ template <class _data_struct> class Repca1Parser
      * @param data data collection object
      * @param gen_id index of generator
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const std::vector<PSSEToken> &split_line,
         gridpack::component::DataCollection *data, int g_id)
     {
       double rval;
@@ -290,7 +291,7 @@ template <class _data_struct> class Repca1Parser
       // PLANT_CONTROLLER_MODEL              "MODEL"                  string
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted().str();
       util.toUpper(model);
       if (!data->getValue(PLANT_CONTROLLER_MODEL, &stmp, g_id)) {
         data->addValue(PLANT_CONTROLLER_MODEL, model.c_str(), g_id);
@@ -301,26 +302,26 @@ template <class _data_struct> class Repca1Parser
       int ival;
       if (nstr > 3) {
         if (!data->getValue(GENERATOR_REPCA_IREG,&ival,g_id)) {
-          data->addValue(GENERATOR_REPCA_IREG, atoi(split_line[3].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_IREG, split_line[3].toInt(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_IREG, atoi(split_line[3].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_IREG, split_line[3].toInt(), g_id);
         }
       } 
 
       if (nstr > 4) {
         if (!data->getValue(GENERATOR_REPCA_BRCH_BUS_FROM,&ival,g_id)) {
-          data->addValue(GENERATOR_REPCA_BRCH_BUS_FROM, atoi(split_line[4].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_BRCH_BUS_FROM, split_line[4].toInt(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_BRCH_BUS_FROM, atoi(split_line[4].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_BRCH_BUS_FROM, split_line[4].toInt(), g_id);
         }
       } 
 
 
       if (nstr > 5) {
         if (!data->getValue(GENERATOR_REPCA_BRCH_BUS_TO,&ival,g_id)) {
-          data->addValue(GENERATOR_REPCA_BRCH_BUS_TO, atoi(split_line[5].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_BRCH_BUS_TO, split_line[5].toInt(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_BRCH_BUS_TO, atoi(split_line[5].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_BRCH_BUS_TO, split_line[5].toInt(), g_id);
         }
       } 
 
@@ -328,13 +329,13 @@ template <class _data_struct> class Repca1Parser
       if (nstr > 6) {
 		/*
         if (!data->getValue(GENERATOR_REPCA_BRCH_CKT,&ival,g_id)) {
-          data->addValue(GENERATOR_REPCA_BRCH_CKT, atoi(split_line[6].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_BRCH_CKT, split_line[6].toInt(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_BRCH_CKT, atoi(split_line[6].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_BRCH_CKT, split_line[6].toInt(), g_id);
         }
 		*/
 
-	    std::string idtmp = util.trimQuotes(split_line[6]);
+	    std::string idtmp = split_line[6].unquoted().str();
         util.toUpper(idtmp);
         if (!data->getValue(GENERATOR_REPCA_BRCH_CKT, &stmp, g_id)) {
           data->addValue(GENERATOR_REPCA_BRCH_CKT, idtmp.c_str(), g_id);
@@ -346,27 +347,27 @@ template <class _data_struct> class Repca1Parser
 
       if (nstr > 7) {
         if (!data->getValue(GENERATOR_REPCA_VC_FLAG,&ival,g_id)) {
-          data->addValue(GENERATOR_REPCA_VC_FLAG, atoi(split_line[7].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_VC_FLAG, split_line[7].toInt(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_VC_FLAG, atoi(split_line[7].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_VC_FLAG, split_line[7].toInt(), g_id);
         }
       }
 
 
       if (nstr > 8) {
         if (!data->getValue(GENERATOR_REPCA_REF_FLAG,&ival,g_id)) {
-          data->addValue(GENERATOR_REPCA_REF_FLAG, atoi(split_line[8].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_REF_FLAG, split_line[8].toInt(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_REF_FLAG, atoi(split_line[8].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_REF_FLAG, split_line[8].toInt(), g_id);
         }
       } 
 
 
       if (nstr > 9) {
         if (!data->getValue(GENERATOR_REPCA_F_FLAG,&ival,g_id)) {
-          data->addValue(GENERATOR_REPCA_F_FLAG, atoi(split_line[9].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_F_FLAG, split_line[9].toInt(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_F_FLAG, atoi(split_line[9].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_F_FLAG, split_line[9].toInt(), g_id);
         }
       } 
 
@@ -374,224 +375,224 @@ template <class _data_struct> class Repca1Parser
 
       if (nstr > 10) {
         if (!data->getValue(GENERATOR_REPCA_TFLTR,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_TFLTR, atof(split_line[10].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_TFLTR, split_line[10].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_TFLTR, atof(split_line[10].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_TFLTR, split_line[10].toDouble(), g_id);
         }
       } 
 
 
       if (nstr > 11) {
         if (!data->getValue(GENERATOR_REPCA_KP,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_KP, atof(split_line[11].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_KP, split_line[11].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_KP, atof(split_line[11].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_KP, split_line[11].toDouble(), g_id);
         }
       } 
 
 
       if (nstr > 12) {
         if (!data->getValue(GENERATOR_REPCA_KI,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_KI, atof(split_line[12].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_KI, split_line[12].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_KI, atof(split_line[12].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_KI, split_line[12].toDouble(), g_id);
         }
       } 
 
       if (nstr > 13) {
         if (!data->getValue(GENERATOR_REPCA_TFT,&rval,g_id)) {
           data->addValue(GENERATOR_REPCA_TFT,
-              atof(split_line[13].c_str()), g_id);
+              split_line[13].toDouble(), g_id);
         } else {
           data->setValue(GENERATOR_REPCA_TFT,
-              atof(split_line[13].c_str()), g_id);
+              split_line[13].toDouble(), g_id);
         }
       } 
 
 
       if (nstr > 14) {
         if (!data->getValue(GENERATOR_REPCA_TFV,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_TFV, atof(split_line[14].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_TFV, split_line[14].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_TFV, atof(split_line[14].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_TFV, split_line[14].toDouble(), g_id);
         }
       } 
 
 
       if (nstr > 15) {
         if (!data->getValue(GENERATOR_REPCA_VFRZ,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_VFRZ, atof(split_line[15].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_VFRZ, split_line[15].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_VFRZ, atof(split_line[15].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_VFRZ, split_line[15].toDouble(), g_id);
         }
       } 
 	  
 
       if (nstr > 16) {
         if (!data->getValue(GENERATOR_REPCA_RC,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_RC, atof(split_line[16].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_RC, split_line[16].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_RC, atof(split_line[16].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_RC, split_line[16].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr > 17) {
         if (!data->getValue(GENERATOR_REPCA_XC,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_XC, atof(split_line[17].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_XC, split_line[17].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_XC, atof(split_line[17].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_XC, split_line[17].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr > 18  ) {
         if (!data->getValue(GENERATOR_REPCA_KC,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_KC, atof(split_line[ 18].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_KC, split_line[18].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_KC, atof(split_line[ 18].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_KC, split_line[18].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  19 ) {
         if (!data->getValue(GENERATOR_REPCA_EMAX,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_EMAX, atof(split_line[ 19].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_EMAX, split_line[19].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_EMAX, atof(split_line[ 19].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_EMAX, split_line[19].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  20 ) {
         if (!data->getValue(GENERATOR_REPCA_EMIN,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_EMIN, atof(split_line[ 20].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_EMIN, split_line[20].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_EMIN, atof(split_line[ 20].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_EMIN, split_line[20].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  21 ) {
         if (!data->getValue(GENERATOR_REPCA_DBD1,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_DBD1, atof(split_line[ 21].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_DBD1, split_line[21].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_DBD1, atof(split_line[ 21].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_DBD1, split_line[21].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  22 ) {
         if (!data->getValue(GENERATOR_REPCA_DBD2,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_DBD2, atof(split_line[ 22].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_DBD2, split_line[22].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_DBD2, atof(split_line[ 22].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_DBD2, split_line[22].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  23 ) {
         if (!data->getValue(GENERATOR_REPCA_QMAX,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_QMAX, atof(split_line[ 23].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_QMAX, split_line[23].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_QMAX, atof(split_line[ 23].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_QMAX, split_line[23].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  24 ) {
         if (!data->getValue(GENERATOR_REPCA_QMIN,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_QMIN, atof(split_line[ 24].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_QMIN, split_line[24].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_QMIN, atof(split_line[ 24].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_QMIN, split_line[24].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  25 ) {
         if (!data->getValue(GENERATOR_REPCA_KPG,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_KPG, atof(split_line[ 25].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_KPG, split_line[25].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_KPG, atof(split_line[ 25].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_KPG, split_line[25].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  26 ) {
         if (!data->getValue(GENERATOR_REPCA_KIG,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_KIG, atof(split_line[ 26].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_KIG, split_line[26].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_KIG, atof(split_line[ 26].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_KIG, split_line[26].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  27 ) {
         if (!data->getValue(GENERATOR_REPCA_TP,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_TP, atof(split_line[ 27].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_TP, split_line[27].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_TP, atof(split_line[ 27].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_TP, split_line[27].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  28 ) {
         if (!data->getValue(GENERATOR_REPCA_FDBD1,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_FDBD1, atof(split_line[ 28].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_FDBD1, split_line[28].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_FDBD1, atof(split_line[ 28].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_FDBD1, split_line[28].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  29 ) {
         if (!data->getValue(GENERATOR_REPCA_FDBD2,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_FDBD2, atof(split_line[ 29].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_FDBD2, split_line[29].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_FDBD2, atof(split_line[ 29].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_FDBD2, split_line[29].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  30 ) {
         if (!data->getValue(GENERATOR_REPCA_FEMAX,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_FEMAX, atof(split_line[ 30].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_FEMAX, split_line[30].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_FEMAX, atof(split_line[ 30].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_FEMAX, split_line[30].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  31 ) {
         if (!data->getValue(GENERATOR_REPCA_FEMIN,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_FEMIN, atof(split_line[ 31].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_FEMIN, split_line[31].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_FEMIN, atof(split_line[ 32].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_FEMIN, split_line[32].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  32 ) {
         if (!data->getValue(GENERATOR_REPCA_PMAX,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_PMAX, atof(split_line[ 32].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_PMAX, split_line[32].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_PMAX, atof(split_line[ 32].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_PMAX, split_line[32].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  33 ) {
         if (!data->getValue(GENERATOR_REPCA_PMIN,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_PMIN, atof(split_line[ 33].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_PMIN, split_line[33].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_PMIN, atof(split_line[ 33].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_PMIN, split_line[33].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >  34 ) {
         if (!data->getValue(GENERATOR_REPCA_TG,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_TG, atof(split_line[ 34].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_TG, split_line[34].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_TG, atof(split_line[ 34].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_TG, split_line[34].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >   35) {
         if (!data->getValue(GENERATOR_REPCA_DDN,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_DDN, atof(split_line[ 35].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_DDN, split_line[35].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_DDN, atof(split_line[ 35].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_DDN, split_line[35].toDouble(), g_id);
         }
       } 
 	  
 	  if (nstr >   36) {
         if (!data->getValue(GENERATOR_REPCA_DUP,&rval,g_id)) {
-          data->addValue(GENERATOR_REPCA_DUP, atof(split_line[ 36].c_str()), g_id);
+          data->addValue(GENERATOR_REPCA_DUP, split_line[36].toDouble(), g_id);
         } else {
-          data->setValue(GENERATOR_REPCA_DUP, atof(split_line[ 36].c_str()), g_id);
+          data->setValue(GENERATOR_REPCA_DUP, split_line[36].toDouble(), g_id);
         }
       } 
 	  
@@ -602,21 +603,21 @@ template <class _data_struct> class Repca1Parser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const std::vector<PSSEToken> &split_line,_data_struct &data)
     {
       // GENERATOR_BUSNUMBER               "I"                   integer
       int o_idx;
-      o_idx = atoi(split_line[0].c_str());
+      o_idx = split_line[0].toInt();
       data.bus_id = o_idx;
 
       // Clean up 2 character tag for generator ID
       gridpack::utility::StringUtils util;
-      std::string tag = util.clean2Char(split_line[2]);
+      std::string tag = split_line[2].tag();
       strcpy(data.gen_id, tag.c_str());
 
       std::string sval;
 
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted().str();
       util.toUpper(sval);
 
       // GENERATOR_MODEL              "MODEL"                  integer
@@ -625,152 +626,152 @@ template <class _data_struct> class Repca1Parser
       int nstr = split_line.size();
      
       if (nstr > 3) {
-        data.repca1_ireg = atoi(split_line[3].c_str());
+        data.repca1_ireg = split_line[3].toInt();
       } 
 
      
       if (nstr > 4) {
-        data.repca1_brh_bus_from = atoi(split_line[4].c_str());
+        data.repca1_brh_bus_from = split_line[4].toInt();
       } 
 
     
       if (nstr > 5) {
-        data.repca1_brh_bus_to = atoi(split_line[5].c_str());
+        data.repca1_brh_bus_to = split_line[5].toInt();
       } 
 
                              
       if (nstr > 6) {
-		tag = util.clean2Char(split_line[6]);
+		tag = split_line[6].tag();
         strcpy(data.repca1_brh_ckt, tag.c_str());
       } 
 
 
       if (nstr > 7) {
-        data.repca1_vcflag = atoi(split_line[7].c_str());
+        data.repca1_vcflag = split_line[7].toInt();
       }
 
 
       if (nstr > 8) {
-        data.repca1_refflag = atoi(split_line[8].c_str());
+        data.repca1_refflag = split_line[8].toInt();
       } 
 
 
       if (nstr > 9) {
-        data.repca1_fflag = atoi(split_line[9].c_str());
+        data.repca1_fflag = split_line[9].toInt();
       } 
 
 /// start J parameters here
 
       if (nstr > 10) {
-        data.repca1_tfltr = atof(split_line[10].c_str());
+        data.repca1_tfltr = split_line[10].toDouble();
       } 
 
       if (nstr > 11) {
-        data.repca1_kp = atof(split_line[11].c_str());
+        data.repca1_kp = split_line[11].toDouble();
       } 
 
 
       if (nstr > 12) {
-        data.repca1_ki = atof(split_line[12].c_str());
+        data.repca1_ki = split_line[12].toDouble();
       } 
 
 
       if (nstr > 13) {
-        data.repca1_tft = atof(split_line[13].c_str());
+        data.repca1_tft = split_line[13].toDouble();
       } 
 
 
       if (nstr > 14) {
-        data.repca1_tfv = atof(split_line[14].c_str());
+        data.repca1_tfv = split_line[14].toDouble();
       } 
 
 
       if (nstr > 15) {
-        data.repca1_vfrz = atof(split_line[15].c_str());
+        data.repca1_vfrz = split_line[15].toDouble();
       } 
 	  
 	  if (nstr > 16) {
-        data.repca1_rc = atof(split_line[16].c_str());
+        data.repca1_rc = split_line[16].toDouble();
       } 
 	  
 	  if (nstr > 17) {
-        data.repca1_xc = atof(split_line[17].c_str());
+        data.repca1_xc = split_line[17].toDouble();
       } 
 	  
 	  if (nstr >  18) {
-        data.repca1_kc = atof(split_line[ 18 ].c_str());
+        data.repca1_kc = split_line[18].toDouble();
       } 
 	  
 	  if (nstr >  19) {
-        data.repca1_emax = atof(split_line[ 19 ].c_str());
+        data.repca1_emax = split_line[19].toDouble();
       } 
 	  
 	  if (nstr >  20) {
-        data.repca1_emin = atof(split_line[ 20 ].c_str());
+        data.repca1_emin = split_line[20].toDouble();
       } 
 	  
 	  if (nstr >  21) {
-        data.repca1_dbd1 = atof(split_line[ 21 ].c_str());
+        data.repca1_dbd1 = split_line[21].toDouble();
       } 
 	  
 	  if (nstr >  22) {
-        data.repca1_dbd2 = atof(split_line[ 22 ].c_str());
+        data.repca1_dbd2 = split_line[22].toDouble();
       } 
 	  
 	  if (nstr >  23) {
-        data.repca1_qmax = atof(split_line[ 23 ].c_str());
+        data.repca1_qmax = split_line[23].toDouble();
       } 
 	  
 	  if (nstr >  24) {
-        data.repca1_qmin = atof(split_line[ 24 ].c_str());
+        data.repca1_qmin = split_line[24].toDouble();
       } 
 	  
 	  if (nstr >  25) {
-        data.repca1_kpg = atof(split_line[  25].c_str());
+        data.repca1_kpg = split_line[25].toDouble();
       } 
 	  
 	  if (nstr >  26) {
-        data.repca1_kig = atof(split_line[ 26 ].c_str());
+        data.repca1_kig = split_line[26].toDouble();
       } 
 	  
 	  if (nstr >  27) {
-        data.repca1_tp = atof(split_line[  27].c_str());
+        data.repca1_tp = split_line[27].toDouble();
       } 
 	  
 	  if (nstr >  28) {
-        data.repca1_fdbd1 = atof(split_line[ 28 ].c_str());
+        data.repca1_fdbd1 = split_line[28].toDouble();
       } 
 	  
 	  if (nstr >  29) {
-        data.repca1_fdbd2 = atof(split_line[ 29 ].c_str());
+        data.repca1_fdbd2 = split_line[29].toDouble();
       } 
 	  
 	  if (nstr >  30) {
-        data.repca1_femax = atof(split_line[  30].c_str());
+        data.repca1_femax = split_line[30].toDouble();
       } 
 	  
 	  if (nstr >  31) {
-        data.repca1_femin = atof(split_line[  31].c_str());
+        data.repca1_femin = split_line[31].toDouble();
       } 
 	  
 	  if (nstr >  32) {
-        data.repca1_pmax = atof(split_line[  32].c_str());
+        data.repca1_pmax = split_line[32].toDouble();
       } 
 	  
 	  if (nstr >  33) {
-        data.repca1_pmin = atof(split_line[  33].c_str());
+        data.repca1_pmin = split_line[33].toDouble();
       } 
 	  
 	  if (nstr >  34) {
-        data.repca1_tg = atof(split_line[  34].c_str());
+        data.repca1_tg = split_line[34].toDouble();
       } 
 	  
 	  if (nstr >  35) {
-        data.repca1_ddn = atof(split_line[  35].c_str());
+        data.repca1_ddn = split_line[35].toDouble();
       } 
 	  
 	  if (nstr >  36) {
-        data.repca1_dup = atof(split_line[ 36 ].c_str());
+        data.repca1_dup = split_line[36].toDouble();
       } 
 
  
@@ -11,6 +11,7 @@
 #define SEXS_HPP
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
+#include "gridpack/parser/psse_tokenizer.hpp"
 #include "gridpack/utilities/string_utils.hpp"
 namespace gridpack {
 namespace parser {
@@ -107,7 +108,7 @@ template <class _data_struct> class SexsParser
      * @param data data collection object
      * @param gen_id index of generator
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const std::vector<PSSEToken> &split_line,
         gridpack::component::DataCollection *data, int g_id)
     {
       double rval;
@@ -123,7 +124,7 @@ template <class _data_struct> class SexsParser
       // EXCITER_MODEL
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted().str();
       util.toUpper(model);
       if (!data->getValue(EXCITER_MODEL,&stmp,g_id)) {
         data->addValue(EXCITER_MODEL, model.c_str(), g_id);
@@ -135,10 +136,10 @@ template <class _data_struct> class SexsParser
       if (nstr > 3) {
         if (!data->getValue(EXCITER_TA_OVER_TB,&rval,g_id)) {
           data->addValue(EXCITER_TA_OVER_TB,
-              atof(split_line[3].c_str()), g_id);
+              split_line[3].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_TA_OVER_TB,
-              atof(split_line[3].c_str()), g_id);
+              split_line[3].toDouble(), g_id);
         }
       } 
 
@@ -146,10 +147,10 @@ template <class _data_struct> class SexsParser
       if (nstr > 4) {
         if (!data->getValue(EXCITER_TB,&rval,g_id)) {
           data->addValue(EXCITER_TB,
-              atof(split_line[4].c_str()), g_id);
+              split_line[4].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_TB,
-              atof(split_line[4].c_str()), g_id);
+              split_line[4].toDouble(), g_id);
         }
       } 
 
@@ -157,10 +158,10 @@ template <class _data_struct> class SexsParser
       if (nstr > 5) {
         if (!data->getValue(EXCITER_K,&rval,g_id)) {
           data->addValue(EXCITER_K,
-              atof(split_line[5].c_str()), g_id);
+              split_line[5].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_K,
-              atof(split_line[5].c_str()), g_id);
+              split_line[5].toDouble(), g_id);
         }
       }
 
@@ -168,10 +169,10 @@ template <class _data_struct> class SexsParser
       if (nstr > 6) {
         if (!data->getValue(EXCITER_TE,&rval,g_id)) {
           data->addValue(EXCITER_TE,
-              atof(split_line[6].c_str()), g_id);
+              split_line[6].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_TE,
-              atof(split_line[6].c_str()), g_id);
+              split_line[6].toDouble(), g_id);
         }
       }
 
@@ -179,10 +180,10 @@ template <class _data_struct> class SexsParser
       if (nstr > 7) {
         if (!data->getValue(EXCITER_EMIN,&rval,g_id)) {
           data->addValue(EXCITER_EMIN,
-              atof(split_line[7].c_str()), g_id);
+              split_line[7].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_EMIN,
-              atof(split_line[7].c_str()), g_id);
+              split_line[7].toDouble(), g_id);
         }
       }
 
@@ -190,10 +191,10 @@ template <class _data_struct> class SexsParser
       if (nstr > 8) {
         if (!data->getValue(EXCITER_EMAX,&rval,g_id)) {
           data->addValue(EXCITER_EMAX,
-              atof(split_line[8].c_str()), g_id);
+              split_line[8].toDouble(), g_id);
         } else {
           data->setValue(EXCITER_EMAX,
-              atof(split_line[8].c_str()), g_id);
+              split_line[8].toDouble(), g_id);
         }
       } 
     }
@@ -203,23 +204,23 @@ template <class _data_struct> class SexsParser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const std::vector<PSSEToken> &split_line,_data_struct &data)
     {
       // EXCITER_BUSNUMBER               "I"                   integer
       int o_idx;
-      o_idx = atoi(split_line[0].c_str());
+      o_idx = split_line[0].toInt();
       data.bus_id = o_idx;
 
       // Clean up 2 character tag for generator ID
       gridpack::utility::StringUtils util;
-      std::string tag = util.clean2Char(split_line[2]);
+      std::string tag = split_line[2].tag();
       strcpy(data.gen_id, tag.c_str());
 
       std::string sval;
       double rval;
       int ival;
 
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted().str();
       util.toUpper(sval);
 
       // EXCITER_MODEL              "MODEL"                  integer
@@ -228,32 +229,32 @@ template <class _data_struct> class SexsParser
       int nstr = split_line.size();
       // EXCITER_TA_OVER_TB
       if (nstr > 3) {
-        data.ex_ta_over_tb = atof(split_line[3].c_str());
+        data.ex_ta_over_tb = split_line[3].toDouble();
       }
 
       // EXCITER_TB
       if (nstr > 4) {
-        data.ex_tb = atof(split_line[4].c_str());
+        data.ex_tb = split_line[4].toDouble();
       }
 
       // EXCITER_K
       if (nstr > 5) {
-        data.ex_k = atof(split_line[5].c_str());
+        data.ex_k = split_line[5].toDouble();
       }
 
       // EXCITER_TE
       if (nstr > 6) {
-        data.ex_te = atof(split_line[6].c_str());
+        data.ex_te = split_line[6].toDouble();
       }
 
       // EXCITER_EMIN
       if (nstr > 7) {
-        data.ex_emin = atof(split_line[7].c_str());
+        data.ex_emin = split_line[7].toDouble();
       }
 
       // EXCITER_EMAX
       if (nstr > 8) {
-        data.ex_emax = atof(split_line[8].c_str());
+        data.ex_emax = split_line[8].toDouble();
       }
     }
 };
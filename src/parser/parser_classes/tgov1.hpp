@@ -11,6 +11,7 @@
 #define TGOV1_HPP
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
+#include "gridpack/parser/psse_tokenizer.hpp"
 #include "gridpack/utilities/string_utils.hpp"
 namespace gridpack {
 namespace parser {
@@ -113,7 +114,7 @@ template <class _data_struct> class Tgov1Parser
      * @param data data collection object
      * @param gen_id index of generator
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const std::vector<PSSEToken> &split_line,
         gridpack::component::DataCollection *data, int g_id)
     {
       double rval;
@@ -129,7 +130,7 @@ template <class _data_struct> class Tgov1Parser
       // GOVERNOR_MODEL
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted().str();
       util.toUpper(model);
       if (!data->getValue(GOVERNOR_MODEL,&stmp,g_id)) {
         data->addValue(GOVERNOR_MODEL, model.c_str(), g_id);
@@ -140,63 +141,63 @@ template <class _data_struct> class Tgov1Parser
       // GOVERNOR_R
       if (nstr > 3) {
         if (!data->getValue(GOVERNOR_R,&rval,g_id)) {
-          data->addValue(GOVERNOR_R, atof(split_line[3].c_str()), g_id);
+          data->addValue(GOVERNOR_R, split_line[3].toDouble(), g_id);
         } else {
-          data->setValue(GOVERNOR_R, atof(split_line[3].c_str()), g_id);
+          data->setValue(GOVERNOR_R, split_line[3].toDouble(), g_id);
         }
       } 
 
       // GOVERNOR_T1
       if (nstr > 4) {
         if (!data->getValue(GOVERNOR_T1,&rval,g_id)) {
-          data->addValue(GOVERNOR_T1, atof(split_line[4].c_str()), g_id);
+          data->addValue(GOVERNOR_T1, split_line[4].toDouble(), g_id);
         } else {
-          data->setValue(GOVERNOR_T1, atof(split_line[4].c_str()), g_id);
+          data->setValue(GOVERNOR_T1, split_line[4].toDouble(), g_id);
         }
       } 
 
       // GOVERNOR_VMAX
       if (nstr > 5) {
         if (!data->getValue(GOVERNOR_VMAX,&rval,g_id)) {
-          data->addValue(GOVERNOR_VMAX, atof(split_line[5].c_str()), g_id);
+          data->addValue(GOVERNOR_VMAX, split_line[5].toDouble(), g_id);
         } else {
-          data->setValue(GOVERNOR_VMAX, atof(split_line[5].c_str()), g_id);
+          data->setValue(GOVERNOR_VMAX, split_line[5].toDouble(), g_id);
         }
       } 
 
       // GOVERNOR_VMIN
       if (nstr > 6) {
         if (!data->getValue(GOVERNOR_VMIN,&rval,g_id)) {
-          data->addValue(GOVERNOR_VMIN, atof(split_line[6].c_str()), g_id);
+          data->addValue(GOVERNOR_VMIN, split_line[6].toDouble(), g_id);
         } else {
-          data->setValue(GOVERNOR_VMIN, atof(split_line[6].c_str()), g_id);
+          data->setValue(GOVERNOR_VMIN, split_line[6].toDouble(), g_id);
         }
       } 
 
       // GOVERNOR_T2
       if (nstr > 7) {
         if (!data->getValue(GOVERNOR_T2,&rval,g_id)) {
-          data->addValue(GOVERNOR_T2, atof(split_line[7].c_str()), g_id);
+          data->addValue(GOVERNOR_T2, split_line[7].toDouble(), g_id);
         } else {
-          data->setValue(GOVERNOR_T2, atof(split_line[7].c_str()), g_id);
+          data->setValue(GOVERNOR_T2, split_line[7].toDouble(), g_id);
         }
       } 
 
       // GOVERNOR_T3
       if (nstr > 8) {
         if (!data->getValue(GOVERNOR_T3,&rval,g_id)) {
-          data->addValue(GOVERNOR_T3, atof(split_line[8].c_str()), g_id);
+          data->addValue(GOVERNOR_T3, split_line[8].toDouble(), g_id);
         } else {
-          data->setValue(GOVERNOR_T3, atof(split_line[8].c_str()), g_id);
+          data->setValue(GOVERNOR_T3, split_line[8].toDouble(), g_id);
         }
       } 
 
       // GOVERNOR_DT
       if (nstr > 9) {
         if (!data->getValue(GOVERNOR_DT,&rval,g_id)) {
-          data->addValue(GOVERNOR_DT, atof(split_line[9].c_str()), g_id);
+          data->addValue(GOVERNOR_DT, split_line[9].toDouble(), g_id);
         } else {
-          data->setValue(GOVERNOR_DT, atof(split_line[9].c_str()), g_id);
+          data->setValue(GOVERNOR_DT, split_line[9].toDouble(), g_id);
         }
       } 
     }
@@ -206,20 +207,20 @@ template <class _data_struct> class Tgov1Parser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const std::vector<PSSEToken> &split_line,_data_struct &data)
     {
       // GOVERNOR_BUSNUMBER               "I"                   integer
       int o_idx;
-      o_idx = atoi(split_line[0].c_str());
+      o_idx = split_line[0].toInt();
       data.bus_id = o_idx;
 
       // Clean up 2 character tag for generator ID
       gridpack::utility::StringUtils util;
-      std::string tag = util.clean2Char(split_line[2]);
+      std::string tag = split_line[2].tag();
       strcpy(data.gen_id, tag.c_str());
 
       std::string sval;
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted().str();
       util.toUpper(sval);
 
       // GOVERNOR_MODEL              "MODEL"                  integer
@@ -228,37 +229,37 @@ template <class _data_struct> class Tgov1Parser
       int nstr = split_line.size();
       // GOVERNOR_R
       if (nstr > 3) {
-        data.gv_r = atof(split_line[3].c_str());
+        data.gv_r = split_line[3].toDouble();
       }
 
       // GOVERNOR_T1
       if (nstr > 4) {
-        data.gv_t1 = atof(split_line[4].c_str());
+        data.gv_t1 = split_line[4].toDouble();
       }
 
       // GOVERNOR_VMAX
       if (nstr > 5) {
-        data.vmax = atof(split_line[5].c_str());
+        data.vmax = split_line[5].toDouble();
       }
 
       // GOVERNOR_VMIN
       if (nstr > 6) {
-        data.vmin = atof(split_line[6].c_str());
+        data.vmin = split_line[6].toDouble();
       }
 
       // GOVERNOR_T2
       if (nstr > 7) {
-        data.gv_t2 = atof(split_line[7].c_str());
+        data.gv_t2 = split_line[7].toDouble();
       }
 
       // GOVERNOR_T3
       if (nstr > 8) {
-        data.gv_t3 = atof(split_line[8].c_str());
+        data.gv_t3 = split_line[8].toDouble();
       }
 
       // GOVERNOR_DT
       if (nstr > 9) {
-        data.gv_dt = atof(split_line[9].c_str());
+        data.gv_dt = split_line[9].toDouble();
       }
     }
 };
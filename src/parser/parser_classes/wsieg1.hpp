@@ -11,6 +11,7 @@
 #define WSIEG1_HPP
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
+#include "gridpack/parser/psse_tokenizer.hpp"
 #include "gridpack/utilities/string_utils.hpp"
 namespace gridpack {
 namespace parser {
@@ -317,7 +318,7 @@ template <class _data_struct> class Wsieg1Parser
      * @param data data collection object
      * @param gen_id index of generator
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const std::vector<PSSEToken> &split_line,
         gridpack::component::DataCollection *data, int g_id)
     {
       double rval;
@@ -334,7 +335,7 @@ template <class _data_struct> class Wsieg1Parser
       // GOVERNOR_MODEL
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted().str();
       util.toUpper(model);
       if (!data->getValue(GOVERNOR_MODEL,&stmp,g_id)) {
         data->addValue(GOVERNOR_MODEL, model.c_str(), g_id);
@@ -346,10 +347,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 3) {
         if (!data->getValue(GOVERNOR_JBUS,&ival,g_id)) {
           data->addValue(GOVERNOR_JBUS,
-              atoi(split_line[3].c_str()), g_id);
+              split_line[3].toInt(), g_id);
         } else {
           data->setValue(GOVERNOR_JBUS,
-              atoi(split_line[3].c_str()), g_id);
+              split_line[3].toInt(), g_id);
         }
       } 
 
@@ -357,10 +358,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 4) {
         if (!data->getValue(GOVERNOR_M,&ival,g_id)) {
           data->addValue(GOVERNOR_M,
-              atoi(split_line[4].c_str()), g_id);
+              split_line[4].toInt(), g_id);
         } else {
           data->setValue(GOVERNOR_M,
-              atoi(split_line[4].c_str()), g_id);
+              split_line[4].toInt(), g_id);
         }
       } 
 
@@ -368,10 +369,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 5) {
         if (!data->getValue(GOVERNOR_K,&rval,g_id)) {
           data->addValue(GOVERNOR_K,
-              atof(split_line[5].c_str()), g_id);
+              split_line[5].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_K,
-              atof(split_line[5].c_str()), g_id);
+              split_line[5].toDouble(), g_id);
         }
       } 
 
@@ -379,10 +380,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 6) {
         if (!data->getValue(GOVERNOR_T1,&rval,g_id)) {
           data->addValue(GOVERNOR_T1,
-              atof(split_line[6].c_str()), g_id);
+              split_line[6].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_T1,
-              atof(split_line[6].c_str()), g_id);
+              split_line[6].toDouble(), g_id);
         }
       } 
 
@@ -390,10 +391,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 7) {
         if (!data->getValue(GOVERNOR_T2,&rval,g_id)) {
           data->addValue(GOVERNOR_T2,
-              atof(split_line[7].c_str()), g_id);
+              split_line[7].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_T2,
-              atof(split_line[7].c_str()), g_id);
+              split_line[7].toDouble(), g_id);
         }
       } 
 
@@ -401,10 +402,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 8) {
         if (!data->getValue(GOVERNOR_T3,&rval,g_id)) {
           data->addValue(GOVERNOR_T3,
-              atof(split_line[8].c_str()), g_id);
+              split_line[8].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_T3,
-              atof(split_line[8].c_str()), g_id);
+              split_line[8].toDouble(), g_id);
         }
       } 
 
@@ -412,10 +413,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 9) {
         if (!data->getValue(GOVERNOR_UO,&rval,g_id)) {
           data->addValue(GOVERNOR_UO,
-              atof(split_line[9].c_str()), g_id);
+              split_line[9].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_UO,
-              atof(split_line[9].c_str()), g_id);
+              split_line[9].toDouble(), g_id);
         }
       }
 
@@ -423,10 +424,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 10) {
         if (!data->getValue(GOVERNOR_UC,&rval,g_id)) {
           data->addValue(GOVERNOR_UC,
-              atof(split_line[10].c_str()), g_id);
+              split_line[10].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_UC,
-              atof(split_line[10].c_str()), g_id);
+              split_line[10].toDouble(), g_id);
         }
       } 
 
@@ -434,10 +435,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 11) {
         if (!data->getValue(GOVERNOR_PMAX,&rval,g_id)) {
           data->addValue(GOVERNOR_PMAX,
-              atof(split_line[11].c_str()), g_id);
+              split_line[11].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_PMAX,
-              atof(split_line[11].c_str()), g_id);
+              split_line[11].toDouble(), g_id);
         }
       } 
 
@@ -445,10 +446,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 12) {
         if (!data->getValue(GOVERNOR_PMIN,&rval,g_id)) {
           data->addValue(GOVERNOR_PMIN,
-              atof(split_line[12].c_str()), g_id);
+              split_line[12].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_PMIN,
-              atof(split_line[12].c_str()), g_id);
+              split_line[12].toDouble(), g_id);
         }
       } 
 
@@ -456,10 +457,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 13) {
         if (!data->getValue(GOVERNOR_T4,&rval,g_id)) {
           data->addValue(GOVERNOR_T4,
-              atof(split_line[13].c_str()), g_id);
+              split_line[13].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_T4,
-              atof(split_line[13].c_str()), g_id);
+              split_line[13].toDouble(), g_id);
         }
       } 
 
@@ -467,10 +468,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 14) {
         if (!data->getValue(GOVERNOR_K1,&rval,g_id)) {
           data->addValue(GOVERNOR_K1,
-              atof(split_line[14].c_str()), g_id);
+              split_line[14].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_K1,
-              atof(split_line[14].c_str()), g_id);
+              split_line[14].toDouble(), g_id);
         }
       } 
 
@@ -478,10 +479,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 15) {
         if (!data->getValue(GOVERNOR_K2,&rval,g_id)) {
           data->addValue(GOVERNOR_K2,
-              atof(split_line[15].c_str()), g_id);
+              split_line[15].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_K2,
-              atof(split_line[15].c_str()), g_id);
+              split_line[15].toDouble(), g_id);
         }
       } 
 
@@ -489,10 +490,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 16) {
         if (!data->getValue(GOVERNOR_T5,&rval,g_id)) {
           data->addValue(GOVERNOR_T5,
-              atof(split_line[16].c_str()), g_id);
+              split_line[16].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_T5,
-              atof(split_line[16].c_str()), g_id);
+              split_line[16].toDouble(), g_id);
         }
       } 
 
@@ -500,10 +501,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 17) {
         if (!data->getValue(GOVERNOR_K3,&rval,g_id)) {
           data->addValue(GOVERNOR_K3,
-              atof(split_line[17].c_str()), g_id);
+              split_line[17].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_K3,
-              atof(split_line[17].c_str()), g_id);
+              split_line[17].toDouble(), g_id);
         }
       } 
 
@@ -511,10 +512,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 18) {
         if (!data->getValue(GOVERNOR_K4,&rval,g_id)) {
           data->addValue(GOVERNOR_K4,
-              atof(split_line[18].c_str()), g_id);
+              split_line[18].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_K4,
-              atof(split_line[18].c_str()), g_id);
+              split_line[18].toDouble(), g_id);
         }
       } 
 
@@ -522,10 +523,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 19) {
         if (!data->getValue(GOVERNOR_T6,&rval,g_id)) {
           data->addValue(GOVERNOR_T6,
-              atof(split_line[19].c_str()), g_id);
+              split_line[19].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_T6,
-              atof(split_line[19].c_str()), g_id);
+              split_line[19].toDouble(), g_id);
         }
       } 
 
@@ -533,10 +534,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 20) {
         if (!data->getValue(GOVERNOR_K5,&rval,g_id)) {
           data->addValue(GOVERNOR_K5,
-              atof(split_line[20].c_str()), g_id);
+              split_line[20].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_K5,
-              atof(split_line[20].c_str()), g_id);
+              split_line[20].toDouble(), g_id);
         }
       } 
 
@@ -544,10 +545,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 21) {
         if (!data->getValue(GOVERNOR_K6,&rval,g_id)) {
           data->addValue(GOVERNOR_K6,
-              atof(split_line[21].c_str()), g_id);
+              split_line[21].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_K6,
-              atof(split_line[21].c_str()), g_id);
+              split_line[21].toDouble(), g_id);
         }
       } 
 
@@ -555,10 +556,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 22) {
         if (!data->getValue(GOVERNOR_T7,&rval,g_id)) {
           data->addValue(GOVERNOR_T7,
-              atof(split_line[22].c_str()), g_id);
+              split_line[22].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_T7,
-              atof(split_line[22].c_str()), g_id);
+              split_line[22].toDouble(), g_id);
         }
       } 
 
@@ -566,10 +567,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 23) {
         if (!data->getValue(GOVERNOR_K7,&rval,g_id)) {
           data->addValue(GOVERNOR_K7,
-              atof(split_line[23].c_str()), g_id);
+              split_line[23].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_K7,
-              atof(split_line[23].c_str()), g_id);
+              split_line[23].toDouble(), g_id);
         }
       } 
 
@@ -577,10 +578,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 24) {
         if (!data->getValue(GOVERNOR_K8,&rval,g_id)) {
           data->addValue(GOVERNOR_K8,
-              atof(split_line[24].c_str()), g_id);
+              split_line[24].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_K8,
-              atof(split_line[24].c_str()), g_id);
+              split_line[24].toDouble(), g_id);
         }
       } 
 
@@ -588,10 +589,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 25) {
         if (!data->getValue(GOVERNOR_DB1,&rval,g_id)) {
           data->addValue(GOVERNOR_DB1,
-              atof(split_line[25].c_str()), g_id);
+              split_line[25].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_DB1,
-              atof(split_line[25].c_str()), g_id);
+              split_line[25].toDouble(), g_id);
         }
       } 
 
@@ -599,10 +600,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 26) {
         if (!data->getValue(GOVERNOR_ERR,&rval,g_id)) {
           data->addValue(GOVERNOR_ERR,
-              atof(split_line[26].c_str()), g_id);
+              split_line[26].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_ERR,
-              atof(split_line[26].c_str()), g_id);
+              split_line[26].toDouble(), g_id);
         }
       } 
 
@@ -610,10 +611,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 27) {
         if (!data->getValue(GOVERNOR_DB2,&rval,g_id)) {
           data->addValue(GOVERNOR_DB2,
-              atof(split_line[27].c_str()), g_id);
+              split_line[27].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_DB2,
-              atof(split_line[27].c_str()), g_id);
+              split_line[27].toDouble(), g_id);
         }
       } 
 
@@ -621,10 +622,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 28) {
         if (!data->getValue(GOVERNOR_GV1,&rval,g_id)) {
           data->addValue(GOVERNOR_GV1,
-              atof(split_line[28].c_str()), g_id);
+              split_line[28].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_GV1,
-              atof(split_line[28].c_str()), g_id);
+              split_line[28].toDouble(), g_id);
         }
       } 
 
@@ -632,10 +633,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 29) {
         if (!data->getValue(GOVERNOR_PGV1,&rval,g_id)) {
           data->addValue(GOVERNOR_PGV1,
-              atof(split_line[29].c_str()), g_id);
+              split_line[29].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_PGV1,
-              atof(split_line[29].c_str()), g_id);
+              split_line[29].toDouble(), g_id);
         }
       } 
 
@@ -643,10 +644,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 30) {
         if (!data->getValue(GOVERNOR_GV2,&rval,g_id)) {
           data->addValue(GOVERNOR_GV2,
-              atof(split_line[30].c_str()), g_id);
+              split_line[30].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_GV2,
-              atof(split_line[30].c_str()), g_id);
+              split_line[30].toDouble(), g_id);
         }
       } 
 
@@ -654,10 +655,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 31) {
         if (!data->getValue(GOVERNOR_PGV2,&rval,g_id)) {
           data->addValue(GOVERNOR_PGV2,
-              atof(split_line[31].c_str()), g_id);
+              split_line[31].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_PGV2,
-              atof(split_line[31].c_str()), g_id);
+              split_line[31].toDouble(), g_id);
         }
       } 
 
@@ -665,10 +666,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 32) {
         if (!data->getValue(GOVERNOR_GV3,&rval,g_id)) {
           data->addValue(GOVERNOR_GV3,
-              atof(split_line[32].c_str()), g_id);
+              split_line[32].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_GV3,
-              atof(split_line[32].c_str()), g_id);
+              split_line[32].toDouble(), g_id);
         }
       } 
 
@@ -676,10 +677,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 33) {
         if (!data->getValue(GOVERNOR_PGV3,&rval,g_id)) {
           data->addValue(GOVERNOR_PGV3,
-              atof(split_line[33].c_str()), g_id);
+              split_line[33].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_PGV3,
-              atof(split_line[33].c_str()), g_id);
+              split_line[33].toDouble(), g_id);
         }
       } 
 
@@ -687,10 +688,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 34) {
         if (!data->getValue(GOVERNOR_GV4,&rval,g_id)) {
           data->addValue(GOVERNOR_GV4,
-              atof(split_line[34].c_str()), g_id);
+              split_line[34].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_GV4,
-              atof(split_line[34].c_str()), g_id);
+              split_line[34].toDouble(), g_id);
         }
       } 
 
@@ -698,10 +699,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 35) {
         if (!data->getValue(GOVERNOR_PGV4,&rval,g_id)) {
           data->addValue(GOVERNOR_PGV4,
-              atof(split_line[35].c_str()), g_id);
+              split_line[35].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_PGV4,
-              atof(split_line[35].c_str()), g_id);
+              split_line[35].toDouble(), g_id);
         }
       } 
 
@@ -709,10 +710,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 36) {
         if (!data->getValue(GOVERNOR_GV5,&rval,g_id)) {
           data->addValue(GOVERNOR_GV5,
-              atof(split_line[36].c_str()), g_id);
+              split_line[36].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_GV4,
-              atof(split_line[36].c_str()), g_id);
+              split_line[36].toDouble(), g_id);
         }
       } 
 
@@ -720,10 +721,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 37) {
         if (!data->getValue(GOVERNOR_PGV5,&rval,g_id)) {
           data->addValue(GOVERNOR_PGV5,
-              atof(split_line[37].c_str()), g_id);
+              split_line[37].toDouble(), g_id);
         } else {
           data->setValue(GOVERNOR_PGV5,
-              atof(split_line[37].c_str()), g_id);
+              split_line[37].toDouble(), g_id);
         }
       } 
 
@@ -731,10 +732,10 @@ template <class _data_struct> class Wsieg1Parser
       if (nstr > 38) {
         if (!data->getValue(GOVERNOR_IBLOCK,&ival,g_id)) {
           data->addValue(GOVERNOR_PGV5,
-              atoi(split_line[38].c_str()), g_id);
+              split_line[38].toInt(), g_id);
         } else {
           data->setValue(GOVERNOR_IBLOCK,
-              atoi(split_line[38].c_str()), g_id);
+              split_line[38].toInt(), g_id);
         }
       } 
     }
@@ -744,21 +745,21 @@ template <class _data_struct> class Wsieg1Parser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const std::vector<PSSEToken> &split_line,_data_struct &data)
     {
       // GOVERNOR_BUSNUMBER               "I"                   integer
       int o_idx;
-      o_idx = atoi(split_line[0].c_str());
+      o_idx = split_line[0].toInt();
       data.bus_id = o_idx;
 
       // Clean up 2 character tag for generator ID
       gridpack::utility::StringUtils util;
-      std::string tag = util.clean2Char(split_line[2]);
+      std::string tag = split_line[2].tag();
       strcpy(data.gen_id, tag.c_str());
 
       std::string sval;
 
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted().str();
       util.toUpper(sval);
 
       // GOVERNOR_MODEL              "MODEL"                  integer
@@ -767,182 +768,182 @@ template <class _data_struct> class Wsieg1Parser
       int nstr = split_line.size();
       // GOVERNOR_JBUS
       if (nstr > 3) {
-        data.jbus = atoi(split_line[3].c_str());
+        data.jbus = split_line[3].toInt();
       }
 
       // GOVERNOR_M
       if (nstr > 4) {
-        data.gv_m = atoi(split_line[4].c_str());
+        data.gv_m = split_line[4].toInt();
       }
 
       // GOVERNOR_K
       if (nstr > 5) {
-        data.gv_k = atof(split_line[5].c_str());
+        data.gv_k = split_line[5].toDouble();
       }
 
       // GOVERNOR_T1
       if (nstr > 6) {
-        data.gv_t1 = atof(split_line[6].c_str());
+        data.gv_t1 = split_line[6].toDouble();
       }
 
       // GOVERNOR_T2
       if (nstr > 7) {
-        data.gv_t2 = atof(split_line[7].c_str());
+        data.gv_t2 = split_line[7].toDouble();
       }
 
       // GOVERNOR_T3
       if (nstr > 8) {
-        data.gv_t3 = atof(split_line[8].c_str());
+        data.gv_t3 = split_line[8].toDouble();
       }
 
       // GOVERNOR_UO
       if (nstr > 9) {
-        data.gv_uo = atof(split_line[9].c_str());
+        data.gv_uo = split_line[9].toDouble();
       }
 
       // GOVERNOR_UC
       if (nstr > 10) {
-        data.gv_uc = atof(split_line[10].c_str());
+        data.gv_uc = split_line[10].toDouble();
       }
 
       // GOVERNOR_PMAX
       if (nstr > 11) {
-        data.pmax = atof(split_line[11].c_str());
+        data.pmax = split_line[11].toDouble();
       }
 
       // GOVERNOR_PMIN
       if (nstr > 12) {
-        data.pmin = atof(split_line[12].c_str());
+        data.pmin = split_line[12].toDouble();
       }
 
       // GOVERNOR_T4
       if (nstr > 13) {
-        data.gv_t4 = atof(split_line[13].c_str());
+        data.gv_t4 = split_line[13].toDouble();
       }
 
       // GOVERNOR_K1
       if (nstr > 14) {
-        data.gv_k1 = atof(split_line[14].c_str());
+        data.gv_k1 = split_line[14].toDouble();
       }
 
       // GOVERNOR_K2
       if (nstr > 15) {
-        data.gv_k2 = atof(split_line[15].c_str());
+        data.gv_k2 = split_line[15].toDouble();
       }
 
       // GOVERNOR_T5
       if (nstr > 16) {
-        data.gv_t5 = atof(split_line[16].c_str());
+        data.gv_t5 = split_line[16].toDouble();
       }
 
       // GOVERNOR_K3
       if (nstr > 17) {
-        data.gv_k3 = atof(split_line[17].c_str());
+        data.gv_k3 = split_line[17].toDouble();
       }
 
       // GOVERNOR_K4
       if (nstr > 18) {
-        data.gv_k4 = atof(split_line[18].c_str());
+        data.gv_k4 = split_line[18].toDouble();
       }
 
       // GOVERNOR_T6
       if (nstr > 19) {
-        data.gv_t6 = atof(split_line[19].c_str());
+        data.gv_t6 = split_line[19].toDouble();
       }
 
       // GOVERNOR_K5
       if (nstr > 20) {
-        data.gv_k5 = atof(split_line[20].c_str());
+        data.gv_k5 = split_line[20].toDouble();
       }
 
       // GOVERNOR_K6
       if (nstr > 21) {
-        data.gv_k6 = atof(split_line[21].c_str());
+        data.gv_k6 = split_line[21].toDouble();
       }
 
       // GOVERNOR_T7
       if (nstr > 22) {
-        data.gv_t7 = atof(split_line[22].c_str());
+        data.gv_t7 = split_line[22].toDouble();
       }
 
       // GOVERNOR_K7
       if (nstr > 23) {
-        data.gv_k7 = atof(split_line[23].c_str());
+        data.gv_k7 = split_line[23].toDouble();
       }
 
       // GOVERNOR_K8
       if (nstr > 24) {
-        data.gv_k8 = atof(split_line[24].c_str());
+        data.gv_k8 = split_line[24].toDouble();
       }
 
       // GOVERNOR_DB1
       if (nstr > 25) {
-        data.db1 = atof(split_line[25].c_str());
+        data.db1 = split_line[25].toDouble();
       }
 
       // GOVERNOR_ERR
       if (nstr > 26) {
-        data.err = atof(split_line[26].c_str());
+        data.err = split_line[26].toDouble();
       }
 
       // GOVERNOR_DB2
       if (nstr > 27) {
-        data.db2 = atof(split_line[27].c_str());
+        data.db2 = split_line[27].toDouble();
       }
 
       // GOVERNOR_GV1
       if (nstr > 28) {
-        data.gv1 = atof(split_line[28].c_str());
+        data.gv1 = split_line[28].toDouble();
       }
 
       // GOVERNOR_PGV1
       if (nstr > 29) {
-        data.pgv1 = atof(split_line[29].c_str());
+        data.pgv1 = split_line[29].toDouble();
       }
 
       // GOVERNOR_GV2
       if (nstr > 30) {
-        data.gv2 = atof(split_line[30].c_str());
+        data.gv2 = split_line[30].toDouble();
       }
 
       // GOVERNOR_PGV2
       if (nstr > 31) {
-        data.pgv2 = atof(split_line[31].c_str());
+        data.pgv2 = split_line[31].toDouble();
       }
 
       // GOVERNOR_GV3
       if (nstr > 32) {
-        data.gv3 = atof(split_line[32].c_str());
+        data.gv3 = split_line[32].toDouble();
       }
 
       // GOVERNOR_PGV3
       if (nstr > 33) {
-        data.pgv3 = atof(split_line[33].c_str());
+        data.pgv3 = split_line[33].toDouble();
       }
 
       // GOVERNOR_GV4
       if (nstr > 34) {
-        data.gv4 = atof(split_line[34].c_str());
+        data.gv4 = split_line[34].toDouble();
       }
 
       // GOVERNOR_PGV4
       if (nstr > 35) {
-        data.pgv4 = atof(split_line[35].c_str());
+        data.pgv4 = split_line[35].toDouble();
       }
 
       // GOVERNOR_GV5
       if (nstr > 36) {
-        data.gv5 = atof(split_line[36].c_str());
+        data.gv5 = split_line[36].toDouble();
       }
 
       // GOVERNOR_PGV5
       if (nstr > 37) {
-        data.pgv5 = atof(split_line[37].c_str());
+        data.pgv5 = split_line[37].toDouble();
       }
 
       // GOVERNOR_IBLOCK
       if (nstr > 38) {
-        data.iblock = atoi(split_line[38].c_str());
+        data.iblock = split_line[38].toInt();
       }
     }
 };
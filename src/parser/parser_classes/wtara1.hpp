@@ -11,6 +11,7 @@
 #define WTARA1_HPP
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
+#include "gridpack/parser/psse_tokenizer.hpp"
 #include "gridpack/utilities/string_utils.hpp"
 namespace gridpack {
 namespace parser {
@@ -86,7 +87,7 @@ template <class _data_struct> class Wtara1Parser
      * @param data data collection object
      * @param gen_id index of user model
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const std::vector<PSSEToken> &split_line,
         gridpack::component::DataCollection *data, int g_id)
     {
       double rval;
@@ -103,7 +104,7 @@ template <class _data_struct> class Wtara1Parser
       // WIND_NAME
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted().str();
       util.toUpper(model);
       if (!data->getValue(WIND_AERODYNAMIC,&stmp,g_id)) {
         data->addValue(WIND_AERODYNAMIC, model.c_str(), g_id);
@@ -113,7 +114,7 @@ template <class _data_struct> class Wtara1Parser
 
       // WIND_ID
       std::string tag;
-      tag = util.clean2Char(split_line[2]);
+      tag = split_line[2].tag();
       if (!data->getValue(WIND_ID,&stmp,g_id)) {
         data->addValue(WIND_ID, tag.c_str(), g_id);
       } else {
@@ -123,17 +124,17 @@ template <class _data_struct> class Wtara1Parser
       // Use counter to keep track of additional parameters
       if (nstr > 3) {
         if (!data->getValue(WIND_AD_KA,&rval,g_id)) {
-          data->addValue(WIND_AD_KA, atof(split_line[3].c_str()), g_id);
+          data->addValue(WIND_AD_KA, split_line[3].toDouble(), g_id);
         } else {
-          data->setValue(WIND_AD_KA, atof(split_line[3].c_str()), g_id);
+          data->setValue(WIND_AD_KA, split_line[3].toDouble(), g_id);
         }
       }
 
       if (nstr > 4) {
         if (!data->getValue(WIND_AD_THETA,&rval,g_id)) {
-          data->addValue(WIND_AD_THETA, atof(split_line[4].c_str()), g_id);
+          data->addValue(WIND_AD_THETA, split_line[4].toDouble(), g_id);
         } else {
-          data->setValue(WIND_AD_THETA, atof(split_line[4].c_str()), g_id);
+          data->setValue(WIND_AD_THETA, split_line[4].toDouble(), g_id);
         }
       }
     }
@@ -143,21 +144,21 @@ template <class _data_struct> class Wtara1Parser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const std::vector<PSSEToken> &split_line,_data_struct &data)
     {
       // WIND_BUSNUMBER               "I"                   integer
       int o_idx;
       int ncnt, ni, nc, ns, nv;
-      o_idx = atoi(split_line[0].c_str());
+      o_idx = split_line[0].toInt();
       data.bus_id = o_idx;
 
       // Clean up 2 character tag for user model ID
       gridpack::utility::StringUtils util;
-      std::string tag = util.clean2Char(split_line[2]);
+      std::string tag = split_line[2].tag();
       strcpy(data.gen_id, tag.c_str());
 
       std::string sval;
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted().str();
       util.toUpper(sval);
 
       // WIND_AERODYNAMIC              "MODEL"                  integer
@@ -168,11 +169,11 @@ template <class _data_struct> class Wtara1Parser
       // Wind model parameters
 
       if (nstr > 3) {
-        data.wind_ka = atof(split_line[3].c_str());
+        data.wind_ka = split_line[3].toDouble();
       }
 
       if (nstr > 4) {
-        data.wind_theta = atof(split_line[4].c_str());
+        data.wind_theta = split_line[4].toDouble();
       }
     }
 };
@@ -11,6 +11,7 @@
 #define WTDTA1_HPP
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
+#include "gridpack/parser/psse_tokenizer.hpp"
 #include "gridpack/utilities/string_utils.hpp"
 namespace gridpack {
 namespace parser {
@@ -107,7 +108,7 @@ template <class _data_struct> class Wtdta1Parser
      * @param data data collection object
      * @param gen_id index of user model
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const std::vector<PSSEToken> &split_line,
         gridpack::component::DataCollection *data, int g_id)
     {
       double rval;
@@ -124,7 +125,7 @@ template <class _data_struct> class Wtdta1Parser
       // WIND_NAME
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted().str();
       util.toUpper(model);
       if (!data->getValue(WIND_DRIVETRAIN,&stmp,g_id)) {
         data->addValue(WIND_DRIVETRAIN, model.c_str(), g_id);
@@ -134,7 +135,7 @@ template <class _data_struct> class Wtdta1Parser
 
       // WIND_ID
       std::string tag;
-      tag = util.clean2Char(split_line[2]);
+      tag = split_line[2].tag();
       if (!data->getValue(WIND_ID,&stmp,g_id)) {
         data->addValue(WIND_ID, tag.c_str(), g_id);
       } else {
@@ -144,41 +145,41 @@ template <class _data_struct> class Wtdta1Parser
       // Use counter to keep track of additional parameters
       if (nstr > 3) {
         if (!data->getValue(WIND_DT_H,&rval,g_id)) {
-          data->addValue(WIND_DT_H, atof(split_line[3].c_str()), g_id);
+          data->addValue(WIND_DT_H, split_line[3].toDouble(), g_id);
         } else {
-          data->setValue(WIND_DT_H, atof(split_line[3].c_str()), g_id);
+          data->setValue(WIND_DT_H, split_line[3].toDouble(), g_id);
         }
       }
 
       if (nstr > 4) {
         if (!data->getValue(WIND_DT_DAMP,&rval,g_id)) {
-          data->addValue(WIND_DT_DAMP, atof(split_line[4].c_str()), g_id);
+          data->addValue(WIND_DT_DAMP, split_line[4].toDouble(), g_id);
         } else {
-          data->setValue(WIND_DT_DAMP, atof(split_line[4].c_str()), g_id);
+          data->setValue(WIND_DT_DAMP, split_line[4].toDouble(), g_id);
         }
       }
 
       if (nstr > 5) {
         if (!data->getValue(WIND_DT_HFRAC,&rval,g_id)) {
-          data->addValue(WIND_DT_HFRAC, atof(split_line[5].c_str()), g_id);
+          data->addValue(WIND_DT_HFRAC, split_line[5].toDouble(), g_id);
         } else {
-          data->setValue(WIND_DT_HFRAC, atof(split_line[5].c_str()), g_id);
+          data->setValue(WIND_DT_HFRAC, split_line[5].toDouble(), g_id);
         }
       }
 
       if (nstr > 6) {
         if (!data->getValue(WIND_DT_FREQ1,&rval,g_id)) {
-          data->addValue(WIND_DT_FREQ1, atof(split_line[6].c_str()), g_id);
+          data->addValue(WIND_DT_FREQ1, split_line[6].toDouble(), g_id);
         } else {
-          data->setValue(WIND_DT_FREQ1, atof(split_line[6].c_str()), g_id);
+          data->setValue(WIND_DT_FREQ1, split_line[6].toDouble(), g_id);
         }
       }
 
       if (nstr > 7) {
         if (!data->getValue(WIND_DT_DSHAFT,&rval,g_id)) {
-          data->addValue(WIND_DT_DSHAFT, atof(split_line[7].c_str()), g_id);
+          data->addValue(WIND_DT_DSHAFT, split_line[7].toDouble(), g_id);
         } else {
-          data->setValue(WIND_DT_DSHAFT, atof(split_line[7].c_str()), g_id);
+          data->setValue(WIND_DT_DSHAFT, split_line[7].toDouble(), g_id);
         }
       }
     }
@@ -188,21 +189,21 @@ template <class _data_struct> class Wtdta1Parser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const std::vector<PSSEToken> &split_line,_data_struct &data)
     {
       // WIND_BUSNUMBER               "I"                   integer
       int o_idx;
       int ncnt, ni, nc, ns, nv;
-      o_idx = atoi(split_line[0].c_str());
+      o_idx = split_line[0].toInt();
       data.bus_id = o_idx;
 
       // Clean up 2 character tag for user model ID
       gridpack::utility::StringUtils util;
-      std::string tag = util.clean2Char(split_line[2]);
+      std::string tag = split_line[2].tag();
       strcpy(data.gen_id, tag.c_str());
 
       std::string sval;
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted().str();
       util.toUpper(sval);
 
       // WIND_DRIVETRAIN              "MODEL"                  integer
@@ -213,23 +214,23 @@ template <class _data_struct> class Wtdta1Parser
       // Wind model parameters
 
       if (nstr > 3) {
-        data.wind_h = atof(split_line[3].c_str());
+        data.wind_h = split_line[3].toDouble();
       }
 
       if (nstr > 4) {
-        data.wind_damp = atof(split_line[4].c_str());
+        data.wind_damp = split_line[4].toDouble();
       }
 
       if (nstr > 5) {
-        data.wind_hfrac = atof(split_line[5].c_str());
+        data.wind_hfrac = split_line[5].toDouble();
       }
 
       if (nstr > 6) {
-        data.wind_freq1 = atof(split_line[6].c_str());
+        data.wind_freq1 = split_line[6].toDouble();
       }
 
       if (nstr > 7) {
-        data.wind_dshaft = atof(split_line[7].c_str());
+        data.wind_dshaft = split_line[7].toDouble();
       }
     }
 };
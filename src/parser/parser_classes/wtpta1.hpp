@@ -11,6 +11,7 @@
 #define WTPTA1_HPP
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
+#include "gridpack/parser/psse_tokenizer.hpp"
 #include "gridpack/utilities/string_utils.hpp"
 namespace gridpack {
 namespace parser {
@@ -142,7 +143,7 @@ template <class _data_struct> class Wtpta1Parser
      * @param data data collection object
      * @param gen_id index of user model
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const std::vector<PSSEToken> &split_line,
         gridpack::component::DataCollection *data, int g_id)
     {
       double rval;
@@ -159,7 +160,7 @@ template <class _data_struct> class Wtpta1Parser
       // WIND_NAME
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted().str();
       util.toUpper(model);
       if (!data->getValue(WIND_PITCHCONTROL,&stmp,g_id)) {
         data->addValue(WIND_PITCHCONTROL, model.c_str(), g_id);
@@ -169,7 +170,7 @@ template <class _data_struct> class Wtpta1Parser
 
       // WIND_ID
       std::string tag;
-      tag = util.clean2Char(split_line[2]);
+      tag = split_line[2].tag();
       if (!data->getValue(WIND_ID,&stmp,g_id)) {
         data->addValue(WIND_ID, tag.c_str(), g_id);
       } else {
@@ -179,81 +180,81 @@ template <class _data_struct> class Wtpta1Parser
       // Use counter to keep track of additional parameters
       if (nstr > 3) {
         if (!data->getValue(WIND_PC_KIW,&rval,g_id)) {
-          data->addValue(WIND_PC_KIW, atof(split_line[3].c_str()), g_id);
+          data->addValue(WIND_PC_KIW, split_line[3].toDouble(), g_id);
         } else {
-          data->setValue(WIND_PC_KIW, atof(split_line[3].c_str()), g_id);
+          data->setValue(WIND_PC_KIW, split_line[3].toDouble(), g_id);
         }
       }
 
       if (nstr > 4) {
         if (!data->getValue(WIND_PC_KPW,&rval,g_id)) {
-          data->addValue(WIND_PC_KPW, atof(split_line[4].c_str()), g_id);
+          data->addValue(WIND_PC_KPW, split_line[4].toDouble(), g_id);
         } else {
-          data->setValue(WIND_PC_KPW, atof(split_line[4].c_str()), g_id);
+          data->setValue(WIND_PC_KPW, split_line[4].toDouble(), g_id);
         }
       }
 
       if (nstr > 5) {
         if (!data->getValue(WIND_PC_KIC,&rval,g_id)) {
-          data->addValue(WIND_PC_KIC, atof(split_line[5].c_str()), g_id);
+          data->addValue(WIND_PC_KIC, split_line[5].toDouble(), g_id);
         } else {
-          data->setValue(WIND_PC_KIC, atof(split_line[5].c_str()), g_id);
+          data->setValue(WIND_PC_KIC, split_line[5].toDouble(), g_id);
         }
       }
 
       if (nstr > 6) {
         if (!data->getValue(WIND_PC_KPC,&rval,g_id)) {
-          data->addValue(WIND_PC_KPC, atof(split_line[6].c_str()), g_id);
+          data->addValue(WIND_PC_KPC, split_line[6].toDouble(), g_id);
         } else {
-          data->setValue(WIND_PC_KPC, atof(split_line[6].c_str()), g_id);
+          data->setValue(WIND_PC_KPC, split_line[6].toDouble(), g_id);
         }
       }
 
       if (nstr > 7) {
         if (!data->getValue(WIND_PC_KCC,&rval,g_id)) {
-          data->addValue(WIND_PC_KCC, atof(split_line[7].c_str()), g_id);
+          data->addValue(WIND_PC_KCC, split_line[7].toDouble(), g_id);
         } else {
-          data->setValue(WIND_PC_KCC, atof(split_line[7].c_str()), g_id);
+          data->setValue(WIND_PC_KCC, split_line[7].toDouble(), g_id);
         }
       }
 
       if (nstr > 8) {
         if (!data->getValue(WIND_PC_TP,&rval,g_id)) {
-          data->addValue(WIND_PC_TP, atof(split_line[8].c_str()), g_id);
+          data->addValue(WIND_PC_TP, split_line[8].toDouble(), g_id);
         } else {
-          data->setValue(WIND_PC_TP, atof(split_line[8].c_str()), g_id);
+          data->setValue(WIND_PC_TP, split_line[8].toDouble(), g_id);
         }
       }
 
       if (nstr > 9) {
         if (!data->getValue(WIND_PC_THETAMAX,&rval,g_id)) {
-          data->addValue(WIND_PC_THETAMAX, atof(split_line[9].c_str()), g_id);
+          data->addValue(WIND_PC_THETAMAX, split_line[9].toDouble(), g_id);
         } else {
-          data->setValue(WIND_PC_THETAMAX, atof(split_line[9].c_str()), g_id);
+          data->setValue(WIND_PC_THETAMAX, split_line[9].toDouble(), g_id);
         }
       }
 
       if (nstr > 10) {
         if (!data->getValue(WIND_PC_THETAMIN,&rval,g_id)) {
-          data->addValue(WIND_PC_THETAMIN, atof(split_line[10].c_str()), g_id);
+          data->addValue(WIND_PC_THETAMIN, split_line[10].toDouble(), g_id);
         } else {
-          data->setValue(WIND_PC_THETAMIN, atof(split_line[10].c_str()), g_id);
+          data->setValue(WIND_PC_THETAMIN, split_line[10].toDouble(), g_id);
         }
       }
 
       if (nstr > 11) {
         if (!data->getValue(WIND_PC_RTHETAMAX,&rval,g_id)) {
-          data->addValue(WIND_PC_RTHETAMAX, atof(split_line[11].c_str()), g_id);
+          data->addValue(WIND_PC_RTHETAMAX, split_line[11].toDouble(), g_id);
         } else {
-          data->setValue(WIND_PC_RTHETAMAX, atof(split_line[11].c_str()), g_id);
+          data->setValue(WIND_PC_RTHETAMAX, split_line[11].toDouble(), g_id);
         }
       }
 
       if (nstr > 12) {
         if (!data->getValue(WIND_PC_RTHETAMIN,&rval,g_id)) {
-          data->addValue(WIND_PC_RTHETAMIN, atof(split_line[12].c_str()), g_id);
+          data->addValue(WIND_PC_RTHETAMIN, split_line[12].toDouble(), g_id);
         } else {
-          data->setValue(WIND_PC_RTHETAMIN, atof(split_line[12].c_str()), g_id);
+          data->setValue(WIND_PC_RTHETAMIN, split_line[12].toDouble(), g_id);
         }
       }
     }
@@ -263,21 +264,21 @@ template <class _data_struct> class Wtpta1Parser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const std::vector<PSSEToken> &split_line,_data_struct &data)
     {
       // WIND_BUSNUMBER               "I"                   integer
       int o_idx;
       int ncnt, ni, nc, ns, nv;
-      o_idx = atoi(split_line[0].c_str());
+      o_idx = split_line[0].toInt();
       data.bus_id = o_idx;
 
       // Clean up 2 character tag for user model ID
       gridpack::utility::StringUtils util;
-      std::string tag = util.clean2Char(split_line[2]);
+      std::string tag = split_line[2].tag();
       strcpy(data.gen_id, tag.c_str());
 
       std::string sval;
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted().str();
       util.toUpper(sval);
 
       // WIND_PITCHCONTROL              "MODEL"                  integer
@@ -288,43 +289,43 @@ template <class _data_struct> class Wtpta1Parser
       // Wind model parameters
 
       if (nstr > 3) {
-        data.wind_kiw = atof(split_line[3].c_str());
+        data.wind_kiw = split_line[3].toDouble();
       }
 
       if (nstr > 4) {
-        data.wind_kpw = atof(split_line[4].c_str());
+        data.wind_kpw = split_line[4].toDouble();
       }
 
       if (nstr > 5) {
-        data.wind_kic = atof(split_line[5].c_str());
+        data.wind_kic = split_line[5].toDouble();
       }
 
       if (nstr > 6) {
-        data.wind_kpc = atof(split_line[6].c_str());
+        data.wind_kpc = split_line[6].toDouble();
       }
 
       if (nstr > 7) {
-        data.wind_kcc = atof(split_line[7].c_str());
+        data.wind_kcc = split_line[7].toDouble();
       }
 
       if (nstr > 8) {
-        data.wind_tp = atof(split_line[8].c_str());
+        data.wind_tp = split_line[8].toDouble();
       }
 
       if (nstr > 9) {
-        data.wind_thetamax = atof(split_line[9].c_str());
+        data.wind_thetamax = split_line[9].toDouble();
       }
 
       if (nstr > 10) {
-        data.wind_thetamin = atof(split_line[10].c_str());
+        data.wind_thetamin = split_line[10].toDouble();
       }
 
       if (nstr > 11) {
-        data.wind_rthetamax = atof(split_line[11].c_str());
+        data.wind_rthetamax = split_line[11].toDouble();
       }
 
       if (nstr > 12) {
-        data.wind_rthetamin = atof(split_line[12].c_str());
+        data.wind_rthetamin = split_line[12].toDouble();
       }
     }
 };
@@ -11,6 +11,7 @@
 #define WTTQA1_HPP
 #include "gridpack/component/data_collection.hpp"
 #include "gridpack/parser/dictionary.hpp"
+#include "gridpack/parser/psse_tokenizer.hpp"
 #include "gridpack/utilities/string_utils.hpp"
 namespace gridpack {
 namespace parser {
@@ -184,7 +185,7 @@ template <class _data_struct> class Wttqa1Parser
      * @param data data collection object
      * @param gen_id index of user model
      */
-    void parse(std::vector<std::string> &split_line,
+    void parse(const std::vector<PSSEToken> &split_line,
         gridpack::component::DataCollection *data, int g_id)
     {
       double rval;
@@ -201,7 +202,7 @@ template <class _data_struct> class Wttqa1Parser
       // WIND_NAME
       std::string stmp, model;
       gridpack::utility::StringUtils util;
-      model = util.trimQuotes(split_line[1]);
+      model = split_line[1].unquoted().str();
       util.toUpper(model);
       if (!data->getValue(WIND_TORQUECONTROL,&stmp,g_id)) {
         data->addValue(WIND_TORQUECONTROL, model.c_str(), g_id);
@@ -211,7 +212,7 @@ template <class _data_struct> class Wttqa1Parser
 
       // WIND_ID
       std::string tag;
-      tag = util.clean2Char(split_line[2]);
+      tag = split_line[2].tag();
       if (!data->getValue(WIND_ID,&stmp,g_id)) {
         data->addValue(WIND_ID, tag.c_str(), g_id);
       } else {
@@ -221,129 +222,129 @@ template <class _data_struct> class Wttqa1Parser
       // Use counter to keep track of additional parameters
       if (nstr > 3) {
         if (!data->getValue(WIND_TC_TFLAG,&ival,g_id)) {
-          data->addValue(WIND_TC_TFLAG, atoi(split_line[3].c_str()), g_id);
+          data->addValue(WIND_TC_TFLAG, split_line[3].toInt(), g_id);
         } else {
-          data->setValue(WIND_TC_TFLAG, atoi(split_line[3].c_str()), g_id);
+          data->setValue(WIND_TC_TFLAG, split_line[3].toInt(), g_id);
         }
       }
 
       if (nstr > 4) {
         if (!data->getValue(WIND_TC_KPP,&rval,g_id)) {
-          data->addValue(WIND_TC_KPP, atof(split_line[4].c_str()), g_id);
+          data->addValue(WIND_TC_KPP, split_line[4].toDouble(), g_id);
         } else {
-          data->setValue(WIND_TC_KPP, atof(split_line[4].c_str()), g_id);
+          data->setValue(WIND_TC_KPP, split_line[4].toDouble(), g_id);
         }
       }
 
       if (nstr > 5) {
         if (!data->getValue(WIND_TC_KIP,&rval,g_id)) {
-          data->addValue(WIND_TC_KIP, atof(split_line[5].c_str()), g_id);
+          data->addValue(WIND_TC_KIP, split_line[5].toDouble(), g_id);
         } else {
-          data->setValue(WIND_TC_KIP, atof(split_line[5].c_str()), g_id);
+          data->setValue(WIND_TC_KIP, split_line[5].toDouble(), g_id);
         }
       }
 
       if (nstr > 6) {
         if (!data->getValue(WIND_TC_TP,&rval,g_id)) {
-          data->addValue(WIND_TC_TP, atof(split_line[6].c_str()), g_id);
+          data->addValue(WIND_TC_TP, split_line[6].toDouble(), g_id);
         } else {
-          data->setValue(WIND_TC_TP, atof(split_line[6].c_str()), g_id);
+          data->setValue(WIND_TC_TP, split_line[6].toDouble(), g_id);
         }
       }
 
       if (nstr > 7) {
         if (!data->getValue(WIND_TC_TWREF,&rval,g_id)) {
-          data->addValue(WIND_TC_TWREF, atof(split_line[7].c_str()), g_id);
+          data->addValue(WIND_TC_TWREF, split_line[7].toDouble(), g_id);
         } else {
-          data->setValue(WIND_TC_TWREF, atof(split_line[7].c_str()), g_id);
+          data->setValue(WIND_TC_TWREF, split_line[7].toDouble(), g_id);
         }
       }
 
       if (nstr > 8) {
         if (!data->getValue(WIND_TC_TEMAX,&rval,g_id)) {
-          data->addValue(WIND_TC_TEMAX, atof(split_line[8].c_str()), g_id);
+          data->addValue(WIND_TC_TEMAX, split_line[8].toDouble(), g_id);
         } else {
-          data->setValue(WIND_TC_TEMAX, atof(split_line[8].c_str()), g_id);
+          data->setValue(WIND_TC_TEMAX, split_line[8].toDouble(), g_id);
         }
       }
 
       if (nstr > 9) {
         if (!data->getValue(WIND_TC_TEMIN,&rval,g_id)) {
-          data->addValue(WIND_TC_TEMIN, atof(split_line[9].c_str()), g_id);
+          data->addValue(WIND_TC_TEMIN, split_line[9].toDouble(), g_id);
         } else {
-          data->setValue(WIND_TC_TEMIN, atof(split_line[9].c_str()), g_id);
+          data->setValue(WIND_TC_TEMIN, split_line[9].toDouble(), g_id);
         }
       }
 
       if (nstr > 10) {
         if (!data->getValue(WIND_TC_P1,&rval,g_id)) {
-          data->addValue(WIND_TC_P1, atof(split_line[10].c_str()), g_id);
+          data->addValue(WIND_TC_P1, split_line[10].toDouble(), g_id);
         } else {
-          data->setValue(WIND_TC_P1, atof(split_line[10].c_str()), g_id);
+          data->setValue(WIND_TC_P1, split_line[10].toDouble(), g_id);
         }
       }
 
       if (nstr > 11) {
         if (!data->getValue(WIND_TC_SPD1,&rval,g_id)) {
-          data->addValue(WIND_TC_SPD1, atof(split_line[11].c_str()), g_id);
+          data->addValue(WIND_TC_SPD1, split_line[11].toDouble(), g_id);
         } else {
-          data->setValue(WIND_TC_SPD1, atof(split_line[11].c_str()), g_id);
+          data->setValue(WIND_TC_SPD1, split_line[11].toDouble(), g_id);
         }
       }
 
       if (nstr > 12) {
         if (!data->getValue(WIND_TC_P2,&rval,g_id)) {
-          data->addValue(WIND_TC_P2, atof(split_line[12].c_str()), g_id);
+          data->addValue(WIND_TC_P2, split_line[12].toDouble(), g_id);
         } else {
-          data->setValue(WIND_TC_P2, atof(split_line[12].c_str()), g_id);
+          data->setValue(WIND_TC_P2, split_line[12].toDouble(), g_id);
         }
       }
 
       if (nstr > 13) {
         if (!data->getValue(WIND_TC_SPD2,&rval,g_id)) {
-          data->addValue(WIND_TC_SPD2, atof(split_line[13].c_str()), g_id);
+          data->addValue(WIND_TC_SPD2, split_line[13].toDouble(), g_id);
         } else {
-          data->setValue(WIND_TC_SPD2, atof(split_line[13].c_str()), g_id);
+          data->setValue(WIND_TC_SPD2, split_line[13].toDouble(), g_id);
         }
       }
 
       if (nstr > 14) {
         if (!data->getValue(WIND_TC_P3,&rval,g_id)) {
-          data->addValue(WIND_TC_P3, atof(split_line[14].c_str()), g_id);
+          data->addValue(WIND_TC_P3, split_line[14].toDouble(), g_id);
         } else {
-          data->setValue(WIND_TC_P3, atof(split_line[14].c_str()), g_id);
+          data->setValue(WIND_TC_P3, split_line[14].toDouble(), g_id);
         }
       }
 
       if (nstr > 15) {
         if (!data->getValue(WIND_TC_SPD3,&rval,g_id)) {
-          data->addValue(WIND_TC_SPD3, atof(split_line[15].c_str()), g_id);
+          data->addValue(WIND_TC_SPD3, split_line[15].toDouble(), g_id);
         } else {
-          data->setValue(WIND_TC_SPD3, atof(split_line[15].c_str()), g_id);
+          data->setValue(WIND_TC_SPD3, split_line[15].toDouble(), g_id);
         }
       }
 
       if (nstr > 16) {
         if (!data->getValue(WIND_TC_P4,&rval,g_id)) {
-          data->addValue(WIND_TC_P4, atof(split_line[16].c_str()), g_id);
+          data->addValue(WIND_TC_P4, split_line[16].toDouble(), g_id);
         } else {
-          data->setValue(WIND_TC_P4, atof(split_line[16].c_str()), g_id);
+          data->setValue(WIND_TC_P4, split_line[16].toDouble(), g_id);
         }
       }
 
       if (nstr > 17) {
         if (!data->getValue(WIND_TC_SPD4,&rval,g_id)) {
-          data->addValue(WIND_TC_SPD4, atof(split_line[17].c_str()), g_id);
+          data->addValue(WIND_TC_SPD4, split_line[17].toDouble(), g_id);
         } else {
-          data->setValue(WIND_TC_SPD4, atof(split_line[17].c_str()), g_id);
+          data->setValue(WIND_TC_SPD4, split_line[17].toDouble(), g_id);
         }
       }
 
       if (nstr > 18) {
         if (!data->getValue(WIND_TC_TRATE,&rval,g_id)) {
-          data->addValue(WIND_TC_TRATE, atof(split_line[18].c_str()), g_id);
+          data->addValue(WIND_TC_TRATE, split_line[18].toDouble(), g_id);
         } else {
-          data->setValue(WIND_TC_TRATE, atof(split_line[18].c_str()), g_id);
+          data->setValue(WIND_TC_TRATE, split_line[18].toDouble(), g_id);
         }
       }
     }
@@ -353,21 +354,21 @@ template <class _data_struct> class Wttqa1Parser
      * @param split_line list of tokens from .dyr file
      * @param data data struct that stores information from file
      */
-    void store(std::vector<std::string> &split_line,_data_struct &data)
+    void store(const std::vector<PSSEToken> &split_line,_data_struct &data)
     {
       // WIND_BUSNUMBER               "I"                   integer
       int o_idx;
       int ncnt, ni, nc, ns, nv;
-      o_idx = atoi(split_line[0].c_str());
+      o_idx = split_line[0].toInt();
       data.bus_id = o_idx;
 
       // Clean up 2 character tag for user model ID
       gridpack::utility::StringUtils util;
-      std::string tag = util.clean2Char(split_line[2]);
+      std::string tag = split_line[2].tag();
       strcpy(data.gen_id, tag.c_str());
 
       std::string sval;
-      sval = util.trimQuotes(split_line[1]);
+      sval = split_line[1].unquoted().str();
       util.toUpper(sval);
 
       // WIND_TORQUECONTROL              "MODEL"                  integer
@@ -377,67 +378,67 @@ template <class _data_struct> class Wttqa1Parser
 
       // Wind model parameters
       if (nstr > 3) {
-        data.wind_tflag = atoi(split_line[3].c_str());
+        data.wind_tflag = split_line[3].toInt();
       }
 
       if (nstr > 4) {
-        data.wind_kpp = atof(split_line[4].c_str());
+        data.wind_kpp = split_line[4].toDouble();
       }
 
       if (nstr > 5) {
-        data.wind_kip = atof(split_line[5].c_str());
+        data.wind_kip = split_line[5].toDouble();
       }
 
       if (nstr > 6) {
-        data.wind_tp = atof(split_line[6].c_str());
+        data.wind_tp = split_line[6].toDouble();
       }
 
       if (nstr > 7) {
-        data.wind_twref = atof(split_line[7].c_str());
+        data.wind_twref = split_line[7].toDouble();
       }
 
       if (nstr > 8) {
-        data.wind_temax = atof(split_line[8].c_str());
+        data.wind_temax = split_line[8].toDouble();
       }
 
       if (nstr > 9) {
-        data.wind_temin = atof(split_line[9].c_str());
+        data.wind_temin = split_line[9].toDouble();
       }
 
       if (nstr > 10) {
-        data.wind_p1 = atof(split_line[10].c_str());
+        data.wind_p1 = split_line[10].toDouble();
       }
 
       if (nstr > 11) {
-        data.wind_spd1 = atof(split_line[11].c_str());
+        data.wind_spd1 = split_line[11].toDouble();
       }
 
       if (nstr > 12) {
-        data.wind_p2 = atof(split_line[12].c_str());
+        data.wind_p2 = split_line[12].toDouble();
       }
 
       if (nstr > 13) {
-        data.wind_spd2 = atof(split_line[13].c_str());
+        data.wind_spd2 = split_line[13].toDouble();
       }
 
       if (nstr > 14) {
-        data.wind_p3 = atof(split_line[14].c_str());
+        data.wind_p3 = split_line[14].toDouble();
       }
 
       if (nstr > 15) {
-        data.wind_spd3 = atof(split_line[15].c_str());
+        data.wind_spd3 = split_line[15].toDouble();
       }
 
       if (nstr > 16) {
-        data.wind_p4 = atof(split_line[16].c_str());
+        data.wind_p4 = split_line[16].toDouble();
       }
 
       if (nstr > 17) {
-        data.wind_spd4 = atof(split_line[17].c_str());
+        data.wind_spd4 = split_line[17].toDouble();
       }
 
       if (nstr > 18) {
-        data.wind_trate = atof(split_line[18].c_str());
+        data.wind_trate = split_line[18].toDouble();
       }
     }
 };
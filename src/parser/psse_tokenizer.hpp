@@ -0,0 +1,540 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   psse_tokenizer.hpp
+ *
+ * @brief  Tokenizer for PSS/E formatted files. The complete file is read
+ * into a single buffer and records are split into tokens in place, so
+ * each token is just a pointer into the buffer and a length. Fields are
+ * delimited by commas and blanks, quoted strings are kept together, empty
+ * fields between commas are returned as "0" and records are terminated by
+ * a '/' character (anything following the '/' on the same line is
+ * ignored). Lines starting with "//" are treated as comments.
+ *
+ * Numerical values are converted directly from the buffer. If the
+ * compiler supports C++17 std::from_chars is used, otherwise the
+ * conversion falls back on strtol/strtod.
+ */
+// -------------------------------------------------------------
+
+#ifndef _psse_tokenizer_h_
+#define _psse_tokenizer_h_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <string>
+#include <vector>
+#include <istream>
+#if __cplusplus >= 201703L
+#include <charconv>
+#endif
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define GRIDPACK_HAVE_FROM_CHARS 1
+#endif
+
+namespace gridpack {
+namespace parser {
+
+/**
+ * A single token. The token points into the buffer owned by the tokenizer
+ * and is only valid until the tokenizer is destroyed or refilled.
+ */
+struct PSSEToken {
+  const char *ptr;
+  int len;
+
+  /**
+   * @return token as a string
+   */
+  std::string str() const
+  {
+    return std::string(ptr, len);
+  }
+
+  /**
+   * @return true if token is enclosed by single or double quotes
+   */
+  bool quoted() const
+  {
+    return len >= 2 && (ptr[0] == '\'' || ptr[0] == '\"')
+      && ptr[len-1] == ptr[0];
+  }
+
+  /**
+   * Remove enclosing quotes and any leading and trailing blanks inside
+   * the quotes
+   * @return token without quotes
+   */
+  PSSEToken unquoted() const
+  {
+    PSSEToken ret = *this;
+    if (ret.quoted()) {
+      ret.ptr++;
+      ret.len -= 2;
+    }
+    while (ret.len > 0 && ret.ptr[0] == ' ') {
+      ret.ptr++;
+      ret.len--;
+    }
+    while (ret.len > 0 && ret.ptr[ret.len-1] == ' ') ret.len--;
+    return ret;
+  }
+
+  /**
+   * Clean up 2 character tags such as generator and circuit IDs. Quotes
+   * are removed, the tag is truncated at the first blank and single
+   * character tags are right-justified. This matches
+   * StringUtils::clean2Char
+   * @return 2 character tag
+   */
+  std::string tag() const
+  {
+    PSSEToken tok = unquoted();
+    int i = 0;
+    while (i < tok.len && tok.ptr[i] != ' ') i++;
+    std::string ret(tok.ptr, i);
+    if (i == 1) ret.append(" ");
+    return ret;
+  }
+
+  /**
+   * Case insensitive comparison with a null terminated string
+   * @param str string to compare with
+   * @return true if token matches string
+   */
+  bool equals(const char *str) const
+  {
+    int i;
+    for (i=0; i<len; i++) {
+      if (str[i] == '\0') return false;
+      if (toupper(ptr[i]) != toupper(str[i])) return false;
+    }
+    return str[len] == '\0';
+  }
+
+  /**
+   * Convert token to an integer. Conversion stops at the first character
+   * that is not part of an integer, so "2.0" returns 2, matching atoi
+   * @return integer value (0 if token is not a number)
+   */
+  int toInt() const
+  {
+    const char *first = ptr;
+    const char *last = ptr+len;
+    while (first < last && (*first == ' ' || *first == '+')) first++;
+#ifdef GRIDPACK_HAVE_FROM_CHARS
+    int ret = 0;
+    std::from_chars(first, last, ret);
+    return ret;
+#else
+    char buf[64];
+    int n = last-first;
+    if (n > 63) n = 63;
+    memcpy(buf, first, n);
+    buf[n] = '\0';
+    return static_cast<int>(strtol(buf, NULL, 10));
+#endif
+  }
+
+  /**
+   * Convert token to a double. Conversion stops at the first character
+   * that is not part of a number, matching atof
+   * @return double value (0.0 if token is not a number)
+   */
+  double toDouble() const
+  {
+    const char *first = ptr;
+    const char *last = ptr+len;
+    while (first < last && (*first == ' ' || *first == '+')) first++;
+#ifdef GRIDPACK_HAVE_FROM_CHARS
+    double ret = 0.0;
+    std::from_chars(first, last, ret);
+    return ret;
+#else
+    char buf[64];
+    int n = last-first;
+    if (n > 63) n = 63;
+    memcpy(buf, first, n);
+    buf[n] = '\0';
+    return strtod(buf, NULL);
+#endif
+  }
+};
+
+class PSSETokenizer {
+  public:
+
+    /**
+     * Basic constructor
+     */
+    PSSETokenizer()
+    {
+      p_pos = 0;
+      p_line = 0;
+      p_tokens.reserve(64);
+    }
+
+    /**
+     * Basic destructor
+     */
+    ~PSSETokenizer()
+    {
+    }
+
+    /**
+     * Read the remaining contents of a stream into the buffer
+     * @param input input stream
+     */
+    void read(std::istream &input)
+    {
+      p_buffer.clear();
+      char block[65536];
+      while (input) {
+        input.read(block, sizeof(block));
+        std::streamsize n = input.gcount();
+        if (n <= 0) break;
+        p_buffer.insert(p_buffer.end(), block, block+n);
+      }
+      reset();
+    }
+
+    /**
+     * Read the complete contents of a file into the buffer with a single
+     * read
+     * @param filename name of file
+     * @return false if file could not be read
+     */
+    bool open(const std::string &filename)
+    {
+      p_buffer.clear();
+      reset();
+      FILE *fp = fopen(filename.c_str(), "rb");
+      if (!fp) return false;
+      fseek(fp, 0, SEEK_END);
+      long size = ftell(fp);
+      fseek(fp, 0, SEEK_SET);
+      if (size > 0) {
+        p_buffer.resize(size);
+        size_t nread = fread(&p_buffer[0], 1, size, fp);
+        p_buffer.resize(nread);
+      }
+      fclose(fp);
+      return true;
+    }
+
+    /**
+     * Copy a string into the buffer. This can be used to tokenize single
+     * lines or text that has already been read into memory
+     * @param text text to be tokenized
+     */
+    void setText(const std::string &text)
+    {
+      p_buffer.assign(text.begin(), text.end());
+      reset();
+    }
+
+    /**
+     * Start reading the buffer from the beginning
+     */
+    void reset()
+    {
+      p_pos = 0;
+      p_line = 0;
+      p_tokens.clear();
+    }
+
+    /**
+     * Find the next record in the buffer and split it into tokens. Blank
+     * lines and comment lines are skipped. A record continues over
+     * multiple lines until a '/' character is found or the end of the
+     * buffer is reached.
+     * @return false if no more records are available
+     */
+    bool nextRecord()
+    {
+      p_tokens.clear();
+      size_t size = p_buffer.size();
+      const char *buf = size > 0 ? &p_buffer[0] : NULL;
+      // skip blank and comment lines
+      while (p_pos < size) {
+        size_t pos = p_pos;
+        while (pos < size && isBlank(buf[pos])) pos++;
+        if (pos == size) {
+          p_pos = size;
+          return false;
+        }
+        if (buf[pos] == '\n') {
+          p_pos = pos+1;
+          p_line++;
+          continue;
+        }
+        if (buf[pos] == '/' && pos+1 < size && buf[pos+1] == '/') {
+          p_pos = skipLine(buf, pos, size);
+          continue;
+        }
+        break;
+      }
+      if (p_pos >= size) return false;
+      // find end of record. Slashes inside quotes do not terminate the
+      // record, but quotes do not extend past the end of a line
+      size_t start = p_pos;
+      size_t end = start;
+      char quote = '\0';
+      while (end < size) {
+        char c = buf[end];
+        if (c == '\n') {
+          quote = '\0';
+          p_line++;
+        } else if (quote != '\0') {
+          if (c == quote) quote = '\0';
+        } else if (c == '\'' || c == '\"') {
+          quote = c;
+        } else if (c == '/') {
+          break;
+        }
+        end++;
+      }
+      if (end < size) {
+        p_pos = skipLine(buf, end, size);
+      } else {
+        p_pos = size;
+      }
+      split(buf+start, buf+end, p_tokens);
+      return true;
+    }
+
+    /**
+     * @return number of tokens in current record
+     */
+    int numTokens() const
+    {
+      return p_tokens.size();
+    }
+
+    /**
+     * @param idx token index
+     * @return token in current record
+     */
+    const PSSEToken& token(int idx) const
+    {
+      return p_tokens[idx];
+    }
+
+    /**
+     * @return all tokens in current record
+     */
+    const std::vector<PSSEToken>& tokens() const
+    {
+      return p_tokens;
+    }
+
+    /**
+     * Copy the tokens in the current record into a vector of strings. The
+     * strings in the vector are reused, so once the vector has been used
+     * for a few records no further allocations take place for tokens that
+     * fit in the short string buffer
+     * @param tokens list of tokens
+     */
+    void getTokens(std::vector<std::string> &tokens) const
+    {
+      copyTokens(p_tokens, tokens);
+    }
+
+    /**
+     * @return number of lines that have been read so far
+     */
+    int lineNumber() const
+    {
+      return p_line;
+    }
+
+    /**
+     * Split a single line into tokens using both commas and blanks as
+     * delimiters. Empty fields between commas are returned as "0"
+     * @param first pointer to first character of line
+     * @param last pointer past last character of line
+     * @param tokens list of tokens pointing into the line
+     */
+    static void split(const char *first, const char *last,
+        std::vector<PSSEToken> &tokens)
+    {
+      tokens.clear();
+      static const char zero[] = "0";
+      const char *field = first;
+      while (true) {
+        // find end of field
+        const char *fend = field;
+        while (fend < last && *fend != ',') fend++;
+        // split field on blanks, keeping quoted strings together
+        const char *ptr = field;
+        bool found = false;
+        while (ptr < fend) {
+          while (ptr < fend && (isBlank(*ptr) || *ptr == '\n')) ptr++;
+          if (ptr == fend) break;
+          const char *tstart = ptr;
+          if (*ptr == '\'' || *ptr == '\"') {
+            char quote = *ptr;
+            ptr++;
+            while (ptr < fend && *ptr != quote) ptr++;
+            if (ptr < fend) ptr++;
+          } else {
+            while (ptr < fend && !isBlank(*ptr) && *ptr != '\n') ptr++;
+          }
+          PSSEToken token;
+          token.ptr = tstart;
+          token.len = ptr-tstart;
+          tokens.push_back(token);
+          found = true;
+        }
+        if (!found) {
+          // empty fields are converted to 0 and 0.0 by atoi and atof
+          PSSEToken token;
+          token.ptr = zero;
+          token.len = 1;
+          tokens.push_back(token);
+        }
+        if (fend == last) break;
+        field = fend+1;
+      }
+    }
+
+    /**
+     * Split a single line into strings using both commas and blanks as
+     * delimiters. This has the same behavior as the splitPSSELine
+     * functions in the PTI parsers
+     * @param line input string from PSS/E file
+     * @param tokens list of tokens parsed from line
+     */
+    static void splitLine(const std::string &line,
+        std::vector<std::string> &tokens)
+    {
+      std::vector<PSSEToken> ptokens;
+      const char *first = line.c_str();
+      split(first, first+line.size(), ptokens);
+      copyTokens(ptokens, tokens);
+    }
+
+  private:
+
+    /**
+     * Copy tokens into a list of strings, reusing the strings in the list
+     * @param ptokens list of tokens
+     * @param tokens list of strings
+     */
+    static void copyTokens(const std::vector<PSSEToken> &ptokens,
+        std::vector<std::string> &tokens)
+    {
+      int ntok = ptokens.size();
+      tokens.resize(ntok);
+      int i;
+      for (i=0; i<ntok; i++) {
+        tokens[i].assign(ptokens[i].ptr, ptokens[i].len);
+      }
+    }
+
+    /**
+     * @param c character
+     * @return true if character is a blank, tab or carriage return
+     */
+    static bool isBlank(char c)
+    {
+      return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    /**
+     * Find the start of the next line
+     * @param buf buffer
+     * @param pos current position in buffer
+     * @param size size of buffer
+     * @return position of first character of the next line
+     */
+    size_t skipLine(const char *buf, size_t pos, size_t size)
+    {
+      while (pos < size && buf[pos] != '\n') pos++;
+      if (pos < size) {
+        pos++;
+        p_line++;
+      }
+      return pos;
+    }
+
+    std::vector<char> p_buffer;
+    size_t p_pos;
+    int p_line;
+    std::vector<PSSEToken> p_tokens;
+};
+
+/**
+ * A single record from a PSS/E file that owns a copy of the line it was
+ * split from, so that its tokens remain valid after the line that was
+ * read from the input stream is overwritten. Records that span multiple
+ * lines (e.g. transformers) use one PSSERecord per line. The buffer and
+ * token list are reused, so splitting a line does not allocate once the
+ * record has seen a line of similar length
+ */
+class PSSERecord {
+  public:
+
+    /**
+     * Basic constructor
+     */
+    PSSERecord()
+    {
+      p_tokens.reserve(64);
+    }
+
+    /**
+     * Basic destructor
+     */
+    ~PSSERecord()
+    {
+    }
+
+    /**
+     * Copy a line into the record and split it into tokens
+     * @param line input string from PSS/E file
+     */
+    void split(const std::string &line)
+    {
+      p_text = line;
+      const char *first = p_text.c_str();
+      PSSETokenizer::split(first, first+p_text.size(), p_tokens);
+    }
+
+    /**
+     * @return number of tokens in record
+     */
+    int size() const
+    {
+      return p_tokens.size();
+    }
+
+    /**
+     * @param idx token index
+     * @return token in record
+     */
+    const PSSEToken& operator[](int idx) const
+    {
+      return p_tokens[idx];
+    }
+
+  private:
+
+    // Tokens point into p_text, so records cannot be copied
+    PSSERecord(const PSSERecord&);
+    PSSERecord& operator=(const PSSERecord&);
+
+    std::string p_text;
+    std::vector<PSSEToken> p_tokens;
+};
+
+}  // parser
+}  // gridpack
+#endif
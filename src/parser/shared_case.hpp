@@ -0,0 +1,463 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   shared_case.hpp
+ * @date   October 19, 2026
+ *
+ * @brief  Read-only image of a parsed network that is shared by all task
+ * groups on a node. Drivers that run many scenarios on task groups created
+ * with Communicator::divide parse the network file once, store the bus and
+ * branch data collections and the network topology in node level shared
+ * memory (MPI-3 shared windows) and create the network on each task group
+ * from this image. Each processor only deserializes the buses and branches
+ * it is given before partitioning, so no processor holds a private copy of
+ * the whole case. Scenario changes are made to the data collections of the
+ * task group and never touch the image.
+ */
+// -------------------------------------------------------------
+
+#ifndef _shared_case_hpp_
+#define _shared_case_hpp_
+
+#include <vector>
+#include <string>
+#include <sstream>
+#include <cstring>
+#include <algorithm>
+#include <mpi.h>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
+#include "gridpack/parallel/communicator.hpp"
+#include "gridpack/timer/memory_tracker.hpp"
+#include "gridpack/parser/base_parser.hpp"
+
+namespace gridpack {
+namespace parser {
+
+template <class _network>
+class SharedCase : public BaseParser<_network>
+{
+  public:
+
+    /**
+     * Constructor
+     * @param comm communicator containing all processors that create
+     * networks from the base case
+     */
+    explicit SharedCase(const gridpack::parallel::Communicator &comm)
+      : p_comm(comm), p_win(MPI_WIN_NULL), p_image(NULL), p_size(0)
+    {
+      MPI_Comm_split_type(static_cast<MPI_Comm>(p_comm),MPI_COMM_TYPE_SHARED,
+          p_comm.rank(),MPI_INFO_NULL,&p_node_comm);
+    }
+
+    /**
+     * Destructor
+     */
+    ~SharedCase()
+    {
+      freeImage();
+      MPI_Comm_free(&p_node_comm);
+    }
+
+    /**
+     * @return communicator containing all processors that use the base case
+     */
+    const gridpack::parallel::Communicator& communicator() const
+    {
+      return p_comm;
+    }
+
+    /**
+     * Copy the buses, branches and network data of a network that has been
+     * read in by one of the parsers into node level shared memory. The
+     * network must be defined on the communicator of the shared case. It
+     * can be partitioned or not, in which case all data is on the first
+     * processor. The network can be discarded afterwards. This is a
+     * collective operation
+     * @param network network containing the base case
+     */
+    void store(boost::shared_ptr<_network> network)
+    {
+      gridpack::utility::CoarseTimer *timer =
+        gridpack::utility::CoarseTimer::instance();
+      int t_store = timer->createCategory("Parser:Store Shared Case");
+      timer->start(t_store);
+      freeImage();
+      int i;
+
+      // serialize locally owned buses and branches. Each record is
+      // described by its global index, original indices and length
+      std::vector<long> lbus, lbranch;
+      std::string lbusbuf, lbranchbuf;
+      int nbus = network->numBuses();
+      for (i=0; i<nbus; i++) {
+        if (!network->getActiveBus(i)) continue;
+        std::string rec = serialize(*network->getBusData(i));
+        lbus.push_back(network->getGlobalBusIndex(i));
+        lbus.push_back(network->getOriginalBusIndex(i));
+        lbus.push_back(rec.size());
+        lbusbuf.append(rec);
+      }
+      int nbranch = network->numBranches();
+      for (i=0; i<nbranch; i++) {
+        if (!network->getActiveBranch(i)) continue;
+        std::string rec = serialize(*network->getBranchData(i));
+        int idx1, idx2;
+        network->getOriginalBranchEndpoints(i,&idx1,&idx2);
+        lbranch.push_back(network->getGlobalBranchIndex(i));
+        lbranch.push_back(idx1);
+        lbranch.push_back(idx2);
+        lbranch.push_back(rec.size());
+        lbranchbuf.append(rec);
+      }
+
+      // gather records on first processor and assemble image
+      std::vector<long> bus, branch;
+      std::string busbuf, branchbuf;
+      gather(lbus,lbusbuf,bus,busbuf);
+      gather(lbranch,lbranchbuf,branch,branchbuf);
+      std::vector<char> image;
+      if (p_comm.rank() == 0) {
+        std::string netbuf = serialize(*network->getNetworkData());
+        long nb = bus.size()/BUS_ENTRY;
+        long nr = branch.size()/BRANCH_ENTRY;
+        long hsize = sizeof(long)*(H_SIZE+BUS_ENTRY*nb+BRANCH_ENTRY*nr);
+        image.resize(hsize+busbuf.size()+branchbuf.size()+netbuf.size());
+        long *h = reinterpret_cast<long*>(&image[0]);
+        h[H_NBUS] = nb;
+        h[H_NBRANCH] = nr;
+        // case parameters are stored with every bus by the parser
+        int id = 0;
+        double sbase = 100.0;
+        if (nb > 0) {
+          gridpack::component::DataCollection data;
+          readBuffer(busbuf.data(),bus[2],data);
+          data.getValue(CASE_ID,&id);
+          data.getValue(CASE_SBASE,&sbase);
+        }
+        h[H_CASE_ID] = id;
+        memcpy(&h[H_CASE_SBASE],&sbase,sizeof(double));
+
+        // buses and branches are stored in order of global index
+        long off = hsize;
+        std::vector<std::pair<long,long> > order;
+        std::vector<long> boff(nb);
+        long bo = 0;
+        for (i=0; i<nb; i++) {
+          order.push_back(std::pair<long,long>(bus[BUS_ENTRY*i],i));
+          boff[i] = bo;
+          bo += bus[BUS_ENTRY*i+2];
+        }
+        std::sort(order.begin(),order.end());
+        long *t = h+H_SIZE;
+        for (i=0; i<nb; i++) {
+          long k = order[i].second;
+          long len = bus[BUS_ENTRY*k+2];
+          t[0] = bus[BUS_ENTRY*k+1];
+          t[1] = off;
+          t[2] = len;
+          memcpy(&image[off],busbuf.data()+boff[k],len);
+          off += len;
+          t += BUS_ENTRY;
+        }
+        order.clear();
+        std::vector<long> roff(nr);
+        long ro = 0;
+        for (i=0; i<nr; i++) {
+          order.push_back(std::pair<long,long>(branch[BRANCH_ENTRY*i],i));
+          roff[i] = ro;
+          ro += branch[BRANCH_ENTRY*i+3];
+        }
+        std::sort(order.begin(),order.end());
+        for (i=0; i<nr; i++) {
+          long k = order[i].second;
+          long len = branch[BRANCH_ENTRY*k+3];
+          t[0] = branch[BRANCH_ENTRY*k+1];
+          t[1] = branch[BRANCH_ENTRY*k+2];
+          t[2] = off;
+          t[3] = len;
+          memcpy(&image[off],branchbuf.data()+roff[k],len);
+          off += len;
+          t += BRANCH_ENTRY;
+        }
+        h[H_NETDATA] = off;
+        h[H_NETDATA_LEN] = netbuf.size();
+        memcpy(&image[off],netbuf.data(),netbuf.size());
+      }
+      shareImage(image);
+      timer->stop(t_store);
+    }
+
+    /**
+     * Create the buses and branches of an empty network from the base
+     * case. Each processor in the network communicator reads a contiguous
+     * block of buses and branches from the image, so the network still
+     * needs to be partitioned afterwards. This is a collective operation on
+     * the network communicator
+     * @param network network that is filled with base case data
+     * @return false if no base case has been stored
+     */
+    bool instantiate(boost::shared_ptr<_network> network)
+    {
+      int me = network->communicator().rank();
+      int nprocs = network->communicator().size();
+      // the image is either present on all processors or on none of them,
+      // so no communication is needed to agree on the error
+      if (p_image == NULL) {
+        if (me == 0) {
+          printf("SharedCase::instantiate: no base case has been stored\n");
+        }
+        return false;
+      }
+      gridpack::utility::CoarseTimer *timer =
+        gridpack::utility::CoarseTimer::instance();
+      int t_inst = timer->createCategory("Parser:Instantiate Shared Case");
+      timer->start(t_inst);
+      long nbus = header(H_NBUS);
+      long nbranch = header(H_NBRANCH);
+      std::vector<boost::shared_ptr<gridpack::component::DataCollection> >
+        busData, branchData;
+      long i;
+      for (i=(nbus*me)/nprocs; i<(nbus*(me+1))/nprocs; i++) {
+        boost::shared_ptr<gridpack::component::DataCollection>
+          data(new gridpack::component::DataCollection);
+        readRecord(busTable(i)+1,*data);
+        busData.push_back(data);
+      }
+      for (i=(nbranch*me)/nprocs; i<(nbranch*(me+1))/nprocs; i++) {
+        boost::shared_ptr<gridpack::component::DataCollection>
+          data(new gridpack::component::DataCollection);
+        readRecord(branchTable(i)+2,*data);
+        branchData.push_back(data);
+      }
+      this->setNetwork(network);
+      this->setCaseID(static_cast<int>(header(H_CASE_ID)));
+      double sbase;
+      memcpy(&sbase,&p_image[H_CASE_SBASE*sizeof(long)],sizeof(double));
+      this->setCaseSBase(sbase);
+      this->createNetwork(busData,branchData);
+      readRecord(reinterpret_cast<const long*>(
+            &p_image[H_NETDATA*sizeof(long)]),*network->getNetworkData());
+      timer->stop(t_inst);
+      return true;
+    }
+
+    /**
+     * @return number of buses in base case
+     */
+    int numBuses() const
+    {
+      return p_image ? static_cast<int>(header(H_NBUS)) : 0;
+    }
+
+    /**
+     * @return number of branches in base case
+     */
+    int numBranches() const
+    {
+      return p_image ? static_cast<int>(header(H_NBRANCH)) : 0;
+    }
+
+    /**
+     * @return size of shared image in bytes. There is one copy of the image
+     * on each node
+     */
+    long imageSize() const
+    {
+      return p_size;
+    }
+
+  private:
+
+    // layout of image header. The header is followed by the bus table
+    // (original index, offset and length of record), the branch table
+    // (original indices of both ends, offset and length of record) and the
+    // serialized records
+    enum Header {H_NBUS, H_NBRANCH, H_CASE_ID, H_CASE_SBASE, H_NETDATA,
+      H_NETDATA_LEN, H_SIZE};
+    static const int BUS_ENTRY = 3;
+    static const int BRANCH_ENTRY = 4;
+
+    /**
+     * Serialize a data collection
+     * @param data data collection
+     * @return serialized data
+     */
+    static std::string serialize(gridpack::component::DataCollection &data)
+    {
+      std::ostringstream ostr(std::ios::binary);
+      {
+        boost::archive::binary_oarchive oarch(ostr);
+        oarch & data;
+      }
+      return ostr.str();
+    }
+
+    /**
+     * Deserialize a data collection
+     * @param buf serialized data
+     * @param len length of serialized data
+     * @param data data collection
+     */
+    static void readBuffer(const char *buf, long len,
+        gridpack::component::DataCollection &data)
+    {
+      std::string s(buf,len);
+      std::istringstream istr(s,std::ios::binary);
+      boost::archive::binary_iarchive iarch(istr);
+      iarch & data;
+    }
+
+    /**
+     * Deserialize a record of the image
+     * @param entry pointer to offset and length of record
+     * @param data data collection
+     */
+    void readRecord(const long *entry,
+        gridpack::component::DataCollection &data) const
+    {
+      readBuffer(p_image+entry[0],entry[1],data);
+    }
+
+    /**
+     * Gather record descriptions and serialized records on first processor
+     * @param lmeta local record descriptions
+     * @param lbuf local serialized records
+     * @param meta record descriptions from all processors
+     * @param buf serialized records from all processors
+     */
+    void gather(std::vector<long> &lmeta, std::string &lbuf,
+        std::vector<long> &meta, std::string &buf)
+    {
+      MPI_Comm comm = static_cast<MPI_Comm>(p_comm);
+      int nprocs = p_comm.size();
+      int i;
+      int lcnt[2];
+      lcnt[0] = lmeta.size();
+      lcnt[1] = lbuf.size();
+      std::vector<int> cnt(2*nprocs);
+      MPI_Gather(lcnt,2,MPI_INT,&cnt[0],2,MPI_INT,0,comm);
+      std::vector<int> mcnt(nprocs), moff(nprocs), bcnt(nprocs), boff(nprocs);
+      int mtot = 0;
+      int btot = 0;
+      if (p_comm.rank() == 0) {
+        for (i=0; i<nprocs; i++) {
+          mcnt[i] = cnt[2*i];
+          bcnt[i] = cnt[2*i+1];
+          moff[i] = mtot;
+          boff[i] = btot;
+          mtot += mcnt[i];
+          btot += bcnt[i];
+        }
+      }
+      meta.resize(mtot);
+      std::vector<char> cbuf(btot+1);
+      if (lmeta.size() == 0) lmeta.push_back(0);
+      MPI_Gatherv(&lmeta[0],lcnt[0],MPI_LONG,
+          mtot > 0 ? &meta[0] : NULL,&mcnt[0],&moff[0],MPI_LONG,0,comm);
+      MPI_Gatherv(const_cast<char*>(lbuf.data()),lcnt[1],MPI_CHAR,
+          &cbuf[0],&bcnt[0],&boff[0],MPI_CHAR,0,comm);
+      buf.assign(&cbuf[0],btot);
+    }
+
+    /**
+     * @return value in image header
+     */
+    long header(int idx) const
+    {
+      return reinterpret_cast<const long*>(p_image)[idx];
+    }
+
+    /**
+     * @return pointer to entry in bus table
+     */
+    const long* busTable(long idx) const
+    {
+      const long *t = reinterpret_cast<const long*>(p_image)+H_SIZE
+        +BUS_ENTRY*idx;
+      return t;
+    }
+
+    /**
+     * @return pointer to entry in branch table
+     */
+    const long* branchTable(long idx) const
+    {
+      const long *t = reinterpret_cast<const long*>(p_image)+H_SIZE
+        +BUS_ENTRY*header(H_NBUS)+BRANCH_ENTRY*idx;
+      return t;
+    }
+
+    /**
+     * Allocate shared window on each node and copy image into it
+     * @param image image, only defined on first processor
+     */
+    void shareImage(std::vector<char> &image)
+    {
+      int me = p_comm.rank();
+      long size = image.size();
+      MPI_Bcast(&size,1,MPI_LONG,0,static_cast<MPI_Comm>(p_comm));
+      p_size = size;
+      int node_rank;
+      MPI_Comm_rank(p_node_comm,&node_rank);
+      char *ptr;
+      MPI_Win_allocate_shared(node_rank == 0 ? size : 0,1,MPI_INFO_NULL,
+          p_node_comm,&ptr,&p_win);
+      MPI_Aint qsize;
+      int disp;
+      MPI_Win_shared_query(p_win,0,&qsize,&disp,&ptr);
+      p_image = ptr;
+      MPI_Win_fence(0,p_win);
+      // first processor on each node receives the image
+      MPI_Comm leaders;
+      MPI_Comm_split(static_cast<MPI_Comm>(p_comm),
+          node_rank == 0 ? 0 : MPI_UNDEFINED,me,&leaders);
+      if (node_rank == 0) {
+        if (me == 0) memcpy(p_image,&image[0],size);
+        long off = 0;
+        while (off < size) {
+          int len = static_cast<int>(std::min(size-off,1L<<30));
+          MPI_Bcast(p_image+off,len,MPI_CHAR,0,leaders);
+          off += len;
+        }
+        MPI_Comm_free(&leaders);
+        gridpack::utility::MemoryTracker *tracker =
+          gridpack::utility::MemoryTracker::instance();
+        tracker->update(tracker->createCategory("Parser: Shared Case"),
+            this,size);
+      }
+      MPI_Win_fence(0,p_win);
+    }
+
+    /**
+     * Release shared window
+     */
+    void freeImage()
+    {
+      if (p_win != MPI_WIN_NULL) {
+        MPI_Win_free(&p_win);
+        gridpack::utility::MemoryTracker *tracker =
+          gridpack::utility::MemoryTracker::instance();
+        tracker->release(tracker->createCategory("Parser: Shared Case"),
+            this);
+      }
+      p_win = MPI_WIN_NULL;
+      p_image = NULL;
+      p_size = 0;
+    }
+
+    gridpack::parallel::Communicator p_comm;
+    MPI_Comm p_node_comm;
+    MPI_Win p_win;
+    char *p_image;
+    long p_size;
+};
+
+} // parser
+} // gridpack
+#endif
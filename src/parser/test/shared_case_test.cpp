@@ -0,0 +1,147 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   shared_case_test.cpp
+ * @date   October 19, 2026
+ *
+ * @brief  Parse a network once, store it as a shared base case and create a
+ * copy of the network on each task group from the shared image. Check that
+ * the copies contain the parsed data and that an empty base case is
+ * rejected
+ */
+// -------------------------------------------------------------
+
+#include <iostream>
+#include <ga.h>
+#include "gridpack/environment/environment.hpp"
+#include "gridpack/parallel/communicator.hpp"
+#include "gridpack/component/base_component.hpp"
+#include "gridpack/network/base_network.hpp"
+#include "gridpack/parser/PTI23_parser.hpp"
+#include "gridpack/parser/shared_case.hpp"
+
+class TestBus
+  : public gridpack::component::BaseBusComponent {
+  public:
+
+  TestBus(void) {
+  }
+
+  ~TestBus(void) {
+  }
+};
+
+class TestBranch
+  : public gridpack::component::BaseBranchComponent {
+  public:
+
+  TestBranch(void) {
+  }
+
+  ~TestBranch(void) {
+  }
+};
+
+typedef gridpack::network::BaseNetwork<TestBus, TestBranch> TestNetwork;
+
+/**
+ * Check contents of DataCollection objects of a network created from
+ * parser_data.raw
+ * @param network network to check
+ * @return number of bad values on this processor
+ */
+int checkNetwork(boost::shared_ptr<TestNetwork> network)
+{
+  int nbus = network->numBuses();
+  int i, idx;
+  int schk = 0;
+  double rval;
+  for (i=0; i<nbus; i++) {
+    network->getBusData(i)->getValue(LOAD_PL,&rval);
+    idx = network->getGlobalBusIndex(i);
+    if (rval != static_cast<double>(idx%100)) schk++;
+    network->getBusData(i)->getValue(LOAD_QL,&rval);
+    if (rval != static_cast<double>((idx+1)%100)) schk++;
+  }
+  int nbranch = network->numBranches();
+  for (i=0; i<nbranch; i++) {
+    network->getBranchData(i)->getValue(BRANCH_RATING_A,&rval,0);
+    idx = network->getGlobalBranchIndex(i);
+    if (rval != static_cast<double>(idx%100)) schk++;
+  }
+  return schk;
+}
+
+// -------------------------------------------------------------
+//  Main Program
+// -------------------------------------------------------------
+int
+main(int argc, char **argv)
+{
+  gridpack::Environment env(argc, argv);
+  int ret = 0;
+  // Create an artificial scope so that all objects call their destructors
+  // before the environment is finalized
+  if (1) {
+    gridpack::parallel::Communicator world;
+    int me = world.rank();
+
+    // Parse network once and store it in shared memory. A base case that
+    // has not been stored cannot be instantiated
+    gridpack::parser::SharedCase<TestNetwork> base(world);
+    int ichk[3];
+    if (1) {
+      boost::shared_ptr<TestNetwork> network(new TestNetwork(world));
+      ichk[2] = base.instantiate(network) ? 1 : 0;
+    }
+    int nbus, nbranch;
+    if (1) {
+      boost::shared_ptr<TestNetwork> network(new TestNetwork(world));
+      gridpack::parser::PTI23_parser<TestNetwork> parser(network);
+      parser.parse("parser_data.raw");
+      nbus = network->totalBuses();
+      nbranch = network->totalBranches();
+      base.store(network);
+    }
+    if (me == 0) {
+      printf("\nShared base case: %d buses %d branches %ld bytes\n",
+          base.numBuses(),base.numBranches(),base.imageSize());
+    }
+
+    // Create network on task groups of two processors
+    int grp_size = world.size() > 1 ? 2 : 1;
+    gridpack::parallel::Communicator task_comm = world.divide(grp_size);
+    boost::shared_ptr<TestNetwork> network(new TestNetwork(task_comm));
+    base.instantiate(network);
+    network->partition();
+
+    ichk[0] = checkNetwork(network);
+    ichk[1] = (network->totalBuses() != nbus ||
+        network->totalBranches() != nbranch) ? 1 : 0;
+
+    world.sum(ichk,3);
+    if (ichk[0] != 0 || ichk[1] != 0 || ichk[2] != 0) ret = 1;
+    if (me == 0) {
+      if (ichk[0] == 0) {
+        printf("\nData of network created from shared case is ok\n");
+      } else {
+        printf("\nError in data of network created from shared case\n");
+      }
+      if (ichk[1] == 0) {
+        printf("\nSize of network created from shared case is ok\n");
+      } else {
+        printf("\nError in size of network created from shared case\n");
+      }
+      if (ichk[2] == 0) {
+        printf("\nMissing shared case is detected\n");
+      } else {
+        printf("\nMissing shared case is not detected\n");
+      }
+    }
+  }
+  return ret;
+}
@@ -0,0 +1,254 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+// -------------------------------------------------------------
+/**
+ * @file   tokenizer_bench.cpp
+ *
+ * @brief  Micro-benchmark comparing the line based parsing of PSS/E
+ * records (getline, boost split and blank tokenizer) with the buffer based
+ * PSSETokenizer. The program generates a synthetic .dyr file, or uses a
+ * file supplied on the command line, parses it with both methods, checks
+ * that the tokens agree and prints the timings.
+ *
+ * Usage: tokenizer_bench [file.dyr] [number of repetitions]
+ */
+// -------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <boost/algorithm/string/split.hpp>
+#include <boost/algorithm/string/classification.hpp>
+#include "gridpack/utilities/string_utils.hpp"
+#include "gridpack/parser/psse_tokenizer.hpp"
+
+/**
+ * @return wall clock time in seconds
+ */
+double wallTime()
+{
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return static_cast<double>(tv.tv_sec) + 1.0e-6*tv.tv_usec;
+}
+
+/**
+ * Generate a synthetic .dyr file containing generator, exciter and
+ * governor records
+ * @param filename name of file
+ * @param ngen number of generators
+ */
+void writeTestFile(const std::string &filename, int ngen)
+{
+  FILE *fp = fopen(filename.c_str(), "w");
+  int i;
+  fprintf(fp,"// synthetic dynamic data file\n");
+  for (i=0; i<ngen; i++) {
+    fprintf(fp,"%d 'GENROU' %d 6.5000 0.60000E-01 0.20000 0.50000E-01"
+        " 5.4000 0.0000\n   1.8000 1.7500 0.30000 0.55000 0.25000"
+        " 0.20000 0.10000 0.30000 /\n", i+1, i%3+1);
+    fprintf(fp,"%d,'IEEET1','%d',0.0,400.0,0.04,7.3,-7.3,1.0,0.8,0.0,"
+        "0.03,1.0,0.0,0.0,0.0,0.0 /\n", i+1, i%3+1);
+    fprintf(fp,"%d 'TGOV1' %d  0.05 0.49 1.05 0.30 1.0 1.0 0.0 /\n",
+        i+1, i%3+1);
+  }
+  fclose(fp);
+}
+
+/**
+ * Parse file using the original line based approach
+ * @param filename name of file
+ * @param records tokens for each record
+ * @return number of tokens
+ */
+long legacyParse(const std::string &filename,
+    std::vector<std::vector<std::string> > &records)
+{
+  gridpack::utility::StringUtils util;
+  std::ifstream input(filename.c_str());
+  std::string line;
+  long ntok = 0;
+  records.clear();
+  while (std::getline(input,line)) {
+    int idx = line.find_first_not_of(' ');
+    int idx2 = line.find_first_not_of('\r');
+    if (idx == std::string::npos || idx2 == std::string::npos) continue;
+    if (line[idx] == '/' && line.length() > idx+1 && line[idx+1] == '/')
+      continue;
+    std::string record = line;
+    idx = line.find('/');
+    while (idx == std::string::npos) {
+      std::getline(input,line);
+      idx = line.find('/');
+      record.append(" ");
+      record.append(line);
+    }
+    // remove carriage returns from files with \r\n line ends
+    idx = record.find('\r');
+    while (idx != std::string::npos) {
+      record[idx] = ' ';
+      idx = record.find('\r');
+    }
+    idx = record.find('/');
+    if (idx != std::string::npos) record.erase(idx,record.length()-idx);
+    std::vector<std::string> split_line;
+    std::vector<std::string> fields;
+    boost::algorithm::split(fields, record, boost::algorithm::is_any_of(","),
+        boost::token_compress_off);
+    int i, j;
+    for (i=0; i<fields.size(); i++) {
+      if (fields[i].find_first_not_of(" \r") == std::string::npos) {
+        split_line.push_back("0");
+      } else {
+        std::vector<std::string> tokens = util.blankTokenizer(fields[i]);
+        for (j=0; j<tokens.size(); j++) {
+          if (tokens[j].find_first_not_of(" \r") == std::string::npos)
+            continue;
+          split_line.push_back(tokens[j]);
+        }
+      }
+    }
+    double sum = 0.0;
+    for (i=3; i<split_line.size(); i++) sum += atof(split_line[i].c_str());
+    if (sum < -1.0e300) printf("unexpected sum\n");
+    ntok += split_line.size();
+    records.push_back(split_line);
+  }
+  return ntok;
+}
+
+/**
+ * Parse file using PSSETokenizer
+ * @param filename name of file
+ * @param records tokens for each record
+ * @return number of tokens
+ */
+long tokenizerParse(const std::string &filename,
+    std::vector<std::vector<std::string> > &records)
+{
+  gridpack::parser::PSSETokenizer tokenizer;
+  long ntok = 0;
+  records.clear();
+  if (!tokenizer.open(filename)) return 0;
+  std::vector<std::string> split_line;
+  while (tokenizer.nextRecord()) {
+    int n = tokenizer.numTokens();
+    int i;
+    double sum = 0.0;
+    for (i=3; i<n; i++) sum += tokenizer.token(i).toDouble();
+    if (sum < -1.0e300) printf("unexpected sum\n");
+    tokenizer.getTokens(split_line);
+    ntok += n;
+    records.push_back(split_line);
+  }
+  return ntok;
+}
+
+/**
+ * Check that values converted directly from tokens agree with the string
+ * conversions used by the parsers before they were switched to tokens
+ * @param filename name of file
+ * @return true if all conversions agree
+ */
+bool checkConversions(const std::string &filename)
+{
+  gridpack::parser::PSSETokenizer tokenizer;
+  gridpack::utility::StringUtils util;
+  if (!tokenizer.open(filename)) return false;
+  std::vector<std::string> split_line;
+  int nrec = 0;
+  while (tokenizer.nextRecord()) {
+    tokenizer.getTokens(split_line);
+    int n = tokenizer.numTokens();
+    int i;
+    if (n > 1 && tokenizer.token(1).unquoted().str()
+        != util.trimQuotes(split_line[1])) {
+      printf("Record %d: model names differ\n",nrec);
+      return false;
+    }
+    if (n > 2 && tokenizer.token(2).tag() != util.clean2Char(split_line[2])) {
+      printf("Record %d: tags differ '%s' '%s'\n",nrec,
+          tokenizer.token(2).tag().c_str(),
+          util.clean2Char(split_line[2]).c_str());
+      return false;
+    }
+    for (i=0; i<n; i++) {
+      if (tokenizer.token(i).toInt() != atoi(split_line[i].c_str()) ||
+          tokenizer.token(i).toDouble() != atof(split_line[i].c_str())) {
+        printf("Record %d token %d: conversions of '%s' differ\n",nrec,i,
+            split_line[i].c_str());
+        return false;
+      }
+    }
+    nrec++;
+  }
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  std::string filename = "tokenizer_bench.dyr";
+  int nrep = 5;
+  if (argc > 1) {
+    filename = argv[1];
+  } else {
+    writeTestFile(filename, 20000);
+  }
+  if (argc > 2) nrep = atoi(argv[2]);
+  if (nrep < 1) nrep = 1;
+
+  std::vector<std::vector<std::string> > legacy, tokens;
+  long nlegacy = 0, ntokens = 0;
+  double tlegacy = 0.0, ttokens = 0.0;
+  int i, j;
+  for (i=0; i<nrep; i++) {
+    double t0 = wallTime();
+    nlegacy = legacyParse(filename, legacy);
+    double t1 = wallTime();
+    ntokens = tokenizerParse(filename, tokens);
+    double t2 = wallTime();
+    tlegacy += t1-t0;
+    ttokens += t2-t1;
+  }
+
+  bool ok = (legacy.size() == tokens.size());
+  for (i=0; ok && i<legacy.size(); i++) {
+    if (legacy[i].size() != tokens[i].size()) {
+      printf("Record %d: token counts differ (%d %d)\n",i,
+          static_cast<int>(legacy[i].size()),
+          static_cast<int>(tokens[i].size()));
+      ok = false;
+      break;
+    }
+    for (j=0; j<legacy[i].size(); j++) {
+      if (legacy[i][j] != tokens[i][j]) {
+        printf("Record %d token %d: '%s' '%s'\n",i,j,legacy[i][j].c_str(),
+            tokens[i][j].c_str());
+        ok = false;
+        break;
+      }
+    }
+  }
+
+  if (ok && !checkConversions(filename)) {
+    printf("Token conversions do not agree with atoi/atof\n");
+    ok = false;
+  }
+
+  printf("Records: %d Tokens: %ld\n",static_cast<int>(tokens.size()),ntokens);
+  printf("Line based parsing:  %12.6f s per pass\n",tlegacy/nrep);
+  printf("PSSETokenizer:       %12.6f s per pass\n",ttokens/nrep);
+  if (ttokens > 0.0) printf("Speedup:             %12.2f\n",tlegacy/ttokens);
+  if (!ok || nlegacy != ntokens) {
+    printf("Tokens from the two parsers do not agree\n");
+    return 1;
+  }
+  return 0;
+}
@@ -25,6 +25,7 @@
 #include "gridpack/network/base_network.hpp"
 #include "gridpack/component/base_component.hpp"
 #include "gridpack/utilities/exception.hpp"
+#include "gridpack/timer/memory_tracker.hpp"
 #ifdef USE_GOSS
 #include "gridpack/serial_io/goss_client.hpp"
 #endif
@@ -69,6 +70,17 @@ class SerialBusIO {
     GA_Set_data(p_maskGA,one,&nbus,C_INT);
     GA_Set_pgroup(p_maskGA, p_GAgrp);
     GA_Allocate(p_maskGA);
+    // Record memory held locally by string and mask arrays
+    int lo, hi;
+    long bytes = 0;
+    NGA_Distribution(p_stringGA, GA_Pgroup_nodeid(p_GAgrp), &lo, &hi);
+    if (lo >= 0 && hi >= lo) {
+      bytes = static_cast<long>(hi-lo+1)*(p_size+sizeof(int));
+    }
+    gridpack::utility::MemoryTracker *tracker
+      = gridpack::utility::MemoryTracker::instance();
+    tracker->update(tracker->createCategory("Serial IO: String Arrays"),
+        this, bytes);
 //#ifdef USE_GOSS
 //    p_goss = NULL;
 //    p_channel = false;
@@ -104,6 +116,10 @@ class SerialBusIO {
     NGA_Deregister_type(p_GA_type);
     GA_Destroy(p_stringGA);
     GA_Destroy(p_maskGA);
+    gridpack::utility::MemoryTracker *tracker
+      = gridpack::utility::MemoryTracker::instance();
+    tracker->release(tracker->createCategory("Serial IO: String Arrays"),
+        this);
     this->close();
   }
 
@@ -699,6 +715,17 @@ class SerialBranchIO {
     GA_Set_pgroup(p_maskGA, p_GAgrp);
     GA_Allocate(p_maskGA);
     p_fout.reset();
+    // Record memory held locally by string and mask arrays
+    int lo, hi;
+    long bytes = 0;
+    NGA_Distribution(p_stringGA, GA_Pgroup_nodeid(p_GAgrp), &lo, &hi);
+    if (lo >= 0 && hi >= lo) {
+      bytes = static_cast<long>(hi-lo+1)*(p_size+sizeof(int));
+    }
+    gridpack::utility::MemoryTracker *tracker
+      = gridpack::utility::MemoryTracker::instance();
+    tracker->update(tracker->createCategory("Serial IO: String Arrays"),
+        this, bytes);
   }
 
   /**
@@ -709,6 +736,10 @@ class SerialBranchIO {
     NGA_Deregister_type(p_GA_type);
     GA_Destroy(p_stringGA);
     GA_Destroy(p_maskGA);
+    gridpack::utility::MemoryTracker *tracker
+      = gridpack::utility::MemoryTracker::instance();
+    tracker->release(tracker->createCategory("Serial IO: String Arrays"),
+        this);
     this->close();
   }
 
@@ -27,7 +27,9 @@ gridpack::utility::CoarseTimer
 
 /**
  * Create a new timer category and return a handle to the category. It is up
- * to the application to keep track of this handle.
+ * to the application to keep track of this handle. Looking up the title is
+ * not free, so categories should be created once outside of time-stepping
+ * or iteration loops and the handle reused.
  * @param title the title is the name that will be used to label the timing
  *        statistics in the output
  * @return an integer handle that can be used to refer to this category
@@ -59,6 +61,7 @@ void gridpack::utility::CoarseTimer::start(const int idx)
   if (!p_profile) return;
   p_start[idx] = MPI_Wtime();
   p_istart[idx]++;
+  p_trace.begin(idx, p_start[idx]);
 }
 
 /**
@@ -68,8 +71,10 @@ void gridpack::utility::CoarseTimer::start(const int idx)
 void gridpack::utility::CoarseTimer::stop(const int idx)
 {
   if (!p_profile) return;
-  p_time[idx] += MPI_Wtime()-p_start[idx];
+  double time = MPI_Wtime();
+  p_time[idx] += time-p_start[idx];
   p_istop[idx]++;
+  p_trace.end(idx, time);
 }
 
 /**
@@ -238,6 +243,34 @@ void gridpack::utility::CoarseTimer::configTimer(bool flag)
   p_profile = flag;
 }
 
+/**
+ * Turn event tracing on and off. When tracing is on, every start and stop
+ * is also recorded as a begin/end event in a fixed size ring buffer on
+ * each processor. Turning tracing on discards any previously recorded
+ * events.
+ * @param flag turn tracing on (true) or off (false)
+ * @param size maximum number of events retained on each processor
+ */
+void gridpack::utility::CoarseTimer::configTrace(bool flag, int size)
+{
+  if (flag) {
+    p_trace.enable(size);
+  } else {
+    p_trace.disable();
+  }
+}
+
+/**
+ * Write recorded trace events from all processors to a file in Chrome
+ * trace-event JSON format. This is a collective operation.
+ * @param filename name of trace file
+ */
+void gridpack::utility::CoarseTimer::dumpTrace(const std::string &filename) const
+{
+  gridpack::parallel::Communicator comm;
+  p_trace.exportChromeTrace(comm, p_title, filename);
+}
+
 /**
  * Return current time. Can be used to solve timing problems that can't be
  * handled using the regular timing capabilities
@@ -11,6 +11,7 @@
 #include <vector>
 
 #include <boost/serialization/export.hpp>
+#include "gridpack/timer/trace_buffer.hpp"
 
 // Simple outline of data collection object
 
@@ -27,7 +28,9 @@ public:
 
   /**
    * Create a new timer category and return a handle to the category. It is up
-   * to the application to keep track of this handle.
+   * to the application to keep track of this handle. Looking up the title
+   * is not free, so categories should be created once outside of
+   * time-stepping or iteration loops and the handle reused.
    * @param title the title is the name that will be used to label the timing
    *        statistics in the output
    * @return an integer handle that can be used to refer to this category
@@ -76,6 +79,24 @@ public:
    */
   void configTimer(bool flag);
 
+  /**
+   * Turn event tracing on and off. When tracing is on, every start and stop
+   * is also recorded as a begin/end event in a fixed size ring buffer on
+   * each processor so that nested timings can be inspected with
+   * chrome://tracing or Perfetto. Turning tracing on discards any
+   * previously recorded events.
+   * @param flag turn tracing on (true) or off (false)
+   * @param size maximum number of events retained on each processor
+   */
+  void configTrace(bool flag, int size = 100000);
+
+  /**
+   * Write recorded trace events from all processors to a file in Chrome
+   * trace-event JSON format. This is a collective operation.
+   * @param filename name of trace file
+   */
+  void dumpTrace(const std::string &filename) const;
+
 protected:
   /**
    * Constructor
@@ -99,6 +120,8 @@ private:
   static CoarseTimer *p_instance;
 
   bool                p_profile;
+
+  TraceBuffer         p_trace;
 };
 
 
@@ -0,0 +1,326 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+
+#include "mpi.h"
+#include <ga.h>
+#include <stdio.h>
+#include <sys/resource.h>
+#include "gridpack/parallel/communicator.hpp"
+#include "gridpack/timer/memory_tracker.hpp"
+
+gridpack::utility::MemoryTracker
+         *gridpack::utility::MemoryTracker::p_instance = NULL;
+
+/**
+ * Retrieve instance of the MemoryTracker object
+ */
+gridpack::utility::MemoryTracker
+         *gridpack::utility::MemoryTracker::instance()
+{
+  if (p_instance == NULL) {
+    p_instance = new MemoryTracker();
+  }
+  return p_instance;
+}
+
+/**
+ * Create a new memory category and return a handle to the category.
+ * Looking up the title is not free, so categories should be created once
+ * and the handle reused.
+ * @param title name used to label the memory statistics in the output
+ * @return an integer handle that can be used to refer to this category
+ */
+int gridpack::utility::MemoryTracker::createCategory(const std::string title)
+{
+  int idx = p_title.size();
+  std::map<std::string, int>::iterator it;
+  it = p_title_map.find(title);
+  if (it != p_title_map.end()) {
+    idx = it->second;
+  } else {
+    p_title_map.insert(std::pair<std::string, int>(title,idx));
+    p_title.push_back(title);
+    p_current.push_back(0);
+    p_peak.push_back(0);
+    p_owners.push_back(std::map<const void*, long>());
+  }
+  return idx;
+}
+
+/**
+ * Change the amount of memory in a category
+ * @param idx category handle
+ * @param bytes change in memory (bytes)
+ */
+void gridpack::utility::MemoryTracker::change(const int idx, const long bytes)
+{
+  p_current[idx] += bytes;
+  if (p_current[idx] > p_peak[idx]) p_peak[idx] = p_current[idx];
+  p_total += bytes;
+  if (p_total > p_peakTotal) p_peakTotal = p_total;
+}
+
+/**
+ * Set the amount of memory held by an object in a category. This
+ * replaces any amount previously set for the same object, so it can be
+ * called whenever the object changes size.
+ * @param idx category handle
+ * @param owner pointer that identifies the object holding the memory
+ * @param bytes number of bytes held by object
+ */
+void gridpack::utility::MemoryTracker::update(const int idx,
+    const void *owner, const long bytes)
+{
+  if (!p_track) return;
+  std::map<const void*, long>::iterator it = p_owners[idx].find(owner);
+  if (it != p_owners[idx].end()) {
+    change(idx, bytes-it->second);
+    it->second = bytes;
+  } else {
+    change(idx, bytes);
+    p_owners[idx].insert(std::pair<const void*, long>(owner,bytes));
+  }
+}
+
+/**
+ * Remove the memory held by an object from a category. This should be
+ * called when the object is destroyed
+ * @param idx category handle
+ * @param owner pointer that identifies the object holding the memory
+ */
+void gridpack::utility::MemoryTracker::release(const int idx,
+    const void *owner)
+{
+  std::map<const void*, long>::iterator it = p_owners[idx].find(owner);
+  if (it != p_owners[idx].end()) {
+    change(idx, -it->second);
+    p_owners[idx].erase(it);
+  }
+}
+
+/**
+ * Add an allocation to a category
+ * @param idx category handle
+ * @param bytes number of bytes allocated
+ */
+void gridpack::utility::MemoryTracker::allocate(const int idx,
+    const long bytes)
+{
+  if (!p_track) return;
+  change(idx, bytes);
+}
+
+/**
+ * Remove an allocation from a category
+ * @param idx category handle
+ * @param bytes number of bytes freed
+ */
+void gridpack::utility::MemoryTracker::deallocate(const int idx,
+    const long bytes)
+{
+  if (!p_track) return;
+  change(idx, -bytes);
+}
+
+/**
+ * @param idx category handle
+ * @return memory currently held in category on this processor (bytes)
+ */
+long gridpack::utility::MemoryTracker::currentUsage(const int idx) const
+{
+  return p_current[idx];
+}
+
+/**
+ * @param idx category handle
+ * @return largest amount of memory held in category on this processor
+ *         (bytes)
+ */
+long gridpack::utility::MemoryTracker::peakUsage(const int idx) const
+{
+  return p_peak[idx];
+}
+
+/**
+ * @return memory currently held in all categories on this processor
+ *         (bytes)
+ */
+long gridpack::utility::MemoryTracker::totalUsage(void) const
+{
+  return p_total;
+}
+
+/**
+ * @return largest value of totalUsage on this processor (bytes)
+ */
+long gridpack::utility::MemoryTracker::peakTotalUsage(void) const
+{
+  return p_peakTotal;
+}
+
+/**
+ * Write current and peak memory usage for all categories to standard
+ * out. Categories are matched across processors by title and need not
+ * exist on all processors. This is a collective operation.
+ */
+void gridpack::utility::MemoryTracker::dump(void) const
+{
+  int me, nproc, i;
+  gridpack::parallel::Communicator comm;
+  MPI_Comm world = static_cast<MPI_Comm>(comm);
+  MPI_Comm_rank(world, &me);
+  MPI_Comm_size(world, &nproc);
+  const double mb = 1.0/(1024.0*1024.0);
+
+  // Categories may be created in a different order, or only on some
+  // processors, so they are matched by title. Gather the titles from all
+  // processors and number them in order of first appearance
+  std::vector<char> sbuf;
+  for (i=0; i<p_title.size(); i++) {
+    sbuf.insert(sbuf.end(),p_title[i].begin(),p_title[i].end());
+    sbuf.push_back('\0');
+  }
+  int len = sbuf.size();
+  std::vector<int> rlen(nproc), offset(nproc);
+  MPI_Allgather(&len,1,MPI_INT,&rlen[0],1,MPI_INT,world);
+  int ntot = 0;
+  for (i=0; i<nproc; i++) {
+    offset[i] = ntot;
+    ntot += rlen[i];
+  }
+  // make sure buffers are not empty so that their addresses are valid
+  sbuf.push_back('\0');
+  std::vector<char> rbuf(ntot+1);
+  MPI_Allgatherv(&sbuf[0],len,MPI_CHAR,&rbuf[0],&rlen[0],&offset[0],
+      MPI_CHAR,world);
+  std::map<std::string, int> title_map;
+  std::vector<std::string> titles;
+  int pos = 0;
+  while (pos < ntot) {
+    std::string title(&rbuf[pos]);
+    pos += title.size()+1;
+    if (title_map.find(title) == title_map.end()) {
+      title_map.insert(std::pair<std::string, int>(title,titles.size()));
+      titles.push_back(title);
+    }
+  }
+  int size = titles.size();
+
+  // Categories, followed by the total over all categories, the peak
+  // resident set size and the memory used by GA
+  int nval = size+3;
+  // Categories that do not exist on this processor hold no memory
+  std::vector<double> sval(2*nval,0.0), smax(2*nval), smin(2*nval),
+    ssum(2*nval);
+  for (i=0; i<p_title.size(); i++) {
+    int k = title_map[p_title[i]];
+    sval[2*k] = static_cast<double>(p_current[i])*mb;
+    sval[2*k+1] = static_cast<double>(p_peak[i])*mb;
+  }
+  sval[2*size] = static_cast<double>(p_total)*mb;
+  sval[2*size+1] = static_cast<double>(p_peakTotal)*mb;
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  // ru_maxrss is in kilobytes on Linux
+  sval[2*size+2] = static_cast<double>(usage.ru_maxrss)/1024.0;
+  sval[2*size+3] = sval[2*size+2];
+  sval[2*size+4] = static_cast<double>(GA_Inquire_memory())*mb;
+  sval[2*size+5] = sval[2*size+4];
+  MPI_Allreduce(&sval[0], &smax[0], 2*nval, MPI_DOUBLE, MPI_MAX, world);
+  MPI_Allreduce(&sval[0], &smin[0], 2*nval, MPI_DOUBLE, MPI_MIN, world);
+  MPI_Allreduce(&sval[0], &ssum[0], 2*nval, MPI_DOUBLE, MPI_SUM, world);
+  if (me != 0) return;
+  double rnp = 1.0/static_cast<double>(nproc);
+  for (i=0; i<nval; i++) {
+    if (i < size && smax[2*i+1] == 0.0) continue;
+    if (i < size) {
+      printf("Memory statistics (MB) for: %s\n",titles[i].c_str());
+    } else if (i == size) {
+      printf("Memory statistics (MB) for: All tracked categories\n");
+    } else if (i == size+1) {
+      printf("Memory statistics (MB) for: Peak resident set size\n");
+    } else {
+      printf("Memory statistics (MB) for: Global Arrays\n");
+    }
+    if (i <= size) {
+      printf("    Current average:   %16.4f\n",ssum[2*i]*rnp);
+      printf("    Current maximum:   %16.4f\n",smax[2*i]);
+      printf("    Current minimum:   %16.4f\n",smin[2*i]);
+      printf("    Peak average:      %16.4f\n",ssum[2*i+1]*rnp);
+      printf("    Peak maximum:      %16.4f\n",smax[2*i+1]);
+      printf("    Peak minimum:      %16.4f\n",smin[2*i+1]);
+    } else {
+      printf("    Average:           %16.4f\n",ssum[2*i]*rnp);
+      printf("    Maximum:           %16.4f\n",smax[2*i]);
+      printf("    Minimum:           %16.4f\n",smin[2*i]);
+    }
+  }
+}
+
+/**
+ * Write out current and peak memory usage on all processors for the
+ * requested category. This is a collective operation.
+ * @param idx category handle
+ */
+void gridpack::utility::MemoryTracker::dumpProfile(const int idx) const
+{
+  int me, nproc, j;
+  gridpack::parallel::Communicator comm;
+  MPI_Comm world = static_cast<MPI_Comm>(comm);
+  MPI_Comm_rank(world, &me);
+  MPI_Comm_size(world, &nproc);
+  const double mb = 1.0/(1024.0*1024.0);
+
+  std::vector<double> sval(2*nproc), rval(2*nproc);
+  for (j=0; j<2*nproc; j++) sval[j] = 0.0;
+  sval[2*me] = static_cast<double>(p_current[idx])*mb;
+  sval[2*me+1] = static_cast<double>(p_peak[idx])*mb;
+  MPI_Allreduce(&sval[0], &rval[0], 2*nproc, MPI_DOUBLE, MPI_SUM, world);
+  if (me == 0) {
+    printf("Memory profile (MB) for: %s\n",p_title[idx].c_str());
+    for (j=0; j<nproc; j++) {
+      printf("    Process[%6d] current: %16.4f peak: %16.4f\n",j,
+          rval[2*j],rval[2*j+1]);
+    }
+  }
+}
+
+/**
+ * Turn memory tracking on and off. If tracking is off, no data is
+ * collected.
+ * @param flag turn tracking on (true) or off (false)
+ */
+void gridpack::utility::MemoryTracker::configTracker(bool flag)
+{
+  p_track = flag;
+}
+
+/**
+ * Constructor
+ */
+gridpack::utility::MemoryTracker::MemoryTracker()
+{
+  p_title_map.clear();
+  p_title.clear();
+  p_current.clear();
+  p_peak.clear();
+  p_owners.clear();
+  p_total = 0;
+  p_peakTotal = 0;
+  p_track = true;
+}
+
+/**
+ * Destructor
+ */
+gridpack::utility::MemoryTracker::~MemoryTracker()
+{
+  p_title_map.clear();
+  p_title.clear();
+  p_current.clear();
+  p_peak.clear();
+  p_owners.clear();
+}
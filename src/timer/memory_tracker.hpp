@@ -0,0 +1,154 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+#ifndef _memory_tracker_h
+#define _memory_tracker_h
+
+#include <map>
+#include <string>
+#include <vector>
+
+// Accounting of memory used by different parts of GridPACK. Allocation
+// sites in the network, mapper, math and serial IO modules report the
+// memory they hold to a category. Current and peak usage for each category
+// are kept on each processor and can be written out, together with the
+// peak resident set size and GA memory usage, in the same way as the
+// CoarseTimer statistics.
+
+namespace gridpack{
+namespace utility{
+
+class MemoryTracker {
+public:
+
+  /**
+   * Retrieve instance of the MemoryTracker object
+   */
+  static MemoryTracker *instance();
+
+  /**
+   * Create a new memory category and return a handle to the category.
+   * Looking up the title is not free, so categories should be created once
+   * and the handle reused.
+   * @param title name used to label the memory statistics in the output
+   * @return an integer handle that can be used to refer to this category
+   */
+  int createCategory(const std::string title);
+
+  /**
+   * Set the amount of memory held by an object in a category. This
+   * replaces any amount previously set for the same object, so it can be
+   * called whenever the object changes size.
+   * @param idx category handle
+   * @param owner pointer that identifies the object holding the memory
+   * @param bytes number of bytes held by object
+   */
+  void update(const int idx, const void *owner, const long bytes);
+
+  /**
+   * Remove the memory held by an object from a category. This should be
+   * called when the object is destroyed
+   * @param idx category handle
+   * @param owner pointer that identifies the object holding the memory
+   */
+  void release(const int idx, const void *owner);
+
+  /**
+   * Add an allocation to a category
+   * @param idx category handle
+   * @param bytes number of bytes allocated
+   */
+  void allocate(const int idx, const long bytes);
+
+  /**
+   * Remove an allocation from a category
+   * @param idx category handle
+   * @param bytes number of bytes freed
+   */
+  void deallocate(const int idx, const long bytes);
+
+  /**
+   * @param idx category handle
+   * @return memory currently held in category on this processor (bytes)
+   */
+  long currentUsage(const int idx) const;
+
+  /**
+   * @param idx category handle
+   * @return largest amount of memory held in category on this processor
+   *         (bytes)
+   */
+  long peakUsage(const int idx) const;
+
+  /**
+   * @return memory currently held in all categories on this processor
+   *         (bytes)
+   */
+  long totalUsage(void) const;
+
+  /**
+   * @return largest value of totalUsage on this processor (bytes)
+   */
+  long peakTotalUsage(void) const;
+
+  /**
+   * Write current and peak memory usage for all categories to standard
+   * out. Categories are matched across processors by title and need not
+   * exist on all processors. This is a collective operation.
+   */
+  void dump(void) const;
+
+  /**
+   * Write out current and peak memory usage on all processors for the
+   * requested category. This is a collective operation.
+   * @param idx category handle
+   */
+  void dumpProfile(const int idx) const;
+
+  /**
+   * Turn memory tracking on and off. If tracking is off, no data is
+   * collected.
+   * @param flag turn tracking on (true) or off (false)
+   */
+  void configTracker(bool flag);
+
+protected:
+  /**
+   * Constructor
+   */
+  MemoryTracker();
+
+  /**
+   * Destructor
+   */
+  ~MemoryTracker();
+
+private:
+
+  /**
+   * Change the amount of memory in a category
+   * @param idx category handle
+   * @param bytes change in memory (bytes)
+   */
+  void change(const int idx, const long bytes);
+
+  std::map<std::string, int> p_title_map;
+  std::vector<std::string> p_title;
+  std::vector<long> p_current;
+  std::vector<long> p_peak;
+  std::vector<std::map<const void*, long> > p_owners;
+  long p_total;
+  long p_peakTotal;
+
+  static MemoryTracker *p_instance;
+
+  bool p_track;
+};
+
+
+}    // utility
+}    // gridpack
+
+#endif // _memory_tracker_h
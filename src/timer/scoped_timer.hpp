@@ -0,0 +1,58 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+#ifndef _scoped_timer_h
+#define _scoped_timer_h
+
+#include "gridpack/timer/coarse_timer.hpp"
+#include "gridpack/timer/local_timer.hpp"
+
+// Timer that starts a category on construction and stops it when it goes
+// out of scope. Scoped timers may be nested; when tracing is enabled the
+// nesting is preserved in the exported trace.
+
+namespace gridpack{
+namespace utility{
+
+template <class _Timer>
+class ScopedTimerT {
+public:
+
+  /**
+   * Constructor. Starts timing the category.
+   * @param timer timer that owns the category
+   * @param idx category handle obtained from createCategory
+   */
+  ScopedTimerT(_Timer *timer, const int idx)
+    : p_timer(timer), p_idx(idx)
+  {
+    p_timer->start(p_idx);
+  }
+
+  /**
+   * Destructor. Stops timing the category.
+   */
+  ~ScopedTimerT()
+  {
+    p_timer->stop(p_idx);
+  }
+
+private:
+
+  // Scoped timers cannot be copied
+  ScopedTimerT(const ScopedTimerT&);
+  ScopedTimerT& operator=(const ScopedTimerT&);
+
+  _Timer *p_timer;
+  int p_idx;
+};
+
+typedef ScopedTimerT<CoarseTimer> ScopedTimer;
+typedef ScopedTimerT<LocalTimer> ScopedLocalTimer;
+
+}    // utility
+}    // gridpack
+
+#endif // _scoped_timer_h
@@ -18,6 +18,10 @@
 #include "gridpack/parallel/distributed.hpp"
 #include "gridpack/timer/coarse_timer.hpp"
 #include "gridpack/timer/local_timer.hpp"
+#include "gridpack/timer/scoped_timer.hpp"
+#include "gridpack/timer/memory_tracker.hpp"
+#include <fstream>
+#include <string>
 
 #define LOOPSIZE 1000000
 
@@ -102,6 +106,129 @@ BOOST_AUTO_TEST_CASE( Timings )
 
 }
 
+BOOST_AUTO_TEST_CASE( Tracing )
+{
+  gridpack::parallel::Communicator world;
+  int me = world.rank();
+  int i, j;
+  double t = 0.0;
+
+  // Trace nested scoped timers
+  gridpack::utility::LocalTimer ltime(world);
+  int t_outer = ltime.createCategory("Trace: \"Outer\"");
+  int t_inner = ltime.createCategory("Trace: Inner");
+  ltime.configTrace(true, 16);
+  for (i=0; i<20; i++) {
+    gridpack::utility::ScopedLocalTimer outer(&ltime, t_outer);
+    for (j=0; j<2; j++) {
+      gridpack::utility::ScopedLocalTimer inner(&ltime, t_inner);
+      t += exp(1.0/static_cast<double>(i+j+1));
+    }
+  }
+  ltime.dumpTrace("test_timer_trace.json");
+  ltime.dump();
+
+  // Check that merged file is well formed enough to be read by a trace
+  // viewer
+  if (me == 0) {
+    std::ifstream fin("test_timer_trace.json");
+    BOOST_REQUIRE(fin.is_open());
+    std::string contents((std::istreambuf_iterator<char>(fin)),
+        std::istreambuf_iterator<char>());
+    BOOST_CHECK(contents.find("\"traceEvents\"") != std::string::npos);
+    BOOST_CHECK(contents.find("\\\"Outer\\\"") != std::string::npos);
+    BOOST_CHECK(contents.find("Trace: Inner") != std::string::npos);
+    BOOST_CHECK(contents.find("\"pid\":0") != std::string::npos);
+    int nbegin = 0;
+    int nend = 0;
+    size_t pos = 0;
+    while ((pos = contents.find("\"ph\":\"B\"",pos)) != std::string::npos) {
+      nbegin++;
+      pos++;
+    }
+    pos = 0;
+    while ((pos = contents.find("\"ph\":\"E\"",pos)) != std::string::npos) {
+      nend++;
+      pos++;
+    }
+    // Ring buffer only holds 16 events per process
+    BOOST_CHECK(nend <= nbegin);
+    BOOST_CHECK(nbegin+nend <= 16*world.size());
+  }
+  ltime.configTrace(false);
+}
+
+BOOST_AUTO_TEST_CASE( MemoryTracking )
+{
+  gridpack::parallel::Communicator world;
+  gridpack::utility::MemoryTracker *tracker =
+    gridpack::utility::MemoryTracker::instance();
+  BOOST_REQUIRE(tracker != NULL);
+
+  int m_objects = tracker->createCategory("MemoryTracker: Objects");
+  int m_buffers = tracker->createCategory("MemoryTracker: Buffers");
+  BOOST_CHECK(m_objects != m_buffers);
+  BOOST_CHECK_EQUAL(tracker->createCategory("MemoryTracker: Objects"),
+      m_objects);
+  long total = tracker->totalUsage();
+
+  // Two objects reporting to the same category. Updating an object
+  // replaces its previous contribution
+  int obj1, obj2;
+  long nbytes = 1024*(world.rank()+1);
+  tracker->update(m_objects, &obj1, nbytes);
+  tracker->update(m_objects, &obj2, 2*nbytes);
+  BOOST_CHECK_EQUAL(tracker->currentUsage(m_objects), 3*nbytes);
+  tracker->update(m_objects, &obj1, 4*nbytes);
+  BOOST_CHECK_EQUAL(tracker->currentUsage(m_objects), 6*nbytes);
+  BOOST_CHECK_EQUAL(tracker->peakUsage(m_objects), 6*nbytes);
+  tracker->release(m_objects, &obj1);
+  BOOST_CHECK_EQUAL(tracker->currentUsage(m_objects), 2*nbytes);
+  BOOST_CHECK_EQUAL(tracker->peakUsage(m_objects), 6*nbytes);
+  // Releasing an object twice has no effect
+  tracker->release(m_objects, &obj1);
+  BOOST_CHECK_EQUAL(tracker->currentUsage(m_objects), 2*nbytes);
+
+  tracker->allocate(m_buffers, nbytes);
+  tracker->allocate(m_buffers, nbytes);
+  tracker->deallocate(m_buffers, nbytes);
+  BOOST_CHECK_EQUAL(tracker->currentUsage(m_buffers), nbytes);
+  BOOST_CHECK_EQUAL(tracker->peakUsage(m_buffers), 2*nbytes);
+  BOOST_CHECK_EQUAL(tracker->totalUsage(), total+3*nbytes);
+
+  // No data is collected when tracking is turned off
+  tracker->configTracker(false);
+  tracker->allocate(m_buffers, nbytes);
+  BOOST_CHECK_EQUAL(tracker->currentUsage(m_buffers), nbytes);
+  tracker->configTracker(true);
+
+  // Categories created in a different order on different processors, and
+  // a category that only exists on some processors, are matched by title
+  int m_first, m_second, m_local;
+  if (world.rank()%2 == 0) {
+    m_first = tracker->createCategory("MemoryTracker: First");
+    m_second = tracker->createCategory("MemoryTracker: Second");
+    m_local = tracker->createCategory("MemoryTracker: Even processors");
+    tracker->allocate(m_local, nbytes);
+  } else {
+    m_second = tracker->createCategory("MemoryTracker: Second");
+    m_first = tracker->createCategory("MemoryTracker: First");
+  }
+  tracker->allocate(m_first, nbytes);
+  tracker->allocate(m_second, 2*nbytes);
+
+  tracker->dump();
+  tracker->dumpProfile(m_objects);
+
+  tracker->deallocate(m_first, nbytes);
+  tracker->deallocate(m_second, 2*nbytes);
+  if (world.rank()%2 == 0) tracker->deallocate(m_local, nbytes);
+
+  tracker->release(m_objects, &obj2);
+  tracker->deallocate(m_buffers, nbytes);
+  BOOST_CHECK_EQUAL(tracker->totalUsage(), total);
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 bool init_function(void)
@@ -0,0 +1,188 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+
+#include "mpi.h"
+#include <stdio.h>
+#include <fstream>
+#include "gridpack/timer/trace_buffer.hpp"
+
+/**
+ * Constructor
+ */
+gridpack::utility::TraceBuffer::TraceBuffer()
+  : p_size(0), p_next(0), p_count(0), p_depth(0), p_dropped(0),
+    p_enabled(false)
+{
+}
+
+/**
+ * Destructor
+ */
+gridpack::utility::TraceBuffer::~TraceBuffer()
+{
+  p_events.clear();
+}
+
+/**
+ * Allocate ring buffer and start recording events. Any previously
+ * recorded events are discarded.
+ * @param size maximum number of events retained on this process. Once the
+ *        buffer is full, the oldest events are overwritten
+ */
+void gridpack::utility::TraceBuffer::enable(int size)
+{
+  if (size < 1) size = 1;
+  p_events.resize(size);
+  p_size = size;
+  p_next = 0;
+  p_count = 0;
+  p_depth = 0;
+  p_dropped = 0;
+  p_enabled = true;
+}
+
+/**
+ * Stop recording events and release buffer
+ */
+void gridpack::utility::TraceBuffer::disable()
+{
+  p_enabled = false;
+  std::vector<TraceEvent>().swap(p_events);
+  p_size = 0;
+  p_next = 0;
+  p_count = 0;
+  p_depth = 0;
+}
+
+/**
+ * @return number of events currently held in buffer
+ */
+int gridpack::utility::TraceBuffer::numEvents() const
+{
+  return p_count;
+}
+
+/**
+ * @return number of events that have been overwritten because the buffer
+ *         was full
+ */
+long gridpack::utility::TraceBuffer::numDropped() const
+{
+  return p_dropped;
+}
+
+/**
+ * Format locally held events as a comma-separated list of JSON objects
+ * @param rank processor rank used as process ID in trace
+ * @param origin time stamp corresponding to zero in the trace
+ * @param titles category titles
+ * @return formatted string
+ */
+std::string gridpack::utility::TraceBuffer::formatEvents(int rank,
+    double origin, const std::vector<std::string> &titles) const
+{
+  std::string ret;
+  char buf[128];
+  sprintf(buf,"{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":0,"
+      "\"args\":{\"name\":\"rank %d\"}}",rank,rank);
+  ret.append(buf);
+  if (p_count == 0) return ret;
+  int first = p_next - p_count;
+  if (first < 0) first += p_size;
+  // Events at the start of a wrapped buffer may be end events whose
+  // matching begin event has been overwritten. These are skipped so that
+  // the exported trace is properly nested.
+  int open = 0;
+  int i;
+  for (i=0; i<p_count; i++) {
+    const TraceEvent &ev = p_events[(first+i)%p_size];
+    if (ev.phase == 'E') {
+      if (open == 0) continue;
+      open--;
+    } else {
+      open++;
+    }
+    ret.append(",\n{\"name\":\"");
+    if (ev.idx >= 0 && ev.idx < static_cast<int>(titles.size())) {
+      const std::string &title = titles[ev.idx];
+      size_t j;
+      for (j=0; j<title.size(); j++) {
+        char c = title[j];
+        if (c == '"' || c == '\\') ret.push_back('\\');
+        if (c >= 0 && c < 32) c = ' ';
+        ret.push_back(c);
+      }
+    } else {
+      sprintf(buf,"category %d",ev.idx);
+      ret.append(buf);
+    }
+    sprintf(buf,"\",\"cat\":\"gridpack\",\"ph\":\"%c\",\"ts\":%.3f,"
+        "\"pid\":%d,\"tid\":0}",ev.phase,(ev.time-origin)*1.0e6,rank);
+    ret.append(buf);
+  }
+  return ret;
+}
+
+/**
+ * Write events from all processors in communicator to a single file in
+ * Chrome trace-event format. Each processor appears as a separate process
+ * in the trace. This is a collective operation on comm.
+ * @param comm communicator over which events are merged
+ * @param titles category titles, indexed by category handle
+ * @param filename name of output file
+ */
+void gridpack::utility::TraceBuffer::exportChromeTrace(
+    const gridpack::parallel::Communicator &comm,
+    const std::vector<std::string> &titles,
+    const std::string &filename) const
+{
+  MPI_Comm mpi_comm = static_cast<MPI_Comm>(comm);
+  int me, nproc, i;
+  MPI_Comm_rank(mpi_comm, &me);
+  MPI_Comm_size(mpi_comm, &nproc);
+
+  // Find a common origin so that all processors share a time axis
+  double origin = MPI_Wtime();
+  if (p_count > 0) {
+    int first = p_next - p_count;
+    if (first < 0) first += p_size;
+    origin = p_events[first].time;
+  }
+  double gorigin;
+  MPI_Allreduce(&origin, &gorigin, 1, MPI_DOUBLE, MPI_MIN, mpi_comm);
+
+  // Format events locally and gather to process 0
+  std::string local = formatEvents(me, gorigin, titles);
+  int len = local.size();
+  std::vector<int> lens(nproc,0);
+  MPI_Gather(&len, 1, MPI_INT, &lens[0], 1, MPI_INT, 0, mpi_comm);
+  std::vector<int> offsets(nproc,0);
+  int total = 0;
+  if (me == 0) {
+    for (i=0; i<nproc; i++) {
+      offsets[i] = total;
+      total += lens[i];
+    }
+  }
+  std::vector<char> all(total+1);
+  MPI_Gatherv(const_cast<char*>(local.c_str()), len, MPI_CHAR, &all[0],
+      &lens[0], &offsets[0], MPI_CHAR, 0, mpi_comm);
+
+  if (me == 0) {
+    std::ofstream fout(filename.c_str());
+    if (!fout.is_open()) {
+      printf("Unable to open trace file: %s\n",filename.c_str());
+      return;
+    }
+    fout << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    for (i=0; i<nproc; i++) {
+      if (i > 0) fout << ",\n";
+      fout.write(&all[offsets[i]], lens[i]);
+    }
+    fout << "\n]}\n";
+    fout.close();
+  }
+}
@@ -0,0 +1,153 @@
+/*
+ *     Copyright (c) 2013 Battelle Memorial Institute
+ *     Licensed under modified BSD License. A copy of this license can be found
+ *     in the LICENSE file in the top level directory of this distribution.
+ */
+#ifndef _trace_buffer_h
+#define _trace_buffer_h
+
+#include <string>
+#include <vector>
+
+#include "gridpack/parallel/communicator.hpp"
+
+// Fixed size ring buffer of begin/end timing events that can be exported to
+// the Chrome trace-event JSON format (readable by chrome://tracing and
+// Perfetto)
+
+namespace gridpack{
+namespace utility{
+
+struct TraceEvent {
+  int    idx;     // category handle
+  int    depth;   // nesting depth at time of event
+  char   phase;   // 'B' for begin, 'E' for end
+  double time;    // time stamp from MPI_Wtime()
+};
+
+class TraceBuffer {
+public:
+
+  /**
+   * Constructor
+   */
+  TraceBuffer();
+
+  /**
+   * Destructor
+   */
+  ~TraceBuffer();
+
+  /**
+   * Allocate ring buffer and start recording events. Any previously
+   * recorded events are discarded.
+   * @param size maximum number of events retained on this process. Once the
+   *        buffer is full, the oldest events are overwritten
+   */
+  void enable(int size);
+
+  /**
+   * Stop recording events and release buffer
+   */
+  void disable();
+
+  /**
+   * @return true if events are currently being recorded
+   */
+  bool enabled() const
+  {
+    return p_enabled;
+  }
+
+  /**
+   * Record a begin event. This is called on the hot path so it does no
+   * allocation.
+   * @param idx category handle
+   * @param time time stamp
+   */
+  void begin(int idx, double time)
+  {
+    if (!p_enabled) return;
+    record(idx, 'B', time);
+    p_depth++;
+  }
+
+  /**
+   * Record an end event
+   * @param idx category handle
+   * @param time time stamp
+   */
+  void end(int idx, double time)
+  {
+    if (!p_enabled) return;
+    if (p_depth > 0) p_depth--;
+    record(idx, 'E', time);
+  }
+
+  /**
+   * @return number of events currently held in buffer
+   */
+  int numEvents() const;
+
+  /**
+   * @return number of events that have been overwritten because the buffer
+   *         was full
+   */
+  long numDropped() const;
+
+  /**
+   * Write events from all processors in communicator to a single file in
+   * Chrome trace-event format. Each processor appears as a separate process
+   * in the trace. This is a collective operation on comm.
+   * @param comm communicator over which events are merged
+   * @param titles category titles, indexed by category handle
+   * @param filename name of output file
+   */
+  void exportChromeTrace(const gridpack::parallel::Communicator &comm,
+      const std::vector<std::string> &titles,
+      const std::string &filename) const;
+
+private:
+
+  /**
+   * Store event in next slot of ring buffer
+   */
+  void record(int idx, char phase, double time)
+  {
+    TraceEvent &ev = p_events[p_next];
+    ev.idx = idx;
+    ev.depth = p_depth;
+    ev.phase = phase;
+    ev.time = time;
+    p_next++;
+    if (p_next == p_size) p_next = 0;
+    if (p_count < p_size) {
+      p_count++;
+    } else {
+      p_dropped++;
+    }
+  }
+
+  /**
+   * Format locally held events as a comma-separated list of JSON objects
+   * @param rank processor rank used as process ID in trace
+   * @param origin time stamp corresponding to zero in the trace
+   * @param titles category titles
+   * @return formatted string
+   */
+  std::string formatEvents(int rank, double origin,
+      const std::vector<std::string> &titles) const;
+
+  std::vector<TraceEvent> p_events;
+  int  p_size;
+  int  p_next;
+  int  p_count;
+  int  p_depth;
+  long p_dropped;
+  bool p_enabled;
+};
+
+}    // utility
+}    // gridpack
+
+#endif // _trace_buffer_h